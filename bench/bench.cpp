@@ -0,0 +1,293 @@
+#include "time.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// Microbenchmarks of the hot paths over array sizes 1 to 10^7, printed as JSON so runs can be diffed between releases.
+//
+// Each case is timed over whole calls, repeated until --min-time seconds have passed (at least once), with any
+// setup run outside the timed region. Allocations are counted by replacing the global operator new, so they
+// cover everything the call does including the worker threads (but not Eigen's dynamic-size matrices, which
+// go to malloc directly; the paths measured here only use fixed-size ones).
+//
+//     bench [--max-size N] [--min-time SECONDS] [--filter SUBSTRING]
+
+std::atomic<int64_t> ALLOCATIONS(0);
+
+// kept out of line, otherwise GCC sees malloc() and free() paired with operator new and delete and warns
+#if defined(__GNUC__)
+    #define BENCH_NOINLINE __attribute__((noinline))
+#else
+    #define BENCH_NOINLINE
+#endif
+
+BENCH_NOINLINE void* operator new(size_t size) {
+    ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+BENCH_NOINLINE void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+BENCH_NOINLINE void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+// keeps the compiler from dropping a result that is never read
+volatile double SINK = 0.0;
+
+struct BenchResult {
+    std::string name;
+    int size;
+    int64_t iterations;
+    double seconds_per_call;
+    double allocations_per_call;
+};
+
+double MIN_TIME = 0.2;
+
+BenchResult run(const std::string& name, int size, const std::function<void()>& setup, const std::function<void()>& body) {
+    int64_t iterations = 0;
+    int64_t allocations = 0;
+    double elapsed = 0.0;
+    while (iterations == 0 || elapsed < MIN_TIME) {
+        setup();
+        int64_t allocations_before = ALLOCATIONS.load();
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        allocations += ALLOCATIONS.load() - allocations_before;
+        elapsed += std::chrono::duration<double>(stop - start).count();
+        iterations++;
+    }
+    return {name, size, iterations, elapsed / iterations, static_cast<double>(allocations) / iterations};
+}
+
+void print_json(const std::vector<BenchResult>& results) {
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::gmtime(&now));
+    printf("{\n  \"context\": {\n");
+    printf("    \"date\": \"%s\",\n", date);
+    printf("    \"num_threads\": %d,\n", get_num_threads());
+    printf("    \"isa\": \"%s\",\n", isa_name(get_isa()));
+#ifdef __VERSION__
+    printf("    \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    printf("    \"min_time\": %g\n  },\n  \"benchmarks\": [\n", MIN_TIME);
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        printf("    {\"name\": \"%s/%d\", \"size\": %d, \"iterations\": %lld, \"ns_per_call\": %.1f, "
+               "\"ns_per_epoch\": %.3f, \"allocations_per_epoch\": %.4f}%s\n",
+               r.name.c_str(), r.size, r.size, static_cast<long long>(r.iterations), r.seconds_per_call * 1e9,
+               r.seconds_per_call * 1e9 / r.size, r.allocations_per_call / r.size, i + 1 < results.size() ? "," : "");
+    }
+    printf("  ]\n}\n");
+}
+
+int main(int argc, char** argv) {
+    int max_size = 10000000;
+    std::string filter;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--max-size")) {
+            max_size = std::atoi(argv[i + 1]);
+        } else if (!std::strcmp(argv[i], "--min-time")) {
+            MIN_TIME = std::atof(argv[i + 1]);
+        } else if (!std::strcmp(argv[i], "--filter")) {
+            filter = argv[i + 1];
+        } else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    const DateTime start(2018, 1, 1, 0, 0, 0, 0);
+    const DateTime end(2018, 1, 2, 0, 0, 0, 0);
+    const double jd_start = start.jd_utc();
+    std::vector<BenchResult> results;
+    auto enabled = [&](const char* name) { return filter.empty() || std::string(name).find(filter) != std::string::npos; };
+    auto nothing = []() {};
+
+    for (int n = 1; n <= max_size; n *= 10) {
+        fprintf(stderr, "size %d\n", n);
+        if (enabled("datetime_construct")) {
+            results.push_back(run("datetime_construct", n, nothing, [&]() {
+                int64_t sum = 0;
+                for (int i = 0; i < n; i++) {
+                    sum += DateTime(2018, 1, 1 + i % 28, i % 24, i % 60, i % 60, i).nanoseconds_since_j2000();
+                }
+                SINK = sum;
+            }));
+        }
+        if (enabled("datetime_itrf_to_j2000")) {
+            results.push_back(run("datetime_itrf_to_j2000", n, nothing, [&]() {
+                double sum = 0.0;
+                for (int i = 0; i < n; i++) {
+                    sum += DateTime(2018, 1, 1, 0, 0, i).itrf_to_j2000()(0, 0);
+                }
+                SINK = sum;
+            }));
+        }
+        if (enabled("jd_to_datetime")) {
+            results.push_back(run("jd_to_datetime", n, nothing, [&]() {
+                int64_t sum = 0;
+                for (int i = 0; i < n; i++) {
+                    sum += jd_to_datetime(jd_start + i * 1e-5).nanoseconds_since_j2000();
+                }
+                SINK = sum;
+            }));
+        }
+        if (enabled("delta_psi_delta_epsilon")) {
+            std::vector<double> T(n), delta_psi(n), delta_eps(n);
+            for (int i = 0; i < n; i++) {
+                T[i] = 0.18 + i * 1e-9;
+            }
+            results.push_back(run("delta_psi_delta_epsilon", n, nothing, [&]() {
+                delta_psi_delta_epsilon(T.data(), n, delta_psi.data(), delta_eps.data());
+                SINK = delta_psi[n - 1];
+            }));
+        }
+        if (enabled("delta_psi_delta_epsilon_13_terms")) {
+            std::vector<double> T(n, 0.18), delta_psi(n), delta_eps(n);
+            results.push_back(run("delta_psi_delta_epsilon_13_terms", n, nothing, [&]() {
+                delta_psi_delta_epsilon<13>(T.data(), n, delta_psi.data(), delta_eps.data());
+                SINK = delta_psi[n - 1];
+            }));
+        }
+        if (enabled("delta_psi_delta_epsilon_4_terms")) {
+            std::vector<double> T(n, 0.18), delta_psi(n), delta_eps(n);
+            results.push_back(run("delta_psi_delta_epsilon_4_terms", n, nothing, [&]() {
+                delta_psi_delta_epsilon<4>(T.data(), n, delta_psi.data(), delta_eps.data());
+                SINK = delta_psi[n - 1];
+            }));
+        }
+        if (enabled("sidereal_time_batch")) {
+            std::vector<double> jd_ut1(n), jd_tt(n), gmst(n), gast(n);
+            for (int i = 0; i < n; i++) {
+                jd_ut1[i] = 2458119.5 + i * 1e-5;
+                jd_tt[i] = jd_ut1[i] + 69.184 / 86400.0;
+            }
+            SiderealTimes out;
+            out.gmst = gmst.data();
+            out.gast = gast.data();
+            results.push_back(run("sidereal_time_batch", n, nothing, [&]() {
+                sidereal_time_batch(jd_ut1.data(), jd_tt.data(), n, out);
+                SINK = gast[n - 1];
+            }));
+        }
+        if (enabled("convert_time_scale_gps_to_utc") || enabled("convert_time_scale_gps_to_ut1")) {
+            // GPS stamps 10 ms apart from the start of 2018
+            std::vector<int64_t> gps(n), out(n);
+            for (int i = 0; i < n; i++) {
+                gps[i] = start.nanoseconds_since_j2000() + 18 * NANOSECONDS_PER_SECOND + i * 10000000LL;
+            }
+            for (TimeScale to : {TimeScale::UTC, TimeScale::UT1}) {
+                const char* name = to == TimeScale::UTC ? "convert_time_scale_gps_to_utc" : "convert_time_scale_gps_to_ut1";
+                if (enabled(name)) {
+                    results.push_back(run(name, n, nothing, [&]() {
+                        convert_time_scale(gps.data(), n, TimeScale::GPS, to, out.data());
+                        SINK = out[n - 1];
+                    }));
+                }
+            }
+        }
+        if (enabled("datetime_linspace")) {
+            results.push_back(run("datetime_linspace", n, nothing, [&]() {
+                SINK = datetime_linspace(start, end, n).size();
+            }));
+        }
+        // the columns are cached on the array, so every call gets a fresh one
+        std::unique_ptr<DateTimeArray> array;
+        auto fresh_array = [&]() { array.reset(new DateTimeArray(datetime_linspace(start, end, n))); };
+        if (enabled("array_shift_in_place")) {
+            const TimeDelta light_time(0, 0, 0, 0, 0, 0, 1234567);
+            results.push_back(run("array_shift_in_place", n, fresh_array, [&]() {
+                *array += light_time;
+                SINK = array->nanoseconds_since_j2000()[n - 1];
+            }));
+        }
+        // the light-time iteration: the columns read before the shift are evaluated again in place
+        if (enabled("array_shift_in_place_cached")) {
+            const TimeDelta light_time(0, 0, 0, 0, 0, 0, 1234567);
+            results.push_back(run("array_shift_in_place_cached", n, [&]() {
+                fresh_array();
+                array->jd_utc();
+                array->gast();
+            }, [&]() {
+                *array += light_time;
+                SINK = array->gast()[n - 1];
+            }));
+        }
+        // 25 bytes of output per site and epoch, the larger sizes would not fit in memory
+        if (enabled("array_look_angles") && n <= 100000) {
+            const int n_sites = 100;
+            std::vector<TopocentricSite> sites;
+            for (int s = 0; s < n_sites; s++) {
+                sites.push_back(geodetic_to_site(-1.2 + 0.024 * s, 0.06 * s, 0.5));
+            }
+            std::vector<double> positions(3 * n);
+            for (int i = 0; i < n; i++) {
+                positions[3 * i] = 7000.0 * cos(1e-3 * i);
+                positions[3 * i + 1] = 7000.0 * sin(1e-3 * i);
+                positions[3 * i + 2] = 1000.0;
+            }
+            std::vector<double> azimuth(n_sites * n), elevation(n_sites * n), range(n_sites * n);
+            std::unique_ptr<bool[]> visible(new bool[n_sites * n]);
+            LookAngles out;
+            out.azimuth = azimuth.data();
+            out.elevation = elevation.data();
+            out.range = range.data();
+            out.visible = visible.get();
+            results.push_back(run("array_look_angles_100_sites", n, fresh_array, [&]() {
+                array->look_angles(positions.data(), sites.data(), n_sites, 0.0, out);
+                SINK = elevation[n - 1];
+            }));
+        }
+        if (enabled("rotation_history_at")) {
+            RotationHistory history = datetime_arange(start, end + TimeDelta(0, 0, 0, 0, 10, 0, 0), TimeDelta(0, 0, 0, 0, 10, 0, 0))
+                                          .rotation_history(Frame::ITRF, Frame::J2000);
+            std::vector<int64_t> epochs = datetime_linspace(start, end, n).tai_nanoseconds_since_j2000();
+            std::vector<Eigen::Quaterniond> quaternions(n);
+            results.push_back(run("rotation_history_at", n, nothing, [&]() {
+                history.at(epochs.data(), n, quaternions.data());
+                SINK = quaternions[n - 1].w();
+            }));
+        }
+        if (enabled("array_itrf_to_j2000_quaternions")) {
+            results.push_back(run("array_itrf_to_j2000_quaternions", n, fresh_array, [&]() {
+                SINK = array->transform_quaternions(Frame::ITRF, Frame::J2000)[n - 1].w();
+            }));
+        }
+        if (enabled("array_gast")) {
+            results.push_back(run("array_gast", n, fresh_array, [&]() {
+                SINK = array->gast()[n - 1];
+            }));
+        }
+        if (enabled("array_itrf_to_j2000")) {
+            results.push_back(run("array_itrf_to_j2000", n, fresh_array, [&]() {
+                SINK = array->itrf_to_j2000()[n - 1](0, 0);
+            }));
+        }
+        if (enabled("array_transform_vectors")) {
+            std::vector<double> positions(3 * n, 7000.0);
+            results.push_back(run("array_transform_vectors", n, fresh_array, [&]() {
+                array->transform_vectors(Frame::ITRF, Frame::J2000, positions.data(), positions.data());
+                SINK = positions[0];
+            }));
+        }
+        array.reset();
+    }
+    print_json(results);
+}
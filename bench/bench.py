@@ -0,0 +1,108 @@
+"""Python-side benchmarks of the sidereal bindings, printed as JSON in the same layout as bench/bench.cpp.
+
+Scalar cases time n calls through the bindings, so against the C++ numbers they show the per-call overhead.
+Batch cases time one call over n epochs on a fresh array, since derived columns are cached on the array.
+
+    python bench/bench.py [--max-size N] [--min-time SECONDS] [--filter SUBSTRING]
+"""
+
+import argparse
+import datetime
+import json
+import sys
+import time
+
+import numpy as np
+import sidereal
+
+
+def run(name, size, body, setup=None, min_time=0.2):
+    iterations = 0
+    elapsed = 0.0
+    while iterations == 0 or elapsed < min_time:
+        state = setup() if setup is not None else None
+        start = time.perf_counter()
+        body(state)
+        elapsed += time.perf_counter() - start
+        iterations += 1
+    seconds_per_call = elapsed / iterations
+    return {
+        "name": f"{name}/{size}",
+        "size": size,
+        "iterations": iterations,
+        "ns_per_call": round(seconds_per_call * 1e9, 1),
+        "ns_per_epoch": round(seconds_per_call * 1e9 / size, 3),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--max-size", type=int, default=1_000_000)
+    parser.add_argument("--min-time", type=float, default=0.2)
+    parser.add_argument("--filter", default="")
+    args = parser.parse_args()
+
+    start = sidereal.DateTime(2018, 1, 1)
+    end = sidereal.DateTime(2018, 1, 2)
+    dt = sidereal.DateTime(2018, 1, 1, 6)
+    F = sidereal.Frame
+
+    def scalar_cases(n):
+        def construct(_):
+            for i in range(n):
+                sidereal.DateTime(2018, 1, 1 + i % 28, i % 24)
+
+        def property_access(_):
+            for _ in range(n):
+                dt.jd_utc
+
+        def scalar_itrf_to_j2000(_):
+            for i in range(n):
+                sidereal.DateTime(2018, 1, 1, 0, 0, i).itrf_to_j2000()
+
+        return {
+            "datetime_construct": (construct, None),
+            "datetime_property": (property_access, None),
+            "datetime_itrf_to_j2000": (scalar_itrf_to_j2000, None),
+        }
+
+    def batch_cases(n):
+        fresh = lambda: sidereal.linspace(start, end, n)
+        positions = np.full((n, 3), 7000.0)
+        return {
+            "linspace": (lambda _: sidereal.linspace(start, end, n), None),
+            "array_column_view": (lambda a: a.jd_utc(), lambda: _evaluated(fresh())),
+            "array_gast": (lambda a: a.gast(), fresh),
+            "array_itrf_to_j2000": (lambda a: a.itrf_to_j2000(), fresh),
+            "array_transform_vectors": (lambda a: a.transform(F.ITRF, F.J2000, positions), fresh),
+        }
+
+    results = []
+    n = 1
+    while n <= args.max_size:
+        print(f"size {n}", file=sys.stderr)
+        cases = {**scalar_cases(n), **batch_cases(n)}
+        for name, (body, setup) in cases.items():
+            if args.filter in name:
+                results.append(run(name, n, body, setup, args.min_time))
+        n *= 10
+
+    context = {
+        "date": datetime.datetime.now(datetime.timezone.utc).strftime("%Y-%m-%dT%H:%M:%S"),
+        "num_threads": sidereal.get_num_threads(),
+        "isa": sidereal.get_isa(),
+        "python": sys.version.split()[0],
+        "numpy": np.__version__,
+        "min_time": args.min_time,
+    }
+    json.dump({"context": context, "benchmarks": results}, sys.stdout, indent=2)
+    print()
+
+
+def _evaluated(array):
+    array.jd_utc()
+    return array
+
+
+if __name__ == "__main__":
+    main()
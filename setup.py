@@ -1,20 +1,28 @@
 from distutils.core import setup
 from pybind11.setup_helpers import Pybind11Extension
 import eigency
+import os
 import platform
 
 std_arg = "-std=c++17"
-opt_arg = "-O3"
+# errno is never read, without it sqrt inlines and the loops calling it vectorize
+opt_args = ["-O3", "-fno-math-errno"]
 if platform.system() == "Windows":
     std_arg = "/std:c++17"
-    opt_arg = "/O2"
+    opt_args = ["/O2"]
+
+# SIDEREAL_PROFILE=1 pip install . compiles in the hot path probes read by sidereal.profile_stats()
+profile = os.environ.get("SIDEREAL_PROFILE", "0") not in ("", "0")
+# SIDEREAL_NUTATION_TERMS=13 pip install . truncates the nutation series (see src/nutation.hpp for the accuracy)
+nutation_terms = os.environ.get("SIDEREAL_NUTATION_TERMS", "106")
 
 ext_modules = [
     Pybind11Extension(
         name="sidereal",
         sources=["src/python_bindings.cpp"],
         include_dirs=["src", *tuple(eigency.get_includes())],
-        extra_compile_args=[std_arg, opt_arg],
+        extra_compile_args=[std_arg, *opt_args],
+        define_macros=[("SIDEREAL_PROFILE", "1" if profile else "0"), ("SIDEREAL_NUTATION_TERMS", nutation_terms)],
     ),
 ]
 
@@ -0,0 +1,233 @@
+#pragma once
+#ifdef _MSC_VER
+    #define _USE_MATH_DEFINES // For MS Visual Studio
+    #include <math.h>
+#else
+    #include <cmath>
+#endif
+#include <cstdint>
+#include <stdexcept>
+#include "dispatch.hpp"
+
+// Calendar kernels: conversions between nanoseconds since J2000, civil dates and day counts (JD, MJD, Unix time).
+//
+// Epochs are stored as a signed 64-bit count of nanoseconds since J2000 (2000-01-01 12:00:00 UTC). Like jd_utc,
+// the count treats every UTC day as 86400 seconds, leap seconds only show up in tai_minus_utc. The int64 range
+// reaches from 1707-09 to 2292-04, epochs from outside are accepted for the years 1708 to 2291 and the
+// checked_* conversions throw std::out_of_range beyond them.
+//
+// The integer conversions are constexpr and branch free, and the batch versions are plain loops over columns
+// with no calls or allocations inside, so the compiler can unroll and (where the target has the instructions)
+// vectorize them. Day numbers to civil dates follow Neri and Schneider, "Euclidean affine functions and their
+// application to calendar algorithms" (2022): one 32-bit division by a constant and a few multiply-shifts.
+
+constexpr int64_t NANOSECONDS_PER_SECOND = 1000000000;
+constexpr int64_t NANOSECONDS_PER_DAY = 86400 * NANOSECONDS_PER_SECOND;
+constexpr int64_t J2000_UNIX_DAYS = 10957; // 2000-01-01 in days since 1970-01-01
+constexpr double JD_J2000 = 2451545.0;
+constexpr double MJD_J2000 = 51544.5;
+constexpr int64_t J2000_UNIX_NANOSECONDS = J2000_UNIX_DAYS * NANOSECONDS_PER_DAY + NANOSECONDS_PER_DAY / 2; // J2000 on the Unix time scale
+
+constexpr int64_t floor_div(int64_t a, int64_t b) {
+    return a / b - ((a % b != 0) & ((a < 0) != (b < 0)));
+}
+
+// days since 1970-01-01 of a proleptic Gregorian date, months outside 1-12 and days past the end of a month roll over
+constexpr int64_t days_from_civil(int64_t year, int64_t month, int64_t day) {
+    int64_t years_carry = floor_div(month - 1, 12);
+    int64_t y = year + years_carry;
+    int64_t m = month - 12 * years_carry;
+    y -= m <= 2;
+    int64_t era = floor_div(y, 400);
+    int64_t yoe = y - era * 400;
+    int64_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5;
+    int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468 + day - 1;
+}
+
+// Inverse of days_from_civil for days in [-12699422, 1061042401] (years -32800 to 2906945). The day count is shifted
+// to be positive and the calendar computed in unsigned 32-bit arithmetic from a March-based year.
+constexpr void civil_from_days(int64_t days, int& year, int& month, int& day) {
+    const uint32_t shift_eras = 82;
+    const uint32_t shift_days = 719468 + 146097 * shift_eras;
+    uint32_t n = static_cast<uint32_t>(days + shift_days);
+    uint32_t n1 = 4 * n + 3;
+    uint32_t century = n1 / 146097;
+    uint32_t day_of_century = n1 % 146097 / 4;
+    uint32_t n2 = 4 * day_of_century + 3;
+    uint64_t p2 = static_cast<uint64_t>(2939745) * n2;
+    uint32_t year_of_century = static_cast<uint32_t>(p2 >> 32);
+    uint32_t day_of_year = static_cast<uint32_t>(p2) / 2939745 / 4;
+    uint32_t n3 = 2141 * day_of_year + 197913;
+    uint32_t march_month = n3 >> 16;
+    uint32_t january = day_of_year >= 306;
+    year = static_cast<int>(100 * century + year_of_century) - static_cast<int>(400 * shift_eras) + static_cast<int>(january);
+    month = static_cast<int>(march_month - 12 * january);
+    day = static_cast<int>((n3 & 65535) / 2141 + 1);
+}
+
+// fields may be negative or overflow their usual range, the result is normalized arithmetically
+constexpr int64_t civil_to_nanoseconds(int year, int month, int day, int hour, int minute, int second, int64_t nanosecond) {
+    int64_t days = days_from_civil(year, month, day) - J2000_UNIX_DAYS;
+    int64_t seconds = (static_cast<int64_t>(hour) * 60 + minute) * 60 + second;
+    return days * NANOSECONDS_PER_DAY + seconds * NANOSECONDS_PER_SECOND + nanosecond - NANOSECONDS_PER_DAY / 2;
+}
+
+// supported epochs [MIN, MAX): 1708-01-01 0h to 2292-01-01 0h, in seconds since J2000
+constexpr int64_t MIN_EPOCH_SECONDS = (days_from_civil(1708, 1, 1) - J2000_UNIX_DAYS) * 86400 - 43200;
+constexpr int64_t MAX_EPOCH_SECONDS = (days_from_civil(2292, 1, 1) - J2000_UNIX_DAYS) * 86400 - 43200;
+constexpr double MIN_EPOCH_DAYS = MIN_EPOCH_SECONDS / 86400.0;
+constexpr double MAX_EPOCH_DAYS = MAX_EPOCH_SECONDS / 86400.0;
+
+const char* const EPOCH_RANGE_ERROR = "epoch outside the supported years 1708 to 2291";
+
+// whether civil_to_nanoseconds stays inside the supported epochs, for any int fields
+constexpr bool civil_in_range(int year, int month, int day, int hour, int minute, int second, int64_t nanosecond) {
+    int64_t seconds = (days_from_civil(year, month, day) - J2000_UNIX_DAYS) * 86400 - 43200
+        + (static_cast<int64_t>(hour) * 60 + minute) * 60 + second + floor_div(nanosecond, NANOSECONDS_PER_SECOND);
+    return seconds >= MIN_EPOCH_SECONDS && seconds < MAX_EPOCH_SECONDS;
+}
+
+// false for NaN as well
+constexpr bool days_in_range(double days_since_j2000) {
+    return days_since_j2000 >= MIN_EPOCH_DAYS && days_since_j2000 < MAX_EPOCH_DAYS;
+}
+
+int64_t checked_civil_to_nanoseconds(int year, int month, int day, int hour, int minute, int second, int64_t nanosecond) {
+    if (!civil_in_range(year, month, day, hour, minute, second, nanosecond)) {
+        throw std::out_of_range(EPOCH_RANGE_ERROR);
+    }
+    return civil_to_nanoseconds(year, month, day, hour, minute, second, nanosecond);
+}
+
+struct CalendarFields {
+    int year;
+    int month;
+    int day;
+    int hour;
+    int minute;
+    int second;
+    int nanosecond;
+};
+
+constexpr CalendarFields nanoseconds_to_calendar(int64_t ns) {
+    int64_t since_midnight = ns + NANOSECONDS_PER_DAY / 2;
+    int64_t days = floor_div(since_midnight, NANOSECONDS_PER_DAY);
+    int64_t time_of_day = since_midnight - days * NANOSECONDS_PER_DAY;
+    int64_t secs = time_of_day / NANOSECONDS_PER_SECOND;
+    CalendarFields fields = {0, 0, 0, 0, 0, 0, 0};
+    civil_from_days(days + J2000_UNIX_DAYS, fields.year, fields.month, fields.day);
+    fields.nanosecond = static_cast<int>(time_of_day - secs * NANOSECONDS_PER_SECOND);
+    fields.hour = static_cast<int>(secs / 3600);
+    fields.minute = static_cast<int>(secs / 60 % 60);
+    fields.second = static_cast<int>(secs % 60);
+    return fields;
+}
+
+constexpr double nanoseconds_to_jd(int64_t ns) {
+    int64_t days = floor_div(ns, NANOSECONDS_PER_DAY);
+    int64_t rem = ns - days * NANOSECONDS_PER_DAY;
+    return (JD_J2000 + days) + rem / static_cast<double>(NANOSECONDS_PER_DAY);
+}
+
+constexpr double nanoseconds_to_unix_seconds(int64_t ns) {
+    int64_t since_unix_epoch = ns + J2000_UNIX_NANOSECONDS;
+    int64_t seconds = floor_div(since_unix_epoch, NANOSECONDS_PER_SECOND);
+    return seconds + (since_unix_epoch - seconds * NANOSECONDS_PER_SECOND) / static_cast<double>(NANOSECONDS_PER_SECOND);
+}
+
+// a real count of units to whole units and nanoseconds, the fraction rounded to the nearest nanosecond
+// (floor by truncating and correcting negative values, which the compiler keeps inline unlike a call to floor)
+constexpr int64_t split_to_nanoseconds(double units, int64_t nanoseconds_per_unit) {
+    int64_t whole = static_cast<int64_t>(units);
+    whole -= whole > units;
+    return whole * nanoseconds_per_unit + static_cast<int64_t>((units - whole) * nanoseconds_per_unit + 0.5);
+}
+
+constexpr int64_t days_to_nanoseconds(double days_since_j2000) {
+    return split_to_nanoseconds(days_since_j2000, NANOSECONDS_PER_DAY);
+}
+
+constexpr int64_t jd_to_nanoseconds(double jd) {
+    return days_to_nanoseconds(jd - JD_J2000);
+}
+
+constexpr int64_t mjd_to_nanoseconds(double mjd) {
+    return days_to_nanoseconds(mjd - MJD_J2000);
+}
+
+// Unix time counts 86400 s per UTC day, so it maps onto the epochs here without leap second handling
+constexpr int64_t unix_seconds_to_nanoseconds(double unix_seconds) {
+    return split_to_nanoseconds(unix_seconds, NANOSECONDS_PER_SECOND) - J2000_UNIX_NANOSECONDS;
+}
+
+// Range checks for the conversions above, which assume epochs the int64 count can hold
+
+constexpr bool jd_in_range(double jd) {
+    return days_in_range(jd - JD_J2000);
+}
+
+constexpr bool mjd_in_range(double mjd) {
+    return days_in_range(mjd - MJD_J2000);
+}
+
+constexpr bool unix_seconds_in_range(double unix_seconds) {
+    return days_in_range((unix_seconds - J2000_UNIX_NANOSECONDS / NANOSECONDS_PER_SECOND) / 86400.0);
+}
+
+constexpr bool unix_nanoseconds_in_range(int64_t unix_nanoseconds) {
+    int64_t seconds = floor_div(unix_nanoseconds, NANOSECONDS_PER_SECOND) - J2000_UNIX_NANOSECONDS / NANOSECONDS_PER_SECOND;
+    return seconds >= MIN_EPOCH_SECONDS && seconds < MAX_EPOCH_SECONDS;
+}
+
+int64_t checked_jd_to_nanoseconds(double jd) {
+    if (!jd_in_range(jd)) {
+        throw std::out_of_range(EPOCH_RANGE_ERROR);
+    }
+    return jd_to_nanoseconds(jd);
+}
+
+// Batch versions over n epochs, built for each instruction set level (see dispatch.hpp)
+
+void nanoseconds_to_jd_kernel(const int64_t* ns, int n, double* jd) {
+    for (int i = 0; i < n; i++) {
+        jd[i] = nanoseconds_to_jd(ns[i]);
+    }
+}
+
+void jd_to_nanoseconds_kernel(const double* jd, int n, int64_t* ns) {
+    for (int i = 0; i < n; i++) {
+        ns[i] = jd_to_nanoseconds(jd[i]);
+    }
+}
+
+void nanoseconds_to_calendar_kernel(const int64_t* ns, int n, int* year, int* month, int* day, int* hour, int* minute,
+                                    int* second, int* nanosecond) {
+    for (int i = 0; i < n; i++) {
+        CalendarFields fields = nanoseconds_to_calendar(ns[i]);
+        year[i] = fields.year;
+        month[i] = fields.month;
+        day[i] = fields.day;
+        hour[i] = fields.hour;
+        minute[i] = fields.minute;
+        second[i] = fields.second;
+        nanosecond[i] = fields.nanosecond;
+    }
+}
+
+void calendar_to_nanoseconds_kernel(const int* year, const int* month, const int* day, const int* hour, const int* minute,
+                                    const int* second, const int64_t* nanosecond, int n, int64_t* ns) {
+    for (int i = 0; i < n; i++) {
+        ns[i] = civil_to_nanoseconds(year[i], month[i], day[i], hour[i], minute[i], second[i], nanosecond[i]);
+    }
+}
+
+SIDEREAL_DISPATCH(nanoseconds_to_jd, (const int64_t* ns, int n, double* jd), (ns, n, jd))
+SIDEREAL_DISPATCH(jd_to_nanoseconds, (const double* jd, int n, int64_t* ns), (jd, n, ns))
+SIDEREAL_DISPATCH(nanoseconds_to_calendar,
+                  (const int64_t* ns, int n, int* year, int* month, int* day, int* hour, int* minute, int* second, int* nanosecond),
+                  (ns, n, year, month, day, hour, minute, second, nanosecond))
+SIDEREAL_DISPATCH(calendar_to_nanoseconds,
+                  (const int* year, const int* month, const int* day, const int* hour, const int* minute, const int* second,
+                   const int64_t* nanosecond, int n, int64_t* ns),
+                  (year, month, day, hour, minute, second, nanosecond, n, ns))
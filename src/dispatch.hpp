@@ -0,0 +1,105 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+// Runtime selection of the instruction set the batch kernels run with.
+//
+// The wheels are built for baseline x86-64 (SSE2), so SIDEREAL_DISPATCH also compiles each kernel for AVX2 + FMA
+// and for AVX-512, and picks one per call from the level chosen at import: the best the CPU supports, lowered by
+// the SIDEREAL_ISA environment variable ("baseline", "avx2" or "avx512") or set_isa() for testing. The kernels
+// are written once, the wider builds are wrappers that inline the whole call tree (flatten) under a target
+// attribute. The levels agree up to rounding: with FMA available the compiler fuses multiply-adds, which changes
+// the last bits of the results (about 1e-14 rad in the angles). Other compilers and architectures get the baseline
+// build only.
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define SIDEREAL_ISA_DISPATCH 1
+    #define SIDEREAL_TARGET_AVX2 __attribute__((target("avx2,fma"), flatten))
+    #define SIDEREAL_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx512vl,avx2,fma"), flatten))
+#else
+    #define SIDEREAL_ISA_DISPATCH 0
+#endif
+
+enum class Isa : int {
+    BASELINE = 0,
+    AVX2 = 1,
+    AVX512 = 2,
+};
+
+const char* isa_name(Isa isa) {
+    switch (isa) {
+        case Isa::AVX512: return "avx512";
+        case Isa::AVX2: return "avx2";
+        default: return "baseline";
+    }
+}
+
+Isa parse_isa(const std::string& name) {
+    for (Isa isa : {Isa::BASELINE, Isa::AVX2, Isa::AVX512}) {
+        if (name == isa_name(isa)) {
+            return isa;
+        }
+    }
+    throw std::invalid_argument("unknown instruction set '" + name + "', expected baseline, avx2 or avx512");
+}
+
+// best level the CPU (and the OS, which has to save the wider registers) supports
+Isa detect_isa() {
+#if SIDEREAL_ISA_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl")) {
+        return Isa::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return Isa::AVX2;
+    }
+#endif
+    return Isa::BASELINE;
+}
+
+// -1 until the first call of get_isa()
+std::atomic<int> SELECTED_ISA(-1);
+
+Isa get_isa() {
+    int selected = SELECTED_ISA.load(std::memory_order_relaxed);
+    if (selected >= 0) {
+        return static_cast<Isa>(selected);
+    }
+    Isa isa = detect_isa();
+    if (const char* requested = std::getenv("SIDEREAL_ISA")) {
+        try {
+            // only ever lowered, a level the CPU lacks would crash on the first kernel
+            isa = std::min(isa, parse_isa(requested));
+        } catch (const std::invalid_argument&) {
+        }
+    }
+    SELECTED_ISA = static_cast<int>(isa);
+    return isa;
+}
+
+void set_isa(Isa isa) {
+    if (isa > detect_isa()) {
+        throw std::invalid_argument(std::string("this CPU does not support ") + isa_name(isa));
+    }
+    SELECTED_ISA = static_cast<int>(isa);
+}
+
+// Defines name(params) running name##_kernel(args) built for the selected level
+#if SIDEREAL_ISA_DISPATCH
+    #define SIDEREAL_DISPATCH(name, params, args) \
+        SIDEREAL_TARGET_AVX512 void name##_avx512 params { name##_kernel args; } \
+        SIDEREAL_TARGET_AVX2 void name##_avx2 params { name##_kernel args; } \
+        void name params { \
+            switch (get_isa()) { \
+                case Isa::AVX512: name##_avx512 args; break; \
+                case Isa::AVX2: name##_avx2 args; break; \
+                default: name##_kernel args; break; \
+            } \
+        }
+#else
+    #define SIDEREAL_DISPATCH(name, params, args) \
+        void name params { name##_kernel args; }
+#endif
@@ -0,0 +1,195 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "calendar.hpp"
+#include "iau1980.hpp"
+#include "profile.hpp"
+
+// Earth orientation and leap second lookup.
+//
+// The table holds one record per UTC day, so finding the values for an epoch is a single index computation
+// floor(mjd_utc) - first_mjd. TAI-UTC is stored per day as well since leap seconds only happen at 0h UTC.
+// Between the records UT1 is interpolated as UT1-TAI, which stays smooth on a day that ends with a leap second
+// where UT1-UTC steps by a second. Outside the tabulated days UT1-UTC and the pole coordinates are held at the
+// nearest record, while TAI-UTC still follows the leap second table (held at its first value before 1972).
+// Tables can also be loaded from IERS files or a memory mapped cache at runtime, see eop_loader.hpp.
+
+// TAI-UTC as steps on the UTC and on the TAI time line, for the batch time scale conversions (time_scales.hpp)
+struct LeapSteps {
+    std::vector<int64_t> utc; // first UTC epoch of each offset [ns since J2000]
+    std::vector<int64_t> tai; // first TAI epoch read back with each offset, the start of the leap second before it
+    std::vector<int64_t> offsets; // TAI-UTC [ns]
+};
+
+struct EopRecord {
+    double tai_minus_utc; // [s]
+    double ut1_minus_utc; // [s]
+    double px; // [arcsec]
+    double py; // [arcsec]
+};
+
+class EopTable {
+    private:
+        std::shared_ptr<const void> storage_; // keeps the arrays below alive
+        int first_mjd_;
+        int n_days_;
+        int n_leaps_;
+        const EopRecord* days_;
+        const double* leap_mjds_;
+        const double* leap_tai_minus_utc_;
+        LeapSteps leap_steps_;
+
+        // index of the last leap second at or before mjd_utc, -1 before the first one
+        int leap_index(double mjd_utc) const {
+            return static_cast<int>(std::upper_bound(leap_mjds_, leap_mjds_ + n_leaps_, mjd_utc) - leap_mjds_) - 1;
+        }
+
+        double leap_value(int index) const {
+            return leap_tai_minus_utc_[std::max(index, 0)];
+        }
+
+        void check() const {
+            if (n_days_ < 1 || n_leaps_ < 1) {
+                throw std::invalid_argument("EOP table needs at least one day and one leap second entry");
+            }
+            if (!std::is_sorted(leap_mjds_, leap_mjds_ + n_leaps_)) {
+                throw std::invalid_argument("EOP leap second dates must be sorted");
+            }
+        }
+
+        void build_leap_steps() {
+            for (int k = 0; k < n_leaps_; k++) {
+                int64_t utc = mjd_to_nanoseconds(leap_mjds_[k]);
+                int64_t offset = llround(leap_tai_minus_utc_[k] * NANOSECONDS_PER_SECOND);
+                leap_steps_.utc.push_back(utc);
+                leap_steps_.tai.push_back(utc + (k > 0 ? leap_steps_.offsets.back() : offset));
+                leap_steps_.offsets.push_back(offset);
+            }
+        }
+
+        struct Owned {
+            std::vector<EopRecord> days;
+            std::vector<double> leap_mjds;
+            std::vector<double> leap_offsets;
+        };
+
+    public:
+        // days[i] holds UT1-UTC, px and py at 0h UTC of mjd first_mjd + i, their TAI-UTC is filled in from the leap seconds
+        EopTable(int first_mjd, std::vector<EopRecord> days, std::vector<double> leap_mjds, std::vector<double> leap_offsets) {
+            auto owned = std::make_shared<Owned>(Owned{std::move(days), std::move(leap_mjds), std::move(leap_offsets)});
+            if (owned->leap_mjds.size() != owned->leap_offsets.size()) {
+                throw std::invalid_argument("EOP leap second dates and offsets differ in length");
+            }
+            storage_ = owned;
+            first_mjd_ = first_mjd;
+            n_days_ = owned->days.size();
+            n_leaps_ = owned->leap_mjds.size();
+            days_ = owned->days.data();
+            leap_mjds_ = owned->leap_mjds.data();
+            leap_tai_minus_utc_ = owned->leap_offsets.data();
+            check();
+            for (int i = 0; i < n_days_; i++) {
+                owned->days[i].tai_minus_utc = leap_value(leap_index(first_mjd_ + i));
+            }
+            build_leap_steps();
+        }
+
+        // views arrays kept alive by storage (a memory mapped file), the days already carry their TAI-UTC
+        EopTable(std::shared_ptr<const void> storage, int first_mjd, const EopRecord* days, int n_days,
+                 const double* leap_mjds, const double* leap_offsets, int n_leaps)
+            : storage_(std::move(storage)), first_mjd_(first_mjd), n_days_(n_days), n_leaps_(n_leaps),
+              days_(days), leap_mjds_(leap_mjds), leap_tai_minus_utc_(leap_offsets) {
+            check();
+            build_leap_steps();
+        }
+
+        int first_mjd() const { return first_mjd_; }
+        int last_mjd() const { return first_mjd_ + n_days_ - 1; }
+        int size() const { return n_days_; }
+        int n_leaps() const { return n_leaps_; }
+        const EopRecord* days() const { return days_; }
+        const double* leap_mjds() const { return leap_mjds_; }
+        const double* leap_offsets() const { return leap_tai_minus_utc_; }
+        const LeapSteps& leap_steps() const { return leap_steps_; }
+
+        // TAI-UTC [s] straight from the leap second table
+        double leap_tai_minus_utc(double mjd_utc) const {
+            return leap_value(leap_index(mjd_utc));
+        }
+
+        // Fills the values for n epochs, any of the outputs may be null. The record for the current day is kept
+        // between epochs, so sorted input only does a lookup when it crosses into a new day, and the leap second
+        // index for days outside the table is advanced from the previous one instead of searched for.
+        void lookup(const double* mjd_utc, int n, double* tai_minus_utc, double* ut1_minus_utc, double* px, double* py) const {
+            PROFILE_SCOPE("eop.lookup", n);
+            double day = NAN;
+            const EopRecord* r0 = nullptr;
+            const EopRecord* r1 = nullptr;
+            bool inside = false;
+            double day_tai_minus_utc = 0.0;
+            double leap_step = 0.0; // leap second at the end of the day, taken out of the next UT1-UTC
+            int leap = -1;
+
+            for (int i = 0; i < n; i++) {
+                double mjd_day = floor(mjd_utc[i]);
+                if (mjd_day != day) {
+                    day = mjd_day;
+                    double index = day - first_mjd_;
+                    inside = index >= 0 && index < size() - 1;
+                    if (inside) {
+                        r0 = &days_[static_cast<int>(index)];
+                        r1 = r0 + 1;
+                        day_tai_minus_utc = r0->tai_minus_utc;
+                        leap_step = r1->tai_minus_utc - r0->tai_minus_utc;
+                    } else {
+                        r0 = r1 = index < 0 ? days_ : days_ + n_days_ - 1;
+                        if (leap >= 0 && day < leap_mjds_[leap]) {
+                            leap = leap_index(day);
+                        }
+                        while (leap + 1 < n_leaps_ && leap_mjds_[leap + 1] <= day) {
+                            leap++;
+                        }
+                        day_tai_minus_utc = leap_value(leap);
+                    }
+                }
+                double frac = inside ? mjd_utc[i] - day : 0.0;
+                if (tai_minus_utc) {
+                    tai_minus_utc[i] = day_tai_minus_utc;
+                }
+                if (ut1_minus_utc) {
+                    ut1_minus_utc[i] = (1 - frac) * r0->ut1_minus_utc + frac * (r1->ut1_minus_utc - leap_step);
+                }
+                if (px) {
+                    px[i] = (1 - frac) * r0->px + frac * r1->px;
+                }
+                if (py) {
+                    py[i] = (1 - frac) * r0->py + frac * r1->py;
+                }
+            }
+        }
+
+        EopRecord lookup(double mjd_utc) const {
+            EopRecord values;
+            lookup(&mjd_utc, 1, &values.tai_minus_utc, &values.ut1_minus_utc, &values.px, &values.py);
+            return values;
+        }
+};
+
+// the table compiled in from iau1980.hpp
+EopTable embedded_eop_table() {
+    int n_days = sizeof(vEOPMJD) / sizeof(vEOPMJD[0]);
+    std::vector<EopRecord> days(n_days);
+    for (int i = 0; i < n_days; i++) {
+        days[i] = {0.0, vUTC_MINUS_UT1[i], vEOPx[i], vEOPy[i]};
+    }
+    int n_leaps = sizeof(vLEAP_JDS) / sizeof(vLEAP_JDS[0]);
+    std::vector<double> leap_mjds(n_leaps);
+    for (int i = 0; i < n_leaps; i++) {
+        leap_mjds[i] = vLEAP_JDS[i] - 2400000.5;
+    }
+    std::vector<double> leap_tai_minus_utc(vTAI_MINUS_UTC, vTAI_MINUS_UTC + n_leaps);
+    return EopTable(static_cast<int>(vEOPMJD[0]), std::move(days), std::move(leap_mjds), std::move(leap_tai_minus_utc));
+}
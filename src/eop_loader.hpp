@@ -0,0 +1,273 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX // keep std::min and std::max usable
+    #endif
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#include "eop.hpp"
+
+// Loading Earth orientation data at runtime.
+//
+// IERS text files are parsed once and written to a compact binary cache, which later processes memory map
+// instead of parsing again. Every lookup goes through current_eop_table(), so a new table can be swapped in
+// while the process runs; quantities already evaluated keep the values of the table they were computed with.
+// The tables compiled into iau1980.hpp are used until something else is loaded, or if the cache named by
+// the SIDEREAL_EOP_CACHE environment variable can't be mapped at startup.
+
+// Cache layout: header, n_days EopRecords, n_leaps leap second dates [mjd], n_leaps TAI-UTC values [s].
+// Everything is stored in the byte order of the machine that wrote it.
+const char EOP_CACHE_MAGIC[8] = {'S', 'I', 'D', 'E', 'O', 'P', 'C', '1'};
+
+struct EopCacheHeader {
+    char magic[8];
+    uint32_t n_days;
+    uint32_t n_leaps;
+    int32_t first_mjd;
+    int32_t reserved;
+};
+
+// Read-only mapping of a whole file, unmapped when the last EopTable viewing it goes away
+class MappedFile {
+    private:
+        const void* data_ = nullptr;
+        size_t size_ = 0;
+#ifdef _WIN32
+        HANDLE file_ = INVALID_HANDLE_VALUE;
+        HANDLE mapping_ = nullptr;
+#endif
+
+    public:
+        explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+            file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error("could not open " + path);
+            }
+            LARGE_INTEGER file_size;
+            GetFileSizeEx(file_, &file_size);
+            size_ = static_cast<size_t>(file_size.QuadPart);
+            mapping_ = size_ ? CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+            data_ = mapping_ ? MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (!data_) {
+                if (mapping_) {
+                    CloseHandle(mapping_);
+                }
+                CloseHandle(file_);
+                throw std::runtime_error("could not map " + path);
+            }
+#else
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error("could not open " + path);
+            }
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size == 0) {
+                close(fd);
+                throw std::runtime_error("could not map " + path);
+            }
+            size_ = static_cast<size_t>(st.st_size);
+            void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (data == MAP_FAILED) {
+                throw std::runtime_error("could not map " + path);
+            }
+            data_ = data;
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile() {
+#ifdef _WIN32
+            UnmapViewOfFile(data_);
+            CloseHandle(mapping_);
+            CloseHandle(file_);
+#else
+            munmap(const_cast<void*>(data_), size_);
+#endif
+        }
+
+        const char* data() const { return static_cast<const char*>(data_); }
+        size_t size() const { return size_; }
+};
+
+std::string read_text_file(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("could not open " + path);
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// parses columns [begin, end) of a fixed width line, false if they are blank or missing
+bool parse_fixed_column(const std::string& line, size_t begin, size_t end, double& value) {
+    if (line.size() <= begin) {
+        return false;
+    }
+    std::string field = line.substr(begin, end - begin);
+    char* parsed_end;
+    value = std::strtod(field.c_str(), &parsed_end);
+    return parsed_end != field.c_str();
+}
+
+// Days of an IERS finals file (finals.all, finals2000A.data, ..., USNO gpsrapid.out uses the same layout), Bulletin A
+// columns. Parsing stops at the first day without polar motion or UT1-UTC, which is where the predictions end.
+std::vector<EopRecord> parse_iers_finals(const std::string& text, int& first_mjd) {
+    std::vector<EopRecord> days;
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line)) {
+        double mjd, px, py, ut1_minus_utc;
+        if (!parse_fixed_column(line, 7, 15, mjd)) {
+            continue;
+        }
+        if (!parse_fixed_column(line, 18, 27, px) || !parse_fixed_column(line, 37, 46, py) || !parse_fixed_column(line, 58, 68, ut1_minus_utc)) {
+            break;
+        }
+        if (days.empty()) {
+            first_mjd = static_cast<int>(mjd);
+        } else if (static_cast<int>(mjd) != first_mjd + static_cast<int>(days.size())) {
+            throw std::runtime_error("IERS finals file skips or repeats a day at MJD " + std::to_string(mjd));
+        }
+        days.push_back({0.0, ut1_minus_utc, px, py});
+    }
+    if (days.empty()) {
+        throw std::runtime_error("no Earth orientation data found in IERS finals file");
+    }
+    return days;
+}
+
+// Leap seconds from a USNO tai-utc.dat file. Entries before 1972 drift linearly with MJD instead of stepping by
+// whole seconds, they are skipped so the table starts at TAI-UTC = 10 s like the embedded one.
+void parse_tai_utc(const std::string& text, std::vector<double>& leap_mjds, std::vector<double>& leap_offsets) {
+    leap_mjds.clear();
+    leap_offsets.clear();
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line)) {
+        size_t jd_at = line.find("=JD");
+        size_t offset_at = line.find("TAI-UTC=");
+        if (jd_at == std::string::npos || offset_at == std::string::npos) {
+            continue;
+        }
+        size_t rate_at = line.find(" X ", offset_at);
+        double rate = rate_at == std::string::npos ? 0.0 : std::strtod(line.c_str() + rate_at + 3, nullptr);
+        if (rate != 0.0) {
+            continue;
+        }
+        leap_mjds.push_back(std::strtod(line.c_str() + jd_at + 3, nullptr) - 2400000.5);
+        leap_offsets.push_back(std::strtod(line.c_str() + offset_at + 8, nullptr));
+    }
+    if (leap_mjds.empty()) {
+        throw std::runtime_error("no leap seconds found in tai-utc file");
+    }
+}
+
+void write_eop_cache(const EopTable& table, const std::string& path) {
+    EopCacheHeader header = {};
+    std::memcpy(header.magic, EOP_CACHE_MAGIC, sizeof(header.magic));
+    header.n_days = table.size();
+    header.n_leaps = table.n_leaps();
+    header.first_mjd = table.first_mjd();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.days()), table.size() * sizeof(EopRecord));
+    file.write(reinterpret_cast<const char*>(table.leap_mjds()), table.n_leaps() * sizeof(double));
+    file.write(reinterpret_cast<const char*>(table.leap_offsets()), table.n_leaps() * sizeof(double));
+    if (!file) {
+        throw std::runtime_error("could not write EOP cache " + path);
+    }
+}
+
+// a table viewing the cache in place, nothing is copied
+std::shared_ptr<const EopTable> map_eop_cache(const std::string& path) {
+    auto file = std::make_shared<const MappedFile>(path);
+    EopCacheHeader header;
+    if (file->size() < sizeof(header)) {
+        throw std::runtime_error(path + " is not an EOP cache");
+    }
+    std::memcpy(&header, file->data(), sizeof(header));
+    size_t expected_size = sizeof(header) + header.n_days * sizeof(EopRecord) + 2 * header.n_leaps * sizeof(double);
+    if (std::memcmp(header.magic, EOP_CACHE_MAGIC, sizeof(header.magic)) != 0 || file->size() != expected_size) {
+        throw std::runtime_error(path + " is not an EOP cache");
+    }
+    const char* data = file->data() + sizeof(header);
+    const EopRecord* days = reinterpret_cast<const EopRecord*>(data);
+    const double* leap_mjds = reinterpret_cast<const double*>(data + header.n_days * sizeof(EopRecord));
+    const double* leap_offsets = leap_mjds + header.n_leaps;
+    return std::make_shared<const EopTable>(file, header.first_mjd, days, header.n_days, leap_mjds, leap_offsets, header.n_leaps);
+}
+
+std::shared_ptr<const EopTable> initial_eop_table() {
+    const char* cache = std::getenv("SIDEREAL_EOP_CACHE");
+    if (cache && *cache) {
+        try {
+            return map_eop_cache(cache);
+        } catch (const std::exception& e) {
+            std::cerr << "sidereal: " << e.what() << ", using the embedded EOP tables" << std::endl;
+        }
+    }
+    return std::make_shared<const EopTable>(embedded_eop_table());
+}
+
+std::shared_ptr<const EopTable> EOP_TABLE = initial_eop_table();
+
+// the table used for lookups right now, callers keep it alive for as long as they use it
+std::shared_ptr<const EopTable> current_eop_table() {
+    return std::atomic_load(&EOP_TABLE);
+}
+
+void set_eop_table(std::shared_ptr<const EopTable> table) {
+    std::atomic_store(&EOP_TABLE, std::move(table));
+}
+
+// Parses IERS finals and (optionally) tai-utc.dat files and swaps the result in. Without a tai-utc file the
+// current leap seconds are kept. With a cache path the table is also written there for map_eop_cache.
+void load_eop(const std::string& finals_path, const std::string& tai_utc_path = "", const std::string& cache_path = "") {
+    int first_mjd = 0;
+    std::vector<EopRecord> days = parse_iers_finals(read_text_file(finals_path), first_mjd);
+    std::vector<double> leap_mjds;
+    std::vector<double> leap_offsets;
+    if (tai_utc_path.empty()) {
+        std::shared_ptr<const EopTable> current = current_eop_table();
+        leap_mjds.assign(current->leap_mjds(), current->leap_mjds() + current->n_leaps());
+        leap_offsets.assign(current->leap_offsets(), current->leap_offsets() + current->n_leaps());
+    } else {
+        parse_tai_utc(read_text_file(tai_utc_path), leap_mjds, leap_offsets);
+    }
+    auto table = std::make_shared<const EopTable>(first_mjd, std::move(days), std::move(leap_mjds), std::move(leap_offsets));
+    if (!cache_path.empty()) {
+        write_eop_cache(*table, cache_path);
+    }
+    set_eop_table(std::move(table));
+}
+
+void load_eop_cache(const std::string& path) {
+    set_eop_table(map_eop_cache(path));
+}
+
+// back to the tables compiled into the extension
+void reset_eop() {
+    set_eop_table(std::make_shared<const EopTable>(embedded_eop_table()));
+}
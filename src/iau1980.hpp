@@ -1,73 +1,148 @@
-// using eigen vectors
-#include "Eigen/Dense"
-
-double vPL[] = {0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, -1, 0, 1, -1, -1, 1,
- 2, -2, 0, 2, 2, 1, 0, 0, -1, 0, 0, -1, 0, 1, 0, 2, -1, 1,
- 1, 0, 0, 0, -2, 1, 2, 0, 1, 0, 0, 1, 2, 2, 0, 1, 0, 1,
- 0, -2, 1, 1, 1, 1, -1, 3, 0, 0, -2, 1, -1, 2, 1, 3, 0, -1,
- 2, 2, 0, 0, 0, -1, 0, -1, 1, -2, 2, 1, 1, -2, -1, 1, 2, 2,
- 1, 0, 3, 1, 0, -1, 0, 0, 0, 1, 0, 1, 1, 2, 0, 0};
-
-double vPLPRIME[] = {0, 0, 0, 0, 1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 1, 0, -1, 0, 0, 0,
- 1, 1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 1, 0,
- 0, 0, -1, 1, 0, -1, -1, 0, -1, -2, 0, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0,
- 0, 0, 0, 0, 1, -1, 0, 0, 1, 0, -1, 1, 0, 0, 0, 1};
-
-double vPF[] = {0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 2, 2, 0, 0, 2, 0, 2,
- 0, 2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, -2, 2, 2,
- 0, 2, 2, 2, 0, 0, 2, 0, 2, 2, 0, 0, 2, 0, 2, 0, 0, -2,
- 0, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 0, 0, 2, 2,
- -2, 0, -2, -2, 0, 0, 2, 0, 0, 2, 0, 2, 2, 2, 4, 0, 2, 2,
- 0, 4, 2, 2, 2, 0, -2, 2, 0, -2, 2, 0, -2, 0, 2, 0};
-
-double vPD[] = {0, -2, 0, 0, 0, 0, -2, 0, 0, -2, -2, -2, 0, 2, 0, 2, 0, 0,
- -2, 0, 2, 0, 0, -2, 0, -2, 0, 0, -2, 2, 0, -2, 0, 0, 2, 2,
- -2, 0, 0, 2, 2, 2, -2, 2, -2, -2, -2, 0, 0, -2, -2, -1, -2, 0,
- 1, 0, -1, 0, 0, 0, 2, 0, 2, -2, 0, 0, -2, 0, 0, 0, 1, 4,
- 0, -2, 2, 2, 0, 1, -2, 0, -4, 2, -4, -2, 2, 4, 0, -2, -2, 2,
- 2, -2, -2, -2, 0, 2, 0, -1, 2, -2, 0, -2, 2, 2, 4, 1};
-
-double vPOMEGA[] = {1, 2, 2, 2, 0, 0, 2, 1, 2, 2, 0, 1, 2, 0, 1, 2, 1, 1, 0, 1, 2, 2, 0, 2,
- 0, 0, 1, 0, 2, 1, 1, 1, 1, 0, 1, 2, 0, 2, 2, 1, 1, 0, 2, 1, 1, 1, 1, 0,
- 1, 1, 1, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 2, 2, 1, 1, 2, 1, 1, 2, 0, 2, 2,
- 1, 0, 1, 0, 2, 1, 0, 2, 0, 2, 0, 2, 1, 2, 2, 0, 1, 2, 1, 2, 2, 0, 1, 1,
- 1, 2, 0, 0, 1, 1, 0, 0, 2, 0};
-
- double vP6[] = {-171996, -13187, -2274, 2062, 1426, 712, -517, -386, -301, 217, -158, 129, 123, 63, 63, -59, -58, -51, 48, 46, -38, -31, 29, 29, 26, -22, 21, 17, -16, 16, -15, -13, -12, 11, -10, -8, -7, 7, -7, -7, -6, 6, 6, -6, 6, -5, -5, 5, -5, 4, 4, -4, -4, 4, -4, -3, -3, -3, 3, -3, -3, -3, -3, -2, -2, 2, -2, 2, -2, 2, 2, -2, 1, 1, 1, -1, 1, 1, -1, 1, -1, 1, -1, 1, -1, -1, 1, 1, 1, -1, -1, 1, 1, -1, 1, 1, -1, -1, -1, -1, -1, -1, -1, 1, -1, 1};
-
- double vP7[] = {-174, -1, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-
- double vP8[] = {92025, 5736, 977, -895, 54, -7, 224, 200, 129, -95, -1, -70, -53, -2, -33, 26, 32, 27, 1, -24, 16, 13, -1, -12, -1, 0, -10, 0, 7, -8, 9, 7, 6, 0, 5, 3, 0, -3, 3, 3, 3, 0, -3, 3, -3, 3, 3, 0, 3, -2, -2, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, -1, 1, -1, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-
- double vP9[] = {8, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+#pragma once
+#include <cstdint>
+
+// IAU 1980 theory of nutation (Seidelmann 1982, Explanatory Supplement to the Astronomical Almanac table 3.222.1).
+//
+// Each term adds (psi + psi_rate * T) * sin(arg) to delta psi and (eps + eps_rate * T) * cos(arg) to delta epsilon,
+// where arg is the sum of its multipliers times the fundamental arguments (l, l', F, D, Omega), T is in julian
+// centuries of TT since J2000 and the amplitudes are in 0.0001 arcseconds. The terms are sorted by decreasing
+// amplitude so the series can be truncated by taking a prefix. Only four terms have rates, they are kept apart.
+
+struct Iau1980Term {
+    int8_t multipliers[5]; // of l, l', F, D, Omega
+    int32_t psi; // sin amplitude of delta psi
+    int32_t eps; // cos amplitude of delta epsilon
+};
+
+struct Iau1980Rate {
+    int term; // index into IAU1980_TERMS
+    int32_t psi; // per julian century
+    int32_t eps; // per julian century
+};
+
+constexpr Iau1980Term IAU1980_TERMS[] = {
+    {{ 0,  0,  0,  0,  1}, -171996,  92025},
+    {{ 0,  0,  2, -2,  2},  -13187,   5736},
+    {{ 0,  0,  2,  0,  2},   -2274,    977},
+    {{ 0,  0,  0,  0,  2},    2062,   -895},
+    {{ 0,  1,  0,  0,  0},    1426,     54},
+    {{ 1,  0,  0,  0,  0},     712,     -7},
+    {{ 0,  1,  2, -2,  2},    -517,    224},
+    {{ 0,  0,  2,  0,  1},    -386,    200},
+    {{ 1,  0,  2,  0,  2},    -301,    129},
+    {{ 0, -1,  2, -2,  2},     217,    -95},
+    {{ 1,  0,  0, -2,  0},    -158,     -1},
+    {{ 0,  0,  2, -2,  1},     129,    -70},
+    {{-1,  0,  2,  0,  2},     123,    -53},
+    {{ 0,  0,  0,  2,  0},      63,     -2},
+    {{ 1,  0,  0,  0,  1},      63,    -33},
+    {{-1,  0,  2,  2,  2},     -59,     26},
+    {{-1,  0,  0,  0,  1},     -58,     32},
+    {{ 1,  0,  2,  0,  1},     -51,     27},
+    {{ 2,  0,  0, -2,  0},      48,      1},
+    {{-2,  0,  2,  0,  1},      46,    -24},
+    {{ 0,  0,  2,  2,  2},     -38,     16},
+    {{ 2,  0,  2,  0,  2},     -31,     13},
+    {{ 2,  0,  0,  0,  0},      29,     -1},
+    {{ 1,  0,  2, -2,  2},      29,    -12},
+    {{ 0,  0,  2,  0,  0},      26,     -1},
+    {{ 0,  0,  2, -2,  0},     -22,      0},
+    {{-1,  0,  2,  0,  1},      21,    -10},
+    {{ 0,  2,  0,  0,  0},      17,      0},
+    {{ 0,  2,  2, -2,  2},     -16,      7},
+    {{-1,  0,  0,  2,  1},      16,     -8},
+    {{ 0,  1,  0,  0,  1},     -15,      9},
+    {{ 1,  0,  0, -2,  1},     -13,      7},
+    {{ 0, -1,  0,  0,  1},     -12,      6},
+    {{ 2,  0, -2,  0,  0},      11,      0},
+    {{-1,  0,  2,  2,  1},     -10,      5},
+    {{ 1,  0,  2,  2,  2},      -8,      3},
+    {{ 1,  1,  0, -2,  0},      -7,      0},
+    {{ 0,  1,  2,  0,  2},       7,     -3},
+    {{ 0, -1,  2,  0,  2},      -7,      3},
+    {{ 0,  0,  2,  2,  1},      -7,      3},
+    {{-2,  0,  0,  2,  1},      -6,      3},
+    {{ 1,  0,  0,  2,  0},       6,      0},
+    {{ 2,  0,  2, -2,  2},       6,     -3},
+    {{ 0,  0,  0,  2,  1},      -6,      3},
+    {{ 1,  0,  2, -2,  1},       6,     -3},
+    {{ 0, -1,  2, -2,  1},      -5,      3},
+    {{ 0,  0,  0, -2,  1},      -5,      3},
+    {{ 1, -1,  0,  0,  0},       5,      0},
+    {{ 2,  0,  2,  0,  1},      -5,      3},
+    {{ 2,  0,  0, -2,  1},       4,     -2},
+    {{ 0,  1,  2, -2,  1},       4,     -2},
+    {{ 1,  0,  0, -1,  0},      -4,      0},
+    {{ 0,  1,  0, -2,  0},      -4,      0},
+    {{ 1,  0, -2,  0,  0},       4,      0},
+    {{ 0,  0,  0,  1,  0},      -4,      0},
+    {{-2,  0,  2,  0,  2},      -3,      1},
+    {{ 1, -1,  0, -1,  0},      -3,      0},
+    {{ 1,  1,  0,  0,  0},      -3,      0},
+    {{ 1,  0,  2,  0,  0},       3,      0},
+    {{ 1, -1,  2,  0,  2},      -3,      1},
+    {{-1, -1,  2,  2,  2},      -3,      1},
+    {{ 3,  0,  2,  0,  2},      -3,      1},
+    {{ 0, -1,  2,  2,  2},      -3,      1},
+    {{ 0, -2,  2, -2,  1},      -2,      1},
+    {{-2,  0,  0,  0,  1},      -2,      1},
+    {{ 1,  1,  2,  0,  2},       2,     -1},
+    {{-1,  0,  2, -2,  1},      -2,      1},
+    {{ 2,  0,  0,  0,  1},       2,     -1},
+    {{ 1,  0,  0,  0,  2},      -2,      1},
+    {{ 3,  0,  0,  0,  0},       2,      0},
+    {{ 0,  0,  2,  1,  2},       2,     -1},
+    {{-1,  0,  2,  4,  2},      -2,      1},
+    {{ 2,  0, -2,  0,  1},       1,      0},
+    {{ 2,  1,  0, -2,  0},       1,      0},
+    {{ 0,  0, -2,  2,  1},       1,      0},
+    {{ 0,  1, -2,  2,  0},      -1,      0},
+    {{ 0,  1,  0,  0,  2},       1,      0},
+    {{-1,  0,  0,  1,  1},       1,      0},
+    {{ 0,  1,  2, -2,  0},      -1,      0},
+    {{-1,  0,  0,  0,  2},       1,     -1},
+    {{ 1,  0,  0, -4,  0},      -1,      0},
+    {{-2,  0,  2,  2,  2},       1,     -1},
+    {{ 2,  0,  0, -4,  0},      -1,      0},
+    {{ 1,  1,  2, -2,  2},       1,     -1},
+    {{ 1,  0,  2,  2,  1},      -1,      1},
+    {{-2,  0,  2,  4,  2},      -1,      1},
+    {{-1,  0,  4,  0,  2},       1,      0},
+    {{ 1, -1,  0, -2,  0},       1,      0},
+    {{ 2,  0,  2, -2,  1},       1,     -1},
+    {{ 2,  0,  2,  2,  2},      -1,      0},
+    {{ 1,  0,  0,  2,  1},      -1,      0},
+    {{ 0,  0,  4, -2,  2},       1,      0},
+    {{ 3,  0,  2, -2,  2},       1,      0},
+    {{ 1,  0,  2, -2,  0},      -1,      0},
+    {{ 0,  1,  2,  0,  1},       1,      0},
+    {{-1, -1,  0,  2,  1},       1,      0},
+    {{ 0,  0, -2,  0,  1},      -1,      0},
+    {{ 0,  0,  2, -1,  2},      -1,      0},
+    {{ 0,  1,  0,  2,  0},      -1,      0},
+    {{ 1,  0, -2, -2,  0},      -1,      0},
+    {{ 0, -1,  2,  0,  1},      -1,      0},
+    {{ 1,  1,  0, -2,  1},      -1,      0},
+    {{ 1,  0, -2,  2,  0},      -1,      0},
+    {{ 2,  0,  0,  2,  0},       1,      0},
+    {{ 0,  0,  2,  4,  2},      -1,      0},
+    {{ 0,  1,  0,  1,  0},       1,      0},
+};
+
+constexpr Iau1980Rate IAU1980_RATES[] = {{0, -174, 8}, {1, -1, -3}, {4, -3, 0}, {6, 1, 0}};
 
 // https://maia.usno.navy.mil/ser7/readme.gpsrapid
 // https://maia.usno.navy.mil/ser7/gpsrapid.out
-double vEOPMJD[] = {48743, 48744, 48745, 48746, 48747, 48748, 48749, 48750, 48751, 48752, 48753, 48754, 48755, 48756, 48757, 48758, 48759, 48760, 48761, 48762, 48763, 48764, 48765, 48766, 48767, 48768, 48769, 48770, 48771, 48772, 48773, 48774, 48775, 48776, 48777, 48778, 48779, 48780, 48781, 48782, 48783, 48784, 48785, 48786, 48787, 48788, 48789, 48790, 48791, 48792, 48793, 48794, 48795, 48796, 48797, 48798, 48799, 48800, 48801, 48802, 48803, 48804, 48805, 48806, 48807, 48808, 48809, 48810, 48811, 48812, 48813, 48814, 48815, 48816, 48817, 48818, 48819, 48820, 48821, 48822, 48823, 48824, 48825, 48826, 48827, 48828, 48829, 48830, 48831, 48832, 48833, 48834, 48835, 48836, 48837, 48838, 48839, 48840, 48841, 48842, 48843, 48844, 48845, 48846, 48847, 48848, 48849, 48850, 48851, 48852, 48853, 48854, 48855, 48856, 48857, 48858, 48859, 48860, 48861, 48862, 48863, 48864, 48865, 48866, 48867, 48868, 48869, 48870, 48871, 48872, 48873, 48874, 48875, 48876, 48877, 48878, 48879, 48880, 48881, 48882, 48883, 48884, 48885, 48886, 48887, 48888, 48889, 48890, 48891, 48892, 48893, 48894, 48895, 48896, 48897, 48898, 48899, 48900, 48901, 48902, 48903, 48904, 48905, 48906, 48907, 48908, 48909, 48910, 48911, 48912, 48913, 48914, 48915, 48916, 48917, 48918, 48919, 48920, 48921, 48922, 48923, 48924, 48925, 48926, 48927, 48928, 48929, 48930, 48931, 48932, 48933, 48934, 48935, 48936, 48937, 48938, 48939, 48940, 48941, 48942, 48943, 48944, 48945, 48946, 48947, 48948, 48949, 48950, 48951, 48952, 48953, 48954, 48955, 48956, 48957, 48958, 48959, 48960, 48961, 48962, 48963, 48964, 48965, 48966, 48967, 48968, 48969, 48970, 48971, 48972, 48973, 48974, 48975, 48976, 48977, 48978, 48979, 48980, 48981, 48982, 48983, 48984, 48985, 48986, 48987, 48988, 48989, 48990, 48991, 48992, 48993, 48994, 48995, 48996, 48997, 48998, 48999, 49000, 49001, 49002, 49003, 49004, 49005, 49006, 49007, 49008, 49009, 49010, 49011, 49012, 49013, 49014, 49015, 49016, 49017, 49018, 49019, 49020, 49021, 49022, 49023, 49024, 49025, 49026, 49027, 49028, 49029, 49030, 49031, 49032, 49033, 49034, 49035, 49036, 49037, 49038, 49039, 49040, 49041, 49042, 49043, 49044, 49045, 49046, 49047, 49048, 49049, 49050, 49051, 49052, 49053, 49054, 49055, 49056, 49057, 49058, 49059, 49060, 49061, 49062, 49063, 49064, 49065, 49066, 49067, 49068, 49069, 49070, 49071, 49072, 49073, 49074, 49075, 49076, 49077, 49078, 49079, 49080, 49081, 49082, 49083, 49084, 49085, 49086, 49087, 49088, 49089, 49090, 49091, 49092, 49093, 49094, 49095, 49096, 49097, 49098, 49099, 49100, 49101, 49102, 49103, 49104, 49105, 49106, 49107, 49108, 49109, 49110, 49111, 49112, 49113, 49114, 49115, 49116, 49117, 49118, 49119, 49120, 49121, 49122, 49123, 49124, 49125, 49126, 49127, 49128, 49129, 49130, 49131, 49132, 49133, 49134, 49135, 49136, 49137, 49138, 49139, 49140, 49141, 49142, 49143, 49144, 49145, 49146, 49147, 49148, 49149, 49150, 49151, 49152, 49153, 49154, 49155, 49156, 49157, 49158, 49159, 49160, 49161, 49162, 49163, 49164, 49165, 49166, 49167, 49168, 49169, 49170, 49171, 49172, 49173, 49174, 49175, 49176, 49177, 49178, 49179, 49180, 49181, 49182, 49183, 49184, 49185, 49186, 49187, 49188, 49189, 49190, 49191, 49192, 49193, 49194, 49195, 49196, 49197, 49198, 49199, 49200, 49201, 49202, 49203, 49204, 49205, 49206, 49207, 49208, 49209, 49210, 49211, 49212, 49213, 49214, 49215, 49216, 49217, 49218, 49219, 49220, 49221, 49222, 49223, 49224, 49225, 49226, 49227, 49228, 49229, 49230, 49231, 49232, 49233, 49234, 49235, 49236, 49237, 49238, 49239, 49240, 49241, 49242, 49243, 49244, 49245, 49246, 49247, 49248, 49249, 49250, 49251, 49252, 49253, 49254, 49255, 49256, 49257, 49258, 49259, 49260, 49261, 49262, 49263, 49264, 49265, 49266, 49267, 49268, 49269, 49270, 49271, 49272, 49273, 49274, 49275, 49276, 49277, 49278, 49279, 49280, 49281, 49282, 49283, 49284, 49285, 49286, 49287, 49288, 49289, 49290, 49291, 49292, 49293, 49294, 49295, 49296, 49297, 49298, 49299, 49300, 49301, 49302, 49303, 49304, 49305, 49306, 49307, 49308, 49309, 49310, 49311, 49312, 49313, 49314, 49315, 49316, 49317, 49318, 49319, 49320, 49321, 49322, 49323, 49324, 49325, 49326, 49327, 49328, 49329, 49330, 49331, 49332, 49333, 49334, 49335, 49336, 49337, 49338, 49339, 49340, 49341, 49342, 49343, 49344, 49345, 49346, 49347, 49348, 49349, 49350, 49351, 49352, 49353, 49354, 49355, 49356, 49357, 49358, 49359, 49360, 49361, 49362, 49363, 49364, 49365, 49366, 49367, 49368, 49369, 49370, 49371, 49372, 49373, 49374, 49375, 49376, 49377, 49378, 49379, 49380, 49381, 49382, 49383, 49384, 49385, 49386, 49387, 49388, 49389, 49390, 49391, 49392, 49393, 49394, 49395, 49396, 49397, 49398, 49399, 49400, 49401, 49402, 49403, 49404, 49405, 49406, 49407, 49408, 49409, 49410, 49411, 49412, 49413, 49414, 49415, 49416, 49417, 49418, 49419, 49420, 49421, 49422, 49423, 49424, 49425, 49426, 49427, 49428, 49429, 49430, 49431, 49432, 49433, 49434, 49435, 49436, 49437, 49438, 49439, 49440, 49441, 49442, 49443, 49444, 49445, 49446, 49447, 49448, 49449, 49450, 49451, 49452, 49453, 49454, 49455, 49456, 49457, 49458, 49459, 49460, 49461, 49462, 49463, 49464, 49465, 49466, 49467, 49468, 49469, 49470, 49471, 49472, 49473, 49474, 49475, 49476, 49477, 49478, 49479, 49480, 49481, 49482, 49483, 49484, 49485, 49486, 49487, 49488, 49489, 49490, 49491, 49492, 49493, 49494, 49495, 49496, 49497, 49498, 49499, 49500, 49501, 49502, 49503, 49504, 49505, 49506, 49507, 49508, 49509, 49510, 49511, 49512, 49513, 49514, 49515, 49516, 49517, 49518, 49519, 49520, 49521, 49522, 49523, 49524, 49525, 49526, 49527, 49528, 49529, 49530, 49531, 49532, 49533, 49534, 49535, 49536, 49537, 49538, 49539, 49540, 49541, 49542, 49543, 49544, 49545, 49546, 49547, 49548, 49549, 49550, 49551, 49552, 49553, 49554, 49555, 49556, 49557, 49558, 49559, 49560, 49561, 49562, 49563, 49564, 49565, 49566, 49567, 49568, 49569, 49570, 49571, 49572, 49573, 49574, 49575, 49576, 49577, 49578, 49579, 49580, 49581, 49582, 49583, 49584, 49585, 49586, 49587, 49588, 49589, 49590, 49591, 49592, 49593, 49594, 49595, 49596, 49597, 49598, 49599, 49600, 49601, 49602, 49603, 49604, 49605, 49606, 49607, 49608, 49609, 49610, 49611, 49612, 49613, 49614, 49615, 49616, 49617, 49618, 49619, 49620, 49621, 49622, 49623, 49624, 49625, 49626, 49627, 49628, 49629, 49630, 49631, 49632, 49633, 49634, 49635, 49636, 49637, 49638, 49639, 49640, 49641, 49642, 49643, 49644, 49645, 49646, 49647, 49648, 49649, 49650, 49651, 49652, 49653, 49654, 49655, 49656, 49657, 49658, 49659, 49660, 49661, 49662, 49663, 49664, 49665, 49666, 49667, 49668, 49669, 49670, 49671, 49672, 49673, 49674, 49675, 49676, 49677, 49678, 49679, 49680, 49681, 49682, 49683, 49684, 49685, 49686, 49687, 49688, 49689, 49690, 49691, 49692, 49693, 49694, 49695, 49696, 49697, 49698, 49699, 49700, 49701, 49702, 49703, 49704, 49705, 49706, 49707, 49708, 49709, 49710, 49711, 49712, 49713, 49714, 49715, 49716, 49717, 49718, 49719, 49720, 49721, 49722, 49723, 49724, 49725, 49726, 49727, 49728, 49729, 49730, 49731, 49732, 49733, 49734, 49735, 49736, 49737, 49738, 49739, 49740, 49741, 49742, 49743, 49744, 49745, 49746, 49747, 49748, 49749, 49750, 49751, 49752, 49753, 49754, 49755, 49756, 49757, 49758, 49759, 49760, 49761, 49762, 49763, 49764, 49765, 49766, 49767, 49768, 49769, 49770, 49771, 49772, 49773, 49774, 49775, 49776, 49777, 49778, 49779, 49780, 49781, 49782, 49783, 49784, 49785, 49786, 49787, 49788, 49789, 49790, 49791, 49792, 49793, 49794, 49795, 49796, 49797, 49798, 49799, 49800, 49801, 49802, 49803, 49804, 49805, 49806, 49807, 49808, 49809, 49810, 49811, 49812, 49813, 49814, 49815, 49816, 49817, 49818, 49819, 49820, 49821, 49822, 49823, 49824, 49825, 49826, 49827, 49828, 49829, 49830, 49831, 49832, 49833, 49834, 49835, 49836, 49837, 49838, 49839, 49840, 49841, 49842, 49843, 49844, 49845, 49846, 49847, 49848, 49849, 49850, 49851, 49852, 49853, 49854, 49855, 49856, 49857, 49858, 49859, 49860, 49861, 49862, 49863, 49864, 49865, 49866, 49867, 49868, 49869, 49870, 49871, 49872, 49873, 49874, 49875, 49876, 49877, 49878, 49879, 49880, 49881, 49882, 49883, 49884, 49885, 49886, 49887, 49888, 49889, 49890, 49891, 49892, 49893, 49894, 49895, 49896, 49897, 49898, 49899, 49900, 49901, 49902, 49903, 49904, 49905, 49906, 49907, 49908, 49909, 49910, 49911, 49912, 49913, 49914, 49915, 49916, 49917, 49918, 49919, 49920, 49921, 49922, 49923, 49924, 49925, 49926, 49927, 49928, 49929, 49930, 49931, 49932, 49933, 49934, 49935, 49936, 49937, 49938, 49939, 49940, 49941, 49942, 49943, 49944, 49945, 49946, 49947, 49948, 49949, 49950, 49951, 49952, 49953, 49954, 49955, 49956, 49957, 49958, 49959, 49960, 49961, 49962, 49963, 49964, 49965, 49966, 49967, 49968, 49969, 49970, 49971, 49972, 49973, 49974, 49975, 49976, 49977, 49978, 49979, 49980, 49981, 49982, 49983, 49984, 49985, 49986, 49987, 49988, 49989, 49990, 49991, 49992, 49993, 49994, 49995, 49996, 49997, 49998, 49999, 50000, 50001, 50002, 50003, 50004, 50005, 50006, 50007, 50008, 50009, 50010, 50011, 50012, 50013, 50014, 50015, 50016, 50017, 50018, 50019, 50020, 50021, 50022, 50023, 50024, 50025, 50026, 50027, 50028, 50029, 50030, 50031, 50032, 50033, 50034, 50035, 50036, 50037, 50038, 50039, 50040, 50041, 50042, 50043, 50044, 50045, 50046, 50047, 50048, 50049, 50050, 50051, 50052, 50053, 50054, 50055, 50056, 50057, 50058, 50059, 50060, 50061, 50062, 50063, 50064, 50065, 50066, 50067, 50068, 50069, 50070, 50071, 50072, 50073, 50074, 50075, 50076, 50077, 50078, 50079, 50080, 50081, 50082, 50083, 50084, 50085, 50086, 50087, 50088, 50089, 50090, 50091, 50092, 50093, 50094, 50095, 50096, 50097, 50098, 50099, 50100, 50101, 50102, 50103, 50104, 50105, 50106, 50107, 50108, 50109, 50110, 50111, 50112, 50113, 50114, 50115, 50116, 50117, 50118, 50119, 50120, 50121, 50122, 50123, 50124, 50125, 50126, 50127, 50128, 50129, 50130, 50131, 50132, 50133, 50134, 50135, 50136, 50137, 50138, 50139, 50140, 50141, 50142, 50143, 50144, 50145, 50146, 50147, 50148, 50149, 50150, 50151, 50152, 50153, 50154, 50155, 50156, 50157, 50158, 50159, 50160, 50161, 50162, 50163, 50164, 50165, 50166, 50167, 50168, 50169, 50170, 50171, 50172, 50173, 50174, 50175, 50176, 50177, 50178, 50179, 50180, 50181, 50182, 50183, 50184, 50185, 50186, 50187, 50188, 50189, 50190, 50191, 50192, 50193, 50194, 50195, 50196, 50197, 50198, 50199, 50200, 50201, 50202, 50203, 50204, 50205, 50206, 50207, 50208, 50209, 50210, 50211, 50212, 50213, 50214, 50215, 50216, 50217, 50218, 50219, 50220, 50221, 50222, 50223, 50224, 50225, 50226, 50227, 50228, 50229, 50230, 50231, 50232, 50233, 50234, 50235, 50236, 50237, 50238, 50239, 50240, 50241, 50242, 50243, 50244, 50245, 50246, 50247, 50248, 50249, 50250, 50251, 50252, 50253, 50254, 50255, 50256, 50257, 50258, 50259, 50260, 50261, 50262, 50263, 50264, 50265, 50266, 50267, 50268, 50269, 50270, 50271, 50272, 50273, 50274, 50275, 50276, 50277, 50278, 50279, 50280, 50281, 50282, 50283, 50284, 50285, 50286, 50287, 50288, 50289, 50290, 50291, 50292, 50293, 50294, 50295, 50296, 50297, 50298, 50299, 50300, 50301, 50302, 50303, 50304, 50305, 50306, 50307, 50308, 50309, 50310, 50311, 50312, 50313, 50314, 50315, 50316, 50317, 50318, 50319, 50320, 50321, 50322, 50323, 50324, 50325, 50326, 50327, 50328, 50329, 50330, 50331, 50332, 50333, 50334, 50335, 50336, 50337, 50338, 50339, 50340, 50341, 50342, 50343, 50344, 50345, 50346, 50347, 50348, 50349, 50350, 50351, 50352, 50353, 50354, 50355, 50356, 50357, 50358, 50359, 50360, 50361, 50362, 50363, 50364, 50365, 50366, 50367, 50368, 50369, 50370, 50371, 50372, 50373, 50374, 50375, 50376, 50377, 50378, 50379, 50380, 50381, 50382, 50383, 50384, 50385, 50386, 50387, 50388, 50389, 50390, 50391, 50392, 50393, 50394, 50395, 50396, 50397, 50398, 50399, 50400, 50401, 50402, 50403, 50404, 50405, 50406, 50407, 50408, 50409, 50410, 50411, 50412, 50413, 50414, 50415, 50416, 50417, 50418, 50419, 50420, 50421, 50422, 50423, 50424, 50425, 50426, 50427, 50428, 50429, 50430, 50431, 50432, 50433, 50434, 50435, 50436, 50437, 50438, 50439, 50440, 50441, 50442, 50443, 50444, 50445, 50446, 50447, 50448, 50449, 50450, 50451, 50452, 50453, 50454, 50455, 50456, 50457, 50458, 50459, 50460, 50461, 50462, 50463, 50464, 50465, 50466, 50467, 50468, 50469, 50470, 50471, 50472, 50473, 50474, 50475, 50476, 50477, 50478, 50479, 50480, 50481, 50482, 50483, 50484, 50485, 50486, 50487, 50488, 50489, 50490, 50491, 50492, 50493, 50494, 50495, 50496, 50497, 50498, 50499, 50500, 50501, 50502, 50503, 50504, 50505, 50506, 50507, 50508, 50509, 50510, 50511, 50512, 50513, 50514, 50515, 50516, 50517, 50518, 50519, 50520, 50521, 50522, 50523, 50524, 50525, 50526, 50527, 50528, 50529, 50530, 50531, 50532, 50533, 50534, 50535, 50536, 50537, 50538, 50539, 50540, 50541, 50542, 50543, 50544, 50545, 50546, 50547, 50548, 50549, 50550, 50551, 50552, 50553, 50554, 50555, 50556, 50557, 50558, 50559, 50560, 50561, 50562, 50563, 50564, 50565, 50566, 50567, 50568, 50569, 50570, 50571, 50572, 50573, 50574, 50575, 50576, 50577, 50578, 50579, 50580, 50581, 50582, 50583, 50584, 50585, 50586, 50587, 50588, 50589, 50590, 50591, 50592, 50593, 50594, 50595, 50596, 50597, 50598, 50599, 50600, 50601, 50602, 50603, 50604, 50605, 50606, 50607, 50608, 50609, 50610, 50611, 50612, 50613, 50614, 50615, 50616, 50617, 50618, 50619, 50620, 50621, 50622, 50623, 50624, 50625, 50626, 50627, 50628, 50629, 50630, 50631, 50632, 50633, 50634, 50635, 50636, 50637, 50638, 50639, 50640, 50641, 50642, 50643, 50644, 50645, 50646, 50647, 50648, 50649, 50650, 50651, 50652, 50653, 50654, 50655, 50656, 50657, 50658, 50659, 50660, 50661, 50662, 50663, 50664, 50665, 50666, 50667, 50668, 50669, 50670, 50671, 50672, 50673, 50674, 50675, 50676, 50677, 50678, 50679, 50680, 50681, 50682, 50683, 50684, 50685, 50686, 50687, 50688, 50689, 50690, 50691, 50692, 50693, 50694, 50695, 50696, 50697, 50698, 50699, 50700, 50701, 50702, 50703, 50704, 50705, 50706, 50707, 50708, 50709, 50710, 50711, 50712, 50713, 50714, 50715, 50716, 50717, 50718, 50719, 50720, 50721, 50722, 50723, 50724, 50725, 50726, 50727, 50728, 50729, 50730, 50731, 50732, 50733, 50734, 50735, 50736, 50737, 50738, 50739, 50740, 50741, 50742, 50743, 50744, 50745, 50746, 50747, 50748, 50749, 50750, 50751, 50752, 50753, 50754, 50755, 50756, 50757, 50758, 50759, 50760, 50761, 50762, 50763, 50764, 50765, 50766, 50767, 50768, 50769, 50770, 50771, 50772, 50773, 50774, 50775, 50776, 50777, 50778, 50779, 50780, 50781, 50782, 50783, 50784, 50785, 50786, 50787, 50788, 50789, 50790, 50791, 50792, 50793, 50794, 50795, 50796, 50797, 50798, 50799, 50800, 50801, 50802, 50803, 50804, 50805, 50806, 50807, 50808, 50809, 50810, 50811, 50812, 50813, 50814, 50815, 50816, 50817, 50818, 50819, 50820, 50821, 50822, 50823, 50824, 50825, 50826, 50827, 50828, 50829, 50830, 50831, 50832, 50833, 50834, 50835, 50836, 50837, 50838, 50839, 50840, 50841, 50842, 50843, 50844, 50845, 50846, 50847, 50848, 50849, 50850, 50851, 50852, 50853, 50854, 50855, 50856, 50857, 50858, 50859, 50860, 50861, 50862, 50863, 50864, 50865, 50866, 50867, 50868, 50869, 50870, 50871, 50872, 50873, 50874, 50875, 50876, 50877, 50878, 50879, 50880, 50881, 50882, 50883, 50884, 50885, 50886, 50887, 50888, 50889, 50890, 50891, 50892, 50893, 50894, 50895, 50896, 50897, 50898, 50899, 50900, 50901, 50902, 50903, 50904, 50905, 50906, 50907, 50908, 50909, 50910, 50911, 50912, 50913, 50914, 50915, 50916, 50917, 50918, 50919, 50920, 50921, 50922, 50923, 50924, 50925, 50926, 50927, 50928, 50929, 50930, 50931, 50932, 50933, 50934, 50935, 50936, 50937, 50938, 50939, 50940, 50941, 50942, 50943, 50944, 50945, 50946, 50947, 50948, 50949, 50950, 50951, 50952, 50953, 50954, 50955, 50956, 50957, 50958, 50959, 50960, 50961, 50962, 50963, 50964, 50965, 50966, 50967, 50968, 50969, 50970, 50971, 50972, 50973, 50974, 50975, 50976, 50977, 50978, 50979, 50980, 50981, 50982, 50983, 50984, 50985, 50986, 50987, 50988, 50989, 50990, 50991, 50992, 50993, 50994, 50995, 50996, 50997, 50998, 50999, 51000, 51001, 51002, 51003, 51004, 51005, 51006, 51007, 51008, 51009, 51010, 51011, 51012, 51013, 51014, 51015, 51016, 51017, 51018, 51019, 51020, 51021, 51022, 51023, 51024, 51025, 51026, 51027, 51028, 51029, 51030, 51031, 51032, 51033, 51034, 51035, 51036, 51037, 51038, 51039, 51040, 51041, 51042, 51043, 51044, 51045, 51046, 51047, 51048, 51049, 51050, 51051, 51052, 51053, 51054, 51055, 51056, 51057, 51058, 51059, 51060, 51061, 51062, 51063, 51064, 51065, 51066, 51067, 51068, 51069, 51070, 51071, 51072, 51073, 51074, 51075, 51076, 51077, 51078, 51079, 51080, 51081, 51082, 51083, 51084, 51085, 51086, 51087, 51088, 51089, 51090, 51091, 51092, 51093, 51094, 51095, 51096, 51097, 51098, 51099, 51100, 51101, 51102, 51103, 51104, 51105, 51106, 51107, 51108, 51109, 51110, 51111, 51112, 51113, 51114, 51115, 51116, 51117, 51118, 51119, 51120, 51121, 51122, 51123, 51124, 51125, 51126, 51127, 51128, 51129, 51130, 51131, 51132, 51133, 51134, 51135, 51136, 51137, 51138, 51139, 51140, 51141, 51142, 51143, 51144, 51145, 51146, 51147, 51148, 51149, 51150, 51151, 51152, 51153, 51154, 51155, 51156, 51157, 51158, 51159, 51160, 51161, 51162, 51163, 51164, 51165, 51166, 51167, 51168, 51169, 51170, 51171, 51172, 51173, 51174, 51175, 51176, 51177, 51178, 51179, 51180, 51181, 51182, 51183, 51184, 51185, 51186, 51187, 51188, 51189, 51190, 51191, 51192, 51193, 51194, 51195, 51196, 51197, 51198, 51199, 51200, 51201, 51202, 51203, 51204, 51205, 51206, 51207, 51208, 51209, 51210, 51211, 51212, 51213, 51214, 51215, 51216, 51217, 51218, 51219, 51220, 51221, 51222, 51223, 51224, 51225, 51226, 51227, 51228, 51229, 51230, 51231, 51232, 51233, 51234, 51235, 51236, 51237, 51238, 51239, 51240, 51241, 51242, 51243, 51244, 51245, 51246, 51247, 51248, 51249, 51250, 51251, 51252, 51253, 51254, 51255, 51256, 51257, 51258, 51259, 51260, 51261, 51262, 51263, 51264, 51265, 51266, 51267, 51268, 51269, 51270, 51271, 51272, 51273, 51274, 51275, 51276, 51277, 51278, 51279, 51280, 51281, 51282, 51283, 51284, 51285, 51286, 51287, 51288, 51289, 51290, 51291, 51292, 51293, 51294, 51295, 51296, 51297, 51298, 51299, 51300, 51301, 51302, 51303, 51304, 51305, 51306, 51307, 51308, 51309, 51310, 51311, 51312, 51313, 51314, 51315, 51316, 51317, 51318, 51319, 51320, 51321, 51322, 51323, 51324, 51325, 51326, 51327, 51328, 51329, 51330, 51331, 51332, 51333, 51334, 51335, 51336, 51337, 51338, 51339, 51340, 51341, 51342, 51343, 51344, 51345, 51346, 51347, 51348, 51349, 51350, 51351, 51352, 51353, 51354, 51355, 51356, 51357, 51358, 51359, 51360, 51361, 51362, 51363, 51364, 51365, 51366, 51367, 51368, 51369, 51370, 51371, 51372, 51373, 51374, 51375, 51376, 51377, 51378, 51379, 51380, 51381, 51382, 51383, 51384, 51385, 51386, 51387, 51388, 51389, 51390, 51391, 51392, 51393, 51394, 51395, 51396, 51397, 51398, 51399, 51400, 51401, 51402, 51403, 51404, 51405, 51406, 51407, 51408, 51409, 51410, 51411, 51412, 51413, 51414, 51415, 51416, 51417, 51418, 51419, 51420, 51421, 51422, 51423, 51424, 51425, 51426, 51427, 51428, 51429, 51430, 51431, 51432, 51433, 51434, 51435, 51436, 51437, 51438, 51439, 51440, 51441, 51442, 51443, 51444, 51445, 51446, 51447, 51448, 51449, 51450, 51451, 51452, 51453, 51454, 51455, 51456, 51457, 51458, 51459, 51460, 51461, 51462, 51463, 51464, 51465, 51466, 51467, 51468, 51469, 51470, 51471, 51472, 51473, 51474, 51475, 51476, 51477, 51478, 51479, 51480, 51481, 51482, 51483, 51484, 51485, 51486, 51487, 51488, 51489, 51490, 51491, 51492, 51493, 51494, 51495, 51496, 51497, 51498, 51499, 51500, 51501, 51502, 51503, 51504, 51505, 51506, 51507, 51508, 51509, 51510, 51511, 51512, 51513, 51514, 51515, 51516, 51517, 51518, 51519, 51520, 51521, 51522, 51523, 51524, 51525, 51526, 51527, 51528, 51529, 51530, 51531, 51532, 51533, 51534, 51535, 51536, 51537, 51538, 51539, 51540, 51541, 51542, 51543, 51544, 51545, 51546, 51547, 51548, 51549, 51550, 51551, 51552, 51553, 51554, 51555, 51556, 51557, 51558, 51559, 51560, 51561, 51562, 51563, 51564, 51565, 51566, 51567, 51568, 51569, 51570, 51571, 51572, 51573, 51574, 51575, 51576, 51577, 51578, 51579, 51580, 51581, 51582, 51583, 51584, 51585, 51586, 51587, 51588, 51589, 51590, 51591, 51592, 51593, 51594, 51595, 51596, 51597, 51598, 51599, 51600, 51601, 51602, 51603, 51604, 51605, 51606, 51607, 51608, 51609, 51610, 51611, 51612, 51613, 51614, 51615, 51616, 51617, 51618, 51619, 51620, 51621, 51622, 51623, 51624, 51625, 51626, 51627, 51628, 51629, 51630, 51631, 51632, 51633, 51634, 51635, 51636, 51637, 51638, 51639, 51640, 51641, 51642, 51643, 51644, 51645, 51646, 51647, 51648, 51649, 51650, 51651, 51652, 51653, 51654, 51655, 51656, 51657, 51658, 51659, 51660, 51661, 51662, 51663, 51664, 51665, 51666, 51667, 51668, 51669, 51670, 51671, 51672, 51673, 51674, 51675, 51676, 51677, 51678, 51679, 51680, 51681, 51682, 51683, 51684, 51685, 51686, 51687, 51688, 51689, 51690, 51691, 51692, 51693, 51694, 51695, 51696, 51697, 51698, 51699, 51700, 51701, 51702, 51703, 51704, 51705, 51706, 51707, 51708, 51709, 51710, 51711, 51712, 51713, 51714, 51715, 51716, 51717, 51718, 51719, 51720, 51721, 51722, 51723, 51724, 51725, 51726, 51727, 51728, 51729, 51730, 51731, 51732, 51733, 51734, 51735, 51736, 51737, 51738, 51739, 51740, 51741, 51742, 51743, 51744, 51745, 51746, 51747, 51748, 51749, 51750, 51751, 51752, 51753, 51754, 51755, 51756, 51757, 51758, 51759, 51760, 51761, 51762, 51763, 51764, 51765, 51766, 51767, 51768, 51769, 51770, 51771, 51772, 51773, 51774, 51775, 51776, 51777, 51778, 51779, 51780, 51781, 51782, 51783, 51784, 51785, 51786, 51787, 51788, 51789, 51790, 51791, 51792, 51793, 51794, 51795, 51796, 51797, 51798, 51799, 51800, 51801, 51802, 51803, 51804, 51805, 51806, 51807, 51808, 51809, 51810, 51811, 51812, 51813, 51814, 51815, 51816, 51817, 51818, 51819, 51820, 51821, 51822, 51823, 51824, 51825, 51826, 51827, 51828, 51829, 51830, 51831, 51832, 51833, 51834, 51835, 51836, 51837, 51838, 51839, 51840, 51841, 51842, 51843, 51844, 51845, 51846, 51847, 51848, 51849, 51850, 51851, 51852, 51853, 51854, 51855, 51856, 51857, 51858, 51859, 51860, 51861, 51862, 51863, 51864, 51865, 51866, 51867, 51868, 51869, 51870, 51871, 51872, 51873, 51874, 51875, 51876, 51877, 51878, 51879, 51880, 51881, 51882, 51883, 51884, 51885, 51886, 51887, 51888, 51889, 51890, 51891, 51892, 51893, 51894, 51895, 51896, 51897, 51898, 51899, 51900, 51901, 51902, 51903, 51904, 51905, 51906, 51907, 51908, 51909, 51910, 51911, 51912, 51913, 51914, 51915, 51916, 51917, 51918, 51919, 51920, 51921, 51922, 51923, 51924, 51925, 51926, 51927, 51928, 51929, 51930, 51931, 51932, 51933, 51934, 51935, 51936, 51937, 51938, 51939, 51940, 51941, 51942, 51943, 51944, 51945, 51946, 51947, 51948, 51949, 51950, 51951, 51952, 51953, 51954, 51955, 51956, 51957, 51958, 51959, 51960, 51961, 51962, 51963, 51964, 51965, 51966, 51967, 51968, 51969, 51970, 51971, 51972, 51973, 51974, 51975, 51976, 51977, 51978, 51979, 51980, 51981, 51982, 51983, 51984, 51985, 51986, 51987, 51988, 51989, 51990, 51991, 51992, 51993, 51994, 51995, 51996, 51997, 51998, 51999, 52000, 52001, 52002, 52003, 52004, 52005, 52006, 52007, 52008, 52009, 52010, 52011, 52012, 52013, 52014, 52015, 52016, 52017, 52018, 52019, 52020, 52021, 52022, 52023, 52024, 52025, 52026, 52027, 52028, 52029, 52030, 52031, 52032, 52033, 52034, 52035, 52036, 52037, 52038, 52039, 52040, 52041, 52042, 52043, 52044, 52045, 52046, 52047, 52048, 52049, 52050, 52051, 52052, 52053, 52054, 52055, 52056, 52057, 52058, 52059, 52060, 52061, 52062, 52063, 52064, 52065, 52066, 52067, 52068, 52069, 52070, 52071, 52072, 52073, 52074, 52075, 52076, 52077, 52078, 52079, 52080, 52081, 52082, 52083, 52084, 52085, 52086, 52087, 52088, 52089, 52090, 52091, 52092, 52093, 52094, 52095, 52096, 52097, 52098, 52099, 52100, 52101, 52102, 52103, 52104, 52105, 52106, 52107, 52108, 52109, 52110, 52111, 52112, 52113, 52114, 52115, 52116, 52117, 52118, 52119, 52120, 52121, 52122, 52123, 52124, 52125, 52126, 52127, 52128, 52129, 52130, 52131, 52132, 52133, 52134, 52135, 52136, 52137, 52138, 52139, 52140, 52141, 52142, 52143, 52144, 52145, 52146, 52147, 52148, 52149, 52150, 52151, 52152, 52153, 52154, 52155, 52156, 52157, 52158, 52159, 52160, 52161, 52162, 52163, 52164, 52165, 52166, 52167, 52168, 52169, 52170, 52171, 52172, 52173, 52174, 52175, 52176, 52177, 52178, 52179, 52180, 52181, 52182, 52183, 52184, 52185, 52186, 52187, 52188, 52189, 52190, 52191, 52192, 52193, 52194, 52195, 52196, 52197, 52198, 52199, 52200, 52201, 52202, 52203, 52204, 52205, 52206, 52207, 52208, 52209, 52210, 52211, 52212, 52213, 52214, 52215, 52216, 52217, 52218, 52219, 52220, 52221, 52222, 52223, 52224, 52225, 52226, 52227, 52228, 52229, 52230, 52231, 52232, 52233, 52234, 52235, 52236, 52237, 52238, 52239, 52240, 52241, 52242, 52243, 52244, 52245, 52246, 52247, 52248, 52249, 52250, 52251, 52252, 52253, 52254, 52255, 52256, 52257, 52258, 52259, 52260, 52261, 52262, 52263, 52264, 52265, 52266, 52267, 52268, 52269, 52270, 52271, 52272, 52273, 52274, 52275, 52276, 52277, 52278, 52279, 52280, 52281, 52282, 52283, 52284, 52285, 52286, 52287, 52288, 52289, 52290, 52291, 52292, 52293, 52294, 52295, 52296, 52297, 52298, 52299, 52300, 52301, 52302, 52303, 52304, 52305, 52306, 52307, 52308, 52309, 52310, 52311, 52312, 52313, 52314, 52315, 52316, 52317, 52318, 52319, 52320, 52321, 52322, 52323, 52324, 52325, 52326, 52327, 52328, 52329, 52330, 52331, 52332, 52333, 52334, 52335, 52336, 52337, 52338, 52339, 52340, 52341, 52342, 52343, 52344, 52345, 52346, 52347, 52348, 52349, 52350, 52351, 52352, 52353, 52354, 52355, 52356, 52357, 52358, 52359, 52360, 52361, 52362, 52363, 52364, 52365, 52366, 52367, 52368, 52369, 52370, 52371, 52372, 52373, 52374, 52375, 52376, 52377, 52378, 52379, 52380, 52381, 52382, 52383, 52384, 52385, 52386, 52387, 52388, 52389, 52390, 52391, 52392, 52393, 52394, 52395, 52396, 52397, 52398, 52399, 52400, 52401, 52402, 52403, 52404, 52405, 52406, 52407, 52408, 52409, 52410, 52411, 52412, 52413, 52414, 52415, 52416, 52417, 52418, 52419, 52420, 52421, 52422, 52423, 52424, 52425, 52426, 52427, 52428, 52429, 52430, 52431, 52432, 52433, 52434, 52435, 52436, 52437, 52438, 52439, 52440, 52441, 52442, 52443, 52444, 52445, 52446, 52447, 52448, 52449, 52450, 52451, 52452, 52453, 52454, 52455, 52456, 52457, 52458, 52459, 52460, 52461, 52462, 52463, 52464, 52465, 52466, 52467, 52468, 52469, 52470, 52471, 52472, 52473, 52474, 52475, 52476, 52477, 52478, 52479, 52480, 52481, 52482, 52483, 52484, 52485, 52486, 52487, 52488, 52489, 52490, 52491, 52492, 52493, 52494, 52495, 52496, 52497, 52498, 52499, 52500, 52501, 52502, 52503, 52504, 52505, 52506, 52507, 52508, 52509, 52510, 52511, 52512, 52513, 52514, 52515, 52516, 52517, 52518, 52519, 52520, 52521, 52522, 52523, 52524, 52525, 52526, 52527, 52528, 52529, 52530, 52531, 52532, 52533, 52534, 52535, 52536, 52537, 52538, 52539, 52540, 52541, 52542, 52543, 52544, 52545, 52546, 52547, 52548, 52549, 52550, 52551, 52552, 52553, 52554, 52555, 52556, 52557, 52558, 52559, 52560, 52561, 52562, 52563, 52564, 52565, 52566, 52567, 52568, 52569, 52570, 52571, 52572, 52573, 52574, 52575, 52576, 52577, 52578, 52579, 52580, 52581, 52582, 52583, 52584, 52585, 52586, 52587, 52588, 52589, 52590, 52591, 52592, 52593, 52594, 52595, 52596, 52597, 52598, 52599, 52600, 52601, 52602, 52603, 52604, 52605, 52606, 52607, 52608, 52609, 52610, 52611, 52612, 52613, 52614, 52615, 52616, 52617, 52618, 52619, 52620, 52621, 52622, 52623, 52624, 52625, 52626, 52627, 52628, 52629, 52630, 52631, 52632, 52633, 52634, 52635, 52636, 52637, 52638, 52639, 52640, 52641, 52642, 52643, 52644, 52645, 52646, 52647, 52648, 52649, 52650, 52651, 52652, 52653, 52654, 52655, 52656, 52657, 52658, 52659, 52660, 52661, 52662, 52663, 52664, 52665, 52666, 52667, 52668, 52669, 52670, 52671, 52672, 52673, 52674, 52675, 52676, 52677, 52678, 52679, 52680, 52681, 52682, 52683, 52684, 52685, 52686, 52687, 52688, 52689, 52690, 52691, 52692, 52693, 52694, 52695, 52696, 52697, 52698, 52699, 52700, 52701, 52702, 52703, 52704, 52705, 52706, 52707, 52708, 52709, 52710, 52711, 52712, 52713, 52714, 52715, 52716, 52717, 52718, 52719, 52720, 52721, 52722, 52723, 52724, 52725, 52726, 52727, 52728, 52729, 52730, 52731, 52732, 52733, 52734, 52735, 52736, 52737, 52738, 52739, 52740, 52741, 52742, 52743, 52744, 52745, 52746, 52747, 52748, 52749, 52750, 52751, 52752, 52753, 52754, 52755, 52756, 52757, 52758, 52759, 52760, 52761, 52762, 52763, 52764, 52765, 52766, 52767, 52768, 52769, 52770, 52771, 52772, 52773, 52774, 52775, 52776, 52777, 52778, 52779, 52780, 52781, 52782, 52783, 52784, 52785, 52786, 52787, 52788, 52789, 52790, 52791, 52792, 52793, 52794, 52795, 52796, 52797, 52798, 52799, 52800, 52801, 52802, 52803, 52804, 52805, 52806, 52807, 52808, 52809, 52810, 52811, 52812, 52813, 52814, 52815, 52816, 52817, 52818, 52819, 52820, 52821, 52822, 52823, 52824, 52825, 52826, 52827, 52828, 52829, 52830, 52831, 52832, 52833, 52834, 52835, 52836, 52837, 52838, 52839, 52840, 52841, 52842, 52843, 52844, 52845, 52846, 52847, 52848, 52849, 52850, 52851, 52852, 52853, 52854, 52855, 52856, 52857, 52858, 52859, 52860, 52861, 52862, 52863, 52864, 52865, 52866, 52867, 52868, 52869, 52870, 52871, 52872, 52873, 52874, 52875, 52876, 52877, 52878, 52879, 52880, 52881, 52882, 52883, 52884, 52885, 52886, 52887, 52888, 52889, 52890, 52891, 52892, 52893, 52894, 52895, 52896, 52897, 52898, 52899, 52900, 52901, 52902, 52903, 52904, 52905, 52906, 52907, 52908, 52909, 52910, 52911, 52912, 52913, 52914, 52915, 52916, 52917, 52918, 52919, 52920, 52921, 52922, 52923, 52924, 52925, 52926, 52927, 52928, 52929, 52930, 52931, 52932, 52933, 52934, 52935, 52936, 52937, 52938, 52939, 52940, 52941, 52942, 52943, 52944, 52945, 52946, 52947, 52948, 52949, 52950, 52951, 52952, 52953, 52954, 52955, 52956, 52957, 52958, 52959, 52960, 52961, 52962, 52963, 52964, 52965, 52966, 52967, 52968, 52969, 52970, 52971, 52972, 52973, 52974, 52975, 52976, 52977, 52978, 52979, 52980, 52981, 52982, 52983, 52984, 52985, 52986, 52987, 52988, 52989, 52990, 52991, 52992, 52993, 52994, 52995, 52996, 52997, 52998, 52999, 53000, 53001, 53002, 53003, 53004, 53005, 53006, 53007, 53008, 53009, 53010, 53011, 53012, 53013, 53014, 53015, 53016, 53017, 53018, 53019, 53020, 53021, 53022, 53023, 53024, 53025, 53026, 53027, 53028, 53029, 53030, 53031, 53032, 53033, 53034, 53035, 53036, 53037, 53038, 53039, 53040, 53041, 53042, 53043, 53044, 53045, 53046, 53047, 53048, 53049, 53050, 53051, 53052, 53053, 53054, 53055, 53056, 53057, 53058, 53059, 53060, 53061, 53062, 53063, 53064, 53065, 53066, 53067, 53068, 53069, 53070, 53071, 53072, 53073, 53074, 53075, 53076, 53077, 53078, 53079, 53080, 53081, 53082, 53083, 53084, 53085, 53086, 53087, 53088, 53089, 53090, 53091, 53092, 53093, 53094, 53095, 53096, 53097, 53098, 53099, 53100, 53101, 53102, 53103, 53104, 53105, 53106, 53107, 53108, 53109, 53110, 53111, 53112, 53113, 53114, 53115, 53116, 53117, 53118, 53119, 53120, 53121, 53122, 53123, 53124, 53125, 53126, 53127, 53128, 53129, 53130, 53131, 53132, 53133, 53134, 53135, 53136, 53137, 53138, 53139, 53140, 53141, 53142, 53143, 53144, 53145, 53146, 53147, 53148, 53149, 53150, 53151, 53152, 53153, 53154, 53155, 53156, 53157, 53158, 53159, 53160, 53161, 53162, 53163, 53164, 53165, 53166, 53167, 53168, 53169, 53170, 53171, 53172, 53173, 53174, 53175, 53176, 53177, 53178, 53179, 53180, 53181, 53182, 53183, 53184, 53185, 53186, 53187, 53188, 53189, 53190, 53191, 53192, 53193, 53194, 53195, 53196, 53197, 53198, 53199, 53200, 53201, 53202, 53203, 53204, 53205, 53206, 53207, 53208, 53209, 53210, 53211, 53212, 53213, 53214, 53215, 53216, 53217, 53218, 53219, 53220, 53221, 53222, 53223, 53224, 53225, 53226, 53227, 53228, 53229, 53230, 53231, 53232, 53233, 53234, 53235, 53236, 53237, 53238, 53239, 53240, 53241, 53242, 53243, 53244, 53245, 53246, 53247, 53248, 53249, 53250, 53251, 53252, 53253, 53254, 53255, 53256, 53257, 53258, 53259, 53260, 53261, 53262, 53263, 53264, 53265, 53266, 53267, 53268, 53269, 53270, 53271, 53272, 53273, 53274, 53275, 53276, 53277, 53278, 53279, 53280, 53281, 53282, 53283, 53284, 53285, 53286, 53287, 53288, 53289, 53290, 53291, 53292, 53293, 53294, 53295, 53296, 53297, 53298, 53299, 53300, 53301, 53302, 53303, 53304, 53305, 53306, 53307, 53308, 53309, 53310, 53311, 53312, 53313, 53314, 53315, 53316, 53317, 53318, 53319, 53320, 53321, 53322, 53323, 53324, 53325, 53326, 53327, 53328, 53329, 53330, 53331, 53332, 53333, 53334, 53335, 53336, 53337, 53338, 53339, 53340, 53341, 53342, 53343, 53344, 53345, 53346, 53347, 53348, 53349, 53350, 53351, 53352, 53353, 53354, 53355, 53356, 53357, 53358, 53359, 53360, 53361, 53362, 53363, 53364, 53365, 53366, 53367, 53368, 53369, 53370, 53371, 53372, 53373, 53374, 53375, 53376, 53377, 53378, 53379, 53380, 53381, 53382, 53383, 53384, 53385, 53386, 53387, 53388, 53389, 53390, 53391, 53392, 53393, 53394, 53395, 53396, 53397, 53398, 53399, 53400, 53401, 53402, 53403, 53404, 53405, 53406, 53407, 53408, 53409, 53410, 53411, 53412, 53413, 53414, 53415, 53416, 53417, 53418, 53419, 53420, 53421, 53422, 53423, 53424, 53425, 53426, 53427, 53428, 53429, 53430, 53431, 53432, 53433, 53434, 53435, 53436, 53437, 53438, 53439, 53440, 53441, 53442, 53443, 53444, 53445, 53446, 53447, 53448, 53449, 53450, 53451, 53452, 53453, 53454, 53455, 53456, 53457, 53458, 53459, 53460, 53461, 53462, 53463, 53464, 53465, 53466, 53467, 53468, 53469, 53470, 53471, 53472, 53473, 53474, 53475, 53476, 53477, 53478, 53479, 53480, 53481, 53482, 53483, 53484, 53485, 53486, 53487, 53488, 53489, 53490, 53491, 53492, 53493, 53494, 53495, 53496, 53497, 53498, 53499, 53500, 53501, 53502, 53503, 53504, 53505, 53506, 53507, 53508, 53509, 53510, 53511, 53512, 53513, 53514, 53515, 53516, 53517, 53518, 53519, 53520, 53521, 53522, 53523, 53524, 53525, 53526, 53527, 53528, 53529, 53530, 53531, 53532, 53533, 53534, 53535, 53536, 53537, 53538, 53539, 53540, 53541, 53542, 53543, 53544, 53545, 53546, 53547, 53548, 53549, 53550, 53551, 53552, 53553, 53554, 53555, 53556, 53557, 53558, 53559, 53560, 53561, 53562, 53563, 53564, 53565, 53566, 53567, 53568, 53569, 53570, 53571, 53572, 53573, 53574, 53575, 53576, 53577, 53578, 53579, 53580, 53581, 53582, 53583, 53584, 53585, 53586, 53587, 53588, 53589, 53590, 53591, 53592, 53593, 53594, 53595, 53596, 53597, 53598, 53599, 53600, 53601, 53602, 53603, 53604, 53605, 53606, 53607, 53608, 53609, 53610, 53611, 53612, 53613, 53614, 53615, 53616, 53617, 53618, 53619, 53620, 53621, 53622, 53623, 53624, 53625, 53626, 53627, 53628, 53629, 53630, 53631, 53632, 53633, 53634, 53635, 53636, 53637, 53638, 53639, 53640, 53641, 53642, 53643, 53644, 53645, 53646, 53647, 53648, 53649, 53650, 53651, 53652, 53653, 53654, 53655, 53656, 53657, 53658, 53659, 53660, 53661, 53662, 53663, 53664, 53665, 53666, 53667, 53668, 53669, 53670, 53671, 53672, 53673, 53674, 53675, 53676, 53677, 53678, 53679, 53680, 53681, 53682, 53683, 53684, 53685, 53686, 53687, 53688, 53689, 53690, 53691, 53692, 53693, 53694, 53695, 53696, 53697, 53698, 53699, 53700, 53701, 53702, 53703, 53704, 53705, 53706, 53707, 53708, 53709, 53710, 53711, 53712, 53713, 53714, 53715, 53716, 53717, 53718, 53719, 53720, 53721, 53722, 53723, 53724, 53725, 53726, 53727, 53728, 53729, 53730, 53731, 53732, 53733, 53734, 53735, 53736, 53737, 53738, 53739, 53740, 53741, 53742, 53743, 53744, 53745, 53746, 53747, 53748, 53749, 53750, 53751, 53752, 53753, 53754, 53755, 53756, 53757, 53758, 53759, 53760, 53761, 53762, 53763, 53764, 53765, 53766, 53767, 53768, 53769, 53770, 53771, 53772, 53773, 53774, 53775, 53776, 53777, 53778, 53779, 53780, 53781, 53782, 53783, 53784, 53785, 53786, 53787, 53788, 53789, 53790, 53791, 53792, 53793, 53794, 53795, 53796, 53797, 53798, 53799, 53800, 53801, 53802, 53803, 53804, 53805, 53806, 53807, 53808, 53809, 53810, 53811, 53812, 53813, 53814, 53815, 53816, 53817, 53818, 53819, 53820, 53821, 53822, 53823, 53824, 53825, 53826, 53827, 53828, 53829, 53830, 53831, 53832, 53833, 53834, 53835, 53836, 53837, 53838, 53839, 53840, 53841, 53842, 53843, 53844, 53845, 53846, 53847, 53848, 53849, 53850, 53851, 53852, 53853, 53854, 53855, 53856, 53857, 53858, 53859, 53860, 53861, 53862, 53863, 53864, 53865, 53866, 53867, 53868, 53869, 53870, 53871, 53872, 53873, 53874, 53875, 53876, 53877, 53878, 53879, 53880, 53881, 53882, 53883, 53884, 53885, 53886, 53887, 53888, 53889, 53890, 53891, 53892, 53893, 53894, 53895, 53896, 53897, 53898, 53899, 53900, 53901, 53902, 53903, 53904, 53905, 53906, 53907, 53908, 53909, 53910, 53911, 53912, 53913, 53914, 53915, 53916, 53917, 53918, 53919, 53920, 53921, 53922, 53923, 53924, 53925, 53926, 53927, 53928, 53929, 53930, 53931, 53932, 53933, 53934, 53935, 53936, 53937, 53938, 53939, 53940, 53941, 53942, 53943, 53944, 53945, 53946, 53947, 53948, 53949, 53950, 53951, 53952, 53953, 53954, 53955, 53956, 53957, 53958, 53959, 53960, 53961, 53962, 53963, 53964, 53965, 53966, 53967, 53968, 53969, 53970, 53971, 53972, 53973, 53974, 53975, 53976, 53977, 53978, 53979, 53980, 53981, 53982, 53983, 53984, 53985, 53986, 53987, 53988, 53989, 53990, 53991, 53992, 53993, 53994, 53995, 53996, 53997, 53998, 53999, 54000, 54001, 54002, 54003, 54004, 54005, 54006, 54007, 54008, 54009, 54010, 54011, 54012, 54013, 54014, 54015, 54016, 54017, 54018, 54019, 54020, 54021, 54022, 54023, 54024, 54025, 54026, 54027, 54028, 54029, 54030, 54031, 54032, 54033, 54034, 54035, 54036, 54037, 54038, 54039, 54040, 54041, 54042, 54043, 54044, 54045, 54046, 54047, 54048, 54049, 54050, 54051, 54052, 54053, 54054, 54055, 54056, 54057, 54058, 54059, 54060, 54061, 54062, 54063, 54064, 54065, 54066, 54067, 54068, 54069, 54070, 54071, 54072, 54073, 54074, 54075, 54076, 54077, 54078, 54079, 54080, 54081, 54082, 54083, 54084, 54085, 54086, 54087, 54088, 54089, 54090, 54091, 54092, 54093, 54094, 54095, 54096, 54097, 54098, 54099, 54100, 54101, 54102, 54103, 54104, 54105, 54106, 54107, 54108, 54109, 54110, 54111, 54112, 54113, 54114, 54115, 54116, 54117, 54118, 54119, 54120, 54121, 54122, 54123, 54124, 54125, 54126, 54127, 54128, 54129, 54130, 54131, 54132, 54133, 54134, 54135, 54136, 54137, 54138, 54139, 54140, 54141, 54142, 54143, 54144, 54145, 54146, 54147, 54148, 54149, 54150, 54151, 54152, 54153, 54154, 54155, 54156, 54157, 54158, 54159, 54160, 54161, 54162, 54163, 54164, 54165, 54166, 54167, 54168, 54169, 54170, 54171, 54172, 54173, 54174, 54175, 54176, 54177, 54178, 54179, 54180, 54181, 54182, 54183, 54184, 54185, 54186, 54187, 54188, 54189, 54190, 54191, 54192, 54193, 54194, 54195, 54196, 54197, 54198, 54199, 54200, 54201, 54202, 54203, 54204, 54205, 54206, 54207, 54208, 54209, 54210, 54211, 54212, 54213, 54214, 54215, 54216, 54217, 54218, 54219, 54220, 54221, 54222, 54223, 54224, 54225, 54226, 54227, 54228, 54229, 54230, 54231, 54232, 54233, 54234, 54235, 54236, 54237, 54238, 54239, 54240, 54241, 54242, 54243, 54244, 54245, 54246, 54247, 54248, 54249, 54250, 54251, 54252, 54253, 54254, 54255, 54256, 54257, 54258, 54259, 54260, 54261, 54262, 54263, 54264, 54265, 54266, 54267, 54268, 54269, 54270, 54271, 54272, 54273, 54274, 54275, 54276, 54277, 54278, 54279, 54280, 54281, 54282, 54283, 54284, 54285, 54286, 54287, 54288, 54289, 54290, 54291, 54292, 54293, 54294, 54295, 54296, 54297, 54298, 54299, 54300, 54301, 54302, 54303, 54304, 54305, 54306, 54307, 54308, 54309, 54310, 54311, 54312, 54313, 54314, 54315, 54316, 54317, 54318, 54319, 54320, 54321, 54322, 54323, 54324, 54325, 54326, 54327, 54328, 54329, 54330, 54331, 54332, 54333, 54334, 54335, 54336, 54337, 54338, 54339, 54340, 54341, 54342, 54343, 54344, 54345, 54346, 54347, 54348, 54349, 54350, 54351, 54352, 54353, 54354, 54355, 54356, 54357, 54358, 54359, 54360, 54361, 54362, 54363, 54364, 54365, 54366, 54367, 54368, 54369, 54370, 54371, 54372, 54373, 54374, 54375, 54376, 54377, 54378, 54379, 54380, 54381, 54382, 54383, 54384, 54385, 54386, 54387, 54388, 54389, 54390, 54391, 54392, 54393, 54394, 54395, 54396, 54397, 54398, 54399, 54400, 54401, 54402, 54403, 54404, 54405, 54406, 54407, 54408, 54409, 54410, 54411, 54412, 54413, 54414, 54415, 54416, 54417, 54418, 54419, 54420, 54421, 54422, 54423, 54424, 54425, 54426, 54427, 54428, 54429, 54430, 54431, 54432, 54433, 54434, 54435, 54436, 54437, 54438, 54439, 54440, 54441, 54442, 54443, 54444, 54445, 54446, 54447, 54448, 54449, 54450, 54451, 54452, 54453, 54454, 54455, 54456, 54457, 54458, 54459, 54460, 54461, 54462, 54463, 54464, 54465, 54466, 54467, 54468, 54469, 54470, 54471, 54472, 54473, 54474, 54475, 54476, 54477, 54478, 54479, 54480, 54481, 54482, 54483, 54484, 54485, 54486, 54487, 54488, 54489, 54490, 54491, 54492, 54493, 54494, 54495, 54496, 54497, 54498, 54499, 54500, 54501, 54502, 54503, 54504, 54505, 54506, 54507, 54508, 54509, 54510, 54511, 54512, 54513, 54514, 54515, 54516, 54517, 54518, 54519, 54520, 54521, 54522, 54523, 54524, 54525, 54526, 54527, 54528, 54529, 54530, 54531, 54532, 54533, 54534, 54535, 54536, 54537, 54538, 54539, 54540, 54541, 54542, 54543, 54544, 54545, 54546, 54547, 54548, 54549, 54550, 54551, 54552, 54553, 54554, 54555, 54556, 54557, 54558, 54559, 54560, 54561, 54562, 54563, 54564, 54565, 54566, 54567, 54568, 54569, 54570, 54571, 54572, 54573, 54574, 54575, 54576, 54577, 54578, 54579, 54580, 54581, 54582, 54583, 54584, 54585, 54586, 54587, 54588, 54589, 54590, 54591, 54592, 54593, 54594, 54595, 54596, 54597, 54598, 54599, 54600, 54601, 54602, 54603, 54604, 54605, 54606, 54607, 54608, 54609, 54610, 54611, 54612, 54613, 54614, 54615, 54616, 54617, 54618, 54619, 54620, 54621, 54622, 54623, 54624, 54625, 54626, 54627, 54628, 54629, 54630, 54631, 54632, 54633, 54634, 54635, 54636, 54637, 54638, 54639, 54640, 54641, 54642, 54643, 54644, 54645, 54646, 54647, 54648, 54649, 54650, 54651, 54652, 54653, 54654, 54655, 54656, 54657, 54658, 54659, 54660, 54661, 54662, 54663, 54664, 54665, 54666, 54667, 54668, 54669, 54670, 54671, 54672, 54673, 54674, 54675, 54676, 54677, 54678, 54679, 54680, 54681, 54682, 54683, 54684, 54685, 54686, 54687, 54688, 54689, 54690, 54691, 54692, 54693, 54694, 54695, 54696, 54697, 54698, 54699, 54700, 54701, 54702, 54703, 54704, 54705, 54706, 54707, 54708, 54709, 54710, 54711, 54712, 54713, 54714, 54715, 54716, 54717, 54718, 54719, 54720, 54721, 54722, 54723, 54724, 54725, 54726, 54727, 54728, 54729, 54730, 54731, 54732, 54733, 54734, 54735, 54736, 54737, 54738, 54739, 54740, 54741, 54742, 54743, 54744, 54745, 54746, 54747, 54748, 54749, 54750, 54751, 54752, 54753, 54754, 54755, 54756, 54757, 54758, 54759, 54760, 54761, 54762, 54763, 54764, 54765, 54766, 54767, 54768, 54769, 54770, 54771, 54772, 54773, 54774, 54775, 54776, 54777, 54778, 54779, 54780, 54781, 54782, 54783, 54784, 54785, 54786, 54787, 54788, 54789, 54790, 54791, 54792, 54793, 54794, 54795, 54796, 54797, 54798, 54799, 54800, 54801, 54802, 54803, 54804, 54805, 54806, 54807, 54808, 54809, 54810, 54811, 54812, 54813, 54814, 54815, 54816, 54817, 54818, 54819, 54820, 54821, 54822, 54823, 54824, 54825, 54826, 54827, 54828, 54829, 54830, 54831, 54832, 54833, 54834, 54835, 54836, 54837, 54838, 54839, 54840, 54841, 54842, 54843, 54844, 54845, 54846, 54847, 54848, 54849, 54850, 54851, 54852, 54853, 54854, 54855, 54856, 54857, 54858, 54859, 54860, 54861, 54862, 54863, 54864, 54865, 54866, 54867, 54868, 54869, 54870, 54871, 54872, 54873, 54874, 54875, 54876, 54877, 54878, 54879, 54880, 54881, 54882, 54883, 54884, 54885, 54886, 54887, 54888, 54889, 54890, 54891, 54892, 54893, 54894, 54895, 54896, 54897, 54898, 54899, 54900, 54901, 54902, 54903, 54904, 54905, 54906, 54907, 54908, 54909, 54910, 54911, 54912, 54913, 54914, 54915, 54916, 54917, 54918, 54919, 54920, 54921, 54922, 54923, 54924, 54925, 54926, 54927, 54928, 54929, 54930, 54931, 54932, 54933, 54934, 54935, 54936, 54937, 54938, 54939, 54940, 54941, 54942, 54943, 54944, 54945, 54946, 54947, 54948, 54949, 54950, 54951, 54952, 54953, 54954, 54955, 54956, 54957, 54958, 54959, 54960, 54961, 54962, 54963, 54964, 54965, 54966, 54967, 54968, 54969, 54970, 54971, 54972, 54973, 54974, 54975, 54976, 54977, 54978, 54979, 54980, 54981, 54982, 54983, 54984, 54985, 54986, 54987, 54988, 54989, 54990, 54991, 54992, 54993, 54994, 54995, 54996, 54997, 54998, 54999, 55000, 55001, 55002, 55003, 55004, 55005, 55006, 55007, 55008, 55009, 55010, 55011, 55012, 55013, 55014, 55015, 55016, 55017, 55018, 55019, 55020, 55021, 55022, 55023, 55024, 55025, 55026, 55027, 55028, 55029, 55030, 55031, 55032, 55033, 55034, 55035, 55036, 55037, 55038, 55039, 55040, 55041, 55042, 55043, 55044, 55045, 55046, 55047, 55048, 55049, 55050, 55051, 55052, 55053, 55054, 55055, 55056, 55057, 55058, 55059, 55060, 55061, 55062, 55063, 55064, 55065, 55066, 55067, 55068, 55069, 55070, 55071, 55072, 55073, 55074, 55075, 55076, 55077, 55078, 55079, 55080, 55081, 55082, 55083, 55084, 55085, 55086, 55087, 55088, 55089, 55090, 55091, 55092, 55093, 55094, 55095, 55096, 55097, 55098, 55099, 55100, 55101, 55102, 55103, 55104, 55105, 55106, 55107, 55108, 55109, 55110, 55111, 55112, 55113, 55114, 55115, 55116, 55117, 55118, 55119, 55120, 55121, 55122, 55123, 55124, 55125, 55126, 55127, 55128, 55129, 55130, 55131, 55132, 55133, 55134, 55135, 55136, 55137, 55138, 55139, 55140, 55141, 55142, 55143, 55144, 55145, 55146, 55147, 55148, 55149, 55150, 55151, 55152, 55153, 55154, 55155, 55156, 55157, 55158, 55159, 55160, 55161, 55162, 55163, 55164, 55165, 55166, 55167, 55168, 55169, 55170, 55171, 55172, 55173, 55174, 55175, 55176, 55177, 55178, 55179, 55180, 55181, 55182, 55183, 55184, 55185, 55186, 55187, 55188, 55189, 55190, 55191, 55192, 55193, 55194, 55195, 55196, 55197, 55198, 55199, 55200, 55201, 55202, 55203, 55204, 55205, 55206, 55207, 55208, 55209, 55210, 55211, 55212, 55213, 55214, 55215, 55216, 55217, 55218, 55219, 55220, 55221, 55222, 55223, 55224, 55225, 55226, 55227, 55228, 55229, 55230, 55231, 55232, 55233, 55234, 55235, 55236, 55237, 55238, 55239, 55240, 55241, 55242, 55243, 55244, 55245, 55246, 55247, 55248, 55249, 55250, 55251, 55252, 55253, 55254, 55255, 55256, 55257, 55258, 55259, 55260, 55261, 55262, 55263, 55264, 55265, 55266, 55267, 55268, 55269, 55270, 55271, 55272, 55273, 55274, 55275, 55276, 55277, 55278, 55279, 55280, 55281, 55282, 55283, 55284, 55285, 55286, 55287, 55288, 55289, 55290, 55291, 55292, 55293, 55294, 55295, 55296, 55297, 55298, 55299, 55300, 55301, 55302, 55303, 55304, 55305, 55306, 55307, 55308, 55309, 55310, 55311, 55312, 55313, 55314, 55315, 55316, 55317, 55318, 55319, 55320, 55321, 55322, 55323, 55324, 55325, 55326, 55327, 55328, 55329, 55330, 55331, 55332, 55333, 55334, 55335, 55336, 55337, 55338, 55339, 55340, 55341, 55342, 55343, 55344, 55345, 55346, 55347, 55348, 55349, 55350, 55351, 55352, 55353, 55354, 55355, 55356, 55357, 55358, 55359, 55360, 55361, 55362, 55363, 55364, 55365, 55366, 55367, 55368, 55369, 55370, 55371, 55372, 55373, 55374, 55375, 55376, 55377, 55378, 55379, 55380, 55381, 55382, 55383, 55384, 55385, 55386, 55387, 55388, 55389, 55390, 55391, 55392, 55393, 55394, 55395, 55396, 55397, 55398, 55399, 55400, 55401, 55402, 55403, 55404, 55405, 55406, 55407, 55408, 55409, 55410, 55411, 55412, 55413, 55414, 55415, 55416, 55417, 55418, 55419, 55420, 55421, 55422, 55423, 55424, 55425, 55426, 55427, 55428, 55429, 55430, 55431, 55432, 55433, 55434, 55435, 55436, 55437, 55438, 55439, 55440, 55441, 55442, 55443, 55444, 55445, 55446, 55447, 55448, 55449, 55450, 55451, 55452, 55453, 55454, 55455, 55456, 55457, 55458, 55459, 55460, 55461, 55462, 55463, 55464, 55465, 55466, 55467, 55468, 55469, 55470, 55471, 55472, 55473, 55474, 55475, 55476, 55477, 55478, 55479, 55480, 55481, 55482, 55483, 55484, 55485, 55486, 55487, 55488, 55489, 55490, 55491, 55492, 55493, 55494, 55495, 55496, 55497, 55498, 55499, 55500, 55501, 55502, 55503, 55504, 55505, 55506, 55507, 55508, 55509, 55510, 55511, 55512, 55513, 55514, 55515, 55516, 55517, 55518, 55519, 55520, 55521, 55522, 55523, 55524, 55525, 55526, 55527, 55528, 55529, 55530, 55531, 55532, 55533, 55534, 55535, 55536, 55537, 55538, 55539, 55540, 55541, 55542, 55543, 55544, 55545, 55546, 55547, 55548, 55549, 55550, 55551, 55552, 55553, 55554, 55555, 55556, 55557, 55558, 55559, 55560, 55561, 55562, 55563, 55564, 55565, 55566, 55567, 55568, 55569, 55570, 55571, 55572, 55573, 55574, 55575, 55576, 55577, 55578, 55579, 55580, 55581, 55582, 55583, 55584, 55585, 55586, 55587, 55588, 55589, 55590, 55591, 55592, 55593, 55594, 55595, 55596, 55597, 55598, 55599, 55600, 55601, 55602, 55603, 55604, 55605, 55606, 55607, 55608, 55609, 55610, 55611, 55612, 55613, 55614, 55615, 55616, 55617, 55618, 55619, 55620, 55621, 55622, 55623, 55624, 55625, 55626, 55627, 55628, 55629, 55630, 55631, 55632, 55633, 55634, 55635, 55636, 55637, 55638, 55639, 55640, 55641, 55642, 55643, 55644, 55645, 55646, 55647, 55648, 55649, 55650, 55651, 55652, 55653, 55654, 55655, 55656, 55657, 55658, 55659, 55660, 55661, 55662, 55663, 55664, 55665, 55666, 55667, 55668, 55669, 55670, 55671, 55672, 55673, 55674, 55675, 55676, 55677, 55678, 55679, 55680, 55681, 55682, 55683, 55684, 55685, 55686, 55687, 55688, 55689, 55690, 55691, 55692, 55693, 55694, 55695, 55696, 55697, 55698, 55699, 55700, 55701, 55702, 55703, 55704, 55705, 55706, 55707, 55708, 55709, 55710, 55711, 55712, 55713, 55714, 55715, 55716, 55717, 55718, 55719, 55720, 55721, 55722, 55723, 55724, 55725, 55726, 55727, 55728, 55729, 55730, 55731, 55732, 55733, 55734, 55735, 55736, 55737, 55738, 55739, 55740, 55741, 55742, 55743, 55744, 55745, 55746, 55747, 55748, 55749, 55750, 55751, 55752, 55753, 55754, 55755, 55756, 55757, 55758, 55759, 55760, 55761, 55762, 55763, 55764, 55765, 55766, 55767, 55768, 55769, 55770, 55771, 55772, 55773, 55774, 55775, 55776, 55777, 55778, 55779, 55780, 55781, 55782, 55783, 55784, 55785, 55786, 55787, 55788, 55789, 55790, 55791, 55792, 55793, 55794, 55795, 55796, 55797, 55798, 55799, 55800, 55801, 55802, 55803, 55804, 55805, 55806, 55807, 55808, 55809, 55810, 55811, 55812, 55813, 55814, 55815, 55816, 55817, 55818, 55819, 55820, 55821, 55822, 55823, 55824, 55825, 55826, 55827, 55828, 55829, 55830, 55831, 55832, 55833, 55834, 55835, 55836, 55837, 55838, 55839, 55840, 55841, 55842, 55843, 55844, 55845, 55846, 55847, 55848, 55849, 55850, 55851, 55852, 55853, 55854, 55855, 55856, 55857, 55858, 55859, 55860, 55861, 55862, 55863, 55864, 55865, 55866, 55867, 55868, 55869, 55870, 55871, 55872, 55873, 55874, 55875, 55876, 55877, 55878, 55879, 55880, 55881, 55882, 55883, 55884, 55885, 55886, 55887, 55888, 55889, 55890, 55891, 55892, 55893, 55894, 55895, 55896, 55897, 55898, 55899, 55900, 55901, 55902, 55903, 55904, 55905, 55906, 55907, 55908, 55909, 55910, 55911, 55912, 55913, 55914, 55915, 55916, 55917, 55918, 55919, 55920, 55921, 55922, 55923, 55924, 55925, 55926, 55927, 55928, 55929, 55930, 55931, 55932, 55933, 55934, 55935, 55936, 55937, 55938, 55939, 55940, 55941, 55942, 55943, 55944, 55945, 55946, 55947, 55948, 55949, 55950, 55951, 55952, 55953, 55954, 55955, 55956, 55957, 55958, 55959, 55960, 55961, 55962, 55963, 55964, 55965, 55966, 55967, 55968, 55969, 55970, 55971, 55972, 55973, 55974, 55975, 55976, 55977, 55978, 55979, 55980, 55981, 55982, 55983, 55984, 55985, 55986, 55987, 55988, 55989, 55990, 55991, 55992, 55993, 55994, 55995, 55996, 55997, 55998, 55999, 56000, 56001, 56002, 56003, 56004, 56005, 56006, 56007, 56008, 56009, 56010, 56011, 56012, 56013, 56014, 56015, 56016, 56017, 56018, 56019, 56020, 56021, 56022, 56023, 56024, 56025, 56026, 56027, 56028, 56029, 56030, 56031, 56032, 56033, 56034, 56035, 56036, 56037, 56038, 56039, 56040, 56041, 56042, 56043, 56044, 56045, 56046, 56047, 56048, 56049, 56050, 56051, 56052, 56053, 56054, 56055, 56056, 56057, 56058, 56059, 56060, 56061, 56062, 56063, 56064, 56065, 56066, 56067, 56068, 56069, 56070, 56071, 56072, 56073, 56074, 56075, 56076, 56077, 56078, 56079, 56080, 56081, 56082, 56083, 56084, 56085, 56086, 56087, 56088, 56089, 56090, 56091, 56092, 56093, 56094, 56095, 56096, 56097, 56098, 56099, 56100, 56101, 56102, 56103, 56104, 56105, 56106, 56107, 56108, 56109, 56110, 56111, 56112, 56113, 56114, 56115, 56116, 56117, 56118, 56119, 56120, 56121, 56122, 56123, 56124, 56125, 56126, 56127, 56128, 56129, 56130, 56131, 56132, 56133, 56134, 56135, 56136, 56137, 56138, 56139, 56140, 56141, 56142, 56143, 56144, 56145, 56146, 56147, 56148, 56149, 56150, 56151, 56152, 56153, 56154, 56155, 56156, 56157, 56158, 56159, 56160, 56161, 56162, 56163, 56164, 56165, 56166, 56167, 56168, 56169, 56170, 56171, 56172, 56173, 56174, 56175, 56176, 56177, 56178, 56179, 56180, 56181, 56182, 56183, 56184, 56185, 56186, 56187, 56188, 56189, 56190, 56191, 56192, 56193, 56194, 56195, 56196, 56197, 56198, 56199, 56200, 56201, 56202, 56203, 56204, 56205, 56206, 56207, 56208, 56209, 56210, 56211, 56212, 56213, 56214, 56215, 56216, 56217, 56218, 56219, 56220, 56221, 56222, 56223, 56224, 56225, 56226, 56227, 56228, 56229, 56230, 56231, 56232, 56233, 56234, 56235, 56236, 56237, 56238, 56239, 56240, 56241, 56242, 56243, 56244, 56245, 56246, 56247, 56248, 56249, 56250, 56251, 56252, 56253, 56254, 56255, 56256, 56257, 56258, 56259, 56260, 56261, 56262, 56263, 56264, 56265, 56266, 56267, 56268, 56269, 56270, 56271, 56272, 56273, 56274, 56275, 56276, 56277, 56278, 56279, 56280, 56281, 56282, 56283, 56284, 56285, 56286, 56287, 56288, 56289, 56290, 56291, 56292, 56293, 56294, 56295, 56296, 56297, 56298, 56299, 56300, 56301, 56302, 56303, 56304, 56305, 56306, 56307, 56308, 56309, 56310, 56311, 56312, 56313, 56314, 56315, 56316, 56317, 56318, 56319, 56320, 56321, 56322, 56323, 56324, 56325, 56326, 56327, 56328, 56329, 56330, 56331, 56332, 56333, 56334, 56335, 56336, 56337, 56338, 56339, 56340, 56341, 56342, 56343, 56344, 56345, 56346, 56347, 56348, 56349, 56350, 56351, 56352, 56353, 56354, 56355, 56356, 56357, 56358, 56359, 56360, 56361, 56362, 56363, 56364, 56365, 56366, 56367, 56368, 56369, 56370, 56371, 56372, 56373, 56374, 56375, 56376, 56377, 56378, 56379, 56380, 56381, 56382, 56383, 56384, 56385, 56386, 56387, 56388, 56389, 56390, 56391, 56392, 56393, 56394, 56395, 56396, 56397, 56398, 56399, 56400, 56401, 56402, 56403, 56404, 56405, 56406, 56407, 56408, 56409, 56410, 56411, 56412, 56413, 56414, 56415, 56416, 56417, 56418, 56419, 56420, 56421, 56422, 56423, 56424, 56425, 56426, 56427, 56428, 56429, 56430, 56431, 56432, 56433, 56434, 56435, 56436, 56437, 56438, 56439, 56440, 56441, 56442, 56443, 56444, 56445, 56446, 56447, 56448, 56449, 56450, 56451, 56452, 56453, 56454, 56455, 56456, 56457, 56458, 56459, 56460, 56461, 56462, 56463, 56464, 56465, 56466, 56467, 56468, 56469, 56470, 56471, 56472, 56473, 56474, 56475, 56476, 56477, 56478, 56479, 56480, 56481, 56482, 56483, 56484, 56485, 56486, 56487, 56488, 56489, 56490, 56491, 56492, 56493, 56494, 56495, 56496, 56497, 56498, 56499, 56500, 56501, 56502, 56503, 56504, 56505, 56506, 56507, 56508, 56509, 56510, 56511, 56512, 56513, 56514, 56515, 56516, 56517, 56518, 56519, 56520, 56521, 56522, 56523, 56524, 56525, 56526, 56527, 56528, 56529, 56530, 56531, 56532, 56533, 56534, 56535, 56536, 56537, 56538, 56539, 56540, 56541, 56542, 56543, 56544, 56545, 56546, 56547, 56548, 56549, 56550, 56551, 56552, 56553, 56554, 56555, 56556, 56557, 56558, 56559, 56560, 56561, 56562, 56563, 56564, 56565, 56566, 56567, 56568, 56569, 56570, 56571, 56572, 56573, 56574, 56575, 56576, 56577, 56578, 56579, 56580, 56581, 56582, 56583, 56584, 56585, 56586, 56587, 56588, 56589, 56590, 56591, 56592, 56593, 56594, 56595, 56596, 56597, 56598, 56599, 56600, 56601, 56602, 56603, 56604, 56605, 56606, 56607, 56608, 56609, 56610, 56611, 56612, 56613, 56614, 56615, 56616, 56617, 56618, 56619, 56620, 56621, 56622, 56623, 56624, 56625, 56626, 56627, 56628, 56629, 56630, 56631, 56632, 56633, 56634, 56635, 56636, 56637, 56638, 56639, 56640, 56641, 56642, 56643, 56644, 56645, 56646, 56647, 56648, 56649, 56650, 56651, 56652, 56653, 56654, 56655, 56656, 56657, 56658, 56659, 56660, 56661, 56662, 56663, 56664, 56665, 56666, 56667, 56668, 56669, 56670, 56671, 56672, 56673, 56674, 56675, 56676, 56677, 56678, 56679, 56680, 56681, 56682, 56683, 56684, 56685, 56686, 56687, 56688, 56689, 56690, 56691, 56692, 56693, 56694, 56695, 56696, 56697, 56698, 56699, 56700, 56701, 56702, 56703, 56704, 56705, 56706, 56707, 56708, 56709, 56710, 56711, 56712, 56713, 56714, 56715, 56716, 56717, 56718, 56719, 56720, 56721, 56722, 56723, 56724, 56725, 56726, 56727, 56728, 56729, 56730, 56731, 56732, 56733, 56734, 56735, 56736, 56737, 56738, 56739, 56740, 56741, 56742, 56743, 56744, 56745, 56746, 56747, 56748, 56749, 56750, 56751, 56752, 56753, 56754, 56755, 56756, 56757, 56758, 56759, 56760, 56761, 56762, 56763, 56764, 56765, 56766, 56767, 56768, 56769, 56770, 56771, 56772, 56773, 56774, 56775, 56776, 56777, 56778, 56779, 56780, 56781, 56782, 56783, 56784, 56785, 56786, 56787, 56788, 56789, 56790, 56791, 56792, 56793, 56794, 56795, 56796, 56797, 56798, 56799, 56800, 56801, 56802, 56803, 56804, 56805, 56806, 56807, 56808, 56809, 56810, 56811, 56812, 56813, 56814, 56815, 56816, 56817, 56818, 56819, 56820, 56821, 56822, 56823, 56824, 56825, 56826, 56827, 56828, 56829, 56830, 56831, 56832, 56833, 56834, 56835, 56836, 56837, 56838, 56839, 56840, 56841, 56842, 56843, 56844, 56845, 56846, 56847, 56848, 56849, 56850, 56851, 56852, 56853, 56854, 56855, 56856, 56857, 56858, 56859, 56860, 56861, 56862, 56863, 56864, 56865, 56866, 56867, 56868, 56869, 56870, 56871, 56872, 56873, 56874, 56875, 56876, 56877, 56878, 56879, 56880, 56881, 56882, 56883, 56884, 56885, 56886, 56887, 56888, 56889, 56890, 56891, 56892, 56893, 56894, 56895, 56896, 56897, 56898, 56899, 56900, 56901, 56902, 56903, 56904, 56905, 56906, 56907, 56908, 56909, 56910, 56911, 56912, 56913, 56914, 56915, 56916, 56917, 56918, 56919, 56920, 56921, 56922, 56923, 56924, 56925, 56926, 56927, 56928, 56929, 56930, 56931, 56932, 56933, 56934, 56935, 56936, 56937, 56938, 56939, 56940, 56941, 56942, 56943, 56944, 56945, 56946, 56947, 56948, 56949, 56950, 56951, 56952, 56953, 56954, 56955, 56956, 56957, 56958, 56959, 56960, 56961, 56962, 56963, 56964, 56965, 56966, 56967, 56968, 56969, 56970, 56971, 56972, 56973, 56974, 56975, 56976, 56977, 56978, 56979, 56980, 56981, 56982, 56983, 56984, 56985, 56986, 56987, 56988, 56989, 56990, 56991, 56992, 56993, 56994, 56995, 56996, 56997, 56998, 56999, 57000, 57001, 57002, 57003, 57004, 57005, 57006, 57007, 57008, 57009, 57010, 57011, 57012, 57013, 57014, 57015, 57016, 57017, 57018, 57019, 57020, 57021, 57022, 57023, 57024, 57025, 57026, 57027, 57028, 57029, 57030, 57031, 57032, 57033, 57034, 57035, 57036, 57037, 57038, 57039, 57040, 57041, 57042, 57043, 57044, 57045, 57046, 57047, 57048, 57049, 57050, 57051, 57052, 57053, 57054, 57055, 57056, 57057, 57058, 57059, 57060, 57061, 57062, 57063, 57064, 57065, 57066, 57067, 57068, 57069, 57070, 57071, 57072, 57073, 57074, 57075, 57076, 57077, 57078, 57079, 57080, 57081, 57082, 57083, 57084, 57085, 57086, 57087, 57088, 57089, 57090, 57091, 57092, 57093, 57094, 57095, 57096, 57097, 57098, 57099, 57100, 57101, 57102, 57103, 57104, 57105, 57106, 57107, 57108, 57109, 57110, 57111, 57112, 57113, 57114, 57115, 57116, 57117, 57118, 57119, 57120, 57121, 57122, 57123, 57124, 57125, 57126, 57127, 57128, 57129, 57130, 57131, 57132, 57133, 57134, 57135, 57136, 57137, 57138, 57139, 57140, 57141, 57142, 57143, 57144, 57145, 57146, 57147, 57148, 57149, 57150, 57151, 57152, 57153, 57154, 57155, 57156, 57157, 57158, 57159, 57160, 57161, 57162, 57163, 57164, 57165, 57166, 57167, 57168, 57169, 57170, 57171, 57172, 57173, 57174, 57175, 57176, 57177, 57178, 57179, 57180, 57181, 57182, 57183, 57184, 57185, 57186, 57187, 57188, 57189, 57190, 57191, 57192, 57193, 57194, 57195, 57196, 57197, 57198, 57199, 57200, 57201, 57202, 57203, 57204, 57205, 57206, 57207, 57208, 57209, 57210, 57211, 57212, 57213, 57214, 57215, 57216, 57217, 57218, 57219, 57220, 57221, 57222, 57223, 57224, 57225, 57226, 57227, 57228, 57229, 57230, 57231, 57232, 57233, 57234, 57235, 57236, 57237, 57238, 57239, 57240, 57241, 57242, 57243, 57244, 57245, 57246, 57247, 57248, 57249, 57250, 57251, 57252, 57253, 57254, 57255, 57256, 57257, 57258, 57259, 57260, 57261, 57262, 57263, 57264, 57265, 57266, 57267, 57268, 57269, 57270, 57271, 57272, 57273, 57274, 57275, 57276, 57277, 57278, 57279, 57280, 57281, 57282, 57283, 57284, 57285, 57286, 57287, 57288, 57289, 57290, 57291, 57292, 57293, 57294, 57295, 57296, 57297, 57298, 57299, 57300, 57301, 57302, 57303, 57304, 57305, 57306, 57307, 57308, 57309, 57310, 57311, 57312, 57313, 57314, 57315, 57316, 57317, 57318, 57319, 57320, 57321, 57322, 57323, 57324, 57325, 57326, 57327, 57328, 57329, 57330, 57331, 57332, 57333, 57334, 57335, 57336, 57337, 57338, 57339, 57340, 57341, 57342, 57343, 57344, 57345, 57346, 57347, 57348, 57349, 57350, 57351, 57352, 57353, 57354, 57355, 57356, 57357, 57358, 57359, 57360, 57361, 57362, 57363, 57364, 57365, 57366, 57367, 57368, 57369, 57370, 57371, 57372, 57373, 57374, 57375, 57376, 57377, 57378, 57379, 57380, 57381, 57382, 57383, 57384, 57385, 57386, 57387, 57388, 57389, 57390, 57391, 57392, 57393, 57394, 57395, 57396, 57397, 57398, 57399, 57400, 57401, 57402, 57403, 57404, 57405, 57406, 57407, 57408, 57409, 57410, 57411, 57412, 57413, 57414, 57415, 57416, 57417, 57418, 57419, 57420, 57421, 57422, 57423, 57424, 57425, 57426, 57427, 57428, 57429, 57430, 57431, 57432, 57433, 57434, 57435, 57436, 57437, 57438, 57439, 57440, 57441, 57442, 57443, 57444, 57445, 57446, 57447, 57448, 57449, 57450, 57451, 57452, 57453, 57454, 57455, 57456, 57457, 57458, 57459, 57460, 57461, 57462, 57463, 57464, 57465, 57466, 57467, 57468, 57469, 57470, 57471, 57472, 57473, 57474, 57475, 57476, 57477, 57478, 57479, 57480, 57481, 57482, 57483, 57484, 57485, 57486, 57487, 57488, 57489, 57490, 57491, 57492, 57493, 57494, 57495, 57496, 57497, 57498, 57499, 57500, 57501, 57502, 57503, 57504, 57505, 57506, 57507, 57508, 57509, 57510, 57511, 57512, 57513, 57514, 57515, 57516, 57517, 57518, 57519, 57520, 57521, 57522, 57523, 57524, 57525, 57526, 57527, 57528, 57529, 57530, 57531, 57532, 57533, 57534, 57535, 57536, 57537, 57538, 57539, 57540, 57541, 57542, 57543, 57544, 57545, 57546, 57547, 57548, 57549, 57550, 57551, 57552, 57553, 57554, 57555, 57556, 57557, 57558, 57559, 57560, 57561, 57562, 57563, 57564, 57565, 57566, 57567, 57568, 57569, 57570, 57571, 57572, 57573, 57574, 57575, 57576, 57577, 57578, 57579, 57580, 57581, 57582, 57583, 57584, 57585, 57586, 57587, 57588, 57589, 57590, 57591, 57592, 57593, 57594, 57595, 57596, 57597, 57598, 57599, 57600, 57601, 57602, 57603, 57604, 57605, 57606, 57607, 57608, 57609, 57610, 57611, 57612, 57613, 57614, 57615, 57616, 57617, 57618, 57619, 57620, 57621, 57622, 57623, 57624, 57625, 57626, 57627, 57628, 57629, 57630, 57631, 57632, 57633, 57634, 57635, 57636, 57637, 57638, 57639, 57640, 57641, 57642, 57643, 57644, 57645, 57646, 57647, 57648, 57649, 57650, 57651, 57652, 57653, 57654, 57655, 57656, 57657, 57658, 57659, 57660, 57661, 57662, 57663, 57664, 57665, 57666, 57667, 57668, 57669, 57670, 57671, 57672, 57673, 57674, 57675, 57676, 57677, 57678, 57679, 57680, 57681, 57682, 57683, 57684, 57685, 57686, 57687, 57688, 57689, 57690, 57691, 57692, 57693, 57694, 57695, 57696, 57697, 57698, 57699, 57700, 57701, 57702, 57703, 57704, 57705, 57706, 57707, 57708, 57709, 57710, 57711, 57712, 57713, 57714, 57715, 57716, 57717, 57718, 57719, 57720, 57721, 57722, 57723, 57724, 57725, 57726, 57727, 57728, 57729, 57730, 57731, 57732, 57733, 57734, 57735, 57736, 57737, 57738, 57739, 57740, 57741, 57742, 57743, 57744, 57745, 57746, 57747, 57748, 57749, 57750, 57751, 57752, 57753, 57754, 57755, 57756, 57757, 57758, 57759, 57760, 57761, 57762, 57763, 57764, 57765, 57766, 57767, 57768, 57769, 57770, 57771, 57772, 57773, 57774, 57775, 57776, 57777, 57778, 57779, 57780, 57781, 57782, 57783, 57784, 57785, 57786, 57787, 57788, 57789, 57790, 57791, 57792, 57793, 57794, 57795, 57796, 57797, 57798, 57799, 57800, 57801, 57802, 57803, 57804, 57805, 57806, 57807, 57808, 57809, 57810, 57811, 57812, 57813, 57814, 57815, 57816, 57817, 57818, 57819, 57820, 57821, 57822, 57823, 57824, 57825, 57826, 57827, 57828, 57829, 57830, 57831, 57832, 57833, 57834, 57835, 57836, 57837, 57838, 57839, 57840, 57841, 57842, 57843, 57844, 57845, 57846, 57847, 57848, 57849, 57850, 57851, 57852, 57853, 57854, 57855, 57856, 57857, 57858, 57859, 57860, 57861, 57862, 57863, 57864, 57865, 57866, 57867, 57868, 57869, 57870, 57871, 57872, 57873, 57874, 57875, 57876, 57877, 57878, 57879, 57880, 57881, 57882, 57883, 57884, 57885, 57886, 57887, 57888, 57889, 57890, 57891, 57892, 57893, 57894, 57895, 57896, 57897, 57898, 57899, 57900, 57901, 57902, 57903, 57904, 57905, 57906, 57907, 57908, 57909, 57910, 57911, 57912, 57913, 57914, 57915, 57916, 57917, 57918, 57919, 57920, 57921, 57922, 57923, 57924, 57925, 57926, 57927, 57928, 57929, 57930, 57931, 57932, 57933, 57934, 57935, 57936, 57937, 57938, 57939, 57940, 57941, 57942, 57943, 57944, 57945, 57946, 57947, 57948, 57949, 57950, 57951, 57952, 57953, 57954, 57955, 57956, 57957, 57958, 57959, 57960, 57961, 57962, 57963, 57964, 57965, 57966, 57967, 57968, 57969, 57970, 57971, 57972, 57973, 57974, 57975, 57976, 57977, 57978, 57979, 57980, 57981, 57982, 57983, 57984, 57985, 57986, 57987, 57988, 57989, 57990, 57991, 57992, 57993, 57994, 57995, 57996, 57997, 57998, 57999, 58000, 58001, 58002, 58003, 58004, 58005, 58006, 58007, 58008, 58009, 58010, 58011, 58012, 58013, 58014, 58015, 58016, 58017, 58018, 58019, 58020, 58021, 58022, 58023, 58024, 58025, 58026, 58027, 58028, 58029, 58030, 58031, 58032, 58033, 58034, 58035, 58036, 58037, 58038, 58039, 58040, 58041, 58042, 58043, 58044, 58045, 58046, 58047, 58048, 58049, 58050, 58051, 58052, 58053, 58054, 58055, 58056, 58057, 58058, 58059, 58060, 58061, 58062, 58063, 58064, 58065, 58066, 58067, 58068, 58069, 58070, 58071, 58072, 58073, 58074, 58075, 58076, 58077, 58078, 58079, 58080, 58081, 58082, 58083, 58084, 58085, 58086, 58087, 58088, 58089, 58090, 58091, 58092, 58093, 58094, 58095, 58096, 58097, 58098, 58099, 58100, 58101, 58102, 58103, 58104, 58105, 58106, 58107, 58108, 58109, 58110, 58111, 58112, 58113, 58114, 58115, 58116, 58117, 58118, 58119, 58120, 58121, 58122, 58123, 58124, 58125, 58126, 58127, 58128, 58129, 58130, 58131, 58132, 58133, 58134, 58135, 58136, 58137, 58138, 58139, 58140, 58141, 58142, 58143, 58144, 58145, 58146, 58147, 58148, 58149, 58150, 58151, 58152, 58153, 58154, 58155, 58156, 58157, 58158, 58159, 58160, 58161, 58162, 58163, 58164, 58165, 58166, 58167, 58168, 58169, 58170, 58171, 58172, 58173, 58174, 58175, 58176, 58177, 58178, 58179, 58180, 58181, 58182, 58183, 58184, 58185, 58186, 58187, 58188, 58189, 58190, 58191, 58192, 58193, 58194, 58195, 58196, 58197, 58198, 58199, 58200, 58201, 58202, 58203, 58204, 58205, 58206, 58207, 58208, 58209, 58210, 58211, 58212, 58213, 58214, 58215, 58216, 58217, 58218, 58219, 58220, 58221, 58222, 58223, 58224, 58225, 58226, 58227, 58228, 58229, 58230, 58231, 58232, 58233, 58234, 58235, 58236, 58237, 58238, 58239, 58240, 58241, 58242, 58243, 58244, 58245, 58246, 58247, 58248, 58249, 58250, 58251, 58252, 58253, 58254, 58255, 58256, 58257, 58258, 58259, 58260, 58261, 58262, 58263, 58264, 58265, 58266, 58267, 58268, 58269, 58270, 58271, 58272, 58273, 58274, 58275, 58276, 58277, 58278, 58279, 58280, 58281, 58282, 58283, 58284, 58285, 58286, 58287, 58288, 58289, 58290, 58291, 58292, 58293, 58294, 58295, 58296, 58297, 58298, 58299, 58300, 58301, 58302, 58303, 58304, 58305, 58306, 58307, 58308, 58309, 58310, 58311, 58312, 58313, 58314, 58315, 58316, 58317, 58318, 58319, 58320, 58321, 58322, 58323, 58324, 58325, 58326, 58327, 58328, 58329, 58330, 58331, 58332, 58333, 58334, 58335, 58336, 58337, 58338, 58339, 58340, 58341, 58342, 58343, 58344, 58345, 58346, 58347, 58348, 58349, 58350, 58351, 58352, 58353, 58354, 58355, 58356, 58357, 58358, 58359, 58360, 58361, 58362, 58363, 58364, 58365, 58366, 58367, 58368, 58369, 58370, 58371, 58372, 58373, 58374, 58375, 58376, 58377, 58378, 58379, 58380, 58381, 58382, 58383, 58384, 58385, 58386, 58387, 58388, 58389, 58390, 58391, 58392, 58393, 58394, 58395, 58396, 58397, 58398, 58399, 58400, 58401, 58402, 58403, 58404, 58405, 58406, 58407, 58408, 58409, 58410, 58411, 58412, 58413, 58414, 58415, 58416, 58417, 58418, 58419, 58420, 58421, 58422, 58423, 58424, 58425, 58426, 58427, 58428, 58429, 58430, 58431, 58432, 58433, 58434, 58435, 58436, 58437, 58438, 58439, 58440, 58441, 58442, 58443, 58444, 58445, 58446, 58447, 58448, 58449, 58450, 58451, 58452, 58453, 58454, 58455, 58456, 58457, 58458, 58459, 58460, 58461, 58462, 58463, 58464, 58465, 58466, 58467, 58468, 58469, 58470, 58471, 58472, 58473, 58474, 58475, 58476, 58477, 58478, 58479, 58480, 58481, 58482, 58483, 58484, 58485, 58486, 58487, 58488, 58489, 58490, 58491, 58492, 58493, 58494, 58495, 58496, 58497, 58498, 58499, 58500, 58501, 58502, 58503, 58504, 58505, 58506, 58507, 58508, 58509, 58510, 58511, 58512, 58513, 58514, 58515, 58516, 58517, 58518, 58519, 58520, 58521, 58522, 58523, 58524, 58525, 58526, 58527, 58528, 58529, 58530, 58531, 58532, 58533, 58534, 58535, 58536, 58537, 58538, 58539, 58540, 58541, 58542, 58543, 58544, 58545, 58546, 58547, 58548, 58549, 58550, 58551, 58552, 58553, 58554, 58555, 58556, 58557, 58558, 58559, 58560, 58561, 58562, 58563, 58564, 58565, 58566, 58567, 58568, 58569, 58570, 58571, 58572, 58573, 58574, 58575, 58576, 58577, 58578, 58579, 58580, 58581, 58582, 58583, 58584, 58585, 58586, 58587, 58588, 58589, 58590, 58591, 58592, 58593, 58594, 58595, 58596, 58597, 58598, 58599, 58600, 58601, 58602, 58603, 58604, 58605, 58606, 58607, 58608, 58609, 58610, 58611, 58612, 58613, 58614, 58615, 58616, 58617, 58618, 58619, 58620, 58621, 58622, 58623, 58624, 58625, 58626, 58627, 58628, 58629, 58630, 58631, 58632, 58633, 58634, 58635, 58636, 58637, 58638, 58639, 58640, 58641, 58642, 58643, 58644, 58645, 58646, 58647, 58648, 58649, 58650, 58651, 58652, 58653, 58654, 58655, 58656, 58657, 58658, 58659, 58660, 58661, 58662, 58663, 58664, 58665, 58666, 58667, 58668, 58669, 58670, 58671, 58672, 58673, 58674, 58675, 58676, 58677, 58678, 58679, 58680, 58681, 58682, 58683, 58684, 58685, 58686, 58687, 58688, 58689, 58690, 58691, 58692, 58693, 58694, 58695, 58696, 58697, 58698, 58699, 58700, 58701, 58702, 58703, 58704, 58705, 58706, 58707, 58708, 58709, 58710, 58711, 58712, 58713, 58714, 58715, 58716, 58717, 58718, 58719, 58720, 58721, 58722, 58723, 58724, 58725, 58726, 58727, 58728, 58729, 58730, 58731, 58732, 58733, 58734, 58735, 58736, 58737, 58738, 58739, 58740, 58741, 58742, 58743, 58744, 58745, 58746, 58747, 58748, 58749, 58750, 58751, 58752, 58753, 58754, 58755, 58756, 58757, 58758, 58759, 58760, 58761, 58762, 58763, 58764, 58765, 58766, 58767, 58768, 58769, 58770, 58771, 58772, 58773, 58774, 58775, 58776, 58777, 58778, 58779, 58780, 58781, 58782, 58783, 58784, 58785, 58786, 58787, 58788, 58789, 58790, 58791, 58792, 58793, 58794, 58795, 58796, 58797, 58798, 58799, 58800, 58801, 58802, 58803, 58804, 58805, 58806, 58807, 58808, 58809, 58810, 58811, 58812, 58813, 58814, 58815, 58816, 58817, 58818, 58819, 58820, 58821, 58822, 58823, 58824, 58825, 58826, 58827, 58828, 58829, 58830, 58831, 58832, 58833, 58834, 58835, 58836, 58837, 58838, 58839, 58840, 58841, 58842, 58843, 58844, 58845, 58846, 58847, 58848, 58849, 58850, 58851, 58852, 58853, 58854, 58855, 58856, 58857, 58858, 58859, 58860, 58861, 58862, 58863, 58864, 58865, 58866, 58867, 58868, 58869, 58870, 58871, 58872, 58873, 58874, 58875, 58876, 58877, 58878, 58879, 58880, 58881, 58882, 58883, 58884, 58885, 58886, 58887, 58888, 58889, 58890, 58891, 58892, 58893, 58894, 58895, 58896, 58897, 58898, 58899, 58900, 58901, 58902, 58903, 58904, 58905, 58906, 58907, 58908, 58909, 58910, 58911, 58912, 58913, 58914, 58915, 58916, 58917, 58918, 58919, 58920, 58921, 58922, 58923, 58924, 58925, 58926, 58927, 58928, 58929, 58930, 58931, 58932, 58933, 58934, 58935, 58936, 58937, 58938, 58939, 58940, 58941, 58942, 58943, 58944, 58945, 58946, 58947, 58948, 58949, 58950, 58951, 58952, 58953, 58954, 58955, 58956, 58957, 58958, 58959, 58960, 58961, 58962, 58963, 58964, 58965, 58966, 58967, 58968, 58969, 58970, 58971, 58972, 58973, 58974, 58975, 58976, 58977, 58978, 58979, 58980, 58981, 58982, 58983, 58984, 58985, 58986, 58987, 58988, 58989, 58990, 58991, 58992, 58993, 58994, 58995, 58996, 58997, 58998, 58999, 59000, 59001, 59002, 59003, 59004, 59005, 59006, 59007, 59008, 59009, 59010, 59011, 59012, 59013, 59014, 59015, 59016, 59017, 59018, 59019, 59020, 59021, 59022, 59023, 59024, 59025, 59026, 59027, 59028, 59029, 59030, 59031, 59032, 59033, 59034, 59035, 59036, 59037, 59038, 59039, 59040, 59041, 59042, 59043, 59044, 59045, 59046, 59047, 59048, 59049, 59050, 59051, 59052, 59053, 59054, 59055, 59056, 59057, 59058, 59059, 59060, 59061, 59062, 59063, 59064, 59065, 59066, 59067, 59068, 59069, 59070, 59071, 59072, 59073, 59074, 59075, 59076, 59077, 59078, 59079, 59080, 59081, 59082, 59083, 59084, 59085, 59086, 59087, 59088, 59089, 59090, 59091, 59092, 59093, 59094, 59095, 59096, 59097, 59098, 59099, 59100, 59101, 59102, 59103, 59104, 59105, 59106, 59107, 59108, 59109, 59110, 59111, 59112, 59113, 59114, 59115, 59116, 59117, 59118, 59119, 59120, 59121, 59122, 59123, 59124, 59125, 59126, 59127, 59128, 59129, 59130, 59131, 59132, 59133, 59134, 59135, 59136, 59137, 59138, 59139, 59140, 59141, 59142, 59143, 59144, 59145, 59146, 59147, 59148, 59149, 59150, 59151, 59152, 59153, 59154, 59155, 59156, 59157, 59158, 59159, 59160, 59161, 59162, 59163, 59164, 59165, 59166, 59167, 59168, 59169, 59170, 59171, 59172, 59173, 59174, 59175, 59176, 59177, 59178, 59179, 59180, 59181, 59182, 59183, 59184, 59185, 59186, 59187, 59188, 59189, 59190, 59191, 59192, 59193, 59194, 59195, 59196, 59197, 59198, 59199, 59200, 59201, 59202, 59203, 59204, 59205, 59206, 59207, 59208, 59209, 59210, 59211, 59212, 59213, 59214, 59215, 59216, 59217, 59218, 59219, 59220, 59221, 59222, 59223, 59224, 59225, 59226, 59227, 59228, 59229, 59230, 59231, 59232, 59233, 59234, 59235, 59236, 59237, 59238, 59239, 59240, 59241, 59242, 59243, 59244, 59245, 59246, 59247, 59248, 59249, 59250, 59251, 59252, 59253, 59254, 59255, 59256, 59257, 59258, 59259, 59260, 59261, 59262, 59263, 59264, 59265, 59266, 59267, 59268, 59269, 59270, 59271, 59272, 59273, 59274, 59275, 59276, 59277, 59278, 59279, 59280, 59281, 59282, 59283, 59284, 59285, 59286, 59287, 59288, 59289, 59290, 59291, 59292, 59293, 59294, 59295, 59296, 59297, 59298, 59299, 59300, 59301, 59302, 59303, 59304, 59305, 59306, 59307, 59308, 59309, 59310, 59311, 59312, 59313, 59314, 59315, 59316, 59317, 59318, 59319, 59320, 59321, 59322, 59323, 59324, 59325, 59326, 59327, 59328, 59329, 59330, 59331, 59332, 59333, 59334, 59335, 59336, 59337, 59338, 59339, 59340, 59341, 59342, 59343, 59344, 59345, 59346, 59347, 59348, 59349, 59350, 59351, 59352, 59353, 59354, 59355, 59356, 59357, 59358, 59359, 59360, 59361, 59362, 59363, 59364, 59365, 59366, 59367, 59368, 59369, 59370, 59371, 59372, 59373, 59374, 59375, 59376, 59377, 59378, 59379, 59380, 59381, 59382, 59383, 59384, 59385, 59386, 59387, 59388, 59389, 59390, 59391, 59392, 59393, 59394, 59395, 59396, 59397, 59398, 59399, 59400, 59401, 59402, 59403, 59404, 59405, 59406, 59407, 59408, 59409, 59410, 59411, 59412, 59413, 59414, 59415, 59416, 59417, 59418, 59419, 59420, 59421, 59422, 59423, 59424, 59425, 59426, 59427, 59428, 59429, 59430, 59431, 59432, 59433, 59434, 59435, 59436, 59437, 59438, 59439, 59440, 59441, 59442, 59443, 59444, 59445, 59446, 59447, 59448, 59449, 59450, 59451, 59452, 59453, 59454, 59455, 59456, 59457, 59458, 59459, 59460, 59461, 59462, 59463, 59464, 59465, 59466, 59467, 59468, 59469, 59470, 59471, 59472, 59473, 59474, 59475, 59476, 59477, 59478, 59479, 59480, 59481, 59482, 59483, 59484, 59485, 59486, 59487, 59488, 59489, 59490, 59491, 59492, 59493, 59494, 59495, 59496, 59497, 59498, 59499, 59500, 59501, 59502, 59503, 59504, 59505, 59506, 59507, 59508, 59509, 59510, 59511, 59512, 59513, 59514, 59515, 59516, 59517, 59518, 59519, 59520, 59521, 59522, 59523, 59524, 59525, 59526, 59527, 59528, 59529, 59530, 59531, 59532, 59533, 59534, 59535, 59536, 59537, 59538, 59539, 59540, 59541, 59542, 59543, 59544, 59545, 59546, 59547, 59548, 59549, 59550, 59551, 59552, 59553, 59554, 59555, 59556, 59557, 59558, 59559, 59560, 59561, 59562, 59563, 59564, 59565, 59566, 59567, 59568, 59569, 59570, 59571, 59572, 59573, 59574, 59575, 59576, 59577, 59578, 59579, 59580, 59581, 59582, 59583, 59584, 59585, 59586, 59587, 59588, 59589, 59590, 59591, 59592, 59593, 59594, 59595, 59596, 59597, 59598, 59599, 59600, 59601, 59602, 59603, 59604, 59605, 59606, 59607, 59608, 59609, 59610, 59611, 59612, 59613, 59614, 59615, 59616, 59617, 59618, 59619, 59620, 59621, 59622, 59623, 59624, 59625, 59626, 59627, 59628, 59629, 59630, 59631, 59632, 59633, 59634, 59635, 59636, 59637, 59638, 59639, 59640, 59641, 59642, 59643, 59644, 59645, 59646, 59647, 59648, 59649, 59650, 59651, 59652, 59653, 59654, 59655, 59656, 59657, 59658, 59659, 59660, 59661, 59662, 59663, 59664, 59665, 59666, 59667, 59668, 59669, 59670, 59671, 59672, 59673, 59674, 59675, 59676, 59677, 59678, 59679, 59680, 59681, 59682, 59683, 59684, 59685, 59686, 59687, 59688, 59689, 59690, 59691, 59692, 59693, 59694, 59695, 59696, 59697, 59698, 59699, 59700, 59701, 59702, 59703, 59704, 59705, 59706, 59707, 59708, 59709, 59710, 59711, 59712, 59713, 59714, 59715, 59716, 59717, 59718, 59719, 59720, 59721, 59722, 59723, 59724, 59725, 59726, 59727, 59728, 59729, 59730, 59731, 59732, 59733, 59734, 59735, 59736, 59737, 59738, 59739, 59740, 59741, 59742, 59743, 59744, 59745, 59746, 59747, 59748, 59749, 59750, 59751, 59752, 59753, 59754, 59755, 59756, 59757, 59758, 59759, 59760, 59761, 59762, 59763, 59764, 59765, 59766, 59767, 59768, 59769, 59770, 59771, 59772, 59773, 59774, 59775, 59776, 59777, 59778, 59779, 59780, 59781, 59782, 59783, 59784, 59785, 59786, 59787, 59788, 59789, 59790, 59791, 59792, 59793, 59794, 59795, 59796, 59797, 59798, 59799, 59800, 59801, 59802, 59803, 59804, 59805, 59806, 59807, 59808, 59809, 59810, 59811, 59812, 59813, 59814, 59815, 59816, 59817, 59818, 59819, 59820, 59821, 59822, 59823, 59824, 59825, 59826, 59827, 59828, 59829, 59830, 59831, 59832, 59833, 59834, 59835, 59836, 59837, 59838, 59839, 59840, 59841, 59842, 59843, 59844, 59845, 59846, 59847, 59848, 59849, 59850, 59851, 59852, 59853, 59854, 59855, 59856, 59857, 59858, 59859, 59860, 59861, 59862, 59863, 59864, 59865, 59866, 59867, 59868, 59869, 59870, 59871, 59872, 59873, 59874, 59875, 59876, 59877, 59878, 59879, 59880, 59881, 59882, 59883, 59884, 59885, 59886, 59887, 59888, 59889, 59890, 59891, 59892, 59893, 59894, 59895, 59896, 59897, 59898, 59899, 59900, 59901, 59902, 59903, 59904, 59905, 59906, 59907, 59908, 59909, 59910, 59911, 59912, 59913, 59914, 59915, 59916, 59917, 59918, 59919, 59920, 59921, 59922, 59923, 59924, 59925, 59926, 59927, 59928, 59929, 59930, 59931, 59932, 59933, 59934, 59935, 59936, 59937, 59938, 59939, 59940, 59941, 59942, 59943, 59944, 59945, 59946, 59947, 59948, 59949, 59950, 59951, 59952, 59953, 59954, 59955, 59956, 59957, 59958, 59959, 59960, 59961, 59962, 59963, 59964, 59965, 59966, 59967, 59968, 59969, 59970, 59971, 59972, 59973, 59974, 59975, 59976, 59977, 59978, 59979, 59980, 59981, 59982, 59983, 59984, 59985, 59986, 59987, 59988, 59989, 59990, 59991, 59992, 59993, 59994, 59995, 59996, 59997, 59998, 59999, 60000, 60001, 60002, 60003, 60004, 60005, 60006, 60007, 60008, 60009, 60010, 60011, 60012, 60013, 60014, 60015, 60016, 60017, 60018, 60019, 60020, 60021, 60022, 60023, 60024, 60025, 60026, 60027, 60028, 60029, 60030, 60031, 60032, 60033, 60034, 60035, 60036, 60037, 60038, 60039, 60040, 60041, 60042, 60043, 60044, 60045, 60046, 60047, 60048, 60049, 60050, 60051, 60052, 60053, 60054, 60055, 60056, 60057, 60058, 60059, 60060, 60061, 60062, 60063, 60064, 60065, 60066, 60067, 60068, 60069, 60070, 60071, 60072, 60073, 60074, 60075, 60076, 60077, 60078, 60079, 60080, 60081, 60082, 60083, 60084, 60085, 60086, 60087, 60088, 60089, 60090, 60091, 60092, 60093, 60094, 60095, 60096, 60097, 60098, 60099, 60100, 60101, 60102, 60103, 60104, 60105, 60106, 60107, 60108, 60109, 60110, 60111, 60112, 60113, 60114, 60115, 60116, 60117, 60118, 60119, 60120, 60121, 60122, 60123, 60124, 60125, 60126, 60127, 60128, 60129, 60130, 60131, 60132, 60133, 60134, 60135, 60136, 60137, 60138, 60139, 60140, 60141, 60142, 60143, 60144, 60145, 60146, 60147, 60148, 60149, 60150, 60151, 60152, 60153, 60154, 60155, 60156, 60157, 60158, 60159, 60160, 60161, 60162, 60163, 60164, 60165, 60166, 60167, 60168, 60169, 60170, 60171, 60172, 60173, 60174, 60175, 60176, 60177, 60178, 60179, 60180, 60181, 60182, 60183, 60184, 60185, 60186, 60187, 60188, 60189, 60190, 60191, 60192, 60193, 60194, 60195, 60196, 60197, 60198, 60199, 60200, 60201, 60202, 60203, 60204, 60205, 60206, 60207, 60208, 60209, 60210, 60211, 60212, 60213, 60214, 60215, 60216, 60217, 60218, 60219, 60220, 60221, 60222, 60223, 60224, 60225, 60226, 60227, 60228, 60229, 60230, 60231, 60232, 60233, 60234, 60235, 60236, 60237, 60238, 60239, 60240, 60241, 60242, 60243, 60244, 60245, 60246, 60247, 60248, 60249, 60250, 60251, 60252, 60253, 60254, 60255, 60256, 60257, 60258, 60259, 60260, 60261, 60262, 60263, 60264, 60265, 60266, 60267, 60268, 60269, 60270, 60271, 60272, 60273, 60274, 60275, 60276, 60277, 60278};
+const double vEOPMJD[] = {48743, 48744, 48745, 48746, 48747, 48748, 48749, 48750, 48751, 48752, 48753, 48754, 48755, 48756, 48757, 48758, 48759, 48760, 48761, 48762, 48763, 48764, 48765, 48766, 48767, 48768, 48769, 48770, 48771, 48772, 48773, 48774, 48775, 48776, 48777, 48778, 48779, 48780, 48781, 48782, 48783, 48784, 48785, 48786, 48787, 48788, 48789, 48790, 48791, 48792, 48793, 48794, 48795, 48796, 48797, 48798, 48799, 48800, 48801, 48802, 48803, 48804, 48805, 48806, 48807, 48808, 48809, 48810, 48811, 48812, 48813, 48814, 48815, 48816, 48817, 48818, 48819, 48820, 48821, 48822, 48823, 48824, 48825, 48826, 48827, 48828, 48829, 48830, 48831, 48832, 48833, 48834, 48835, 48836, 48837, 48838, 48839, 48840, 48841, 48842, 48843, 48844, 48845, 48846, 48847, 48848, 48849, 48850, 48851, 48852, 48853, 48854, 48855, 48856, 48857, 48858, 48859, 48860, 48861, 48862, 48863, 48864, 48865, 48866, 48867, 48868, 48869, 48870, 48871, 48872, 48873, 48874, 48875, 48876, 48877, 48878, 48879, 48880, 48881, 48882, 48883, 48884, 48885, 48886, 48887, 48888, 48889, 48890, 48891, 48892, 48893, 48894, 48895, 48896, 48897, 48898, 48899, 48900, 48901, 48902, 48903, 48904, 48905, 48906, 48907, 48908, 48909, 48910, 48911, 48912, 48913, 48914, 48915, 48916, 48917, 48918, 48919, 48920, 48921, 48922, 48923, 48924, 48925, 48926, 48927, 48928, 48929, 48930, 48931, 48932, 48933, 48934, 48935, 48936, 48937, 48938, 48939, 48940, 48941, 48942, 48943, 48944, 48945, 48946, 48947, 48948, 48949, 48950, 48951, 48952, 48953, 48954, 48955, 48956, 48957, 48958, 48959, 48960, 48961, 48962, 48963, 48964, 48965, 48966, 48967, 48968, 48969, 48970, 48971, 48972, 48973, 48974, 48975, 48976, 48977, 48978, 48979, 48980, 48981, 48982, 48983, 48984, 48985, 48986, 48987, 48988, 48989, 48990, 48991, 48992, 48993, 48994, 48995, 48996, 48997, 48998, 48999, 49000, 49001, 49002, 49003, 49004, 49005, 49006, 49007, 49008, 49009, 49010, 49011, 49012, 49013, 49014, 49015, 49016, 49017, 49018, 49019, 49020, 49021, 49022, 49023, 49024, 49025, 49026, 49027, 49028, 49029, 49030, 49031, 49032, 49033, 49034, 49035, 49036, 49037, 49038, 49039, 49040, 49041, 49042, 49043, 49044, 49045, 49046, 49047, 49048, 49049, 49050, 49051, 49052, 49053, 49054, 49055, 49056, 49057, 49058, 49059, 49060, 49061, 49062, 49063, 49064, 49065, 49066, 49067, 49068, 49069, 49070, 49071, 49072, 49073, 49074, 49075, 49076, 49077, 49078, 49079, 49080, 49081, 49082, 49083, 49084, 49085, 49086, 49087, 49088, 49089, 49090, 49091, 49092, 49093, 49094, 49095, 49096, 49097, 49098, 49099, 49100, 49101, 49102, 49103, 49104, 49105, 49106, 49107, 49108, 49109, 49110, 49111, 49112, 49113, 49114, 49115, 49116, 49117, 49118, 49119, 49120, 49121, 49122, 49123, 49124, 49125, 49126, 49127, 49128, 49129, 49130, 49131, 49132, 49133, 49134, 49135, 49136, 49137, 49138, 49139, 49140, 49141, 49142, 49143, 49144, 49145, 49146, 49147, 49148, 49149, 49150, 49151, 49152, 49153, 49154, 49155, 49156, 49157, 49158, 49159, 49160, 49161, 49162, 49163, 49164, 49165, 49166, 49167, 49168, 49169, 49170, 49171, 49172, 49173, 49174, 49175, 49176, 49177, 49178, 49179, 49180, 49181, 49182, 49183, 49184, 49185, 49186, 49187, 49188, 49189, 49190, 49191, 49192, 49193, 49194, 49195, 49196, 49197, 49198, 49199, 49200, 49201, 49202, 49203, 49204, 49205, 49206, 49207, 49208, 49209, 49210, 49211, 49212, 49213, 49214, 49215, 49216, 49217, 49218, 49219, 49220, 49221, 49222, 49223, 49224, 49225, 49226, 49227, 49228, 49229, 49230, 49231, 49232, 49233, 49234, 49235, 49236, 49237, 49238, 49239, 49240, 49241, 49242, 49243, 49244, 49245, 49246, 49247, 49248, 49249, 49250, 49251, 49252, 49253, 49254, 49255, 49256, 49257, 49258, 49259, 49260, 49261, 49262, 49263, 49264, 49265, 49266, 49267, 49268, 49269, 49270, 49271, 49272, 49273, 49274, 49275, 49276, 49277, 49278, 49279, 49280, 49281, 49282, 49283, 49284, 49285, 49286, 49287, 49288, 49289, 49290, 49291, 49292, 49293, 49294, 49295, 49296, 49297, 49298, 49299, 49300, 49301, 49302, 49303, 49304, 49305, 49306, 49307, 49308, 49309, 49310, 49311, 49312, 49313, 49314, 49315, 49316, 49317, 49318, 49319, 49320, 49321, 49322, 49323, 49324, 49325, 49326, 49327, 49328, 49329, 49330, 49331, 49332, 49333, 49334, 49335, 49336, 49337, 49338, 49339, 49340, 49341, 49342, 49343, 49344, 49345, 49346, 49347, 49348, 49349, 49350, 49351, 49352, 49353, 49354, 49355, 49356, 49357, 49358, 49359, 49360, 49361, 49362, 49363, 49364, 49365, 49366, 49367, 49368, 49369, 49370, 49371, 49372, 49373, 49374, 49375, 49376, 49377, 49378, 49379, 49380, 49381, 49382, 49383, 49384, 49385, 49386, 49387, 49388, 49389, 49390, 49391, 49392, 49393, 49394, 49395, 49396, 49397, 49398, 49399, 49400, 49401, 49402, 49403, 49404, 49405, 49406, 49407, 49408, 49409, 49410, 49411, 49412, 49413, 49414, 49415, 49416, 49417, 49418, 49419, 49420, 49421, 49422, 49423, 49424, 49425, 49426, 49427, 49428, 49429, 49430, 49431, 49432, 49433, 49434, 49435, 49436, 49437, 49438, 49439, 49440, 49441, 49442, 49443, 49444, 49445, 49446, 49447, 49448, 49449, 49450, 49451, 49452, 49453, 49454, 49455, 49456, 49457, 49458, 49459, 49460, 49461, 49462, 49463, 49464, 49465, 49466, 49467, 49468, 49469, 49470, 49471, 49472, 49473, 49474, 49475, 49476, 49477, 49478, 49479, 49480, 49481, 49482, 49483, 49484, 49485, 49486, 49487, 49488, 49489, 49490, 49491, 49492, 49493, 49494, 49495, 49496, 49497, 49498, 49499, 49500, 49501, 49502, 49503, 49504, 49505, 49506, 49507, 49508, 49509, 49510, 49511, 49512, 49513, 49514, 49515, 49516, 49517, 49518, 49519, 49520, 49521, 49522, 49523, 49524, 49525, 49526, 49527, 49528, 49529, 49530, 49531, 49532, 49533, 49534, 49535, 49536, 49537, 49538, 49539, 49540, 49541, 49542, 49543, 49544, 49545, 49546, 49547, 49548, 49549, 49550, 49551, 49552, 49553, 49554, 49555, 49556, 49557, 49558, 49559, 49560, 49561, 49562, 49563, 49564, 49565, 49566, 49567, 49568, 49569, 49570, 49571, 49572, 49573, 49574, 49575, 49576, 49577, 49578, 49579, 49580, 49581, 49582, 49583, 49584, 49585, 49586, 49587, 49588, 49589, 49590, 49591, 49592, 49593, 49594, 49595, 49596, 49597, 49598, 49599, 49600, 49601, 49602, 49603, 49604, 49605, 49606, 49607, 49608, 49609, 49610, 49611, 49612, 49613, 49614, 49615, 49616, 49617, 49618, 49619, 49620, 49621, 49622, 49623, 49624, 49625, 49626, 49627, 49628, 49629, 49630, 49631, 49632, 49633, 49634, 49635, 49636, 49637, 49638, 49639, 49640, 49641, 49642, 49643, 49644, 49645, 49646, 49647, 49648, 49649, 49650, 49651, 49652, 49653, 49654, 49655, 49656, 49657, 49658, 49659, 49660, 49661, 49662, 49663, 49664, 49665, 49666, 49667, 49668, 49669, 49670, 49671, 49672, 49673, 49674, 49675, 49676, 49677, 49678, 49679, 49680, 49681, 49682, 49683, 49684, 49685, 49686, 49687, 49688, 49689, 49690, 49691, 49692, 49693, 49694, 49695, 49696, 49697, 49698, 49699, 49700, 49701, 49702, 49703, 49704, 49705, 49706, 49707, 49708, 49709, 49710, 49711, 49712, 49713, 49714, 49715, 49716, 49717, 49718, 49719, 49720, 49721, 49722, 49723, 49724, 49725, 49726, 49727, 49728, 49729, 49730, 49731, 49732, 49733, 49734, 49735, 49736, 49737, 49738, 49739, 49740, 49741, 49742, 49743, 49744, 49745, 49746, 49747, 49748, 49749, 49750, 49751, 49752, 49753, 49754, 49755, 49756, 49757, 49758, 49759, 49760, 49761, 49762, 49763, 49764, 49765, 49766, 49767, 49768, 49769, 49770, 49771, 49772, 49773, 49774, 49775, 49776, 49777, 49778, 49779, 49780, 49781, 49782, 49783, 49784, 49785, 49786, 49787, 49788, 49789, 49790, 49791, 49792, 49793, 49794, 49795, 49796, 49797, 49798, 49799, 49800, 49801, 49802, 49803, 49804, 49805, 49806, 49807, 49808, 49809, 49810, 49811, 49812, 49813, 49814, 49815, 49816, 49817, 49818, 49819, 49820, 49821, 49822, 49823, 49824, 49825, 49826, 49827, 49828, 49829, 49830, 49831, 49832, 49833, 49834, 49835, 49836, 49837, 49838, 49839, 49840, 49841, 49842, 49843, 49844, 49845, 49846, 49847, 49848, 49849, 49850, 49851, 49852, 49853, 49854, 49855, 49856, 49857, 49858, 49859, 49860, 49861, 49862, 49863, 49864, 49865, 49866, 49867, 49868, 49869, 49870, 49871, 49872, 49873, 49874, 49875, 49876, 49877, 49878, 49879, 49880, 49881, 49882, 49883, 49884, 49885, 49886, 49887, 49888, 49889, 49890, 49891, 49892, 49893, 49894, 49895, 49896, 49897, 49898, 49899, 49900, 49901, 49902, 49903, 49904, 49905, 49906, 49907, 49908, 49909, 49910, 49911, 49912, 49913, 49914, 49915, 49916, 49917, 49918, 49919, 49920, 49921, 49922, 49923, 49924, 49925, 49926, 49927, 49928, 49929, 49930, 49931, 49932, 49933, 49934, 49935, 49936, 49937, 49938, 49939, 49940, 49941, 49942, 49943, 49944, 49945, 49946, 49947, 49948, 49949, 49950, 49951, 49952, 49953, 49954, 49955, 49956, 49957, 49958, 49959, 49960, 49961, 49962, 49963, 49964, 49965, 49966, 49967, 49968, 49969, 49970, 49971, 49972, 49973, 49974, 49975, 49976, 49977, 49978, 49979, 49980, 49981, 49982, 49983, 49984, 49985, 49986, 49987, 49988, 49989, 49990, 49991, 49992, 49993, 49994, 49995, 49996, 49997, 49998, 49999, 50000, 50001, 50002, 50003, 50004, 50005, 50006, 50007, 50008, 50009, 50010, 50011, 50012, 50013, 50014, 50015, 50016, 50017, 50018, 50019, 50020, 50021, 50022, 50023, 50024, 50025, 50026, 50027, 50028, 50029, 50030, 50031, 50032, 50033, 50034, 50035, 50036, 50037, 50038, 50039, 50040, 50041, 50042, 50043, 50044, 50045, 50046, 50047, 50048, 50049, 50050, 50051, 50052, 50053, 50054, 50055, 50056, 50057, 50058, 50059, 50060, 50061, 50062, 50063, 50064, 50065, 50066, 50067, 50068, 50069, 50070, 50071, 50072, 50073, 50074, 50075, 50076, 50077, 50078, 50079, 50080, 50081, 50082, 50083, 50084, 50085, 50086, 50087, 50088, 50089, 50090, 50091, 50092, 50093, 50094, 50095, 50096, 50097, 50098, 50099, 50100, 50101, 50102, 50103, 50104, 50105, 50106, 50107, 50108, 50109, 50110, 50111, 50112, 50113, 50114, 50115, 50116, 50117, 50118, 50119, 50120, 50121, 50122, 50123, 50124, 50125, 50126, 50127, 50128, 50129, 50130, 50131, 50132, 50133, 50134, 50135, 50136, 50137, 50138, 50139, 50140, 50141, 50142, 50143, 50144, 50145, 50146, 50147, 50148, 50149, 50150, 50151, 50152, 50153, 50154, 50155, 50156, 50157, 50158, 50159, 50160, 50161, 50162, 50163, 50164, 50165, 50166, 50167, 50168, 50169, 50170, 50171, 50172, 50173, 50174, 50175, 50176, 50177, 50178, 50179, 50180, 50181, 50182, 50183, 50184, 50185, 50186, 50187, 50188, 50189, 50190, 50191, 50192, 50193, 50194, 50195, 50196, 50197, 50198, 50199, 50200, 50201, 50202, 50203, 50204, 50205, 50206, 50207, 50208, 50209, 50210, 50211, 50212, 50213, 50214, 50215, 50216, 50217, 50218, 50219, 50220, 50221, 50222, 50223, 50224, 50225, 50226, 50227, 50228, 50229, 50230, 50231, 50232, 50233, 50234, 50235, 50236, 50237, 50238, 50239, 50240, 50241, 50242, 50243, 50244, 50245, 50246, 50247, 50248, 50249, 50250, 50251, 50252, 50253, 50254, 50255, 50256, 50257, 50258, 50259, 50260, 50261, 50262, 50263, 50264, 50265, 50266, 50267, 50268, 50269, 50270, 50271, 50272, 50273, 50274, 50275, 50276, 50277, 50278, 50279, 50280, 50281, 50282, 50283, 50284, 50285, 50286, 50287, 50288, 50289, 50290, 50291, 50292, 50293, 50294, 50295, 50296, 50297, 50298, 50299, 50300, 50301, 50302, 50303, 50304, 50305, 50306, 50307, 50308, 50309, 50310, 50311, 50312, 50313, 50314, 50315, 50316, 50317, 50318, 50319, 50320, 50321, 50322, 50323, 50324, 50325, 50326, 50327, 50328, 50329, 50330, 50331, 50332, 50333, 50334, 50335, 50336, 50337, 50338, 50339, 50340, 50341, 50342, 50343, 50344, 50345, 50346, 50347, 50348, 50349, 50350, 50351, 50352, 50353, 50354, 50355, 50356, 50357, 50358, 50359, 50360, 50361, 50362, 50363, 50364, 50365, 50366, 50367, 50368, 50369, 50370, 50371, 50372, 50373, 50374, 50375, 50376, 50377, 50378, 50379, 50380, 50381, 50382, 50383, 50384, 50385, 50386, 50387, 50388, 50389, 50390, 50391, 50392, 50393, 50394, 50395, 50396, 50397, 50398, 50399, 50400, 50401, 50402, 50403, 50404, 50405, 50406, 50407, 50408, 50409, 50410, 50411, 50412, 50413, 50414, 50415, 50416, 50417, 50418, 50419, 50420, 50421, 50422, 50423, 50424, 50425, 50426, 50427, 50428, 50429, 50430, 50431, 50432, 50433, 50434, 50435, 50436, 50437, 50438, 50439, 50440, 50441, 50442, 50443, 50444, 50445, 50446, 50447, 50448, 50449, 50450, 50451, 50452, 50453, 50454, 50455, 50456, 50457, 50458, 50459, 50460, 50461, 50462, 50463, 50464, 50465, 50466, 50467, 50468, 50469, 50470, 50471, 50472, 50473, 50474, 50475, 50476, 50477, 50478, 50479, 50480, 50481, 50482, 50483, 50484, 50485, 50486, 50487, 50488, 50489, 50490, 50491, 50492, 50493, 50494, 50495, 50496, 50497, 50498, 50499, 50500, 50501, 50502, 50503, 50504, 50505, 50506, 50507, 50508, 50509, 50510, 50511, 50512, 50513, 50514, 50515, 50516, 50517, 50518, 50519, 50520, 50521, 50522, 50523, 50524, 50525, 50526, 50527, 50528, 50529, 50530, 50531, 50532, 50533, 50534, 50535, 50536, 50537, 50538, 50539, 50540, 50541, 50542, 50543, 50544, 50545, 50546, 50547, 50548, 50549, 50550, 50551, 50552, 50553, 50554, 50555, 50556, 50557, 50558, 50559, 50560, 50561, 50562, 50563, 50564, 50565, 50566, 50567, 50568, 50569, 50570, 50571, 50572, 50573, 50574, 50575, 50576, 50577, 50578, 50579, 50580, 50581, 50582, 50583, 50584, 50585, 50586, 50587, 50588, 50589, 50590, 50591, 50592, 50593, 50594, 50595, 50596, 50597, 50598, 50599, 50600, 50601, 50602, 50603, 50604, 50605, 50606, 50607, 50608, 50609, 50610, 50611, 50612, 50613, 50614, 50615, 50616, 50617, 50618, 50619, 50620, 50621, 50622, 50623, 50624, 50625, 50626, 50627, 50628, 50629, 50630, 50631, 50632, 50633, 50634, 50635, 50636, 50637, 50638, 50639, 50640, 50641, 50642, 50643, 50644, 50645, 50646, 50647, 50648, 50649, 50650, 50651, 50652, 50653, 50654, 50655, 50656, 50657, 50658, 50659, 50660, 50661, 50662, 50663, 50664, 50665, 50666, 50667, 50668, 50669, 50670, 50671, 50672, 50673, 50674, 50675, 50676, 50677, 50678, 50679, 50680, 50681, 50682, 50683, 50684, 50685, 50686, 50687, 50688, 50689, 50690, 50691, 50692, 50693, 50694, 50695, 50696, 50697, 50698, 50699, 50700, 50701, 50702, 50703, 50704, 50705, 50706, 50707, 50708, 50709, 50710, 50711, 50712, 50713, 50714, 50715, 50716, 50717, 50718, 50719, 50720, 50721, 50722, 50723, 50724, 50725, 50726, 50727, 50728, 50729, 50730, 50731, 50732, 50733, 50734, 50735, 50736, 50737, 50738, 50739, 50740, 50741, 50742, 50743, 50744, 50745, 50746, 50747, 50748, 50749, 50750, 50751, 50752, 50753, 50754, 50755, 50756, 50757, 50758, 50759, 50760, 50761, 50762, 50763, 50764, 50765, 50766, 50767, 50768, 50769, 50770, 50771, 50772, 50773, 50774, 50775, 50776, 50777, 50778, 50779, 50780, 50781, 50782, 50783, 50784, 50785, 50786, 50787, 50788, 50789, 50790, 50791, 50792, 50793, 50794, 50795, 50796, 50797, 50798, 50799, 50800, 50801, 50802, 50803, 50804, 50805, 50806, 50807, 50808, 50809, 50810, 50811, 50812, 50813, 50814, 50815, 50816, 50817, 50818, 50819, 50820, 50821, 50822, 50823, 50824, 50825, 50826, 50827, 50828, 50829, 50830, 50831, 50832, 50833, 50834, 50835, 50836, 50837, 50838, 50839, 50840, 50841, 50842, 50843, 50844, 50845, 50846, 50847, 50848, 50849, 50850, 50851, 50852, 50853, 50854, 50855, 50856, 50857, 50858, 50859, 50860, 50861, 50862, 50863, 50864, 50865, 50866, 50867, 50868, 50869, 50870, 50871, 50872, 50873, 50874, 50875, 50876, 50877, 50878, 50879, 50880, 50881, 50882, 50883, 50884, 50885, 50886, 50887, 50888, 50889, 50890, 50891, 50892, 50893, 50894, 50895, 50896, 50897, 50898, 50899, 50900, 50901, 50902, 50903, 50904, 50905, 50906, 50907, 50908, 50909, 50910, 50911, 50912, 50913, 50914, 50915, 50916, 50917, 50918, 50919, 50920, 50921, 50922, 50923, 50924, 50925, 50926, 50927, 50928, 50929, 50930, 50931, 50932, 50933, 50934, 50935, 50936, 50937, 50938, 50939, 50940, 50941, 50942, 50943, 50944, 50945, 50946, 50947, 50948, 50949, 50950, 50951, 50952, 50953, 50954, 50955, 50956, 50957, 50958, 50959, 50960, 50961, 50962, 50963, 50964, 50965, 50966, 50967, 50968, 50969, 50970, 50971, 50972, 50973, 50974, 50975, 50976, 50977, 50978, 50979, 50980, 50981, 50982, 50983, 50984, 50985, 50986, 50987, 50988, 50989, 50990, 50991, 50992, 50993, 50994, 50995, 50996, 50997, 50998, 50999, 51000, 51001, 51002, 51003, 51004, 51005, 51006, 51007, 51008, 51009, 51010, 51011, 51012, 51013, 51014, 51015, 51016, 51017, 51018, 51019, 51020, 51021, 51022, 51023, 51024, 51025, 51026, 51027, 51028, 51029, 51030, 51031, 51032, 51033, 51034, 51035, 51036, 51037, 51038, 51039, 51040, 51041, 51042, 51043, 51044, 51045, 51046, 51047, 51048, 51049, 51050, 51051, 51052, 51053, 51054, 51055, 51056, 51057, 51058, 51059, 51060, 51061, 51062, 51063, 51064, 51065, 51066, 51067, 51068, 51069, 51070, 51071, 51072, 51073, 51074, 51075, 51076, 51077, 51078, 51079, 51080, 51081, 51082, 51083, 51084, 51085, 51086, 51087, 51088, 51089, 51090, 51091, 51092, 51093, 51094, 51095, 51096, 51097, 51098, 51099, 51100, 51101, 51102, 51103, 51104, 51105, 51106, 51107, 51108, 51109, 51110, 51111, 51112, 51113, 51114, 51115, 51116, 51117, 51118, 51119, 51120, 51121, 51122, 51123, 51124, 51125, 51126, 51127, 51128, 51129, 51130, 51131, 51132, 51133, 51134, 51135, 51136, 51137, 51138, 51139, 51140, 51141, 51142, 51143, 51144, 51145, 51146, 51147, 51148, 51149, 51150, 51151, 51152, 51153, 51154, 51155, 51156, 51157, 51158, 51159, 51160, 51161, 51162, 51163, 51164, 51165, 51166, 51167, 51168, 51169, 51170, 51171, 51172, 51173, 51174, 51175, 51176, 51177, 51178, 51179, 51180, 51181, 51182, 51183, 51184, 51185, 51186, 51187, 51188, 51189, 51190, 51191, 51192, 51193, 51194, 51195, 51196, 51197, 51198, 51199, 51200, 51201, 51202, 51203, 51204, 51205, 51206, 51207, 51208, 51209, 51210, 51211, 51212, 51213, 51214, 51215, 51216, 51217, 51218, 51219, 51220, 51221, 51222, 51223, 51224, 51225, 51226, 51227, 51228, 51229, 51230, 51231, 51232, 51233, 51234, 51235, 51236, 51237, 51238, 51239, 51240, 51241, 51242, 51243, 51244, 51245, 51246, 51247, 51248, 51249, 51250, 51251, 51252, 51253, 51254, 51255, 51256, 51257, 51258, 51259, 51260, 51261, 51262, 51263, 51264, 51265, 51266, 51267, 51268, 51269, 51270, 51271, 51272, 51273, 51274, 51275, 51276, 51277, 51278, 51279, 51280, 51281, 51282, 51283, 51284, 51285, 51286, 51287, 51288, 51289, 51290, 51291, 51292, 51293, 51294, 51295, 51296, 51297, 51298, 51299, 51300, 51301, 51302, 51303, 51304, 51305, 51306, 51307, 51308, 51309, 51310, 51311, 51312, 51313, 51314, 51315, 51316, 51317, 51318, 51319, 51320, 51321, 51322, 51323, 51324, 51325, 51326, 51327, 51328, 51329, 51330, 51331, 51332, 51333, 51334, 51335, 51336, 51337, 51338, 51339, 51340, 51341, 51342, 51343, 51344, 51345, 51346, 51347, 51348, 51349, 51350, 51351, 51352, 51353, 51354, 51355, 51356, 51357, 51358, 51359, 51360, 51361, 51362, 51363, 51364, 51365, 51366, 51367, 51368, 51369, 51370, 51371, 51372, 51373, 51374, 51375, 51376, 51377, 51378, 51379, 51380, 51381, 51382, 51383, 51384, 51385, 51386, 51387, 51388, 51389, 51390, 51391, 51392, 51393, 51394, 51395, 51396, 51397, 51398, 51399, 51400, 51401, 51402, 51403, 51404, 51405, 51406, 51407, 51408, 51409, 51410, 51411, 51412, 51413, 51414, 51415, 51416, 51417, 51418, 51419, 51420, 51421, 51422, 51423, 51424, 51425, 51426, 51427, 51428, 51429, 51430, 51431, 51432, 51433, 51434, 51435, 51436, 51437, 51438, 51439, 51440, 51441, 51442, 51443, 51444, 51445, 51446, 51447, 51448, 51449, 51450, 51451, 51452, 51453, 51454, 51455, 51456, 51457, 51458, 51459, 51460, 51461, 51462, 51463, 51464, 51465, 51466, 51467, 51468, 51469, 51470, 51471, 51472, 51473, 51474, 51475, 51476, 51477, 51478, 51479, 51480, 51481, 51482, 51483, 51484, 51485, 51486, 51487, 51488, 51489, 51490, 51491, 51492, 51493, 51494, 51495, 51496, 51497, 51498, 51499, 51500, 51501, 51502, 51503, 51504, 51505, 51506, 51507, 51508, 51509, 51510, 51511, 51512, 51513, 51514, 51515, 51516, 51517, 51518, 51519, 51520, 51521, 51522, 51523, 51524, 51525, 51526, 51527, 51528, 51529, 51530, 51531, 51532, 51533, 51534, 51535, 51536, 51537, 51538, 51539, 51540, 51541, 51542, 51543, 51544, 51545, 51546, 51547, 51548, 51549, 51550, 51551, 51552, 51553, 51554, 51555, 51556, 51557, 51558, 51559, 51560, 51561, 51562, 51563, 51564, 51565, 51566, 51567, 51568, 51569, 51570, 51571, 51572, 51573, 51574, 51575, 51576, 51577, 51578, 51579, 51580, 51581, 51582, 51583, 51584, 51585, 51586, 51587, 51588, 51589, 51590, 51591, 51592, 51593, 51594, 51595, 51596, 51597, 51598, 51599, 51600, 51601, 51602, 51603, 51604, 51605, 51606, 51607, 51608, 51609, 51610, 51611, 51612, 51613, 51614, 51615, 51616, 51617, 51618, 51619, 51620, 51621, 51622, 51623, 51624, 51625, 51626, 51627, 51628, 51629, 51630, 51631, 51632, 51633, 51634, 51635, 51636, 51637, 51638, 51639, 51640, 51641, 51642, 51643, 51644, 51645, 51646, 51647, 51648, 51649, 51650, 51651, 51652, 51653, 51654, 51655, 51656, 51657, 51658, 51659, 51660, 51661, 51662, 51663, 51664, 51665, 51666, 51667, 51668, 51669, 51670, 51671, 51672, 51673, 51674, 51675, 51676, 51677, 51678, 51679, 51680, 51681, 51682, 51683, 51684, 51685, 51686, 51687, 51688, 51689, 51690, 51691, 51692, 51693, 51694, 51695, 51696, 51697, 51698, 51699, 51700, 51701, 51702, 51703, 51704, 51705, 51706, 51707, 51708, 51709, 51710, 51711, 51712, 51713, 51714, 51715, 51716, 51717, 51718, 51719, 51720, 51721, 51722, 51723, 51724, 51725, 51726, 51727, 51728, 51729, 51730, 51731, 51732, 51733, 51734, 51735, 51736, 51737, 51738, 51739, 51740, 51741, 51742, 51743, 51744, 51745, 51746, 51747, 51748, 51749, 51750, 51751, 51752, 51753, 51754, 51755, 51756, 51757, 51758, 51759, 51760, 51761, 51762, 51763, 51764, 51765, 51766, 51767, 51768, 51769, 51770, 51771, 51772, 51773, 51774, 51775, 51776, 51777, 51778, 51779, 51780, 51781, 51782, 51783, 51784, 51785, 51786, 51787, 51788, 51789, 51790, 51791, 51792, 51793, 51794, 51795, 51796, 51797, 51798, 51799, 51800, 51801, 51802, 51803, 51804, 51805, 51806, 51807, 51808, 51809, 51810, 51811, 51812, 51813, 51814, 51815, 51816, 51817, 51818, 51819, 51820, 51821, 51822, 51823, 51824, 51825, 51826, 51827, 51828, 51829, 51830, 51831, 51832, 51833, 51834, 51835, 51836, 51837, 51838, 51839, 51840, 51841, 51842, 51843, 51844, 51845, 51846, 51847, 51848, 51849, 51850, 51851, 51852, 51853, 51854, 51855, 51856, 51857, 51858, 51859, 51860, 51861, 51862, 51863, 51864, 51865, 51866, 51867, 51868, 51869, 51870, 51871, 51872, 51873, 51874, 51875, 51876, 51877, 51878, 51879, 51880, 51881, 51882, 51883, 51884, 51885, 51886, 51887, 51888, 51889, 51890, 51891, 51892, 51893, 51894, 51895, 51896, 51897, 51898, 51899, 51900, 51901, 51902, 51903, 51904, 51905, 51906, 51907, 51908, 51909, 51910, 51911, 51912, 51913, 51914, 51915, 51916, 51917, 51918, 51919, 51920, 51921, 51922, 51923, 51924, 51925, 51926, 51927, 51928, 51929, 51930, 51931, 51932, 51933, 51934, 51935, 51936, 51937, 51938, 51939, 51940, 51941, 51942, 51943, 51944, 51945, 51946, 51947, 51948, 51949, 51950, 51951, 51952, 51953, 51954, 51955, 51956, 51957, 51958, 51959, 51960, 51961, 51962, 51963, 51964, 51965, 51966, 51967, 51968, 51969, 51970, 51971, 51972, 51973, 51974, 51975, 51976, 51977, 51978, 51979, 51980, 51981, 51982, 51983, 51984, 51985, 51986, 51987, 51988, 51989, 51990, 51991, 51992, 51993, 51994, 51995, 51996, 51997, 51998, 51999, 52000, 52001, 52002, 52003, 52004, 52005, 52006, 52007, 52008, 52009, 52010, 52011, 52012, 52013, 52014, 52015, 52016, 52017, 52018, 52019, 52020, 52021, 52022, 52023, 52024, 52025, 52026, 52027, 52028, 52029, 52030, 52031, 52032, 52033, 52034, 52035, 52036, 52037, 52038, 52039, 52040, 52041, 52042, 52043, 52044, 52045, 52046, 52047, 52048, 52049, 52050, 52051, 52052, 52053, 52054, 52055, 52056, 52057, 52058, 52059, 52060, 52061, 52062, 52063, 52064, 52065, 52066, 52067, 52068, 52069, 52070, 52071, 52072, 52073, 52074, 52075, 52076, 52077, 52078, 52079, 52080, 52081, 52082, 52083, 52084, 52085, 52086, 52087, 52088, 52089, 52090, 52091, 52092, 52093, 52094, 52095, 52096, 52097, 52098, 52099, 52100, 52101, 52102, 52103, 52104, 52105, 52106, 52107, 52108, 52109, 52110, 52111, 52112, 52113, 52114, 52115, 52116, 52117, 52118, 52119, 52120, 52121, 52122, 52123, 52124, 52125, 52126, 52127, 52128, 52129, 52130, 52131, 52132, 52133, 52134, 52135, 52136, 52137, 52138, 52139, 52140, 52141, 52142, 52143, 52144, 52145, 52146, 52147, 52148, 52149, 52150, 52151, 52152, 52153, 52154, 52155, 52156, 52157, 52158, 52159, 52160, 52161, 52162, 52163, 52164, 52165, 52166, 52167, 52168, 52169, 52170, 52171, 52172, 52173, 52174, 52175, 52176, 52177, 52178, 52179, 52180, 52181, 52182, 52183, 52184, 52185, 52186, 52187, 52188, 52189, 52190, 52191, 52192, 52193, 52194, 52195, 52196, 52197, 52198, 52199, 52200, 52201, 52202, 52203, 52204, 52205, 52206, 52207, 52208, 52209, 52210, 52211, 52212, 52213, 52214, 52215, 52216, 52217, 52218, 52219, 52220, 52221, 52222, 52223, 52224, 52225, 52226, 52227, 52228, 52229, 52230, 52231, 52232, 52233, 52234, 52235, 52236, 52237, 52238, 52239, 52240, 52241, 52242, 52243, 52244, 52245, 52246, 52247, 52248, 52249, 52250, 52251, 52252, 52253, 52254, 52255, 52256, 52257, 52258, 52259, 52260, 52261, 52262, 52263, 52264, 52265, 52266, 52267, 52268, 52269, 52270, 52271, 52272, 52273, 52274, 52275, 52276, 52277, 52278, 52279, 52280, 52281, 52282, 52283, 52284, 52285, 52286, 52287, 52288, 52289, 52290, 52291, 52292, 52293, 52294, 52295, 52296, 52297, 52298, 52299, 52300, 52301, 52302, 52303, 52304, 52305, 52306, 52307, 52308, 52309, 52310, 52311, 52312, 52313, 52314, 52315, 52316, 52317, 52318, 52319, 52320, 52321, 52322, 52323, 52324, 52325, 52326, 52327, 52328, 52329, 52330, 52331, 52332, 52333, 52334, 52335, 52336, 52337, 52338, 52339, 52340, 52341, 52342, 52343, 52344, 52345, 52346, 52347, 52348, 52349, 52350, 52351, 52352, 52353, 52354, 52355, 52356, 52357, 52358, 52359, 52360, 52361, 52362, 52363, 52364, 52365, 52366, 52367, 52368, 52369, 52370, 52371, 52372, 52373, 52374, 52375, 52376, 52377, 52378, 52379, 52380, 52381, 52382, 52383, 52384, 52385, 52386, 52387, 52388, 52389, 52390, 52391, 52392, 52393, 52394, 52395, 52396, 52397, 52398, 52399, 52400, 52401, 52402, 52403, 52404, 52405, 52406, 52407, 52408, 52409, 52410, 52411, 52412, 52413, 52414, 52415, 52416, 52417, 52418, 52419, 52420, 52421, 52422, 52423, 52424, 52425, 52426, 52427, 52428, 52429, 52430, 52431, 52432, 52433, 52434, 52435, 52436, 52437, 52438, 52439, 52440, 52441, 52442, 52443, 52444, 52445, 52446, 52447, 52448, 52449, 52450, 52451, 52452, 52453, 52454, 52455, 52456, 52457, 52458, 52459, 52460, 52461, 52462, 52463, 52464, 52465, 52466, 52467, 52468, 52469, 52470, 52471, 52472, 52473, 52474, 52475, 52476, 52477, 52478, 52479, 52480, 52481, 52482, 52483, 52484, 52485, 52486, 52487, 52488, 52489, 52490, 52491, 52492, 52493, 52494, 52495, 52496, 52497, 52498, 52499, 52500, 52501, 52502, 52503, 52504, 52505, 52506, 52507, 52508, 52509, 52510, 52511, 52512, 52513, 52514, 52515, 52516, 52517, 52518, 52519, 52520, 52521, 52522, 52523, 52524, 52525, 52526, 52527, 52528, 52529, 52530, 52531, 52532, 52533, 52534, 52535, 52536, 52537, 52538, 52539, 52540, 52541, 52542, 52543, 52544, 52545, 52546, 52547, 52548, 52549, 52550, 52551, 52552, 52553, 52554, 52555, 52556, 52557, 52558, 52559, 52560, 52561, 52562, 52563, 52564, 52565, 52566, 52567, 52568, 52569, 52570, 52571, 52572, 52573, 52574, 52575, 52576, 52577, 52578, 52579, 52580, 52581, 52582, 52583, 52584, 52585, 52586, 52587, 52588, 52589, 52590, 52591, 52592, 52593, 52594, 52595, 52596, 52597, 52598, 52599, 52600, 52601, 52602, 52603, 52604, 52605, 52606, 52607, 52608, 52609, 52610, 52611, 52612, 52613, 52614, 52615, 52616, 52617, 52618, 52619, 52620, 52621, 52622, 52623, 52624, 52625, 52626, 52627, 52628, 52629, 52630, 52631, 52632, 52633, 52634, 52635, 52636, 52637, 52638, 52639, 52640, 52641, 52642, 52643, 52644, 52645, 52646, 52647, 52648, 52649, 52650, 52651, 52652, 52653, 52654, 52655, 52656, 52657, 52658, 52659, 52660, 52661, 52662, 52663, 52664, 52665, 52666, 52667, 52668, 52669, 52670, 52671, 52672, 52673, 52674, 52675, 52676, 52677, 52678, 52679, 52680, 52681, 52682, 52683, 52684, 52685, 52686, 52687, 52688, 52689, 52690, 52691, 52692, 52693, 52694, 52695, 52696, 52697, 52698, 52699, 52700, 52701, 52702, 52703, 52704, 52705, 52706, 52707, 52708, 52709, 52710, 52711, 52712, 52713, 52714, 52715, 52716, 52717, 52718, 52719, 52720, 52721, 52722, 52723, 52724, 52725, 52726, 52727, 52728, 52729, 52730, 52731, 52732, 52733, 52734, 52735, 52736, 52737, 52738, 52739, 52740, 52741, 52742, 52743, 52744, 52745, 52746, 52747, 52748, 52749, 52750, 52751, 52752, 52753, 52754, 52755, 52756, 52757, 52758, 52759, 52760, 52761, 52762, 52763, 52764, 52765, 52766, 52767, 52768, 52769, 52770, 52771, 52772, 52773, 52774, 52775, 52776, 52777, 52778, 52779, 52780, 52781, 52782, 52783, 52784, 52785, 52786, 52787, 52788, 52789, 52790, 52791, 52792, 52793, 52794, 52795, 52796, 52797, 52798, 52799, 52800, 52801, 52802, 52803, 52804, 52805, 52806, 52807, 52808, 52809, 52810, 52811, 52812, 52813, 52814, 52815, 52816, 52817, 52818, 52819, 52820, 52821, 52822, 52823, 52824, 52825, 52826, 52827, 52828, 52829, 52830, 52831, 52832, 52833, 52834, 52835, 52836, 52837, 52838, 52839, 52840, 52841, 52842, 52843, 52844, 52845, 52846, 52847, 52848, 52849, 52850, 52851, 52852, 52853, 52854, 52855, 52856, 52857, 52858, 52859, 52860, 52861, 52862, 52863, 52864, 52865, 52866, 52867, 52868, 52869, 52870, 52871, 52872, 52873, 52874, 52875, 52876, 52877, 52878, 52879, 52880, 52881, 52882, 52883, 52884, 52885, 52886, 52887, 52888, 52889, 52890, 52891, 52892, 52893, 52894, 52895, 52896, 52897, 52898, 52899, 52900, 52901, 52902, 52903, 52904, 52905, 52906, 52907, 52908, 52909, 52910, 52911, 52912, 52913, 52914, 52915, 52916, 52917, 52918, 52919, 52920, 52921, 52922, 52923, 52924, 52925, 52926, 52927, 52928, 52929, 52930, 52931, 52932, 52933, 52934, 52935, 52936, 52937, 52938, 52939, 52940, 52941, 52942, 52943, 52944, 52945, 52946, 52947, 52948, 52949, 52950, 52951, 52952, 52953, 52954, 52955, 52956, 52957, 52958, 52959, 52960, 52961, 52962, 52963, 52964, 52965, 52966, 52967, 52968, 52969, 52970, 52971, 52972, 52973, 52974, 52975, 52976, 52977, 52978, 52979, 52980, 52981, 52982, 52983, 52984, 52985, 52986, 52987, 52988, 52989, 52990, 52991, 52992, 52993, 52994, 52995, 52996, 52997, 52998, 52999, 53000, 53001, 53002, 53003, 53004, 53005, 53006, 53007, 53008, 53009, 53010, 53011, 53012, 53013, 53014, 53015, 53016, 53017, 53018, 53019, 53020, 53021, 53022, 53023, 53024, 53025, 53026, 53027, 53028, 53029, 53030, 53031, 53032, 53033, 53034, 53035, 53036, 53037, 53038, 53039, 53040, 53041, 53042, 53043, 53044, 53045, 53046, 53047, 53048, 53049, 53050, 53051, 53052, 53053, 53054, 53055, 53056, 53057, 53058, 53059, 53060, 53061, 53062, 53063, 53064, 53065, 53066, 53067, 53068, 53069, 53070, 53071, 53072, 53073, 53074, 53075, 53076, 53077, 53078, 53079, 53080, 53081, 53082, 53083, 53084, 53085, 53086, 53087, 53088, 53089, 53090, 53091, 53092, 53093, 53094, 53095, 53096, 53097, 53098, 53099, 53100, 53101, 53102, 53103, 53104, 53105, 53106, 53107, 53108, 53109, 53110, 53111, 53112, 53113, 53114, 53115, 53116, 53117, 53118, 53119, 53120, 53121, 53122, 53123, 53124, 53125, 53126, 53127, 53128, 53129, 53130, 53131, 53132, 53133, 53134, 53135, 53136, 53137, 53138, 53139, 53140, 53141, 53142, 53143, 53144, 53145, 53146, 53147, 53148, 53149, 53150, 53151, 53152, 53153, 53154, 53155, 53156, 53157, 53158, 53159, 53160, 53161, 53162, 53163, 53164, 53165, 53166, 53167, 53168, 53169, 53170, 53171, 53172, 53173, 53174, 53175, 53176, 53177, 53178, 53179, 53180, 53181, 53182, 53183, 53184, 53185, 53186, 53187, 53188, 53189, 53190, 53191, 53192, 53193, 53194, 53195, 53196, 53197, 53198, 53199, 53200, 53201, 53202, 53203, 53204, 53205, 53206, 53207, 53208, 53209, 53210, 53211, 53212, 53213, 53214, 53215, 53216, 53217, 53218, 53219, 53220, 53221, 53222, 53223, 53224, 53225, 53226, 53227, 53228, 53229, 53230, 53231, 53232, 53233, 53234, 53235, 53236, 53237, 53238, 53239, 53240, 53241, 53242, 53243, 53244, 53245, 53246, 53247, 53248, 53249, 53250, 53251, 53252, 53253, 53254, 53255, 53256, 53257, 53258, 53259, 53260, 53261, 53262, 53263, 53264, 53265, 53266, 53267, 53268, 53269, 53270, 53271, 53272, 53273, 53274, 53275, 53276, 53277, 53278, 53279, 53280, 53281, 53282, 53283, 53284, 53285, 53286, 53287, 53288, 53289, 53290, 53291, 53292, 53293, 53294, 53295, 53296, 53297, 53298, 53299, 53300, 53301, 53302, 53303, 53304, 53305, 53306, 53307, 53308, 53309, 53310, 53311, 53312, 53313, 53314, 53315, 53316, 53317, 53318, 53319, 53320, 53321, 53322, 53323, 53324, 53325, 53326, 53327, 53328, 53329, 53330, 53331, 53332, 53333, 53334, 53335, 53336, 53337, 53338, 53339, 53340, 53341, 53342, 53343, 53344, 53345, 53346, 53347, 53348, 53349, 53350, 53351, 53352, 53353, 53354, 53355, 53356, 53357, 53358, 53359, 53360, 53361, 53362, 53363, 53364, 53365, 53366, 53367, 53368, 53369, 53370, 53371, 53372, 53373, 53374, 53375, 53376, 53377, 53378, 53379, 53380, 53381, 53382, 53383, 53384, 53385, 53386, 53387, 53388, 53389, 53390, 53391, 53392, 53393, 53394, 53395, 53396, 53397, 53398, 53399, 53400, 53401, 53402, 53403, 53404, 53405, 53406, 53407, 53408, 53409, 53410, 53411, 53412, 53413, 53414, 53415, 53416, 53417, 53418, 53419, 53420, 53421, 53422, 53423, 53424, 53425, 53426, 53427, 53428, 53429, 53430, 53431, 53432, 53433, 53434, 53435, 53436, 53437, 53438, 53439, 53440, 53441, 53442, 53443, 53444, 53445, 53446, 53447, 53448, 53449, 53450, 53451, 53452, 53453, 53454, 53455, 53456, 53457, 53458, 53459, 53460, 53461, 53462, 53463, 53464, 53465, 53466, 53467, 53468, 53469, 53470, 53471, 53472, 53473, 53474, 53475, 53476, 53477, 53478, 53479, 53480, 53481, 53482, 53483, 53484, 53485, 53486, 53487, 53488, 53489, 53490, 53491, 53492, 53493, 53494, 53495, 53496, 53497, 53498, 53499, 53500, 53501, 53502, 53503, 53504, 53505, 53506, 53507, 53508, 53509, 53510, 53511, 53512, 53513, 53514, 53515, 53516, 53517, 53518, 53519, 53520, 53521, 53522, 53523, 53524, 53525, 53526, 53527, 53528, 53529, 53530, 53531, 53532, 53533, 53534, 53535, 53536, 53537, 53538, 53539, 53540, 53541, 53542, 53543, 53544, 53545, 53546, 53547, 53548, 53549, 53550, 53551, 53552, 53553, 53554, 53555, 53556, 53557, 53558, 53559, 53560, 53561, 53562, 53563, 53564, 53565, 53566, 53567, 53568, 53569, 53570, 53571, 53572, 53573, 53574, 53575, 53576, 53577, 53578, 53579, 53580, 53581, 53582, 53583, 53584, 53585, 53586, 53587, 53588, 53589, 53590, 53591, 53592, 53593, 53594, 53595, 53596, 53597, 53598, 53599, 53600, 53601, 53602, 53603, 53604, 53605, 53606, 53607, 53608, 53609, 53610, 53611, 53612, 53613, 53614, 53615, 53616, 53617, 53618, 53619, 53620, 53621, 53622, 53623, 53624, 53625, 53626, 53627, 53628, 53629, 53630, 53631, 53632, 53633, 53634, 53635, 53636, 53637, 53638, 53639, 53640, 53641, 53642, 53643, 53644, 53645, 53646, 53647, 53648, 53649, 53650, 53651, 53652, 53653, 53654, 53655, 53656, 53657, 53658, 53659, 53660, 53661, 53662, 53663, 53664, 53665, 53666, 53667, 53668, 53669, 53670, 53671, 53672, 53673, 53674, 53675, 53676, 53677, 53678, 53679, 53680, 53681, 53682, 53683, 53684, 53685, 53686, 53687, 53688, 53689, 53690, 53691, 53692, 53693, 53694, 53695, 53696, 53697, 53698, 53699, 53700, 53701, 53702, 53703, 53704, 53705, 53706, 53707, 53708, 53709, 53710, 53711, 53712, 53713, 53714, 53715, 53716, 53717, 53718, 53719, 53720, 53721, 53722, 53723, 53724, 53725, 53726, 53727, 53728, 53729, 53730, 53731, 53732, 53733, 53734, 53735, 53736, 53737, 53738, 53739, 53740, 53741, 53742, 53743, 53744, 53745, 53746, 53747, 53748, 53749, 53750, 53751, 53752, 53753, 53754, 53755, 53756, 53757, 53758, 53759, 53760, 53761, 53762, 53763, 53764, 53765, 53766, 53767, 53768, 53769, 53770, 53771, 53772, 53773, 53774, 53775, 53776, 53777, 53778, 53779, 53780, 53781, 53782, 53783, 53784, 53785, 53786, 53787, 53788, 53789, 53790, 53791, 53792, 53793, 53794, 53795, 53796, 53797, 53798, 53799, 53800, 53801, 53802, 53803, 53804, 53805, 53806, 53807, 53808, 53809, 53810, 53811, 53812, 53813, 53814, 53815, 53816, 53817, 53818, 53819, 53820, 53821, 53822, 53823, 53824, 53825, 53826, 53827, 53828, 53829, 53830, 53831, 53832, 53833, 53834, 53835, 53836, 53837, 53838, 53839, 53840, 53841, 53842, 53843, 53844, 53845, 53846, 53847, 53848, 53849, 53850, 53851, 53852, 53853, 53854, 53855, 53856, 53857, 53858, 53859, 53860, 53861, 53862, 53863, 53864, 53865, 53866, 53867, 53868, 53869, 53870, 53871, 53872, 53873, 53874, 53875, 53876, 53877, 53878, 53879, 53880, 53881, 53882, 53883, 53884, 53885, 53886, 53887, 53888, 53889, 53890, 53891, 53892, 53893, 53894, 53895, 53896, 53897, 53898, 53899, 53900, 53901, 53902, 53903, 53904, 53905, 53906, 53907, 53908, 53909, 53910, 53911, 53912, 53913, 53914, 53915, 53916, 53917, 53918, 53919, 53920, 53921, 53922, 53923, 53924, 53925, 53926, 53927, 53928, 53929, 53930, 53931, 53932, 53933, 53934, 53935, 53936, 53937, 53938, 53939, 53940, 53941, 53942, 53943, 53944, 53945, 53946, 53947, 53948, 53949, 53950, 53951, 53952, 53953, 53954, 53955, 53956, 53957, 53958, 53959, 53960, 53961, 53962, 53963, 53964, 53965, 53966, 53967, 53968, 53969, 53970, 53971, 53972, 53973, 53974, 53975, 53976, 53977, 53978, 53979, 53980, 53981, 53982, 53983, 53984, 53985, 53986, 53987, 53988, 53989, 53990, 53991, 53992, 53993, 53994, 53995, 53996, 53997, 53998, 53999, 54000, 54001, 54002, 54003, 54004, 54005, 54006, 54007, 54008, 54009, 54010, 54011, 54012, 54013, 54014, 54015, 54016, 54017, 54018, 54019, 54020, 54021, 54022, 54023, 54024, 54025, 54026, 54027, 54028, 54029, 54030, 54031, 54032, 54033, 54034, 54035, 54036, 54037, 54038, 54039, 54040, 54041, 54042, 54043, 54044, 54045, 54046, 54047, 54048, 54049, 54050, 54051, 54052, 54053, 54054, 54055, 54056, 54057, 54058, 54059, 54060, 54061, 54062, 54063, 54064, 54065, 54066, 54067, 54068, 54069, 54070, 54071, 54072, 54073, 54074, 54075, 54076, 54077, 54078, 54079, 54080, 54081, 54082, 54083, 54084, 54085, 54086, 54087, 54088, 54089, 54090, 54091, 54092, 54093, 54094, 54095, 54096, 54097, 54098, 54099, 54100, 54101, 54102, 54103, 54104, 54105, 54106, 54107, 54108, 54109, 54110, 54111, 54112, 54113, 54114, 54115, 54116, 54117, 54118, 54119, 54120, 54121, 54122, 54123, 54124, 54125, 54126, 54127, 54128, 54129, 54130, 54131, 54132, 54133, 54134, 54135, 54136, 54137, 54138, 54139, 54140, 54141, 54142, 54143, 54144, 54145, 54146, 54147, 54148, 54149, 54150, 54151, 54152, 54153, 54154, 54155, 54156, 54157, 54158, 54159, 54160, 54161, 54162, 54163, 54164, 54165, 54166, 54167, 54168, 54169, 54170, 54171, 54172, 54173, 54174, 54175, 54176, 54177, 54178, 54179, 54180, 54181, 54182, 54183, 54184, 54185, 54186, 54187, 54188, 54189, 54190, 54191, 54192, 54193, 54194, 54195, 54196, 54197, 54198, 54199, 54200, 54201, 54202, 54203, 54204, 54205, 54206, 54207, 54208, 54209, 54210, 54211, 54212, 54213, 54214, 54215, 54216, 54217, 54218, 54219, 54220, 54221, 54222, 54223, 54224, 54225, 54226, 54227, 54228, 54229, 54230, 54231, 54232, 54233, 54234, 54235, 54236, 54237, 54238, 54239, 54240, 54241, 54242, 54243, 54244, 54245, 54246, 54247, 54248, 54249, 54250, 54251, 54252, 54253, 54254, 54255, 54256, 54257, 54258, 54259, 54260, 54261, 54262, 54263, 54264, 54265, 54266, 54267, 54268, 54269, 54270, 54271, 54272, 54273, 54274, 54275, 54276, 54277, 54278, 54279, 54280, 54281, 54282, 54283, 54284, 54285, 54286, 54287, 54288, 54289, 54290, 54291, 54292, 54293, 54294, 54295, 54296, 54297, 54298, 54299, 54300, 54301, 54302, 54303, 54304, 54305, 54306, 54307, 54308, 54309, 54310, 54311, 54312, 54313, 54314, 54315, 54316, 54317, 54318, 54319, 54320, 54321, 54322, 54323, 54324, 54325, 54326, 54327, 54328, 54329, 54330, 54331, 54332, 54333, 54334, 54335, 54336, 54337, 54338, 54339, 54340, 54341, 54342, 54343, 54344, 54345, 54346, 54347, 54348, 54349, 54350, 54351, 54352, 54353, 54354, 54355, 54356, 54357, 54358, 54359, 54360, 54361, 54362, 54363, 54364, 54365, 54366, 54367, 54368, 54369, 54370, 54371, 54372, 54373, 54374, 54375, 54376, 54377, 54378, 54379, 54380, 54381, 54382, 54383, 54384, 54385, 54386, 54387, 54388, 54389, 54390, 54391, 54392, 54393, 54394, 54395, 54396, 54397, 54398, 54399, 54400, 54401, 54402, 54403, 54404, 54405, 54406, 54407, 54408, 54409, 54410, 54411, 54412, 54413, 54414, 54415, 54416, 54417, 54418, 54419, 54420, 54421, 54422, 54423, 54424, 54425, 54426, 54427, 54428, 54429, 54430, 54431, 54432, 54433, 54434, 54435, 54436, 54437, 54438, 54439, 54440, 54441, 54442, 54443, 54444, 54445, 54446, 54447, 54448, 54449, 54450, 54451, 54452, 54453, 54454, 54455, 54456, 54457, 54458, 54459, 54460, 54461, 54462, 54463, 54464, 54465, 54466, 54467, 54468, 54469, 54470, 54471, 54472, 54473, 54474, 54475, 54476, 54477, 54478, 54479, 54480, 54481, 54482, 54483, 54484, 54485, 54486, 54487, 54488, 54489, 54490, 54491, 54492, 54493, 54494, 54495, 54496, 54497, 54498, 54499, 54500, 54501, 54502, 54503, 54504, 54505, 54506, 54507, 54508, 54509, 54510, 54511, 54512, 54513, 54514, 54515, 54516, 54517, 54518, 54519, 54520, 54521, 54522, 54523, 54524, 54525, 54526, 54527, 54528, 54529, 54530, 54531, 54532, 54533, 54534, 54535, 54536, 54537, 54538, 54539, 54540, 54541, 54542, 54543, 54544, 54545, 54546, 54547, 54548, 54549, 54550, 54551, 54552, 54553, 54554, 54555, 54556, 54557, 54558, 54559, 54560, 54561, 54562, 54563, 54564, 54565, 54566, 54567, 54568, 54569, 54570, 54571, 54572, 54573, 54574, 54575, 54576, 54577, 54578, 54579, 54580, 54581, 54582, 54583, 54584, 54585, 54586, 54587, 54588, 54589, 54590, 54591, 54592, 54593, 54594, 54595, 54596, 54597, 54598, 54599, 54600, 54601, 54602, 54603, 54604, 54605, 54606, 54607, 54608, 54609, 54610, 54611, 54612, 54613, 54614, 54615, 54616, 54617, 54618, 54619, 54620, 54621, 54622, 54623, 54624, 54625, 54626, 54627, 54628, 54629, 54630, 54631, 54632, 54633, 54634, 54635, 54636, 54637, 54638, 54639, 54640, 54641, 54642, 54643, 54644, 54645, 54646, 54647, 54648, 54649, 54650, 54651, 54652, 54653, 54654, 54655, 54656, 54657, 54658, 54659, 54660, 54661, 54662, 54663, 54664, 54665, 54666, 54667, 54668, 54669, 54670, 54671, 54672, 54673, 54674, 54675, 54676, 54677, 54678, 54679, 54680, 54681, 54682, 54683, 54684, 54685, 54686, 54687, 54688, 54689, 54690, 54691, 54692, 54693, 54694, 54695, 54696, 54697, 54698, 54699, 54700, 54701, 54702, 54703, 54704, 54705, 54706, 54707, 54708, 54709, 54710, 54711, 54712, 54713, 54714, 54715, 54716, 54717, 54718, 54719, 54720, 54721, 54722, 54723, 54724, 54725, 54726, 54727, 54728, 54729, 54730, 54731, 54732, 54733, 54734, 54735, 54736, 54737, 54738, 54739, 54740, 54741, 54742, 54743, 54744, 54745, 54746, 54747, 54748, 54749, 54750, 54751, 54752, 54753, 54754, 54755, 54756, 54757, 54758, 54759, 54760, 54761, 54762, 54763, 54764, 54765, 54766, 54767, 54768, 54769, 54770, 54771, 54772, 54773, 54774, 54775, 54776, 54777, 54778, 54779, 54780, 54781, 54782, 54783, 54784, 54785, 54786, 54787, 54788, 54789, 54790, 54791, 54792, 54793, 54794, 54795, 54796, 54797, 54798, 54799, 54800, 54801, 54802, 54803, 54804, 54805, 54806, 54807, 54808, 54809, 54810, 54811, 54812, 54813, 54814, 54815, 54816, 54817, 54818, 54819, 54820, 54821, 54822, 54823, 54824, 54825, 54826, 54827, 54828, 54829, 54830, 54831, 54832, 54833, 54834, 54835, 54836, 54837, 54838, 54839, 54840, 54841, 54842, 54843, 54844, 54845, 54846, 54847, 54848, 54849, 54850, 54851, 54852, 54853, 54854, 54855, 54856, 54857, 54858, 54859, 54860, 54861, 54862, 54863, 54864, 54865, 54866, 54867, 54868, 54869, 54870, 54871, 54872, 54873, 54874, 54875, 54876, 54877, 54878, 54879, 54880, 54881, 54882, 54883, 54884, 54885, 54886, 54887, 54888, 54889, 54890, 54891, 54892, 54893, 54894, 54895, 54896, 54897, 54898, 54899, 54900, 54901, 54902, 54903, 54904, 54905, 54906, 54907, 54908, 54909, 54910, 54911, 54912, 54913, 54914, 54915, 54916, 54917, 54918, 54919, 54920, 54921, 54922, 54923, 54924, 54925, 54926, 54927, 54928, 54929, 54930, 54931, 54932, 54933, 54934, 54935, 54936, 54937, 54938, 54939, 54940, 54941, 54942, 54943, 54944, 54945, 54946, 54947, 54948, 54949, 54950, 54951, 54952, 54953, 54954, 54955, 54956, 54957, 54958, 54959, 54960, 54961, 54962, 54963, 54964, 54965, 54966, 54967, 54968, 54969, 54970, 54971, 54972, 54973, 54974, 54975, 54976, 54977, 54978, 54979, 54980, 54981, 54982, 54983, 54984, 54985, 54986, 54987, 54988, 54989, 54990, 54991, 54992, 54993, 54994, 54995, 54996, 54997, 54998, 54999, 55000, 55001, 55002, 55003, 55004, 55005, 55006, 55007, 55008, 55009, 55010, 55011, 55012, 55013, 55014, 55015, 55016, 55017, 55018, 55019, 55020, 55021, 55022, 55023, 55024, 55025, 55026, 55027, 55028, 55029, 55030, 55031, 55032, 55033, 55034, 55035, 55036, 55037, 55038, 55039, 55040, 55041, 55042, 55043, 55044, 55045, 55046, 55047, 55048, 55049, 55050, 55051, 55052, 55053, 55054, 55055, 55056, 55057, 55058, 55059, 55060, 55061, 55062, 55063, 55064, 55065, 55066, 55067, 55068, 55069, 55070, 55071, 55072, 55073, 55074, 55075, 55076, 55077, 55078, 55079, 55080, 55081, 55082, 55083, 55084, 55085, 55086, 55087, 55088, 55089, 55090, 55091, 55092, 55093, 55094, 55095, 55096, 55097, 55098, 55099, 55100, 55101, 55102, 55103, 55104, 55105, 55106, 55107, 55108, 55109, 55110, 55111, 55112, 55113, 55114, 55115, 55116, 55117, 55118, 55119, 55120, 55121, 55122, 55123, 55124, 55125, 55126, 55127, 55128, 55129, 55130, 55131, 55132, 55133, 55134, 55135, 55136, 55137, 55138, 55139, 55140, 55141, 55142, 55143, 55144, 55145, 55146, 55147, 55148, 55149, 55150, 55151, 55152, 55153, 55154, 55155, 55156, 55157, 55158, 55159, 55160, 55161, 55162, 55163, 55164, 55165, 55166, 55167, 55168, 55169, 55170, 55171, 55172, 55173, 55174, 55175, 55176, 55177, 55178, 55179, 55180, 55181, 55182, 55183, 55184, 55185, 55186, 55187, 55188, 55189, 55190, 55191, 55192, 55193, 55194, 55195, 55196, 55197, 55198, 55199, 55200, 55201, 55202, 55203, 55204, 55205, 55206, 55207, 55208, 55209, 55210, 55211, 55212, 55213, 55214, 55215, 55216, 55217, 55218, 55219, 55220, 55221, 55222, 55223, 55224, 55225, 55226, 55227, 55228, 55229, 55230, 55231, 55232, 55233, 55234, 55235, 55236, 55237, 55238, 55239, 55240, 55241, 55242, 55243, 55244, 55245, 55246, 55247, 55248, 55249, 55250, 55251, 55252, 55253, 55254, 55255, 55256, 55257, 55258, 55259, 55260, 55261, 55262, 55263, 55264, 55265, 55266, 55267, 55268, 55269, 55270, 55271, 55272, 55273, 55274, 55275, 55276, 55277, 55278, 55279, 55280, 55281, 55282, 55283, 55284, 55285, 55286, 55287, 55288, 55289, 55290, 55291, 55292, 55293, 55294, 55295, 55296, 55297, 55298, 55299, 55300, 55301, 55302, 55303, 55304, 55305, 55306, 55307, 55308, 55309, 55310, 55311, 55312, 55313, 55314, 55315, 55316, 55317, 55318, 55319, 55320, 55321, 55322, 55323, 55324, 55325, 55326, 55327, 55328, 55329, 55330, 55331, 55332, 55333, 55334, 55335, 55336, 55337, 55338, 55339, 55340, 55341, 55342, 55343, 55344, 55345, 55346, 55347, 55348, 55349, 55350, 55351, 55352, 55353, 55354, 55355, 55356, 55357, 55358, 55359, 55360, 55361, 55362, 55363, 55364, 55365, 55366, 55367, 55368, 55369, 55370, 55371, 55372, 55373, 55374, 55375, 55376, 55377, 55378, 55379, 55380, 55381, 55382, 55383, 55384, 55385, 55386, 55387, 55388, 55389, 55390, 55391, 55392, 55393, 55394, 55395, 55396, 55397, 55398, 55399, 55400, 55401, 55402, 55403, 55404, 55405, 55406, 55407, 55408, 55409, 55410, 55411, 55412, 55413, 55414, 55415, 55416, 55417, 55418, 55419, 55420, 55421, 55422, 55423, 55424, 55425, 55426, 55427, 55428, 55429, 55430, 55431, 55432, 55433, 55434, 55435, 55436, 55437, 55438, 55439, 55440, 55441, 55442, 55443, 55444, 55445, 55446, 55447, 55448, 55449, 55450, 55451, 55452, 55453, 55454, 55455, 55456, 55457, 55458, 55459, 55460, 55461, 55462, 55463, 55464, 55465, 55466, 55467, 55468, 55469, 55470, 55471, 55472, 55473, 55474, 55475, 55476, 55477, 55478, 55479, 55480, 55481, 55482, 55483, 55484, 55485, 55486, 55487, 55488, 55489, 55490, 55491, 55492, 55493, 55494, 55495, 55496, 55497, 55498, 55499, 55500, 55501, 55502, 55503, 55504, 55505, 55506, 55507, 55508, 55509, 55510, 55511, 55512, 55513, 55514, 55515, 55516, 55517, 55518, 55519, 55520, 55521, 55522, 55523, 55524, 55525, 55526, 55527, 55528, 55529, 55530, 55531, 55532, 55533, 55534, 55535, 55536, 55537, 55538, 55539, 55540, 55541, 55542, 55543, 55544, 55545, 55546, 55547, 55548, 55549, 55550, 55551, 55552, 55553, 55554, 55555, 55556, 55557, 55558, 55559, 55560, 55561, 55562, 55563, 55564, 55565, 55566, 55567, 55568, 55569, 55570, 55571, 55572, 55573, 55574, 55575, 55576, 55577, 55578, 55579, 55580, 55581, 55582, 55583, 55584, 55585, 55586, 55587, 55588, 55589, 55590, 55591, 55592, 55593, 55594, 55595, 55596, 55597, 55598, 55599, 55600, 55601, 55602, 55603, 55604, 55605, 55606, 55607, 55608, 55609, 55610, 55611, 55612, 55613, 55614, 55615, 55616, 55617, 55618, 55619, 55620, 55621, 55622, 55623, 55624, 55625, 55626, 55627, 55628, 55629, 55630, 55631, 55632, 55633, 55634, 55635, 55636, 55637, 55638, 55639, 55640, 55641, 55642, 55643, 55644, 55645, 55646, 55647, 55648, 55649, 55650, 55651, 55652, 55653, 55654, 55655, 55656, 55657, 55658, 55659, 55660, 55661, 55662, 55663, 55664, 55665, 55666, 55667, 55668, 55669, 55670, 55671, 55672, 55673, 55674, 55675, 55676, 55677, 55678, 55679, 55680, 55681, 55682, 55683, 55684, 55685, 55686, 55687, 55688, 55689, 55690, 55691, 55692, 55693, 55694, 55695, 55696, 55697, 55698, 55699, 55700, 55701, 55702, 55703, 55704, 55705, 55706, 55707, 55708, 55709, 55710, 55711, 55712, 55713, 55714, 55715, 55716, 55717, 55718, 55719, 55720, 55721, 55722, 55723, 55724, 55725, 55726, 55727, 55728, 55729, 55730, 55731, 55732, 55733, 55734, 55735, 55736, 55737, 55738, 55739, 55740, 55741, 55742, 55743, 55744, 55745, 55746, 55747, 55748, 55749, 55750, 55751, 55752, 55753, 55754, 55755, 55756, 55757, 55758, 55759, 55760, 55761, 55762, 55763, 55764, 55765, 55766, 55767, 55768, 55769, 55770, 55771, 55772, 55773, 55774, 55775, 55776, 55777, 55778, 55779, 55780, 55781, 55782, 55783, 55784, 55785, 55786, 55787, 55788, 55789, 55790, 55791, 55792, 55793, 55794, 55795, 55796, 55797, 55798, 55799, 55800, 55801, 55802, 55803, 55804, 55805, 55806, 55807, 55808, 55809, 55810, 55811, 55812, 55813, 55814, 55815, 55816, 55817, 55818, 55819, 55820, 55821, 55822, 55823, 55824, 55825, 55826, 55827, 55828, 55829, 55830, 55831, 55832, 55833, 55834, 55835, 55836, 55837, 55838, 55839, 55840, 55841, 55842, 55843, 55844, 55845, 55846, 55847, 55848, 55849, 55850, 55851, 55852, 55853, 55854, 55855, 55856, 55857, 55858, 55859, 55860, 55861, 55862, 55863, 55864, 55865, 55866, 55867, 55868, 55869, 55870, 55871, 55872, 55873, 55874, 55875, 55876, 55877, 55878, 55879, 55880, 55881, 55882, 55883, 55884, 55885, 55886, 55887, 55888, 55889, 55890, 55891, 55892, 55893, 55894, 55895, 55896, 55897, 55898, 55899, 55900, 55901, 55902, 55903, 55904, 55905, 55906, 55907, 55908, 55909, 55910, 55911, 55912, 55913, 55914, 55915, 55916, 55917, 55918, 55919, 55920, 55921, 55922, 55923, 55924, 55925, 55926, 55927, 55928, 55929, 55930, 55931, 55932, 55933, 55934, 55935, 55936, 55937, 55938, 55939, 55940, 55941, 55942, 55943, 55944, 55945, 55946, 55947, 55948, 55949, 55950, 55951, 55952, 55953, 55954, 55955, 55956, 55957, 55958, 55959, 55960, 55961, 55962, 55963, 55964, 55965, 55966, 55967, 55968, 55969, 55970, 55971, 55972, 55973, 55974, 55975, 55976, 55977, 55978, 55979, 55980, 55981, 55982, 55983, 55984, 55985, 55986, 55987, 55988, 55989, 55990, 55991, 55992, 55993, 55994, 55995, 55996, 55997, 55998, 55999, 56000, 56001, 56002, 56003, 56004, 56005, 56006, 56007, 56008, 56009, 56010, 56011, 56012, 56013, 56014, 56015, 56016, 56017, 56018, 56019, 56020, 56021, 56022, 56023, 56024, 56025, 56026, 56027, 56028, 56029, 56030, 56031, 56032, 56033, 56034, 56035, 56036, 56037, 56038, 56039, 56040, 56041, 56042, 56043, 56044, 56045, 56046, 56047, 56048, 56049, 56050, 56051, 56052, 56053, 56054, 56055, 56056, 56057, 56058, 56059, 56060, 56061, 56062, 56063, 56064, 56065, 56066, 56067, 56068, 56069, 56070, 56071, 56072, 56073, 56074, 56075, 56076, 56077, 56078, 56079, 56080, 56081, 56082, 56083, 56084, 56085, 56086, 56087, 56088, 56089, 56090, 56091, 56092, 56093, 56094, 56095, 56096, 56097, 56098, 56099, 56100, 56101, 56102, 56103, 56104, 56105, 56106, 56107, 56108, 56109, 56110, 56111, 56112, 56113, 56114, 56115, 56116, 56117, 56118, 56119, 56120, 56121, 56122, 56123, 56124, 56125, 56126, 56127, 56128, 56129, 56130, 56131, 56132, 56133, 56134, 56135, 56136, 56137, 56138, 56139, 56140, 56141, 56142, 56143, 56144, 56145, 56146, 56147, 56148, 56149, 56150, 56151, 56152, 56153, 56154, 56155, 56156, 56157, 56158, 56159, 56160, 56161, 56162, 56163, 56164, 56165, 56166, 56167, 56168, 56169, 56170, 56171, 56172, 56173, 56174, 56175, 56176, 56177, 56178, 56179, 56180, 56181, 56182, 56183, 56184, 56185, 56186, 56187, 56188, 56189, 56190, 56191, 56192, 56193, 56194, 56195, 56196, 56197, 56198, 56199, 56200, 56201, 56202, 56203, 56204, 56205, 56206, 56207, 56208, 56209, 56210, 56211, 56212, 56213, 56214, 56215, 56216, 56217, 56218, 56219, 56220, 56221, 56222, 56223, 56224, 56225, 56226, 56227, 56228, 56229, 56230, 56231, 56232, 56233, 56234, 56235, 56236, 56237, 56238, 56239, 56240, 56241, 56242, 56243, 56244, 56245, 56246, 56247, 56248, 56249, 56250, 56251, 56252, 56253, 56254, 56255, 56256, 56257, 56258, 56259, 56260, 56261, 56262, 56263, 56264, 56265, 56266, 56267, 56268, 56269, 56270, 56271, 56272, 56273, 56274, 56275, 56276, 56277, 56278, 56279, 56280, 56281, 56282, 56283, 56284, 56285, 56286, 56287, 56288, 56289, 56290, 56291, 56292, 56293, 56294, 56295, 56296, 56297, 56298, 56299, 56300, 56301, 56302, 56303, 56304, 56305, 56306, 56307, 56308, 56309, 56310, 56311, 56312, 56313, 56314, 56315, 56316, 56317, 56318, 56319, 56320, 56321, 56322, 56323, 56324, 56325, 56326, 56327, 56328, 56329, 56330, 56331, 56332, 56333, 56334, 56335, 56336, 56337, 56338, 56339, 56340, 56341, 56342, 56343, 56344, 56345, 56346, 56347, 56348, 56349, 56350, 56351, 56352, 56353, 56354, 56355, 56356, 56357, 56358, 56359, 56360, 56361, 56362, 56363, 56364, 56365, 56366, 56367, 56368, 56369, 56370, 56371, 56372, 56373, 56374, 56375, 56376, 56377, 56378, 56379, 56380, 56381, 56382, 56383, 56384, 56385, 56386, 56387, 56388, 56389, 56390, 56391, 56392, 56393, 56394, 56395, 56396, 56397, 56398, 56399, 56400, 56401, 56402, 56403, 56404, 56405, 56406, 56407, 56408, 56409, 56410, 56411, 56412, 56413, 56414, 56415, 56416, 56417, 56418, 56419, 56420, 56421, 56422, 56423, 56424, 56425, 56426, 56427, 56428, 56429, 56430, 56431, 56432, 56433, 56434, 56435, 56436, 56437, 56438, 56439, 56440, 56441, 56442, 56443, 56444, 56445, 56446, 56447, 56448, 56449, 56450, 56451, 56452, 56453, 56454, 56455, 56456, 56457, 56458, 56459, 56460, 56461, 56462, 56463, 56464, 56465, 56466, 56467, 56468, 56469, 56470, 56471, 56472, 56473, 56474, 56475, 56476, 56477, 56478, 56479, 56480, 56481, 56482, 56483, 56484, 56485, 56486, 56487, 56488, 56489, 56490, 56491, 56492, 56493, 56494, 56495, 56496, 56497, 56498, 56499, 56500, 56501, 56502, 56503, 56504, 56505, 56506, 56507, 56508, 56509, 56510, 56511, 56512, 56513, 56514, 56515, 56516, 56517, 56518, 56519, 56520, 56521, 56522, 56523, 56524, 56525, 56526, 56527, 56528, 56529, 56530, 56531, 56532, 56533, 56534, 56535, 56536, 56537, 56538, 56539, 56540, 56541, 56542, 56543, 56544, 56545, 56546, 56547, 56548, 56549, 56550, 56551, 56552, 56553, 56554, 56555, 56556, 56557, 56558, 56559, 56560, 56561, 56562, 56563, 56564, 56565, 56566, 56567, 56568, 56569, 56570, 56571, 56572, 56573, 56574, 56575, 56576, 56577, 56578, 56579, 56580, 56581, 56582, 56583, 56584, 56585, 56586, 56587, 56588, 56589, 56590, 56591, 56592, 56593, 56594, 56595, 56596, 56597, 56598, 56599, 56600, 56601, 56602, 56603, 56604, 56605, 56606, 56607, 56608, 56609, 56610, 56611, 56612, 56613, 56614, 56615, 56616, 56617, 56618, 56619, 56620, 56621, 56622, 56623, 56624, 56625, 56626, 56627, 56628, 56629, 56630, 56631, 56632, 56633, 56634, 56635, 56636, 56637, 56638, 56639, 56640, 56641, 56642, 56643, 56644, 56645, 56646, 56647, 56648, 56649, 56650, 56651, 56652, 56653, 56654, 56655, 56656, 56657, 56658, 56659, 56660, 56661, 56662, 56663, 56664, 56665, 56666, 56667, 56668, 56669, 56670, 56671, 56672, 56673, 56674, 56675, 56676, 56677, 56678, 56679, 56680, 56681, 56682, 56683, 56684, 56685, 56686, 56687, 56688, 56689, 56690, 56691, 56692, 56693, 56694, 56695, 56696, 56697, 56698, 56699, 56700, 56701, 56702, 56703, 56704, 56705, 56706, 56707, 56708, 56709, 56710, 56711, 56712, 56713, 56714, 56715, 56716, 56717, 56718, 56719, 56720, 56721, 56722, 56723, 56724, 56725, 56726, 56727, 56728, 56729, 56730, 56731, 56732, 56733, 56734, 56735, 56736, 56737, 56738, 56739, 56740, 56741, 56742, 56743, 56744, 56745, 56746, 56747, 56748, 56749, 56750, 56751, 56752, 56753, 56754, 56755, 56756, 56757, 56758, 56759, 56760, 56761, 56762, 56763, 56764, 56765, 56766, 56767, 56768, 56769, 56770, 56771, 56772, 56773, 56774, 56775, 56776, 56777, 56778, 56779, 56780, 56781, 56782, 56783, 56784, 56785, 56786, 56787, 56788, 56789, 56790, 56791, 56792, 56793, 56794, 56795, 56796, 56797, 56798, 56799, 56800, 56801, 56802, 56803, 56804, 56805, 56806, 56807, 56808, 56809, 56810, 56811, 56812, 56813, 56814, 56815, 56816, 56817, 56818, 56819, 56820, 56821, 56822, 56823, 56824, 56825, 56826, 56827, 56828, 56829, 56830, 56831, 56832, 56833, 56834, 56835, 56836, 56837, 56838, 56839, 56840, 56841, 56842, 56843, 56844, 56845, 56846, 56847, 56848, 56849, 56850, 56851, 56852, 56853, 56854, 56855, 56856, 56857, 56858, 56859, 56860, 56861, 56862, 56863, 56864, 56865, 56866, 56867, 56868, 56869, 56870, 56871, 56872, 56873, 56874, 56875, 56876, 56877, 56878, 56879, 56880, 56881, 56882, 56883, 56884, 56885, 56886, 56887, 56888, 56889, 56890, 56891, 56892, 56893, 56894, 56895, 56896, 56897, 56898, 56899, 56900, 56901, 56902, 56903, 56904, 56905, 56906, 56907, 56908, 56909, 56910, 56911, 56912, 56913, 56914, 56915, 56916, 56917, 56918, 56919, 56920, 56921, 56922, 56923, 56924, 56925, 56926, 56927, 56928, 56929, 56930, 56931, 56932, 56933, 56934, 56935, 56936, 56937, 56938, 56939, 56940, 56941, 56942, 56943, 56944, 56945, 56946, 56947, 56948, 56949, 56950, 56951, 56952, 56953, 56954, 56955, 56956, 56957, 56958, 56959, 56960, 56961, 56962, 56963, 56964, 56965, 56966, 56967, 56968, 56969, 56970, 56971, 56972, 56973, 56974, 56975, 56976, 56977, 56978, 56979, 56980, 56981, 56982, 56983, 56984, 56985, 56986, 56987, 56988, 56989, 56990, 56991, 56992, 56993, 56994, 56995, 56996, 56997, 56998, 56999, 57000, 57001, 57002, 57003, 57004, 57005, 57006, 57007, 57008, 57009, 57010, 57011, 57012, 57013, 57014, 57015, 57016, 57017, 57018, 57019, 57020, 57021, 57022, 57023, 57024, 57025, 57026, 57027, 57028, 57029, 57030, 57031, 57032, 57033, 57034, 57035, 57036, 57037, 57038, 57039, 57040, 57041, 57042, 57043, 57044, 57045, 57046, 57047, 57048, 57049, 57050, 57051, 57052, 57053, 57054, 57055, 57056, 57057, 57058, 57059, 57060, 57061, 57062, 57063, 57064, 57065, 57066, 57067, 57068, 57069, 57070, 57071, 57072, 57073, 57074, 57075, 57076, 57077, 57078, 57079, 57080, 57081, 57082, 57083, 57084, 57085, 57086, 57087, 57088, 57089, 57090, 57091, 57092, 57093, 57094, 57095, 57096, 57097, 57098, 57099, 57100, 57101, 57102, 57103, 57104, 57105, 57106, 57107, 57108, 57109, 57110, 57111, 57112, 57113, 57114, 57115, 57116, 57117, 57118, 57119, 57120, 57121, 57122, 57123, 57124, 57125, 57126, 57127, 57128, 57129, 57130, 57131, 57132, 57133, 57134, 57135, 57136, 57137, 57138, 57139, 57140, 57141, 57142, 57143, 57144, 57145, 57146, 57147, 57148, 57149, 57150, 57151, 57152, 57153, 57154, 57155, 57156, 57157, 57158, 57159, 57160, 57161, 57162, 57163, 57164, 57165, 57166, 57167, 57168, 57169, 57170, 57171, 57172, 57173, 57174, 57175, 57176, 57177, 57178, 57179, 57180, 57181, 57182, 57183, 57184, 57185, 57186, 57187, 57188, 57189, 57190, 57191, 57192, 57193, 57194, 57195, 57196, 57197, 57198, 57199, 57200, 57201, 57202, 57203, 57204, 57205, 57206, 57207, 57208, 57209, 57210, 57211, 57212, 57213, 57214, 57215, 57216, 57217, 57218, 57219, 57220, 57221, 57222, 57223, 57224, 57225, 57226, 57227, 57228, 57229, 57230, 57231, 57232, 57233, 57234, 57235, 57236, 57237, 57238, 57239, 57240, 57241, 57242, 57243, 57244, 57245, 57246, 57247, 57248, 57249, 57250, 57251, 57252, 57253, 57254, 57255, 57256, 57257, 57258, 57259, 57260, 57261, 57262, 57263, 57264, 57265, 57266, 57267, 57268, 57269, 57270, 57271, 57272, 57273, 57274, 57275, 57276, 57277, 57278, 57279, 57280, 57281, 57282, 57283, 57284, 57285, 57286, 57287, 57288, 57289, 57290, 57291, 57292, 57293, 57294, 57295, 57296, 57297, 57298, 57299, 57300, 57301, 57302, 57303, 57304, 57305, 57306, 57307, 57308, 57309, 57310, 57311, 57312, 57313, 57314, 57315, 57316, 57317, 57318, 57319, 57320, 57321, 57322, 57323, 57324, 57325, 57326, 57327, 57328, 57329, 57330, 57331, 57332, 57333, 57334, 57335, 57336, 57337, 57338, 57339, 57340, 57341, 57342, 57343, 57344, 57345, 57346, 57347, 57348, 57349, 57350, 57351, 57352, 57353, 57354, 57355, 57356, 57357, 57358, 57359, 57360, 57361, 57362, 57363, 57364, 57365, 57366, 57367, 57368, 57369, 57370, 57371, 57372, 57373, 57374, 57375, 57376, 57377, 57378, 57379, 57380, 57381, 57382, 57383, 57384, 57385, 57386, 57387, 57388, 57389, 57390, 57391, 57392, 57393, 57394, 57395, 57396, 57397, 57398, 57399, 57400, 57401, 57402, 57403, 57404, 57405, 57406, 57407, 57408, 57409, 57410, 57411, 57412, 57413, 57414, 57415, 57416, 57417, 57418, 57419, 57420, 57421, 57422, 57423, 57424, 57425, 57426, 57427, 57428, 57429, 57430, 57431, 57432, 57433, 57434, 57435, 57436, 57437, 57438, 57439, 57440, 57441, 57442, 57443, 57444, 57445, 57446, 57447, 57448, 57449, 57450, 57451, 57452, 57453, 57454, 57455, 57456, 57457, 57458, 57459, 57460, 57461, 57462, 57463, 57464, 57465, 57466, 57467, 57468, 57469, 57470, 57471, 57472, 57473, 57474, 57475, 57476, 57477, 57478, 57479, 57480, 57481, 57482, 57483, 57484, 57485, 57486, 57487, 57488, 57489, 57490, 57491, 57492, 57493, 57494, 57495, 57496, 57497, 57498, 57499, 57500, 57501, 57502, 57503, 57504, 57505, 57506, 57507, 57508, 57509, 57510, 57511, 57512, 57513, 57514, 57515, 57516, 57517, 57518, 57519, 57520, 57521, 57522, 57523, 57524, 57525, 57526, 57527, 57528, 57529, 57530, 57531, 57532, 57533, 57534, 57535, 57536, 57537, 57538, 57539, 57540, 57541, 57542, 57543, 57544, 57545, 57546, 57547, 57548, 57549, 57550, 57551, 57552, 57553, 57554, 57555, 57556, 57557, 57558, 57559, 57560, 57561, 57562, 57563, 57564, 57565, 57566, 57567, 57568, 57569, 57570, 57571, 57572, 57573, 57574, 57575, 57576, 57577, 57578, 57579, 57580, 57581, 57582, 57583, 57584, 57585, 57586, 57587, 57588, 57589, 57590, 57591, 57592, 57593, 57594, 57595, 57596, 57597, 57598, 57599, 57600, 57601, 57602, 57603, 57604, 57605, 57606, 57607, 57608, 57609, 57610, 57611, 57612, 57613, 57614, 57615, 57616, 57617, 57618, 57619, 57620, 57621, 57622, 57623, 57624, 57625, 57626, 57627, 57628, 57629, 57630, 57631, 57632, 57633, 57634, 57635, 57636, 57637, 57638, 57639, 57640, 57641, 57642, 57643, 57644, 57645, 57646, 57647, 57648, 57649, 57650, 57651, 57652, 57653, 57654, 57655, 57656, 57657, 57658, 57659, 57660, 57661, 57662, 57663, 57664, 57665, 57666, 57667, 57668, 57669, 57670, 57671, 57672, 57673, 57674, 57675, 57676, 57677, 57678, 57679, 57680, 57681, 57682, 57683, 57684, 57685, 57686, 57687, 57688, 57689, 57690, 57691, 57692, 57693, 57694, 57695, 57696, 57697, 57698, 57699, 57700, 57701, 57702, 57703, 57704, 57705, 57706, 57707, 57708, 57709, 57710, 57711, 57712, 57713, 57714, 57715, 57716, 57717, 57718, 57719, 57720, 57721, 57722, 57723, 57724, 57725, 57726, 57727, 57728, 57729, 57730, 57731, 57732, 57733, 57734, 57735, 57736, 57737, 57738, 57739, 57740, 57741, 57742, 57743, 57744, 57745, 57746, 57747, 57748, 57749, 57750, 57751, 57752, 57753, 57754, 57755, 57756, 57757, 57758, 57759, 57760, 57761, 57762, 57763, 57764, 57765, 57766, 57767, 57768, 57769, 57770, 57771, 57772, 57773, 57774, 57775, 57776, 57777, 57778, 57779, 57780, 57781, 57782, 57783, 57784, 57785, 57786, 57787, 57788, 57789, 57790, 57791, 57792, 57793, 57794, 57795, 57796, 57797, 57798, 57799, 57800, 57801, 57802, 57803, 57804, 57805, 57806, 57807, 57808, 57809, 57810, 57811, 57812, 57813, 57814, 57815, 57816, 57817, 57818, 57819, 57820, 57821, 57822, 57823, 57824, 57825, 57826, 57827, 57828, 57829, 57830, 57831, 57832, 57833, 57834, 57835, 57836, 57837, 57838, 57839, 57840, 57841, 57842, 57843, 57844, 57845, 57846, 57847, 57848, 57849, 57850, 57851, 57852, 57853, 57854, 57855, 57856, 57857, 57858, 57859, 57860, 57861, 57862, 57863, 57864, 57865, 57866, 57867, 57868, 57869, 57870, 57871, 57872, 57873, 57874, 57875, 57876, 57877, 57878, 57879, 57880, 57881, 57882, 57883, 57884, 57885, 57886, 57887, 57888, 57889, 57890, 57891, 57892, 57893, 57894, 57895, 57896, 57897, 57898, 57899, 57900, 57901, 57902, 57903, 57904, 57905, 57906, 57907, 57908, 57909, 57910, 57911, 57912, 57913, 57914, 57915, 57916, 57917, 57918, 57919, 57920, 57921, 57922, 57923, 57924, 57925, 57926, 57927, 57928, 57929, 57930, 57931, 57932, 57933, 57934, 57935, 57936, 57937, 57938, 57939, 57940, 57941, 57942, 57943, 57944, 57945, 57946, 57947, 57948, 57949, 57950, 57951, 57952, 57953, 57954, 57955, 57956, 57957, 57958, 57959, 57960, 57961, 57962, 57963, 57964, 57965, 57966, 57967, 57968, 57969, 57970, 57971, 57972, 57973, 57974, 57975, 57976, 57977, 57978, 57979, 57980, 57981, 57982, 57983, 57984, 57985, 57986, 57987, 57988, 57989, 57990, 57991, 57992, 57993, 57994, 57995, 57996, 57997, 57998, 57999, 58000, 58001, 58002, 58003, 58004, 58005, 58006, 58007, 58008, 58009, 58010, 58011, 58012, 58013, 58014, 58015, 58016, 58017, 58018, 58019, 58020, 58021, 58022, 58023, 58024, 58025, 58026, 58027, 58028, 58029, 58030, 58031, 58032, 58033, 58034, 58035, 58036, 58037, 58038, 58039, 58040, 58041, 58042, 58043, 58044, 58045, 58046, 58047, 58048, 58049, 58050, 58051, 58052, 58053, 58054, 58055, 58056, 58057, 58058, 58059, 58060, 58061, 58062, 58063, 58064, 58065, 58066, 58067, 58068, 58069, 58070, 58071, 58072, 58073, 58074, 58075, 58076, 58077, 58078, 58079, 58080, 58081, 58082, 58083, 58084, 58085, 58086, 58087, 58088, 58089, 58090, 58091, 58092, 58093, 58094, 58095, 58096, 58097, 58098, 58099, 58100, 58101, 58102, 58103, 58104, 58105, 58106, 58107, 58108, 58109, 58110, 58111, 58112, 58113, 58114, 58115, 58116, 58117, 58118, 58119, 58120, 58121, 58122, 58123, 58124, 58125, 58126, 58127, 58128, 58129, 58130, 58131, 58132, 58133, 58134, 58135, 58136, 58137, 58138, 58139, 58140, 58141, 58142, 58143, 58144, 58145, 58146, 58147, 58148, 58149, 58150, 58151, 58152, 58153, 58154, 58155, 58156, 58157, 58158, 58159, 58160, 58161, 58162, 58163, 58164, 58165, 58166, 58167, 58168, 58169, 58170, 58171, 58172, 58173, 58174, 58175, 58176, 58177, 58178, 58179, 58180, 58181, 58182, 58183, 58184, 58185, 58186, 58187, 58188, 58189, 58190, 58191, 58192, 58193, 58194, 58195, 58196, 58197, 58198, 58199, 58200, 58201, 58202, 58203, 58204, 58205, 58206, 58207, 58208, 58209, 58210, 58211, 58212, 58213, 58214, 58215, 58216, 58217, 58218, 58219, 58220, 58221, 58222, 58223, 58224, 58225, 58226, 58227, 58228, 58229, 58230, 58231, 58232, 58233, 58234, 58235, 58236, 58237, 58238, 58239, 58240, 58241, 58242, 58243, 58244, 58245, 58246, 58247, 58248, 58249, 58250, 58251, 58252, 58253, 58254, 58255, 58256, 58257, 58258, 58259, 58260, 58261, 58262, 58263, 58264, 58265, 58266, 58267, 58268, 58269, 58270, 58271, 58272, 58273, 58274, 58275, 58276, 58277, 58278, 58279, 58280, 58281, 58282, 58283, 58284, 58285, 58286, 58287, 58288, 58289, 58290, 58291, 58292, 58293, 58294, 58295, 58296, 58297, 58298, 58299, 58300, 58301, 58302, 58303, 58304, 58305, 58306, 58307, 58308, 58309, 58310, 58311, 58312, 58313, 58314, 58315, 58316, 58317, 58318, 58319, 58320, 58321, 58322, 58323, 58324, 58325, 58326, 58327, 58328, 58329, 58330, 58331, 58332, 58333, 58334, 58335, 58336, 58337, 58338, 58339, 58340, 58341, 58342, 58343, 58344, 58345, 58346, 58347, 58348, 58349, 58350, 58351, 58352, 58353, 58354, 58355, 58356, 58357, 58358, 58359, 58360, 58361, 58362, 58363, 58364, 58365, 58366, 58367, 58368, 58369, 58370, 58371, 58372, 58373, 58374, 58375, 58376, 58377, 58378, 58379, 58380, 58381, 58382, 58383, 58384, 58385, 58386, 58387, 58388, 58389, 58390, 58391, 58392, 58393, 58394, 58395, 58396, 58397, 58398, 58399, 58400, 58401, 58402, 58403, 58404, 58405, 58406, 58407, 58408, 58409, 58410, 58411, 58412, 58413, 58414, 58415, 58416, 58417, 58418, 58419, 58420, 58421, 58422, 58423, 58424, 58425, 58426, 58427, 58428, 58429, 58430, 58431, 58432, 58433, 58434, 58435, 58436, 58437, 58438, 58439, 58440, 58441, 58442, 58443, 58444, 58445, 58446, 58447, 58448, 58449, 58450, 58451, 58452, 58453, 58454, 58455, 58456, 58457, 58458, 58459, 58460, 58461, 58462, 58463, 58464, 58465, 58466, 58467, 58468, 58469, 58470, 58471, 58472, 58473, 58474, 58475, 58476, 58477, 58478, 58479, 58480, 58481, 58482, 58483, 58484, 58485, 58486, 58487, 58488, 58489, 58490, 58491, 58492, 58493, 58494, 58495, 58496, 58497, 58498, 58499, 58500, 58501, 58502, 58503, 58504, 58505, 58506, 58507, 58508, 58509, 58510, 58511, 58512, 58513, 58514, 58515, 58516, 58517, 58518, 58519, 58520, 58521, 58522, 58523, 58524, 58525, 58526, 58527, 58528, 58529, 58530, 58531, 58532, 58533, 58534, 58535, 58536, 58537, 58538, 58539, 58540, 58541, 58542, 58543, 58544, 58545, 58546, 58547, 58548, 58549, 58550, 58551, 58552, 58553, 58554, 58555, 58556, 58557, 58558, 58559, 58560, 58561, 58562, 58563, 58564, 58565, 58566, 58567, 58568, 58569, 58570, 58571, 58572, 58573, 58574, 58575, 58576, 58577, 58578, 58579, 58580, 58581, 58582, 58583, 58584, 58585, 58586, 58587, 58588, 58589, 58590, 58591, 58592, 58593, 58594, 58595, 58596, 58597, 58598, 58599, 58600, 58601, 58602, 58603, 58604, 58605, 58606, 58607, 58608, 58609, 58610, 58611, 58612, 58613, 58614, 58615, 58616, 58617, 58618, 58619, 58620, 58621, 58622, 58623, 58624, 58625, 58626, 58627, 58628, 58629, 58630, 58631, 58632, 58633, 58634, 58635, 58636, 58637, 58638, 58639, 58640, 58641, 58642, 58643, 58644, 58645, 58646, 58647, 58648, 58649, 58650, 58651, 58652, 58653, 58654, 58655, 58656, 58657, 58658, 58659, 58660, 58661, 58662, 58663, 58664, 58665, 58666, 58667, 58668, 58669, 58670, 58671, 58672, 58673, 58674, 58675, 58676, 58677, 58678, 58679, 58680, 58681, 58682, 58683, 58684, 58685, 58686, 58687, 58688, 58689, 58690, 58691, 58692, 58693, 58694, 58695, 58696, 58697, 58698, 58699, 58700, 58701, 58702, 58703, 58704, 58705, 58706, 58707, 58708, 58709, 58710, 58711, 58712, 58713, 58714, 58715, 58716, 58717, 58718, 58719, 58720, 58721, 58722, 58723, 58724, 58725, 58726, 58727, 58728, 58729, 58730, 58731, 58732, 58733, 58734, 58735, 58736, 58737, 58738, 58739, 58740, 58741, 58742, 58743, 58744, 58745, 58746, 58747, 58748, 58749, 58750, 58751, 58752, 58753, 58754, 58755, 58756, 58757, 58758, 58759, 58760, 58761, 58762, 58763, 58764, 58765, 58766, 58767, 58768, 58769, 58770, 58771, 58772, 58773, 58774, 58775, 58776, 58777, 58778, 58779, 58780, 58781, 58782, 58783, 58784, 58785, 58786, 58787, 58788, 58789, 58790, 58791, 58792, 58793, 58794, 58795, 58796, 58797, 58798, 58799, 58800, 58801, 58802, 58803, 58804, 58805, 58806, 58807, 58808, 58809, 58810, 58811, 58812, 58813, 58814, 58815, 58816, 58817, 58818, 58819, 58820, 58821, 58822, 58823, 58824, 58825, 58826, 58827, 58828, 58829, 58830, 58831, 58832, 58833, 58834, 58835, 58836, 58837, 58838, 58839, 58840, 58841, 58842, 58843, 58844, 58845, 58846, 58847, 58848, 58849, 58850, 58851, 58852, 58853, 58854, 58855, 58856, 58857, 58858, 58859, 58860, 58861, 58862, 58863, 58864, 58865, 58866, 58867, 58868, 58869, 58870, 58871, 58872, 58873, 58874, 58875, 58876, 58877, 58878, 58879, 58880, 58881, 58882, 58883, 58884, 58885, 58886, 58887, 58888, 58889, 58890, 58891, 58892, 58893, 58894, 58895, 58896, 58897, 58898, 58899, 58900, 58901, 58902, 58903, 58904, 58905, 58906, 58907, 58908, 58909, 58910, 58911, 58912, 58913, 58914, 58915, 58916, 58917, 58918, 58919, 58920, 58921, 58922, 58923, 58924, 58925, 58926, 58927, 58928, 58929, 58930, 58931, 58932, 58933, 58934, 58935, 58936, 58937, 58938, 58939, 58940, 58941, 58942, 58943, 58944, 58945, 58946, 58947, 58948, 58949, 58950, 58951, 58952, 58953, 58954, 58955, 58956, 58957, 58958, 58959, 58960, 58961, 58962, 58963, 58964, 58965, 58966, 58967, 58968, 58969, 58970, 58971, 58972, 58973, 58974, 58975, 58976, 58977, 58978, 58979, 58980, 58981, 58982, 58983, 58984, 58985, 58986, 58987, 58988, 58989, 58990, 58991, 58992, 58993, 58994, 58995, 58996, 58997, 58998, 58999, 59000, 59001, 59002, 59003, 59004, 59005, 59006, 59007, 59008, 59009, 59010, 59011, 59012, 59013, 59014, 59015, 59016, 59017, 59018, 59019, 59020, 59021, 59022, 59023, 59024, 59025, 59026, 59027, 59028, 59029, 59030, 59031, 59032, 59033, 59034, 59035, 59036, 59037, 59038, 59039, 59040, 59041, 59042, 59043, 59044, 59045, 59046, 59047, 59048, 59049, 59050, 59051, 59052, 59053, 59054, 59055, 59056, 59057, 59058, 59059, 59060, 59061, 59062, 59063, 59064, 59065, 59066, 59067, 59068, 59069, 59070, 59071, 59072, 59073, 59074, 59075, 59076, 59077, 59078, 59079, 59080, 59081, 59082, 59083, 59084, 59085, 59086, 59087, 59088, 59089, 59090, 59091, 59092, 59093, 59094, 59095, 59096, 59097, 59098, 59099, 59100, 59101, 59102, 59103, 59104, 59105, 59106, 59107, 59108, 59109, 59110, 59111, 59112, 59113, 59114, 59115, 59116, 59117, 59118, 59119, 59120, 59121, 59122, 59123, 59124, 59125, 59126, 59127, 59128, 59129, 59130, 59131, 59132, 59133, 59134, 59135, 59136, 59137, 59138, 59139, 59140, 59141, 59142, 59143, 59144, 59145, 59146, 59147, 59148, 59149, 59150, 59151, 59152, 59153, 59154, 59155, 59156, 59157, 59158, 59159, 59160, 59161, 59162, 59163, 59164, 59165, 59166, 59167, 59168, 59169, 59170, 59171, 59172, 59173, 59174, 59175, 59176, 59177, 59178, 59179, 59180, 59181, 59182, 59183, 59184, 59185, 59186, 59187, 59188, 59189, 59190, 59191, 59192, 59193, 59194, 59195, 59196, 59197, 59198, 59199, 59200, 59201, 59202, 59203, 59204, 59205, 59206, 59207, 59208, 59209, 59210, 59211, 59212, 59213, 59214, 59215, 59216, 59217, 59218, 59219, 59220, 59221, 59222, 59223, 59224, 59225, 59226, 59227, 59228, 59229, 59230, 59231, 59232, 59233, 59234, 59235, 59236, 59237, 59238, 59239, 59240, 59241, 59242, 59243, 59244, 59245, 59246, 59247, 59248, 59249, 59250, 59251, 59252, 59253, 59254, 59255, 59256, 59257, 59258, 59259, 59260, 59261, 59262, 59263, 59264, 59265, 59266, 59267, 59268, 59269, 59270, 59271, 59272, 59273, 59274, 59275, 59276, 59277, 59278, 59279, 59280, 59281, 59282, 59283, 59284, 59285, 59286, 59287, 59288, 59289, 59290, 59291, 59292, 59293, 59294, 59295, 59296, 59297, 59298, 59299, 59300, 59301, 59302, 59303, 59304, 59305, 59306, 59307, 59308, 59309, 59310, 59311, 59312, 59313, 59314, 59315, 59316, 59317, 59318, 59319, 59320, 59321, 59322, 59323, 59324, 59325, 59326, 59327, 59328, 59329, 59330, 59331, 59332, 59333, 59334, 59335, 59336, 59337, 59338, 59339, 59340, 59341, 59342, 59343, 59344, 59345, 59346, 59347, 59348, 59349, 59350, 59351, 59352, 59353, 59354, 59355, 59356, 59357, 59358, 59359, 59360, 59361, 59362, 59363, 59364, 59365, 59366, 59367, 59368, 59369, 59370, 59371, 59372, 59373, 59374, 59375, 59376, 59377, 59378, 59379, 59380, 59381, 59382, 59383, 59384, 59385, 59386, 59387, 59388, 59389, 59390, 59391, 59392, 59393, 59394, 59395, 59396, 59397, 59398, 59399, 59400, 59401, 59402, 59403, 59404, 59405, 59406, 59407, 59408, 59409, 59410, 59411, 59412, 59413, 59414, 59415, 59416, 59417, 59418, 59419, 59420, 59421, 59422, 59423, 59424, 59425, 59426, 59427, 59428, 59429, 59430, 59431, 59432, 59433, 59434, 59435, 59436, 59437, 59438, 59439, 59440, 59441, 59442, 59443, 59444, 59445, 59446, 59447, 59448, 59449, 59450, 59451, 59452, 59453, 59454, 59455, 59456, 59457, 59458, 59459, 59460, 59461, 59462, 59463, 59464, 59465, 59466, 59467, 59468, 59469, 59470, 59471, 59472, 59473, 59474, 59475, 59476, 59477, 59478, 59479, 59480, 59481, 59482, 59483, 59484, 59485, 59486, 59487, 59488, 59489, 59490, 59491, 59492, 59493, 59494, 59495, 59496, 59497, 59498, 59499, 59500, 59501, 59502, 59503, 59504, 59505, 59506, 59507, 59508, 59509, 59510, 59511, 59512, 59513, 59514, 59515, 59516, 59517, 59518, 59519, 59520, 59521, 59522, 59523, 59524, 59525, 59526, 59527, 59528, 59529, 59530, 59531, 59532, 59533, 59534, 59535, 59536, 59537, 59538, 59539, 59540, 59541, 59542, 59543, 59544, 59545, 59546, 59547, 59548, 59549, 59550, 59551, 59552, 59553, 59554, 59555, 59556, 59557, 59558, 59559, 59560, 59561, 59562, 59563, 59564, 59565, 59566, 59567, 59568, 59569, 59570, 59571, 59572, 59573, 59574, 59575, 59576, 59577, 59578, 59579, 59580, 59581, 59582, 59583, 59584, 59585, 59586, 59587, 59588, 59589, 59590, 59591, 59592, 59593, 59594, 59595, 59596, 59597, 59598, 59599, 59600, 59601, 59602, 59603, 59604, 59605, 59606, 59607, 59608, 59609, 59610, 59611, 59612, 59613, 59614, 59615, 59616, 59617, 59618, 59619, 59620, 59621, 59622, 59623, 59624, 59625, 59626, 59627, 59628, 59629, 59630, 59631, 59632, 59633, 59634, 59635, 59636, 59637, 59638, 59639, 59640, 59641, 59642, 59643, 59644, 59645, 59646, 59647, 59648, 59649, 59650, 59651, 59652, 59653, 59654, 59655, 59656, 59657, 59658, 59659, 59660, 59661, 59662, 59663, 59664, 59665, 59666, 59667, 59668, 59669, 59670, 59671, 59672, 59673, 59674, 59675, 59676, 59677, 59678, 59679, 59680, 59681, 59682, 59683, 59684, 59685, 59686, 59687, 59688, 59689, 59690, 59691, 59692, 59693, 59694, 59695, 59696, 59697, 59698, 59699, 59700, 59701, 59702, 59703, 59704, 59705, 59706, 59707, 59708, 59709, 59710, 59711, 59712, 59713, 59714, 59715, 59716, 59717, 59718, 59719, 59720, 59721, 59722, 59723, 59724, 59725, 59726, 59727, 59728, 59729, 59730, 59731, 59732, 59733, 59734, 59735, 59736, 59737, 59738, 59739, 59740, 59741, 59742, 59743, 59744, 59745, 59746, 59747, 59748, 59749, 59750, 59751, 59752, 59753, 59754, 59755, 59756, 59757, 59758, 59759, 59760, 59761, 59762, 59763, 59764, 59765, 59766, 59767, 59768, 59769, 59770, 59771, 59772, 59773, 59774, 59775, 59776, 59777, 59778, 59779, 59780, 59781, 59782, 59783, 59784, 59785, 59786, 59787, 59788, 59789, 59790, 59791, 59792, 59793, 59794, 59795, 59796, 59797, 59798, 59799, 59800, 59801, 59802, 59803, 59804, 59805, 59806, 59807, 59808, 59809, 59810, 59811, 59812, 59813, 59814, 59815, 59816, 59817, 59818, 59819, 59820, 59821, 59822, 59823, 59824, 59825, 59826, 59827, 59828, 59829, 59830, 59831, 59832, 59833, 59834, 59835, 59836, 59837, 59838, 59839, 59840, 59841, 59842, 59843, 59844, 59845, 59846, 59847, 59848, 59849, 59850, 59851, 59852, 59853, 59854, 59855, 59856, 59857, 59858, 59859, 59860, 59861, 59862, 59863, 59864, 59865, 59866, 59867, 59868, 59869, 59870, 59871, 59872, 59873, 59874, 59875, 59876, 59877, 59878, 59879, 59880, 59881, 59882, 59883, 59884, 59885, 59886, 59887, 59888, 59889, 59890, 59891, 59892, 59893, 59894, 59895, 59896, 59897, 59898, 59899, 59900, 59901, 59902, 59903, 59904, 59905, 59906, 59907, 59908, 59909, 59910, 59911, 59912, 59913, 59914, 59915, 59916, 59917, 59918, 59919, 59920, 59921, 59922, 59923, 59924, 59925, 59926, 59927, 59928, 59929, 59930, 59931, 59932, 59933, 59934, 59935, 59936, 59937, 59938, 59939, 59940, 59941, 59942, 59943, 59944, 59945, 59946, 59947, 59948, 59949, 59950, 59951, 59952, 59953, 59954, 59955, 59956, 59957, 59958, 59959, 59960, 59961, 59962, 59963, 59964, 59965, 59966, 59967, 59968, 59969, 59970, 59971, 59972, 59973, 59974, 59975, 59976, 59977, 59978, 59979, 59980, 59981, 59982, 59983, 59984, 59985, 59986, 59987, 59988, 59989, 59990, 59991, 59992, 59993, 59994, 59995, 59996, 59997, 59998, 59999, 60000, 60001, 60002, 60003, 60004, 60005, 60006, 60007, 60008, 60009, 60010, 60011, 60012, 60013, 60014, 60015, 60016, 60017, 60018, 60019, 60020, 60021, 60022, 60023, 60024, 60025, 60026, 60027, 60028, 60029, 60030, 60031, 60032, 60033, 60034, 60035, 60036, 60037, 60038, 60039, 60040, 60041, 60042, 60043, 60044, 60045, 60046, 60047, 60048, 60049, 60050, 60051, 60052, 60053, 60054, 60055, 60056, 60057, 60058, 60059, 60060, 60061, 60062, 60063, 60064, 60065, 60066, 60067, 60068, 60069, 60070, 60071, 60072, 60073, 60074, 60075, 60076, 60077, 60078, 60079, 60080, 60081, 60082, 60083, 60084, 60085, 60086, 60087, 60088, 60089, 60090, 60091, 60092, 60093, 60094, 60095, 60096, 60097, 60098, 60099, 60100, 60101, 60102, 60103, 60104, 60105, 60106, 60107, 60108, 60109, 60110, 60111, 60112, 60113, 60114, 60115, 60116, 60117, 60118, 60119, 60120, 60121, 60122, 60123, 60124, 60125, 60126, 60127, 60128, 60129, 60130, 60131, 60132, 60133, 60134, 60135, 60136, 60137, 60138, 60139, 60140, 60141, 60142, 60143, 60144, 60145, 60146, 60147, 60148, 60149, 60150, 60151, 60152, 60153, 60154, 60155, 60156, 60157, 60158, 60159, 60160, 60161, 60162, 60163, 60164, 60165, 60166, 60167, 60168, 60169, 60170, 60171, 60172, 60173, 60174, 60175, 60176, 60177, 60178, 60179, 60180, 60181, 60182, 60183, 60184, 60185, 60186, 60187, 60188, 60189, 60190, 60191, 60192, 60193, 60194, 60195, 60196, 60197, 60198, 60199, 60200, 60201, 60202, 60203, 60204, 60205, 60206, 60207, 60208, 60209, 60210, 60211, 60212, 60213, 60214, 60215, 60216, 60217, 60218, 60219, 60220, 60221, 60222, 60223, 60224, 60225, 60226, 60227, 60228, 60229, 60230, 60231, 60232, 60233, 60234, 60235, 60236, 60237, 60238, 60239, 60240, 60241, 60242, 60243, 60244, 60245, 60246, 60247, 60248, 60249, 60250, 60251, 60252, 60253, 60254, 60255, 60256, 60257, 60258, 60259, 60260, 60261, 60262, 60263, 60264, 60265, 60266, 60267, 60268, 60269, 60270, 60271, 60272, 60273, 60274, 60275, 60276, 60277, 60278};
 
-double vEOPx[] = {-0.13307, -0.135, -0.1371, -0.1392, -0.14116, -0.14283, -0.14412, -0.14511, -0.14592, -0.14666, -0.14746, -0.14844, -0.14963, -0.15086, -0.15192, -0.15265, -0.15308, -0.1533, -0.15347, -0.15368, -0.15391, -0.15418, -0.15456, -0.15508, -0.15574, -0.15651, -0.15734, -0.15802, -0.15834, -0.1582, -0.15777, -0.15723, -0.15667, -0.15619, -0.15584, -0.1556, -0.1554, -0.15516, -0.15487, -0.15457, -0.15427, -0.15395, -0.15361, -0.15328, -0.15301, -0.15285, -0.15285, -0.15299, -0.15315, -0.15317, -0.15292, -0.1523, -0.15142, -0.15046, -0.14963, -0.1489, -0.14808, -0.14703, -0.14578, -0.1445, -0.14332, -0.14223, -0.14117, -0.14002, -0.13872, -0.13732, -0.13584, -0.13423, -0.13248, -0.13078, -0.1294, -0.12831, -0.12744, -0.12671, -0.12604, -0.1253, -0.12417, -0.12245, -0.12021, -0.11764, -0.11494, -0.11231, -0.10998, -0.10801, -0.10605, -0.10395, -0.10178, -0.09973, -0.09788, -0.09615, -0.09432, -0.0923, -0.0902, -0.08806, -0.08587, -0.08373, -0.08181, -0.07998, -0.07812, -0.07619, -0.07427, -0.07229, -0.07022, -0.06824, -0.06637, -0.06444, -0.06231, -0.05998, -0.05745, -0.05471, -0.05179, -0.04876, -0.04564, -0.04248, -0.03933, -0.03623, -0.03312, -0.03001, -0.02693, -0.02388, -0.02083, -0.01788, -0.01517, -0.01286, -0.01094, -0.00892, -0.00673, -0.00443, -0.002, 0.00054, 0.00308, 0.0055, 0.00784, 0.01012, 0.01239, 0.01473, 0.01715, 0.01958, 0.02207, 0.02461, 0.02716, 0.02965, 0.03203, 0.03426, 0.0363, 0.03817, 0.04012, 0.0422, 0.04436, 0.04655, 0.04873, 0.05096, 0.05332, 0.05572, 0.05814, 0.06063, 0.06326, 0.06607, 0.06908, 0.07216, 0.07519, 0.07803, 0.08062, 0.08296, 0.08521, 0.08756, 0.09016, 0.09289, 0.09555, 0.09798, 0.1002, 0.10227, 0.10426, 0.10625, 0.10837, 0.11066, 0.11301, 0.11527, 0.11732, 0.11909, 0.12057, 0.12196, 0.12348, 0.12529, 0.12743, 0.12976, 0.13204, 0.13406, 0.13575, 0.13719, 0.13856, 0.14004, 0.14166, 0.1434, 0.14524, 0.14724, 0.14933, 0.15148, 0.15371, 0.15602, 0.1583, 0.1605, 0.16269, 0.16481, 0.16673, 0.16838, 0.16962, 0.17043, 0.17093, 0.17135, 0.17189, 0.17261, 0.17344, 0.17431, 0.17503, 0.17581, 0.17671, 0.17791, 0.17916, 0.18034, 0.18141, 0.18233, 0.18314, 0.18398, 0.18502, 0.18629, 0.18767, 0.18897, 0.19006, 0.1909, 0.19164, 0.19237, 0.19304, 0.19362, 0.19414, 0.19473, 0.19554, 0.19655, 0.1978, 0.19934, 0.20115, 0.20311, 0.20498, 0.2065, 0.20753, 0.2081, 0.20833, 0.20843, 0.20855, 0.20882, 0.20932, 0.21006, 0.21097, 0.21195, 0.21295, 0.21386, 0.21459, 0.21503, 0.21513, 0.21488, 0.21436, 0.21372, 0.21309, 0.21254, 0.21208, 0.21183, 0.2118, 0.2119, 0.21201, 0.21205, 0.21194, 0.21165, 0.21121, 0.21051, 0.20954, 0.2083, 0.20694, 0.20579, 0.20517, 0.20508, 0.20531, 0.20558, 0.20563, 0.2053, 0.20459, 0.20368, 0.20266, 0.20152, 0.20029, 0.19922, 0.19832, 0.19759, 0.19701, 0.19648, 0.19579, 0.1947, 0.19317, 0.19122, 0.18901, 0.18669, 0.1844, 0.18222, 0.18017, 0.17823, 0.17633, 0.17449, 0.17274, 0.17117, 0.16978, 0.16848, 0.16715, 0.16578, 0.16452, 0.16361, 0.16305, 0.1625, 0.16155, 0.16005, 0.15807, 0.15576, 0.15331, 0.15086, 0.14855, 0.14642, 0.14448, 0.14261, 0.14069, 0.13855, 0.13609, 0.1332, 0.13007, 0.12686, 0.1237, 0.12071, 0.11797, 0.11536, 0.11272, 0.10989, 0.10683, 0.10364, 0.1004, 0.09709, 0.09377, 0.09052, 0.0874, 0.0845, 0.08188, 0.07959, 0.07766, 0.07594, 0.0742, 0.07227, 0.07007, 0.06758, 0.06489, 0.06217, 0.05946, 0.05672, 0.05392, 0.05114, 0.04847, 0.04598, 0.04373, 0.04169, 0.03981, 0.03806, 0.03643, 0.03484, 0.03315, 0.03128, 0.02938, 0.02745, 0.02549, 0.02347, 0.02149, 0.01967, 0.01806, 0.01656, 0.01518, 0.0139, 0.01262, 0.0113, 0.01002, 0.00886, 0.0077, 0.00639, 0.00486, 0.00308, 0.0009, -0.00164, -0.00428, -0.00671, -0.00876, -0.01052, -0.01214, -0.01379, -0.01555, -0.0174, -0.01926, -0.02109, -0.02292, -0.02475, -0.02657, -0.02836, -0.03008, -0.03175, -0.03333, -0.03463, -0.03568, -0.03664, -0.03775, -0.03918, -0.0409, -0.0429, -0.0451, -0.04738, -0.0496, -0.0516, -0.05324, -0.05448, -0.05548, -0.05637, -0.05743, -0.05865, -0.05993, -0.06121, -0.06253, -0.06384, -0.06502, -0.06605, -0.06686, -0.06745, -0.06785, -0.06812, -0.06822, -0.06819, -0.06813, -0.06827, -0.06874, -0.06949, -0.07039, -0.07123, -0.0719, -0.07226, -0.07247, -0.07276, -0.07326, -0.07386, -0.07443, -0.07502, -0.07576, -0.07673, -0.07787, -0.07908, -0.08021, -0.08132, -0.08246, -0.08356, -0.08455, -0.08545, -0.08636, -0.0876, -0.08912, -0.09074, -0.09225, -0.09353, -0.09451, -0.09521, -0.09577, -0.0963, -0.09685, -0.09751, -0.09828, -0.09906, -0.09982, -0.1005, -0.10113, -0.10165, -0.10198, -0.10211, -0.10204, -0.10182, -0.1015, -0.10117, -0.10083, -0.10046, -0.10007, -0.09977, -0.09968, -0.09965, -0.09957, -0.09951, -0.0996, -0.09993, -0.10042, -0.10088, -0.10124, -0.10137, -0.10119, -0.10066, -0.09982, -0.09888, -0.09802, -0.0974, -0.09701, -0.09681, -0.09675, -0.09685, -0.09706, -0.09723, -0.09732, -0.09725, -0.09694, -0.09648, -0.09598, -0.09558, -0.09544, -0.09566, -0.09586, -0.0956, -0.09502, -0.09432, -0.09367, -0.09312, -0.09263, -0.09203, -0.09117, -0.09001, -0.08864, -0.08719, -0.08579, -0.08453, -0.08349, -0.0827, -0.08216, -0.0818, -0.08135, -0.0806, -0.07988, -0.07935, -0.07895, -0.07849, -0.07785, -0.07701, -0.07613, -0.07547, -0.07505, -0.07473, -0.07431, -0.07359, -0.07237, -0.07055, -0.06856, -0.06651, -0.0644, -0.06229, -0.06018, -0.05815, -0.05633, -0.05482, -0.05348, -0.05217, -0.05085, -0.04957, -0.04838, -0.04739, -0.04671, -0.04621, -0.04578, -0.04527, -0.04451, -0.04346, -0.04229, -0.04135, -0.04066, -0.04008, -0.03954, -0.03891, -0.03798, -0.03659, -0.03513, -0.03373, -0.03228, -0.03079, -0.02929, -0.02779, -0.02627, -0.02497, -0.02375, -0.02247, -0.02121, -0.02007, -0.01903, -0.01808, -0.0171, -0.01598, -0.01473, -0.01336, -0.01179, -0.00985, -0.00744, -0.00485, -0.00236, -0.00018, 0.00155, 0.00288, 0.00403, 0.00523, 0.00664, 0.00835, 0.01039, 0.01273, 0.01528, 0.01803, 0.02092, 0.02379, 0.02661, 0.02933, 0.03182, 0.03404, 0.03611, 0.03826, 0.04071, 0.04347, 0.04617, 0.04852, 0.0506, 0.05249, 0.05418, 0.05581, 0.05759, 0.05973, 0.06225, 0.06505, 0.06784, 0.07057, 0.07329, 0.07599, 0.07867, 0.08135, 0.08405, 0.0868, 0.08957, 0.09234, 0.095, 0.09741, 0.09958, 0.1016, 0.10357, 0.10553, 0.10759, 0.10956, 0.11133, 0.11302, 0.11477, 0.11664, 0.11865, 0.12074, 0.12267, 0.12445, 0.12635, 0.12859, 0.13114, 0.1338, 0.13624, 0.13827, 0.13987, 0.14111, 0.14216, 0.14312, 0.14409, 0.14514, 0.14618, 0.14711, 0.14797, 0.14887, 0.14982, 0.15079, 0.15185, 0.153, 0.15428, 0.15574, 0.1573, 0.15883, 0.16027, 0.16163, 0.16268, 0.16337, 0.1638, 0.16406, 0.16425, 0.16457, 0.16525, 0.16626, 0.16737, 0.16843, 0.16934, 0.17008, 0.17082, 0.17193, 0.17338, 0.17498, 0.17648, 0.17775, 0.17881, 0.17976, 0.18069, 0.18154, 0.18223, 0.18277, 0.18313, 0.18324, 0.18315, 0.18305, 0.18299, 0.18306, 0.18327, 0.18354, 0.18376, 0.18383, 0.1838, 0.18369, 0.18348, 0.18323, 0.18298, 0.18281, 0.18277, 0.18279, 0.18291, 0.18322, 0.18365, 0.18417, 0.18471, 0.18515, 0.1854, 0.18552, 0.18569, 0.18603, 0.18656, 0.18724, 0.18799, 0.1886, 0.18905, 0.18916, 0.18889, 0.18837, 0.18781, 0.18735, 0.18716, 0.18707, 0.18681, 0.18628, 0.18543, 0.18429, 0.18296, 0.18156, 0.1802, 0.17891, 0.1777, 0.17654, 0.17542, 0.17439, 0.17351, 0.17263, 0.17157, 0.17036, 0.16904, 0.16768, 0.16645, 0.16546, 0.16456, 0.16362, 0.16267, 0.16175, 0.16093, 0.16018, 0.15944, 0.15858, 0.15751, 0.15618, 0.15459, 0.1529, 0.15133, 0.14989, 0.14844, 0.14688, 0.1452, 0.14347, 0.14172, 0.13994, 0.13822, 0.13661, 0.13499, 0.13327, 0.13142, 0.12952, 0.12763, 0.12579, 0.124, 0.12222, 0.12048, 0.1188, 0.11717, 0.11549, 0.11368, 0.11182, 0.10996, 0.10806, 0.10608, 0.10404, 0.10207, 0.10017, 0.09829, 0.09644, 0.09466, 0.09286, 0.09092, 0.08879, 0.08661, 0.08452, 0.08254, 0.08056, 0.07861, 0.07674, 0.07498, 0.07336, 0.07177, 0.07014, 0.06849, 0.06693, 0.06556, 0.06436, 0.06308, 0.06154, 0.05958, 0.05721, 0.05457, 0.05195, 0.04966, 0.04756, 0.04541, 0.04291, 0.04001, 0.03687, 0.03372, 0.03081, 0.02837, 0.02641, 0.02458, 0.0227, 0.0207, 0.01851, 0.01609, 0.01345, 0.01086, 0.00848, 0.00633, 0.00423, 0.00191, -0.00071, -0.00355, -0.00624, -0.00869, -0.01093, -0.01317, -0.01565, -0.01852, -0.0217, -0.02491, -0.02789, -0.0306, -0.0331, -0.03556, -0.03811, -0.04093, -0.04392, -0.04687, -0.04968, -0.05238, -0.05501, -0.05762, -0.06033, -0.06295, -0.06526, -0.06725, -0.06909, -0.07107, -0.07352, -0.07654, -0.07994, -0.08336, -0.08658, -0.08939, -0.0916, -0.09326, -0.09463, -0.09585, -0.09699, -0.09817, -0.0996, -0.10147, -0.10394, -0.10685, -0.10985, -0.11263, -0.11507, -0.11719, -0.11918, -0.12129, -0.12362, -0.12605, -0.12825, -0.1301, -0.13162, -0.13296, -0.13428, -0.13568, -0.13709, -0.13852, -0.13998, -0.14144, -0.14284, -0.14407, -0.1449, -0.14538, -0.14575, -0.14618, -0.14672, -0.14731, -0.14791, -0.14858, -0.14943, -0.15041, -0.15143, -0.15243, -0.15323, -0.15361, -0.15345, -0.15287, -0.15221, -0.15175, -0.15156, -0.15148, -0.15137, -0.1516, -0.1521, -0.15265, -0.15296, -0.15283, -0.15242, -0.15195, -0.1516, -0.15147, -0.15162, -0.15212, -0.15291, -0.1536, -0.15388, -0.15407, -0.15434, -0.15476, -0.15537, -0.15616, -0.15703, -0.15781, -0.15837, -0.15877, -0.15904, -0.15913, -0.15901, -0.15875, -0.15843, -0.15799, -0.157, -0.1554, -0.15329, -0.15092, -0.14859, -0.14646, -0.14458, -0.14293, -0.14147, -0.14014, -0.13879, -0.13724, -0.13549, -0.13381, -0.13226, -0.13092, -0.12987, -0.12915, -0.12865, -0.12817, -0.12737, -0.12627, -0.12502, -0.12369, -0.12227, -0.12079, -0.11934, -0.11795, -0.11675, -0.11588, -0.11531, -0.11508, -0.11518, -0.11553, -0.11587, -0.11585, -0.11513, -0.11384, -0.11194, -0.1094, -0.10637, -0.10319, -0.10026, -0.09791, -0.09619, -0.09499, -0.09402, -0.09285, -0.0911, -0.089, -0.08692, -0.08506, -0.08344, -0.08197, -0.08049, -0.07883, -0.07673, -0.07399, -0.07071, -0.06714, -0.0635, -0.05993, -0.05652, -0.05325, -0.04996, -0.04663, -0.04331, -0.04006, -0.03695, -0.03415, -0.03168, -0.02955, -0.02769, -0.02606, -0.02441, -0.02233, -0.01967, -0.01673, -0.01381, -0.01107, -0.00871, -0.00676, -0.00501, -0.00318, -0.00081, 0.00257, 0.00697, 0.01203, 0.01711, 0.02169, 0.02564, 0.02905, 0.03213, 0.03516, 0.0383, 0.04151, 0.0447, 0.04796, 0.05123, 0.05437, 0.05732, 0.06019, 0.06309, 0.06601, 0.06907, 0.07222, 0.07555, 0.07902, 0.08249, 0.08581, 0.0889, 0.09176, 0.09474, 0.09818, 0.10183, 0.10558, 0.10955, 0.11373, 0.11796, 0.1221, 0.1261, 0.12991, 0.13353, 0.13705, 0.14056, 0.14405, 0.14759, 0.15129, 0.15526, 0.15946, 0.16373, 0.16779, 0.1715, 0.17483, 0.17794, 0.18101, 0.18403, 0.18693, 0.18959, 0.19186, 0.19379, 0.19553, 0.19724, 0.19913, 0.20124, 0.20343, 0.20552, 0.20752, 0.20949, 0.21143, 0.21341, 0.21543, 0.21753, 0.21974, 0.22221, 0.22501, 0.22811, 0.23135, 0.23454, 0.23755, 0.2405, 0.24334, 0.24596, 0.24829, 0.25036, 0.25225, 0.25417, 0.25621, 0.25841, 0.26074, 0.26312, 0.26545, 0.2676, 0.26948, 0.27106, 0.2723, 0.27319, 0.27387, 0.27454, 0.27536, 0.27635, 0.27748, 0.27874, 0.28004, 0.28121, 0.28218, 0.28306, 0.28398, 0.2849, 0.28565, 0.28617, 0.28649, 0.28675, 0.28707, 0.28742, 0.28759, 0.28763, 0.2877, 0.28785, 0.28798, 0.28797, 0.28777, 0.28759, 0.28747, 0.28729, 0.28693, 0.28647, 0.286, 0.28541, 0.28455, 0.28356, 0.2825, 0.28135, 0.28027, 0.27944, 0.27886, 0.27826, 0.27753, 0.27669, 0.2758, 0.27482, 0.27367, 0.27226, 0.27057, 0.2689, 0.26744, 0.26607, 0.26455, 0.26259, 0.26014, 0.25759, 0.25524, 0.25308, 0.251, 0.24901, 0.2471, 0.24509, 0.24278, 0.24034, 0.23806, 0.236, 0.23401, 0.23203, 0.22987, 0.22734, 0.22457, 0.22185, 0.21931, 0.21703, 0.21491, 0.21264, 0.20993, 0.20687, 0.2037, 0.20047, 0.19721, 0.19398, 0.19094, 0.18817, 0.18557, 0.1829, 0.18004, 0.17705, 0.17413, 0.17133, 0.16834, 0.16513, 0.16179, 0.15857, 0.15555, 0.15266, 0.14979, 0.14698, 0.14418, 0.14124, 0.13801, 0.13447, 0.1306, 0.12648, 0.12251, 0.11868, 0.11476, 0.11074, 0.10659, 0.10237, 0.09823, 0.09438, 0.0909, 0.0878, 0.08463, 0.08104, 0.07713, 0.07322, 0.06974, 0.06688, 0.06446, 0.06199, 0.05903, 0.05544, 0.05133, 0.047, 0.04271, 0.03866, 0.03498, 0.03157, 0.02827, 0.02502, 0.02185, 0.01858, 0.01504, 0.01129, 0.00745, 0.00364, -0.0001, -0.00384, -0.00757, -0.01133, -0.01508, -0.01867, -0.02196, -0.02516, -0.02888, -0.03313, -0.03757, -0.04181, -0.04582, -0.04985, -0.05401, -0.05807, -0.06182, -0.0653, -0.06866, -0.07209, -0.07578, -0.07998, -0.08476, -0.08989, -0.09501, -0.09982, -0.10435, -0.10867, -0.11268, -0.11623, -0.11939, -0.12246, -0.12552, -0.12881, -0.13239, -0.13586, -0.13865, -0.14103, -0.14331, -0.14561, -0.14793, -0.1503, -0.15264, -0.15487, -0.15692, -0.15876, -0.16056, -0.16243, -0.16443, -0.1665, -0.16859, -0.17062, -0.17256, -0.1744, -0.17603, -0.1773, -0.17832, -0.17937, -0.18051, -0.18181, -0.18349, -0.18533, -0.187, -0.18871, -0.19064, -0.19272, -0.19479, -0.1967, -0.19835, -0.19967, -0.20082, -0.20214, -0.20356, -0.20507, -0.20661, -0.20819, -0.20977, -0.21108, -0.21201, -0.2128, -0.21383, -0.21526, -0.21695, -0.21859, -0.21992, -0.2209, -0.22154, -0.22191, -0.22216, -0.22248, -0.22299, -0.22365, -0.22444, -0.22514, -0.22528, -0.22468, -0.2235, -0.22207, -0.22075, -0.21962, -0.21881, -0.21848, -0.21867, -0.21938, -0.22035, -0.22113, -0.22145, -0.22145, -0.22127, -0.22086, -0.22036, -0.21995, -0.21951, -0.21882, -0.21769, -0.21614, -0.21435, -0.21247, -0.21056, -0.20864, -0.20689, -0.20536, -0.204, -0.20268, -0.20127, -0.19978, -0.19828, -0.19664, -0.19479, -0.19283, -0.19072, -0.1882, -0.18511, -0.18183, -0.17902, -0.17687, -0.17515, -0.17336, -0.17123, -0.16868, -0.16574, -0.16268, -0.15978, -0.157, -0.15431, -0.15176, -0.14946, -0.14746, -0.14573, -0.14402, -0.14221, -0.14029, -0.13807, -0.13533, -0.13228, -0.12944, -0.12667, -0.12364, -0.12017, -0.11645, -0.11281, -0.10958, -0.10663, -0.10381, -0.10098, -0.09802, -0.0948, -0.0913, -0.08775, -0.08433, -0.08079, -0.07687, -0.07257, -0.06813, -0.06383, -0.05992, -0.05651, -0.05328, -0.04983, -0.04607, -0.04211, -0.03801, -0.03373, -0.02928, -0.02482, -0.02043, -0.01602, -0.01162, -0.00736, -0.00349, -0.00012, 0.00305, 0.00634, 0.00982, 0.0134, 0.01703, 0.02084, 0.02506, 0.02968, 0.03457, 0.03966, 0.04475, 0.04952, 0.05379, 0.0576, 0.06135, 0.06541, 0.06976, 0.07413, 0.07837, 0.08251, 0.08669, 0.09072, 0.09445, 0.09793, 0.10136, 0.10502, 0.10906, 0.11337, 0.1178, 0.12216, 0.12637, 0.1304, 0.13417, 0.13777, 0.14143, 0.14521, 0.14908, 0.15294, 0.15667, 0.16009, 0.16318, 0.16627, 0.1694, 0.17251, 0.17572, 0.17897, 0.18211, 0.18517, 0.18839, 0.19188, 0.19568, 0.1997, 0.20373, 0.20759, 0.21129, 0.21506, 0.21866, 0.22179, 0.22473, 0.22761, 0.23042, 0.23299, 0.23521, 0.23718, 0.23882, 0.24009, 0.24122, 0.2425, 0.24391, 0.24537, 0.24698, 0.24874, 0.25064, 0.25257, 0.25436, 0.25599, 0.25755, 0.25915, 0.26066, 0.26206, 0.26352, 0.26523, 0.26728, 0.2697, 0.2722, 0.27437, 0.2762, 0.27795, 0.27988, 0.28202, 0.2841, 0.28588, 0.2873, 0.28857, 0.28993, 0.29131, 0.2926, 0.29384, 0.29499, 0.29599, 0.29675, 0.29719, 0.2974, 0.29757, 0.29794, 0.29808, 0.2979, 0.2975, 0.29701, 0.29646, 0.29586, 0.29538, 0.2948, 0.29418, 0.29348, 0.29282, 0.29237, 0.29198, 0.29135, 0.29034, 0.28907, 0.28762, 0.28614, 0.28482, 0.28381, 0.28311, 0.28256, 0.28204, 0.28132, 0.28028, 0.27884, 0.27713, 0.27542, 0.27371, 0.27205, 0.27042, 0.26882, 0.26728, 0.26566, 0.26373, 0.2617, 0.25976, 0.25787, 0.25599, 0.25405, 0.25193, 0.24966, 0.24726, 0.24481, 0.24238, 0.23988, 0.23736, 0.23504, 0.23278, 0.23032, 0.22775, 0.22515, 0.22262, 0.22005, 0.21725, 0.21421, 0.21122, 0.20865, 0.20655, 0.20463, 0.20252, 0.2, 0.19715, 0.19426, 0.19138, 0.1884, 0.18522, 0.18183, 0.17817, 0.17407, 0.16994, 0.1661, 0.16237, 0.15857, 0.15454, 0.15033, 0.14598, 0.14147, 0.13736, 0.13398, 0.13096, 0.12793, 0.12492, 0.12207, 0.11917, 0.11595, 0.11248, 0.1088, 0.10498, 0.1012, 0.09737, 0.09345, 0.0895, 0.08573, 0.08219, 0.07865, 0.07489, 0.07078, 0.0665, 0.06232, 0.05832, 0.05441, 0.05048, 0.04659, 0.04292, 0.03959, 0.03659, 0.03369, 0.03073, 0.02764, 0.02446, 0.02129, 0.01811, 0.015, 0.01217, 0.00968, 0.00729, 0.00459, 0.00139, -0.00223, -0.00615, -0.01033, -0.01473, -0.01916, -0.02322, -0.02694, -0.03045, -0.03375, -0.03699, -0.04044, -0.04406, -0.04748, -0.05046, -0.05329, -0.05616, -0.05903, -0.06171, -0.06406, -0.06614, -0.06813, -0.07006, -0.07204, -0.07425, -0.07687, -0.07976, -0.08243, -0.08502, -0.08778, -0.09064, -0.09374, -0.09689, -0.09992, -0.10285, -0.10564, -0.10841, -0.11144, -0.11449, -0.11731, -0.11996, -0.12257, -0.12488, -0.12684, -0.12861, -0.13045, -0.13234, -0.13426, -0.13629, -0.13839, -0.14047, -0.14263, -0.14498, -0.14757, -0.15022, -0.15269, -0.15506, -0.15719, -0.15901, -0.16055, -0.16173, -0.16321, -0.16513, -0.16757, -0.17005, -0.17217, -0.1738, -0.17491, -0.17566, -0.17633, -0.17722, -0.17847, -0.18017, -0.18213, -0.18407, -0.18558, -0.18635, -0.18657, -0.18646, -0.18645, -0.18684, -0.18759, -0.18829, -0.18867, -0.18886, -0.18919, -0.1895, -0.18963, -0.18957, -0.18942, -0.18949, -0.18993, -0.19038, -0.19073, -0.19103, -0.19119, -0.19101, -0.19031, -0.18929, -0.18824, -0.18724, -0.18634, -0.18549, -0.18451, -0.18341, -0.18236, -0.18134, -0.18037, -0.17966, -0.17922, -0.17885, -0.17836, -0.17769, -0.17681, -0.17581, -0.17483, -0.17399, -0.17331, -0.17267, -0.17175, -0.17042, -0.16875, -0.16702, -0.16555, -0.16446, -0.16349, -0.16236, -0.16087, -0.15887, -0.15636, -0.15353, -0.15071, -0.14804, -0.14532, -0.1424, -0.13934, -0.13638, -0.13378, -0.1316, -0.12958, -0.12749, -0.12513, -0.12241, -0.11945, -0.11647, -0.11356, -0.11069, -0.10817, -0.10588, -0.10362, -0.10136, -0.09909, -0.0967, -0.09418, -0.09177, -0.0895, -0.08727, -0.08499, -0.08261, -0.08006, -0.07737, -0.07487, -0.07258, -0.07034, -0.06797, -0.06518, -0.06181, -0.05804, -0.05428, -0.05056, -0.04689, -0.04328, -0.03968, -0.03605, -0.03239, -0.02878, -0.02507, -0.0212, -0.01717, -0.01299, -0.00887, -0.00495, -0.00122, 0.0025, 0.00641, 0.01056, 0.01489, 0.01929, 0.02358, 0.02754, 0.03131, 0.03505, 0.03877, 0.04262, 0.04675, 0.05096, 0.05483, 0.05836, 0.06179, 0.06533, 0.06896, 0.07255, 0.07587, 0.07882, 0.08161, 0.08457, 0.08795, 0.09171, 0.09555, 0.09915, 0.10245, 0.10549, 0.10811, 0.1104, 0.1126, 0.11495, 0.11754, 0.12033, 0.12331, 0.12641, 0.12946, 0.13238, 0.13521, 0.13787, 0.14025, 0.14249, 0.14474, 0.14698, 0.14917, 0.15135, 0.15354, 0.15564, 0.1576, 0.15948, 0.1613, 0.16311, 0.165, 0.16703, 0.16922, 0.17167, 0.17425, 0.17686, 0.17937, 0.18165, 0.18379, 0.18596, 0.18813, 0.19027, 0.19248, 0.19492, 0.1976, 0.20036, 0.2029, 0.20492, 0.20651, 0.20803, 0.2097, 0.21142, 0.21288, 0.21421, 0.21553, 0.21672, 0.21753, 0.21791, 0.21802, 0.21813, 0.21849, 0.21915, 0.21991, 0.22064, 0.22124, 0.22163, 0.22172, 0.22151, 0.22123, 0.22105, 0.22098, 0.22102, 0.22111, 0.22127, 0.22152, 0.22176, 0.22194, 0.22215, 0.22241, 0.22262, 0.22267, 0.22255, 0.22245, 0.22263, 0.22315, 0.22383, 0.22443, 0.22491, 0.22532, 0.2256, 0.22581, 0.22616, 0.22682, 0.22767, 0.22822, 0.22816, 0.22772, 0.2271, 0.22634, 0.22543, 0.2242, 0.22264, 0.22097, 0.21944, 0.21828, 0.21752, 0.21699, 0.2165, 0.21594, 0.21529, 0.21466, 0.21406, 0.21344, 0.21271, 0.2117, 0.21037, 0.20881, 0.20717, 0.20552, 0.204, 0.20274, 0.2017, 0.20067, 0.19926, 0.19753, 0.19581, 0.19412, 0.19232, 0.19039, 0.18838, 0.18617, 0.18368, 0.18101, 0.17828, 0.17576, 0.17367, 0.17203, 0.17043, 0.16861, 0.16643, 0.16399, 0.16151, 0.15913, 0.1571, 0.15544, 0.1539, 0.15204, 0.14961, 0.14675, 0.14385, 0.14116, 0.13896, 0.13713, 0.13503, 0.13243, 0.12958, 0.12663, 0.12364, 0.12081, 0.11812, 0.11551, 0.11287, 0.11013, 0.10737, 0.10475, 0.10241, 0.10015, 0.0978, 0.09539, 0.09297, 0.09051, 0.088, 0.08536, 0.08249, 0.07941, 0.07616, 0.07276, 0.06948, 0.06665, 0.06374, 0.06056, 0.05735, 0.05424, 0.05119, 0.04807, 0.0448, 0.04142, 0.03804, 0.03477, 0.03164, 0.02864, 0.02588, 0.02332, 0.02048, 0.01743, 0.01432, 0.01119, 0.00804, 0.00477, 0.00141, -0.00184, -0.00482, -0.00749, -0.00995, -0.01238, -0.015, -0.01787, -0.02057, -0.02295, -0.025, -0.0268, -0.02844, -0.03005, -0.03192, -0.03451, -0.03767, -0.0411, -0.04462, -0.04791, -0.05085, -0.05348, -0.05572, -0.0574, -0.05857, -0.05952, -0.06057, -0.06192, -0.06351, -0.06518, -0.06682, -0.0684, -0.07, -0.07161, -0.07325, -0.07483, -0.0761, -0.07715, -0.07834, -0.08007, -0.0823, -0.08465, -0.0869, -0.08892, -0.09079, -0.09279, -0.09477, -0.09647, -0.09787, -0.0992, -0.1006, -0.10217, -0.10393, -0.10584, -0.10765, -0.10899, -0.10985, -0.11044, -0.11107, -0.11192, -0.1129, -0.11369, -0.11405, -0.11406, -0.11391, -0.11374, -0.11364, -0.11377, -0.11413, -0.11461, -0.11499, -0.11488, -0.11451, -0.11404, -0.11368, -0.11357, -0.1136, -0.11366, -0.1137, -0.11365, -0.11346, -0.11311, -0.11276, -0.11269, -0.11292, -0.11319, -0.11333, -0.11345, -0.11364, -0.11391, -0.1142, -0.11442, -0.11451, -0.11444, -0.11422, -0.11384, -0.11334, -0.11283, -0.11234, -0.11186, -0.11135, -0.11088, -0.11055, -0.11029, -0.11002, -0.10988, -0.10986, -0.10959, -0.10915, -0.10865, -0.10806, -0.10758, -0.10739, -0.10734, -0.10707, -0.10646, -0.1058, -0.10523, -0.10474, -0.10444, -0.1045, -0.10463, -0.10451, -0.1041, -0.10357, -0.10296, -0.10213, -0.10119, -0.10043, -0.09992, -0.09932, -0.0983, -0.09694, -0.09527, -0.09356, -0.0917, -0.08984, -0.08808, -0.08637, -0.08461, -0.08285, -0.08129, -0.07977, -0.07813, -0.07617, -0.07376, -0.07101, -0.06815, -0.06548, -0.06292, -0.06043, -0.05791, -0.05532, -0.05274, -0.05019, -0.0477, -0.0452, -0.04269, -0.04015, -0.03766, -0.03523, -0.0329, -0.03068, -0.02852, -0.02643, -0.02444, -0.02249, -0.02057, -0.01866, -0.01651, -0.0142, -0.01181, -0.00927, -0.00667, -0.00417, -0.00184, 0.00023, 0.00213, 0.00399, 0.0059, 0.00779, 0.00978, 0.01197, 0.01412, 0.0161, 0.01794, 0.01993, 0.02222, 0.02477, 0.02759, 0.03055, 0.03325, 0.03547, 0.03742, 0.03947, 0.0417, 0.04396, 0.0462, 0.04839, 0.05045, 0.05237, 0.05423, 0.05616, 0.05824, 0.06056, 0.06311, 0.06554, 0.06764, 0.06949, 0.07121, 0.07293, 0.07485, 0.07719, 0.07986, 0.08252, 0.08499, 0.08727, 0.08939, 0.09142, 0.09328, 0.09503, 0.09692, 0.09919, 0.10173, 0.10422, 0.10635, 0.10797, 0.10924, 0.11054, 0.1121, 0.11395, 0.1159, 0.11764, 0.11914, 0.12036, 0.12137, 0.12231, 0.12328, 0.12424, 0.12531, 0.12655, 0.12809, 0.12981, 0.13149, 0.13299, 0.13431, 0.13569, 0.13724, 0.13883, 0.1402, 0.14129, 0.14209, 0.14288, 0.14399, 0.14531, 0.1467, 0.14808, 0.14929, 0.15029, 0.1512, 0.15184, 0.15224, 0.15254, 0.15295, 0.15351, 0.15419, 0.15504, 0.15607, 0.15718, 0.15829, 0.15946, 0.16069, 0.16189, 0.16284, 0.16327, 0.16321, 0.16326, 0.16363, 0.16422, 0.16488, 0.16552, 0.16618, 0.16665, 0.16666, 0.16622, 0.16548, 0.1647, 0.16418, 0.16385, 0.16328, 0.16205, 0.16017, 0.1582, 0.15644, 0.1549, 0.15378, 0.15288, 0.15192, 0.151, 0.15023, 0.14927, 0.14804, 0.14709, 0.14654, 0.14595, 0.14502, 0.14378, 0.14236, 0.14093, 0.13974, 0.13876, 0.13797, 0.13743, 0.1372, 0.13728, 0.13757, 0.13808, 0.13895, 0.14016, 0.14145, 0.14242, 0.14288, 0.14307, 0.14317, 0.14316, 0.1429, 0.14237, 0.14181, 0.14129, 0.14068, 0.13976, 0.13866, 0.13787, 0.13751, 0.13722, 0.13682, 0.13648, 0.13633, 0.1362, 0.13584, 0.13499, 0.13356, 0.13155, 0.12926, 0.12705, 0.12494, 0.1228, 0.12072, 0.11897, 0.11761, 0.11662, 0.11617, 0.1162, 0.11631, 0.11602, 0.1152, 0.11408, 0.11291, 0.1117, 0.11061, 0.10946, 0.10816, 0.10668, 0.10509, 0.10348, 0.10201, 0.101, 0.10042, 0.09971, 0.09847, 0.09676, 0.09479, 0.09271, 0.09082, 0.08925, 0.08797, 0.08687, 0.08579, 0.08453, 0.08277, 0.08089, 0.0794, 0.07853, 0.07824, 0.07816, 0.07772, 0.07656, 0.07496, 0.07317, 0.07146, 0.07007, 0.069, 0.0682, 0.06749, 0.06665, 0.06557, 0.06443, 0.06336, 0.06228, 0.06112, 0.06005, 0.05889, 0.0576, 0.05618, 0.05465, 0.05299, 0.05122, 0.04988, 0.04903, 0.04827, 0.04741, 0.0466, 0.04565, 0.04417, 0.0421, 0.03938, 0.03643, 0.03383, 0.03176, 0.02993, 0.02804, 0.02606, 0.02397, 0.02191, 0.02014, 0.01874, 0.01747, 0.01591, 0.01388, 0.01214, 0.01108, 0.01056, 0.0102, 0.00965, 0.00889, 0.00816, 0.00741, 0.00634, 0.00487, 0.00316, 0.00159, 0.00028, -0.00097, -0.00219, -0.00357, -0.00525, -0.0069, -0.00794, -0.00828, -0.00839, -0.00859, -0.00919, -0.01035, -0.01187, -0.01346, -0.0148, -0.01572, -0.01643, -0.01712, -0.01787, -0.01848, -0.01882, -0.01906, -0.01919, -0.01915, -0.01897, -0.01898, -0.01932, -0.01979, -0.02013, -0.02033, -0.02044, -0.02045, -0.02047, -0.02068, -0.02126, -0.02217, -0.02305, -0.02367, -0.02403, -0.02433, -0.02465, -0.02508, -0.02575, -0.02658, -0.02729, -0.02787, -0.02852, -0.02919, -0.02975, -0.0303, -0.03074, -0.03104, -0.03131, -0.03151, -0.03166, -0.03198, -0.03255, -0.03292, -0.03298, -0.03283, -0.03255, -0.03233, -0.0323, -0.03233, -0.03215, -0.03192, -0.03199, -0.03234, -0.0326, -0.03256, -0.03235, -0.03223, -0.03207, -0.0317, -0.03109, -0.03036, -0.02962, -0.02882, -0.0279, -0.02695, -0.02614, -0.02547, -0.02493, -0.02458, -0.02445, -0.02466, -0.02515, -0.02562, -0.02581, -0.02568, -0.0253, -0.02472, -0.02408, -0.02353, -0.02335, -0.02361, -0.0239, -0.02394, -0.02377, -0.02343, -0.02292, -0.02228, -0.02156, -0.02077, -0.01979, -0.0185, -0.01703, -0.01567, -0.0147, -0.01408, -0.01374, -0.01349, -0.01314, -0.01266, -0.01215, -0.01175, -0.01163, -0.0115, -0.01095, -0.01023, -0.00971, -0.00921, -0.00859, -0.00816, -0.00816, -0.0084, -0.00861, -0.00851, -0.00831, -0.0081, -0.00774, -0.0072, -0.00669, -0.0064, -0.0063, -0.00613, -0.00567, -0.00479, -0.00362, -0.00238, -0.00122, -0.00033, 0.00015, 0.00047, 0.00095, 0.00169, 0.0025, 0.00313, 0.00359, 0.00397, 0.00427, 0.00443, 0.0046, 0.00497, 0.00543, 0.00554, 0.0053, 0.00507, 0.0051, 0.00535, 0.00565, 0.00591, 0.00618, 0.00645, 0.0067, 0.00718, 0.00784, 0.00853, 0.00924, 0.00988, 0.01054, 0.01139, 0.01241, 0.01338, 0.01402, 0.01425, 0.0141, 0.01385, 0.01381, 0.01408, 0.01457, 0.01515, 0.01579, 0.01642, 0.01684, 0.01724, 0.01779, 0.01838, 0.01895, 0.01954, 0.02006, 0.02041, 0.02059, 0.02085, 0.02136, 0.022, 0.02269, 0.0233, 0.02384, 0.02424, 0.02444, 0.02459, 0.02498, 0.02574, 0.02683, 0.02785, 0.02856, 0.02889, 0.02885, 0.0288, 0.02931, 0.0304, 0.03168, 0.03272, 0.03322, 0.03324, 0.03297, 0.0326, 0.03224, 0.03193, 0.03182, 0.0321, 0.03271, 0.03339, 0.03395, 0.03433, 0.03457, 0.0348, 0.03489, 0.03472, 0.0346, 0.03492, 0.03579, 0.03671, 0.03724, 0.0374, 0.03747, 0.0378, 0.03832, 0.0385, 0.03839, 0.03824, 0.03805, 0.0377, 0.03716, 0.03669, 0.03666, 0.0372, 0.03809, 0.03909, 0.04013, 0.04122, 0.04214, 0.04263, 0.04298, 0.0433, 0.04354, 0.0436, 0.04345, 0.04322, 0.04324, 0.04351, 0.04374, 0.04376, 0.04369, 0.04383, 0.04434, 0.04526, 0.04646, 0.0476, 0.04857, 0.04957, 0.05076, 0.05203, 0.0532, 0.05428, 0.05518, 0.05587, 0.05631, 0.05653, 0.05665, 0.05702, 0.05736, 0.05735, 0.05714, 0.05701, 0.05704, 0.0573, 0.05771, 0.05831, 0.05908, 0.06002, 0.0611, 0.06228, 0.06359, 0.06486, 0.06585, 0.06629, 0.06624, 0.06609, 0.06622, 0.06678, 0.06742, 0.06803, 0.0686, 0.06911, 0.0693, 0.06912, 0.06882, 0.06845, 0.06797, 0.06747, 0.06704, 0.0667, 0.06651, 0.06649, 0.06673, 0.06721, 0.06771, 0.06803, 0.0683, 0.06861, 0.06891, 0.06947, 0.07049, 0.07186, 0.07317, 0.07408, 0.07457, 0.07476, 0.07484, 0.07468, 0.07433, 0.074, 0.07383, 0.07391, 0.07407, 0.07408, 0.07403, 0.07385, 0.07351, 0.07316, 0.07286, 0.07284, 0.07347, 0.07446, 0.07528, 0.07589, 0.07657, 0.07707, 0.07715, 0.07718, 0.07738, 0.07766, 0.07789, 0.07832, 0.07923, 0.08042, 0.08142, 0.08199, 0.08217, 0.08222, 0.08231, 0.08236, 0.08231, 0.08238, 0.08251, 0.08263, 0.08292, 0.08348, 0.08421, 0.08503, 0.08586, 0.08668, 0.08752, 0.0884, 0.08916, 0.08973, 0.09003, 0.08996, 0.0896, 0.08913, 0.08858, 0.08801, 0.08755, 0.08731, 0.08747, 0.08811, 0.0889, 0.08956, 0.09011, 0.09057, 0.09093, 0.09148, 0.0923, 0.09327, 0.09408, 0.09454, 0.09463, 0.09485, 0.09539, 0.0962, 0.0974, 0.099, 0.10076, 0.10242, 0.10389, 0.10517, 0.10649, 0.10777, 0.10886, 0.10983, 0.11094, 0.11195, 0.11247, 0.11255, 0.1125, 0.11274, 0.11321, 0.11351, 0.11359, 0.11366, 0.11317, 0.1122, 0.11101, 0.10984, 0.10889, 0.10814, 0.10775, 0.10765, 0.10784, 0.1082, 0.10857, 0.10901, 0.10954, 0.11006, 0.11023, 0.11018, 0.10998, 0.10956, 0.10898, 0.10821, 0.1074, 0.10702, 0.10684, 0.10636, 0.10548, 0.10448, 0.10367, 0.10289, 0.10214, 0.10123, 0.10018, 0.09925, 0.0983, 0.09717, 0.09603, 0.09483, 0.09345, 0.09212, 0.09126, 0.09079, 0.09048, 0.0903, 0.08989, 0.08913, 0.08837, 0.08764, 0.08693, 0.08643, 0.08589, 0.08529, 0.0846, 0.08392, 0.08322, 0.08232, 0.08128, 0.07999, 0.07836, 0.07662, 0.07506, 0.0737, 0.07266, 0.07195, 0.07133, 0.07039, 0.0691, 0.06754, 0.06586, 0.06392, 0.06209, 0.06061, 0.05913, 0.05747, 0.0556, 0.05378, 0.05226, 0.0511, 0.05004, 0.04902, 0.04788, 0.04664, 0.04518, 0.04341, 0.04127, 0.039, 0.03666, 0.03424, 0.03188, 0.02981, 0.02777, 0.02514, 0.02211, 0.01925, 0.0169, 0.01516, 0.01369, 0.01225, 0.01065, 0.0088, 0.00689, 0.00539, 0.00419, 0.00297, 0.0017, 0.00065, -0.00061, -0.00231, -0.00421, -0.00581, -0.0073, -0.00921, -0.01113, -0.01306, -0.01465, -0.01613, -0.01762, -0.01905, -0.02048, -0.02175, -0.02294, -0.02432, -0.02619, -0.02826, -0.03035, -0.03222, -0.03399, -0.03569, -0.03743, -0.03911, -0.04058, -0.04199, -0.04331, -0.0443, -0.04555, -0.04693, -0.0483, -0.04925, -0.05002, -0.05123, -0.05235, -0.05376, -0.05516, -0.05645, -0.05769, -0.05919, -0.06072, -0.0622, -0.06369, -0.06506, -0.06596, -0.06626, -0.06648, -0.06748, -0.0691, -0.07124, -0.07314, -0.07472, -0.07564, -0.07589, -0.07582, -0.07584, -0.07612, -0.07656, -0.07708, -0.07772, -0.07845, -0.07914, -0.07938, -0.07956, -0.08007, -0.08062, -0.08086, -0.08095, -0.08127, -0.08177, -0.08231, -0.08275, -0.08334, -0.0837, -0.08382, -0.08364, -0.08274, -0.08144, -0.08018, -0.07908, -0.07813, -0.07783, -0.07817, -0.07868, -0.07865, -0.07839, -0.078, -0.07756, -0.07704, -0.07662, -0.0763, -0.07605, -0.07533, -0.07486, -0.07422, -0.07346, -0.0726, -0.07156, -0.07103, -0.07072, -0.07036, -0.07016, -0.07019, -0.0701, -0.06986, -0.06924, -0.06848, -0.06746, -0.06643, -0.06532, -0.06398, -0.0627, -0.06146, -0.0603, -0.05922, -0.0581, -0.05679, -0.05542, -0.05409, -0.05223, -0.05047, -0.04906, -0.0475, -0.04558, -0.04368, -0.04202, -0.04063, -0.03911, -0.03769, -0.03605, -0.03401, -0.03217, -0.03035, -0.02836, -0.0265, -0.02469, -0.02342, -0.02235, -0.0209, -0.01919, -0.01762, -0.0159, -0.01406, -0.01227, -0.01049, -0.00831, -0.00551, -0.00229, 0.00096, 0.00408, 0.00681, 0.0094, 0.012, 0.01421, 0.01616, 0.01729, 0.01851, 0.02035, 0.0226, 0.02451, 0.02629, 0.02881, 0.03103, 0.03337, 0.03558, 0.03803, 0.04093, 0.04389, 0.04642, 0.04869, 0.05099, 0.05357, 0.05634, 0.05915, 0.0617, 0.06462, 0.06733, 0.07029, 0.07334, 0.0764, 0.07928, 0.08181, 0.08419, 0.08637, 0.08859, 0.09067, 0.09272, 0.09475, 0.09698, 0.09916, 0.10165, 0.10438, 0.10669, 0.10846, 0.11042, 0.11298, 0.11589, 0.11856, 0.121, 0.12366, 0.12653, 0.12959, 0.13277, 0.13641, 0.13941, 0.14233, 0.14495, 0.14735, 0.14934, 0.15102, 0.15348, 0.1558, 0.15782, 0.15961, 0.16145, 0.16337, 0.16496, 0.16729, 0.16946, 0.17174, 0.17364, 0.17578, 0.17837, 0.18116, 0.18391, 0.18657, 0.18917, 0.19141, 0.19332, 0.19481, 0.19689, 0.19862, 0.2008, 0.20317, 0.20518, 0.20697, 0.20876, 0.21044, 0.21205, 0.21327, 0.21469, 0.21595, 0.21734, 0.21903, 0.22093, 0.22285, 0.22447, 0.22587, 0.22722, 0.22876, 0.23031, 0.2324, 0.2345, 0.23644, 0.23801, 0.23916, 0.24013, 0.24108, 0.24187, 0.24321, 0.24482, 0.24628, 0.24738, 0.2482, 0.24845, 0.24833, 0.24822, 0.24843, 0.24867, 0.24894, 0.24952, 0.25032, 0.25127, 0.25202, 0.25237, 0.253, 0.25374, 0.25397, 0.25376, 0.25422, 0.25424, 0.25392, 0.25353, 0.25272, 0.25182, 0.2517, 0.25195, 0.25152, 0.25099, 0.25043, 0.2495, 0.2485, 0.24805, 0.24791, 0.2479, 0.24765, 0.24713, 0.24632, 0.24531, 0.24419, 0.24363, 0.243, 0.24203, 0.24068, 0.23903, 0.23732, 0.23588, 0.23472, 0.23342, 0.23094, 0.22826, 0.22586, 0.22386, 0.22185, 0.21965, 0.21716, 0.21428, 0.2113, 0.20845, 0.206, 0.20367, 0.20104, 0.19873, 0.19594, 0.19343, 0.19099, 0.18881, 0.18621, 0.18386, 0.18122, 0.17869, 0.17648, 0.17437, 0.17243, 0.17044, 0.16833, 0.16609, 0.16329, 0.1603, 0.15708, 0.15393, 0.15081, 0.14746, 0.14462, 0.14182, 0.13948, 0.13718, 0.1348, 0.13195, 0.12881, 0.12558, 0.12247, 0.11883, 0.11514, 0.11171, 0.10832, 0.10457, 0.10121, 0.09784, 0.09452, 0.09144, 0.08854, 0.08542, 0.08238, 0.07886, 0.07538, 0.07181, 0.06863, 0.06544, 0.06171, 0.05794, 0.05477, 0.05202, 0.04898, 0.04599, 0.04305, 0.03985, 0.03604, 0.03193, 0.02746, 0.0231, 0.01936, 0.01596, 0.01284, 0.00978, 0.00663, 0.00313, -0.00062, -0.00454, -0.00858, -0.01276, -0.01646, -0.02005, -0.02358, -0.02701, -0.03035, -0.03348, -0.0363, -0.03971, -0.04299, -0.04663, -0.05041, -0.05392, -0.05686, -0.05956, -0.06163, -0.06346, -0.06547, -0.06778, -0.0698, -0.07146, -0.07334, -0.07532, -0.07774, -0.08045, -0.08262, -0.08453, -0.08659, -0.08895, -0.09166, -0.09443, -0.09741, -0.1006, -0.10361, -0.10609, -0.10815, -0.11018, -0.11262, -0.11531, -0.11846, -0.12168, -0.12453, -0.12736, -0.12942, -0.13174, -0.13455, -0.13779, -0.14099, -0.14384, -0.14666, -0.14995, -0.15261, -0.1553, -0.15771, -0.15998, -0.16198, -0.1639, -0.16585, -0.16784, -0.16922, -0.17032, -0.17133, -0.17208, -0.1726, -0.17302, -0.17356, -0.17456, -0.17531, -0.17598, -0.17665, -0.17701, -0.17749, -0.17833, -0.17909, -0.17952, -0.18001, -0.18067, -0.18181, -0.18265, -0.18303, -0.18312, -0.1826, -0.18228, -0.18173, -0.1813, -0.18066, -0.17979, -0.17923, -0.17875, -0.17841, -0.17817, -0.17771, -0.17711, -0.17657, -0.17546, -0.17499, -0.17431, -0.17359, -0.1726, -0.17238, -0.17071, -0.16887, -0.16747, -0.16642, -0.16556, -0.16421, -0.16327, -0.16228, -0.16101, -0.15984, -0.15794, -0.15606, -0.15432, -0.15334, -0.15246, -0.15142, -0.15008, -0.14848, -0.14681, -0.14524, -0.1439, -0.14201, -0.14023, -0.13846, -0.13656, -0.13409, -0.13107, -0.1284, -0.12597, -0.12347, -0.12077, -0.11853, -0.11665, -0.11439, -0.11159, -0.10871, -0.10553, -0.10229, -0.09923, -0.0969, -0.095, -0.0927, -0.09027, -0.08764, -0.08488, -0.08186, -0.07874, -0.07557, -0.07256, -0.06925, -0.06579, -0.06232, -0.05883, -0.05524, -0.05131, -0.048, -0.04502, -0.04171, -0.03823, -0.03451, -0.03078, -0.027, -0.02276, -0.01861, -0.01493, -0.01158, -0.00881, -0.00617, -0.00346, -0.00163, 0.00076, 0.00379, 0.00687, 0.00992, 0.0129, 0.01567, 0.0188, 0.02214, 0.02547, 0.0289, 0.03201, 0.03484, 0.03787, 0.04122, 0.04488, 0.04863, 0.05252, 0.05621, 0.0599, 0.06346, 0.06677, 0.06997, 0.07329, 0.07688, 0.08066, 0.08463, 0.08855, 0.09157, 0.09425, 0.09765, 0.10108, 0.10392, 0.10677, 0.10983, 0.11201, 0.11438, 0.11654, 0.11909, 0.12199, 0.12521, 0.12838, 0.13115, 0.13362, 0.13583, 0.13818, 0.14046, 0.14311, 0.1462, 0.14893, 0.15187, 0.15467, 0.15726, 0.15976, 0.16242, 0.16514, 0.16824, 0.17142, 0.17412, 0.17764, 0.18065, 0.18354, 0.18608, 0.18843, 0.19097, 0.19308, 0.19589, 0.19906, 0.20222, 0.20483, 0.2074, 0.21013, 0.21248, 0.21457, 0.21654, 0.21822, 0.21949, 0.22086, 0.2225, 0.22448, 0.22598, 0.22715, 0.22809, 0.22867, 0.22948, 0.22994, 0.23033, 0.23082, 0.23154, 0.23236, 0.23311, 0.23404, 0.23548, 0.23674, 0.23813, 0.23917, 0.2402, 0.24119, 0.24189, 0.24289, 0.24402, 0.2443, 0.24475, 0.2455, 0.24612, 0.24667, 0.24691, 0.24675, 0.24683, 0.2471, 0.24763, 0.24846, 0.24977, 0.2512, 0.25221, 0.25296, 0.25393, 0.25493, 0.25564, 0.25673, 0.25786, 0.25902, 0.25989, 0.26039, 0.2605, 0.26069, 0.26083, 0.26078, 0.26055, 0.26023, 0.25973, 0.25911, 0.25851, 0.2578, 0.25721, 0.2568, 0.25623, 0.25553, 0.25486, 0.25447, 0.25453, 0.25452, 0.2541, 0.25355, 0.25276, 0.25158, 0.25013, 0.24896, 0.24831, 0.24736, 0.24621, 0.24463, 0.24277, 0.24104, 0.23928, 0.23745, 0.23573, 0.2342, 0.23288, 0.23167, 0.23014, 0.228, 0.2253, 0.22232, 0.21944, 0.21675, 0.21437, 0.2121, 0.21046, 0.20877, 0.20678, 0.20475, 0.20268, 0.2006, 0.19844, 0.19657, 0.19466, 0.19246, 0.18986, 0.18732, 0.18496, 0.18253, 0.18004, 0.17794, 0.17553, 0.17313, 0.17092, 0.16849, 0.16586, 0.16339, 0.16119, 0.1584, 0.15453, 0.15025, 0.14661, 0.14315, 0.13989, 0.13656, 0.13296, 0.12948, 0.12583, 0.12228, 0.11873, 0.11538, 0.11156, 0.10746, 0.10355, 0.09987, 0.09637, 0.09246, 0.08899, 0.08474, 0.08061, 0.07666, 0.0728, 0.06921, 0.06587, 0.06294, 0.05997, 0.05631, 0.05299, 0.04974, 0.04627, 0.04267, 0.03903, 0.03565, 0.03239, 0.02946, 0.02628, 0.02315, 0.02042, 0.01771, 0.0146, 0.01111, 0.00758, 0.00419, 0.00098, -0.00218, -0.00519, -0.0084, -0.01235, -0.01672, -0.02088, -0.02426, -0.02709, -0.03009, -0.0329, -0.03652, -0.04013, -0.04417, -0.04808, -0.05162, -0.05455, -0.05695, -0.05914, -0.06158, -0.06425, -0.06675, -0.0691, -0.07164, -0.0742, -0.07649, -0.07874, -0.08113, -0.08342, -0.08558, -0.0885, -0.09152, -0.09453, -0.09754, -0.10067, -0.10349, -0.10591, -0.1086, -0.11106, -0.11323, -0.11526, -0.11728, -0.11899, -0.12032, -0.12168, -0.1228, -0.12429, -0.12604, -0.12767, -0.12887, -0.12994, -0.131, -0.13222, -0.13356, -0.13514, -0.13679, -0.13812, -0.13899, -0.13927, -0.13947, -0.13979, -0.14115, -0.14264, -0.14412, -0.14523, -0.14606, -0.14731, -0.14842, -0.14966, -0.1513, -0.15295, -0.15429, -0.15536, -0.15587, -0.15609, -0.15634, -0.1563, -0.15586, -0.15532, -0.15491, -0.15478, -0.15531, -0.15547, -0.15545, -0.15512, -0.15461, -0.15463, -0.15465, -0.15437, -0.15384, -0.15319, -0.15288, -0.15309, -0.15342, -0.15376, -0.15435, -0.15453, -0.15477, -0.15491, -0.15558, -0.15643, -0.15702, -0.15769, -0.15707, -0.15694, -0.15674, -0.15593, -0.15494, -0.15387, -0.15327, -0.15232, -0.15152, -0.15057, -0.14898, -0.14758, -0.14578, -0.14345, -0.14061, -0.13788, -0.13545, -0.13325, -0.13133, -0.12909, -0.12713, -0.12463, -0.12217, -0.11982, -0.11758, -0.11624, -0.11469, -0.11354, -0.11141, -0.1094, -0.10726, -0.10522, -0.10397, -0.10224, -0.10034, -0.09811, -0.09558, -0.09313, -0.09075, -0.0886, -0.08607, -0.08283, -0.08005, -0.07768, -0.07526, -0.07294, -0.07045, -0.06688, -0.06313, -0.05946, -0.05618, -0.05325, -0.0501, -0.04717, -0.04476, -0.04231, -0.03974, -0.03776, -0.03612, -0.03447, -0.03265, -0.03052, -0.02829, -0.02598, -0.02369, -0.02135, -0.01862, -0.01541, -0.0126, -0.00986, -0.007, -0.0041, -0.00105, 0.0023, 0.00584, 0.00926, 0.01243, 0.01558, 0.01842, 0.02123, 0.02431, 0.02772, 0.03143, 0.03492, 0.03813, 0.04134, 0.04474, 0.04828, 0.05167, 0.05514, 0.05856, 0.0621, 0.0658, 0.06974, 0.07405, 0.07855, 0.08289, 0.0877, 0.09196, 0.09589, 0.09977, 0.10356, 0.10722, 0.11093, 0.11472, 0.11862, 0.12262, 0.12669, 0.13047, 0.13382, 0.13681, 0.13988, 0.14308, 0.14641, 0.14962, 0.15302, 0.15665, 0.1604, 0.1639, 0.16745, 0.17054, 0.17312, 0.17562, 0.17822, 0.18096, 0.18344, 0.18631, 0.18929, 0.19197, 0.19431, 0.19713, 0.19992, 0.20248, 0.20469, 0.20681, 0.20898, 0.2113, 0.21382, 0.2165, 0.21911, 0.22139, 0.22307, 0.22475, 0.22645, 0.22815, 0.23014, 0.23213, 0.23406, 0.23588, 0.23771, 0.23949, 0.24132, 0.2431, 0.24457, 0.24601, 0.24754, 0.24913, 0.25068, 0.25226, 0.25378, 0.25493, 0.25595, 0.25696, 0.25825, 0.25921, 0.26015, 0.26117, 0.26214, 0.26334, 0.26443, 0.26525, 0.26552, 0.26553, 0.26539, 0.26511, 0.26518, 0.26505, 0.26491, 0.2647, 0.26451, 0.26461, 0.26452, 0.26423, 0.26422, 0.26423, 0.26414, 0.26403, 0.264, 0.2637, 0.26306, 0.26254, 0.26259, 0.26248, 0.26188, 0.26092, 0.26006, 0.25952, 0.25936, 0.25918, 0.25921, 0.25844, 0.25737, 0.25628, 0.25492, 0.25356, 0.25222, 0.25092, 0.24955, 0.24805, 0.24639, 0.24446, 0.24204, 0.23977, 0.23779, 0.23575, 0.23383, 0.23171, 0.22979, 0.22791, 0.22598, 0.22404, 0.22184, 0.22025, 0.21937, 0.21859, 0.21807, 0.21704, 0.21553, 0.21373, 0.21241, 0.21096, 0.2092, 0.20719, 0.20503, 0.20268, 0.20031, 0.19807, 0.19625, 0.19456, 0.19266, 0.19019, 0.1872, 0.18447, 0.18211, 0.17991, 0.17736, 0.17513, 0.17281, 0.1703, 0.16724, 0.16441, 0.16188, 0.15931, 0.1566, 0.15341, 0.14983, 0.14516, 0.14126, 0.13785, 0.13433, 0.13032, 0.12642, 0.12326, 0.12008, 0.11699, 0.11397, 0.11133, 0.10847, 0.10542, 0.10249, 0.09988, 0.09672, 0.09325, 0.08973, 0.08641, 0.08346, 0.08053, 0.07752, 0.07445, 0.07139, 0.06887, 0.0663, 0.06345, 0.06046, 0.05658, 0.0526, 0.04891, 0.04582, 0.04289, 0.03984, 0.03704, 0.03403, 0.03124, 0.02884, 0.02664, 0.0242, 0.02149, 0.01879, 0.01585, 0.0129, 0.01008, 0.00758, 0.00535, 0.00303, 0.00109, -0.00117, -0.0033, -0.00538, -0.00762, -0.01022, -0.01323, -0.0162, -0.01867, -0.02114, -0.02418, -0.02629, -0.02793, -0.02917, -0.03022, -0.03167, -0.03352, -0.036, -0.03896, -0.04205, -0.04504, -0.04776, -0.05126, -0.05419, -0.05673, -0.05883, -0.06069, -0.06259, -0.06488, -0.06776, -0.07077, -0.07386, -0.07681, -0.0795, -0.08157, -0.08288, -0.08438, -0.08662, -0.09007, -0.09307, -0.0957, -0.09796, -0.0998, -0.10136, -0.10251, -0.1043, -0.10593, -0.1084, -0.1105, -0.11216, -0.11404, -0.11535, -0.11761, -0.11897, -0.12033, -0.12161, -0.12212, -0.12305, -0.12378, -0.12446, -0.12521, -0.12602, -0.12692, -0.12815, -0.12918, -0.13004, -0.13132, -0.13169, -0.13187, -0.13197, -0.13176, -0.13212, -0.13288, -0.13416, -0.13558, -0.13694, -0.13797, -0.13866, -0.13954, -0.14024, -0.14081, -0.14086, -0.14099, -0.1412, -0.14072, -0.14016, -0.13997, -0.13974, -0.13923, -0.13878, -0.13891, -0.13909, -0.13914, -0.13856, -0.13767, -0.13594, -0.13473, -0.13354, -0.13255, -0.13301, -0.13312, -0.13295, -0.13276, -0.13209, -0.13059, -0.12837, -0.12676, -0.12508, -0.12371, -0.1215, -0.11976, -0.1185, -0.11706, -0.11592, -0.115, -0.114, -0.11255, -0.11116, -0.10969, -0.10798, -0.10607, -0.10409, -0.10243, -0.10128, -0.10067, -0.10022, -0.09965, -0.09889, -0.0979, -0.09634, -0.09522, -0.09428, -0.09326, -0.09174, -0.09095, -0.09015, -0.08952, -0.08832, -0.08716, -0.08565, -0.08387, -0.0818, -0.07998, -0.07762, -0.07586, -0.07454, -0.07339, -0.0718, -0.07004, -0.06841, -0.06691, -0.06494, -0.06281, -0.06044, -0.0579, -0.05495, -0.05151, -0.04835, -0.04516, -0.04192, -0.03859, -0.03503, -0.03193, -0.02861, -0.02519, -0.02201, -0.0192, -0.01628, -0.0131, -0.01038, -0.00758, -0.0046, -0.00193, 0.0004, 0.00267, 0.00504, 0.00743, 0.00961, 0.01204, 0.01528, 0.01823, 0.02136, 0.02409, 0.02626, 0.02814, 0.0302, 0.0327, 0.03567, 0.03866, 0.04151, 0.04394, 0.04694, 0.04995, 0.05302, 0.05605, 0.05903, 0.06141, 0.06396, 0.06642, 0.0683, 0.07036, 0.07278, 0.07551, 0.07833, 0.08107, 0.0839, 0.08629, 0.08889, 0.0917, 0.09471, 0.0973, 0.09978, 0.10268, 0.10571, 0.10872, 0.1116, 0.11452, 0.11733, 0.11968, 0.12194, 0.12406, 0.12639, 0.12831, 0.13012, 0.13232, 0.13433, 0.13612, 0.13848, 0.14101, 0.14375, 0.14676, 0.14957, 0.15219, 0.1548, 0.15676, 0.1593, 0.1616, 0.16366, 0.16536, 0.16761, 0.16943, 0.17175, 0.17394, 0.17608, 0.17804, 0.17969, 0.18095, 0.18227, 0.18347, 0.18504, 0.18642, 0.1879, 0.18981, 0.19161, 0.19344, 0.19489, 0.19554, 0.19582, 0.19628, 0.19709, 0.1978, 0.19807, 0.19821, 0.19897, 0.19985, 0.20064, 0.20133, 0.20185, 0.2026, 0.20321, 0.20345, 0.20342, 0.20323, 0.2033, 0.20356, 0.20381, 0.20436, 0.20529, 0.20576, 0.20598, 0.20595, 0.2059, 0.20598, 0.20597, 0.2059, 0.20547, 0.2051, 0.20533, 0.20587, 0.20664, 0.20715, 0.20717, 0.20701, 0.20733, 0.20813, 0.2082, 0.20803, 0.20783, 0.2078, 0.20793, 0.20803, 0.20797, 0.20803, 0.20794, 0.20773, 0.20798, 0.20789, 0.20765, 0.20751, 0.20713, 0.2069, 0.20668, 0.20603, 0.20556, 0.20504, 0.20428, 0.20304, 0.20177, 0.20059, 0.19984, 0.19947, 0.19914, 0.19845, 0.19738, 0.19591, 0.19409, 0.1922, 0.19046, 0.18881, 0.18741, 0.18613, 0.18429, 0.18188, 0.18022, 0.17842, 0.17654, 0.17484, 0.17318, 0.17173, 0.17029, 0.16931, 0.16857, 0.16743, 0.16588, 0.16445, 0.16294, 0.16145, 0.15981, 0.15816, 0.15627, 0.15464, 0.15273, 0.15102, 0.14998, 0.1491, 0.14868, 0.14863, 0.14822, 0.14795, 0.14679, 0.14508, 0.14341, 0.14181, 0.13976, 0.13738, 0.13517, 0.13356, 0.13184, 0.13004, 0.12858, 0.12726, 0.12579, 0.12411, 0.12159, 0.11926, 0.11702, 0.11465, 0.1123, 0.11001, 0.1076, 0.1054, 0.10302, 0.10056, 0.09754, 0.09462, 0.09194, 0.0892, 0.08651, 0.08365, 0.0815, 0.07883, 0.07601, 0.0731, 0.06985, 0.06679, 0.06407, 0.06154, 0.05926, 0.05716, 0.05466, 0.05173, 0.0485, 0.04535, 0.04265, 0.0401, 0.03772, 0.03546, 0.03329, 0.03153, 0.03016, 0.02918, 0.02767, 0.02584, 0.02409, 0.0218, 0.01936, 0.01701, 0.0151, 0.01276, 0.01058, 0.00875, 0.00676, 0.0046, 0.00217, 0.00032, -0.00141, -0.00266, -0.00378, -0.00554, -0.00695, -0.00808, -0.00901, -0.00985, -0.01076, -0.0118, -0.01338, -0.01533, -0.01666, -0.01784, -0.01927, -0.02089, -0.02254, -0.02479, -0.02696, -0.02894, -0.03078, -0.03236, -0.03353, -0.03435, -0.03507, -0.03552, -0.03666, -0.03851, -0.04064, -0.04257, -0.04409, -0.04542, -0.04614, -0.04678, -0.04786, -0.04938, -0.05097, -0.05241, -0.05386, -0.05497, -0.05581, -0.05683, -0.05775, -0.05842, -0.05881, -0.05885, -0.05849, -0.05784, -0.05731, -0.05727, -0.05792, -0.05905, -0.06004, -0.06064, -0.06082, -0.06078, -0.06067, -0.06073, -0.06078, -0.06138, -0.06209, -0.06305, -0.06452, -0.06579, -0.06676, -0.06748, -0.06833, -0.06927, -0.07004, -0.07064, -0.07102, -0.07127, -0.07142, -0.07133, -0.07043, -0.06902, -0.06806, -0.06717, -0.06602, -0.06458, -0.06294, -0.0616, -0.06046, -0.05998, -0.05959, -0.05915, -0.05857, -0.05822, -0.05764, -0.0567, -0.05554, -0.05441, -0.05334, -0.05254, -0.05206, -0.05144, -0.05057, -0.04954, -0.04834, -0.04719, -0.04625, -0.04577, -0.04514, -0.04449, -0.0438, -0.04285, -0.04161, -0.04043, -0.03994, -0.03992, -0.04004, -0.03941, -0.03852, -0.03752, -0.03621, -0.03445, -0.0328, -0.03133, -0.02991, -0.02863, -0.02765, -0.02663, -0.02563, -0.02441, -0.02306, -0.02171, -0.02052, -0.01974, -0.01916, -0.01837, -0.01697, -0.01545, -0.01402, -0.01299, -0.01212, -0.01128, -0.01033, -0.00934, -0.00819, -0.00645, -0.00456, -0.0029, -0.00122, 0.00079, 0.00295, 0.00483, 0.00664, 0.00869, 0.01109, 0.01381, 0.01625, 0.01829, 0.02002, 0.02158, 0.02281, 0.02386, 0.02488, 0.02604, 0.02721, 0.02844, 0.02985, 0.03132, 0.03274, 0.03425, 0.03561, 0.03699, 0.03825, 0.03944, 0.04058, 0.04145, 0.04193, 0.04192, 0.04201, 0.0421, 0.04232, 0.0428, 0.0436, 0.04469, 0.046, 0.04724, 0.0485, 0.04941, 0.05009, 0.05046, 0.05039, 0.05015, 0.05018, 0.05091, 0.0519, 0.05255, 0.05265, 0.05266, 0.0531, 0.05364, 0.05438, 0.05535, 0.05624, 0.05678, 0.05711, 0.05783, 0.05856, 0.05876, 0.05871, 0.05863, 0.05898, 0.0599, 0.06089, 0.06214, 0.06325, 0.06398, 0.06451, 0.06497, 0.06514, 0.0653, 0.06572, 0.06628, 0.06697, 0.06795, 0.06922, 0.07051, 0.07089, 0.07099, 0.07101, 0.07101, 0.07093, 0.07089, 0.07088, 0.07056, 0.07011, 0.06982, 0.06951, 0.06945, 0.07013, 0.07115, 0.07228, 0.0729, 0.07306, 0.07306, 0.07291, 0.07267, 0.07255, 0.07244, 0.07221, 0.07152, 0.07082, 0.07001, 0.06925, 0.06913, 0.06949, 0.06975, 0.06921, 0.06886, 0.068, 0.06686, 0.06591, 0.0652, 0.06534, 0.0661, 0.06696, 0.06769, 0.06839, 0.0688, 0.06908, 0.06892, 0.06846, 0.06775, 0.06697, 0.06635, 0.0662, 0.06609, 0.06615, 0.06594, 0.06529, 0.06427, 0.06342, 0.06316, 0.0634, 0.06417, 0.06467, 0.06498, 0.06507, 0.06472, 0.06396, 0.06277, 0.06225, 0.06191, 0.06128, 0.06055, 0.05945, 0.05815, 0.05694, 0.0559, 0.0548, 0.05371, 0.05264, 0.0517, 0.05087, 0.05016, 0.04957, 0.0494, 0.04949, 0.04944, 0.0494, 0.04955, 0.04916, 0.04867, 0.04849, 0.04861, 0.04914, 0.04987, 0.05034, 0.05053, 0.05062, 0.05047, 0.05018, 0.05011, 0.05017, 0.05032, 0.05011, 0.05013, 0.05024, 0.05064, 0.05107, 0.0514, 0.05155, 0.05131, 0.05071, 0.05022, 0.05004, 0.05031, 0.05083, 0.05113, 0.05149, 0.05258, 0.05382, 0.05501, 0.05628, 0.05728, 0.05809, 0.05897, 0.06025, 0.06212, 0.06411, 0.06577, 0.06678, 0.0675, 0.06743, 0.06762, 0.06798, 0.06888, 0.07013, 0.07128, 0.07198, 0.07238, 0.07347, 0.07487, 0.0768, 0.07863, 0.07985, 0.08068, 0.08114, 0.08099, 0.0806, 0.08031, 0.08057, 0.08118, 0.08228, 0.0835, 0.08543, 0.08803, 0.08974, 0.09125, 0.09259, 0.09389, 0.095, 0.09614, 0.0973, 0.09794, 0.09856, 0.09916, 0.10006, 0.10074, 0.10129, 0.10202, 0.10262, 0.10324, 0.10358, 0.10403, 0.10437, 0.1044, 0.10426, 0.104, 0.10421, 0.10432, 0.10404, 0.10347, 0.10335, 0.10312, 0.10244, 0.10185, 0.10183, 0.10196, 0.10211, 0.10279, 0.10365, 0.10428, 0.10497, 0.10552, 0.10606, 0.10623, 0.10655, 0.10736, 0.10841, 0.10934, 0.10971, 0.10982, 0.1098, 0.10962, 0.10908, 0.10869, 0.10851, 0.10823, 0.10803, 0.10762, 0.10745, 0.10734, 0.10776, 0.10849, 0.10961, 0.11063, 0.111, 0.11112, 0.11132, 0.11152, 0.11184, 0.11222, 0.11297, 0.11353, 0.11435, 0.1152, 0.11593, 0.11709, 0.11832, 0.11928, 0.11998, 0.1205, 0.12112, 0.1216, 0.12217, 0.12251, 0.1225, 0.12272, 0.12306, 0.12337, 0.12336, 0.12353, 0.12384, 0.12453, 0.1251, 0.12568, 0.12597, 0.12615, 0.12631, 0.12636, 0.12636, 0.12594, 0.1255, 0.12497, 0.12482, 0.12518, 0.12564, 0.12595, 0.1263, 0.12665, 0.12753, 0.12837, 0.1288, 0.1289, 0.12885, 0.12883, 0.12872, 0.12845, 0.1281, 0.12758, 0.12687, 0.12624, 0.12595, 0.12554, 0.12448, 0.12349, 0.12271, 0.12214, 0.12159, 0.12121, 0.12081, 0.12004, 0.11943, 0.11876, 0.118, 0.11733, 0.11695, 0.11654, 0.11619, 0.116, 0.11512, 0.11381, 0.11259, 0.11135, 0.1103, 0.10932, 0.10883, 0.10855, 0.10839, 0.10846, 0.10841, 0.10784, 0.10687, 0.10601, 0.10518, 0.10441, 0.10345, 0.10211, 0.10073, 0.09942, 0.09809, 0.0966, 0.09515, 0.09403, 0.09293, 0.09169, 0.0905, 0.08965, 0.08851, 0.08713, 0.0858, 0.08457, 0.08342, 0.08242, 0.08128, 0.07978, 0.07829, 0.0773, 0.0768, 0.07616, 0.07508, 0.0738, 0.07242, 0.07083, 0.06913, 0.06735, 0.06587, 0.06463, 0.06333, 0.06186, 0.06027, 0.05855, 0.05647, 0.05422, 0.05171, 0.04926, 0.0471, 0.04508, 0.04334, 0.04167, 0.03979, 0.0374, 0.03504, 0.03265, 0.03039, 0.02835, 0.02703, 0.02611, 0.02524, 0.02435, 0.02352, 0.02228, 0.02044, 0.01825, 0.01568, 0.01316, 0.01127, 0.00984, 0.00848, 0.00719, 0.00619, 0.00522, 0.00421, 0.00349, 0.00295, 0.00219, 0.00104, -0.00055, -0.00184, -0.0025, -0.00291, -0.00316, -0.00338, -0.0038, -0.00415, -0.00431, -0.00456, -0.00512, -0.00583, -0.00655, -0.00735, -0.00887, -0.01062, -0.01243, -0.01389, -0.01488, -0.0158, -0.01685, -0.01778, -0.01862, -0.01978, -0.02125, -0.02272, -0.02422, -0.02569, -0.02687, -0.02814, -0.02967, -0.03129, -0.03294, -0.03453, -0.03583, -0.0367, -0.03746, -0.0382, -0.03856, -0.03862, -0.03868, -0.03889, -0.03933, -0.0403, -0.04152, -0.04256, -0.04343, -0.04422, -0.04492, -0.04563, -0.04667, -0.04799, -0.04896, -0.04962, -0.05013, -0.05056, -0.05115, -0.05199, -0.05258, -0.05261, -0.05209, -0.05135, -0.05078, -0.05047, -0.05026, -0.04986, -0.04954, -0.04942, -0.04947, -0.04999, -0.05132, -0.05295, -0.05453, -0.05592, -0.05675, -0.0572, -0.05758, -0.05813, -0.05897, -0.05916, -0.05872, -0.05838, -0.05799, -0.0574, -0.05698, -0.05652, -0.056, -0.05573, -0.05561, -0.05536, -0.05505, -0.05484, -0.05472, -0.05443, -0.05376, -0.05293, -0.0519, -0.05091, -0.05027, -0.04984, -0.04918, -0.04773, -0.04574, -0.04357, -0.04129, -0.03959, -0.03857, -0.03781, -0.03692, -0.03603, -0.03501, -0.0338, -0.03268, -0.03155, -0.0309, -0.03035, -0.02957, -0.02864, -0.02779, -0.02699, -0.0256, -0.02356, -0.02133, -0.01925, -0.01752, -0.01595, -0.0147, -0.01383, -0.01317, -0.01282, -0.01235, -0.01169, -0.01117, -0.01069, -0.00991, -0.00907, -0.00818, -0.00731, -0.00648, -0.00584, -0.00533, -0.00446, -0.00289, -0.00092, 0.0012, 0.00327, 0.00505, 0.0063, 0.00694, 0.0074, 0.0083, 0.00952, 0.01064, 0.01171, 0.01343, 0.01571, 0.01814, 0.02037, 0.02266, 0.02521, 0.02795, 0.03067, 0.03318, 0.03573, 0.03811, 0.04005, 0.04143, 0.0426, 0.04406, 0.04551, 0.04704, 0.0487, 0.0504, 0.05224, 0.05427, 0.05637, 0.05815, 0.05973, 0.0613, 0.0626, 0.06383, 0.06528, 0.06685, 0.06885, 0.07093, 0.0731, 0.07517, 0.07719, 0.0791, 0.0809, 0.08275, 0.08506, 0.0874, 0.08958, 0.09165, 0.09361, 0.09545, 0.09746, 0.09955, 0.10157, 0.10385, 0.10651, 0.10944, 0.11228, 0.11486, 0.11708, 0.11916, 0.12089, 0.12248, 0.12433, 0.12667, 0.12901, 0.13143, 0.13367, 0.13551, 0.13714, 0.13883, 0.14081, 0.1434, 0.14636, 0.14912, 0.15156, 0.1539, 0.1564, 0.1587, 0.16059, 0.16233, 0.16443, 0.16675, 0.16913, 0.17136, 0.17333, 0.17505, 0.17664, 0.17837, 0.18031, 0.18249, 0.18485, 0.18714, 0.18939, 0.19158, 0.19362, 0.1957, 0.19803, 0.20076, 0.20331, 0.20524, 0.20677, 0.20792, 0.20864, 0.20914, 0.20981, 0.21072, 0.21182, 0.21318, 0.21435, 0.21517, 0.21584, 0.21673, 0.21764, 0.21851, 0.21952, 0.22078, 0.22203, 0.22324, 0.22452, 0.22591, 0.22707, 0.22784, 0.22853, 0.22914, 0.22972, 0.23013, 0.23022, 0.23025, 0.2301, 0.22922, 0.22855, 0.22811, 0.22764, 0.22704, 0.22661, 0.22635, 0.22597, 0.2253, 0.22414, 0.22291, 0.22139, 0.21967, 0.21812, 0.21726, 0.21692, 0.21668, 0.21623, 0.21543, 0.21416, 0.21271, 0.21159, 0.21084, 0.21043, 0.21026, 0.20961, 0.20835, 0.2066, 0.20475, 0.20303, 0.2018, 0.20091, 0.2001, 0.19937, 0.19874, 0.19788, 0.19672, 0.19536, 0.19405, 0.1926, 0.19061, 0.18858, 0.18688, 0.18558, 0.18435, 0.1828, 0.18115, 0.17926, 0.17734, 0.17511, 0.17238, 0.16966, 0.16725, 0.16519, 0.16312, 0.16049, 0.15765, 0.15474, 0.15177, 0.14906, 0.14656, 0.14406, 0.14153, 0.13871, 0.13614, 0.1336, 0.13062, 0.12755, 0.12455, 0.12158, 0.11863, 0.11571, 0.11283, 0.10981, 0.10665, 0.10333, 0.10026, 0.09755, 0.09488, 0.09204, 0.08896, 0.08587, 0.08297, 0.07994, 0.07664, 0.07346, 0.07078, 0.06859, 0.06642, 0.06415, 0.06154, 0.05889, 0.05621, 0.05346, 0.05068, 0.04769, 0.04485, 0.04231, 0.04032, 0.03825, 0.03595, 0.03407, 0.03228, 0.03021, 0.0279, 0.0253, 0.02278, 0.02, 0.01693, 0.0141, 0.01109, 0.0079, 0.00459, 0.0014, -0.00153, -0.00418, -0.0069, -0.00944, -0.0119, -0.01487, -0.01811, -0.02081, -0.02304, -0.02527, -0.02724, -0.02871, -0.02959, -0.03066, -0.03202, -0.03401, -0.03671, -0.03974, -0.04233, -0.04454, -0.04624, -0.04767, -0.04914, -0.05028, -0.0516, -0.05318, -0.05465, -0.05615, -0.05755, -0.05893, -0.06003, -0.06099, -0.06191, -0.06276, -0.06384, -0.06529, -0.06732, -0.0695, -0.0713, -0.07304, -0.07465, -0.07646, -0.07855, -0.08046, -0.08188, -0.08329, -0.08547, -0.0879, -0.09027, -0.09257, -0.09441, -0.09602, -0.09765, -0.09958, -0.10158, -0.10338, -0.105, -0.10683, -0.10884, -0.11049, -0.1121, -0.11395, -0.11503, -0.11512, -0.11506, -0.11545, -0.11589, -0.11663, -0.11743, -0.11782, -0.11799, -0.11852, -0.11914, -0.11963, -0.11961, -0.11955, -0.11986, -0.1205, -0.12083, -0.12131, -0.12203, -0.12295, -0.12348, -0.124, -0.12476, -0.12557, -0.12606, -0.12576, -0.12537, -0.12528, -0.12573, -0.12643, -0.12691, -0.12723, -0.12742, -0.12734, -0.12744, -0.12722, -0.12685, -0.12637, -0.1254, -0.12418, -0.1228, -0.12136, -0.12011, -0.11909, -0.11814, -0.11698, -0.11574, -0.11471, -0.1134, -0.11195, -0.11066, -0.10934, -0.10801, -0.10652, -0.1049, -0.10299, -0.1009, -0.09858, -0.09632, -0.09408, -0.09143, -0.0889, -0.08613, -0.08335, -0.08074, -0.07845, -0.07625, -0.0741, -0.07222, -0.07061, -0.06871, -0.06656, -0.0645, -0.06196, -0.05894, -0.05611, -0.05359, -0.05087, -0.04792, -0.04509, -0.04296, -0.04108, -0.0389, -0.03661, -0.03418, -0.03162, -0.02905, -0.02649, -0.02364, -0.02036, -0.01697, -0.01375, -0.01094, -0.0083, -0.00568, -0.00311, 2e-05, 0.00304, 0.0062, 0.00957, 0.0128, 0.01597, 0.01895, 0.02173, 0.02441, 0.02707, 0.03001, 0.03355, 0.03685, 0.03972, 0.04246, 0.04482, 0.04731, 0.04999, 0.05285, 0.05637, 0.06022, 0.06425, 0.06792, 0.07142, 0.0746, 0.07759, 0.08095, 0.08428, 0.08834, 0.09217, 0.09612, 0.10001, 0.10379, 0.10753, 0.11124, 0.11446, 0.11732, 0.11996, 0.12263, 0.12563, 0.12905, 0.1328, 0.13644, 0.13989, 0.14324, 0.1466, 0.15007, 0.15376, 0.15708, 0.16059, 0.16388, 0.16679, 0.16958, 0.17243, 0.17518, 0.1778, 0.18038, 0.18363, 0.18701, 0.19024, 0.19359, 0.19646, 0.19944, 0.20193, 0.2042, 0.20655, 0.20875, 0.21131, 0.21357, 0.21621, 0.21883, 0.22173, 0.22466, 0.22722, 0.22985, 0.23185, 0.2342, 0.23649, 0.23882, 0.24121, 0.24336, 0.24531, 0.24788, 0.25058, 0.25295, 0.25498, 0.25721, 0.25961, 0.26231, 0.26506, 0.26779, 0.27022, 0.27284, 0.27499, 0.27673, 0.27834, 0.27941, 0.28023, 0.28102, 0.28227, 0.28368, 0.28526, 0.28698, 0.28857, 0.28993, 0.29089, 0.29139, 0.29194, 0.29239, 0.29275, 0.293, 0.29304, 0.29298, 0.29355, 0.29416, 0.29444, 0.29479, 0.29536, 0.29613, 0.29706, 0.29807, 0.29856, 0.2982, 0.29786, 0.29804, 0.29824, 0.29824, 0.29848, 0.29862, 0.2987, 0.29892, 0.2992, 0.299, 0.2987, 0.29827, 0.29789, 0.29757, 0.29725, 0.29692, 0.2965, 0.29577, 0.29448, 0.29285, 0.29143, 0.29074, 0.28931, 0.2879, 0.28589, 0.28419, 0.28221, 0.28018, 0.27838, 0.27652, 0.27475, 0.27305, 0.27132, 0.2698, 0.26827, 0.26647, 0.26459, 0.26243, 0.25989, 0.25686, 0.25434, 0.25209, 0.24968, 0.24719, 0.24483, 0.24236, 0.23965, 0.2371, 0.23479, 0.23249, 0.22974, 0.22704, 0.22448, 0.22161, 0.21891, 0.21621, 0.21374, 0.21125, 0.20839, 0.20506, 0.20119, 0.1978, 0.19524, 0.19336, 0.19112, 0.18845, 0.18575, 0.18256, 0.17946, 0.17644, 0.17337, 0.16975, 0.16653, 0.16385, 0.16087, 0.15769, 0.15404, 0.15038, 0.14667, 0.14254, 0.13848, 0.13447, 0.13087, 0.12696, 0.12329, 0.1206, 0.1185, 0.11703, 0.11536, 0.11335, 0.11092, 0.10771, 0.10445, 0.10124, 0.0983, 0.09512, 0.09168, 0.08823, 0.08461, 0.08044, 0.076, 0.07185, 0.06808, 0.06462, 0.06152, 0.05908, 0.05659, 0.05367, 0.0504, 0.04729, 0.04478, 0.04276, 0.04005, 0.03689, 0.03365, 0.03052, 0.0275, 0.02444, 0.0212, 0.01794, 0.01449, 0.01079, 0.00673, 0.00282, -0.00107, -0.00529, -0.00967, -0.01338, -0.01704, -0.0204, -0.02323, -0.02576, -0.02908, -0.03331, -0.03754, -0.04171, -0.04586, -0.04958, -0.05309, -0.05651, -0.05945, -0.06242, -0.06534, -0.06817, -0.07074, -0.07323, -0.07571, -0.0783, -0.08109, -0.08443, -0.08753, -0.09004, -0.09163, -0.09317, -0.0944, -0.09599, -0.09805, -0.1003, -0.10284, -0.10545, -0.10744, -0.10836, -0.10904, -0.11004, -0.11171, -0.11377, -0.11593, -0.11807, -0.11968, -0.12056, -0.1214, -0.12227, -0.12371, -0.12524, -0.12684, -0.12861, -0.13055, -0.1323, -0.13331, -0.13378, -0.13412, -0.13379, -0.13315, -0.13358, -0.13349, -0.1337, -0.13395, -0.1344, -0.13475, -0.13485, -0.13418, -0.13373, -0.13338, -0.13317, -0.13298, -0.1328, -0.13249, -0.13221, -0.13199, -0.13162, -0.13094, -0.13029, -0.12948, -0.12853, -0.12772, -0.12731, -0.1268, -0.12602, -0.12487, -0.12351, -0.12198, -0.12095, -0.11991, -0.11918, -0.11849, -0.11809, -0.11841, -0.11887, -0.11882, -0.11778, -0.11659, -0.11512, -0.11326, -0.11077, -0.10848, -0.10686, -0.10534, -0.10375, -0.1023, -0.10067, -0.09863, -0.09647, -0.0942, -0.09137, -0.08895, -0.08686, -0.08485, -0.08265, -0.0807, -0.07862, -0.07695, -0.07595, -0.07498, -0.07373, -0.07198, -0.06976, -0.06762, -0.06534, -0.06233, -0.05957, -0.05672, -0.05392, -0.05157, -0.04891, -0.04581, -0.04274, -0.03968, -0.03662, -0.03367, -0.03117, -0.02849, -0.02581, -0.02312, -0.02013, -0.01664, -0.01297, -0.00947, -0.00595, -0.00262, 0.00061, 0.00364, 0.00707, 0.01075, 0.01382, 0.01657, 0.0193, 0.02181, 0.02454, 0.02783, 0.03152, 0.03548, 0.0395, 0.04376, 0.04815, 0.05175, 0.05525, 0.05862, 0.06168, 0.06435, 0.06758, 0.07104, 0.07472, 0.07852, 0.08219, 0.08563, 0.08855, 0.09122, 0.09408, 0.09721, 0.1003, 0.10311, 0.10599, 0.10919, 0.11244, 0.11534, 0.11805, 0.12082, 0.1237, 0.12682, 0.13043, 0.13431, 0.13847, 0.14248, 0.14601, 0.14914, 0.15219, 0.15481, 0.15729, 0.15985, 0.16279, 0.16587, 0.16902, 0.17185, 0.17558, 0.17923, 0.18261, 0.18593, 0.18885, 0.1919, 0.19498, 0.19787, 0.20068, 0.20313, 0.20542, 0.20785, 0.21057, 0.21327, 0.21558, 0.21755, 0.21958, 0.22175, 0.22395, 0.22591, 0.22807, 0.22997, 0.23204, 0.23424, 0.23632, 0.23838, 0.24041, 0.24238, 0.24451, 0.24664, 0.24857, 0.24993, 0.25149, 0.25285, 0.25401, 0.25499, 0.25621, 0.2581, 0.25967, 0.26089, 0.26188, 0.26322, 0.26419, 0.26537, 0.26642, 0.26759, 0.26884, 0.26988, 0.27035, 0.27091, 0.27147, 0.27221, 0.27269, 0.27279, 0.27251, 0.27231, 0.2722, 0.27181, 0.27166, 0.27155, 0.27197, 0.27248, 0.27325, 0.27418, 0.27515, 0.2757, 0.2755, 0.27492, 0.27408, 0.27351, 0.27272, 0.27205, 0.27115, 0.27026, 0.26914, 0.26833, 0.26733, 0.26661, 0.26563, 0.26505, 0.26464, 0.26421, 0.26368, 0.26325, 0.26239, 0.26192, 0.26204, 0.26175, 0.26111, 0.26012, 0.25882, 0.25714, 0.25499, 0.2536, 0.25272, 0.25189, 0.25095, 0.24995, 0.24906, 0.24801, 0.2473, 0.24607, 0.2448, 0.24396, 0.24283, 0.24187, 0.24065, 0.23944, 0.23761, 0.23568, 0.23455, 0.23439, 0.23397, 0.23329, 0.23196, 0.22971, 0.22719, 0.22492, 0.22292, 0.22057, 0.2181, 0.2157, 0.21287, 0.20965, 0.20628, 0.20308, 0.20062, 0.19788, 0.19559, 0.19361, 0.19149, 0.18965, 0.18789, 0.1858, 0.18359, 0.18091, 0.17799, 0.175, 0.17217, 0.16871, 0.16522, 0.16183, 0.15897, 0.15663, 0.15444, 0.15219, 0.14965, 0.14728, 0.14505, 0.14259, 0.1403, 0.13833, 0.13614, 0.13323, 0.13045, 0.12801, 0.12552, 0.12334, 0.12175, 0.12001, 0.11817, 0.11601, 0.11387, 0.11206, 0.11039, 0.10865, 0.10678, 0.10489, 0.10282, 0.10071, 0.0987, 0.09664, 0.09469, 0.09277, 0.09045, 0.08764, 0.08429, 0.08135, 0.07788, 0.07422, 0.07057, 0.06759, 0.06491, 0.06215, 0.05911, 0.05584, 0.0524, 0.04886, 0.04501, 0.04099, 0.03708, 0.03351, 0.03066, 0.02811, 0.02561, 0.02291, 0.02071, 0.01886, 0.01784, 0.01636, 0.01413, 0.01151, 0.00872, 0.006, 0.00332, 0.00088, -0.00108, -0.00291, -0.00478, -0.00646, -0.00833, -0.01078, -0.01356, -0.01595, -0.01786, -0.01956, -0.02118, -0.02256, -0.02346, -0.0242, -0.02514, -0.02635, -0.0275, -0.02836, -0.02923, -0.03042, -0.0315, -0.03261, -0.03398, -0.03508, -0.03591, -0.03698, -0.03821, -0.03907, -0.03997, -0.04132, -0.04299, -0.04485, -0.04616, -0.04712, -0.048, -0.04875, -0.04968, -0.05084, -0.05185, -0.05257, -0.05323, -0.05391, -0.05441, -0.0545, -0.05448, -0.0547, -0.05518, -0.05602, -0.05696, -0.05767, -0.05826, -0.05894, -0.05994, -0.06075, -0.06115, -0.06157, -0.06216, -0.06294, -0.06419, -0.06581, -0.06711, -0.06783, -0.06821, -0.06844, -0.06834, -0.06815, -0.06805, -0.06846, -0.06884, -0.06893, -0.06905, -0.06919, -0.06902, -0.06884, -0.06892, -0.06936, -0.06994, -0.07033, -0.07076, -0.07106, -0.07083, -0.07081, -0.07105, -0.07112, -0.07084, -0.07031, -0.06954, -0.06837, -0.06669, -0.06494, -0.06287, -0.06058, -0.05894, -0.05782, -0.05669, -0.05556, -0.05451, -0.05334, -0.05195, -0.05058, -0.04914, -0.04743, -0.04545, -0.04351, -0.04157, -0.03948, -0.03752, -0.03569, -0.03404, -0.03259, -0.03145, -0.03043, -0.02898, -0.0274, -0.0259, -0.02415, -0.02242, -0.02085, -0.01931, -0.01731, -0.0146, -0.01198, -0.00949, -0.00663, -0.00378, -0.00119, 0.0017, 0.0049, 0.00777, 0.01027, 0.01293, 0.01592, 0.0192, 0.02227, 0.0249, 0.02759, 0.03063, 0.03409, 0.03783, 0.04127, 0.04425, 0.04714, 0.05022, 0.0535, 0.05702, 0.06079, 0.06465, 0.06794, 0.07105, 0.07439, 0.07781, 0.08095, 0.08375, 0.08629, 0.08855, 0.09081, 0.09311, 0.09545, 0.09806, 0.10036, 0.10233, 0.10417, 0.10651, 0.10939, 0.11212, 0.11458, 0.11703, 0.11949, 0.12169, 0.12378, 0.12622, 0.12883, 0.13124, 0.13335, 0.13527, 0.13727, 0.13944, 0.14163, 0.14384, 0.14589, 0.14773, 0.14961, 0.1517, 0.15388, 0.15614, 0.15848, 0.16115, 0.16403, 0.16664, 0.16895, 0.17142, 0.17449, 0.17765, 0.18024, 0.18247, 0.18454, 0.18672, 0.18918, 0.192, 0.19489, 0.19733, 0.19937, 0.20107, 0.20234, 0.20335, 0.2044, 0.20569, 0.20685, 0.20768, 0.20872, 0.21007, 0.21148, 0.21273, 0.21414, 0.21572, 0.21718, 0.21873, 0.22033, 0.22175, 0.22279, 0.22369, 0.22491, 0.22653, 0.228, 0.22933, 0.23059, 0.23149, 0.23197, 0.23236, 0.23314, 0.23416, 0.23477, 0.23513, 0.2353, 0.23529, 0.23513, 0.23473, 0.23423, 0.23402, 0.234, 0.23399, 0.23424, 0.23475, 0.23499, 0.23483, 0.23446, 0.23414, 0.23393, 0.23378, 0.23387, 0.23412, 0.2343, 0.23404, 0.23356, 0.23321, 0.23289, 0.23243, 0.23187, 0.2313, 0.23068, 0.23003, 0.22895, 0.22746, 0.22629, 0.2254, 0.22469, 0.22408, 0.22338, 0.22251, 0.22158, 0.22094, 0.22065, 0.22042, 0.22024, 0.21939, 0.21775, 0.2162, 0.21499, 0.2138, 0.21274, 0.21192, 0.21102, 0.20997, 0.20887, 0.20795, 0.20716, 0.20639, 0.20562, 0.20513, 0.20481, 0.20414, 0.20286, 0.20126, 0.19994, 0.19871, 0.19726, 0.19585, 0.19475, 0.19351, 0.19215, 0.19101, 0.18992, 0.18829, 0.18642, 0.18488, 0.18382, 0.18299, 0.18175, 0.17991, 0.17774, 0.17509, 0.17179, 0.16843, 0.16605, 0.16482, 0.1641, 0.16311, 0.16139, 0.15919, 0.15696, 0.15487, 0.1531, 0.15145, 0.14957, 0.14733, 0.14452, 0.14101, 0.13734, 0.13403, 0.13091, 0.12769, 0.12447, 0.12125, 0.11765, 0.1138, 0.11007, 0.10635, 0.1032, 0.10114, 0.09997, 0.09902, 0.09756, 0.09526, 0.09229, 0.08879, 0.08499, 0.08132, 0.07791, 0.07461, 0.07125, 0.06793, 0.06476, 0.06167, 0.05856, 0.0554, 0.05228, 0.04946, 0.04745, 0.04606, 0.0451, 0.04439, 0.04366, 0.04274, 0.04152, 0.0402, 0.03906, 0.03823, 0.03744, 0.03616, 0.03422, 0.03218, 0.03066, 0.02933, 0.02774, 0.02618, 0.02484, 0.0234, 0.02172, 0.02007, 0.01847, 0.01681, 0.01522, 0.01377, 0.01219, 0.0101, 0.00759, 0.00495, 0.00263, 0.00078, -0.00071, -0.00185, -0.00265, -0.00307, -0.00352, -0.00452, -0.00582, -0.00695, -0.00787, -0.00896, -0.01032, -0.01182, -0.01353, -0.01527, -0.01683, -0.01832, -0.01961, -0.02068, -0.02168, -0.0229, -0.02441, -0.02581, -0.02681, -0.02725, -0.02761, -0.02844, -0.02943, -0.03031, -0.03099, -0.03181, -0.03309, -0.03471, -0.03618, -0.03758, -0.03943, -0.04133, -0.04245, -0.04302, -0.04333, -0.0434, -0.04362, -0.04391, -0.0441, -0.04419, -0.04411, -0.04396, -0.04405, -0.0443, -0.04453, -0.0447, -0.04494, -0.04508, -0.0453, -0.04585, -0.04618, -0.04606, -0.04576, -0.04539, -0.0451, -0.04471, -0.04403, -0.04325, -0.04271, -0.04239, -0.04196, -0.04164, -0.04155, -0.04172, -0.04179, -0.04116, -0.03993, -0.03844, -0.03661, -0.03478, -0.03343, -0.03259, -0.03195, -0.03132, -0.0307, -0.02986, -0.02901, -0.02806, -0.02684, -0.0254, -0.02372, -0.02196, -0.02035, -0.01903, -0.018, -0.01729, -0.01646, -0.01533, -0.01424, -0.01307, -0.01163, -0.00981, -0.00775, -0.00558, -0.00327, -0.00093, 0.00178, 0.00498, 0.008, 0.01066, 0.01312, 0.01519, 0.01706, 0.01893, 0.02083, 0.02282, 0.02498, 0.02711, 0.0291, 0.03105, 0.03266, 0.03363, 0.03472, 0.03657, 0.03845, 0.0402, 0.04206, 0.0437, 0.0452, 0.04664, 0.0483, 0.05035, 0.05252, 0.05508, 0.05762, 0.05986, 0.06215, 0.06429, 0.06581, 0.06714, 0.06879, 0.07057, 0.07234, 0.07441, 0.07654, 0.07869, 0.08112, 0.08379, 0.08657, 0.089, 0.09104, 0.09311, 0.09487, 0.09624, 0.09788, 0.09986, 0.10159, 0.10312, 0.10486, 0.10696, 0.10928, 0.11177, 0.11456, 0.11721, 0.11927, 0.12113, 0.12324, 0.12558, 0.12776, 0.12965, 0.13146, 0.13308, 0.13478, 0.13664, 0.13851, 0.1403, 0.14191, 0.14318, 0.14421, 0.14544, 0.14662, 0.14766, 0.14881, 0.15022, 0.15186, 0.1536, 0.15555, 0.15742, 0.15921, 0.16101, 0.16253, 0.16389, 0.16528, 0.1665, 0.16747, 0.16858, 0.17013, 0.17212, 0.1743, 0.17617, 0.17754, 0.17865, 0.17969, 0.18061, 0.18145, 0.1821, 0.18231, 0.18212, 0.18201, 0.18222, 0.18234, 0.18236, 0.18256, 0.1825, 0.182, 0.18129, 0.18046, 0.17989, 0.17981, 0.17994, 0.18, 0.18017, 0.18076, 0.18182, 0.18296, 0.18388, 0.18488, 0.18582, 0.18629, 0.18628, 0.18613, 0.18587, 0.18556, 0.18508, 0.18459, 0.18444, 0.18469, 0.18536, 0.18618, 0.18678, 0.18698, 0.18704, 0.18729, 0.18763, 0.18769, 0.18755, 0.1875, 0.18759, 0.18758, 0.18728, 0.18689, 0.1868, 0.18702, 0.18713, 0.18684, 0.18623, 0.18549, 0.18485, 0.18473, 0.18479, 0.1843, 0.18318, 0.18175, 0.1805, 0.1794, 0.17833, 0.17745, 0.17674, 0.17605, 0.1753, 0.1744, 0.17311, 0.17159, 0.17007, 0.16842, 0.16697, 0.16625, 0.16554, 0.16412, 0.16243, 0.16111, 0.16046, 0.16011, 0.15977, 0.15947, 0.15884, 0.15767, 0.15602, 0.15465, 0.15386, 0.15297, 0.15209, 0.15123, 0.1499, 0.14844, 0.14712, 0.14571, 0.14435, 0.14262, 0.14036, 0.13804, 0.13583, 0.13407, 0.13271, 0.13134, 0.12956, 0.1277, 0.1261, 0.12444, 0.1227, 0.1207, 0.11876, 0.11739, 0.11595, 0.11453, 0.11323, 0.11139, 0.10888, 0.10643, 0.10417, 0.10178, 0.09976, 0.09836, 0.09729, 0.09612, 0.09489, 0.09353, 0.09169, 0.08954, 0.08738, 0.08542, 0.08318, 0.08067, 0.07856, 0.0765, 0.07422, 0.07186, 0.06934, 0.06675, 0.06427, 0.0618, 0.05926, 0.05687, 0.05472, 0.05299, 0.05135, 0.04933, 0.04735, 0.04569, 0.04431, 0.04316, 0.04215, 0.04126, 0.04028, 0.03882, 0.03708, 0.03565, 0.03433, 0.03299, 0.03163, 0.03058, 0.02966, 0.02833, 0.02664, 0.02466, 0.02282, 0.02151, 0.0206, 0.0201, 0.01965, 0.01906, 0.0188, 0.01888, 0.01852, 0.0178, 0.01738, 0.01687, 0.01571, 0.01439, 0.01319, 0.01211, 0.01101, 0.00972, 0.00869, 0.00774, 0.0064, 0.00494, 0.00338, 0.00164, -8e-05, -0.00152, -0.00266, -0.00371, -0.00443, -0.00467, -0.00507, -0.0058, -0.0067, -0.00757, -0.00816, -0.00883, -0.00957, -0.01034, -0.01136, -0.01227, -0.01291, -0.01339, -0.01373, -0.01367, -0.01311, -0.01234, -0.01164, -0.01089, -0.00992, -0.0089, -0.00803, -0.00725, -0.00633, -0.00524, -0.00425, -0.00347, -0.00289, -0.00237, -0.00149, -0.00032, 0.00063, 0.00134, 0.00218, 0.00331, 0.00435, 0.00526, 0.00631, 0.00769, 0.00918, 0.01052, 0.01184, 0.01335, 0.01506, 0.01628, 0.01699, 0.01752, 0.01767, 0.01776, 0.01835, 0.01968, 0.02154, 0.02367, 0.02586, 0.02778, 0.02921, 0.03035, 0.03139, 0.03227, 0.03318, 0.0342, 0.03544, 0.03705, 0.03906, 0.04106, 0.04294, 0.04462, 0.04564, 0.04626, 0.04689, 0.04773, 0.04885, 0.05016, 0.05171, 0.05327, 0.05481, 0.05651, 0.05822, 0.05994, 0.06172, 0.0635, 0.06492, 0.06597, 0.06685, 0.06762, 0.06863, 0.07008, 0.0719, 0.0737, 0.07553, 0.07734, 0.07892, 0.08084, 0.08307, 0.08529, 0.08741, 0.08946, 0.09131, 0.09277, 0.09407, 0.0956, 0.09725, 0.09889, 0.10049, 0.10248, 0.10502, 0.10768, 0.11003, 0.11187, 0.11339, 0.11489, 0.1166, 0.11829, 0.1199, 0.12137, 0.12279, 0.12444, 0.12618, 0.12773, 0.1292, 0.13077, 0.13235, 0.13392, 0.13558, 0.13725, 0.13899, 0.14089, 0.14244, 0.14349, 0.1446, 0.14593, 0.14729, 0.14843, 0.14924, 0.14995, 0.15065, 0.15145, 0.15246, 0.15373, 0.15529, 0.15693, 0.1585, 0.16024, 0.16206, 0.16334, 0.16433, 0.1656, 0.1671, 0.16856, 0.16994, 0.17124, 0.17238, 0.17338, 0.17409, 0.17464, 0.17519, 0.17563, 0.17602, 0.17638, 0.17672, 0.17708, 0.17723, 0.17698, 0.17663, 0.17636, 0.17619, 0.17605, 0.17593, 0.17585, 0.17574, 0.17558, 0.17568, 0.17595, 0.1762, 0.17671, 0.17739, 0.17775, 0.1778, 0.17769, 0.17746, 0.1771, 0.17655, 0.17611, 0.17587, 0.17558, 0.17491, 0.17394, 0.17309, 0.17206, 0.17068, 0.16948, 0.16887, 0.16853, 0.16828, 0.16819, 0.16775, 0.16682, 0.16577, 0.1648, 0.1638, 0.16267, 0.16165, 0.16052, 0.15908, 0.15759, 0.15602, 0.15414, 0.15216, 0.15068, 0.14951, 0.14804, 0.14658, 0.14551, 0.145, 0.14517, 0.14559, 0.14592, 0.14608, 0.14584, 0.14496, 0.14418, 0.14388, 0.14333, 0.14245, 0.1415, 0.14061, 0.13962, 0.13872, 0.13809, 0.13771, 0.13738, 0.1364, 0.13514, 0.13424, 0.13333, 0.13231, 0.13125, 0.13037, 0.12994, 0.12958, 0.12883, 0.12769, 0.12625, 0.1248, 0.12369, 0.12275, 0.12142, 0.12035, 0.12006, 0.11974, 0.11924, 0.11885, 0.11842, 0.11769, 0.11664, 0.11579, 0.11511, 0.11406, 0.11251, 0.11077, 0.10957, 0.10861, 0.10738, 0.10612, 0.10473, 0.10303, 0.10104, 0.09898, 0.0968, 0.09468, 0.09303, 0.09148, 0.08997, 0.08857, 0.08749, 0.08685, 0.08631, 0.08568, 0.0847, 0.08291, 0.08077, 0.07896, 0.07721, 0.07529, 0.07327, 0.07143, 0.07006, 0.06904, 0.06814, 0.06719, 0.06625, 0.06534, 0.06436, 0.06323, 0.06196, 0.06055, 0.0593, 0.05827, 0.05702, 0.05541, 0.05396, 0.05291, 0.05168, 0.05032, 0.04937, 0.04862, 0.04782, 0.04706, 0.04633, 0.04559, 0.04488, 0.04396, 0.04315, 0.04272, 0.04243, 0.04252, 0.04249, 0.04192, 0.04099, 0.03993, 0.03884, 0.03744, 0.03619, 0.0355, 0.03517, 0.03491, 0.03436, 0.03386, 0.03385, 0.0339, 0.03365, 0.0333, 0.03303, 0.03291, 0.03277, 0.03249, 0.03203, 0.0315, 0.03067, 0.0297, 0.02928, 0.0296, 0.03017, 0.0305, 0.03079, 0.03116, 0.03155, 0.03206, 0.03293, 0.03422, 0.03551, 0.03662, 0.03765, 0.03879, 0.03982, 0.0405, 0.04085, 0.04091, 0.04102, 0.04159, 0.04245, 0.04357, 0.04459, 0.04517, 0.04567, 0.04652, 0.04747, 0.04805, 0.04861, 0.04953, 0.05042, 0.05104, 0.05136, 0.0512, 0.05089, 0.05094, 0.05149, 0.05223, 0.0528, 0.05312, 0.05352, 0.05409, 0.05493, 0.05543, 0.05548, 0.05544, 0.05546, 0.05558, 0.0559, 0.05649, 0.05751, 0.0586, 0.05937, 0.06004, 0.06098, 0.06196, 0.06296, 0.06387, 0.06478, 0.06561, 0.06613, 0.06689, 0.06789, 0.06908, 0.07055, 0.07219, 0.07388, 0.07538, 0.07668, 0.0777, 0.07878, 0.08012, 0.08182, 0.08412, 0.08638, 0.0882, 0.08952, 0.09061, 0.09115, 0.09159, 0.09229, 0.09332, 0.09483, 0.0966, 0.09808, 0.09942, 0.10061, 0.1015, 0.10225, 0.10286, 0.10348, 0.10408, 0.1049, 0.10632, 0.10827, 0.11019, 0.11183, 0.11322, 0.11414, 0.11459, 0.11502, 0.11561, 0.11633, 0.1173, 0.11823, 0.11922, 0.12069, 0.12235, 0.12394, 0.12564, 0.12739, 0.12928, 0.13111, 0.13264, 0.13409, 0.13531, 0.13606, 0.13644, 0.13693, 0.13751, 0.13797, 0.13878, 0.14014, 0.14147, 0.14261, 0.14406, 0.1456, 0.1467, 0.14768, 0.14895, 0.1503, 0.15159, 0.15298, 0.15454, 0.15595, 0.15693, 0.158, 0.15905, 0.15992, 0.16087, 0.1618, 0.16248, 0.16299, 0.1638, 0.16449, 0.16479, 0.16529, 0.16594, 0.16633, 0.16679, 0.16768, 0.16872, 0.1697, 0.17053, 0.17118, 0.1715, 0.1715, 0.17175, 0.17215, 0.17238, 0.1725, 0.1728, 0.17335, 0.17369, 0.17387, 0.17394, 0.17375, 0.17363, 0.17367, 0.17372, 0.1736, 0.17338, 0.17324, 0.17318, 0.17298, 0.17242, 0.17161, 0.17062, 0.16975, 0.16919, 0.16883, 0.16852, 0.16836, 0.16816, 0.16759, 0.1666, 0.16584, 0.16554, 0.16527, 0.16479, 0.16438, 0.16424, 0.16391, 0.16347, 0.1629, 0.16204, 0.16106, 0.1599, 0.1587, 0.15778, 0.15733, 0.15707, 0.15647, 0.15531, 0.15396, 0.15278, 0.15137, 0.14923, 0.14674, 0.14486, 0.14349, 0.14209, 0.14085, 0.13946, 0.13764, 0.13544, 0.13306, 0.13104, 0.12952, 0.12853, 0.12786, 0.12666, 0.12484, 0.12315, 0.12183, 0.12044, 0.11867, 0.11677, 0.11511, 0.11383, 0.11281, 0.11167, 0.11018, 0.10827, 0.10596, 0.10371, 0.10172, 0.09993, 0.09845, 0.09686, 0.09502, 0.09343, 0.09239, 0.09179, 0.09116, 0.09043, 0.08945, 0.08809, 0.08675, 0.08551, 0.08436, 0.0831, 0.08186, 0.08102, 0.07978, 0.07791, 0.07621, 0.07479, 0.0737, 0.07303, 0.07249, 0.07173, 0.07024, 0.06834, 0.06664, 0.06513, 0.06367, 0.06233, 0.06141, 0.06084, 0.06013, 0.05947, 0.05902, 0.05847, 0.05785, 0.05748, 0.05755, 0.05785, 0.05774, 0.05721, 0.05696, 0.05708, 0.05707, 0.05695, 0.05697, 0.05714, 0.05705, 0.05687, 0.0568, 0.05647, 0.05569, 0.05453, 0.05318, 0.05167, 0.04993, 0.04832, 0.04707, 0.04604, 0.04514, 0.04427, 0.04349, 0.04266, 0.04179, 0.04102, 0.04046, 0.04006, 0.03955, 0.03897, 0.03861, 0.03834, 0.03775, 0.03711, 0.03664, 0.03608, 0.03521, 0.03431, 0.03386, 0.03351, 0.03275, 0.03158, 0.03029, 0.02937, 0.0285, 0.02744, 0.02656, 0.02581, 0.02476, 0.02381, 0.02368, 0.02402, 0.02431, 0.02444, 0.02431, 0.02413, 0.02419, 0.02436, 0.02447, 0.0245, 0.0242, 0.02373, 0.02351, 0.02356, 0.02368, 0.02388, 0.02428, 0.02446, 0.02443, 0.02433, 0.02417, 0.02395, 0.02351, 0.02275, 0.02206, 0.02144, 0.02099, 0.02042, 0.01982, 0.01983, 0.02009, 0.02029, 0.02049, 0.02062, 0.02037, 0.01953, 0.01878, 0.01878, 0.01925, 0.01981, 0.0202, 0.0204, 0.02045, 0.02038, 0.02037, 0.02027, 0.0201, 0.01985, 0.01951, 0.01928, 0.01946, 0.0203, 0.02142, 0.02252, 0.02359, 0.02443, 0.02487, 0.02536, 0.0262, 0.02735, 0.02832, 0.02943, 0.03085, 0.03225, 0.03359, 0.03505, 0.03674, 0.0385, 0.04039, 0.0422, 0.0436, 0.04467, 0.04547, 0.04594, 0.04634, 0.04681, 0.04772, 0.04913, 0.0507, 0.05212, 0.05324, 0.05417, 0.05492, 0.05577, 0.05665, 0.05733, 0.0583, 0.05951, 0.06028, 0.06101, 0.06222, 0.06376, 0.06527, 0.06687, 0.06856, 0.07027, 0.07177, 0.07297, 0.0743, 0.07609, 0.07797, 0.07972, 0.0817, 0.08376, 0.08523, 0.08619, 0.08738, 0.08894, 0.09036, 0.09149, 0.09311, 0.0954, 0.09775, 0.09976, 0.10133, 0.10271, 0.10393, 0.10487, 0.10584, 0.1072, 0.10898, 0.11077, 0.11219, 0.1136, 0.11516, 0.11664, 0.11808, 0.12011, 0.12274, 0.1254, 0.1277, 0.12937, 0.13062, 0.13165, 0.13296, 0.13445, 0.13632, 0.1384, 0.14028, 0.14212, 0.14391, 0.14567, 0.14746, 0.14907, 0.15072, 0.15246, 0.15419, 0.15587, 0.15724, 0.1585, 0.15981, 0.1609, 0.16186, 0.16321, 0.1647, 0.16598, 0.16678, 0.16742, 0.1681, 0.16886, 0.16962, 0.17056, 0.17185, 0.17319, 0.17454, 0.17551, 0.17632, 0.17697, 0.17757, 0.17834, 0.17905, 0.18, 0.1811, 0.18198, 0.18269, 0.18312, 0.18359, 0.18399, 0.18441, 0.18532, 0.18648, 0.18772, 0.18873, 0.1893, 0.18962, 0.18997, 0.19036, 0.19096, 0.19196, 0.19312, 0.19407, 0.19471, 0.19542, 0.19604, 0.19663, 0.19754, 0.19856, 0.19981, 0.20111, 0.20212, 0.2031, 0.20423, 0.20543, 0.20654, 0.20732, 0.20796, 0.20879, 0.20963, 0.21016, 0.2103, 0.21, 0.20969, 0.20957, 0.20963, 0.20955, 0.2095, 0.20945, 0.20922, 0.20908, 0.20893, 0.20904, 0.20938, 0.20952, 0.20958, 0.20959, 0.20922, 0.20898, 0.20905, 0.20919, 0.20904, 0.20856, 0.20791, 0.207, 0.20576, 0.2047, 0.20377, 0.20327, 0.20305, 0.20262, 0.20194, 0.20113, 0.20044, 0.19966, 0.19881, 0.19823, 0.19759, 0.19676, 0.19615, 0.19546, 0.19427, 0.19312, 0.19209, 0.1908, 0.18932, 0.18791, 0.18634, 0.18459, 0.18285, 0.18076, 0.17846, 0.17642, 0.17443, 0.17208, 0.16947, 0.16704, 0.16488, 0.16313, 0.16179, 0.16029, 0.15889, 0.15757, 0.1562, 0.15487, 0.15358, 0.1525, 0.15118, 0.14937, 0.14724, 0.1448, 0.14257, 0.14063, 0.13886, 0.13701, 0.13487, 0.13252, 0.13017, 0.12812, 0.1265, 0.12514, 0.12375, 0.12221, 0.12061, 0.1186, 0.11607, 0.11345, 0.11131, 0.10997, 0.10891, 0.1073, 0.10515, 0.10309, 0.10109, 0.09881, 0.0966, 0.09476, 0.09297, 0.09105, 0.08952, 0.08848, 0.08756, 0.08693, 0.08631, 0.08503, 0.08308, 0.08097, 0.07893, 0.07686, 0.07475, 0.07309, 0.07195, 0.07076, 0.0694, 0.06753, 0.06514, 0.06278, 0.06054, 0.05824, 0.05566, 0.05295, 0.05019, 0.04734, 0.0449, 0.04334, 0.04211, 0.0408, 0.03958, 0.03861, 0.03785, 0.03711, 0.03617, 0.03524, 0.03465, 0.0342, 0.03345, 0.03218, 0.03074, 0.0296, 0.02892, 0.02865, 0.0284, 0.02789, 0.02704, 0.02583, 0.02458, 0.02353, 0.02254, 0.02152, 0.02034, 0.01889, 0.01709, 0.01504, 0.01291, 0.01083, 0.00924, 0.00813, 0.00736, 0.00684, 0.00612, 0.0051, 0.00397, 0.00289, 0.00236, 0.00221, 0.00225, 0.00283, 0.00373, 0.0045, 0.00458, 0.00421, 0.00379, 0.00318, 0.0026, 0.00211, 0.00188, 0.00199, 0.00213, 0.00218, 0.00223, 0.00242, 0.00266, 0.00275, 0.00282, 0.00282, 0.00274, 0.00273, 0.00256, 0.00232, 0.00245, 0.00298, 0.00328, 0.00314, 0.00313, 0.00325, 0.00316, 0.00313, 0.00344, 0.0038, 0.00391, 0.00422, 0.00475, 0.00494, 0.0046, 0.00401, 0.00359, 0.00336, 0.00317, 0.00289, 0.00271, 0.00274, 0.00277, 0.00276, 0.00282, 0.00339, 0.00461, 0.00617, 0.00754, 0.00849, 0.00931, 0.01005, 0.01058, 0.01086, 0.01107, 0.01148, 0.01201, 0.01263, 0.01382, 0.01566, 0.01737, 0.01846, 0.01908, 0.01959, 0.0202, 0.02085, 0.02135, 0.02143, 0.0212, 0.02105, 0.02119, 0.02145, 0.02203, 0.02316, 0.02424, 0.02523, 0.02618, 0.0271, 0.028, 0.02892, 0.03006, 0.03113, 0.03212, 0.03355, 0.03526, 0.03684, 0.03806, 0.03898, 0.0397, 0.04004, 0.04024, 0.04077, 0.04151, 0.04228, 0.04346, 0.0451, 0.04706, 0.04896, 0.05058, 0.05216, 0.05377, 0.05545, 0.05719, 0.05908, 0.06137, 0.0637, 0.06574, 0.06787, 0.06993, 0.07182, 0.07386, 0.0757, 0.07742, 0.07918, 0.08098, 0.08302, 0.08513, 0.08717, 0.0891, 0.09093, 0.09232, 0.09318, 0.09386, 0.09484, 0.09596, 0.09662, 0.09715, 0.09802, 0.09909, 0.10047, 0.10233, 0.10464, 0.10723, 0.10989, 0.11253, 0.11495, 0.11703, 0.11909, 0.12119, 0.1231, 0.12503, 0.12705, 0.12914, 0.13148, 0.13395, 0.13613, 0.13788, 0.13942, 0.1408, 0.14213, 0.14355, 0.14498, 0.14657, 0.14859, 0.1508, 0.15283, 0.15482, 0.15674, 0.15856, 0.16056, 0.16297, 0.16563, 0.16817, 0.17037, 0.17216, 0.17382, 0.17566, 0.17735, 0.17882, 0.18006, 0.18106, 0.18199, 0.18306, 0.18445, 0.18583, 0.18732, 0.1892, 0.19111, 0.19289, 0.19457, 0.19628, 0.19811, 0.20008, 0.2022, 0.20455, 0.20682, 0.20866, 0.2099, 0.21062, 0.21128, 0.21204, 0.21275, 0.21377, 0.21531, 0.21699, 0.21837, 0.21939, 0.21979, 0.21952, 0.21948, 0.2201, 0.22118, 0.2222, 0.22306, 0.22409, 0.22526, 0.22594, 0.22609, 0.22607, 0.22599, 0.22605, 0.22614, 0.22626, 0.22666, 0.22736, 0.22783, 0.22795, 0.22803, 0.22787, 0.22739, 0.22663, 0.22567, 0.22496, 0.2248, 0.22477, 0.22459, 0.22421, 0.22348, 0.22243, 0.22141, 0.22046, 0.21949, 0.21877, 0.21833, 0.21812, 0.21812, 0.2181, 0.21756, 0.21623, 0.2143, 0.21213, 0.21029, 0.20943, 0.20925, 0.20899, 0.2086, 0.2081, 0.20739, 0.20664, 0.20571, 0.20417, 0.20207, 0.19994, 0.19794, 0.19593, 0.19398, 0.19204, 0.19008, 0.18834, 0.18689, 0.18574, 0.18477, 0.18372, 0.18239, 0.18075, 0.17917, 0.1781, 0.17737, 0.1763, 0.17446, 0.17185, 0.16884, 0.16622, 0.16421, 0.16244, 0.16104, 0.15977, 0.15803, 0.15604, 0.15445, 0.15306, 0.15142, 0.14972, 0.14805, 0.14627, 0.14444, 0.14267, 0.14082, 0.13887, 0.13684, 0.13453, 0.13212, 0.12994, 0.12785, 0.12556, 0.12305, 0.12085, 0.11944, 0.1185, 0.11766, 0.11636, 0.11457, 0.11262, 0.11059, 0.10876, 0.1072, 0.10597, 0.1049, 0.10364, 0.10237, 0.10106, 0.09908, 0.09645, 0.09386, 0.09154, 0.08936, 0.08713, 0.08506, 0.08347, 0.08197, 0.0801, 0.078, 0.07573, 0.07343, 0.07128, 0.069, 0.06644, 0.064, 0.06185, 0.05968, 0.0575, 0.0554, 0.05335, 0.05114, 0.0489, 0.04709, 0.04564, 0.04409, 0.04227, 0.04067, 0.03945, 0.03786, 0.03591, 0.03422, 0.03269, 0.03104, 0.02948, 0.02816, 0.02667, 0.02499, 0.02321, 0.02124, 0.01894, 0.01642, 0.0138, 0.01105, 0.0086, 0.00682, 0.00565, 0.00463, 0.00347, 0.00226, 0.00075, -0.00129, -0.00326, -0.00473, -0.00571, -0.00651, -0.00752, -0.00867, -0.00946, -0.00967, -0.00973, -0.00997, -0.01055, -0.01125, -0.0119, -0.01248, -0.01313, -0.01393, -0.01482, -0.01599, -0.01737, -0.0186, -0.01934, -0.01996, -0.02089, -0.02161, -0.02192, -0.02205, -0.0224, -0.02326, -0.02424, -0.02483, -0.02468, -0.02407, -0.02375, -0.02377, -0.02376, -0.02404, -0.02448, -0.02485, -0.02509, -0.02511, -0.0252, -0.02522, -0.02478, -0.02396, -0.02273, -0.02081, -0.01841, -0.01621, -0.01462, -0.01379, -0.01358, -0.01367, -0.01366, -0.01328, -0.01264, -0.01188, -0.01111, -0.01028, -0.00941, -0.00879, -0.00843, -0.00811, -0.00754, -0.00644, -0.00474, -0.00262, -0.00081, 0.00064, 0.00204, 0.00333, 0.0046, 0.00612, 0.00772, 0.00909, 0.01045, 0.01195, 0.01362, 0.01543, 0.01702, 0.01855, 0.02026, 0.02207, 0.02402, 0.02573, 0.02702, 0.02801, 0.02884, 0.02968, 0.03061, 0.0322, 0.0345, 0.03664, 0.03857, 0.0406, 0.04225, 0.04346, 0.04489, 0.04659, 0.04834, 0.05019, 0.05221, 0.05428, 0.05636, 0.05842, 0.06045, 0.06251, 0.06452, 0.06635, 0.06799, 0.06938, 0.0704, 0.0712, 0.07244, 0.0743, 0.07639, 0.07869, 0.08087, 0.08274, 0.085, 0.08777, 0.09037, 0.09277, 0.09504, 0.09704, 0.09874, 0.10011, 0.10147, 0.10267, 0.10366, 0.10479, 0.10612, 0.10765, 0.10956, 0.1122, 0.11518, 0.11797, 0.12074, 0.12363, 0.1262, 0.12828, 0.13035, 0.13225, 0.13416, 0.13642, 0.13866, 0.14063, 0.14251, 0.1444, 0.14644, 0.14851, 0.15028, 0.15219, 0.15442, 0.15655, 0.15856, 0.16054, 0.16246, 0.16439, 0.16643, 0.16867, 0.17134, 0.1741, 0.1768, 0.17919, 0.18099, 0.18279, 0.1849, 0.18716, 0.18961, 0.19214, 0.19433, 0.19619, 0.1981, 0.20015, 0.20221, 0.20421, 0.20601, 0.20746, 0.20876, 0.21009, 0.21141, 0.21249, 0.21308, 0.2134, 0.21433, 0.21574, 0.21711, 0.21833, 0.2194, 0.22051, 0.2216, 0.22258, 0.2234, 0.22435, 0.22538, 0.22594, 0.22614, 0.22642, 0.22669, 0.22692, 0.22728, 0.22752, 0.22766, 0.22786, 0.22832, 0.2292, 0.23028, 0.23139, 0.23252, 0.23373, 0.23471, 0.2354, 0.23595, 0.23645, 0.2368, 0.23661, 0.23598, 0.23516, 0.23455, 0.23437, 0.23446, 0.23467, 0.23464, 0.23467, 0.23511, 0.23569, 0.23606, 0.23635, 0.23686, 0.23728, 0.23749, 0.23747, 0.23729, 0.23694, 0.2366, 0.2363, 0.23571, 0.23514, 0.23477, 0.23418, 0.23371, 0.23389, 0.23405, 0.23361, 0.23263, 0.2313, 0.22955, 0.22742, 0.22528, 0.22341, 0.22182, 0.22095, 0.22079, 0.22071, 0.22046, 0.22, 0.21899, 0.21737, 0.21545, 0.21349, 0.21172, 0.20994, 0.20805, 0.20616, 0.20427, 0.20274, 0.20141, 0.20002, 0.1987, 0.19698, 0.19486, 0.19293, 0.19148, 0.1901, 0.18871, 0.18724, 0.18593, 0.18499, 0.1838, 0.18194, 0.17938, 0.17644, 0.17361, 0.17133, 0.16937, 0.16741, 0.16551, 0.16351, 0.1613, 0.15892, 0.15672, 0.15499, 0.15324, 0.15093, 0.1483, 0.146, 0.14408, 0.14253, 0.14128, 0.14022, 0.13897, 0.13696, 0.13445, 0.13204, 0.12987, 0.12794, 0.12601, 0.12414, 0.1224, 0.12076, 0.11951, 0.11868, 0.11823, 0.11806, 0.11799, 0.11753, 0.11635, 0.11469, 0.11306, 0.11178, 0.11079, 0.10971, 0.10837, 0.1064, 0.10365, 0.10076, 0.09806, 0.09559, 0.09332, 0.09118, 0.08908, 0.08681, 0.08464, 0.08288, 0.0814, 0.0805, 0.08028, 0.08027, 0.08, 0.07884, 0.07677, 0.07502, 0.07361, 0.07231, 0.07092, 0.06916, 0.06723, 0.06552, 0.06401, 0.06208, 0.05967, 0.05661, 0.05323, 0.04988, 0.04682, 0.0443, 0.04232, 0.04084, 0.03958, 0.03842, 0.03705, 0.03566, 0.03443, 0.03321, 0.03227, 0.03168, 0.03119, 0.03079, 0.03046, 0.03, 0.02922, 0.02783, 0.02576, 0.02351, 0.02146, 0.01969, 0.01811, 0.01654, 0.015, 0.01359, 0.01218, 0.01066, 0.00915, 0.00811, 0.00764, 0.0073, 0.00683, 0.00635, 0.00632, 0.00645, 0.0063, 0.00581, 0.00507, 0.00449, 0.00428, 0.00447, 0.00475, 0.00492, 0.00498, 0.00461, 0.00389, 0.00343, 0.00358, 0.00405, 0.0045, 0.0046, 0.00439, 0.00414, 0.00399, 0.00399, 0.00412, 0.00446, 0.00487, 0.00522, 0.00541, 0.00567, 0.00586, 0.0055, 0.00504, 0.00492, 0.00497, 0.00505, 0.00529, 0.00532, 0.00507, 0.00532, 0.00577, 0.0063, 0.00722, 0.0084, 0.00959, 0.01035, 0.01057, 0.01065, 0.01104, 0.01162, 0.01254, 0.01423, 0.0163, 0.01819, 0.01975, 0.0212, 0.02268, 0.02384, 0.02479, 0.02615, 0.02785, 0.02913, 0.02983, 0.03057, 0.03147, 0.0323, 0.03328, 0.03468, 0.03631, 0.03792, 0.03939, 0.04053, 0.04167, 0.0432, 0.04518, 0.04768, 0.05002, 0.05199, 0.054, 0.05627, 0.05856, 0.06074, 0.06288, 0.06482, 0.06676, 0.0687, 0.07061, 0.07254, 0.07442, 0.07638, 0.0783, 0.07981, 0.08111, 0.08246, 0.08395, 0.08557, 0.08755, 0.0899, 0.09211, 0.09403, 0.09593, 0.0978, 0.09953, 0.10117, 0.10268, 0.10402, 0.10539, 0.10693, 0.10844, 0.10994, 0.11151, 0.11305, 0.1146, 0.11633, 0.11837, 0.12056, 0.12255, 0.12418, 0.12584, 0.12793, 0.13049, 0.13321, 0.13601, 0.13873, 0.14102, 0.14307, 0.14512, 0.14724, 0.14968, 0.15251, 0.15571, 0.15904, 0.16233, 0.16572, 0.16898, 0.17205, 0.17499, 0.17777, 0.18015, 0.18204, 0.18371, 0.18529, 0.18719, 0.18932, 0.19109, 0.19237, 0.19354, 0.19476, 0.19593, 0.19705, 0.19791, 0.19872, 0.20004, 0.20178, 0.20342, 0.20483, 0.20612, 0.20709, 0.20777, 0.20832, 0.20894, 0.20994, 0.21147, 0.21326, 0.21465, 0.21547, 0.21623, 0.21724, 0.21859, 0.22017, 0.22191, 0.22341, 0.22428, 0.22491, 0.22542, 0.22545, 0.22521, 0.22548, 0.2264, 0.22754, 0.22861, 0.22954, 0.23023, 0.2307, 0.23114, 0.2319, 0.23295, 0.23375, 0.2343, 0.23484, 0.23519, 0.23541, 0.23562, 0.23607, 0.23683, 0.23752, 0.23798, 0.23868, 0.23992, 0.24097, 0.24141, 0.24141, 0.24116, 0.24061, 0.23945, 0.23804, 0.23702, 0.23621, 0.23549, 0.23496, 0.23434, 0.23347, 0.23244, 0.23146, 0.23031, 0.22924, 0.22839, 0.22747, 0.22674, 0.22616, 0.22557, 0.2249, 0.22402, 0.22295, 0.22219, 0.22188, 0.22193, 0.22154, 0.22016, 0.21834, 0.21623, 0.21416, 0.2122, 0.21033, 0.20872, 0.20718, 0.2058, 0.2048, 0.20381, 0.20259, 0.20128, 0.19999, 0.1987, 0.19736, 0.19602, 0.19456, 0.19271, 0.19061, 0.18863, 0.18665, 0.18472, 0.18318, 0.18181, 0.18037, 0.17919, 0.17814, 0.17681, 0.17525, 0.17351, 0.1719, 0.17058, 0.16915, 0.1677, 0.16638, 0.16495, 0.16336, 0.16164, 0.16007, 0.15837, 0.156, 0.1533, 0.15077, 0.14824, 0.14577, 0.1438, 0.14196, 0.13956, 0.13705, 0.13529, 0.13349, 0.13117, 0.1288, 0.12645, 0.12414, 0.12171, 0.11936, 0.11705, 0.11473, 0.11238, 0.10963, 0.10701, 0.10485, 0.10263, 0.10021, 0.09779, 0.09541, 0.09291, 0.09034, 0.08766, 0.08484, 0.08192, 0.07891, 0.0761, 0.07379, 0.07201, 0.07064, 0.06945, 0.06845, 0.06777, 0.06733, 0.06655, 0.06499, 0.06312, 0.06121, 0.05926, 0.05742, 0.05577, 0.05447, 0.05355, 0.05255, 0.05103, 0.04937, 0.04806, 0.04673, 0.0451, 0.04331, 0.04145, 0.0399, 0.0387, 0.03784, 0.03714, 0.03614, 0.03471, 0.03278, 0.03063, 0.0288, 0.02742, 0.02606, 0.02431, 0.02252, 0.02091, 0.01945, 0.0184, 0.01769, 0.01671, 0.01547, 0.01411, 0.01249, 0.01059, 0.00843, 0.00685, 0.00621, 0.00562, 0.0048, 0.00413, 0.00359, 0.0033, 0.00304, 0.00262, 0.00197, 0.00145, 0.00113, 0.00086, 0.00093, 0.00131, 0.00197, 0.00249, 0.00265, 0.00244, 0.00198, 0.00128, 0.00038, -0.00029, -8e-05, 0.0012, 0.00276, 0.0041, 0.0054, 0.00657, 0.00728, 0.00771, 0.00807, 0.00858, 0.00975, 0.01143, 0.01292, 0.01393, 0.01458, 0.01487, 0.01495, 0.01511, 0.01579, 0.01687, 0.01788, 0.01928, 0.02089, 0.02226, 0.02344, 0.02451, 0.02573, 0.02701, 0.02823, 0.02954, 0.03102, 0.03227, 0.03314, 0.03376, 0.03409, 0.03435, 0.03444, 0.03449, 0.03494, 0.03572, 0.03681, 0.03802, 0.03879, 0.03913, 0.04006, 0.0419, 0.04403, 0.04588, 0.04754, 0.04955, 0.0518, 0.05402, 0.05615, 0.05808, 0.05991, 0.06148, 0.06271, 0.0638, 0.06505, 0.0664, 0.06768, 0.06879, 0.06957, 0.07046, 0.07146, 0.07233, 0.07326, 0.07424, 0.07537, 0.07661, 0.07788, 0.07908, 0.08079, 0.08307, 0.08526, 0.08753, 0.08973, 0.09187, 0.094, 0.09569, 0.09702, 0.09817, 0.09933, 0.10083, 0.10264, 0.10449, 0.10608, 0.10756, 0.10911, 0.11068, 0.11213, 0.11325, 0.11436, 0.116, 0.11766, 0.11897, 0.12037, 0.12172, 0.12265, 0.12354, 0.12463, 0.12586, 0.12735, 0.12898, 0.13064, 0.13206, 0.13316, 0.13424, 0.13548, 0.13687, 0.13851, 0.14046, 0.14253, 0.14459, 0.14665, 0.14853, 0.15031, 0.15217, 0.15405, 0.15616, 0.15858, 0.16092, 0.16295, 0.16494, 0.16708, 0.16962, 0.17234, 0.17456, 0.1763, 0.1778, 0.17875, 0.17935, 0.18026, 0.18139, 0.18261, 0.18411, 0.1855, 0.18643, 0.18731, 0.18836, 0.18944, 0.19057, 0.19168, 0.19271, 0.19377, 0.19478, 0.19551, 0.19596, 0.19643, 0.19697, 0.19762, 0.19825, 0.1985, 0.1987, 0.19904, 0.19952, 0.20001, 0.20032, 0.20052, 0.20072, 0.20083, 0.20092, 0.20131, 0.20209, 0.20308, 0.20387, 0.20421, 0.20434, 0.20451, 0.20479, 0.20524, 0.20578, 0.20635, 0.20717, 0.20803, 0.20868, 0.20919, 0.20975, 0.21044, 0.21099, 0.21123, 0.2113, 0.21161, 0.21184, 0.21174, 0.21167, 0.21173, 0.21168, 0.2117, 0.21208, 0.21253, 0.21273, 0.21275, 0.21309, 0.21375, 0.21418, 0.21406, 0.21353, 0.21294, 0.21238, 0.21211, 0.21213, 0.21211, 0.212, 0.21194, 0.21182, 0.21171, 0.21186, 0.21188, 0.21134, 0.21073, 0.21055, 0.21059, 0.21059, 0.21063, 0.21065, 0.2104, 0.20972, 0.20869, 0.2079, 0.20747, 0.20705, 0.20649, 0.20587, 0.20507, 0.20412, 0.20319, 0.20239, 0.20191, 0.20162, 0.2011, 0.20024, 0.19916, 0.198, 0.19679, 0.1956, 0.19468, 0.19388, 0.19326, 0.19267, 0.19216, 0.19155, 0.19015, 0.18824, 0.18636, 0.1846, 0.18324, 0.18224, 0.18123, 0.18022, 0.17931, 0.17837, 0.17779, 0.17752, 0.17691, 0.17592, 0.17482, 0.17367, 0.17247, 0.17115, 0.16953, 0.1681, 0.16705, 0.16603, 0.16496, 0.1639, 0.16295, 0.16189, 0.16055, 0.1593, 0.15824, 0.15675, 0.15468, 0.15257, 0.15061, 0.14852, 0.14617, 0.14386, 0.14187, 0.13974, 0.13725, 0.13486, 0.13306, 0.13176, 0.13033, 0.12868, 0.12685, 0.12492, 0.12313, 0.12116, 0.11927, 0.11749, 0.11543, 0.11342, 0.11168, 0.1099, 0.10788, 0.10579, 0.10363, 0.10146, 0.09933, 0.09734, 0.09544, 0.09329, 0.09089, 0.0885, 0.08642, 0.08439, 0.08189, 0.07913, 0.07652, 0.07421, 0.07231, 0.0712, 0.07061, 0.06975, 0.06889, 0.06829, 0.06768, 0.06702, 0.06633, 0.06553, 0.06441, 0.06308, 0.06195, 0.06095, 0.06008, 0.05952, 0.05903, 0.05832, 0.05704, 0.05549, 0.05432, 0.05349, 0.05264, 0.05164, 0.05067, 0.04987, 0.04898, 0.04756, 0.04603, 0.04483, 0.04391, 0.04305, 0.04232, 0.04181, 0.04117, 0.04011, 0.03884, 0.03767, 0.03642, 0.03532, 0.03501, 0.03548, 0.03635, 0.0371, 0.03743, 0.03733, 0.03673, 0.0358, 0.03532, 0.03546, 0.03582, 0.0364, 0.03739, 0.03864, 0.04013, 0.0417, 0.04301, 0.04392, 0.0447, 0.04544, 0.04569, 0.04547, 0.04532, 0.04543, 0.04536, 0.04497, 0.04469, 0.04472, 0.04491, 0.04517, 0.04558, 0.04582, 0.04565, 0.0454, 0.04519, 0.04516, 0.04543, 0.04582, 0.04597, 0.04597, 0.0462, 0.04655, 0.04715, 0.048, 0.04886, 0.04978, 0.05056, 0.05105, 0.05135, 0.05162, 0.05178, 0.05186, 0.0521, 0.05254, 0.05313, 0.05383, 0.05462, 0.05504, 0.05524, 0.05582, 0.05672, 0.05777, 0.05858, 0.05924, 0.06025, 0.06132, 0.06216, 0.06283, 0.06352, 0.06451, 0.06576, 0.06714, 0.06861, 0.07026, 0.07219, 0.07419, 0.07574, 0.07677, 0.07758, 0.07822, 0.07902, 0.08018, 0.08168, 0.08319, 0.08431, 0.08511, 0.08586, 0.08666, 0.08767, 0.08903, 0.09061, 0.09211, 0.09333, 0.09432, 0.09521, 0.09628, 0.09764, 0.09911, 0.10065, 0.10197, 0.10282, 0.10349, 0.10425, 0.10529, 0.10696, 0.10929, 0.11179, 0.11438, 0.11703, 0.11929, 0.12105, 0.12275, 0.12447, 0.12626, 0.12835, 0.13045, 0.13237, 0.13446, 0.13671, 0.13869, 0.14025, 0.14175, 0.14328, 0.1446, 0.14585, 0.14716, 0.14841, 0.14925, 0.14972, 0.15046, 0.15159, 0.15316, 0.15495, 0.15652, 0.15773, 0.15849, 0.15895, 0.15933, 0.15985, 0.16091, 0.1628, 0.16506, 0.16707, 0.16886, 0.17064, 0.17215, 0.17327, 0.17453, 0.17607, 0.17774, 0.17931, 0.18056, 0.18164, 0.18252, 0.18308, 0.18375, 0.18463, 0.18594, 0.18772, 0.18965, 0.19181, 0.19423, 0.19658, 0.19863, 0.20056, 0.20265, 0.20467, 0.2063, 0.20783, 0.20932, 0.21054, 0.21158, 0.21236, 0.21278, 0.21321, 0.21363, 0.21404, 0.21453, 0.21501, 0.21562, 0.21625, 0.21661, 0.21679, 0.21696, 0.217, 0.21708, 0.21723, 0.21728, 0.21721, 0.21695, 0.21668, 0.21649, 0.21641, 0.21628, 0.21596, 0.21536, 0.21468, 0.21436, 0.2142, 0.21386, 0.21353, 0.21335, 0.21338, 0.21365, 0.21378, 0.21358, 0.21293, 0.2117, 0.21038, 0.20942, 0.20884, 0.20844, 0.20792, 0.20741, 0.20688, 0.20603, 0.2049, 0.2038, 0.20299, 0.2023, 0.20169, 0.20106, 0.20019, 0.19953, 0.19915, 0.19894, 0.19883, 0.1984, 0.19757, 0.19652, 0.19555, 0.19466, 0.19367, 0.1927, 0.19167, 0.19059, 0.18951, 0.18868, 0.18778, 0.18627, 0.18441, 0.18279, 0.18144, 0.17995, 0.17831, 0.17677, 0.17524, 0.17372, 0.17247, 0.17138, 0.17013, 0.16887, 0.16791, 0.16737, 0.16712, 0.167, 0.16698, 0.16666, 0.16606, 0.16539, 0.1647, 0.16394, 0.16315, 0.1624, 0.16148, 0.16046, 0.15927, 0.15793, 0.15675, 0.15561, 0.15435, 0.1532, 0.15209, 0.15021, 0.14766, 0.1453, 0.14331, 0.14155, 0.13977, 0.13791, 0.13585, 0.13372, 0.13181, 0.13017, 0.12874, 0.12732, 0.12597, 0.12457, 0.123, 0.12124, 0.11899, 0.11626, 0.1135, 0.11123, 0.10945, 0.10793, 0.10676, 0.10591, 0.10528, 0.10501, 0.10485, 0.10431, 0.10326, 0.10151, 0.09947, 0.09753, 0.09599, 0.09514, 0.09477, 0.09439, 0.09335, 0.09185, 0.09025, 0.08856, 0.08687, 0.08503, 0.08285, 0.08039, 0.07827, 0.07658, 0.07464, 0.07273, 0.07135, 0.07007, 0.0684, 0.06659, 0.06494, 0.06361, 0.06264, 0.06186, 0.06122, 0.06088, 0.06051, 0.05958, 0.05847, 0.05741, 0.0565, 0.0556, 0.05461, 0.05384, 0.05329, 0.05263, 0.05204, 0.05188, 0.05142, 0.05044, 0.04937, 0.04827, 0.04702, 0.04569, 0.04446, 0.04349, 0.04274, 0.04231, 0.04204, 0.0413, 0.04005, 0.03878, 0.03801, 0.03764, 0.03737, 0.03738, 0.03732, 0.0365, 0.03491, 0.0331, 0.03159, 0.03071, 0.03024, 0.02958, 0.02851, 0.02749, 0.02702, 0.02708, 0.02744, 0.02796, 0.02848, 0.02868, 0.02828, 0.02766, 0.027, 0.02638, 0.0261, 0.02633, 0.02694, 0.02767, 0.02807, 0.02808, 0.02823, 0.02866, 0.02929, 0.03039, 0.03184, 0.03316, 0.03412, 0.03477, 0.03548, 0.03679, 0.03871, 0.04083, 0.04262, 0.04376, 0.04452, 0.04483, 0.0445, 0.04414, 0.04473, 0.04582, 0.04707, 0.0488, 0.0508, 0.0526, 0.05398, 0.0549, 0.05549, 0.05592, 0.05623, 0.05683, 0.05762, 0.05816, 0.05857, 0.05911, 0.05986, 0.06094, 0.06203, 0.06289, 0.0638, 0.06441, 0.06432, 0.06378, 0.06329, 0.06343, 0.06428, 0.06553, 0.06705, 0.06838, 0.06942, 0.07068, 0.0723, 0.07413, 0.07586, 0.07765, 0.07966, 0.08147, 0.08296, 0.08436, 0.0859, 0.08764, 0.08958, 0.09157, 0.0932, 0.09463, 0.09596, 0.09728, 0.09882, 0.10033, 0.10172, 0.10302, 0.10447, 0.10608, 0.10739, 0.10817, 0.1084, 0.10844, 0.10837, 0.10842, 0.10919, 0.11014, 0.11097, 0.11202, 0.1131, 0.11414, 0.11535, 0.1166, 0.118, 0.11961, 0.12134, 0.12296, 0.1242, 0.1254, 0.12693, 0.12871, 0.13054, 0.13239, 0.13436, 0.13636, 0.13836, 0.14037, 0.14255, 0.1449, 0.14712, 0.14926, 0.1511, 0.15253, 0.15396, 0.15541, 0.15698, 0.15887, 0.16084, 0.16276, 0.16479, 0.16682, 0.16856, 0.17007, 0.17162, 0.17342, 0.17553, 0.17763, 0.1796, 0.18152, 0.1834, 0.18513, 0.18661, 0.1876, 0.18849, 0.18969, 0.19097, 0.19218, 0.19319, 0.19387, 0.19434, 0.19471, 0.19512, 0.19562, 0.19637, 0.19718, 0.19776, 0.19806, 0.19824, 0.1986, 0.19919, 0.19988, 0.20099, 0.20254, 0.20385, 0.20499, 0.20611, 0.2071, 0.20798, 0.20885, 0.20989, 0.21098, 0.21202, 0.21311, 0.21428, 0.21518, 0.21574, 0.21623, 0.21675, 0.21712, 0.21705, 0.21679, 0.21677, 0.21702, 0.2176, 0.21832, 0.21875, 0.21875, 0.21854, 0.21839, 0.2181, 0.21749, 0.21676, 0.21585, 0.21489, 0.214, 0.21326, 0.21271, 0.21225, 0.21175, 0.21124, 0.21094, 0.21089, 0.21082, 0.21024, 0.2094, 0.20867, 0.20807, 0.20782, 0.20775, 0.20745, 0.20671, 0.20572, 0.20461, 0.20342, 0.20235, 0.20133, 0.20006, 0.19866, 0.19731, 0.19613, 0.19508, 0.1942, 0.1935, 0.19255, 0.19136, 0.19043, 0.19, 0.18947, 0.18844, 0.18718, 0.18586, 0.18453, 0.18301, 0.18143, 0.18016, 0.1791, 0.17832, 0.17788, 0.17777, 0.17775, 0.17711, 0.17583, 0.17447, 0.17325, 0.17212, 0.17093, 0.16956, 0.16825, 0.16696, 0.16532, 0.16372, 0.16223, 0.16046, 0.15858, 0.15679, 0.15511, 0.15387, 0.15307, 0.15217, 0.1509, 0.14937, 0.14783, 0.14615, 0.14417, 0.14215, 0.14013, 0.13777, 0.13523, 0.1329, 0.13082, 0.12903, 0.12756, 0.12628, 0.12518, 0.12452, 0.12414, 0.12353, 0.12249, 0.12092, 0.11878, 0.11618, 0.11339, 0.11073, 0.10833, 0.10628, 0.10459, 0.103, 0.10135, 0.09946, 0.09743, 0.09542, 0.0934, 0.09167, 0.09039, 0.08931, 0.0881, 0.08675, 0.08542, 0.08412, 0.08297, 0.0821, 0.08122, 0.08007, 0.07889, 0.07791, 0.07725, 0.07699, 0.07668, 0.07599, 0.07502, 0.07395, 0.07264, 0.07119, 0.06977, 0.06869, 0.06768, 0.06605, 0.06387, 0.06181, 0.06043, 0.05958, 0.05895, 0.05832, 0.05797, 0.05756, 0.05694, 0.05604, 0.05498, 0.05432, 0.05377, 0.05304, 0.05252, 0.05258, 0.05277, 0.05258, 0.05241, 0.05236, 0.05187, 0.05101, 0.05037, 0.05004, 0.04991, 0.04989, 0.04961, 0.04936, 0.04943, 0.04946, 0.0493, 0.04923, 0.04926, 0.04917, 0.04912, 0.04936, 0.04992, 0.0506, 0.05115, 0.05135, 0.05152, 0.05183, 0.05165, 0.05096, 0.0504, 0.05043, 0.05088, 0.0514, 0.05136, 0.05069, 0.04988, 0.0495, 0.04982, 0.05026, 0.05042, 0.05049, 0.05063, 0.05067, 0.05067, 0.05115, 0.05221, 0.05336, 0.05461, 0.05616, 0.05761, 0.05871, 0.05964, 0.06059, 0.06175, 0.06304, 0.06432, 0.06527, 0.06564, 0.06587, 0.06622, 0.06666, 0.06755, 0.06877, 0.07003, 0.07147, 0.07276, 0.07377, 0.075, 0.07658, 0.0782, 0.07956, 0.08067, 0.08155, 0.08225, 0.08289, 0.08374, 0.08485, 0.08583, 0.08662, 0.0873, 0.08757, 0.08746, 0.0871, 0.08681, 0.08694, 0.08773, 0.08878, 0.09012, 0.09213, 0.0942, 0.09589, 0.09723, 0.09822, 0.09899, 0.09956, 0.09985, 0.10003, 0.10044, 0.10137, 0.10267, 0.10402, 0.1054, 0.10681, 0.10822, 0.1098, 0.11157, 0.11335, 0.11528, 0.11711, 0.11871, 0.1204, 0.12197, 0.12323, 0.12461, 0.12641, 0.12837, 0.13031, 0.13248, 0.13487, 0.13709, 0.13942, 0.14203, 0.14448, 0.14658, 0.14835, 0.15004, 0.15166, 0.15313, 0.15459, 0.1561, 0.1578, 0.15944, 0.16079, 0.16221, 0.16344, 0.16429, 0.16529, 0.16647, 0.16746, 0.16852, 0.17, 0.17162, 0.17302, 0.17426, 0.17543, 0.17648, 0.17752, 0.17843, 0.17918, 0.18009, 0.18159, 0.18345, 0.18527, 0.18699, 0.18864, 0.19026, 0.19202, 0.19386, 0.19555, 0.19726, 0.19904, 0.20103, 0.20311, 0.20501, 0.20693, 0.20906, 0.21131, 0.21343, 0.21566, 0.21808, 0.22016, 0.22184, 0.22365, 0.22564, 0.22753, 0.22929, 0.23086, 0.23236, 0.23396, 0.23553, 0.23694, 0.23838, 0.23993, 0.24138, 0.24253, 0.24356, 0.24441, 0.2446, 0.2443, 0.24404, 0.24401, 0.24434, 0.24509, 0.24601, 0.24681, 0.24774, 0.24864, 0.24933, 0.25034, 0.25151, 0.25232, 0.25252, 0.25192, 0.25092, 0.25023, 0.24991, 0.24959, 0.24917, 0.24874, 0.24838, 0.24816, 0.24804, 0.24796, 0.24772, 0.2473, 0.24685, 0.24638, 0.24606, 0.24602, 0.24604, 0.24606, 0.24607, 0.24602, 0.24577, 0.24508, 0.24434, 0.24392, 0.24386, 0.24383, 0.24325, 0.24226, 0.24113, 0.24021, 0.23955, 0.2391, 0.23893, 0.23905, 0.23892, 0.23811, 0.23681, 0.23525, 0.2341, 0.23319, 0.23195, 0.23091, 0.23045, 0.23022, 0.22973, 0.22905, 0.22815, 0.22673, 0.22499, 0.22325, 0.22173, 0.22068, 0.21992, 0.21919, 0.21806, 0.21652, 0.21484, 0.21284, 0.21072, 0.20877, 0.20705, 0.20561, 0.2043, 0.20292, 0.20133, 0.19947, 0.19712, 0.19463, 0.1925, 0.19039, 0.18848, 0.18701, 0.18592, 0.18508, 0.1839, 0.18224, 0.18079, 0.17938, 0.17742, 0.17504, 0.17294, 0.17113, 0.16917, 0.16719, 0.16552, 0.16437, 0.16328, 0.16145, 0.15896, 0.15649, 0.1544, 0.15253, 0.15084, 0.14953, 0.14852, 0.14773, 0.14699, 0.14571, 0.14358, 0.14148, 0.13978, 0.13783, 0.13554, 0.13347, 0.1316, 0.12962, 0.12786, 0.12657, 0.12532, 0.12394, 0.12251, 0.12099, 0.11947, 0.11797, 0.11667, 0.11524, 0.11361, 0.11222, 0.11091, 0.10916, 0.10669, 0.10402, 0.1014, 0.09843, 0.0953, 0.09259, 0.09028, 0.08785, 0.08532, 0.08267, 0.08032, 0.07876, 0.07731, 0.07538, 0.07316, 0.07091, 0.06853, 0.06614, 0.06428, 0.06276, 0.06107, 0.05924, 0.05774, 0.05626, 0.05464, 0.05344, 0.05297, 0.05326, 0.05347, 0.05294, 0.05179, 0.05023, 0.04862, 0.04715, 0.04562, 0.04428, 0.04344, 0.04316, 0.04304, 0.0425, 0.04146, 0.03993, 0.03855, 0.03787, 0.03747, 0.03691, 0.03592, 0.03443, 0.03277, 0.03139, 0.03025, 0.02913, 0.0283, 0.02757, 0.02668, 0.02612, 0.02585, 0.02571, 0.02577, 0.02575, 0.02572, 0.0257, 0.02514, 0.02411, 0.02289, 0.02129, 0.01953, 0.01805, 0.01724, 0.0168, 0.01642, 0.01616, 0.01597, 0.01604, 0.01615, 0.01627, 0.01673, 0.01762, 0.01844, 0.01898, 0.01962, 0.02024, 0.02064, 0.02099, 0.02187, 0.0233, 0.02501, 0.02671, 0.02813, 0.02955, 0.031, 0.03222, 0.03308, 0.03367, 0.03413, 0.03443, 0.03437, 0.03424, 0.03395, 0.03346, 0.03308, 0.03293, 0.03303, 0.03337, 0.03427, 0.03575, 0.03715, 0.03827, 0.03927, 0.04035, 0.04164, 0.04275, 0.04341, 0.04354, 0.04335, 0.04356, 0.04438, 0.04513, 0.04561, 0.04639, 0.04771, 0.04944, 0.05123, 0.05256, 0.05345, 0.05429, 0.05533, 0.05653, 0.05788, 0.05942, 0.06129, 0.06372, 0.06617, 0.06833, 0.07049, 0.07276, 0.07522, 0.07786, 0.08048, 0.08282, 0.08484, 0.08649, 0.08793, 0.08968, 0.0917, 0.09363, 0.09557, 0.09769, 0.09982, 0.10167, 0.10339, 0.1051, 0.10669, 0.10852, 0.11091, 0.11349, 0.11607, 0.11851, 0.12071, 0.12229, 0.12327, 0.12466, 0.12649, 0.12845, 0.13066, 0.13297, 0.13535, 0.13767, 0.13966, 0.14166, 0.14358, 0.14516, 0.14668, 0.14814, 0.14985, 0.152, 0.15433, 0.15661, 0.15888, 0.16116, 0.16348, 0.16626, 0.16936, 0.17234, 0.17517, 0.17783, 0.18032, 0.1828, 0.18507, 0.18707, 0.1892, 0.19161, 0.19404, 0.19659, 0.19946, 0.20239, 0.20509, 0.20762, 0.21014, 0.21273, 0.2154, 0.21822, 0.22134, 0.22441, 0.22723, 0.23002, 0.23294, 0.2361, 0.2392, 0.2419, 0.24446, 0.24713, 0.24975, 0.2523, 0.2547, 0.25681, 0.25833, 0.25923, 0.26026, 0.26171, 0.26346, 0.2653, 0.26726, 0.26924, 0.27099, 0.27257, 0.27411, 0.27567, 0.27706, 0.27849, 0.27986, 0.28108, 0.28227, 0.28337, 0.28463, 0.28599, 0.28714, 0.28789, 0.28855, 0.28953, 0.29054, 0.2911, 0.29155, 0.29234, 0.29322, 0.29384, 0.29446, 0.29507, 0.29558, 0.29637, 0.29752, 0.29856, 0.29928, 0.29991, 0.3009, 0.30213, 0.30301, 0.30377, 0.30449, 0.30489, 0.30519, 0.30536, 0.30527, 0.30497, 0.30463, 0.3045, 0.30462, 0.30476, 0.30451, 0.30421, 0.30409, 0.30379, 0.30323, 0.30262, 0.30173, 0.30035, 0.29916, 0.29858, 0.29813, 0.29756, 0.29698, 0.29634, 0.29561, 0.29475, 0.29358, 0.29229, 0.29136, 0.29066, 0.28977, 0.28863, 0.28727, 0.28595, 0.28517, 0.28473, 0.28388, 0.28301, 0.28233, 0.28137, 0.28005, 0.27846, 0.27655, 0.2744, 0.27245, 0.27089, 0.2694, 0.26741, 0.26532, 0.26367, 0.26203, 0.25989, 0.25698, 0.25406, 0.2512, 0.24807, 0.24518, 0.24302, 0.24072, 0.23772, 0.23466, 0.23202, 0.23004, 0.22814, 0.22608, 0.2237, 0.22083, 0.21772, 0.21452, 0.2114, 0.2086, 0.20624, 0.20388, 0.20154, 0.1995, 0.19793, 0.19643, 0.19459, 0.19264, 0.19037, 0.18784, 0.18543, 0.18332, 0.18191, 0.18116, 0.18059, 0.17984, 0.1785, 0.17665, 0.17468, 0.17252, 0.17016, 0.16791, 0.16581, 0.16339, 0.16042, 0.15695, 0.15323, 0.14994, 0.14703, 0.14407, 0.14111, 0.13852, 0.13568, 0.13271, 0.13025, 0.12786, 0.12555, 0.12302, 0.12005, 0.11712, 0.11455, 0.11225, 0.11009, 0.10781, 0.10528, 0.10263, 0.10023, 0.0983, 0.09675, 0.0958, 0.09482, 0.09342, 0.09131, 0.08838, 0.08522, 0.08203, 0.07822, 0.07476, 0.07122, 0.06704, 0.06278, 0.05906, 0.05574, 0.05299, 0.05082, 0.0488, 0.04688, 0.04515, 0.04337, 0.04131, 0.03897, 0.03656, 0.03422, 0.03179, 0.02935, 0.02687, 0.02435, 0.02169, 0.01911, 0.0167, 0.01399, 0.01088, 0.00781, 0.00542, 0.00392, 0.00291, 0.00159, 0.00037, -0.00026, -0.00087, -0.00136, -0.00231, -0.00356, -0.0049, -0.00646, -0.00821, -0.00995, -0.01192, -0.01409, -0.01573, -0.01669, -0.01789, -0.01963, -0.02193, -0.0245, -0.02695, -0.02937, -0.03175, -0.03399, -0.03582, -0.03723, -0.03825, -0.03877, -0.03896, -0.03914, -0.03967, -0.04092, -0.04272, -0.04403, -0.04508, -0.04606, -0.04666, -0.04692, -0.0466, -0.04564, -0.0446, -0.04351, -0.04236, -0.04128, -0.04074, -0.04054, -0.04008, -0.0397, -0.03967, -0.0398, -0.03967, -0.03905, -0.03809, -0.03691, -0.03549, -0.03391, -0.03249, -0.03117, -0.02986, -0.02839, -0.02661, -0.02469, -0.02304, -0.02172, -0.02038, -0.01885, -0.01733, -0.01563, -0.0138, -0.01226, -0.01072, -0.00912, -0.00783, -0.00656, -0.0053, -0.00403, -0.00297, -0.00235, -0.00184, -0.00112, 0.00018, 0.00168, 0.00296, 0.0043, 0.00575, 0.00744, 0.00911, 0.01072, 0.01262, 0.01499, 0.01732, 0.01941, 0.02147, 0.0238, 0.026, 0.0276, 0.02883, 0.03025, 0.03195, 0.03383, 0.03573, 0.03784, 0.03984, 0.04172, 0.04355, 0.04532, 0.04729, 0.04946, 0.05235, 0.05585, 0.05921, 0.0621, 0.06453, 0.06692, 0.06937, 0.07165, 0.0737, 0.07617, 0.07918, 0.08221, 0.08484, 0.08678, 0.08864, 0.09032, 0.09189, 0.09379, 0.09636, 0.09927, 0.10223, 0.10516, 0.10808, 0.11121, 0.11416, 0.11658, 0.11913, 0.12169, 0.12386, 0.12612, 0.12869, 0.13125, 0.13378, 0.1365, 0.13949, 0.14252, 0.14563, 0.14871, 0.15207, 0.15544, 0.1584, 0.16136, 0.16425, 0.16718, 0.17046, 0.17391, 0.17705, 0.18025, 0.18366, 0.18723, 0.19049, 0.19322, 0.19588, 0.19845, 0.20125, 0.20417, 0.20699, 0.20958, 0.21215, 0.2146, 0.21695, 0.21938, 0.22188, 0.22443, 0.22691, 0.22899, 0.23101, 0.23336, 0.23589, 0.23822, 0.24042, 0.24268, 0.245, 0.24738, 0.24986, 0.25231, 0.25453, 0.25629, 0.25776, 0.2595, 0.26154, 0.26345, 0.26554, 0.26794, 0.2705, 0.27284, 0.2747, 0.27634, 0.2778, 0.27901, 0.27996, 0.28081, 0.2818, 0.28278, 0.28353, 0.28417, 0.2852, 0.28655, 0.28772, 0.28864, 0.28978, 0.29133, 0.29256, 0.29405, 0.29608, 0.29828, 0.30034, 0.30208, 0.30351, 0.30443, 0.30473, 0.30482, 0.30468, 0.30431, 0.30422, 0.30425, 0.30427, 0.30501, 0.30621, 0.30741, 0.30855, 0.3093, 0.30964, 0.30966, 0.3097, 0.30978, 0.30966, 0.30897, 0.30819, 0.30745, 0.30679, 0.30636, 0.30573, 0.30504, 0.3042, 0.30338, 0.30283, 0.30262, 0.30217, 0.30175, 0.30136, 0.30072, 0.29982, 0.2988, 0.29819, 0.29792, 0.29753, 0.29686, 0.29593, 0.29494, 0.29375, 0.29236, 0.29145, 0.29093, 0.29025, 0.28956, 0.2889, 0.28807, 0.28679, 0.28522, 0.28386, 0.28275, 0.28194, 0.28131, 0.28064, 0.28019, 0.28003, 0.28004, 0.27955, 0.27818, 0.27636, 0.27462, 0.27317, 0.27188, 0.27096, 0.27012, 0.26921, 0.26823, 0.26681, 0.2652, 0.26348, 0.26165, 0.25993, 0.25826, 0.25651, 0.25456, 0.25244, 0.25037, 0.24842, 0.24666, 0.24531, 0.2445, 0.24348, 0.24205, 0.2409, 0.23975, 0.23829, 0.23632, 0.2339, 0.23145, 0.22899};
+const double vEOPx[] = {-0.13307, -0.135, -0.1371, -0.1392, -0.14116, -0.14283, -0.14412, -0.14511, -0.14592, -0.14666, -0.14746, -0.14844, -0.14963, -0.15086, -0.15192, -0.15265, -0.15308, -0.1533, -0.15347, -0.15368, -0.15391, -0.15418, -0.15456, -0.15508, -0.15574, -0.15651, -0.15734, -0.15802, -0.15834, -0.1582, -0.15777, -0.15723, -0.15667, -0.15619, -0.15584, -0.1556, -0.1554, -0.15516, -0.15487, -0.15457, -0.15427, -0.15395, -0.15361, -0.15328, -0.15301, -0.15285, -0.15285, -0.15299, -0.15315, -0.15317, -0.15292, -0.1523, -0.15142, -0.15046, -0.14963, -0.1489, -0.14808, -0.14703, -0.14578, -0.1445, -0.14332, -0.14223, -0.14117, -0.14002, -0.13872, -0.13732, -0.13584, -0.13423, -0.13248, -0.13078, -0.1294, -0.12831, -0.12744, -0.12671, -0.12604, -0.1253, -0.12417, -0.12245, -0.12021, -0.11764, -0.11494, -0.11231, -0.10998, -0.10801, -0.10605, -0.10395, -0.10178, -0.09973, -0.09788, -0.09615, -0.09432, -0.0923, -0.0902, -0.08806, -0.08587, -0.08373, -0.08181, -0.07998, -0.07812, -0.07619, -0.07427, -0.07229, -0.07022, -0.06824, -0.06637, -0.06444, -0.06231, -0.05998, -0.05745, -0.05471, -0.05179, -0.04876, -0.04564, -0.04248, -0.03933, -0.03623, -0.03312, -0.03001, -0.02693, -0.02388, -0.02083, -0.01788, -0.01517, -0.01286, -0.01094, -0.00892, -0.00673, -0.00443, -0.002, 0.00054, 0.00308, 0.0055, 0.00784, 0.01012, 0.01239, 0.01473, 0.01715, 0.01958, 0.02207, 0.02461, 0.02716, 0.02965, 0.03203, 0.03426, 0.0363, 0.03817, 0.04012, 0.0422, 0.04436, 0.04655, 0.04873, 0.05096, 0.05332, 0.05572, 0.05814, 0.06063, 0.06326, 0.06607, 0.06908, 0.07216, 0.07519, 0.07803, 0.08062, 0.08296, 0.08521, 0.08756, 0.09016, 0.09289, 0.09555, 0.09798, 0.1002, 0.10227, 0.10426, 0.10625, 0.10837, 0.11066, 0.11301, 0.11527, 0.11732, 0.11909, 0.12057, 0.12196, 0.12348, 0.12529, 0.12743, 0.12976, 0.13204, 0.13406, 0.13575, 0.13719, 0.13856, 0.14004, 0.14166, 0.1434, 0.14524, 0.14724, 0.14933, 0.15148, 0.15371, 0.15602, 0.1583, 0.1605, 0.16269, 0.16481, 0.16673, 0.16838, 0.16962, 0.17043, 0.17093, 0.17135, 0.17189, 0.17261, 0.17344, 0.17431, 0.17503, 0.17581, 0.17671, 0.17791, 0.17916, 0.18034, 0.18141, 0.18233, 0.18314, 0.18398, 0.18502, 0.18629, 0.18767, 0.18897, 0.19006, 0.1909, 0.19164, 0.19237, 0.19304, 0.19362, 0.19414, 0.19473, 0.19554, 0.19655, 0.1978, 0.19934, 0.20115, 0.20311, 0.20498, 0.2065, 0.20753, 0.2081, 0.20833, 0.20843, 0.20855, 0.20882, 0.20932, 0.21006, 0.21097, 0.21195, 0.21295, 0.21386, 0.21459, 0.21503, 0.21513, 0.21488, 0.21436, 0.21372, 0.21309, 0.21254, 0.21208, 0.21183, 0.2118, 0.2119, 0.21201, 0.21205, 0.21194, 0.21165, 0.21121, 0.21051, 0.20954, 0.2083, 0.20694, 0.20579, 0.20517, 0.20508, 0.20531, 0.20558, 0.20563, 0.2053, 0.20459, 0.20368, 0.20266, 0.20152, 0.20029, 0.19922, 0.19832, 0.19759, 0.19701, 0.19648, 0.19579, 0.1947, 0.19317, 0.19122, 0.18901, 0.18669, 0.1844, 0.18222, 0.18017, 0.17823, 0.17633, 0.17449, 0.17274, 0.17117, 0.16978, 0.16848, 0.16715, 0.16578, 0.16452, 0.16361, 0.16305, 0.1625, 0.16155, 0.16005, 0.15807, 0.15576, 0.15331, 0.15086, 0.14855, 0.14642, 0.14448, 0.14261, 0.14069, 0.13855, 0.13609, 0.1332, 0.13007, 0.12686, 0.1237, 0.12071, 0.11797, 0.11536, 0.11272, 0.10989, 0.10683, 0.10364, 0.1004, 0.09709, 0.09377, 0.09052, 0.0874, 0.0845, 0.08188, 0.07959, 0.07766, 0.07594, 0.0742, 0.07227, 0.07007, 0.06758, 0.06489, 0.06217, 0.05946, 0.05672, 0.05392, 0.05114, 0.04847, 0.04598, 0.04373, 0.04169, 0.03981, 0.03806, 0.03643, 0.03484, 0.03315, 0.03128, 0.02938, 0.02745, 0.02549, 0.02347, 0.02149, 0.01967, 0.01806, 0.01656, 0.01518, 0.0139, 0.01262, 0.0113, 0.01002, 0.00886, 0.0077, 0.00639, 0.00486, 0.00308, 0.0009, -0.00164, -0.00428, -0.00671, -0.00876, -0.01052, -0.01214, -0.01379, -0.01555, -0.0174, -0.01926, -0.02109, -0.02292, -0.02475, -0.02657, -0.02836, -0.03008, -0.03175, -0.03333, -0.03463, -0.03568, -0.03664, -0.03775, -0.03918, -0.0409, -0.0429, -0.0451, -0.04738, -0.0496, -0.0516, -0.05324, -0.05448, -0.05548, -0.05637, -0.05743, -0.05865, -0.05993, -0.06121, -0.06253, -0.06384, -0.06502, -0.06605, -0.06686, -0.06745, -0.06785, -0.06812, -0.06822, -0.06819, -0.06813, -0.06827, -0.06874, -0.06949, -0.07039, -0.07123, -0.0719, -0.07226, -0.07247, -0.07276, -0.07326, -0.07386, -0.07443, -0.07502, -0.07576, -0.07673, -0.07787, -0.07908, -0.08021, -0.08132, -0.08246, -0.08356, -0.08455, -0.08545, -0.08636, -0.0876, -0.08912, -0.09074, -0.09225, -0.09353, -0.09451, -0.09521, -0.09577, -0.0963, -0.09685, -0.09751, -0.09828, -0.09906, -0.09982, -0.1005, -0.10113, -0.10165, -0.10198, -0.10211, -0.10204, -0.10182, -0.1015, -0.10117, -0.10083, -0.10046, -0.10007, -0.09977, -0.09968, -0.09965, -0.09957, -0.09951, -0.0996, -0.09993, -0.10042, -0.10088, -0.10124, -0.10137, -0.10119, -0.10066, -0.09982, -0.09888, -0.09802, -0.0974, -0.09701, -0.09681, -0.09675, -0.09685, -0.09706, -0.09723, -0.09732, -0.09725, -0.09694, -0.09648, -0.09598, -0.09558, -0.09544, -0.09566, -0.09586, -0.0956, -0.09502, -0.09432, -0.09367, -0.09312, -0.09263, -0.09203, -0.09117, -0.09001, -0.08864, -0.08719, -0.08579, -0.08453, -0.08349, -0.0827, -0.08216, -0.0818, -0.08135, -0.0806, -0.07988, -0.07935, -0.07895, -0.07849, -0.07785, -0.07701, -0.07613, -0.07547, -0.07505, -0.07473, -0.07431, -0.07359, -0.07237, -0.07055, -0.06856, -0.06651, -0.0644, -0.06229, -0.06018, -0.05815, -0.05633, -0.05482, -0.05348, -0.05217, -0.05085, -0.04957, -0.04838, -0.04739, -0.04671, -0.04621, -0.04578, -0.04527, -0.04451, -0.04346, -0.04229, -0.04135, -0.04066, -0.04008, -0.03954, -0.03891, -0.03798, -0.03659, -0.03513, -0.03373, -0.03228, -0.03079, -0.02929, -0.02779, -0.02627, -0.02497, -0.02375, -0.02247, -0.02121, -0.02007, -0.01903, -0.01808, -0.0171, -0.01598, -0.01473, -0.01336, -0.01179, -0.00985, -0.00744, -0.00485, -0.00236, -0.00018, 0.00155, 0.00288, 0.00403, 0.00523, 0.00664, 0.00835, 0.01039, 0.01273, 0.01528, 0.01803, 0.02092, 0.02379, 0.02661, 0.02933, 0.03182, 0.03404, 0.03611, 0.03826, 0.04071, 0.04347, 0.04617, 0.04852, 0.0506, 0.05249, 0.05418, 0.05581, 0.05759, 0.05973, 0.06225, 0.06505, 0.06784, 0.07057, 0.07329, 0.07599, 0.07867, 0.08135, 0.08405, 0.0868, 0.08957, 0.09234, 0.095, 0.09741, 0.09958, 0.1016, 0.10357, 0.10553, 0.10759, 0.10956, 0.11133, 0.11302, 0.11477, 0.11664, 0.11865, 0.12074, 0.12267, 0.12445, 0.12635, 0.12859, 0.13114, 0.1338, 0.13624, 0.13827, 0.13987, 0.14111, 0.14216, 0.14312, 0.14409, 0.14514, 0.14618, 0.14711, 0.14797, 0.14887, 0.14982, 0.15079, 0.15185, 0.153, 0.15428, 0.15574, 0.1573, 0.15883, 0.16027, 0.16163, 0.16268, 0.16337, 0.1638, 0.16406, 0.16425, 0.16457, 0.16525, 0.16626, 0.16737, 0.16843, 0.16934, 0.17008, 0.17082, 0.17193, 0.17338, 0.17498, 0.17648, 0.17775, 0.17881, 0.17976, 0.18069, 0.18154, 0.18223, 0.18277, 0.18313, 0.18324, 0.18315, 0.18305, 0.18299, 0.18306, 0.18327, 0.18354, 0.18376, 0.18383, 0.1838, 0.18369, 0.18348, 0.18323, 0.18298, 0.18281, 0.18277, 0.18279, 0.18291, 0.18322, 0.18365, 0.18417, 0.18471, 0.18515, 0.1854, 0.18552, 0.18569, 0.18603, 0.18656, 0.18724, 0.18799, 0.1886, 0.18905, 0.18916, 0.18889, 0.18837, 0.18781, 0.18735, 0.18716, 0.18707, 0.18681, 0.18628, 0.18543, 0.18429, 0.18296, 0.18156, 0.1802, 0.17891, 0.1777, 0.17654, 0.17542, 0.17439, 0.17351, 0.17263, 0.17157, 0.17036, 0.16904, 0.16768, 0.16645, 0.16546, 0.16456, 0.16362, 0.16267, 0.16175, 0.16093, 0.16018, 0.15944, 0.15858, 0.15751, 0.15618, 0.15459, 0.1529, 0.15133, 0.14989, 0.14844, 0.14688, 0.1452, 0.14347, 0.14172, 0.13994, 0.13822, 0.13661, 0.13499, 0.13327, 0.13142, 0.12952, 0.12763, 0.12579, 0.124, 0.12222, 0.12048, 0.1188, 0.11717, 0.11549, 0.11368, 0.11182, 0.10996, 0.10806, 0.10608, 0.10404, 0.10207, 0.10017, 0.09829, 0.09644, 0.09466, 0.09286, 0.09092, 0.08879, 0.08661, 0.08452, 0.08254, 0.08056, 0.07861, 0.07674, 0.07498, 0.07336, 0.07177, 0.07014, 0.06849, 0.06693, 0.06556, 0.06436, 0.06308, 0.06154, 0.05958, 0.05721, 0.05457, 0.05195, 0.04966, 0.04756, 0.04541, 0.04291, 0.04001, 0.03687, 0.03372, 0.03081, 0.02837, 0.02641, 0.02458, 0.0227, 0.0207, 0.01851, 0.01609, 0.01345, 0.01086, 0.00848, 0.00633, 0.00423, 0.00191, -0.00071, -0.00355, -0.00624, -0.00869, -0.01093, -0.01317, -0.01565, -0.01852, -0.0217, -0.02491, -0.02789, -0.0306, -0.0331, -0.03556, -0.03811, -0.04093, -0.04392, -0.04687, -0.04968, -0.05238, -0.05501, -0.05762, -0.06033, -0.06295, -0.06526, -0.06725, -0.06909, -0.07107, -0.07352, -0.07654, -0.07994, -0.08336, -0.08658, -0.08939, -0.0916, -0.09326, -0.09463, -0.09585, -0.09699, -0.09817, -0.0996, -0.10147, -0.10394, -0.10685, -0.10985, -0.11263, -0.11507, -0.11719, -0.11918, -0.12129, -0.12362, -0.12605, -0.12825, -0.1301, -0.13162, -0.13296, -0.13428, -0.13568, -0.13709, -0.13852, -0.13998, -0.14144, -0.14284, -0.14407, -0.1449, -0.14538, -0.14575, -0.14618, -0.14672, -0.14731, -0.14791, -0.14858, -0.14943, -0.15041, -0.15143, -0.15243, -0.15323, -0.15361, -0.15345, -0.15287, -0.15221, -0.15175, -0.15156, -0.15148, -0.15137, -0.1516, -0.1521, -0.15265, -0.15296, -0.15283, -0.15242, -0.15195, -0.1516, -0.15147, -0.15162, -0.15212, -0.15291, -0.1536, -0.15388, -0.15407, -0.15434, -0.15476, -0.15537, -0.15616, -0.15703, -0.15781, -0.15837, -0.15877, -0.15904, -0.15913, -0.15901, -0.15875, -0.15843, -0.15799, -0.157, -0.1554, -0.15329, -0.15092, -0.14859, -0.14646, -0.14458, -0.14293, -0.14147, -0.14014, -0.13879, -0.13724, -0.13549, -0.13381, -0.13226, -0.13092, -0.12987, -0.12915, -0.12865, -0.12817, -0.12737, -0.12627, -0.12502, -0.12369, -0.12227, -0.12079, -0.11934, -0.11795, -0.11675, -0.11588, -0.11531, -0.11508, -0.11518, -0.11553, -0.11587, -0.11585, -0.11513, -0.11384, -0.11194, -0.1094, -0.10637, -0.10319, -0.10026, -0.09791, -0.09619, -0.09499, -0.09402, -0.09285, -0.0911, -0.089, -0.08692, -0.08506, -0.08344, -0.08197, -0.08049, -0.07883, -0.07673, -0.07399, -0.07071, -0.06714, -0.0635, -0.05993, -0.05652, -0.05325, -0.04996, -0.04663, -0.04331, -0.04006, -0.03695, -0.03415, -0.03168, -0.02955, -0.02769, -0.02606, -0.02441, -0.02233, -0.01967, -0.01673, -0.01381, -0.01107, -0.00871, -0.00676, -0.00501, -0.00318, -0.00081, 0.00257, 0.00697, 0.01203, 0.01711, 0.02169, 0.02564, 0.02905, 0.03213, 0.03516, 0.0383, 0.04151, 0.0447, 0.04796, 0.05123, 0.05437, 0.05732, 0.06019, 0.06309, 0.06601, 0.06907, 0.07222, 0.07555, 0.07902, 0.08249, 0.08581, 0.0889, 0.09176, 0.09474, 0.09818, 0.10183, 0.10558, 0.10955, 0.11373, 0.11796, 0.1221, 0.1261, 0.12991, 0.13353, 0.13705, 0.14056, 0.14405, 0.14759, 0.15129, 0.15526, 0.15946, 0.16373, 0.16779, 0.1715, 0.17483, 0.17794, 0.18101, 0.18403, 0.18693, 0.18959, 0.19186, 0.19379, 0.19553, 0.19724, 0.19913, 0.20124, 0.20343, 0.20552, 0.20752, 0.20949, 0.21143, 0.21341, 0.21543, 0.21753, 0.21974, 0.22221, 0.22501, 0.22811, 0.23135, 0.23454, 0.23755, 0.2405, 0.24334, 0.24596, 0.24829, 0.25036, 0.25225, 0.25417, 0.25621, 0.25841, 0.26074, 0.26312, 0.26545, 0.2676, 0.26948, 0.27106, 0.2723, 0.27319, 0.27387, 0.27454, 0.27536, 0.27635, 0.27748, 0.27874, 0.28004, 0.28121, 0.28218, 0.28306, 0.28398, 0.2849, 0.28565, 0.28617, 0.28649, 0.28675, 0.28707, 0.28742, 0.28759, 0.28763, 0.2877, 0.28785, 0.28798, 0.28797, 0.28777, 0.28759, 0.28747, 0.28729, 0.28693, 0.28647, 0.286, 0.28541, 0.28455, 0.28356, 0.2825, 0.28135, 0.28027, 0.27944, 0.27886, 0.27826, 0.27753, 0.27669, 0.2758, 0.27482, 0.27367, 0.27226, 0.27057, 0.2689, 0.26744, 0.26607, 0.26455, 0.26259, 0.26014, 0.25759, 0.25524, 0.25308, 0.251, 0.24901, 0.2471, 0.24509, 0.24278, 0.24034, 0.23806, 0.236, 0.23401, 0.23203, 0.22987, 0.22734, 0.22457, 0.22185, 0.21931, 0.21703, 0.21491, 0.21264, 0.20993, 0.20687, 0.2037, 0.20047, 0.19721, 0.19398, 0.19094, 0.18817, 0.18557, 0.1829, 0.18004, 0.17705, 0.17413, 0.17133, 0.16834, 0.16513, 0.16179, 0.15857, 0.15555, 0.15266, 0.14979, 0.14698, 0.14418, 0.14124, 0.13801, 0.13447, 0.1306, 0.12648, 0.12251, 0.11868, 0.11476, 0.11074, 0.10659, 0.10237, 0.09823, 0.09438, 0.0909, 0.0878, 0.08463, 0.08104, 0.07713, 0.07322, 0.06974, 0.06688, 0.06446, 0.06199, 0.05903, 0.05544, 0.05133, 0.047, 0.04271, 0.03866, 0.03498, 0.03157, 0.02827, 0.02502, 0.02185, 0.01858, 0.01504, 0.01129, 0.00745, 0.00364, -0.0001, -0.00384, -0.00757, -0.01133, -0.01508, -0.01867, -0.02196, -0.02516, -0.02888, -0.03313, -0.03757, -0.04181, -0.04582, -0.04985, -0.05401, -0.05807, -0.06182, -0.0653, -0.06866, -0.07209, -0.07578, -0.07998, -0.08476, -0.08989, -0.09501, -0.09982, -0.10435, -0.10867, -0.11268, -0.11623, -0.11939, -0.12246, -0.12552, -0.12881, -0.13239, -0.13586, -0.13865, -0.14103, -0.14331, -0.14561, -0.14793, -0.1503, -0.15264, -0.15487, -0.15692, -0.15876, -0.16056, -0.16243, -0.16443, -0.1665, -0.16859, -0.17062, -0.17256, -0.1744, -0.17603, -0.1773, -0.17832, -0.17937, -0.18051, -0.18181, -0.18349, -0.18533, -0.187, -0.18871, -0.19064, -0.19272, -0.19479, -0.1967, -0.19835, -0.19967, -0.20082, -0.20214, -0.20356, -0.20507, -0.20661, -0.20819, -0.20977, -0.21108, -0.21201, -0.2128, -0.21383, -0.21526, -0.21695, -0.21859, -0.21992, -0.2209, -0.22154, -0.22191, -0.22216, -0.22248, -0.22299, -0.22365, -0.22444, -0.22514, -0.22528, -0.22468, -0.2235, -0.22207, -0.22075, -0.21962, -0.21881, -0.21848, -0.21867, -0.21938, -0.22035, -0.22113, -0.22145, -0.22145, -0.22127, -0.22086, -0.22036, -0.21995, -0.21951, -0.21882, -0.21769, -0.21614, -0.21435, -0.21247, -0.21056, -0.20864, -0.20689, -0.20536, -0.204, -0.20268, -0.20127, -0.19978, -0.19828, -0.19664, -0.19479, -0.19283, -0.19072, -0.1882, -0.18511, -0.18183, -0.17902, -0.17687, -0.17515, -0.17336, -0.17123, -0.16868, -0.16574, -0.16268, -0.15978, -0.157, -0.15431, -0.15176, -0.14946, -0.14746, -0.14573, -0.14402, -0.14221, -0.14029, -0.13807, -0.13533, -0.13228, -0.12944, -0.12667, -0.12364, -0.12017, -0.11645, -0.11281, -0.10958, -0.10663, -0.10381, -0.10098, -0.09802, -0.0948, -0.0913, -0.08775, -0.08433, -0.08079, -0.07687, -0.07257, -0.06813, -0.06383, -0.05992, -0.05651, -0.05328, -0.04983, -0.04607, -0.04211, -0.03801, -0.03373, -0.02928, -0.02482, -0.02043, -0.01602, -0.01162, -0.00736, -0.00349, -0.00012, 0.00305, 0.00634, 0.00982, 0.0134, 0.01703, 0.02084, 0.02506, 0.02968, 0.03457, 0.03966, 0.04475, 0.04952, 0.05379, 0.0576, 0.06135, 0.06541, 0.06976, 0.07413, 0.07837, 0.08251, 0.08669, 0.09072, 0.09445, 0.09793, 0.10136, 0.10502, 0.10906, 0.11337, 0.1178, 0.12216, 0.12637, 0.1304, 0.13417, 0.13777, 0.14143, 0.14521, 0.14908, 0.15294, 0.15667, 0.16009, 0.16318, 0.16627, 0.1694, 0.17251, 0.17572, 0.17897, 0.18211, 0.18517, 0.18839, 0.19188, 0.19568, 0.1997, 0.20373, 0.20759, 0.21129, 0.21506, 0.21866, 0.22179, 0.22473, 0.22761, 0.23042, 0.23299, 0.23521, 0.23718, 0.23882, 0.24009, 0.24122, 0.2425, 0.24391, 0.24537, 0.24698, 0.24874, 0.25064, 0.25257, 0.25436, 0.25599, 0.25755, 0.25915, 0.26066, 0.26206, 0.26352, 0.26523, 0.26728, 0.2697, 0.2722, 0.27437, 0.2762, 0.27795, 0.27988, 0.28202, 0.2841, 0.28588, 0.2873, 0.28857, 0.28993, 0.29131, 0.2926, 0.29384, 0.29499, 0.29599, 0.29675, 0.29719, 0.2974, 0.29757, 0.29794, 0.29808, 0.2979, 0.2975, 0.29701, 0.29646, 0.29586, 0.29538, 0.2948, 0.29418, 0.29348, 0.29282, 0.29237, 0.29198, 0.29135, 0.29034, 0.28907, 0.28762, 0.28614, 0.28482, 0.28381, 0.28311, 0.28256, 0.28204, 0.28132, 0.28028, 0.27884, 0.27713, 0.27542, 0.27371, 0.27205, 0.27042, 0.26882, 0.26728, 0.26566, 0.26373, 0.2617, 0.25976, 0.25787, 0.25599, 0.25405, 0.25193, 0.24966, 0.24726, 0.24481, 0.24238, 0.23988, 0.23736, 0.23504, 0.23278, 0.23032, 0.22775, 0.22515, 0.22262, 0.22005, 0.21725, 0.21421, 0.21122, 0.20865, 0.20655, 0.20463, 0.20252, 0.2, 0.19715, 0.19426, 0.19138, 0.1884, 0.18522, 0.18183, 0.17817, 0.17407, 0.16994, 0.1661, 0.16237, 0.15857, 0.15454, 0.15033, 0.14598, 0.14147, 0.13736, 0.13398, 0.13096, 0.12793, 0.12492, 0.12207, 0.11917, 0.11595, 0.11248, 0.1088, 0.10498, 0.1012, 0.09737, 0.09345, 0.0895, 0.08573, 0.08219, 0.07865, 0.07489, 0.07078, 0.0665, 0.06232, 0.05832, 0.05441, 0.05048, 0.04659, 0.04292, 0.03959, 0.03659, 0.03369, 0.03073, 0.02764, 0.02446, 0.02129, 0.01811, 0.015, 0.01217, 0.00968, 0.00729, 0.00459, 0.00139, -0.00223, -0.00615, -0.01033, -0.01473, -0.01916, -0.02322, -0.02694, -0.03045, -0.03375, -0.03699, -0.04044, -0.04406, -0.04748, -0.05046, -0.05329, -0.05616, -0.05903, -0.06171, -0.06406, -0.06614, -0.06813, -0.07006, -0.07204, -0.07425, -0.07687, -0.07976, -0.08243, -0.08502, -0.08778, -0.09064, -0.09374, -0.09689, -0.09992, -0.10285, -0.10564, -0.10841, -0.11144, -0.11449, -0.11731, -0.11996, -0.12257, -0.12488, -0.12684, -0.12861, -0.13045, -0.13234, -0.13426, -0.13629, -0.13839, -0.14047, -0.14263, -0.14498, -0.14757, -0.15022, -0.15269, -0.15506, -0.15719, -0.15901, -0.16055, -0.16173, -0.16321, -0.16513, -0.16757, -0.17005, -0.17217, -0.1738, -0.17491, -0.17566, -0.17633, -0.17722, -0.17847, -0.18017, -0.18213, -0.18407, -0.18558, -0.18635, -0.18657, -0.18646, -0.18645, -0.18684, -0.18759, -0.18829, -0.18867, -0.18886, -0.18919, -0.1895, -0.18963, -0.18957, -0.18942, -0.18949, -0.18993, -0.19038, -0.19073, -0.19103, -0.19119, -0.19101, -0.19031, -0.18929, -0.18824, -0.18724, -0.18634, -0.18549, -0.18451, -0.18341, -0.18236, -0.18134, -0.18037, -0.17966, -0.17922, -0.17885, -0.17836, -0.17769, -0.17681, -0.17581, -0.17483, -0.17399, -0.17331, -0.17267, -0.17175, -0.17042, -0.16875, -0.16702, -0.16555, -0.16446, -0.16349, -0.16236, -0.16087, -0.15887, -0.15636, -0.15353, -0.15071, -0.14804, -0.14532, -0.1424, -0.13934, -0.13638, -0.13378, -0.1316, -0.12958, -0.12749, -0.12513, -0.12241, -0.11945, -0.11647, -0.11356, -0.11069, -0.10817, -0.10588, -0.10362, -0.10136, -0.09909, -0.0967, -0.09418, -0.09177, -0.0895, -0.08727, -0.08499, -0.08261, -0.08006, -0.07737, -0.07487, -0.07258, -0.07034, -0.06797, -0.06518, -0.06181, -0.05804, -0.05428, -0.05056, -0.04689, -0.04328, -0.03968, -0.03605, -0.03239, -0.02878, -0.02507, -0.0212, -0.01717, -0.01299, -0.00887, -0.00495, -0.00122, 0.0025, 0.00641, 0.01056, 0.01489, 0.01929, 0.02358, 0.02754, 0.03131, 0.03505, 0.03877, 0.04262, 0.04675, 0.05096, 0.05483, 0.05836, 0.06179, 0.06533, 0.06896, 0.07255, 0.07587, 0.07882, 0.08161, 0.08457, 0.08795, 0.09171, 0.09555, 0.09915, 0.10245, 0.10549, 0.10811, 0.1104, 0.1126, 0.11495, 0.11754, 0.12033, 0.12331, 0.12641, 0.12946, 0.13238, 0.13521, 0.13787, 0.14025, 0.14249, 0.14474, 0.14698, 0.14917, 0.15135, 0.15354, 0.15564, 0.1576, 0.15948, 0.1613, 0.16311, 0.165, 0.16703, 0.16922, 0.17167, 0.17425, 0.17686, 0.17937, 0.18165, 0.18379, 0.18596, 0.18813, 0.19027, 0.19248, 0.19492, 0.1976, 0.20036, 0.2029, 0.20492, 0.20651, 0.20803, 0.2097, 0.21142, 0.21288, 0.21421, 0.21553, 0.21672, 0.21753, 0.21791, 0.21802, 0.21813, 0.21849, 0.21915, 0.21991, 0.22064, 0.22124, 0.22163, 0.22172, 0.22151, 0.22123, 0.22105, 0.22098, 0.22102, 0.22111, 0.22127, 0.22152, 0.22176, 0.22194, 0.22215, 0.22241, 0.22262, 0.22267, 0.22255, 0.22245, 0.22263, 0.22315, 0.22383, 0.22443, 0.22491, 0.22532, 0.2256, 0.22581, 0.22616, 0.22682, 0.22767, 0.22822, 0.22816, 0.22772, 0.2271, 0.22634, 0.22543, 0.2242, 0.22264, 0.22097, 0.21944, 0.21828, 0.21752, 0.21699, 0.2165, 0.21594, 0.21529, 0.21466, 0.21406, 0.21344, 0.21271, 0.2117, 0.21037, 0.20881, 0.20717, 0.20552, 0.204, 0.20274, 0.2017, 0.20067, 0.19926, 0.19753, 0.19581, 0.19412, 0.19232, 0.19039, 0.18838, 0.18617, 0.18368, 0.18101, 0.17828, 0.17576, 0.17367, 0.17203, 0.17043, 0.16861, 0.16643, 0.16399, 0.16151, 0.15913, 0.1571, 0.15544, 0.1539, 0.15204, 0.14961, 0.14675, 0.14385, 0.14116, 0.13896, 0.13713, 0.13503, 0.13243, 0.12958, 0.12663, 0.12364, 0.12081, 0.11812, 0.11551, 0.11287, 0.11013, 0.10737, 0.10475, 0.10241, 0.10015, 0.0978, 0.09539, 0.09297, 0.09051, 0.088, 0.08536, 0.08249, 0.07941, 0.07616, 0.07276, 0.06948, 0.06665, 0.06374, 0.06056, 0.05735, 0.05424, 0.05119, 0.04807, 0.0448, 0.04142, 0.03804, 0.03477, 0.03164, 0.02864, 0.02588, 0.02332, 0.02048, 0.01743, 0.01432, 0.01119, 0.00804, 0.00477, 0.00141, -0.00184, -0.00482, -0.00749, -0.00995, -0.01238, -0.015, -0.01787, -0.02057, -0.02295, -0.025, -0.0268, -0.02844, -0.03005, -0.03192, -0.03451, -0.03767, -0.0411, -0.04462, -0.04791, -0.05085, -0.05348, -0.05572, -0.0574, -0.05857, -0.05952, -0.06057, -0.06192, -0.06351, -0.06518, -0.06682, -0.0684, -0.07, -0.07161, -0.07325, -0.07483, -0.0761, -0.07715, -0.07834, -0.08007, -0.0823, -0.08465, -0.0869, -0.08892, -0.09079, -0.09279, -0.09477, -0.09647, -0.09787, -0.0992, -0.1006, -0.10217, -0.10393, -0.10584, -0.10765, -0.10899, -0.10985, -0.11044, -0.11107, -0.11192, -0.1129, -0.11369, -0.11405, -0.11406, -0.11391, -0.11374, -0.11364, -0.11377, -0.11413, -0.11461, -0.11499, -0.11488, -0.11451, -0.11404, -0.11368, -0.11357, -0.1136, -0.11366, -0.1137, -0.11365, -0.11346, -0.11311, -0.11276, -0.11269, -0.11292, -0.11319, -0.11333, -0.11345, -0.11364, -0.11391, -0.1142, -0.11442, -0.11451, -0.11444, -0.11422, -0.11384, -0.11334, -0.11283, -0.11234, -0.11186, -0.11135, -0.11088, -0.11055, -0.11029, -0.11002, -0.10988, -0.10986, -0.10959, -0.10915, -0.10865, -0.10806, -0.10758, -0.10739, -0.10734, -0.10707, -0.10646, -0.1058, -0.10523, -0.10474, -0.10444, -0.1045, -0.10463, -0.10451, -0.1041, -0.10357, -0.10296, -0.10213, -0.10119, -0.10043, -0.09992, -0.09932, -0.0983, -0.09694, -0.09527, -0.09356, -0.0917, -0.08984, -0.08808, -0.08637, -0.08461, -0.08285, -0.08129, -0.07977, -0.07813, -0.07617, -0.07376, -0.07101, -0.06815, -0.06548, -0.06292, -0.06043, -0.05791, -0.05532, -0.05274, -0.05019, -0.0477, -0.0452, -0.04269, -0.04015, -0.03766, -0.03523, -0.0329, -0.03068, -0.02852, -0.02643, -0.02444, -0.02249, -0.02057, -0.01866, -0.01651, -0.0142, -0.01181, -0.00927, -0.00667, -0.00417, -0.00184, 0.00023, 0.00213, 0.00399, 0.0059, 0.00779, 0.00978, 0.01197, 0.01412, 0.0161, 0.01794, 0.01993, 0.02222, 0.02477, 0.02759, 0.03055, 0.03325, 0.03547, 0.03742, 0.03947, 0.0417, 0.04396, 0.0462, 0.04839, 0.05045, 0.05237, 0.05423, 0.05616, 0.05824, 0.06056, 0.06311, 0.06554, 0.06764, 0.06949, 0.07121, 0.07293, 0.07485, 0.07719, 0.07986, 0.08252, 0.08499, 0.08727, 0.08939, 0.09142, 0.09328, 0.09503, 0.09692, 0.09919, 0.10173, 0.10422, 0.10635, 0.10797, 0.10924, 0.11054, 0.1121, 0.11395, 0.1159, 0.11764, 0.11914, 0.12036, 0.12137, 0.12231, 0.12328, 0.12424, 0.12531, 0.12655, 0.12809, 0.12981, 0.13149, 0.13299, 0.13431, 0.13569, 0.13724, 0.13883, 0.1402, 0.14129, 0.14209, 0.14288, 0.14399, 0.14531, 0.1467, 0.14808, 0.14929, 0.15029, 0.1512, 0.15184, 0.15224, 0.15254, 0.15295, 0.15351, 0.15419, 0.15504, 0.15607, 0.15718, 0.15829, 0.15946, 0.16069, 0.16189, 0.16284, 0.16327, 0.16321, 0.16326, 0.16363, 0.16422, 0.16488, 0.16552, 0.16618, 0.16665, 0.16666, 0.16622, 0.16548, 0.1647, 0.16418, 0.16385, 0.16328, 0.16205, 0.16017, 0.1582, 0.15644, 0.1549, 0.15378, 0.15288, 0.15192, 0.151, 0.15023, 0.14927, 0.14804, 0.14709, 0.14654, 0.14595, 0.14502, 0.14378, 0.14236, 0.14093, 0.13974, 0.13876, 0.13797, 0.13743, 0.1372, 0.13728, 0.13757, 0.13808, 0.13895, 0.14016, 0.14145, 0.14242, 0.14288, 0.14307, 0.14317, 0.14316, 0.1429, 0.14237, 0.14181, 0.14129, 0.14068, 0.13976, 0.13866, 0.13787, 0.13751, 0.13722, 0.13682, 0.13648, 0.13633, 0.1362, 0.13584, 0.13499, 0.13356, 0.13155, 0.12926, 0.12705, 0.12494, 0.1228, 0.12072, 0.11897, 0.11761, 0.11662, 0.11617, 0.1162, 0.11631, 0.11602, 0.1152, 0.11408, 0.11291, 0.1117, 0.11061, 0.10946, 0.10816, 0.10668, 0.10509, 0.10348, 0.10201, 0.101, 0.10042, 0.09971, 0.09847, 0.09676, 0.09479, 0.09271, 0.09082, 0.08925, 0.08797, 0.08687, 0.08579, 0.08453, 0.08277, 0.08089, 0.0794, 0.07853, 0.07824, 0.07816, 0.07772, 0.07656, 0.07496, 0.07317, 0.07146, 0.07007, 0.069, 0.0682, 0.06749, 0.06665, 0.06557, 0.06443, 0.06336, 0.06228, 0.06112, 0.06005, 0.05889, 0.0576, 0.05618, 0.05465, 0.05299, 0.05122, 0.04988, 0.04903, 0.04827, 0.04741, 0.0466, 0.04565, 0.04417, 0.0421, 0.03938, 0.03643, 0.03383, 0.03176, 0.02993, 0.02804, 0.02606, 0.02397, 0.02191, 0.02014, 0.01874, 0.01747, 0.01591, 0.01388, 0.01214, 0.01108, 0.01056, 0.0102, 0.00965, 0.00889, 0.00816, 0.00741, 0.00634, 0.00487, 0.00316, 0.00159, 0.00028, -0.00097, -0.00219, -0.00357, -0.00525, -0.0069, -0.00794, -0.00828, -0.00839, -0.00859, -0.00919, -0.01035, -0.01187, -0.01346, -0.0148, -0.01572, -0.01643, -0.01712, -0.01787, -0.01848, -0.01882, -0.01906, -0.01919, -0.01915, -0.01897, -0.01898, -0.01932, -0.01979, -0.02013, -0.02033, -0.02044, -0.02045, -0.02047, -0.02068, -0.02126, -0.02217, -0.02305, -0.02367, -0.02403, -0.02433, -0.02465, -0.02508, -0.02575, -0.02658, -0.02729, -0.02787, -0.02852, -0.02919, -0.02975, -0.0303, -0.03074, -0.03104, -0.03131, -0.03151, -0.03166, -0.03198, -0.03255, -0.03292, -0.03298, -0.03283, -0.03255, -0.03233, -0.0323, -0.03233, -0.03215, -0.03192, -0.03199, -0.03234, -0.0326, -0.03256, -0.03235, -0.03223, -0.03207, -0.0317, -0.03109, -0.03036, -0.02962, -0.02882, -0.0279, -0.02695, -0.02614, -0.02547, -0.02493, -0.02458, -0.02445, -0.02466, -0.02515, -0.02562, -0.02581, -0.02568, -0.0253, -0.02472, -0.02408, -0.02353, -0.02335, -0.02361, -0.0239, -0.02394, -0.02377, -0.02343, -0.02292, -0.02228, -0.02156, -0.02077, -0.01979, -0.0185, -0.01703, -0.01567, -0.0147, -0.01408, -0.01374, -0.01349, -0.01314, -0.01266, -0.01215, -0.01175, -0.01163, -0.0115, -0.01095, -0.01023, -0.00971, -0.00921, -0.00859, -0.00816, -0.00816, -0.0084, -0.00861, -0.00851, -0.00831, -0.0081, -0.00774, -0.0072, -0.00669, -0.0064, -0.0063, -0.00613, -0.00567, -0.00479, -0.00362, -0.00238, -0.00122, -0.00033, 0.00015, 0.00047, 0.00095, 0.00169, 0.0025, 0.00313, 0.00359, 0.00397, 0.00427, 0.00443, 0.0046, 0.00497, 0.00543, 0.00554, 0.0053, 0.00507, 0.0051, 0.00535, 0.00565, 0.00591, 0.00618, 0.00645, 0.0067, 0.00718, 0.00784, 0.00853, 0.00924, 0.00988, 0.01054, 0.01139, 0.01241, 0.01338, 0.01402, 0.01425, 0.0141, 0.01385, 0.01381, 0.01408, 0.01457, 0.01515, 0.01579, 0.01642, 0.01684, 0.01724, 0.01779, 0.01838, 0.01895, 0.01954, 0.02006, 0.02041, 0.02059, 0.02085, 0.02136, 0.022, 0.02269, 0.0233, 0.02384, 0.02424, 0.02444, 0.02459, 0.02498, 0.02574, 0.02683, 0.02785, 0.02856, 0.02889, 0.02885, 0.0288, 0.02931, 0.0304, 0.03168, 0.03272, 0.03322, 0.03324, 0.03297, 0.0326, 0.03224, 0.03193, 0.03182, 0.0321, 0.03271, 0.03339, 0.03395, 0.03433, 0.03457, 0.0348, 0.03489, 0.03472, 0.0346, 0.03492, 0.03579, 0.03671, 0.03724, 0.0374, 0.03747, 0.0378, 0.03832, 0.0385, 0.03839, 0.03824, 0.03805, 0.0377, 0.03716, 0.03669, 0.03666, 0.0372, 0.03809, 0.03909, 0.04013, 0.04122, 0.04214, 0.04263, 0.04298, 0.0433, 0.04354, 0.0436, 0.04345, 0.04322, 0.04324, 0.04351, 0.04374, 0.04376, 0.04369, 0.04383, 0.04434, 0.04526, 0.04646, 0.0476, 0.04857, 0.04957, 0.05076, 0.05203, 0.0532, 0.05428, 0.05518, 0.05587, 0.05631, 0.05653, 0.05665, 0.05702, 0.05736, 0.05735, 0.05714, 0.05701, 0.05704, 0.0573, 0.05771, 0.05831, 0.05908, 0.06002, 0.0611, 0.06228, 0.06359, 0.06486, 0.06585, 0.06629, 0.06624, 0.06609, 0.06622, 0.06678, 0.06742, 0.06803, 0.0686, 0.06911, 0.0693, 0.06912, 0.06882, 0.06845, 0.06797, 0.06747, 0.06704, 0.0667, 0.06651, 0.06649, 0.06673, 0.06721, 0.06771, 0.06803, 0.0683, 0.06861, 0.06891, 0.06947, 0.07049, 0.07186, 0.07317, 0.07408, 0.07457, 0.07476, 0.07484, 0.07468, 0.07433, 0.074, 0.07383, 0.07391, 0.07407, 0.07408, 0.07403, 0.07385, 0.07351, 0.07316, 0.07286, 0.07284, 0.07347, 0.07446, 0.07528, 0.07589, 0.07657, 0.07707, 0.07715, 0.07718, 0.07738, 0.07766, 0.07789, 0.07832, 0.07923, 0.08042, 0.08142, 0.08199, 0.08217, 0.08222, 0.08231, 0.08236, 0.08231, 0.08238, 0.08251, 0.08263, 0.08292, 0.08348, 0.08421, 0.08503, 0.08586, 0.08668, 0.08752, 0.0884, 0.08916, 0.08973, 0.09003, 0.08996, 0.0896, 0.08913, 0.08858, 0.08801, 0.08755, 0.08731, 0.08747, 0.08811, 0.0889, 0.08956, 0.09011, 0.09057, 0.09093, 0.09148, 0.0923, 0.09327, 0.09408, 0.09454, 0.09463, 0.09485, 0.09539, 0.0962, 0.0974, 0.099, 0.10076, 0.10242, 0.10389, 0.10517, 0.10649, 0.10777, 0.10886, 0.10983, 0.11094, 0.11195, 0.11247, 0.11255, 0.1125, 0.11274, 0.11321, 0.11351, 0.11359, 0.11366, 0.11317, 0.1122, 0.11101, 0.10984, 0.10889, 0.10814, 0.10775, 0.10765, 0.10784, 0.1082, 0.10857, 0.10901, 0.10954, 0.11006, 0.11023, 0.11018, 0.10998, 0.10956, 0.10898, 0.10821, 0.1074, 0.10702, 0.10684, 0.10636, 0.10548, 0.10448, 0.10367, 0.10289, 0.10214, 0.10123, 0.10018, 0.09925, 0.0983, 0.09717, 0.09603, 0.09483, 0.09345, 0.09212, 0.09126, 0.09079, 0.09048, 0.0903, 0.08989, 0.08913, 0.08837, 0.08764, 0.08693, 0.08643, 0.08589, 0.08529, 0.0846, 0.08392, 0.08322, 0.08232, 0.08128, 0.07999, 0.07836, 0.07662, 0.07506, 0.0737, 0.07266, 0.07195, 0.07133, 0.07039, 0.0691, 0.06754, 0.06586, 0.06392, 0.06209, 0.06061, 0.05913, 0.05747, 0.0556, 0.05378, 0.05226, 0.0511, 0.05004, 0.04902, 0.04788, 0.04664, 0.04518, 0.04341, 0.04127, 0.039, 0.03666, 0.03424, 0.03188, 0.02981, 0.02777, 0.02514, 0.02211, 0.01925, 0.0169, 0.01516, 0.01369, 0.01225, 0.01065, 0.0088, 0.00689, 0.00539, 0.00419, 0.00297, 0.0017, 0.00065, -0.00061, -0.00231, -0.00421, -0.00581, -0.0073, -0.00921, -0.01113, -0.01306, -0.01465, -0.01613, -0.01762, -0.01905, -0.02048, -0.02175, -0.02294, -0.02432, -0.02619, -0.02826, -0.03035, -0.03222, -0.03399, -0.03569, -0.03743, -0.03911, -0.04058, -0.04199, -0.04331, -0.0443, -0.04555, -0.04693, -0.0483, -0.04925, -0.05002, -0.05123, -0.05235, -0.05376, -0.05516, -0.05645, -0.05769, -0.05919, -0.06072, -0.0622, -0.06369, -0.06506, -0.06596, -0.06626, -0.06648, -0.06748, -0.0691, -0.07124, -0.07314, -0.07472, -0.07564, -0.07589, -0.07582, -0.07584, -0.07612, -0.07656, -0.07708, -0.07772, -0.07845, -0.07914, -0.07938, -0.07956, -0.08007, -0.08062, -0.08086, -0.08095, -0.08127, -0.08177, -0.08231, -0.08275, -0.08334, -0.0837, -0.08382, -0.08364, -0.08274, -0.08144, -0.08018, -0.07908, -0.07813, -0.07783, -0.07817, -0.07868, -0.07865, -0.07839, -0.078, -0.07756, -0.07704, -0.07662, -0.0763, -0.07605, -0.07533, -0.07486, -0.07422, -0.07346, -0.0726, -0.07156, -0.07103, -0.07072, -0.07036, -0.07016, -0.07019, -0.0701, -0.06986, -0.06924, -0.06848, -0.06746, -0.06643, -0.06532, -0.06398, -0.0627, -0.06146, -0.0603, -0.05922, -0.0581, -0.05679, -0.05542, -0.05409, -0.05223, -0.05047, -0.04906, -0.0475, -0.04558, -0.04368, -0.04202, -0.04063, -0.03911, -0.03769, -0.03605, -0.03401, -0.03217, -0.03035, -0.02836, -0.0265, -0.02469, -0.02342, -0.02235, -0.0209, -0.01919, -0.01762, -0.0159, -0.01406, -0.01227, -0.01049, -0.00831, -0.00551, -0.00229, 0.00096, 0.00408, 0.00681, 0.0094, 0.012, 0.01421, 0.01616, 0.01729, 0.01851, 0.02035, 0.0226, 0.02451, 0.02629, 0.02881, 0.03103, 0.03337, 0.03558, 0.03803, 0.04093, 0.04389, 0.04642, 0.04869, 0.05099, 0.05357, 0.05634, 0.05915, 0.0617, 0.06462, 0.06733, 0.07029, 0.07334, 0.0764, 0.07928, 0.08181, 0.08419, 0.08637, 0.08859, 0.09067, 0.09272, 0.09475, 0.09698, 0.09916, 0.10165, 0.10438, 0.10669, 0.10846, 0.11042, 0.11298, 0.11589, 0.11856, 0.121, 0.12366, 0.12653, 0.12959, 0.13277, 0.13641, 0.13941, 0.14233, 0.14495, 0.14735, 0.14934, 0.15102, 0.15348, 0.1558, 0.15782, 0.15961, 0.16145, 0.16337, 0.16496, 0.16729, 0.16946, 0.17174, 0.17364, 0.17578, 0.17837, 0.18116, 0.18391, 0.18657, 0.18917, 0.19141, 0.19332, 0.19481, 0.19689, 0.19862, 0.2008, 0.20317, 0.20518, 0.20697, 0.20876, 0.21044, 0.21205, 0.21327, 0.21469, 0.21595, 0.21734, 0.21903, 0.22093, 0.22285, 0.22447, 0.22587, 0.22722, 0.22876, 0.23031, 0.2324, 0.2345, 0.23644, 0.23801, 0.23916, 0.24013, 0.24108, 0.24187, 0.24321, 0.24482, 0.24628, 0.24738, 0.2482, 0.24845, 0.24833, 0.24822, 0.24843, 0.24867, 0.24894, 0.24952, 0.25032, 0.25127, 0.25202, 0.25237, 0.253, 0.25374, 0.25397, 0.25376, 0.25422, 0.25424, 0.25392, 0.25353, 0.25272, 0.25182, 0.2517, 0.25195, 0.25152, 0.25099, 0.25043, 0.2495, 0.2485, 0.24805, 0.24791, 0.2479, 0.24765, 0.24713, 0.24632, 0.24531, 0.24419, 0.24363, 0.243, 0.24203, 0.24068, 0.23903, 0.23732, 0.23588, 0.23472, 0.23342, 0.23094, 0.22826, 0.22586, 0.22386, 0.22185, 0.21965, 0.21716, 0.21428, 0.2113, 0.20845, 0.206, 0.20367, 0.20104, 0.19873, 0.19594, 0.19343, 0.19099, 0.18881, 0.18621, 0.18386, 0.18122, 0.17869, 0.17648, 0.17437, 0.17243, 0.17044, 0.16833, 0.16609, 0.16329, 0.1603, 0.15708, 0.15393, 0.15081, 0.14746, 0.14462, 0.14182, 0.13948, 0.13718, 0.1348, 0.13195, 0.12881, 0.12558, 0.12247, 0.11883, 0.11514, 0.11171, 0.10832, 0.10457, 0.10121, 0.09784, 0.09452, 0.09144, 0.08854, 0.08542, 0.08238, 0.07886, 0.07538, 0.07181, 0.06863, 0.06544, 0.06171, 0.05794, 0.05477, 0.05202, 0.04898, 0.04599, 0.04305, 0.03985, 0.03604, 0.03193, 0.02746, 0.0231, 0.01936, 0.01596, 0.01284, 0.00978, 0.00663, 0.00313, -0.00062, -0.00454, -0.00858, -0.01276, -0.01646, -0.02005, -0.02358, -0.02701, -0.03035, -0.03348, -0.0363, -0.03971, -0.04299, -0.04663, -0.05041, -0.05392, -0.05686, -0.05956, -0.06163, -0.06346, -0.06547, -0.06778, -0.0698, -0.07146, -0.07334, -0.07532, -0.07774, -0.08045, -0.08262, -0.08453, -0.08659, -0.08895, -0.09166, -0.09443, -0.09741, -0.1006, -0.10361, -0.10609, -0.10815, -0.11018, -0.11262, -0.11531, -0.11846, -0.12168, -0.12453, -0.12736, -0.12942, -0.13174, -0.13455, -0.13779, -0.14099, -0.14384, -0.14666, -0.14995, -0.15261, -0.1553, -0.15771, -0.15998, -0.16198, -0.1639, -0.16585, -0.16784, -0.16922, -0.17032, -0.17133, -0.17208, -0.1726, -0.17302, -0.17356, -0.17456, -0.17531, -0.17598, -0.17665, -0.17701, -0.17749, -0.17833, -0.17909, -0.17952, -0.18001, -0.18067, -0.18181, -0.18265, -0.18303, -0.18312, -0.1826, -0.18228, -0.18173, -0.1813, -0.18066, -0.17979, -0.17923, -0.17875, -0.17841, -0.17817, -0.17771, -0.17711, -0.17657, -0.17546, -0.17499, -0.17431, -0.17359, -0.1726, -0.17238, -0.17071, -0.16887, -0.16747, -0.16642, -0.16556, -0.16421, -0.16327, -0.16228, -0.16101, -0.15984, -0.15794, -0.15606, -0.15432, -0.15334, -0.15246, -0.15142, -0.15008, -0.14848, -0.14681, -0.14524, -0.1439, -0.14201, -0.14023, -0.13846, -0.13656, -0.13409, -0.13107, -0.1284, -0.12597, -0.12347, -0.12077, -0.11853, -0.11665, -0.11439, -0.11159, -0.10871, -0.10553, -0.10229, -0.09923, -0.0969, -0.095, -0.0927, -0.09027, -0.08764, -0.08488, -0.08186, -0.07874, -0.07557, -0.07256, -0.06925, -0.06579, -0.06232, -0.05883, -0.05524, -0.05131, -0.048, -0.04502, -0.04171, -0.03823, -0.03451, -0.03078, -0.027, -0.02276, -0.01861, -0.01493, -0.01158, -0.00881, -0.00617, -0.00346, -0.00163, 0.00076, 0.00379, 0.00687, 0.00992, 0.0129, 0.01567, 0.0188, 0.02214, 0.02547, 0.0289, 0.03201, 0.03484, 0.03787, 0.04122, 0.04488, 0.04863, 0.05252, 0.05621, 0.0599, 0.06346, 0.06677, 0.06997, 0.07329, 0.07688, 0.08066, 0.08463, 0.08855, 0.09157, 0.09425, 0.09765, 0.10108, 0.10392, 0.10677, 0.10983, 0.11201, 0.11438, 0.11654, 0.11909, 0.12199, 0.12521, 0.12838, 0.13115, 0.13362, 0.13583, 0.13818, 0.14046, 0.14311, 0.1462, 0.14893, 0.15187, 0.15467, 0.15726, 0.15976, 0.16242, 0.16514, 0.16824, 0.17142, 0.17412, 0.17764, 0.18065, 0.18354, 0.18608, 0.18843, 0.19097, 0.19308, 0.19589, 0.19906, 0.20222, 0.20483, 0.2074, 0.21013, 0.21248, 0.21457, 0.21654, 0.21822, 0.21949, 0.22086, 0.2225, 0.22448, 0.22598, 0.22715, 0.22809, 0.22867, 0.22948, 0.22994, 0.23033, 0.23082, 0.23154, 0.23236, 0.23311, 0.23404, 0.23548, 0.23674, 0.23813, 0.23917, 0.2402, 0.24119, 0.24189, 0.24289, 0.24402, 0.2443, 0.24475, 0.2455, 0.24612, 0.24667, 0.24691, 0.24675, 0.24683, 0.2471, 0.24763, 0.24846, 0.24977, 0.2512, 0.25221, 0.25296, 0.25393, 0.25493, 0.25564, 0.25673, 0.25786, 0.25902, 0.25989, 0.26039, 0.2605, 0.26069, 0.26083, 0.26078, 0.26055, 0.26023, 0.25973, 0.25911, 0.25851, 0.2578, 0.25721, 0.2568, 0.25623, 0.25553, 0.25486, 0.25447, 0.25453, 0.25452, 0.2541, 0.25355, 0.25276, 0.25158, 0.25013, 0.24896, 0.24831, 0.24736, 0.24621, 0.24463, 0.24277, 0.24104, 0.23928, 0.23745, 0.23573, 0.2342, 0.23288, 0.23167, 0.23014, 0.228, 0.2253, 0.22232, 0.21944, 0.21675, 0.21437, 0.2121, 0.21046, 0.20877, 0.20678, 0.20475, 0.20268, 0.2006, 0.19844, 0.19657, 0.19466, 0.19246, 0.18986, 0.18732, 0.18496, 0.18253, 0.18004, 0.17794, 0.17553, 0.17313, 0.17092, 0.16849, 0.16586, 0.16339, 0.16119, 0.1584, 0.15453, 0.15025, 0.14661, 0.14315, 0.13989, 0.13656, 0.13296, 0.12948, 0.12583, 0.12228, 0.11873, 0.11538, 0.11156, 0.10746, 0.10355, 0.09987, 0.09637, 0.09246, 0.08899, 0.08474, 0.08061, 0.07666, 0.0728, 0.06921, 0.06587, 0.06294, 0.05997, 0.05631, 0.05299, 0.04974, 0.04627, 0.04267, 0.03903, 0.03565, 0.03239, 0.02946, 0.02628, 0.02315, 0.02042, 0.01771, 0.0146, 0.01111, 0.00758, 0.00419, 0.00098, -0.00218, -0.00519, -0.0084, -0.01235, -0.01672, -0.02088, -0.02426, -0.02709, -0.03009, -0.0329, -0.03652, -0.04013, -0.04417, -0.04808, -0.05162, -0.05455, -0.05695, -0.05914, -0.06158, -0.06425, -0.06675, -0.0691, -0.07164, -0.0742, -0.07649, -0.07874, -0.08113, -0.08342, -0.08558, -0.0885, -0.09152, -0.09453, -0.09754, -0.10067, -0.10349, -0.10591, -0.1086, -0.11106, -0.11323, -0.11526, -0.11728, -0.11899, -0.12032, -0.12168, -0.1228, -0.12429, -0.12604, -0.12767, -0.12887, -0.12994, -0.131, -0.13222, -0.13356, -0.13514, -0.13679, -0.13812, -0.13899, -0.13927, -0.13947, -0.13979, -0.14115, -0.14264, -0.14412, -0.14523, -0.14606, -0.14731, -0.14842, -0.14966, -0.1513, -0.15295, -0.15429, -0.15536, -0.15587, -0.15609, -0.15634, -0.1563, -0.15586, -0.15532, -0.15491, -0.15478, -0.15531, -0.15547, -0.15545, -0.15512, -0.15461, -0.15463, -0.15465, -0.15437, -0.15384, -0.15319, -0.15288, -0.15309, -0.15342, -0.15376, -0.15435, -0.15453, -0.15477, -0.15491, -0.15558, -0.15643, -0.15702, -0.15769, -0.15707, -0.15694, -0.15674, -0.15593, -0.15494, -0.15387, -0.15327, -0.15232, -0.15152, -0.15057, -0.14898, -0.14758, -0.14578, -0.14345, -0.14061, -0.13788, -0.13545, -0.13325, -0.13133, -0.12909, -0.12713, -0.12463, -0.12217, -0.11982, -0.11758, -0.11624, -0.11469, -0.11354, -0.11141, -0.1094, -0.10726, -0.10522, -0.10397, -0.10224, -0.10034, -0.09811, -0.09558, -0.09313, -0.09075, -0.0886, -0.08607, -0.08283, -0.08005, -0.07768, -0.07526, -0.07294, -0.07045, -0.06688, -0.06313, -0.05946, -0.05618, -0.05325, -0.0501, -0.04717, -0.04476, -0.04231, -0.03974, -0.03776, -0.03612, -0.03447, -0.03265, -0.03052, -0.02829, -0.02598, -0.02369, -0.02135, -0.01862, -0.01541, -0.0126, -0.00986, -0.007, -0.0041, -0.00105, 0.0023, 0.00584, 0.00926, 0.01243, 0.01558, 0.01842, 0.02123, 0.02431, 0.02772, 0.03143, 0.03492, 0.03813, 0.04134, 0.04474, 0.04828, 0.05167, 0.05514, 0.05856, 0.0621, 0.0658, 0.06974, 0.07405, 0.07855, 0.08289, 0.0877, 0.09196, 0.09589, 0.09977, 0.10356, 0.10722, 0.11093, 0.11472, 0.11862, 0.12262, 0.12669, 0.13047, 0.13382, 0.13681, 0.13988, 0.14308, 0.14641, 0.14962, 0.15302, 0.15665, 0.1604, 0.1639, 0.16745, 0.17054, 0.17312, 0.17562, 0.17822, 0.18096, 0.18344, 0.18631, 0.18929, 0.19197, 0.19431, 0.19713, 0.19992, 0.20248, 0.20469, 0.20681, 0.20898, 0.2113, 0.21382, 0.2165, 0.21911, 0.22139, 0.22307, 0.22475, 0.22645, 0.22815, 0.23014, 0.23213, 0.23406, 0.23588, 0.23771, 0.23949, 0.24132, 0.2431, 0.24457, 0.24601, 0.24754, 0.24913, 0.25068, 0.25226, 0.25378, 0.25493, 0.25595, 0.25696, 0.25825, 0.25921, 0.26015, 0.26117, 0.26214, 0.26334, 0.26443, 0.26525, 0.26552, 0.26553, 0.26539, 0.26511, 0.26518, 0.26505, 0.26491, 0.2647, 0.26451, 0.26461, 0.26452, 0.26423, 0.26422, 0.26423, 0.26414, 0.26403, 0.264, 0.2637, 0.26306, 0.26254, 0.26259, 0.26248, 0.26188, 0.26092, 0.26006, 0.25952, 0.25936, 0.25918, 0.25921, 0.25844, 0.25737, 0.25628, 0.25492, 0.25356, 0.25222, 0.25092, 0.24955, 0.24805, 0.24639, 0.24446, 0.24204, 0.23977, 0.23779, 0.23575, 0.23383, 0.23171, 0.22979, 0.22791, 0.22598, 0.22404, 0.22184, 0.22025, 0.21937, 0.21859, 0.21807, 0.21704, 0.21553, 0.21373, 0.21241, 0.21096, 0.2092, 0.20719, 0.20503, 0.20268, 0.20031, 0.19807, 0.19625, 0.19456, 0.19266, 0.19019, 0.1872, 0.18447, 0.18211, 0.17991, 0.17736, 0.17513, 0.17281, 0.1703, 0.16724, 0.16441, 0.16188, 0.15931, 0.1566, 0.15341, 0.14983, 0.14516, 0.14126, 0.13785, 0.13433, 0.13032, 0.12642, 0.12326, 0.12008, 0.11699, 0.11397, 0.11133, 0.10847, 0.10542, 0.10249, 0.09988, 0.09672, 0.09325, 0.08973, 0.08641, 0.08346, 0.08053, 0.07752, 0.07445, 0.07139, 0.06887, 0.0663, 0.06345, 0.06046, 0.05658, 0.0526, 0.04891, 0.04582, 0.04289, 0.03984, 0.03704, 0.03403, 0.03124, 0.02884, 0.02664, 0.0242, 0.02149, 0.01879, 0.01585, 0.0129, 0.01008, 0.00758, 0.00535, 0.00303, 0.00109, -0.00117, -0.0033, -0.00538, -0.00762, -0.01022, -0.01323, -0.0162, -0.01867, -0.02114, -0.02418, -0.02629, -0.02793, -0.02917, -0.03022, -0.03167, -0.03352, -0.036, -0.03896, -0.04205, -0.04504, -0.04776, -0.05126, -0.05419, -0.05673, -0.05883, -0.06069, -0.06259, -0.06488, -0.06776, -0.07077, -0.07386, -0.07681, -0.0795, -0.08157, -0.08288, -0.08438, -0.08662, -0.09007, -0.09307, -0.0957, -0.09796, -0.0998, -0.10136, -0.10251, -0.1043, -0.10593, -0.1084, -0.1105, -0.11216, -0.11404, -0.11535, -0.11761, -0.11897, -0.12033, -0.12161, -0.12212, -0.12305, -0.12378, -0.12446, -0.12521, -0.12602, -0.12692, -0.12815, -0.12918, -0.13004, -0.13132, -0.13169, -0.13187, -0.13197, -0.13176, -0.13212, -0.13288, -0.13416, -0.13558, -0.13694, -0.13797, -0.13866, -0.13954, -0.14024, -0.14081, -0.14086, -0.14099, -0.1412, -0.14072, -0.14016, -0.13997, -0.13974, -0.13923, -0.13878, -0.13891, -0.13909, -0.13914, -0.13856, -0.13767, -0.13594, -0.13473, -0.13354, -0.13255, -0.13301, -0.13312, -0.13295, -0.13276, -0.13209, -0.13059, -0.12837, -0.12676, -0.12508, -0.12371, -0.1215, -0.11976, -0.1185, -0.11706, -0.11592, -0.115, -0.114, -0.11255, -0.11116, -0.10969, -0.10798, -0.10607, -0.10409, -0.10243, -0.10128, -0.10067, -0.10022, -0.09965, -0.09889, -0.0979, -0.09634, -0.09522, -0.09428, -0.09326, -0.09174, -0.09095, -0.09015, -0.08952, -0.08832, -0.08716, -0.08565, -0.08387, -0.0818, -0.07998, -0.07762, -0.07586, -0.07454, -0.07339, -0.0718, -0.07004, -0.06841, -0.06691, -0.06494, -0.06281, -0.06044, -0.0579, -0.05495, -0.05151, -0.04835, -0.04516, -0.04192, -0.03859, -0.03503, -0.03193, -0.02861, -0.02519, -0.02201, -0.0192, -0.01628, -0.0131, -0.01038, -0.00758, -0.0046, -0.00193, 0.0004, 0.00267, 0.00504, 0.00743, 0.00961, 0.01204, 0.01528, 0.01823, 0.02136, 0.02409, 0.02626, 0.02814, 0.0302, 0.0327, 0.03567, 0.03866, 0.04151, 0.04394, 0.04694, 0.04995, 0.05302, 0.05605, 0.05903, 0.06141, 0.06396, 0.06642, 0.0683, 0.07036, 0.07278, 0.07551, 0.07833, 0.08107, 0.0839, 0.08629, 0.08889, 0.0917, 0.09471, 0.0973, 0.09978, 0.10268, 0.10571, 0.10872, 0.1116, 0.11452, 0.11733, 0.11968, 0.12194, 0.12406, 0.12639, 0.12831, 0.13012, 0.13232, 0.13433, 0.13612, 0.13848, 0.14101, 0.14375, 0.14676, 0.14957, 0.15219, 0.1548, 0.15676, 0.1593, 0.1616, 0.16366, 0.16536, 0.16761, 0.16943, 0.17175, 0.17394, 0.17608, 0.17804, 0.17969, 0.18095, 0.18227, 0.18347, 0.18504, 0.18642, 0.1879, 0.18981, 0.19161, 0.19344, 0.19489, 0.19554, 0.19582, 0.19628, 0.19709, 0.1978, 0.19807, 0.19821, 0.19897, 0.19985, 0.20064, 0.20133, 0.20185, 0.2026, 0.20321, 0.20345, 0.20342, 0.20323, 0.2033, 0.20356, 0.20381, 0.20436, 0.20529, 0.20576, 0.20598, 0.20595, 0.2059, 0.20598, 0.20597, 0.2059, 0.20547, 0.2051, 0.20533, 0.20587, 0.20664, 0.20715, 0.20717, 0.20701, 0.20733, 0.20813, 0.2082, 0.20803, 0.20783, 0.2078, 0.20793, 0.20803, 0.20797, 0.20803, 0.20794, 0.20773, 0.20798, 0.20789, 0.20765, 0.20751, 0.20713, 0.2069, 0.20668, 0.20603, 0.20556, 0.20504, 0.20428, 0.20304, 0.20177, 0.20059, 0.19984, 0.19947, 0.19914, 0.19845, 0.19738, 0.19591, 0.19409, 0.1922, 0.19046, 0.18881, 0.18741, 0.18613, 0.18429, 0.18188, 0.18022, 0.17842, 0.17654, 0.17484, 0.17318, 0.17173, 0.17029, 0.16931, 0.16857, 0.16743, 0.16588, 0.16445, 0.16294, 0.16145, 0.15981, 0.15816, 0.15627, 0.15464, 0.15273, 0.15102, 0.14998, 0.1491, 0.14868, 0.14863, 0.14822, 0.14795, 0.14679, 0.14508, 0.14341, 0.14181, 0.13976, 0.13738, 0.13517, 0.13356, 0.13184, 0.13004, 0.12858, 0.12726, 0.12579, 0.12411, 0.12159, 0.11926, 0.11702, 0.11465, 0.1123, 0.11001, 0.1076, 0.1054, 0.10302, 0.10056, 0.09754, 0.09462, 0.09194, 0.0892, 0.08651, 0.08365, 0.0815, 0.07883, 0.07601, 0.0731, 0.06985, 0.06679, 0.06407, 0.06154, 0.05926, 0.05716, 0.05466, 0.05173, 0.0485, 0.04535, 0.04265, 0.0401, 0.03772, 0.03546, 0.03329, 0.03153, 0.03016, 0.02918, 0.02767, 0.02584, 0.02409, 0.0218, 0.01936, 0.01701, 0.0151, 0.01276, 0.01058, 0.00875, 0.00676, 0.0046, 0.00217, 0.00032, -0.00141, -0.00266, -0.00378, -0.00554, -0.00695, -0.00808, -0.00901, -0.00985, -0.01076, -0.0118, -0.01338, -0.01533, -0.01666, -0.01784, -0.01927, -0.02089, -0.02254, -0.02479, -0.02696, -0.02894, -0.03078, -0.03236, -0.03353, -0.03435, -0.03507, -0.03552, -0.03666, -0.03851, -0.04064, -0.04257, -0.04409, -0.04542, -0.04614, -0.04678, -0.04786, -0.04938, -0.05097, -0.05241, -0.05386, -0.05497, -0.05581, -0.05683, -0.05775, -0.05842, -0.05881, -0.05885, -0.05849, -0.05784, -0.05731, -0.05727, -0.05792, -0.05905, -0.06004, -0.06064, -0.06082, -0.06078, -0.06067, -0.06073, -0.06078, -0.06138, -0.06209, -0.06305, -0.06452, -0.06579, -0.06676, -0.06748, -0.06833, -0.06927, -0.07004, -0.07064, -0.07102, -0.07127, -0.07142, -0.07133, -0.07043, -0.06902, -0.06806, -0.06717, -0.06602, -0.06458, -0.06294, -0.0616, -0.06046, -0.05998, -0.05959, -0.05915, -0.05857, -0.05822, -0.05764, -0.0567, -0.05554, -0.05441, -0.05334, -0.05254, -0.05206, -0.05144, -0.05057, -0.04954, -0.04834, -0.04719, -0.04625, -0.04577, -0.04514, -0.04449, -0.0438, -0.04285, -0.04161, -0.04043, -0.03994, -0.03992, -0.04004, -0.03941, -0.03852, -0.03752, -0.03621, -0.03445, -0.0328, -0.03133, -0.02991, -0.02863, -0.02765, -0.02663, -0.02563, -0.02441, -0.02306, -0.02171, -0.02052, -0.01974, -0.01916, -0.01837, -0.01697, -0.01545, -0.01402, -0.01299, -0.01212, -0.01128, -0.01033, -0.00934, -0.00819, -0.00645, -0.00456, -0.0029, -0.00122, 0.00079, 0.00295, 0.00483, 0.00664, 0.00869, 0.01109, 0.01381, 0.01625, 0.01829, 0.02002, 0.02158, 0.02281, 0.02386, 0.02488, 0.02604, 0.02721, 0.02844, 0.02985, 0.03132, 0.03274, 0.03425, 0.03561, 0.03699, 0.03825, 0.03944, 0.04058, 0.04145, 0.04193, 0.04192, 0.04201, 0.0421, 0.04232, 0.0428, 0.0436, 0.04469, 0.046, 0.04724, 0.0485, 0.04941, 0.05009, 0.05046, 0.05039, 0.05015, 0.05018, 0.05091, 0.0519, 0.05255, 0.05265, 0.05266, 0.0531, 0.05364, 0.05438, 0.05535, 0.05624, 0.05678, 0.05711, 0.05783, 0.05856, 0.05876, 0.05871, 0.05863, 0.05898, 0.0599, 0.06089, 0.06214, 0.06325, 0.06398, 0.06451, 0.06497, 0.06514, 0.0653, 0.06572, 0.06628, 0.06697, 0.06795, 0.06922, 0.07051, 0.07089, 0.07099, 0.07101, 0.07101, 0.07093, 0.07089, 0.07088, 0.07056, 0.07011, 0.06982, 0.06951, 0.06945, 0.07013, 0.07115, 0.07228, 0.0729, 0.07306, 0.07306, 0.07291, 0.07267, 0.07255, 0.07244, 0.07221, 0.07152, 0.07082, 0.07001, 0.06925, 0.06913, 0.06949, 0.06975, 0.06921, 0.06886, 0.068, 0.06686, 0.06591, 0.0652, 0.06534, 0.0661, 0.06696, 0.06769, 0.06839, 0.0688, 0.06908, 0.06892, 0.06846, 0.06775, 0.06697, 0.06635, 0.0662, 0.06609, 0.06615, 0.06594, 0.06529, 0.06427, 0.06342, 0.06316, 0.0634, 0.06417, 0.06467, 0.06498, 0.06507, 0.06472, 0.06396, 0.06277, 0.06225, 0.06191, 0.06128, 0.06055, 0.05945, 0.05815, 0.05694, 0.0559, 0.0548, 0.05371, 0.05264, 0.0517, 0.05087, 0.05016, 0.04957, 0.0494, 0.04949, 0.04944, 0.0494, 0.04955, 0.04916, 0.04867, 0.04849, 0.04861, 0.04914, 0.04987, 0.05034, 0.05053, 0.05062, 0.05047, 0.05018, 0.05011, 0.05017, 0.05032, 0.05011, 0.05013, 0.05024, 0.05064, 0.05107, 0.0514, 0.05155, 0.05131, 0.05071, 0.05022, 0.05004, 0.05031, 0.05083, 0.05113, 0.05149, 0.05258, 0.05382, 0.05501, 0.05628, 0.05728, 0.05809, 0.05897, 0.06025, 0.06212, 0.06411, 0.06577, 0.06678, 0.0675, 0.06743, 0.06762, 0.06798, 0.06888, 0.07013, 0.07128, 0.07198, 0.07238, 0.07347, 0.07487, 0.0768, 0.07863, 0.07985, 0.08068, 0.08114, 0.08099, 0.0806, 0.08031, 0.08057, 0.08118, 0.08228, 0.0835, 0.08543, 0.08803, 0.08974, 0.09125, 0.09259, 0.09389, 0.095, 0.09614, 0.0973, 0.09794, 0.09856, 0.09916, 0.10006, 0.10074, 0.10129, 0.10202, 0.10262, 0.10324, 0.10358, 0.10403, 0.10437, 0.1044, 0.10426, 0.104, 0.10421, 0.10432, 0.10404, 0.10347, 0.10335, 0.10312, 0.10244, 0.10185, 0.10183, 0.10196, 0.10211, 0.10279, 0.10365, 0.10428, 0.10497, 0.10552, 0.10606, 0.10623, 0.10655, 0.10736, 0.10841, 0.10934, 0.10971, 0.10982, 0.1098, 0.10962, 0.10908, 0.10869, 0.10851, 0.10823, 0.10803, 0.10762, 0.10745, 0.10734, 0.10776, 0.10849, 0.10961, 0.11063, 0.111, 0.11112, 0.11132, 0.11152, 0.11184, 0.11222, 0.11297, 0.11353, 0.11435, 0.1152, 0.11593, 0.11709, 0.11832, 0.11928, 0.11998, 0.1205, 0.12112, 0.1216, 0.12217, 0.12251, 0.1225, 0.12272, 0.12306, 0.12337, 0.12336, 0.12353, 0.12384, 0.12453, 0.1251, 0.12568, 0.12597, 0.12615, 0.12631, 0.12636, 0.12636, 0.12594, 0.1255, 0.12497, 0.12482, 0.12518, 0.12564, 0.12595, 0.1263, 0.12665, 0.12753, 0.12837, 0.1288, 0.1289, 0.12885, 0.12883, 0.12872, 0.12845, 0.1281, 0.12758, 0.12687, 0.12624, 0.12595, 0.12554, 0.12448, 0.12349, 0.12271, 0.12214, 0.12159, 0.12121, 0.12081, 0.12004, 0.11943, 0.11876, 0.118, 0.11733, 0.11695, 0.11654, 0.11619, 0.116, 0.11512, 0.11381, 0.11259, 0.11135, 0.1103, 0.10932, 0.10883, 0.10855, 0.10839, 0.10846, 0.10841, 0.10784, 0.10687, 0.10601, 0.10518, 0.10441, 0.10345, 0.10211, 0.10073, 0.09942, 0.09809, 0.0966, 0.09515, 0.09403, 0.09293, 0.09169, 0.0905, 0.08965, 0.08851, 0.08713, 0.0858, 0.08457, 0.08342, 0.08242, 0.08128, 0.07978, 0.07829, 0.0773, 0.0768, 0.07616, 0.07508, 0.0738, 0.07242, 0.07083, 0.06913, 0.06735, 0.06587, 0.06463, 0.06333, 0.06186, 0.06027, 0.05855, 0.05647, 0.05422, 0.05171, 0.04926, 0.0471, 0.04508, 0.04334, 0.04167, 0.03979, 0.0374, 0.03504, 0.03265, 0.03039, 0.02835, 0.02703, 0.02611, 0.02524, 0.02435, 0.02352, 0.02228, 0.02044, 0.01825, 0.01568, 0.01316, 0.01127, 0.00984, 0.00848, 0.00719, 0.00619, 0.00522, 0.00421, 0.00349, 0.00295, 0.00219, 0.00104, -0.00055, -0.00184, -0.0025, -0.00291, -0.00316, -0.00338, -0.0038, -0.00415, -0.00431, -0.00456, -0.00512, -0.00583, -0.00655, -0.00735, -0.00887, -0.01062, -0.01243, -0.01389, -0.01488, -0.0158, -0.01685, -0.01778, -0.01862, -0.01978, -0.02125, -0.02272, -0.02422, -0.02569, -0.02687, -0.02814, -0.02967, -0.03129, -0.03294, -0.03453, -0.03583, -0.0367, -0.03746, -0.0382, -0.03856, -0.03862, -0.03868, -0.03889, -0.03933, -0.0403, -0.04152, -0.04256, -0.04343, -0.04422, -0.04492, -0.04563, -0.04667, -0.04799, -0.04896, -0.04962, -0.05013, -0.05056, -0.05115, -0.05199, -0.05258, -0.05261, -0.05209, -0.05135, -0.05078, -0.05047, -0.05026, -0.04986, -0.04954, -0.04942, -0.04947, -0.04999, -0.05132, -0.05295, -0.05453, -0.05592, -0.05675, -0.0572, -0.05758, -0.05813, -0.05897, -0.05916, -0.05872, -0.05838, -0.05799, -0.0574, -0.05698, -0.05652, -0.056, -0.05573, -0.05561, -0.05536, -0.05505, -0.05484, -0.05472, -0.05443, -0.05376, -0.05293, -0.0519, -0.05091, -0.05027, -0.04984, -0.04918, -0.04773, -0.04574, -0.04357, -0.04129, -0.03959, -0.03857, -0.03781, -0.03692, -0.03603, -0.03501, -0.0338, -0.03268, -0.03155, -0.0309, -0.03035, -0.02957, -0.02864, -0.02779, -0.02699, -0.0256, -0.02356, -0.02133, -0.01925, -0.01752, -0.01595, -0.0147, -0.01383, -0.01317, -0.01282, -0.01235, -0.01169, -0.01117, -0.01069, -0.00991, -0.00907, -0.00818, -0.00731, -0.00648, -0.00584, -0.00533, -0.00446, -0.00289, -0.00092, 0.0012, 0.00327, 0.00505, 0.0063, 0.00694, 0.0074, 0.0083, 0.00952, 0.01064, 0.01171, 0.01343, 0.01571, 0.01814, 0.02037, 0.02266, 0.02521, 0.02795, 0.03067, 0.03318, 0.03573, 0.03811, 0.04005, 0.04143, 0.0426, 0.04406, 0.04551, 0.04704, 0.0487, 0.0504, 0.05224, 0.05427, 0.05637, 0.05815, 0.05973, 0.0613, 0.0626, 0.06383, 0.06528, 0.06685, 0.06885, 0.07093, 0.0731, 0.07517, 0.07719, 0.0791, 0.0809, 0.08275, 0.08506, 0.0874, 0.08958, 0.09165, 0.09361, 0.09545, 0.09746, 0.09955, 0.10157, 0.10385, 0.10651, 0.10944, 0.11228, 0.11486, 0.11708, 0.11916, 0.12089, 0.12248, 0.12433, 0.12667, 0.12901, 0.13143, 0.13367, 0.13551, 0.13714, 0.13883, 0.14081, 0.1434, 0.14636, 0.14912, 0.15156, 0.1539, 0.1564, 0.1587, 0.16059, 0.16233, 0.16443, 0.16675, 0.16913, 0.17136, 0.17333, 0.17505, 0.17664, 0.17837, 0.18031, 0.18249, 0.18485, 0.18714, 0.18939, 0.19158, 0.19362, 0.1957, 0.19803, 0.20076, 0.20331, 0.20524, 0.20677, 0.20792, 0.20864, 0.20914, 0.20981, 0.21072, 0.21182, 0.21318, 0.21435, 0.21517, 0.21584, 0.21673, 0.21764, 0.21851, 0.21952, 0.22078, 0.22203, 0.22324, 0.22452, 0.22591, 0.22707, 0.22784, 0.22853, 0.22914, 0.22972, 0.23013, 0.23022, 0.23025, 0.2301, 0.22922, 0.22855, 0.22811, 0.22764, 0.22704, 0.22661, 0.22635, 0.22597, 0.2253, 0.22414, 0.22291, 0.22139, 0.21967, 0.21812, 0.21726, 0.21692, 0.21668, 0.21623, 0.21543, 0.21416, 0.21271, 0.21159, 0.21084, 0.21043, 0.21026, 0.20961, 0.20835, 0.2066, 0.20475, 0.20303, 0.2018, 0.20091, 0.2001, 0.19937, 0.19874, 0.19788, 0.19672, 0.19536, 0.19405, 0.1926, 0.19061, 0.18858, 0.18688, 0.18558, 0.18435, 0.1828, 0.18115, 0.17926, 0.17734, 0.17511, 0.17238, 0.16966, 0.16725, 0.16519, 0.16312, 0.16049, 0.15765, 0.15474, 0.15177, 0.14906, 0.14656, 0.14406, 0.14153, 0.13871, 0.13614, 0.1336, 0.13062, 0.12755, 0.12455, 0.12158, 0.11863, 0.11571, 0.11283, 0.10981, 0.10665, 0.10333, 0.10026, 0.09755, 0.09488, 0.09204, 0.08896, 0.08587, 0.08297, 0.07994, 0.07664, 0.07346, 0.07078, 0.06859, 0.06642, 0.06415, 0.06154, 0.05889, 0.05621, 0.05346, 0.05068, 0.04769, 0.04485, 0.04231, 0.04032, 0.03825, 0.03595, 0.03407, 0.03228, 0.03021, 0.0279, 0.0253, 0.02278, 0.02, 0.01693, 0.0141, 0.01109, 0.0079, 0.00459, 0.0014, -0.00153, -0.00418, -0.0069, -0.00944, -0.0119, -0.01487, -0.01811, -0.02081, -0.02304, -0.02527, -0.02724, -0.02871, -0.02959, -0.03066, -0.03202, -0.03401, -0.03671, -0.03974, -0.04233, -0.04454, -0.04624, -0.04767, -0.04914, -0.05028, -0.0516, -0.05318, -0.05465, -0.05615, -0.05755, -0.05893, -0.06003, -0.06099, -0.06191, -0.06276, -0.06384, -0.06529, -0.06732, -0.0695, -0.0713, -0.07304, -0.07465, -0.07646, -0.07855, -0.08046, -0.08188, -0.08329, -0.08547, -0.0879, -0.09027, -0.09257, -0.09441, -0.09602, -0.09765, -0.09958, -0.10158, -0.10338, -0.105, -0.10683, -0.10884, -0.11049, -0.1121, -0.11395, -0.11503, -0.11512, -0.11506, -0.11545, -0.11589, -0.11663, -0.11743, -0.11782, -0.11799, -0.11852, -0.11914, -0.11963, -0.11961, -0.11955, -0.11986, -0.1205, -0.12083, -0.12131, -0.12203, -0.12295, -0.12348, -0.124, -0.12476, -0.12557, -0.12606, -0.12576, -0.12537, -0.12528, -0.12573, -0.12643, -0.12691, -0.12723, -0.12742, -0.12734, -0.12744, -0.12722, -0.12685, -0.12637, -0.1254, -0.12418, -0.1228, -0.12136, -0.12011, -0.11909, -0.11814, -0.11698, -0.11574, -0.11471, -0.1134, -0.11195, -0.11066, -0.10934, -0.10801, -0.10652, -0.1049, -0.10299, -0.1009, -0.09858, -0.09632, -0.09408, -0.09143, -0.0889, -0.08613, -0.08335, -0.08074, -0.07845, -0.07625, -0.0741, -0.07222, -0.07061, -0.06871, -0.06656, -0.0645, -0.06196, -0.05894, -0.05611, -0.05359, -0.05087, -0.04792, -0.04509, -0.04296, -0.04108, -0.0389, -0.03661, -0.03418, -0.03162, -0.02905, -0.02649, -0.02364, -0.02036, -0.01697, -0.01375, -0.01094, -0.0083, -0.00568, -0.00311, 2e-05, 0.00304, 0.0062, 0.00957, 0.0128, 0.01597, 0.01895, 0.02173, 0.02441, 0.02707, 0.03001, 0.03355, 0.03685, 0.03972, 0.04246, 0.04482, 0.04731, 0.04999, 0.05285, 0.05637, 0.06022, 0.06425, 0.06792, 0.07142, 0.0746, 0.07759, 0.08095, 0.08428, 0.08834, 0.09217, 0.09612, 0.10001, 0.10379, 0.10753, 0.11124, 0.11446, 0.11732, 0.11996, 0.12263, 0.12563, 0.12905, 0.1328, 0.13644, 0.13989, 0.14324, 0.1466, 0.15007, 0.15376, 0.15708, 0.16059, 0.16388, 0.16679, 0.16958, 0.17243, 0.17518, 0.1778, 0.18038, 0.18363, 0.18701, 0.19024, 0.19359, 0.19646, 0.19944, 0.20193, 0.2042, 0.20655, 0.20875, 0.21131, 0.21357, 0.21621, 0.21883, 0.22173, 0.22466, 0.22722, 0.22985, 0.23185, 0.2342, 0.23649, 0.23882, 0.24121, 0.24336, 0.24531, 0.24788, 0.25058, 0.25295, 0.25498, 0.25721, 0.25961, 0.26231, 0.26506, 0.26779, 0.27022, 0.27284, 0.27499, 0.27673, 0.27834, 0.27941, 0.28023, 0.28102, 0.28227, 0.28368, 0.28526, 0.28698, 0.28857, 0.28993, 0.29089, 0.29139, 0.29194, 0.29239, 0.29275, 0.293, 0.29304, 0.29298, 0.29355, 0.29416, 0.29444, 0.29479, 0.29536, 0.29613, 0.29706, 0.29807, 0.29856, 0.2982, 0.29786, 0.29804, 0.29824, 0.29824, 0.29848, 0.29862, 0.2987, 0.29892, 0.2992, 0.299, 0.2987, 0.29827, 0.29789, 0.29757, 0.29725, 0.29692, 0.2965, 0.29577, 0.29448, 0.29285, 0.29143, 0.29074, 0.28931, 0.2879, 0.28589, 0.28419, 0.28221, 0.28018, 0.27838, 0.27652, 0.27475, 0.27305, 0.27132, 0.2698, 0.26827, 0.26647, 0.26459, 0.26243, 0.25989, 0.25686, 0.25434, 0.25209, 0.24968, 0.24719, 0.24483, 0.24236, 0.23965, 0.2371, 0.23479, 0.23249, 0.22974, 0.22704, 0.22448, 0.22161, 0.21891, 0.21621, 0.21374, 0.21125, 0.20839, 0.20506, 0.20119, 0.1978, 0.19524, 0.19336, 0.19112, 0.18845, 0.18575, 0.18256, 0.17946, 0.17644, 0.17337, 0.16975, 0.16653, 0.16385, 0.16087, 0.15769, 0.15404, 0.15038, 0.14667, 0.14254, 0.13848, 0.13447, 0.13087, 0.12696, 0.12329, 0.1206, 0.1185, 0.11703, 0.11536, 0.11335, 0.11092, 0.10771, 0.10445, 0.10124, 0.0983, 0.09512, 0.09168, 0.08823, 0.08461, 0.08044, 0.076, 0.07185, 0.06808, 0.06462, 0.06152, 0.05908, 0.05659, 0.05367, 0.0504, 0.04729, 0.04478, 0.04276, 0.04005, 0.03689, 0.03365, 0.03052, 0.0275, 0.02444, 0.0212, 0.01794, 0.01449, 0.01079, 0.00673, 0.00282, -0.00107, -0.00529, -0.00967, -0.01338, -0.01704, -0.0204, -0.02323, -0.02576, -0.02908, -0.03331, -0.03754, -0.04171, -0.04586, -0.04958, -0.05309, -0.05651, -0.05945, -0.06242, -0.06534, -0.06817, -0.07074, -0.07323, -0.07571, -0.0783, -0.08109, -0.08443, -0.08753, -0.09004, -0.09163, -0.09317, -0.0944, -0.09599, -0.09805, -0.1003, -0.10284, -0.10545, -0.10744, -0.10836, -0.10904, -0.11004, -0.11171, -0.11377, -0.11593, -0.11807, -0.11968, -0.12056, -0.1214, -0.12227, -0.12371, -0.12524, -0.12684, -0.12861, -0.13055, -0.1323, -0.13331, -0.13378, -0.13412, -0.13379, -0.13315, -0.13358, -0.13349, -0.1337, -0.13395, -0.1344, -0.13475, -0.13485, -0.13418, -0.13373, -0.13338, -0.13317, -0.13298, -0.1328, -0.13249, -0.13221, -0.13199, -0.13162, -0.13094, -0.13029, -0.12948, -0.12853, -0.12772, -0.12731, -0.1268, -0.12602, -0.12487, -0.12351, -0.12198, -0.12095, -0.11991, -0.11918, -0.11849, -0.11809, -0.11841, -0.11887, -0.11882, -0.11778, -0.11659, -0.11512, -0.11326, -0.11077, -0.10848, -0.10686, -0.10534, -0.10375, -0.1023, -0.10067, -0.09863, -0.09647, -0.0942, -0.09137, -0.08895, -0.08686, -0.08485, -0.08265, -0.0807, -0.07862, -0.07695, -0.07595, -0.07498, -0.07373, -0.07198, -0.06976, -0.06762, -0.06534, -0.06233, -0.05957, -0.05672, -0.05392, -0.05157, -0.04891, -0.04581, -0.04274, -0.03968, -0.03662, -0.03367, -0.03117, -0.02849, -0.02581, -0.02312, -0.02013, -0.01664, -0.01297, -0.00947, -0.00595, -0.00262, 0.00061, 0.00364, 0.00707, 0.01075, 0.01382, 0.01657, 0.0193, 0.02181, 0.02454, 0.02783, 0.03152, 0.03548, 0.0395, 0.04376, 0.04815, 0.05175, 0.05525, 0.05862, 0.06168, 0.06435, 0.06758, 0.07104, 0.07472, 0.07852, 0.08219, 0.08563, 0.08855, 0.09122, 0.09408, 0.09721, 0.1003, 0.10311, 0.10599, 0.10919, 0.11244, 0.11534, 0.11805, 0.12082, 0.1237, 0.12682, 0.13043, 0.13431, 0.13847, 0.14248, 0.14601, 0.14914, 0.15219, 0.15481, 0.15729, 0.15985, 0.16279, 0.16587, 0.16902, 0.17185, 0.17558, 0.17923, 0.18261, 0.18593, 0.18885, 0.1919, 0.19498, 0.19787, 0.20068, 0.20313, 0.20542, 0.20785, 0.21057, 0.21327, 0.21558, 0.21755, 0.21958, 0.22175, 0.22395, 0.22591, 0.22807, 0.22997, 0.23204, 0.23424, 0.23632, 0.23838, 0.24041, 0.24238, 0.24451, 0.24664, 0.24857, 0.24993, 0.25149, 0.25285, 0.25401, 0.25499, 0.25621, 0.2581, 0.25967, 0.26089, 0.26188, 0.26322, 0.26419, 0.26537, 0.26642, 0.26759, 0.26884, 0.26988, 0.27035, 0.27091, 0.27147, 0.27221, 0.27269, 0.27279, 0.27251, 0.27231, 0.2722, 0.27181, 0.27166, 0.27155, 0.27197, 0.27248, 0.27325, 0.27418, 0.27515, 0.2757, 0.2755, 0.27492, 0.27408, 0.27351, 0.27272, 0.27205, 0.27115, 0.27026, 0.26914, 0.26833, 0.26733, 0.26661, 0.26563, 0.26505, 0.26464, 0.26421, 0.26368, 0.26325, 0.26239, 0.26192, 0.26204, 0.26175, 0.26111, 0.26012, 0.25882, 0.25714, 0.25499, 0.2536, 0.25272, 0.25189, 0.25095, 0.24995, 0.24906, 0.24801, 0.2473, 0.24607, 0.2448, 0.24396, 0.24283, 0.24187, 0.24065, 0.23944, 0.23761, 0.23568, 0.23455, 0.23439, 0.23397, 0.23329, 0.23196, 0.22971, 0.22719, 0.22492, 0.22292, 0.22057, 0.2181, 0.2157, 0.21287, 0.20965, 0.20628, 0.20308, 0.20062, 0.19788, 0.19559, 0.19361, 0.19149, 0.18965, 0.18789, 0.1858, 0.18359, 0.18091, 0.17799, 0.175, 0.17217, 0.16871, 0.16522, 0.16183, 0.15897, 0.15663, 0.15444, 0.15219, 0.14965, 0.14728, 0.14505, 0.14259, 0.1403, 0.13833, 0.13614, 0.13323, 0.13045, 0.12801, 0.12552, 0.12334, 0.12175, 0.12001, 0.11817, 0.11601, 0.11387, 0.11206, 0.11039, 0.10865, 0.10678, 0.10489, 0.10282, 0.10071, 0.0987, 0.09664, 0.09469, 0.09277, 0.09045, 0.08764, 0.08429, 0.08135, 0.07788, 0.07422, 0.07057, 0.06759, 0.06491, 0.06215, 0.05911, 0.05584, 0.0524, 0.04886, 0.04501, 0.04099, 0.03708, 0.03351, 0.03066, 0.02811, 0.02561, 0.02291, 0.02071, 0.01886, 0.01784, 0.01636, 0.01413, 0.01151, 0.00872, 0.006, 0.00332, 0.00088, -0.00108, -0.00291, -0.00478, -0.00646, -0.00833, -0.01078, -0.01356, -0.01595, -0.01786, -0.01956, -0.02118, -0.02256, -0.02346, -0.0242, -0.02514, -0.02635, -0.0275, -0.02836, -0.02923, -0.03042, -0.0315, -0.03261, -0.03398, -0.03508, -0.03591, -0.03698, -0.03821, -0.03907, -0.03997, -0.04132, -0.04299, -0.04485, -0.04616, -0.04712, -0.048, -0.04875, -0.04968, -0.05084, -0.05185, -0.05257, -0.05323, -0.05391, -0.05441, -0.0545, -0.05448, -0.0547, -0.05518, -0.05602, -0.05696, -0.05767, -0.05826, -0.05894, -0.05994, -0.06075, -0.06115, -0.06157, -0.06216, -0.06294, -0.06419, -0.06581, -0.06711, -0.06783, -0.06821, -0.06844, -0.06834, -0.06815, -0.06805, -0.06846, -0.06884, -0.06893, -0.06905, -0.06919, -0.06902, -0.06884, -0.06892, -0.06936, -0.06994, -0.07033, -0.07076, -0.07106, -0.07083, -0.07081, -0.07105, -0.07112, -0.07084, -0.07031, -0.06954, -0.06837, -0.06669, -0.06494, -0.06287, -0.06058, -0.05894, -0.05782, -0.05669, -0.05556, -0.05451, -0.05334, -0.05195, -0.05058, -0.04914, -0.04743, -0.04545, -0.04351, -0.04157, -0.03948, -0.03752, -0.03569, -0.03404, -0.03259, -0.03145, -0.03043, -0.02898, -0.0274, -0.0259, -0.02415, -0.02242, -0.02085, -0.01931, -0.01731, -0.0146, -0.01198, -0.00949, -0.00663, -0.00378, -0.00119, 0.0017, 0.0049, 0.00777, 0.01027, 0.01293, 0.01592, 0.0192, 0.02227, 0.0249, 0.02759, 0.03063, 0.03409, 0.03783, 0.04127, 0.04425, 0.04714, 0.05022, 0.0535, 0.05702, 0.06079, 0.06465, 0.06794, 0.07105, 0.07439, 0.07781, 0.08095, 0.08375, 0.08629, 0.08855, 0.09081, 0.09311, 0.09545, 0.09806, 0.10036, 0.10233, 0.10417, 0.10651, 0.10939, 0.11212, 0.11458, 0.11703, 0.11949, 0.12169, 0.12378, 0.12622, 0.12883, 0.13124, 0.13335, 0.13527, 0.13727, 0.13944, 0.14163, 0.14384, 0.14589, 0.14773, 0.14961, 0.1517, 0.15388, 0.15614, 0.15848, 0.16115, 0.16403, 0.16664, 0.16895, 0.17142, 0.17449, 0.17765, 0.18024, 0.18247, 0.18454, 0.18672, 0.18918, 0.192, 0.19489, 0.19733, 0.19937, 0.20107, 0.20234, 0.20335, 0.2044, 0.20569, 0.20685, 0.20768, 0.20872, 0.21007, 0.21148, 0.21273, 0.21414, 0.21572, 0.21718, 0.21873, 0.22033, 0.22175, 0.22279, 0.22369, 0.22491, 0.22653, 0.228, 0.22933, 0.23059, 0.23149, 0.23197, 0.23236, 0.23314, 0.23416, 0.23477, 0.23513, 0.2353, 0.23529, 0.23513, 0.23473, 0.23423, 0.23402, 0.234, 0.23399, 0.23424, 0.23475, 0.23499, 0.23483, 0.23446, 0.23414, 0.23393, 0.23378, 0.23387, 0.23412, 0.2343, 0.23404, 0.23356, 0.23321, 0.23289, 0.23243, 0.23187, 0.2313, 0.23068, 0.23003, 0.22895, 0.22746, 0.22629, 0.2254, 0.22469, 0.22408, 0.22338, 0.22251, 0.22158, 0.22094, 0.22065, 0.22042, 0.22024, 0.21939, 0.21775, 0.2162, 0.21499, 0.2138, 0.21274, 0.21192, 0.21102, 0.20997, 0.20887, 0.20795, 0.20716, 0.20639, 0.20562, 0.20513, 0.20481, 0.20414, 0.20286, 0.20126, 0.19994, 0.19871, 0.19726, 0.19585, 0.19475, 0.19351, 0.19215, 0.19101, 0.18992, 0.18829, 0.18642, 0.18488, 0.18382, 0.18299, 0.18175, 0.17991, 0.17774, 0.17509, 0.17179, 0.16843, 0.16605, 0.16482, 0.1641, 0.16311, 0.16139, 0.15919, 0.15696, 0.15487, 0.1531, 0.15145, 0.14957, 0.14733, 0.14452, 0.14101, 0.13734, 0.13403, 0.13091, 0.12769, 0.12447, 0.12125, 0.11765, 0.1138, 0.11007, 0.10635, 0.1032, 0.10114, 0.09997, 0.09902, 0.09756, 0.09526, 0.09229, 0.08879, 0.08499, 0.08132, 0.07791, 0.07461, 0.07125, 0.06793, 0.06476, 0.06167, 0.05856, 0.0554, 0.05228, 0.04946, 0.04745, 0.04606, 0.0451, 0.04439, 0.04366, 0.04274, 0.04152, 0.0402, 0.03906, 0.03823, 0.03744, 0.03616, 0.03422, 0.03218, 0.03066, 0.02933, 0.02774, 0.02618, 0.02484, 0.0234, 0.02172, 0.02007, 0.01847, 0.01681, 0.01522, 0.01377, 0.01219, 0.0101, 0.00759, 0.00495, 0.00263, 0.00078, -0.00071, -0.00185, -0.00265, -0.00307, -0.00352, -0.00452, -0.00582, -0.00695, -0.00787, -0.00896, -0.01032, -0.01182, -0.01353, -0.01527, -0.01683, -0.01832, -0.01961, -0.02068, -0.02168, -0.0229, -0.02441, -0.02581, -0.02681, -0.02725, -0.02761, -0.02844, -0.02943, -0.03031, -0.03099, -0.03181, -0.03309, -0.03471, -0.03618, -0.03758, -0.03943, -0.04133, -0.04245, -0.04302, -0.04333, -0.0434, -0.04362, -0.04391, -0.0441, -0.04419, -0.04411, -0.04396, -0.04405, -0.0443, -0.04453, -0.0447, -0.04494, -0.04508, -0.0453, -0.04585, -0.04618, -0.04606, -0.04576, -0.04539, -0.0451, -0.04471, -0.04403, -0.04325, -0.04271, -0.04239, -0.04196, -0.04164, -0.04155, -0.04172, -0.04179, -0.04116, -0.03993, -0.03844, -0.03661, -0.03478, -0.03343, -0.03259, -0.03195, -0.03132, -0.0307, -0.02986, -0.02901, -0.02806, -0.02684, -0.0254, -0.02372, -0.02196, -0.02035, -0.01903, -0.018, -0.01729, -0.01646, -0.01533, -0.01424, -0.01307, -0.01163, -0.00981, -0.00775, -0.00558, -0.00327, -0.00093, 0.00178, 0.00498, 0.008, 0.01066, 0.01312, 0.01519, 0.01706, 0.01893, 0.02083, 0.02282, 0.02498, 0.02711, 0.0291, 0.03105, 0.03266, 0.03363, 0.03472, 0.03657, 0.03845, 0.0402, 0.04206, 0.0437, 0.0452, 0.04664, 0.0483, 0.05035, 0.05252, 0.05508, 0.05762, 0.05986, 0.06215, 0.06429, 0.06581, 0.06714, 0.06879, 0.07057, 0.07234, 0.07441, 0.07654, 0.07869, 0.08112, 0.08379, 0.08657, 0.089, 0.09104, 0.09311, 0.09487, 0.09624, 0.09788, 0.09986, 0.10159, 0.10312, 0.10486, 0.10696, 0.10928, 0.11177, 0.11456, 0.11721, 0.11927, 0.12113, 0.12324, 0.12558, 0.12776, 0.12965, 0.13146, 0.13308, 0.13478, 0.13664, 0.13851, 0.1403, 0.14191, 0.14318, 0.14421, 0.14544, 0.14662, 0.14766, 0.14881, 0.15022, 0.15186, 0.1536, 0.15555, 0.15742, 0.15921, 0.16101, 0.16253, 0.16389, 0.16528, 0.1665, 0.16747, 0.16858, 0.17013, 0.17212, 0.1743, 0.17617, 0.17754, 0.17865, 0.17969, 0.18061, 0.18145, 0.1821, 0.18231, 0.18212, 0.18201, 0.18222, 0.18234, 0.18236, 0.18256, 0.1825, 0.182, 0.18129, 0.18046, 0.17989, 0.17981, 0.17994, 0.18, 0.18017, 0.18076, 0.18182, 0.18296, 0.18388, 0.18488, 0.18582, 0.18629, 0.18628, 0.18613, 0.18587, 0.18556, 0.18508, 0.18459, 0.18444, 0.18469, 0.18536, 0.18618, 0.18678, 0.18698, 0.18704, 0.18729, 0.18763, 0.18769, 0.18755, 0.1875, 0.18759, 0.18758, 0.18728, 0.18689, 0.1868, 0.18702, 0.18713, 0.18684, 0.18623, 0.18549, 0.18485, 0.18473, 0.18479, 0.1843, 0.18318, 0.18175, 0.1805, 0.1794, 0.17833, 0.17745, 0.17674, 0.17605, 0.1753, 0.1744, 0.17311, 0.17159, 0.17007, 0.16842, 0.16697, 0.16625, 0.16554, 0.16412, 0.16243, 0.16111, 0.16046, 0.16011, 0.15977, 0.15947, 0.15884, 0.15767, 0.15602, 0.15465, 0.15386, 0.15297, 0.15209, 0.15123, 0.1499, 0.14844, 0.14712, 0.14571, 0.14435, 0.14262, 0.14036, 0.13804, 0.13583, 0.13407, 0.13271, 0.13134, 0.12956, 0.1277, 0.1261, 0.12444, 0.1227, 0.1207, 0.11876, 0.11739, 0.11595, 0.11453, 0.11323, 0.11139, 0.10888, 0.10643, 0.10417, 0.10178, 0.09976, 0.09836, 0.09729, 0.09612, 0.09489, 0.09353, 0.09169, 0.08954, 0.08738, 0.08542, 0.08318, 0.08067, 0.07856, 0.0765, 0.07422, 0.07186, 0.06934, 0.06675, 0.06427, 0.0618, 0.05926, 0.05687, 0.05472, 0.05299, 0.05135, 0.04933, 0.04735, 0.04569, 0.04431, 0.04316, 0.04215, 0.04126, 0.04028, 0.03882, 0.03708, 0.03565, 0.03433, 0.03299, 0.03163, 0.03058, 0.02966, 0.02833, 0.02664, 0.02466, 0.02282, 0.02151, 0.0206, 0.0201, 0.01965, 0.01906, 0.0188, 0.01888, 0.01852, 0.0178, 0.01738, 0.01687, 0.01571, 0.01439, 0.01319, 0.01211, 0.01101, 0.00972, 0.00869, 0.00774, 0.0064, 0.00494, 0.00338, 0.00164, -8e-05, -0.00152, -0.00266, -0.00371, -0.00443, -0.00467, -0.00507, -0.0058, -0.0067, -0.00757, -0.00816, -0.00883, -0.00957, -0.01034, -0.01136, -0.01227, -0.01291, -0.01339, -0.01373, -0.01367, -0.01311, -0.01234, -0.01164, -0.01089, -0.00992, -0.0089, -0.00803, -0.00725, -0.00633, -0.00524, -0.00425, -0.00347, -0.00289, -0.00237, -0.00149, -0.00032, 0.00063, 0.00134, 0.00218, 0.00331, 0.00435, 0.00526, 0.00631, 0.00769, 0.00918, 0.01052, 0.01184, 0.01335, 0.01506, 0.01628, 0.01699, 0.01752, 0.01767, 0.01776, 0.01835, 0.01968, 0.02154, 0.02367, 0.02586, 0.02778, 0.02921, 0.03035, 0.03139, 0.03227, 0.03318, 0.0342, 0.03544, 0.03705, 0.03906, 0.04106, 0.04294, 0.04462, 0.04564, 0.04626, 0.04689, 0.04773, 0.04885, 0.05016, 0.05171, 0.05327, 0.05481, 0.05651, 0.05822, 0.05994, 0.06172, 0.0635, 0.06492, 0.06597, 0.06685, 0.06762, 0.06863, 0.07008, 0.0719, 0.0737, 0.07553, 0.07734, 0.07892, 0.08084, 0.08307, 0.08529, 0.08741, 0.08946, 0.09131, 0.09277, 0.09407, 0.0956, 0.09725, 0.09889, 0.10049, 0.10248, 0.10502, 0.10768, 0.11003, 0.11187, 0.11339, 0.11489, 0.1166, 0.11829, 0.1199, 0.12137, 0.12279, 0.12444, 0.12618, 0.12773, 0.1292, 0.13077, 0.13235, 0.13392, 0.13558, 0.13725, 0.13899, 0.14089, 0.14244, 0.14349, 0.1446, 0.14593, 0.14729, 0.14843, 0.14924, 0.14995, 0.15065, 0.15145, 0.15246, 0.15373, 0.15529, 0.15693, 0.1585, 0.16024, 0.16206, 0.16334, 0.16433, 0.1656, 0.1671, 0.16856, 0.16994, 0.17124, 0.17238, 0.17338, 0.17409, 0.17464, 0.17519, 0.17563, 0.17602, 0.17638, 0.17672, 0.17708, 0.17723, 0.17698, 0.17663, 0.17636, 0.17619, 0.17605, 0.17593, 0.17585, 0.17574, 0.17558, 0.17568, 0.17595, 0.1762, 0.17671, 0.17739, 0.17775, 0.1778, 0.17769, 0.17746, 0.1771, 0.17655, 0.17611, 0.17587, 0.17558, 0.17491, 0.17394, 0.17309, 0.17206, 0.17068, 0.16948, 0.16887, 0.16853, 0.16828, 0.16819, 0.16775, 0.16682, 0.16577, 0.1648, 0.1638, 0.16267, 0.16165, 0.16052, 0.15908, 0.15759, 0.15602, 0.15414, 0.15216, 0.15068, 0.14951, 0.14804, 0.14658, 0.14551, 0.145, 0.14517, 0.14559, 0.14592, 0.14608, 0.14584, 0.14496, 0.14418, 0.14388, 0.14333, 0.14245, 0.1415, 0.14061, 0.13962, 0.13872, 0.13809, 0.13771, 0.13738, 0.1364, 0.13514, 0.13424, 0.13333, 0.13231, 0.13125, 0.13037, 0.12994, 0.12958, 0.12883, 0.12769, 0.12625, 0.1248, 0.12369, 0.12275, 0.12142, 0.12035, 0.12006, 0.11974, 0.11924, 0.11885, 0.11842, 0.11769, 0.11664, 0.11579, 0.11511, 0.11406, 0.11251, 0.11077, 0.10957, 0.10861, 0.10738, 0.10612, 0.10473, 0.10303, 0.10104, 0.09898, 0.0968, 0.09468, 0.09303, 0.09148, 0.08997, 0.08857, 0.08749, 0.08685, 0.08631, 0.08568, 0.0847, 0.08291, 0.08077, 0.07896, 0.07721, 0.07529, 0.07327, 0.07143, 0.07006, 0.06904, 0.06814, 0.06719, 0.06625, 0.06534, 0.06436, 0.06323, 0.06196, 0.06055, 0.0593, 0.05827, 0.05702, 0.05541, 0.05396, 0.05291, 0.05168, 0.05032, 0.04937, 0.04862, 0.04782, 0.04706, 0.04633, 0.04559, 0.04488, 0.04396, 0.04315, 0.04272, 0.04243, 0.04252, 0.04249, 0.04192, 0.04099, 0.03993, 0.03884, 0.03744, 0.03619, 0.0355, 0.03517, 0.03491, 0.03436, 0.03386, 0.03385, 0.0339, 0.03365, 0.0333, 0.03303, 0.03291, 0.03277, 0.03249, 0.03203, 0.0315, 0.03067, 0.0297, 0.02928, 0.0296, 0.03017, 0.0305, 0.03079, 0.03116, 0.03155, 0.03206, 0.03293, 0.03422, 0.03551, 0.03662, 0.03765, 0.03879, 0.03982, 0.0405, 0.04085, 0.04091, 0.04102, 0.04159, 0.04245, 0.04357, 0.04459, 0.04517, 0.04567, 0.04652, 0.04747, 0.04805, 0.04861, 0.04953, 0.05042, 0.05104, 0.05136, 0.0512, 0.05089, 0.05094, 0.05149, 0.05223, 0.0528, 0.05312, 0.05352, 0.05409, 0.05493, 0.05543, 0.05548, 0.05544, 0.05546, 0.05558, 0.0559, 0.05649, 0.05751, 0.0586, 0.05937, 0.06004, 0.06098, 0.06196, 0.06296, 0.06387, 0.06478, 0.06561, 0.06613, 0.06689, 0.06789, 0.06908, 0.07055, 0.07219, 0.07388, 0.07538, 0.07668, 0.0777, 0.07878, 0.08012, 0.08182, 0.08412, 0.08638, 0.0882, 0.08952, 0.09061, 0.09115, 0.09159, 0.09229, 0.09332, 0.09483, 0.0966, 0.09808, 0.09942, 0.10061, 0.1015, 0.10225, 0.10286, 0.10348, 0.10408, 0.1049, 0.10632, 0.10827, 0.11019, 0.11183, 0.11322, 0.11414, 0.11459, 0.11502, 0.11561, 0.11633, 0.1173, 0.11823, 0.11922, 0.12069, 0.12235, 0.12394, 0.12564, 0.12739, 0.12928, 0.13111, 0.13264, 0.13409, 0.13531, 0.13606, 0.13644, 0.13693, 0.13751, 0.13797, 0.13878, 0.14014, 0.14147, 0.14261, 0.14406, 0.1456, 0.1467, 0.14768, 0.14895, 0.1503, 0.15159, 0.15298, 0.15454, 0.15595, 0.15693, 0.158, 0.15905, 0.15992, 0.16087, 0.1618, 0.16248, 0.16299, 0.1638, 0.16449, 0.16479, 0.16529, 0.16594, 0.16633, 0.16679, 0.16768, 0.16872, 0.1697, 0.17053, 0.17118, 0.1715, 0.1715, 0.17175, 0.17215, 0.17238, 0.1725, 0.1728, 0.17335, 0.17369, 0.17387, 0.17394, 0.17375, 0.17363, 0.17367, 0.17372, 0.1736, 0.17338, 0.17324, 0.17318, 0.17298, 0.17242, 0.17161, 0.17062, 0.16975, 0.16919, 0.16883, 0.16852, 0.16836, 0.16816, 0.16759, 0.1666, 0.16584, 0.16554, 0.16527, 0.16479, 0.16438, 0.16424, 0.16391, 0.16347, 0.1629, 0.16204, 0.16106, 0.1599, 0.1587, 0.15778, 0.15733, 0.15707, 0.15647, 0.15531, 0.15396, 0.15278, 0.15137, 0.14923, 0.14674, 0.14486, 0.14349, 0.14209, 0.14085, 0.13946, 0.13764, 0.13544, 0.13306, 0.13104, 0.12952, 0.12853, 0.12786, 0.12666, 0.12484, 0.12315, 0.12183, 0.12044, 0.11867, 0.11677, 0.11511, 0.11383, 0.11281, 0.11167, 0.11018, 0.10827, 0.10596, 0.10371, 0.10172, 0.09993, 0.09845, 0.09686, 0.09502, 0.09343, 0.09239, 0.09179, 0.09116, 0.09043, 0.08945, 0.08809, 0.08675, 0.08551, 0.08436, 0.0831, 0.08186, 0.08102, 0.07978, 0.07791, 0.07621, 0.07479, 0.0737, 0.07303, 0.07249, 0.07173, 0.07024, 0.06834, 0.06664, 0.06513, 0.06367, 0.06233, 0.06141, 0.06084, 0.06013, 0.05947, 0.05902, 0.05847, 0.05785, 0.05748, 0.05755, 0.05785, 0.05774, 0.05721, 0.05696, 0.05708, 0.05707, 0.05695, 0.05697, 0.05714, 0.05705, 0.05687, 0.0568, 0.05647, 0.05569, 0.05453, 0.05318, 0.05167, 0.04993, 0.04832, 0.04707, 0.04604, 0.04514, 0.04427, 0.04349, 0.04266, 0.04179, 0.04102, 0.04046, 0.04006, 0.03955, 0.03897, 0.03861, 0.03834, 0.03775, 0.03711, 0.03664, 0.03608, 0.03521, 0.03431, 0.03386, 0.03351, 0.03275, 0.03158, 0.03029, 0.02937, 0.0285, 0.02744, 0.02656, 0.02581, 0.02476, 0.02381, 0.02368, 0.02402, 0.02431, 0.02444, 0.02431, 0.02413, 0.02419, 0.02436, 0.02447, 0.0245, 0.0242, 0.02373, 0.02351, 0.02356, 0.02368, 0.02388, 0.02428, 0.02446, 0.02443, 0.02433, 0.02417, 0.02395, 0.02351, 0.02275, 0.02206, 0.02144, 0.02099, 0.02042, 0.01982, 0.01983, 0.02009, 0.02029, 0.02049, 0.02062, 0.02037, 0.01953, 0.01878, 0.01878, 0.01925, 0.01981, 0.0202, 0.0204, 0.02045, 0.02038, 0.02037, 0.02027, 0.0201, 0.01985, 0.01951, 0.01928, 0.01946, 0.0203, 0.02142, 0.02252, 0.02359, 0.02443, 0.02487, 0.02536, 0.0262, 0.02735, 0.02832, 0.02943, 0.03085, 0.03225, 0.03359, 0.03505, 0.03674, 0.0385, 0.04039, 0.0422, 0.0436, 0.04467, 0.04547, 0.04594, 0.04634, 0.04681, 0.04772, 0.04913, 0.0507, 0.05212, 0.05324, 0.05417, 0.05492, 0.05577, 0.05665, 0.05733, 0.0583, 0.05951, 0.06028, 0.06101, 0.06222, 0.06376, 0.06527, 0.06687, 0.06856, 0.07027, 0.07177, 0.07297, 0.0743, 0.07609, 0.07797, 0.07972, 0.0817, 0.08376, 0.08523, 0.08619, 0.08738, 0.08894, 0.09036, 0.09149, 0.09311, 0.0954, 0.09775, 0.09976, 0.10133, 0.10271, 0.10393, 0.10487, 0.10584, 0.1072, 0.10898, 0.11077, 0.11219, 0.1136, 0.11516, 0.11664, 0.11808, 0.12011, 0.12274, 0.1254, 0.1277, 0.12937, 0.13062, 0.13165, 0.13296, 0.13445, 0.13632, 0.1384, 0.14028, 0.14212, 0.14391, 0.14567, 0.14746, 0.14907, 0.15072, 0.15246, 0.15419, 0.15587, 0.15724, 0.1585, 0.15981, 0.1609, 0.16186, 0.16321, 0.1647, 0.16598, 0.16678, 0.16742, 0.1681, 0.16886, 0.16962, 0.17056, 0.17185, 0.17319, 0.17454, 0.17551, 0.17632, 0.17697, 0.17757, 0.17834, 0.17905, 0.18, 0.1811, 0.18198, 0.18269, 0.18312, 0.18359, 0.18399, 0.18441, 0.18532, 0.18648, 0.18772, 0.18873, 0.1893, 0.18962, 0.18997, 0.19036, 0.19096, 0.19196, 0.19312, 0.19407, 0.19471, 0.19542, 0.19604, 0.19663, 0.19754, 0.19856, 0.19981, 0.20111, 0.20212, 0.2031, 0.20423, 0.20543, 0.20654, 0.20732, 0.20796, 0.20879, 0.20963, 0.21016, 0.2103, 0.21, 0.20969, 0.20957, 0.20963, 0.20955, 0.2095, 0.20945, 0.20922, 0.20908, 0.20893, 0.20904, 0.20938, 0.20952, 0.20958, 0.20959, 0.20922, 0.20898, 0.20905, 0.20919, 0.20904, 0.20856, 0.20791, 0.207, 0.20576, 0.2047, 0.20377, 0.20327, 0.20305, 0.20262, 0.20194, 0.20113, 0.20044, 0.19966, 0.19881, 0.19823, 0.19759, 0.19676, 0.19615, 0.19546, 0.19427, 0.19312, 0.19209, 0.1908, 0.18932, 0.18791, 0.18634, 0.18459, 0.18285, 0.18076, 0.17846, 0.17642, 0.17443, 0.17208, 0.16947, 0.16704, 0.16488, 0.16313, 0.16179, 0.16029, 0.15889, 0.15757, 0.1562, 0.15487, 0.15358, 0.1525, 0.15118, 0.14937, 0.14724, 0.1448, 0.14257, 0.14063, 0.13886, 0.13701, 0.13487, 0.13252, 0.13017, 0.12812, 0.1265, 0.12514, 0.12375, 0.12221, 0.12061, 0.1186, 0.11607, 0.11345, 0.11131, 0.10997, 0.10891, 0.1073, 0.10515, 0.10309, 0.10109, 0.09881, 0.0966, 0.09476, 0.09297, 0.09105, 0.08952, 0.08848, 0.08756, 0.08693, 0.08631, 0.08503, 0.08308, 0.08097, 0.07893, 0.07686, 0.07475, 0.07309, 0.07195, 0.07076, 0.0694, 0.06753, 0.06514, 0.06278, 0.06054, 0.05824, 0.05566, 0.05295, 0.05019, 0.04734, 0.0449, 0.04334, 0.04211, 0.0408, 0.03958, 0.03861, 0.03785, 0.03711, 0.03617, 0.03524, 0.03465, 0.0342, 0.03345, 0.03218, 0.03074, 0.0296, 0.02892, 0.02865, 0.0284, 0.02789, 0.02704, 0.02583, 0.02458, 0.02353, 0.02254, 0.02152, 0.02034, 0.01889, 0.01709, 0.01504, 0.01291, 0.01083, 0.00924, 0.00813, 0.00736, 0.00684, 0.00612, 0.0051, 0.00397, 0.00289, 0.00236, 0.00221, 0.00225, 0.00283, 0.00373, 0.0045, 0.00458, 0.00421, 0.00379, 0.00318, 0.0026, 0.00211, 0.00188, 0.00199, 0.00213, 0.00218, 0.00223, 0.00242, 0.00266, 0.00275, 0.00282, 0.00282, 0.00274, 0.00273, 0.00256, 0.00232, 0.00245, 0.00298, 0.00328, 0.00314, 0.00313, 0.00325, 0.00316, 0.00313, 0.00344, 0.0038, 0.00391, 0.00422, 0.00475, 0.00494, 0.0046, 0.00401, 0.00359, 0.00336, 0.00317, 0.00289, 0.00271, 0.00274, 0.00277, 0.00276, 0.00282, 0.00339, 0.00461, 0.00617, 0.00754, 0.00849, 0.00931, 0.01005, 0.01058, 0.01086, 0.01107, 0.01148, 0.01201, 0.01263, 0.01382, 0.01566, 0.01737, 0.01846, 0.01908, 0.01959, 0.0202, 0.02085, 0.02135, 0.02143, 0.0212, 0.02105, 0.02119, 0.02145, 0.02203, 0.02316, 0.02424, 0.02523, 0.02618, 0.0271, 0.028, 0.02892, 0.03006, 0.03113, 0.03212, 0.03355, 0.03526, 0.03684, 0.03806, 0.03898, 0.0397, 0.04004, 0.04024, 0.04077, 0.04151, 0.04228, 0.04346, 0.0451, 0.04706, 0.04896, 0.05058, 0.05216, 0.05377, 0.05545, 0.05719, 0.05908, 0.06137, 0.0637, 0.06574, 0.06787, 0.06993, 0.07182, 0.07386, 0.0757, 0.07742, 0.07918, 0.08098, 0.08302, 0.08513, 0.08717, 0.0891, 0.09093, 0.09232, 0.09318, 0.09386, 0.09484, 0.09596, 0.09662, 0.09715, 0.09802, 0.09909, 0.10047, 0.10233, 0.10464, 0.10723, 0.10989, 0.11253, 0.11495, 0.11703, 0.11909, 0.12119, 0.1231, 0.12503, 0.12705, 0.12914, 0.13148, 0.13395, 0.13613, 0.13788, 0.13942, 0.1408, 0.14213, 0.14355, 0.14498, 0.14657, 0.14859, 0.1508, 0.15283, 0.15482, 0.15674, 0.15856, 0.16056, 0.16297, 0.16563, 0.16817, 0.17037, 0.17216, 0.17382, 0.17566, 0.17735, 0.17882, 0.18006, 0.18106, 0.18199, 0.18306, 0.18445, 0.18583, 0.18732, 0.1892, 0.19111, 0.19289, 0.19457, 0.19628, 0.19811, 0.20008, 0.2022, 0.20455, 0.20682, 0.20866, 0.2099, 0.21062, 0.21128, 0.21204, 0.21275, 0.21377, 0.21531, 0.21699, 0.21837, 0.21939, 0.21979, 0.21952, 0.21948, 0.2201, 0.22118, 0.2222, 0.22306, 0.22409, 0.22526, 0.22594, 0.22609, 0.22607, 0.22599, 0.22605, 0.22614, 0.22626, 0.22666, 0.22736, 0.22783, 0.22795, 0.22803, 0.22787, 0.22739, 0.22663, 0.22567, 0.22496, 0.2248, 0.22477, 0.22459, 0.22421, 0.22348, 0.22243, 0.22141, 0.22046, 0.21949, 0.21877, 0.21833, 0.21812, 0.21812, 0.2181, 0.21756, 0.21623, 0.2143, 0.21213, 0.21029, 0.20943, 0.20925, 0.20899, 0.2086, 0.2081, 0.20739, 0.20664, 0.20571, 0.20417, 0.20207, 0.19994, 0.19794, 0.19593, 0.19398, 0.19204, 0.19008, 0.18834, 0.18689, 0.18574, 0.18477, 0.18372, 0.18239, 0.18075, 0.17917, 0.1781, 0.17737, 0.1763, 0.17446, 0.17185, 0.16884, 0.16622, 0.16421, 0.16244, 0.16104, 0.15977, 0.15803, 0.15604, 0.15445, 0.15306, 0.15142, 0.14972, 0.14805, 0.14627, 0.14444, 0.14267, 0.14082, 0.13887, 0.13684, 0.13453, 0.13212, 0.12994, 0.12785, 0.12556, 0.12305, 0.12085, 0.11944, 0.1185, 0.11766, 0.11636, 0.11457, 0.11262, 0.11059, 0.10876, 0.1072, 0.10597, 0.1049, 0.10364, 0.10237, 0.10106, 0.09908, 0.09645, 0.09386, 0.09154, 0.08936, 0.08713, 0.08506, 0.08347, 0.08197, 0.0801, 0.078, 0.07573, 0.07343, 0.07128, 0.069, 0.06644, 0.064, 0.06185, 0.05968, 0.0575, 0.0554, 0.05335, 0.05114, 0.0489, 0.04709, 0.04564, 0.04409, 0.04227, 0.04067, 0.03945, 0.03786, 0.03591, 0.03422, 0.03269, 0.03104, 0.02948, 0.02816, 0.02667, 0.02499, 0.02321, 0.02124, 0.01894, 0.01642, 0.0138, 0.01105, 0.0086, 0.00682, 0.00565, 0.00463, 0.00347, 0.00226, 0.00075, -0.00129, -0.00326, -0.00473, -0.00571, -0.00651, -0.00752, -0.00867, -0.00946, -0.00967, -0.00973, -0.00997, -0.01055, -0.01125, -0.0119, -0.01248, -0.01313, -0.01393, -0.01482, -0.01599, -0.01737, -0.0186, -0.01934, -0.01996, -0.02089, -0.02161, -0.02192, -0.02205, -0.0224, -0.02326, -0.02424, -0.02483, -0.02468, -0.02407, -0.02375, -0.02377, -0.02376, -0.02404, -0.02448, -0.02485, -0.02509, -0.02511, -0.0252, -0.02522, -0.02478, -0.02396, -0.02273, -0.02081, -0.01841, -0.01621, -0.01462, -0.01379, -0.01358, -0.01367, -0.01366, -0.01328, -0.01264, -0.01188, -0.01111, -0.01028, -0.00941, -0.00879, -0.00843, -0.00811, -0.00754, -0.00644, -0.00474, -0.00262, -0.00081, 0.00064, 0.00204, 0.00333, 0.0046, 0.00612, 0.00772, 0.00909, 0.01045, 0.01195, 0.01362, 0.01543, 0.01702, 0.01855, 0.02026, 0.02207, 0.02402, 0.02573, 0.02702, 0.02801, 0.02884, 0.02968, 0.03061, 0.0322, 0.0345, 0.03664, 0.03857, 0.0406, 0.04225, 0.04346, 0.04489, 0.04659, 0.04834, 0.05019, 0.05221, 0.05428, 0.05636, 0.05842, 0.06045, 0.06251, 0.06452, 0.06635, 0.06799, 0.06938, 0.0704, 0.0712, 0.07244, 0.0743, 0.07639, 0.07869, 0.08087, 0.08274, 0.085, 0.08777, 0.09037, 0.09277, 0.09504, 0.09704, 0.09874, 0.10011, 0.10147, 0.10267, 0.10366, 0.10479, 0.10612, 0.10765, 0.10956, 0.1122, 0.11518, 0.11797, 0.12074, 0.12363, 0.1262, 0.12828, 0.13035, 0.13225, 0.13416, 0.13642, 0.13866, 0.14063, 0.14251, 0.1444, 0.14644, 0.14851, 0.15028, 0.15219, 0.15442, 0.15655, 0.15856, 0.16054, 0.16246, 0.16439, 0.16643, 0.16867, 0.17134, 0.1741, 0.1768, 0.17919, 0.18099, 0.18279, 0.1849, 0.18716, 0.18961, 0.19214, 0.19433, 0.19619, 0.1981, 0.20015, 0.20221, 0.20421, 0.20601, 0.20746, 0.20876, 0.21009, 0.21141, 0.21249, 0.21308, 0.2134, 0.21433, 0.21574, 0.21711, 0.21833, 0.2194, 0.22051, 0.2216, 0.22258, 0.2234, 0.22435, 0.22538, 0.22594, 0.22614, 0.22642, 0.22669, 0.22692, 0.22728, 0.22752, 0.22766, 0.22786, 0.22832, 0.2292, 0.23028, 0.23139, 0.23252, 0.23373, 0.23471, 0.2354, 0.23595, 0.23645, 0.2368, 0.23661, 0.23598, 0.23516, 0.23455, 0.23437, 0.23446, 0.23467, 0.23464, 0.23467, 0.23511, 0.23569, 0.23606, 0.23635, 0.23686, 0.23728, 0.23749, 0.23747, 0.23729, 0.23694, 0.2366, 0.2363, 0.23571, 0.23514, 0.23477, 0.23418, 0.23371, 0.23389, 0.23405, 0.23361, 0.23263, 0.2313, 0.22955, 0.22742, 0.22528, 0.22341, 0.22182, 0.22095, 0.22079, 0.22071, 0.22046, 0.22, 0.21899, 0.21737, 0.21545, 0.21349, 0.21172, 0.20994, 0.20805, 0.20616, 0.20427, 0.20274, 0.20141, 0.20002, 0.1987, 0.19698, 0.19486, 0.19293, 0.19148, 0.1901, 0.18871, 0.18724, 0.18593, 0.18499, 0.1838, 0.18194, 0.17938, 0.17644, 0.17361, 0.17133, 0.16937, 0.16741, 0.16551, 0.16351, 0.1613, 0.15892, 0.15672, 0.15499, 0.15324, 0.15093, 0.1483, 0.146, 0.14408, 0.14253, 0.14128, 0.14022, 0.13897, 0.13696, 0.13445, 0.13204, 0.12987, 0.12794, 0.12601, 0.12414, 0.1224, 0.12076, 0.11951, 0.11868, 0.11823, 0.11806, 0.11799, 0.11753, 0.11635, 0.11469, 0.11306, 0.11178, 0.11079, 0.10971, 0.10837, 0.1064, 0.10365, 0.10076, 0.09806, 0.09559, 0.09332, 0.09118, 0.08908, 0.08681, 0.08464, 0.08288, 0.0814, 0.0805, 0.08028, 0.08027, 0.08, 0.07884, 0.07677, 0.07502, 0.07361, 0.07231, 0.07092, 0.06916, 0.06723, 0.06552, 0.06401, 0.06208, 0.05967, 0.05661, 0.05323, 0.04988, 0.04682, 0.0443, 0.04232, 0.04084, 0.03958, 0.03842, 0.03705, 0.03566, 0.03443, 0.03321, 0.03227, 0.03168, 0.03119, 0.03079, 0.03046, 0.03, 0.02922, 0.02783, 0.02576, 0.02351, 0.02146, 0.01969, 0.01811, 0.01654, 0.015, 0.01359, 0.01218, 0.01066, 0.00915, 0.00811, 0.00764, 0.0073, 0.00683, 0.00635, 0.00632, 0.00645, 0.0063, 0.00581, 0.00507, 0.00449, 0.00428, 0.00447, 0.00475, 0.00492, 0.00498, 0.00461, 0.00389, 0.00343, 0.00358, 0.00405, 0.0045, 0.0046, 0.00439, 0.00414, 0.00399, 0.00399, 0.00412, 0.00446, 0.00487, 0.00522, 0.00541, 0.00567, 0.00586, 0.0055, 0.00504, 0.00492, 0.00497, 0.00505, 0.00529, 0.00532, 0.00507, 0.00532, 0.00577, 0.0063, 0.00722, 0.0084, 0.00959, 0.01035, 0.01057, 0.01065, 0.01104, 0.01162, 0.01254, 0.01423, 0.0163, 0.01819, 0.01975, 0.0212, 0.02268, 0.02384, 0.02479, 0.02615, 0.02785, 0.02913, 0.02983, 0.03057, 0.03147, 0.0323, 0.03328, 0.03468, 0.03631, 0.03792, 0.03939, 0.04053, 0.04167, 0.0432, 0.04518, 0.04768, 0.05002, 0.05199, 0.054, 0.05627, 0.05856, 0.06074, 0.06288, 0.06482, 0.06676, 0.0687, 0.07061, 0.07254, 0.07442, 0.07638, 0.0783, 0.07981, 0.08111, 0.08246, 0.08395, 0.08557, 0.08755, 0.0899, 0.09211, 0.09403, 0.09593, 0.0978, 0.09953, 0.10117, 0.10268, 0.10402, 0.10539, 0.10693, 0.10844, 0.10994, 0.11151, 0.11305, 0.1146, 0.11633, 0.11837, 0.12056, 0.12255, 0.12418, 0.12584, 0.12793, 0.13049, 0.13321, 0.13601, 0.13873, 0.14102, 0.14307, 0.14512, 0.14724, 0.14968, 0.15251, 0.15571, 0.15904, 0.16233, 0.16572, 0.16898, 0.17205, 0.17499, 0.17777, 0.18015, 0.18204, 0.18371, 0.18529, 0.18719, 0.18932, 0.19109, 0.19237, 0.19354, 0.19476, 0.19593, 0.19705, 0.19791, 0.19872, 0.20004, 0.20178, 0.20342, 0.20483, 0.20612, 0.20709, 0.20777, 0.20832, 0.20894, 0.20994, 0.21147, 0.21326, 0.21465, 0.21547, 0.21623, 0.21724, 0.21859, 0.22017, 0.22191, 0.22341, 0.22428, 0.22491, 0.22542, 0.22545, 0.22521, 0.22548, 0.2264, 0.22754, 0.22861, 0.22954, 0.23023, 0.2307, 0.23114, 0.2319, 0.23295, 0.23375, 0.2343, 0.23484, 0.23519, 0.23541, 0.23562, 0.23607, 0.23683, 0.23752, 0.23798, 0.23868, 0.23992, 0.24097, 0.24141, 0.24141, 0.24116, 0.24061, 0.23945, 0.23804, 0.23702, 0.23621, 0.23549, 0.23496, 0.23434, 0.23347, 0.23244, 0.23146, 0.23031, 0.22924, 0.22839, 0.22747, 0.22674, 0.22616, 0.22557, 0.2249, 0.22402, 0.22295, 0.22219, 0.22188, 0.22193, 0.22154, 0.22016, 0.21834, 0.21623, 0.21416, 0.2122, 0.21033, 0.20872, 0.20718, 0.2058, 0.2048, 0.20381, 0.20259, 0.20128, 0.19999, 0.1987, 0.19736, 0.19602, 0.19456, 0.19271, 0.19061, 0.18863, 0.18665, 0.18472, 0.18318, 0.18181, 0.18037, 0.17919, 0.17814, 0.17681, 0.17525, 0.17351, 0.1719, 0.17058, 0.16915, 0.1677, 0.16638, 0.16495, 0.16336, 0.16164, 0.16007, 0.15837, 0.156, 0.1533, 0.15077, 0.14824, 0.14577, 0.1438, 0.14196, 0.13956, 0.13705, 0.13529, 0.13349, 0.13117, 0.1288, 0.12645, 0.12414, 0.12171, 0.11936, 0.11705, 0.11473, 0.11238, 0.10963, 0.10701, 0.10485, 0.10263, 0.10021, 0.09779, 0.09541, 0.09291, 0.09034, 0.08766, 0.08484, 0.08192, 0.07891, 0.0761, 0.07379, 0.07201, 0.07064, 0.06945, 0.06845, 0.06777, 0.06733, 0.06655, 0.06499, 0.06312, 0.06121, 0.05926, 0.05742, 0.05577, 0.05447, 0.05355, 0.05255, 0.05103, 0.04937, 0.04806, 0.04673, 0.0451, 0.04331, 0.04145, 0.0399, 0.0387, 0.03784, 0.03714, 0.03614, 0.03471, 0.03278, 0.03063, 0.0288, 0.02742, 0.02606, 0.02431, 0.02252, 0.02091, 0.01945, 0.0184, 0.01769, 0.01671, 0.01547, 0.01411, 0.01249, 0.01059, 0.00843, 0.00685, 0.00621, 0.00562, 0.0048, 0.00413, 0.00359, 0.0033, 0.00304, 0.00262, 0.00197, 0.00145, 0.00113, 0.00086, 0.00093, 0.00131, 0.00197, 0.00249, 0.00265, 0.00244, 0.00198, 0.00128, 0.00038, -0.00029, -8e-05, 0.0012, 0.00276, 0.0041, 0.0054, 0.00657, 0.00728, 0.00771, 0.00807, 0.00858, 0.00975, 0.01143, 0.01292, 0.01393, 0.01458, 0.01487, 0.01495, 0.01511, 0.01579, 0.01687, 0.01788, 0.01928, 0.02089, 0.02226, 0.02344, 0.02451, 0.02573, 0.02701, 0.02823, 0.02954, 0.03102, 0.03227, 0.03314, 0.03376, 0.03409, 0.03435, 0.03444, 0.03449, 0.03494, 0.03572, 0.03681, 0.03802, 0.03879, 0.03913, 0.04006, 0.0419, 0.04403, 0.04588, 0.04754, 0.04955, 0.0518, 0.05402, 0.05615, 0.05808, 0.05991, 0.06148, 0.06271, 0.0638, 0.06505, 0.0664, 0.06768, 0.06879, 0.06957, 0.07046, 0.07146, 0.07233, 0.07326, 0.07424, 0.07537, 0.07661, 0.07788, 0.07908, 0.08079, 0.08307, 0.08526, 0.08753, 0.08973, 0.09187, 0.094, 0.09569, 0.09702, 0.09817, 0.09933, 0.10083, 0.10264, 0.10449, 0.10608, 0.10756, 0.10911, 0.11068, 0.11213, 0.11325, 0.11436, 0.116, 0.11766, 0.11897, 0.12037, 0.12172, 0.12265, 0.12354, 0.12463, 0.12586, 0.12735, 0.12898, 0.13064, 0.13206, 0.13316, 0.13424, 0.13548, 0.13687, 0.13851, 0.14046, 0.14253, 0.14459, 0.14665, 0.14853, 0.15031, 0.15217, 0.15405, 0.15616, 0.15858, 0.16092, 0.16295, 0.16494, 0.16708, 0.16962, 0.17234, 0.17456, 0.1763, 0.1778, 0.17875, 0.17935, 0.18026, 0.18139, 0.18261, 0.18411, 0.1855, 0.18643, 0.18731, 0.18836, 0.18944, 0.19057, 0.19168, 0.19271, 0.19377, 0.19478, 0.19551, 0.19596, 0.19643, 0.19697, 0.19762, 0.19825, 0.1985, 0.1987, 0.19904, 0.19952, 0.20001, 0.20032, 0.20052, 0.20072, 0.20083, 0.20092, 0.20131, 0.20209, 0.20308, 0.20387, 0.20421, 0.20434, 0.20451, 0.20479, 0.20524, 0.20578, 0.20635, 0.20717, 0.20803, 0.20868, 0.20919, 0.20975, 0.21044, 0.21099, 0.21123, 0.2113, 0.21161, 0.21184, 0.21174, 0.21167, 0.21173, 0.21168, 0.2117, 0.21208, 0.21253, 0.21273, 0.21275, 0.21309, 0.21375, 0.21418, 0.21406, 0.21353, 0.21294, 0.21238, 0.21211, 0.21213, 0.21211, 0.212, 0.21194, 0.21182, 0.21171, 0.21186, 0.21188, 0.21134, 0.21073, 0.21055, 0.21059, 0.21059, 0.21063, 0.21065, 0.2104, 0.20972, 0.20869, 0.2079, 0.20747, 0.20705, 0.20649, 0.20587, 0.20507, 0.20412, 0.20319, 0.20239, 0.20191, 0.20162, 0.2011, 0.20024, 0.19916, 0.198, 0.19679, 0.1956, 0.19468, 0.19388, 0.19326, 0.19267, 0.19216, 0.19155, 0.19015, 0.18824, 0.18636, 0.1846, 0.18324, 0.18224, 0.18123, 0.18022, 0.17931, 0.17837, 0.17779, 0.17752, 0.17691, 0.17592, 0.17482, 0.17367, 0.17247, 0.17115, 0.16953, 0.1681, 0.16705, 0.16603, 0.16496, 0.1639, 0.16295, 0.16189, 0.16055, 0.1593, 0.15824, 0.15675, 0.15468, 0.15257, 0.15061, 0.14852, 0.14617, 0.14386, 0.14187, 0.13974, 0.13725, 0.13486, 0.13306, 0.13176, 0.13033, 0.12868, 0.12685, 0.12492, 0.12313, 0.12116, 0.11927, 0.11749, 0.11543, 0.11342, 0.11168, 0.1099, 0.10788, 0.10579, 0.10363, 0.10146, 0.09933, 0.09734, 0.09544, 0.09329, 0.09089, 0.0885, 0.08642, 0.08439, 0.08189, 0.07913, 0.07652, 0.07421, 0.07231, 0.0712, 0.07061, 0.06975, 0.06889, 0.06829, 0.06768, 0.06702, 0.06633, 0.06553, 0.06441, 0.06308, 0.06195, 0.06095, 0.06008, 0.05952, 0.05903, 0.05832, 0.05704, 0.05549, 0.05432, 0.05349, 0.05264, 0.05164, 0.05067, 0.04987, 0.04898, 0.04756, 0.04603, 0.04483, 0.04391, 0.04305, 0.04232, 0.04181, 0.04117, 0.04011, 0.03884, 0.03767, 0.03642, 0.03532, 0.03501, 0.03548, 0.03635, 0.0371, 0.03743, 0.03733, 0.03673, 0.0358, 0.03532, 0.03546, 0.03582, 0.0364, 0.03739, 0.03864, 0.04013, 0.0417, 0.04301, 0.04392, 0.0447, 0.04544, 0.04569, 0.04547, 0.04532, 0.04543, 0.04536, 0.04497, 0.04469, 0.04472, 0.04491, 0.04517, 0.04558, 0.04582, 0.04565, 0.0454, 0.04519, 0.04516, 0.04543, 0.04582, 0.04597, 0.04597, 0.0462, 0.04655, 0.04715, 0.048, 0.04886, 0.04978, 0.05056, 0.05105, 0.05135, 0.05162, 0.05178, 0.05186, 0.0521, 0.05254, 0.05313, 0.05383, 0.05462, 0.05504, 0.05524, 0.05582, 0.05672, 0.05777, 0.05858, 0.05924, 0.06025, 0.06132, 0.06216, 0.06283, 0.06352, 0.06451, 0.06576, 0.06714, 0.06861, 0.07026, 0.07219, 0.07419, 0.07574, 0.07677, 0.07758, 0.07822, 0.07902, 0.08018, 0.08168, 0.08319, 0.08431, 0.08511, 0.08586, 0.08666, 0.08767, 0.08903, 0.09061, 0.09211, 0.09333, 0.09432, 0.09521, 0.09628, 0.09764, 0.09911, 0.10065, 0.10197, 0.10282, 0.10349, 0.10425, 0.10529, 0.10696, 0.10929, 0.11179, 0.11438, 0.11703, 0.11929, 0.12105, 0.12275, 0.12447, 0.12626, 0.12835, 0.13045, 0.13237, 0.13446, 0.13671, 0.13869, 0.14025, 0.14175, 0.14328, 0.1446, 0.14585, 0.14716, 0.14841, 0.14925, 0.14972, 0.15046, 0.15159, 0.15316, 0.15495, 0.15652, 0.15773, 0.15849, 0.15895, 0.15933, 0.15985, 0.16091, 0.1628, 0.16506, 0.16707, 0.16886, 0.17064, 0.17215, 0.17327, 0.17453, 0.17607, 0.17774, 0.17931, 0.18056, 0.18164, 0.18252, 0.18308, 0.18375, 0.18463, 0.18594, 0.18772, 0.18965, 0.19181, 0.19423, 0.19658, 0.19863, 0.20056, 0.20265, 0.20467, 0.2063, 0.20783, 0.20932, 0.21054, 0.21158, 0.21236, 0.21278, 0.21321, 0.21363, 0.21404, 0.21453, 0.21501, 0.21562, 0.21625, 0.21661, 0.21679, 0.21696, 0.217, 0.21708, 0.21723, 0.21728, 0.21721, 0.21695, 0.21668, 0.21649, 0.21641, 0.21628, 0.21596, 0.21536, 0.21468, 0.21436, 0.2142, 0.21386, 0.21353, 0.21335, 0.21338, 0.21365, 0.21378, 0.21358, 0.21293, 0.2117, 0.21038, 0.20942, 0.20884, 0.20844, 0.20792, 0.20741, 0.20688, 0.20603, 0.2049, 0.2038, 0.20299, 0.2023, 0.20169, 0.20106, 0.20019, 0.19953, 0.19915, 0.19894, 0.19883, 0.1984, 0.19757, 0.19652, 0.19555, 0.19466, 0.19367, 0.1927, 0.19167, 0.19059, 0.18951, 0.18868, 0.18778, 0.18627, 0.18441, 0.18279, 0.18144, 0.17995, 0.17831, 0.17677, 0.17524, 0.17372, 0.17247, 0.17138, 0.17013, 0.16887, 0.16791, 0.16737, 0.16712, 0.167, 0.16698, 0.16666, 0.16606, 0.16539, 0.1647, 0.16394, 0.16315, 0.1624, 0.16148, 0.16046, 0.15927, 0.15793, 0.15675, 0.15561, 0.15435, 0.1532, 0.15209, 0.15021, 0.14766, 0.1453, 0.14331, 0.14155, 0.13977, 0.13791, 0.13585, 0.13372, 0.13181, 0.13017, 0.12874, 0.12732, 0.12597, 0.12457, 0.123, 0.12124, 0.11899, 0.11626, 0.1135, 0.11123, 0.10945, 0.10793, 0.10676, 0.10591, 0.10528, 0.10501, 0.10485, 0.10431, 0.10326, 0.10151, 0.09947, 0.09753, 0.09599, 0.09514, 0.09477, 0.09439, 0.09335, 0.09185, 0.09025, 0.08856, 0.08687, 0.08503, 0.08285, 0.08039, 0.07827, 0.07658, 0.07464, 0.07273, 0.07135, 0.07007, 0.0684, 0.06659, 0.06494, 0.06361, 0.06264, 0.06186, 0.06122, 0.06088, 0.06051, 0.05958, 0.05847, 0.05741, 0.0565, 0.0556, 0.05461, 0.05384, 0.05329, 0.05263, 0.05204, 0.05188, 0.05142, 0.05044, 0.04937, 0.04827, 0.04702, 0.04569, 0.04446, 0.04349, 0.04274, 0.04231, 0.04204, 0.0413, 0.04005, 0.03878, 0.03801, 0.03764, 0.03737, 0.03738, 0.03732, 0.0365, 0.03491, 0.0331, 0.03159, 0.03071, 0.03024, 0.02958, 0.02851, 0.02749, 0.02702, 0.02708, 0.02744, 0.02796, 0.02848, 0.02868, 0.02828, 0.02766, 0.027, 0.02638, 0.0261, 0.02633, 0.02694, 0.02767, 0.02807, 0.02808, 0.02823, 0.02866, 0.02929, 0.03039, 0.03184, 0.03316, 0.03412, 0.03477, 0.03548, 0.03679, 0.03871, 0.04083, 0.04262, 0.04376, 0.04452, 0.04483, 0.0445, 0.04414, 0.04473, 0.04582, 0.04707, 0.0488, 0.0508, 0.0526, 0.05398, 0.0549, 0.05549, 0.05592, 0.05623, 0.05683, 0.05762, 0.05816, 0.05857, 0.05911, 0.05986, 0.06094, 0.06203, 0.06289, 0.0638, 0.06441, 0.06432, 0.06378, 0.06329, 0.06343, 0.06428, 0.06553, 0.06705, 0.06838, 0.06942, 0.07068, 0.0723, 0.07413, 0.07586, 0.07765, 0.07966, 0.08147, 0.08296, 0.08436, 0.0859, 0.08764, 0.08958, 0.09157, 0.0932, 0.09463, 0.09596, 0.09728, 0.09882, 0.10033, 0.10172, 0.10302, 0.10447, 0.10608, 0.10739, 0.10817, 0.1084, 0.10844, 0.10837, 0.10842, 0.10919, 0.11014, 0.11097, 0.11202, 0.1131, 0.11414, 0.11535, 0.1166, 0.118, 0.11961, 0.12134, 0.12296, 0.1242, 0.1254, 0.12693, 0.12871, 0.13054, 0.13239, 0.13436, 0.13636, 0.13836, 0.14037, 0.14255, 0.1449, 0.14712, 0.14926, 0.1511, 0.15253, 0.15396, 0.15541, 0.15698, 0.15887, 0.16084, 0.16276, 0.16479, 0.16682, 0.16856, 0.17007, 0.17162, 0.17342, 0.17553, 0.17763, 0.1796, 0.18152, 0.1834, 0.18513, 0.18661, 0.1876, 0.18849, 0.18969, 0.19097, 0.19218, 0.19319, 0.19387, 0.19434, 0.19471, 0.19512, 0.19562, 0.19637, 0.19718, 0.19776, 0.19806, 0.19824, 0.1986, 0.19919, 0.19988, 0.20099, 0.20254, 0.20385, 0.20499, 0.20611, 0.2071, 0.20798, 0.20885, 0.20989, 0.21098, 0.21202, 0.21311, 0.21428, 0.21518, 0.21574, 0.21623, 0.21675, 0.21712, 0.21705, 0.21679, 0.21677, 0.21702, 0.2176, 0.21832, 0.21875, 0.21875, 0.21854, 0.21839, 0.2181, 0.21749, 0.21676, 0.21585, 0.21489, 0.214, 0.21326, 0.21271, 0.21225, 0.21175, 0.21124, 0.21094, 0.21089, 0.21082, 0.21024, 0.2094, 0.20867, 0.20807, 0.20782, 0.20775, 0.20745, 0.20671, 0.20572, 0.20461, 0.20342, 0.20235, 0.20133, 0.20006, 0.19866, 0.19731, 0.19613, 0.19508, 0.1942, 0.1935, 0.19255, 0.19136, 0.19043, 0.19, 0.18947, 0.18844, 0.18718, 0.18586, 0.18453, 0.18301, 0.18143, 0.18016, 0.1791, 0.17832, 0.17788, 0.17777, 0.17775, 0.17711, 0.17583, 0.17447, 0.17325, 0.17212, 0.17093, 0.16956, 0.16825, 0.16696, 0.16532, 0.16372, 0.16223, 0.16046, 0.15858, 0.15679, 0.15511, 0.15387, 0.15307, 0.15217, 0.1509, 0.14937, 0.14783, 0.14615, 0.14417, 0.14215, 0.14013, 0.13777, 0.13523, 0.1329, 0.13082, 0.12903, 0.12756, 0.12628, 0.12518, 0.12452, 0.12414, 0.12353, 0.12249, 0.12092, 0.11878, 0.11618, 0.11339, 0.11073, 0.10833, 0.10628, 0.10459, 0.103, 0.10135, 0.09946, 0.09743, 0.09542, 0.0934, 0.09167, 0.09039, 0.08931, 0.0881, 0.08675, 0.08542, 0.08412, 0.08297, 0.0821, 0.08122, 0.08007, 0.07889, 0.07791, 0.07725, 0.07699, 0.07668, 0.07599, 0.07502, 0.07395, 0.07264, 0.07119, 0.06977, 0.06869, 0.06768, 0.06605, 0.06387, 0.06181, 0.06043, 0.05958, 0.05895, 0.05832, 0.05797, 0.05756, 0.05694, 0.05604, 0.05498, 0.05432, 0.05377, 0.05304, 0.05252, 0.05258, 0.05277, 0.05258, 0.05241, 0.05236, 0.05187, 0.05101, 0.05037, 0.05004, 0.04991, 0.04989, 0.04961, 0.04936, 0.04943, 0.04946, 0.0493, 0.04923, 0.04926, 0.04917, 0.04912, 0.04936, 0.04992, 0.0506, 0.05115, 0.05135, 0.05152, 0.05183, 0.05165, 0.05096, 0.0504, 0.05043, 0.05088, 0.0514, 0.05136, 0.05069, 0.04988, 0.0495, 0.04982, 0.05026, 0.05042, 0.05049, 0.05063, 0.05067, 0.05067, 0.05115, 0.05221, 0.05336, 0.05461, 0.05616, 0.05761, 0.05871, 0.05964, 0.06059, 0.06175, 0.06304, 0.06432, 0.06527, 0.06564, 0.06587, 0.06622, 0.06666, 0.06755, 0.06877, 0.07003, 0.07147, 0.07276, 0.07377, 0.075, 0.07658, 0.0782, 0.07956, 0.08067, 0.08155, 0.08225, 0.08289, 0.08374, 0.08485, 0.08583, 0.08662, 0.0873, 0.08757, 0.08746, 0.0871, 0.08681, 0.08694, 0.08773, 0.08878, 0.09012, 0.09213, 0.0942, 0.09589, 0.09723, 0.09822, 0.09899, 0.09956, 0.09985, 0.10003, 0.10044, 0.10137, 0.10267, 0.10402, 0.1054, 0.10681, 0.10822, 0.1098, 0.11157, 0.11335, 0.11528, 0.11711, 0.11871, 0.1204, 0.12197, 0.12323, 0.12461, 0.12641, 0.12837, 0.13031, 0.13248, 0.13487, 0.13709, 0.13942, 0.14203, 0.14448, 0.14658, 0.14835, 0.15004, 0.15166, 0.15313, 0.15459, 0.1561, 0.1578, 0.15944, 0.16079, 0.16221, 0.16344, 0.16429, 0.16529, 0.16647, 0.16746, 0.16852, 0.17, 0.17162, 0.17302, 0.17426, 0.17543, 0.17648, 0.17752, 0.17843, 0.17918, 0.18009, 0.18159, 0.18345, 0.18527, 0.18699, 0.18864, 0.19026, 0.19202, 0.19386, 0.19555, 0.19726, 0.19904, 0.20103, 0.20311, 0.20501, 0.20693, 0.20906, 0.21131, 0.21343, 0.21566, 0.21808, 0.22016, 0.22184, 0.22365, 0.22564, 0.22753, 0.22929, 0.23086, 0.23236, 0.23396, 0.23553, 0.23694, 0.23838, 0.23993, 0.24138, 0.24253, 0.24356, 0.24441, 0.2446, 0.2443, 0.24404, 0.24401, 0.24434, 0.24509, 0.24601, 0.24681, 0.24774, 0.24864, 0.24933, 0.25034, 0.25151, 0.25232, 0.25252, 0.25192, 0.25092, 0.25023, 0.24991, 0.24959, 0.24917, 0.24874, 0.24838, 0.24816, 0.24804, 0.24796, 0.24772, 0.2473, 0.24685, 0.24638, 0.24606, 0.24602, 0.24604, 0.24606, 0.24607, 0.24602, 0.24577, 0.24508, 0.24434, 0.24392, 0.24386, 0.24383, 0.24325, 0.24226, 0.24113, 0.24021, 0.23955, 0.2391, 0.23893, 0.23905, 0.23892, 0.23811, 0.23681, 0.23525, 0.2341, 0.23319, 0.23195, 0.23091, 0.23045, 0.23022, 0.22973, 0.22905, 0.22815, 0.22673, 0.22499, 0.22325, 0.22173, 0.22068, 0.21992, 0.21919, 0.21806, 0.21652, 0.21484, 0.21284, 0.21072, 0.20877, 0.20705, 0.20561, 0.2043, 0.20292, 0.20133, 0.19947, 0.19712, 0.19463, 0.1925, 0.19039, 0.18848, 0.18701, 0.18592, 0.18508, 0.1839, 0.18224, 0.18079, 0.17938, 0.17742, 0.17504, 0.17294, 0.17113, 0.16917, 0.16719, 0.16552, 0.16437, 0.16328, 0.16145, 0.15896, 0.15649, 0.1544, 0.15253, 0.15084, 0.14953, 0.14852, 0.14773, 0.14699, 0.14571, 0.14358, 0.14148, 0.13978, 0.13783, 0.13554, 0.13347, 0.1316, 0.12962, 0.12786, 0.12657, 0.12532, 0.12394, 0.12251, 0.12099, 0.11947, 0.11797, 0.11667, 0.11524, 0.11361, 0.11222, 0.11091, 0.10916, 0.10669, 0.10402, 0.1014, 0.09843, 0.0953, 0.09259, 0.09028, 0.08785, 0.08532, 0.08267, 0.08032, 0.07876, 0.07731, 0.07538, 0.07316, 0.07091, 0.06853, 0.06614, 0.06428, 0.06276, 0.06107, 0.05924, 0.05774, 0.05626, 0.05464, 0.05344, 0.05297, 0.05326, 0.05347, 0.05294, 0.05179, 0.05023, 0.04862, 0.04715, 0.04562, 0.04428, 0.04344, 0.04316, 0.04304, 0.0425, 0.04146, 0.03993, 0.03855, 0.03787, 0.03747, 0.03691, 0.03592, 0.03443, 0.03277, 0.03139, 0.03025, 0.02913, 0.0283, 0.02757, 0.02668, 0.02612, 0.02585, 0.02571, 0.02577, 0.02575, 0.02572, 0.0257, 0.02514, 0.02411, 0.02289, 0.02129, 0.01953, 0.01805, 0.01724, 0.0168, 0.01642, 0.01616, 0.01597, 0.01604, 0.01615, 0.01627, 0.01673, 0.01762, 0.01844, 0.01898, 0.01962, 0.02024, 0.02064, 0.02099, 0.02187, 0.0233, 0.02501, 0.02671, 0.02813, 0.02955, 0.031, 0.03222, 0.03308, 0.03367, 0.03413, 0.03443, 0.03437, 0.03424, 0.03395, 0.03346, 0.03308, 0.03293, 0.03303, 0.03337, 0.03427, 0.03575, 0.03715, 0.03827, 0.03927, 0.04035, 0.04164, 0.04275, 0.04341, 0.04354, 0.04335, 0.04356, 0.04438, 0.04513, 0.04561, 0.04639, 0.04771, 0.04944, 0.05123, 0.05256, 0.05345, 0.05429, 0.05533, 0.05653, 0.05788, 0.05942, 0.06129, 0.06372, 0.06617, 0.06833, 0.07049, 0.07276, 0.07522, 0.07786, 0.08048, 0.08282, 0.08484, 0.08649, 0.08793, 0.08968, 0.0917, 0.09363, 0.09557, 0.09769, 0.09982, 0.10167, 0.10339, 0.1051, 0.10669, 0.10852, 0.11091, 0.11349, 0.11607, 0.11851, 0.12071, 0.12229, 0.12327, 0.12466, 0.12649, 0.12845, 0.13066, 0.13297, 0.13535, 0.13767, 0.13966, 0.14166, 0.14358, 0.14516, 0.14668, 0.14814, 0.14985, 0.152, 0.15433, 0.15661, 0.15888, 0.16116, 0.16348, 0.16626, 0.16936, 0.17234, 0.17517, 0.17783, 0.18032, 0.1828, 0.18507, 0.18707, 0.1892, 0.19161, 0.19404, 0.19659, 0.19946, 0.20239, 0.20509, 0.20762, 0.21014, 0.21273, 0.2154, 0.21822, 0.22134, 0.22441, 0.22723, 0.23002, 0.23294, 0.2361, 0.2392, 0.2419, 0.24446, 0.24713, 0.24975, 0.2523, 0.2547, 0.25681, 0.25833, 0.25923, 0.26026, 0.26171, 0.26346, 0.2653, 0.26726, 0.26924, 0.27099, 0.27257, 0.27411, 0.27567, 0.27706, 0.27849, 0.27986, 0.28108, 0.28227, 0.28337, 0.28463, 0.28599, 0.28714, 0.28789, 0.28855, 0.28953, 0.29054, 0.2911, 0.29155, 0.29234, 0.29322, 0.29384, 0.29446, 0.29507, 0.29558, 0.29637, 0.29752, 0.29856, 0.29928, 0.29991, 0.3009, 0.30213, 0.30301, 0.30377, 0.30449, 0.30489, 0.30519, 0.30536, 0.30527, 0.30497, 0.30463, 0.3045, 0.30462, 0.30476, 0.30451, 0.30421, 0.30409, 0.30379, 0.30323, 0.30262, 0.30173, 0.30035, 0.29916, 0.29858, 0.29813, 0.29756, 0.29698, 0.29634, 0.29561, 0.29475, 0.29358, 0.29229, 0.29136, 0.29066, 0.28977, 0.28863, 0.28727, 0.28595, 0.28517, 0.28473, 0.28388, 0.28301, 0.28233, 0.28137, 0.28005, 0.27846, 0.27655, 0.2744, 0.27245, 0.27089, 0.2694, 0.26741, 0.26532, 0.26367, 0.26203, 0.25989, 0.25698, 0.25406, 0.2512, 0.24807, 0.24518, 0.24302, 0.24072, 0.23772, 0.23466, 0.23202, 0.23004, 0.22814, 0.22608, 0.2237, 0.22083, 0.21772, 0.21452, 0.2114, 0.2086, 0.20624, 0.20388, 0.20154, 0.1995, 0.19793, 0.19643, 0.19459, 0.19264, 0.19037, 0.18784, 0.18543, 0.18332, 0.18191, 0.18116, 0.18059, 0.17984, 0.1785, 0.17665, 0.17468, 0.17252, 0.17016, 0.16791, 0.16581, 0.16339, 0.16042, 0.15695, 0.15323, 0.14994, 0.14703, 0.14407, 0.14111, 0.13852, 0.13568, 0.13271, 0.13025, 0.12786, 0.12555, 0.12302, 0.12005, 0.11712, 0.11455, 0.11225, 0.11009, 0.10781, 0.10528, 0.10263, 0.10023, 0.0983, 0.09675, 0.0958, 0.09482, 0.09342, 0.09131, 0.08838, 0.08522, 0.08203, 0.07822, 0.07476, 0.07122, 0.06704, 0.06278, 0.05906, 0.05574, 0.05299, 0.05082, 0.0488, 0.04688, 0.04515, 0.04337, 0.04131, 0.03897, 0.03656, 0.03422, 0.03179, 0.02935, 0.02687, 0.02435, 0.02169, 0.01911, 0.0167, 0.01399, 0.01088, 0.00781, 0.00542, 0.00392, 0.00291, 0.00159, 0.00037, -0.00026, -0.00087, -0.00136, -0.00231, -0.00356, -0.0049, -0.00646, -0.00821, -0.00995, -0.01192, -0.01409, -0.01573, -0.01669, -0.01789, -0.01963, -0.02193, -0.0245, -0.02695, -0.02937, -0.03175, -0.03399, -0.03582, -0.03723, -0.03825, -0.03877, -0.03896, -0.03914, -0.03967, -0.04092, -0.04272, -0.04403, -0.04508, -0.04606, -0.04666, -0.04692, -0.0466, -0.04564, -0.0446, -0.04351, -0.04236, -0.04128, -0.04074, -0.04054, -0.04008, -0.0397, -0.03967, -0.0398, -0.03967, -0.03905, -0.03809, -0.03691, -0.03549, -0.03391, -0.03249, -0.03117, -0.02986, -0.02839, -0.02661, -0.02469, -0.02304, -0.02172, -0.02038, -0.01885, -0.01733, -0.01563, -0.0138, -0.01226, -0.01072, -0.00912, -0.00783, -0.00656, -0.0053, -0.00403, -0.00297, -0.00235, -0.00184, -0.00112, 0.00018, 0.00168, 0.00296, 0.0043, 0.00575, 0.00744, 0.00911, 0.01072, 0.01262, 0.01499, 0.01732, 0.01941, 0.02147, 0.0238, 0.026, 0.0276, 0.02883, 0.03025, 0.03195, 0.03383, 0.03573, 0.03784, 0.03984, 0.04172, 0.04355, 0.04532, 0.04729, 0.04946, 0.05235, 0.05585, 0.05921, 0.0621, 0.06453, 0.06692, 0.06937, 0.07165, 0.0737, 0.07617, 0.07918, 0.08221, 0.08484, 0.08678, 0.08864, 0.09032, 0.09189, 0.09379, 0.09636, 0.09927, 0.10223, 0.10516, 0.10808, 0.11121, 0.11416, 0.11658, 0.11913, 0.12169, 0.12386, 0.12612, 0.12869, 0.13125, 0.13378, 0.1365, 0.13949, 0.14252, 0.14563, 0.14871, 0.15207, 0.15544, 0.1584, 0.16136, 0.16425, 0.16718, 0.17046, 0.17391, 0.17705, 0.18025, 0.18366, 0.18723, 0.19049, 0.19322, 0.19588, 0.19845, 0.20125, 0.20417, 0.20699, 0.20958, 0.21215, 0.2146, 0.21695, 0.21938, 0.22188, 0.22443, 0.22691, 0.22899, 0.23101, 0.23336, 0.23589, 0.23822, 0.24042, 0.24268, 0.245, 0.24738, 0.24986, 0.25231, 0.25453, 0.25629, 0.25776, 0.2595, 0.26154, 0.26345, 0.26554, 0.26794, 0.2705, 0.27284, 0.2747, 0.27634, 0.2778, 0.27901, 0.27996, 0.28081, 0.2818, 0.28278, 0.28353, 0.28417, 0.2852, 0.28655, 0.28772, 0.28864, 0.28978, 0.29133, 0.29256, 0.29405, 0.29608, 0.29828, 0.30034, 0.30208, 0.30351, 0.30443, 0.30473, 0.30482, 0.30468, 0.30431, 0.30422, 0.30425, 0.30427, 0.30501, 0.30621, 0.30741, 0.30855, 0.3093, 0.30964, 0.30966, 0.3097, 0.30978, 0.30966, 0.30897, 0.30819, 0.30745, 0.30679, 0.30636, 0.30573, 0.30504, 0.3042, 0.30338, 0.30283, 0.30262, 0.30217, 0.30175, 0.30136, 0.30072, 0.29982, 0.2988, 0.29819, 0.29792, 0.29753, 0.29686, 0.29593, 0.29494, 0.29375, 0.29236, 0.29145, 0.29093, 0.29025, 0.28956, 0.2889, 0.28807, 0.28679, 0.28522, 0.28386, 0.28275, 0.28194, 0.28131, 0.28064, 0.28019, 0.28003, 0.28004, 0.27955, 0.27818, 0.27636, 0.27462, 0.27317, 0.27188, 0.27096, 0.27012, 0.26921, 0.26823, 0.26681, 0.2652, 0.26348, 0.26165, 0.25993, 0.25826, 0.25651, 0.25456, 0.25244, 0.25037, 0.24842, 0.24666, 0.24531, 0.2445, 0.24348, 0.24205, 0.2409, 0.23975, 0.23829, 0.23632, 0.2339, 0.23145, 0.22899};
 
-double vEOPy[] = {0.23007, 0.23234, 0.23449, 0.23658, 0.23868, 0.24084, 0.24316, 0.24568, 0.24844, 0.25134, 0.25428, 0.25716, 0.2599, 0.26241, 0.26471, 0.26689, 0.26901, 0.27116, 0.27341, 0.27581, 0.27834, 0.28093, 0.28354, 0.28617, 0.28874, 0.29116, 0.29338, 0.29549, 0.29759, 0.29979, 0.30213, 0.30464, 0.30724, 0.30982, 0.31229, 0.31461, 0.31681, 0.31894, 0.32105, 0.32322, 0.32549, 0.3279, 0.33048, 0.33323, 0.33619, 0.3393, 0.34243, 0.34548, 0.34836, 0.35102, 0.35341, 0.35561, 0.35773, 0.35991, 0.36219, 0.36455, 0.36699, 0.36946, 0.37195, 0.37445, 0.37694, 0.3794, 0.38178, 0.38409, 0.38634, 0.38853, 0.39066, 0.39276, 0.39488, 0.39714, 0.39957, 0.40209, 0.40456, 0.40684, 0.40883, 0.41055, 0.4122, 0.41398, 0.41602, 0.41834, 0.42086, 0.4234, 0.42581, 0.42803, 0.43013, 0.43215, 0.43408, 0.43595, 0.43775, 0.43951, 0.44136, 0.44347, 0.44576, 0.44811, 0.45038, 0.45248, 0.45449, 0.45649, 0.45855, 0.46079, 0.46325, 0.46584, 0.46846, 0.47098, 0.47324, 0.47523, 0.47701, 0.47869, 0.48037, 0.48204, 0.48362, 0.48508, 0.48641, 0.4876, 0.48871, 0.48981, 0.491, 0.49238, 0.4939, 0.49551, 0.49722, 0.49896, 0.50051, 0.50163, 0.50214, 0.5022, 0.50215, 0.50231, 0.50275, 0.50343, 0.5042, 0.50491, 0.50549, 0.50592, 0.50618, 0.50631, 0.5064, 0.50663, 0.50703, 0.5074, 0.50759, 0.50753, 0.50731, 0.50705, 0.50692, 0.50697, 0.50701, 0.507, 0.5069, 0.50663, 0.50614, 0.50545, 0.50471, 0.50406, 0.5036, 0.50333, 0.50315, 0.50297, 0.50277, 0.50253, 0.50217, 0.50164, 0.50089, 0.49992, 0.49878, 0.49763, 0.49667, 0.49602, 0.49557, 0.49522, 0.49483, 0.4943, 0.49356, 0.49259, 0.49149, 0.49044, 0.48951, 0.48869, 0.48787, 0.48691, 0.48578, 0.48448, 0.48307, 0.4816, 0.4801, 0.47861, 0.47721, 0.47599, 0.47484, 0.47359, 0.47219, 0.47063, 0.46895, 0.46718, 0.46541, 0.46371, 0.46216, 0.46076, 0.45946, 0.45821, 0.45701, 0.45584, 0.45467, 0.45342, 0.45199, 0.45032, 0.44843, 0.44638, 0.4442, 0.44189, 0.4395, 0.4371, 0.43475, 0.43249, 0.43043, 0.42838, 0.42644, 0.42462, 0.42285, 0.42103, 0.41906, 0.417, 0.41491, 0.4128, 0.41067, 0.40858, 0.40654, 0.40456, 0.40258, 0.40052, 0.39833, 0.39599, 0.39351, 0.39091, 0.38824, 0.38558, 0.38298, 0.38041, 0.37785, 0.3753, 0.37278, 0.3703, 0.36785, 0.36535, 0.36262, 0.35966, 0.35658, 0.35346, 0.35041, 0.34745, 0.34454, 0.34171, 0.33894, 0.33625, 0.33366, 0.33117, 0.3288, 0.32651, 0.3242, 0.32175, 0.31911, 0.31632, 0.31347, 0.3106, 0.30771, 0.30484, 0.3021, 0.29958, 0.29733, 0.29529, 0.29335, 0.29133, 0.28917, 0.28686, 0.28439, 0.28178, 0.27904, 0.27618, 0.27329, 0.27052, 0.26794, 0.26557, 0.26333, 0.26112, 0.25881, 0.25633, 0.25378, 0.25121, 0.2486, 0.24592, 0.24324, 0.24061, 0.23808, 0.23577, 0.23374, 0.23201, 0.23053, 0.22911, 0.22756, 0.22572, 0.22365, 0.22147, 0.21927, 0.21713, 0.21511, 0.21323, 0.21152, 0.20994, 0.20841, 0.20688, 0.20532, 0.20372, 0.20211, 0.20051, 0.19897, 0.19748, 0.19603, 0.1946, 0.19315, 0.19168, 0.19022, 0.18877, 0.18733, 0.1859, 0.18447, 0.18307, 0.1817, 0.18036, 0.17912, 0.17793, 0.17669, 0.17538, 0.17405, 0.17275, 0.17159, 0.17062, 0.16987, 0.16925, 0.16869, 0.16812, 0.16756, 0.16701, 0.16648, 0.16594, 0.16545, 0.16505, 0.16476, 0.1646, 0.16452, 0.16445, 0.16433, 0.16415, 0.16397, 0.16387, 0.1639, 0.16406, 0.16423, 0.16431, 0.16426, 0.16417, 0.16412, 0.16416, 0.16435, 0.16468, 0.16509, 0.1655, 0.16589, 0.16622, 0.16647, 0.16664, 0.16669, 0.16662, 0.16649, 0.16637, 0.16635, 0.16648, 0.16676, 0.16721, 0.16778, 0.16846, 0.16921, 0.17002, 0.17087, 0.17176, 0.17269, 0.17362, 0.17455, 0.17545, 0.17628, 0.17698, 0.17757, 0.17805, 0.1785, 0.17895, 0.17942, 0.1799, 0.18035, 0.18074, 0.18106, 0.18147, 0.18211, 0.18296, 0.18396, 0.18501, 0.18603, 0.18694, 0.18783, 0.1888, 0.18995, 0.1913, 0.1928, 0.19432, 0.1957, 0.19687, 0.19784, 0.19867, 0.19945, 0.20022, 0.20112, 0.20218, 0.20332, 0.2045, 0.20563, 0.20672, 0.20778, 0.20886, 0.21006, 0.21134, 0.21261, 0.21381, 0.21491, 0.21592, 0.21684, 0.21769, 0.21855, 0.21948, 0.22049, 0.22161, 0.22287, 0.22428, 0.22578, 0.22734, 0.22897, 0.23063, 0.23234, 0.23409, 0.23583, 0.23756, 0.23932, 0.24104, 0.24266, 0.24416, 0.24564, 0.24721, 0.24895, 0.25078, 0.25253, 0.25423, 0.25597, 0.25782, 0.25977, 0.26175, 0.26374, 0.26571, 0.26767, 0.26966, 0.27171, 0.27386, 0.27609, 0.27838, 0.28064, 0.28281, 0.28482, 0.28664, 0.28828, 0.28981, 0.29133, 0.29291, 0.29458, 0.29636, 0.29825, 0.30029, 0.30251, 0.30487, 0.30725, 0.30959, 0.31185, 0.31396, 0.31591, 0.31777, 0.31961, 0.32147, 0.3233, 0.32505, 0.32668, 0.32818, 0.32971, 0.33133, 0.33305, 0.33492, 0.33699, 0.33927, 0.34165, 0.34403, 0.34624, 0.34817, 0.34978, 0.35115, 0.35238, 0.35368, 0.35521, 0.35696, 0.35883, 0.36077, 0.36272, 0.36469, 0.36666, 0.36857, 0.37042, 0.37226, 0.37412, 0.37604, 0.37799, 0.37991, 0.38176, 0.38352, 0.38525, 0.38702, 0.38887, 0.39089, 0.39311, 0.3954, 0.39751, 0.39934, 0.4009, 0.40222, 0.40339, 0.40453, 0.40587, 0.40737, 0.40893, 0.41052, 0.41214, 0.41385, 0.41559, 0.4172, 0.41863, 0.41985, 0.42088, 0.42178, 0.42263, 0.42354, 0.42458, 0.42585, 0.42735, 0.42899, 0.43065, 0.43222, 0.43363, 0.43486, 0.43594, 0.43689, 0.43774, 0.43856, 0.43941, 0.44036, 0.44141, 0.44252, 0.44362, 0.44468, 0.44569, 0.44665, 0.44761, 0.44856, 0.44945, 0.45023, 0.45092, 0.45154, 0.45213, 0.45278, 0.45352, 0.45434, 0.45524, 0.4562, 0.4572, 0.45824, 0.45931, 0.46037, 0.46138, 0.46241, 0.46348, 0.46464, 0.46589, 0.46715, 0.46825, 0.46918, 0.46997, 0.4707, 0.47145, 0.4723, 0.4733, 0.47438, 0.47537, 0.47612, 0.47655, 0.47666, 0.47652, 0.47628, 0.47612, 0.47616, 0.47641, 0.47683, 0.47737, 0.47799, 0.47865, 0.4793, 0.47982, 0.48015, 0.48025, 0.48015, 0.47992, 0.47968, 0.47941, 0.47917, 0.47905, 0.47911, 0.47922, 0.47917, 0.47887, 0.47841, 0.4778, 0.47707, 0.4765, 0.47628, 0.47622, 0.476, 0.47542, 0.47468, 0.47387, 0.47297, 0.472, 0.47103, 0.47015, 0.46943, 0.46878, 0.46807, 0.46729, 0.46647, 0.4656, 0.46465, 0.46359, 0.46247, 0.46135, 0.46026, 0.45919, 0.45808, 0.45686, 0.45551, 0.45408, 0.45264, 0.45134, 0.45033, 0.44963, 0.44917, 0.44881, 0.44842, 0.44788, 0.44715, 0.44619, 0.44492, 0.44333, 0.44153, 0.43964, 0.43779, 0.43602, 0.43432, 0.43269, 0.43108, 0.42943, 0.42772, 0.42599, 0.42431, 0.42278, 0.42139, 0.42002, 0.41852, 0.41695, 0.41535, 0.41369, 0.41193, 0.41008, 0.40819, 0.40638, 0.40462, 0.40283, 0.40098, 0.39907, 0.39709, 0.39509, 0.3932, 0.39147, 0.38984, 0.38821, 0.38651, 0.38475, 0.38295, 0.38115, 0.37936, 0.37759, 0.37589, 0.37427, 0.37264, 0.37085, 0.36879, 0.36656, 0.36434, 0.36224, 0.36033, 0.35861, 0.35706, 0.35561, 0.35414, 0.35255, 0.35077, 0.34875, 0.34646, 0.34394, 0.34128, 0.33866, 0.33622, 0.334, 0.33193, 0.32993, 0.32789, 0.32579, 0.32358, 0.32124, 0.31884, 0.31647, 0.31422, 0.31211, 0.31011, 0.30812, 0.30606, 0.30395, 0.30186, 0.29985, 0.29786, 0.29582, 0.29381, 0.29195, 0.29025, 0.28866, 0.28708, 0.28537, 0.28345, 0.28135, 0.27911, 0.27676, 0.27433, 0.2719, 0.26954, 0.26736, 0.26536, 0.26349, 0.26172, 0.25999, 0.25824, 0.25641, 0.25448, 0.25246, 0.25038, 0.24822, 0.24599, 0.24377, 0.24166, 0.23976, 0.23801, 0.23624, 0.23437, 0.23233, 0.23016, 0.22795, 0.22586, 0.2239, 0.22203, 0.22019, 0.21838, 0.2166, 0.21493, 0.21346, 0.21214, 0.21089, 0.20964, 0.20836, 0.20699, 0.20554, 0.20399, 0.20245, 0.20101, 0.19972, 0.19852, 0.19738, 0.19627, 0.19513, 0.1939, 0.19254, 0.19103, 0.18933, 0.18751, 0.18571, 0.18413, 0.18273, 0.18141, 0.18016, 0.179, 0.17797, 0.1771, 0.1764, 0.17582, 0.17527, 0.17473, 0.17423, 0.17383, 0.17352, 0.17325, 0.17299, 0.17268, 0.17233, 0.17197, 0.1717, 0.17156, 0.17154, 0.17152, 0.17137, 0.171, 0.1704, 0.1697, 0.1691, 0.16877, 0.16869, 0.16876, 0.16886, 0.16889, 0.1688, 0.16862, 0.16844, 0.16838, 0.16849, 0.16872, 0.16902, 0.16943, 0.16992, 0.17037, 0.17073, 0.17106, 0.17144, 0.17195, 0.17261, 0.1734, 0.17427, 0.17515, 0.1761, 0.17714, 0.17819, 0.17916, 0.18, 0.18081, 0.18159, 0.18235, 0.18311, 0.18395, 0.18498, 0.18616, 0.18731, 0.18839, 0.18949, 0.19064, 0.19187, 0.19312, 0.19442, 0.19588, 0.1975, 0.19923, 0.20106, 0.20296, 0.20485, 0.20665, 0.20823, 0.20962, 0.2109, 0.21215, 0.2134, 0.21471, 0.21618, 0.2179, 0.21986, 0.22201, 0.22428, 0.22662, 0.22897, 0.23128, 0.23348, 0.23561, 0.23779, 0.23996, 0.24212, 0.24423, 0.24632, 0.24841, 0.25049, 0.25254, 0.2546, 0.25673, 0.25893, 0.2611, 0.26317, 0.2652, 0.2673, 0.26952, 0.27184, 0.27424, 0.27671, 0.2793, 0.282, 0.28476, 0.28755, 0.29028, 0.29292, 0.29548, 0.29809, 0.30078, 0.30349, 0.30621, 0.30896, 0.31181, 0.31474, 0.3176, 0.3204, 0.32318, 0.32593, 0.32865, 0.33138, 0.33409, 0.33674, 0.33928, 0.34167, 0.34391, 0.34603, 0.34815, 0.35036, 0.35278, 0.35543, 0.35824, 0.36111, 0.3639, 0.36655, 0.36912, 0.37176, 0.37449, 0.37726, 0.38003, 0.38273, 0.38528, 0.38762, 0.38988, 0.39214, 0.3945, 0.39706, 0.39988, 0.40293, 0.40613, 0.40931, 0.41244, 0.41554, 0.41858, 0.4215, 0.42424, 0.42679, 0.42919, 0.43141, 0.43345, 0.43535, 0.43723, 0.43928, 0.44167, 0.44426, 0.44689, 0.4495, 0.45207, 0.45457, 0.45691, 0.45905, 0.461, 0.46276, 0.46441, 0.46611, 0.46802, 0.47021, 0.4726, 0.47512, 0.47753, 0.4797, 0.48163, 0.48335, 0.48493, 0.48644, 0.48795, 0.4894, 0.49077, 0.49212, 0.49358, 0.49527, 0.4973, 0.49967, 0.50216, 0.50448, 0.50646, 0.5081, 0.50949, 0.51077, 0.51218, 0.51372, 0.51526, 0.51675, 0.51809, 0.51926, 0.52035, 0.52159, 0.52308, 0.52485, 0.52683, 0.5288, 0.53063, 0.53226, 0.53368, 0.53496, 0.53618, 0.53739, 0.53864, 0.53996, 0.54132, 0.5426, 0.54371, 0.5446, 0.54525, 0.54559, 0.54572, 0.54587, 0.54631, 0.54704, 0.54794, 0.54893, 0.54993, 0.55087, 0.55164, 0.55218, 0.55258, 0.55296, 0.55354, 0.55444, 0.55563, 0.5569, 0.55787, 0.55843, 0.55862, 0.55858, 0.55843, 0.55821, 0.55789, 0.55768, 0.55766, 0.55781, 0.55799, 0.55807, 0.55802, 0.55781, 0.55749, 0.55708, 0.55664, 0.55629, 0.55605, 0.55589, 0.55578, 0.55571, 0.55551, 0.55505, 0.55433, 0.55344, 0.55243, 0.55131, 0.5501, 0.5488, 0.54742, 0.54598, 0.54449, 0.543, 0.54156, 0.54012, 0.53862, 0.53706, 0.53551, 0.53402, 0.53255, 0.53105, 0.52949, 0.52784, 0.52614, 0.52448, 0.52289, 0.52136, 0.5198, 0.51807, 0.51612, 0.51392, 0.51149, 0.50898, 0.50652, 0.50413, 0.50181, 0.49947, 0.49704, 0.49451, 0.49184, 0.48904, 0.48615, 0.48324, 0.4803, 0.47721, 0.47399, 0.47075, 0.46762, 0.46473, 0.46206, 0.45928, 0.45634, 0.45336, 0.45036, 0.44727, 0.44405, 0.44076, 0.4375, 0.43429, 0.43112, 0.42791, 0.42457, 0.42104, 0.41742, 0.41381, 0.41029, 0.40683, 0.40336, 0.39974, 0.39598, 0.39223, 0.38848, 0.38464, 0.38068, 0.37659, 0.37238, 0.36818, 0.36409, 0.36011, 0.35616, 0.3522, 0.34829, 0.34447, 0.34079, 0.3372, 0.33365, 0.33006, 0.32636, 0.32257, 0.31876, 0.31497, 0.31116, 0.30731, 0.30341, 0.29949, 0.29554, 0.29159, 0.28768, 0.28381, 0.28002, 0.27628, 0.27249, 0.2686, 0.26466, 0.26073, 0.25682, 0.25288, 0.24893, 0.24506, 0.24132, 0.23769, 0.23412, 0.23054, 0.22695, 0.22336, 0.21978, 0.2163, 0.21295, 0.20966, 0.20647, 0.20343, 0.20052, 0.1977, 0.19492, 0.19211, 0.18923, 0.18637, 0.18347, 0.18049, 0.17756, 0.17477, 0.17214, 0.16957, 0.16698, 0.16438, 0.16183, 0.15941, 0.15716, 0.15508, 0.15309, 0.15109, 0.14887, 0.14639, 0.14376, 0.141, 0.13813, 0.13531, 0.13288, 0.13088, 0.12914, 0.12741, 0.12559, 0.12365, 0.12168, 0.11982, 0.11808, 0.11649, 0.11494, 0.11343, 0.11204, 0.11082, 0.10986, 0.10899, 0.10806, 0.10704, 0.10601, 0.10502, 0.10406, 0.10308, 0.10196, 0.10066, 0.09922, 0.09764, 0.09596, 0.0943, 0.09276, 0.09149, 0.09061, 0.09004, 0.08945, 0.08865, 0.08772, 0.08683, 0.08612, 0.08571, 0.08556, 0.08546, 0.0852, 0.0847, 0.08405, 0.08334, 0.08269, 0.08231, 0.08227, 0.08246, 0.08274, 0.08308, 0.08344, 0.0838, 0.08414, 0.08445, 0.08477, 0.08514, 0.08551, 0.08581, 0.0861, 0.08643, 0.08682, 0.08735, 0.08815, 0.08931, 0.09067, 0.09211, 0.09353, 0.09487, 0.09603, 0.097, 0.098, 0.09915, 0.1005, 0.10204, 0.10369, 0.1054, 0.10715, 0.1089, 0.1106, 0.11221, 0.11383, 0.1156, 0.11754, 0.11958, 0.12162, 0.1236, 0.12554, 0.12747, 0.12946, 0.13156, 0.13389, 0.13656, 0.1395, 0.14259, 0.14575, 0.14889, 0.15193, 0.15482, 0.15768, 0.16068, 0.16393, 0.1674, 0.17097, 0.17446, 0.17776, 0.18082, 0.18365, 0.18637, 0.18909, 0.19189, 0.19475, 0.19768, 0.20079, 0.20408, 0.20745, 0.21069, 0.21359, 0.21619, 0.21865, 0.22134, 0.22435, 0.22749, 0.2305, 0.23322, 0.23576, 0.23845, 0.24159, 0.24521, 0.24909, 0.25291, 0.25645, 0.2598, 0.26319, 0.26677, 0.27047, 0.27431, 0.2782, 0.28192, 0.28538, 0.28874, 0.2922, 0.29584, 0.2996, 0.3034, 0.30721, 0.31096, 0.31459, 0.31804, 0.32119, 0.324, 0.3267, 0.32949, 0.33252, 0.33591, 0.33976, 0.34407, 0.34863, 0.35314, 0.35739, 0.36124, 0.36471, 0.368, 0.37137, 0.37508, 0.37913, 0.38326, 0.38725, 0.39109, 0.39489, 0.39874, 0.40273, 0.40684, 0.41101, 0.41518, 0.41936, 0.4234, 0.42723, 0.43089, 0.43439, 0.4378, 0.44118, 0.44457, 0.44808, 0.45156, 0.45497, 0.45841, 0.46199, 0.46597, 0.47029, 0.47454, 0.47842, 0.48176, 0.48462, 0.48727, 0.48993, 0.49276, 0.49569, 0.49867, 0.50162, 0.50456, 0.50754, 0.51052, 0.51331, 0.51566, 0.5176, 0.51934, 0.52108, 0.52298, 0.52521, 0.52783, 0.53072, 0.53367, 0.53653, 0.53925, 0.54185, 0.54439, 0.54691, 0.54937, 0.55171, 0.55392, 0.55604, 0.55808, 0.56, 0.56174, 0.56322, 0.56456, 0.56598, 0.56771, 0.56986, 0.57225, 0.57456, 0.57651, 0.57812, 0.57953, 0.58085, 0.58212, 0.58337, 0.58461, 0.58587, 0.58704, 0.58811, 0.58914, 0.59017, 0.59112, 0.59193, 0.59264, 0.59323, 0.5937, 0.59415, 0.59457, 0.59493, 0.59518, 0.59528, 0.59533, 0.59549, 0.59572, 0.59598, 0.59626, 0.59656, 0.59673, 0.59666, 0.5963, 0.59562, 0.59471, 0.59364, 0.59247, 0.59134, 0.5903, 0.58921, 0.58798, 0.58658, 0.5851, 0.58359, 0.58202, 0.58044, 0.57886, 0.57712, 0.57525, 0.57335, 0.57142, 0.56949, 0.56769, 0.56619, 0.56497, 0.56377, 0.56233, 0.56044, 0.55804, 0.55535, 0.55261, 0.54993, 0.54727, 0.54457, 0.54182, 0.53907, 0.53635, 0.53375, 0.53131, 0.52901, 0.52673, 0.52433, 0.52172, 0.51889, 0.51591, 0.51286, 0.50973, 0.50658, 0.50355, 0.50072, 0.49795, 0.49514, 0.49228, 0.48939, 0.48651, 0.48369, 0.48091, 0.47806, 0.47508, 0.47213, 0.46931, 0.46656, 0.46374, 0.46071, 0.4574, 0.45379, 0.44992, 0.44588, 0.44179, 0.43772, 0.43386, 0.43022, 0.42665, 0.4231, 0.41956, 0.41603, 0.41252, 0.40904, 0.40552, 0.40193, 0.39829, 0.39468, 0.39113, 0.38761, 0.38413, 0.38068, 0.37721, 0.3736, 0.36974, 0.36568, 0.36146, 0.35706, 0.3525, 0.34794, 0.34346, 0.33906, 0.33476, 0.33054, 0.32639, 0.32232, 0.31829, 0.31439, 0.31058, 0.30683, 0.3032, 0.29964, 0.29599, 0.29216, 0.2881, 0.28384, 0.27952, 0.27531, 0.27122, 0.26732, 0.26381, 0.26057, 0.25734, 0.25392, 0.25026, 0.24649, 0.24267, 0.23888, 0.23523, 0.2317, 0.22816, 0.22451, 0.22067, 0.21677, 0.21311, 0.20968, 0.20645, 0.20346, 0.20065, 0.19788, 0.19499, 0.19194, 0.18885, 0.18581, 0.18287, 0.18005, 0.17735, 0.1747, 0.17205, 0.16947, 0.16696, 0.16442, 0.1617, 0.15883, 0.15583, 0.15278, 0.14974, 0.1468, 0.14396, 0.14117, 0.13832, 0.13528, 0.13227, 0.12949, 0.12701, 0.12484, 0.12296, 0.12119, 0.1194, 0.11747, 0.11561, 0.11397, 0.11256, 0.11122, 0.10988, 0.10839, 0.10665, 0.10482, 0.10312, 0.10166, 0.10046, 0.09953, 0.09875, 0.09795, 0.09703, 0.09607, 0.09529, 0.09472, 0.09426, 0.09379, 0.09322, 0.09254, 0.09179, 0.09109, 0.09053, 0.09001, 0.08939, 0.08862, 0.08775, 0.08685, 0.08602, 0.0854, 0.0851, 0.0851, 0.08538, 0.08589, 0.08653, 0.08722, 0.08791, 0.08864, 0.08933, 0.08996, 0.09053, 0.09106, 0.09155, 0.092, 0.09238, 0.09272, 0.09307, 0.09352, 0.09411, 0.09474, 0.09531, 0.09594, 0.09682, 0.09803, 0.09948, 0.10099, 0.10237, 0.10358, 0.10474, 0.10592, 0.1071, 0.10829, 0.10955, 0.11094, 0.11253, 0.11442, 0.11649, 0.11856, 0.12063, 0.1227, 0.12477, 0.12679, 0.12875, 0.13057, 0.1323, 0.13401, 0.13578, 0.13762, 0.13951, 0.14145, 0.14351, 0.14563, 0.14777, 0.1499, 0.1521, 0.15445, 0.15686, 0.15928, 0.1618, 0.16445, 0.16722, 0.17002, 0.17277, 0.17546, 0.17818, 0.18096, 0.18372, 0.18635, 0.18881, 0.19114, 0.19341, 0.19572, 0.19816, 0.20082, 0.2039, 0.20711, 0.21047, 0.21379, 0.21702, 0.22021, 0.2234, 0.22662, 0.22988, 0.23315, 0.23646, 0.23974, 0.24292, 0.24602, 0.24907, 0.25215, 0.25533, 0.25865, 0.26218, 0.26606, 0.27017, 0.27419, 0.27795, 0.28153, 0.28513, 0.2888, 0.29251, 0.29622, 0.29997, 0.30382, 0.30776, 0.31171, 0.3156, 0.31941, 0.32309, 0.32657, 0.32993, 0.33329, 0.33697, 0.34081, 0.34459, 0.34821, 0.3517, 0.35514, 0.35864, 0.36224, 0.36599, 0.36986, 0.37375, 0.3775, 0.38101, 0.38425, 0.38737, 0.39051, 0.39374, 0.39709, 0.40058, 0.40418, 0.40777, 0.41113, 0.41432, 0.41748, 0.42063, 0.42371, 0.4266, 0.42928, 0.43184, 0.43438, 0.43703, 0.43991, 0.44305, 0.44635, 0.44959, 0.45259, 0.45548, 0.45839, 0.46135, 0.46421, 0.46689, 0.46935, 0.47163, 0.47379, 0.47595, 0.47823, 0.48071, 0.48336, 0.48603, 0.48856, 0.49089, 0.49315, 0.49542, 0.49765, 0.49982, 0.50191, 0.50396, 0.50597, 0.50793, 0.50986, 0.51171, 0.51348, 0.51518, 0.51668, 0.51791, 0.51889, 0.51959, 0.52006, 0.52052, 0.52126, 0.52247, 0.52407, 0.52573, 0.52713, 0.52817, 0.529, 0.52976, 0.53058, 0.53141, 0.53217, 0.53279, 0.53327, 0.53371, 0.53414, 0.53459, 0.53502, 0.53536, 0.53566, 0.53605, 0.53659, 0.53708, 0.53731, 0.53724, 0.53694, 0.53646, 0.53586, 0.53523, 0.53465, 0.53422, 0.53376, 0.53314, 0.53238, 0.53159, 0.53087, 0.53019, 0.52949, 0.52875, 0.52791, 0.52696, 0.5259, 0.5248, 0.52376, 0.5228, 0.52194, 0.52103, 0.51998, 0.51878, 0.51744, 0.51609, 0.51477, 0.51347, 0.51217, 0.51086, 0.50952, 0.50816, 0.50682, 0.50548, 0.50403, 0.50236, 0.50047, 0.49844, 0.49642, 0.49448, 0.49243, 0.49024, 0.48805, 0.48592, 0.48383, 0.48169, 0.47947, 0.47714, 0.47474, 0.47243, 0.47032, 0.46846, 0.46681, 0.4652, 0.46348, 0.46168, 0.45985, 0.45802, 0.45624, 0.45447, 0.45263, 0.4507, 0.44858, 0.44622, 0.44368, 0.44111, 0.43863, 0.43612, 0.43342, 0.43076, 0.42838, 0.42622, 0.42408, 0.42175, 0.41922, 0.41672, 0.41429, 0.41187, 0.40944, 0.40693, 0.40428, 0.40143, 0.39824, 0.39486, 0.39151, 0.38831, 0.38529, 0.3824, 0.37951, 0.37649, 0.37338, 0.3703, 0.36738, 0.36469, 0.36221, 0.35983, 0.3575, 0.35514, 0.35265, 0.35004, 0.34741, 0.34482, 0.34221, 0.33951, 0.33668, 0.33376, 0.33078, 0.32788, 0.32514, 0.32255, 0.31997, 0.31734, 0.31462, 0.31176, 0.30876, 0.30563, 0.30236, 0.29895, 0.29561, 0.2925, 0.2897, 0.28723, 0.28497, 0.28276, 0.28048, 0.27818, 0.27589, 0.27356, 0.27117, 0.26872, 0.26621, 0.26373, 0.26134, 0.25909, 0.25693, 0.25484, 0.25273, 0.25049, 0.24803, 0.24538, 0.24256, 0.23969, 0.23694, 0.23441, 0.23216, 0.23021, 0.22845, 0.22675, 0.22502, 0.22318, 0.22121, 0.21922, 0.21732, 0.21554, 0.21379, 0.21204, 0.21026, 0.20847, 0.20675, 0.20513, 0.20359, 0.20201, 0.20025, 0.19825, 0.1961, 0.19407, 0.19236, 0.19115, 0.19023, 0.1893, 0.18818, 0.18678, 0.18507, 0.18331, 0.18163, 0.18009, 0.17874, 0.17758, 0.17659, 0.17569, 0.17478, 0.17392, 0.17321, 0.17265, 0.1722, 0.17176, 0.17125, 0.17061, 0.16989, 0.16921, 0.16868, 0.16831, 0.16808, 0.16794, 0.16778, 0.16763, 0.16759, 0.16768, 0.16791, 0.16815, 0.1682, 0.16791, 0.16748, 0.16707, 0.16678, 0.1667, 0.1669, 0.16733, 0.16789, 0.16845, 0.16898, 0.16953, 0.17019, 0.171, 0.17186, 0.17258, 0.17328, 0.17404, 0.17473, 0.17525, 0.1755, 0.17557, 0.17578, 0.1762, 0.17676, 0.17754, 0.1786, 0.17991, 0.18137, 0.1828, 0.18408, 0.18519, 0.18613, 0.18697, 0.1878, 0.1886, 0.18945, 0.19045, 0.19177, 0.19337, 0.19513, 0.1969, 0.19864, 0.20053, 0.20249, 0.20448, 0.20655, 0.20868, 0.21077, 0.21277, 0.2147, 0.21682, 0.21902, 0.22112, 0.22298, 0.22465, 0.22625, 0.22786, 0.22955, 0.23128, 0.23284, 0.23422, 0.23561, 0.23724, 0.23904, 0.24099, 0.24308, 0.24531, 0.24761, 0.24991, 0.25227, 0.25472, 0.25713, 0.25942, 0.26158, 0.26368, 0.26591, 0.26838, 0.271, 0.27382, 0.27677, 0.2797, 0.28248, 0.28514, 0.28776, 0.29038, 0.29307, 0.29591, 0.29877, 0.30154, 0.30427, 0.30704, 0.30993, 0.3127, 0.31512, 0.31726, 0.31935, 0.32159, 0.32395, 0.32621, 0.32831, 0.33031, 0.33231, 0.33442, 0.33668, 0.33908, 0.34139, 0.34353, 0.34557, 0.34758, 0.34964, 0.35176, 0.35391, 0.356, 0.35798, 0.35983, 0.3616, 0.36336, 0.36519, 0.36717, 0.36934, 0.37187, 0.37462, 0.37739, 0.38002, 0.38246, 0.38466, 0.38653, 0.38815, 0.38981, 0.39169, 0.39374, 0.39579, 0.39771, 0.39942, 0.40101, 0.40257, 0.40415, 0.40575, 0.40735, 0.40897, 0.41058, 0.41209, 0.41347, 0.41474, 0.416, 0.41734, 0.41881, 0.4205, 0.42216, 0.42366, 0.42502, 0.42631, 0.42764, 0.42911, 0.43067, 0.43212, 0.43339, 0.43458, 0.43582, 0.43725, 0.43886, 0.44051, 0.44216, 0.44384, 0.44555, 0.44722, 0.44874, 0.45008, 0.45134, 0.45273, 0.45432, 0.456, 0.45763, 0.45917, 0.46056, 0.46167, 0.46255, 0.46334, 0.46417, 0.46503, 0.4659, 0.46678, 0.46763, 0.4684, 0.46913, 0.46996, 0.47097, 0.47212, 0.47334, 0.47453, 0.47558, 0.47646, 0.4771, 0.47752, 0.47786, 0.47822, 0.47855, 0.47873, 0.4787, 0.47856, 0.47852, 0.4786, 0.47871, 0.47866, 0.47854, 0.4784, 0.47812, 0.47774, 0.47745, 0.47734, 0.47734, 0.47731, 0.47709, 0.47678, 0.47658, 0.47658, 0.47665, 0.47658, 0.47647, 0.47643, 0.47639, 0.47619, 0.47573, 0.4749, 0.47372, 0.47241, 0.47121, 0.47018, 0.46928, 0.46855, 0.46797, 0.46736, 0.46675, 0.46621, 0.46576, 0.4654, 0.46511, 0.46485, 0.46445, 0.46376, 0.46263, 0.46118, 0.45966, 0.45816, 0.45671, 0.45527, 0.45393, 0.45269, 0.45134, 0.44977, 0.4481, 0.44655, 0.44521, 0.444, 0.44269, 0.4413, 0.43978, 0.43806, 0.43612, 0.43405, 0.43214, 0.43069, 0.42964, 0.42869, 0.42758, 0.42617, 0.42466, 0.42332, 0.42217, 0.42108, 0.41991, 0.41857, 0.41699, 0.41509, 0.41307, 0.41121, 0.40956, 0.40801, 0.40637, 0.40465, 0.40292, 0.40132, 0.39982, 0.3984, 0.39697, 0.39552, 0.39404, 0.39237, 0.39051, 0.38836, 0.38601, 0.38361, 0.38126, 0.37901, 0.37692, 0.37489, 0.37284, 0.37079, 0.36874, 0.36673, 0.36481, 0.36288, 0.36097, 0.35908, 0.35712, 0.35507, 0.35308, 0.35119, 0.34926, 0.34721, 0.34504, 0.34289, 0.34095, 0.33927, 0.33773, 0.33631, 0.33519, 0.33432, 0.33349, 0.33255, 0.33143, 0.32994, 0.32806, 0.326, 0.32398, 0.32207, 0.32026, 0.31861, 0.31719, 0.31591, 0.31466, 0.31359, 0.31271, 0.31171, 0.31027, 0.30852, 0.30688, 0.30539, 0.30397, 0.30261, 0.30136, 0.30016, 0.2989, 0.29746, 0.29573, 0.29375, 0.29187, 0.29029, 0.28898, 0.28792, 0.2872, 0.28672, 0.28635, 0.28587, 0.28504, 0.28374, 0.28206, 0.28016, 0.27816, 0.27624, 0.27453, 0.27299, 0.27158, 0.27019, 0.26886, 0.26766, 0.26659, 0.26553, 0.26443, 0.26334, 0.26241, 0.26157, 0.2607, 0.25974, 0.2587, 0.25751, 0.25617, 0.25483, 0.25361, 0.25274, 0.25239, 0.25241, 0.25244, 0.25236, 0.2521, 0.25139, 0.2504, 0.24939, 0.24841, 0.2476, 0.24713, 0.24698, 0.24688, 0.2466, 0.2461, 0.24563, 0.2453, 0.24508, 0.24484, 0.24448, 0.24395, 0.24327, 0.24255, 0.24198, 0.24166, 0.24164, 0.24186, 0.24219, 0.24252, 0.24272, 0.24273, 0.24255, 0.24218, 0.24178, 0.24141, 0.24103, 0.2406, 0.24015, 0.23972, 0.23931, 0.2391, 0.23922, 0.2396, 0.2401, 0.24064, 0.24113, 0.24147, 0.24158, 0.24158, 0.24153, 0.24131, 0.24108, 0.24107, 0.24119, 0.24113, 0.24083, 0.24038, 0.23996, 0.23971, 0.23972, 0.24, 0.24033, 0.24055, 0.2408, 0.24131, 0.24214, 0.24311, 0.24413, 0.24524, 0.24649, 0.24768, 0.24852, 0.24892, 0.24902, 0.24901, 0.24908, 0.24944, 0.25013, 0.25102, 0.25194, 0.25286, 0.25391, 0.25517, 0.25658, 0.2579, 0.25893, 0.25959, 0.25996, 0.26017, 0.26053, 0.26115, 0.26196, 0.26279, 0.26361, 0.26459, 0.2658, 0.26719, 0.26866, 0.27018, 0.27178, 0.27342, 0.27494, 0.27615, 0.27701, 0.27767, 0.27835, 0.2791, 0.27983, 0.2805, 0.28111, 0.28161, 0.28216, 0.28282, 0.28343, 0.284, 0.28463, 0.28542, 0.2863, 0.28733, 0.28863, 0.29018, 0.29166, 0.29284, 0.29366, 0.29413, 0.29453, 0.29508, 0.29583, 0.29679, 0.29785, 0.29874, 0.2994, 0.29993, 0.30048, 0.30117, 0.30204, 0.30295, 0.3038, 0.30462, 0.30552, 0.30651, 0.3075, 0.30834, 0.309, 0.30958, 0.31019, 0.31091, 0.31191, 0.31322, 0.3147, 0.31613, 0.31737, 0.31849, 0.31965, 0.32087, 0.32208, 0.32327, 0.32451, 0.32575, 0.32681, 0.32751, 0.32803, 0.32857, 0.32922, 0.33001, 0.33082, 0.33156, 0.3322, 0.33272, 0.33316, 0.33359, 0.33409, 0.33476, 0.33563, 0.3366, 0.33762, 0.33869, 0.33971, 0.34067, 0.34156, 0.34244, 0.34347, 0.34466, 0.34576, 0.34661, 0.34718, 0.34758, 0.34794, 0.34831, 0.34885, 0.34969, 0.3508, 0.35205, 0.35332, 0.35453, 0.35567, 0.35685, 0.35805, 0.35917, 0.36015, 0.36099, 0.36168, 0.36228, 0.36281, 0.36327, 0.36372, 0.36419, 0.36462, 0.36495, 0.36525, 0.36558, 0.36604, 0.3666, 0.36717, 0.36779, 0.36844, 0.36903, 0.36957, 0.37011, 0.37078, 0.37166, 0.3726, 0.37331, 0.37377, 0.37415, 0.3746, 0.37508, 0.37547, 0.37574, 0.37595, 0.376, 0.37593, 0.37596, 0.37626, 0.37679, 0.37748, 0.37827, 0.37915, 0.38006, 0.38092, 0.38165, 0.3822, 0.38261, 0.38275, 0.38265, 0.38261, 0.38275, 0.38288, 0.38291, 0.38287, 0.38279, 0.38274, 0.38269, 0.38255, 0.38243, 0.3825, 0.38274, 0.38298, 0.38313, 0.38323, 0.3834, 0.38365, 0.38379, 0.3837, 0.38348, 0.3833, 0.38317, 0.38298, 0.38262, 0.38212, 0.38161, 0.38107, 0.38058, 0.38021, 0.37978, 0.37908, 0.3782, 0.37732, 0.37663, 0.37643, 0.37678, 0.37748, 0.37812, 0.37839, 0.37842, 0.37839, 0.37847, 0.37865, 0.37879, 0.37879, 0.37859, 0.37819, 0.37775, 0.37738, 0.37707, 0.37689, 0.37691, 0.37718, 0.37768, 0.37834, 0.37894, 0.37932, 0.37944, 0.37936, 0.37916, 0.37907, 0.37928, 0.37971, 0.38016, 0.38051, 0.38082, 0.38118, 0.38164, 0.382, 0.38215, 0.38219, 0.38219, 0.38203, 0.38159, 0.38085, 0.37984, 0.37879, 0.37801, 0.37768, 0.37772, 0.37796, 0.37828, 0.37837, 0.37816, 0.37787, 0.37764, 0.37741, 0.37711, 0.37679, 0.37647, 0.37627, 0.37614, 0.37586, 0.37542, 0.37505, 0.3749, 0.3749, 0.37493, 0.37495, 0.37496, 0.37502, 0.37527, 0.37564, 0.37585, 0.37604, 0.3764, 0.37687, 0.37727, 0.37749, 0.37747, 0.37719, 0.37686, 0.37658, 0.37633, 0.37607, 0.37568, 0.37516, 0.37451, 0.37388, 0.3733, 0.37279, 0.3724, 0.37214, 0.37199, 0.37175, 0.37132, 0.37082, 0.37034, 0.36989, 0.36942, 0.36899, 0.36868, 0.36854, 0.36846, 0.36832, 0.36801, 0.36753, 0.36692, 0.36619, 0.36537, 0.36446, 0.36355, 0.36274, 0.36207, 0.36156, 0.36106, 0.36065, 0.36041, 0.36027, 0.36013, 0.35997, 0.35976, 0.35939, 0.35904, 0.35886, 0.35877, 0.35853, 0.35802, 0.35728, 0.35641, 0.35557, 0.35479, 0.35403, 0.35334, 0.35278, 0.35227, 0.35175, 0.3512, 0.35057, 0.34977, 0.34891, 0.34811, 0.34731, 0.34659, 0.34615, 0.34608, 0.3463, 0.34668, 0.347, 0.34708, 0.34688, 0.34643, 0.34586, 0.34519, 0.34443, 0.34381, 0.34354, 0.34355, 0.34375, 0.34402, 0.34424, 0.34432, 0.34421, 0.34388, 0.34333, 0.34263, 0.34187, 0.34109, 0.3404, 0.33986, 0.33948, 0.33915, 0.33885, 0.33851, 0.33808, 0.33767, 0.33729, 0.33682, 0.33614, 0.3352, 0.33414, 0.33308, 0.33203, 0.33106, 0.33032, 0.32985, 0.32975, 0.32979, 0.32984, 0.32976, 0.32936, 0.32865, 0.32793, 0.32732, 0.32681, 0.32636, 0.32584, 0.32498, 0.32368, 0.32256, 0.32174, 0.321, 0.32026, 0.31953, 0.31886, 0.31822, 0.31751, 0.31666, 0.31568, 0.31466, 0.3137, 0.31282, 0.31205, 0.31126, 0.31033, 0.3091, 0.30766, 0.30628, 0.30505, 0.30382, 0.30266, 0.30152, 0.30045, 0.29932, 0.29783, 0.29616, 0.2945, 0.29274, 0.29096, 0.28934, 0.28807, 0.28685, 0.28551, 0.28418, 0.28301, 0.28172, 0.28023, 0.2788, 0.27757, 0.27651, 0.27563, 0.27487, 0.2741, 0.27342, 0.27286, 0.27227, 0.27155, 0.27057, 0.26939, 0.26826, 0.26716, 0.26603, 0.26502, 0.26413, 0.26313, 0.26182, 0.26044, 0.25926, 0.2582, 0.25716, 0.25633, 0.25573, 0.25523, 0.2547, 0.25409, 0.25335, 0.25255, 0.25188, 0.25131, 0.25086, 0.25041, 0.24984, 0.24923, 0.24871, 0.2483, 0.24796, 0.24767, 0.24727, 0.24658, 0.24582, 0.24523, 0.24472, 0.24438, 0.24429, 0.24433, 0.24432, 0.24419, 0.244, 0.24381, 0.24354, 0.24321, 0.24296, 0.24289, 0.24283, 0.24265, 0.24235, 0.24202, 0.24188, 0.24197, 0.24207, 0.24208, 0.24215, 0.24223, 0.24223, 0.24206, 0.24171, 0.24123, 0.24068, 0.24023, 0.2399, 0.23974, 0.2398, 0.23989, 0.23996, 0.24011, 0.24058, 0.24136, 0.24229, 0.24318, 0.24368, 0.24371, 0.24359, 0.24357, 0.24371, 0.2441, 0.24475, 0.24565, 0.24648, 0.24714, 0.24781, 0.24849, 0.24914, 0.24963, 0.2501, 0.25048, 0.25074, 0.25118, 0.25202, 0.25325, 0.25482, 0.25656, 0.25812, 0.25938, 0.26041, 0.26126, 0.26201, 0.2628, 0.26368, 0.2646, 0.26564, 0.26698, 0.26854, 0.27013, 0.27183, 0.27359, 0.27513, 0.27663, 0.27852, 0.28072, 0.28277, 0.28447, 0.28611, 0.28779, 0.28951, 0.29142, 0.29362, 0.29589, 0.29794, 0.29959, 0.30083, 0.30199, 0.30352, 0.3054, 0.30715, 0.30861, 0.31003, 0.31167, 0.31361, 0.31582, 0.31816, 0.32038, 0.32244, 0.32432, 0.3261, 0.32794, 0.32984, 0.3317, 0.33357, 0.33538, 0.33715, 0.33891, 0.34064, 0.34232, 0.34398, 0.34562, 0.34737, 0.34926, 0.35116, 0.3528, 0.35419, 0.35554, 0.35722, 0.35925, 0.36142, 0.36365, 0.3659, 0.36802, 0.36991, 0.3718, 0.37401, 0.3765, 0.3791, 0.38171, 0.38428, 0.38673, 0.38893, 0.3909, 0.39282, 0.39472, 0.3965, 0.39819, 0.39996, 0.40188, 0.40374, 0.40536, 0.4068, 0.40814, 0.40947, 0.41084, 0.41231, 0.4141, 0.41613, 0.41822, 0.42023, 0.42203, 0.42362, 0.42512, 0.4265, 0.42794, 0.4293, 0.43037, 0.43133, 0.43259, 0.43428, 0.4361, 0.43799, 0.43984, 0.44165, 0.44339, 0.44499, 0.4464, 0.44738, 0.44812, 0.44882, 0.44956, 0.45053, 0.45178, 0.45319, 0.45471, 0.45626, 0.45773, 0.459, 0.45998, 0.46092, 0.46213, 0.46342, 0.46475, 0.46605, 0.46727, 0.46839, 0.46956, 0.47089, 0.47236, 0.47409, 0.47591, 0.47754, 0.47895, 0.48018, 0.48124, 0.48219, 0.48289, 0.48342, 0.48403, 0.48475, 0.4853, 0.48557, 0.48562, 0.48559, 0.48556, 0.4856, 0.48571, 0.48592, 0.48629, 0.48657, 0.48685, 0.48723, 0.4876, 0.48801, 0.48858, 0.48905, 0.48924, 0.48965, 0.49022, 0.49069, 0.49103, 0.49124, 0.49131, 0.49127, 0.49097, 0.49045, 0.48988, 0.48941, 0.48901, 0.4884, 0.48751, 0.48688, 0.48664, 0.48642, 0.48587, 0.48498, 0.48411, 0.48346, 0.48295, 0.48223, 0.48133, 0.48041, 0.47945, 0.47877, 0.47824, 0.47777, 0.47711, 0.47631, 0.47559, 0.47487, 0.47388, 0.47257, 0.47122, 0.46976, 0.46818, 0.46643, 0.46449, 0.46271, 0.46147, 0.46027, 0.4587, 0.45673, 0.45461, 0.45247, 0.45025, 0.44799, 0.4459, 0.44422, 0.44271, 0.44094, 0.43879, 0.43651, 0.43372, 0.43091, 0.42808, 0.42535, 0.42275, 0.42032, 0.41818, 0.4158, 0.41328, 0.41054, 0.40756, 0.40465, 0.40194, 0.39934, 0.39679, 0.39421, 0.39149, 0.38864, 0.3857, 0.38265, 0.38014, 0.37746, 0.37495, 0.37262, 0.3702, 0.36757, 0.36485, 0.36186, 0.35855, 0.35543, 0.35249, 0.34963, 0.34668, 0.34373, 0.34092, 0.33799, 0.33504, 0.33202, 0.32897, 0.32588, 0.32277, 0.31993, 0.3172, 0.31412, 0.3109, 0.30777, 0.30458, 0.30134, 0.29838, 0.29566, 0.29295, 0.29023, 0.28745, 0.28434, 0.28098, 0.27781, 0.27484, 0.27192, 0.26899, 0.26587, 0.26253, 0.25923, 0.25609, 0.25288, 0.24981, 0.24674, 0.24369, 0.24079, 0.23803, 0.23556, 0.23283, 0.23002, 0.22707, 0.22397, 0.22091, 0.21815, 0.21565, 0.21369, 0.21152, 0.20886, 0.20597, 0.20333, 0.20089, 0.19879, 0.19649, 0.19424, 0.19175, 0.189, 0.18635, 0.18384, 0.1814, 0.17917, 0.17702, 0.17479, 0.17253, 0.17042, 0.16836, 0.1661, 0.1641, 0.16224, 0.16032, 0.15828, 0.15619, 0.15408, 0.15259, 0.15117, 0.15017, 0.14927, 0.14795, 0.14642, 0.14484, 0.14297, 0.14096, 0.13929, 0.13795, 0.13687, 0.13579, 0.13473, 0.13338, 0.13234, 0.13118, 0.13011, 0.1292, 0.12835, 0.1275, 0.12675, 0.12613, 0.1256, 0.12505, 0.12436, 0.12337, 0.12224, 0.12113, 0.12017, 0.11926, 0.11869, 0.11829, 0.11797, 0.11783, 0.11759, 0.11749, 0.11757, 0.11779, 0.11792, 0.11793, 0.11791, 0.11776, 0.11747, 0.11743, 0.11768, 0.11795, 0.11842, 0.11909, 0.11956, 0.12011, 0.12061, 0.12119, 0.12198, 0.12291, 0.12388, 0.12484, 0.12591, 0.12706, 0.12825, 0.12932, 0.1304, 0.1316, 0.13269, 0.13388, 0.13496, 0.136, 0.137, 0.13807, 0.13943, 0.14109, 0.14299, 0.14518, 0.14766, 0.15015, 0.15271, 0.15528, 0.15744, 0.15929, 0.16093, 0.16275, 0.16462, 0.16656, 0.16864, 0.17074, 0.17311, 0.17572, 0.17827, 0.18073, 0.18325, 0.18572, 0.18809, 0.19043, 0.19296, 0.19564, 0.19815, 0.20035, 0.20269, 0.2054, 0.20872, 0.21185, 0.21457, 0.21708, 0.21981, 0.22272, 0.22548, 0.22809, 0.23077, 0.23333, 0.236, 0.23875, 0.24173, 0.24499, 0.2486, 0.25201, 0.25553, 0.25909, 0.26271, 0.26659, 0.27069, 0.2748, 0.27875, 0.28254, 0.28657, 0.29046, 0.29411, 0.2978, 0.301, 0.30378, 0.30665, 0.3097, 0.3129, 0.31551, 0.31836, 0.32134, 0.32439, 0.32756, 0.33066, 0.33376, 0.33706, 0.34001, 0.34314, 0.34627, 0.34937, 0.3524, 0.35545, 0.35864, 0.36206, 0.36548, 0.36889, 0.37231, 0.3756, 0.37892, 0.38225, 0.38526, 0.3885, 0.39174, 0.39493, 0.39809, 0.40109, 0.40334, 0.40664, 0.40956, 0.41268, 0.41559, 0.41897, 0.42261, 0.42583, 0.4289, 0.43191, 0.43463, 0.43727, 0.43992, 0.44263, 0.44545, 0.448, 0.45104, 0.4541, 0.45741, 0.46079, 0.46396, 0.46709, 0.47039, 0.47365, 0.47661, 0.47994, 0.4831, 0.48609, 0.48909, 0.49187, 0.49458, 0.49724, 0.4999, 0.50262, 0.50533, 0.50773, 0.51004, 0.51233, 0.51451, 0.51665, 0.51862, 0.5205, 0.52242, 0.52418, 0.52587, 0.52772, 0.52934, 0.53084, 0.53248, 0.53427, 0.53599, 0.53748, 0.53874, 0.53974, 0.54045, 0.54094, 0.54132, 0.54182, 0.54305, 0.54442, 0.54588, 0.54711, 0.54803, 0.54885, 0.54951, 0.54993, 0.55058, 0.55141, 0.55211, 0.55275, 0.55333, 0.55383, 0.55432, 0.55475, 0.55501, 0.55514, 0.55512, 0.55498, 0.55481, 0.55467, 0.55449, 0.5541, 0.55354, 0.55304, 0.55263, 0.55258, 0.55243, 0.55212, 0.55199, 0.55193, 0.55177, 0.55139, 0.55088, 0.55008, 0.54931, 0.54901, 0.54854, 0.54783, 0.54698, 0.54577, 0.54421, 0.54261, 0.54143, 0.54067, 0.54015, 0.53966, 0.53899, 0.53814, 0.53725, 0.53622, 0.53514, 0.53398, 0.53285, 0.53154, 0.53019, 0.52872, 0.52719, 0.52546, 0.52358, 0.52199, 0.52031, 0.51864, 0.51692, 0.51527, 0.51365, 0.51198, 0.51009, 0.508, 0.50589, 0.50419, 0.50238, 0.5003, 0.49796, 0.49554, 0.49302, 0.49076, 0.48898, 0.48691, 0.48457, 0.48205, 0.4793, 0.47647, 0.47343, 0.47037, 0.46744, 0.46469, 0.46177, 0.45861, 0.45585, 0.4529, 0.44982, 0.44653, 0.44306, 0.43976, 0.43649, 0.43332, 0.43046, 0.42759, 0.42462, 0.42156, 0.4185, 0.4157, 0.41298, 0.41054, 0.40835, 0.40581, 0.40292, 0.39994, 0.39705, 0.39429, 0.39138, 0.38807, 0.38454, 0.38079, 0.377, 0.37331, 0.37004, 0.36704, 0.3643, 0.36174, 0.35918, 0.35652, 0.35361, 0.35042, 0.3476, 0.3451, 0.34245, 0.33989, 0.33704, 0.33384, 0.33105, 0.32836, 0.32579, 0.32317, 0.32048, 0.31774, 0.31492, 0.31191, 0.30883, 0.30558, 0.30227, 0.29887, 0.29536, 0.29191, 0.28865, 0.28559, 0.2825, 0.27939, 0.27625, 0.27305, 0.26988, 0.26687, 0.26386, 0.26089, 0.25822, 0.25585, 0.2534, 0.25077, 0.24822, 0.24564, 0.24298, 0.23989, 0.237, 0.23473, 0.2328, 0.23104, 0.22935, 0.22737, 0.22516, 0.2229, 0.22056, 0.21794, 0.21564, 0.2133, 0.21104, 0.20867, 0.20608, 0.20338, 0.20064, 0.1983, 0.19589, 0.19366, 0.19157, 0.1895, 0.18739, 0.18521, 0.18287, 0.18087, 0.17894, 0.17709, 0.17527, 0.17361, 0.17173, 0.17033, 0.16907, 0.16801, 0.16689, 0.1656, 0.16406, 0.16279, 0.1615, 0.16024, 0.15856, 0.15688, 0.15539, 0.15421, 0.15307, 0.15234, 0.15165, 0.15092, 0.15019, 0.14958, 0.14912, 0.14828, 0.14776, 0.14704, 0.14637, 0.1456, 0.14507, 0.14471, 0.14444, 0.14405, 0.1439, 0.14387, 0.14385, 0.1438, 0.14336, 0.1427, 0.14228, 0.14184, 0.14164, 0.1419, 0.14212, 0.14227, 0.14231, 0.14217, 0.14186, 0.1417, 0.14158, 0.14138, 0.14137, 0.14156, 0.14238, 0.14327, 0.1444, 0.14574, 0.14691, 0.14793, 0.14922, 0.15082, 0.15245, 0.15384, 0.1551, 0.1561, 0.15687, 0.15747, 0.15869, 0.16008, 0.16197, 0.16428, 0.16664, 0.16884, 0.17107, 0.17335, 0.17533, 0.17706, 0.17906, 0.18131, 0.18345, 0.18581, 0.18813, 0.19045, 0.19288, 0.19538, 0.1976, 0.19951, 0.20136, 0.20352, 0.20571, 0.20808, 0.21054, 0.21283, 0.21496, 0.21705, 0.21934, 0.22183, 0.22423, 0.22671, 0.22901, 0.23123, 0.23368, 0.23655, 0.23978, 0.24259, 0.245, 0.24724, 0.24958, 0.25231, 0.25529, 0.25842, 0.26149, 0.26426, 0.26699, 0.26985, 0.2726, 0.27552, 0.27814, 0.28059, 0.28339, 0.28614, 0.28881, 0.2915, 0.29429, 0.29705, 0.29967, 0.30233, 0.30478, 0.30726, 0.31027, 0.31369, 0.31778, 0.32156, 0.32467, 0.3276, 0.33064, 0.33369, 0.33659, 0.33951, 0.34234, 0.34485, 0.34744, 0.3504, 0.35328, 0.35604, 0.35851, 0.36099, 0.36368, 0.36654, 0.36954, 0.37257, 0.37567, 0.37891, 0.38153, 0.38421, 0.38707, 0.38996, 0.39282, 0.39587, 0.39976, 0.40372, 0.40686, 0.40979, 0.41269, 0.41564, 0.41851, 0.42141, 0.42423, 0.42708, 0.43008, 0.43303, 0.43577, 0.43879, 0.44194, 0.44488, 0.44774, 0.45096, 0.45426, 0.45719, 0.45987, 0.46254, 0.46503, 0.46771, 0.4705, 0.47308, 0.47545, 0.47762, 0.47944, 0.48141, 0.48361, 0.48588, 0.48791, 0.48972, 0.49183, 0.49388, 0.49605, 0.4982, 0.50038, 0.5026, 0.50454, 0.50637, 0.50822, 0.51005, 0.51177, 0.51363, 0.51565, 0.51768, 0.51988, 0.52191, 0.52341, 0.52521, 0.52683, 0.52814, 0.52946, 0.53078, 0.53209, 0.53342, 0.53455, 0.53567, 0.5367, 0.53772, 0.5388, 0.53989, 0.54077, 0.54117, 0.54141, 0.54173, 0.54218, 0.5428, 0.54379, 0.54471, 0.54575, 0.54664, 0.5473, 0.54785, 0.54805, 0.54808, 0.54802, 0.54802, 0.54805, 0.54812, 0.54823, 0.54826, 0.54795, 0.5474, 0.54689, 0.54637, 0.54579, 0.54528, 0.54506, 0.54495, 0.54473, 0.54458, 0.54428, 0.54382, 0.54319, 0.54269, 0.54227, 0.54188, 0.54126, 0.54065, 0.54008, 0.53951, 0.53878, 0.53776, 0.53612, 0.53436, 0.53282, 0.53139, 0.52992, 0.52841, 0.52689, 0.52541, 0.52412, 0.52282, 0.5214, 0.51993, 0.51841, 0.51682, 0.51491, 0.51288, 0.51084, 0.50873, 0.50641, 0.50407, 0.50182, 0.49962, 0.49742, 0.49502, 0.4923, 0.48934, 0.48661, 0.48409, 0.48174, 0.47971, 0.47752, 0.47506, 0.47257, 0.46981, 0.46681, 0.46391, 0.4613, 0.45907, 0.4569, 0.45451, 0.45229, 0.44998, 0.44752, 0.44495, 0.442, 0.43888, 0.43562, 0.43266, 0.42995, 0.42746, 0.42507, 0.42226, 0.41908, 0.41574, 0.4125, 0.40924, 0.40627, 0.40351, 0.4007, 0.39773, 0.39461, 0.39139, 0.38814, 0.38464, 0.38111, 0.37771, 0.37448, 0.37136, 0.36809, 0.36479, 0.36148, 0.35819, 0.35501, 0.35197, 0.34898, 0.34613, 0.34319, 0.34001, 0.33662, 0.33315, 0.32993, 0.32706, 0.32429, 0.32102, 0.31747, 0.31422, 0.3113, 0.30868, 0.30641, 0.30423, 0.30163, 0.29883, 0.29633, 0.29365, 0.29066, 0.28761, 0.28487, 0.28228, 0.27946, 0.27668, 0.27387, 0.27092, 0.26767, 0.26445, 0.26127, 0.25812, 0.25526, 0.25273, 0.25024, 0.24756, 0.24493, 0.24241, 0.24016, 0.23803, 0.236, 0.23396, 0.23177, 0.22945, 0.22719, 0.22522, 0.22355, 0.22183, 0.21976, 0.21723, 0.21436, 0.21142, 0.20846, 0.20592, 0.20367, 0.20132, 0.19871, 0.19632, 0.19398, 0.19159, 0.18931, 0.18733, 0.18567, 0.18399, 0.18218, 0.18058, 0.17928, 0.17859, 0.17799, 0.17706, 0.17581, 0.17441, 0.17318, 0.17206, 0.1708, 0.16935, 0.16803, 0.16687, 0.16568, 0.16467, 0.16398, 0.16369, 0.1633, 0.16273, 0.16221, 0.16173, 0.16121, 0.16048, 0.15972, 0.15906, 0.15876, 0.15855, 0.15835, 0.15791, 0.15741, 0.15709, 0.15665, 0.15613, 0.1557, 0.15532, 0.15498, 0.15472, 0.15474, 0.15494, 0.15497, 0.15466, 0.15435, 0.15404, 0.15387, 0.15405, 0.1545, 0.15505, 0.15568, 0.15641, 0.15712, 0.15755, 0.15787, 0.15813, 0.15855, 0.15923, 0.16028, 0.16159, 0.16283, 0.16397, 0.16528, 0.16655, 0.16746, 0.16846, 0.17023, 0.17198, 0.1734, 0.17471, 0.17612, 0.17766, 0.17942, 0.18129, 0.18317, 0.18484, 0.18615, 0.18727, 0.18836, 0.18924, 0.19007, 0.19089, 0.19224, 0.19383, 0.19556, 0.19728, 0.19931, 0.20114, 0.20281, 0.20469, 0.20647, 0.20827, 0.21024, 0.21258, 0.21504, 0.21727, 0.21976, 0.22224, 0.2245, 0.2266, 0.22886, 0.23122, 0.23365, 0.23606, 0.23812, 0.24011, 0.24233, 0.24443, 0.24661, 0.24908, 0.25175, 0.25428, 0.25644, 0.2583, 0.26028, 0.26232, 0.26426, 0.26645, 0.26869, 0.27087, 0.27304, 0.27508, 0.27732, 0.27979, 0.28219, 0.28493, 0.28809, 0.29147, 0.29509, 0.29859, 0.30196, 0.30541, 0.30859, 0.31172, 0.31487, 0.31797, 0.32085, 0.32358, 0.32626, 0.32886, 0.33121, 0.33354, 0.3364, 0.33951, 0.34275, 0.34602, 0.34937, 0.35255, 0.35542, 0.35823, 0.361, 0.36391, 0.36727, 0.37065, 0.374, 0.37745, 0.38054, 0.38305, 0.38537, 0.38751, 0.38931, 0.3911, 0.3931, 0.39543, 0.39821, 0.40129, 0.40447, 0.40764, 0.41073, 0.41373, 0.41665, 0.41947, 0.42177, 0.42411, 0.42646, 0.42902, 0.43188, 0.43471, 0.43735, 0.44023, 0.44259, 0.44438, 0.44584, 0.44706, 0.44842, 0.44972, 0.45125, 0.45257, 0.45383, 0.45527, 0.45685, 0.45857, 0.46013, 0.46172, 0.46329, 0.46464, 0.46591, 0.46742, 0.46915, 0.47094, 0.47242, 0.47398, 0.47564, 0.47718, 0.47851, 0.48014, 0.48177, 0.48325, 0.48469, 0.48614, 0.48749, 0.48875, 0.49019, 0.49178, 0.49358, 0.49556, 0.49722, 0.49859, 0.49989, 0.50119, 0.50229, 0.50342, 0.50497, 0.50629, 0.50731, 0.50817, 0.50927, 0.51036, 0.51113, 0.51187, 0.5126, 0.51331, 0.51397, 0.51462, 0.51497, 0.51542, 0.51636, 0.51723, 0.51803, 0.51896, 0.51957, 0.52011, 0.52056, 0.5209, 0.52104, 0.52098, 0.52078, 0.52043, 0.52004, 0.51979, 0.51946, 0.51927, 0.51931, 0.51933, 0.51896, 0.51852, 0.51782, 0.51716, 0.51648, 0.51592, 0.51556, 0.51542, 0.51532, 0.51517, 0.51497, 0.51446, 0.51395, 0.51352, 0.51312, 0.51311, 0.51346, 0.51379, 0.51392, 0.51374, 0.5133, 0.51261, 0.51196, 0.51139, 0.51061, 0.50956, 0.50819, 0.50663, 0.50522, 0.50397, 0.5027, 0.50152, 0.50027, 0.49898, 0.49761, 0.49599, 0.49423, 0.49227, 0.49005, 0.48762, 0.48515, 0.48295, 0.48109, 0.47919, 0.47739, 0.47553, 0.47339, 0.47107, 0.46876, 0.46642, 0.46409, 0.4617, 0.45937, 0.45712, 0.45477, 0.45228, 0.45018, 0.44834, 0.44677, 0.44506, 0.44307, 0.44101, 0.43885, 0.43665, 0.43419, 0.43185, 0.4294, 0.42689, 0.42441, 0.42204, 0.41954, 0.41707, 0.41458, 0.41235, 0.4102, 0.40786, 0.40539, 0.40288, 0.40011, 0.39727, 0.39497, 0.3928, 0.39073, 0.3888, 0.38672, 0.38472, 0.38278, 0.38096, 0.37911, 0.37705, 0.37481, 0.37265, 0.37039, 0.36811, 0.36596, 0.36381, 0.36163, 0.35944, 0.35737, 0.35505, 0.35233, 0.34963, 0.34706, 0.34484, 0.34294, 0.34125, 0.33924, 0.33683, 0.33452, 0.33214, 0.32953, 0.32686, 0.32455, 0.32227, 0.32004, 0.31795, 0.3158, 0.31357, 0.31133, 0.30918, 0.30694, 0.30453, 0.30217, 0.30006, 0.29808, 0.29603, 0.29375, 0.29147, 0.28896, 0.28665, 0.28466, 0.28269, 0.2806, 0.27875, 0.27696, 0.27481, 0.27279, 0.27084, 0.26883, 0.26669, 0.26454, 0.26249, 0.26065, 0.25904, 0.25759, 0.25605, 0.25426, 0.25232, 0.25033, 0.24877, 0.24754, 0.24668, 0.24568, 0.24407, 0.24253, 0.24097, 0.23947, 0.2382, 0.23707, 0.23601, 0.23488, 0.23356, 0.23193, 0.22995, 0.22829, 0.22701, 0.22586, 0.22466, 0.22339, 0.22223, 0.22118, 0.21999, 0.21875, 0.21757, 0.21659, 0.21597, 0.21533, 0.21431, 0.21344, 0.21263, 0.21171, 0.21078, 0.20994, 0.20939, 0.2091, 0.2091, 0.20892, 0.20873, 0.20872, 0.20799, 0.20708, 0.20633, 0.20606, 0.20605, 0.20601, 0.20573, 0.20507, 0.20455, 0.20379, 0.20342, 0.20331, 0.2034, 0.20356, 0.20336, 0.20319, 0.20333, 0.20395, 0.20474, 0.20546, 0.20604, 0.20631, 0.20644, 0.20682, 0.20774, 0.20882, 0.21005, 0.21153, 0.21306, 0.21433, 0.21512, 0.21604, 0.21673, 0.21728, 0.21799, 0.21883, 0.21968, 0.22059, 0.22143, 0.22216, 0.22274, 0.22339, 0.22359, 0.2238, 0.22421, 0.22498, 0.22598, 0.22706, 0.22844, 0.23031, 0.23193, 0.23325, 0.2347, 0.23639, 0.23804, 0.23943, 0.2404, 0.24149, 0.24272, 0.2441, 0.24511, 0.24577, 0.2462, 0.24676, 0.24821, 0.25032, 0.2524, 0.25407, 0.25548, 0.25697, 0.25875, 0.26056, 0.26251, 0.2649, 0.26735, 0.26964, 0.27191, 0.27423, 0.27647, 0.27872, 0.28104, 0.28331, 0.28529, 0.28701, 0.2887, 0.29055, 0.29253, 0.29493, 0.29763, 0.30011, 0.30218, 0.3041, 0.306, 0.30784, 0.30977, 0.31158, 0.31319, 0.31478, 0.31624, 0.31762, 0.31899, 0.32036, 0.32188, 0.32356, 0.32513, 0.3265, 0.32787, 0.3293, 0.33075, 0.33235, 0.33403, 0.33568, 0.33742, 0.33938, 0.34163, 0.34378, 0.3459, 0.34801, 0.34979, 0.35115, 0.35272, 0.35459, 0.35653, 0.35831, 0.35986, 0.36123, 0.36239, 0.36347, 0.36491, 0.36692, 0.36902, 0.37114, 0.37323, 0.37499, 0.37649, 0.378, 0.37955, 0.38117, 0.38282, 0.38443, 0.38604, 0.38733, 0.3884, 0.38964, 0.39081, 0.392, 0.3935, 0.39491, 0.39615, 0.397, 0.39801, 0.39898, 0.40001, 0.40134, 0.4029, 0.40466, 0.40621, 0.40746, 0.40824, 0.40886, 0.4095, 0.41033, 0.41145, 0.41274, 0.41379, 0.41449, 0.41499, 0.41532, 0.41546, 0.41573, 0.41639, 0.4172, 0.41804, 0.41877, 0.41929, 0.41976, 0.42013, 0.42034, 0.42057, 0.42095, 0.42135, 0.42161, 0.42182, 0.42207, 0.42224, 0.42266, 0.42308, 0.42358, 0.42444, 0.42541, 0.42646, 0.42733, 0.42796, 0.42854, 0.42906, 0.42942, 0.42954, 0.42944, 0.42919, 0.42908, 0.42912, 0.42905, 0.42871, 0.42862, 0.4285, 0.42809, 0.42713, 0.42622, 0.42572, 0.42543, 0.42514, 0.42525, 0.42556, 0.42544, 0.4249, 0.42426, 0.42375, 0.42343, 0.42304, 0.42303, 0.42319, 0.42332, 0.42321, 0.42258, 0.42159, 0.42119, 0.42129, 0.42158, 0.42196, 0.42182, 0.42115, 0.42032, 0.4195, 0.41898, 0.41839, 0.41781, 0.41745, 0.41707, 0.4169, 0.41707, 0.41716, 0.41724, 0.41702, 0.41647, 0.41572, 0.41542, 0.41545, 0.4158, 0.41579, 0.41526, 0.41449, 0.41358, 0.41295, 0.41223, 0.41123, 0.40998, 0.40884, 0.40823, 0.40797, 0.40777, 0.40744, 0.40708, 0.40649, 0.40582, 0.4052, 0.40462, 0.40388, 0.40302, 0.40226, 0.40161, 0.40069, 0.39975, 0.39897, 0.39843, 0.39778, 0.39725, 0.39662, 0.39611, 0.39561, 0.3954, 0.39503, 0.3947, 0.39395, 0.3935, 0.39319, 0.39281, 0.39225, 0.39214, 0.39277, 0.3929, 0.39245, 0.39213, 0.39165, 0.39073, 0.38936, 0.38856, 0.38819, 0.38825, 0.38824, 0.38821, 0.38851, 0.3891, 0.38949, 0.38992, 0.39029, 0.39068, 0.39098, 0.3912, 0.39116, 0.39107, 0.39059, 0.39001, 0.38924, 0.38848, 0.38804, 0.38776, 0.38791, 0.38834, 0.38894, 0.38939, 0.38955, 0.38952, 0.38875, 0.38808, 0.38772, 0.38742, 0.38733, 0.38739, 0.38725, 0.38663, 0.38585, 0.3851, 0.38424, 0.3837, 0.38334, 0.38308, 0.38277, 0.38247, 0.38215, 0.38201, 0.38191, 0.38169, 0.38154, 0.38146, 0.38115, 0.38084, 0.38047, 0.3802, 0.38014, 0.38039, 0.38074, 0.38104, 0.38134, 0.38155, 0.38158, 0.38108, 0.38067, 0.38068, 0.3808, 0.38104, 0.38134, 0.38172, 0.38207, 0.38262, 0.38338, 0.38405, 0.38471, 0.38488, 0.3849, 0.3848, 0.38484, 0.38466, 0.38455, 0.3848, 0.38489, 0.38477, 0.38445, 0.38418, 0.38395, 0.38394, 0.3844, 0.3849, 0.38523, 0.38514, 0.38496, 0.38455, 0.38416, 0.38379, 0.38339, 0.38306, 0.38307, 0.38326, 0.38326, 0.38341, 0.38351, 0.38338, 0.38355, 0.38374, 0.38363, 0.38309, 0.3827, 0.38259, 0.38263, 0.38252, 0.38184, 0.38104, 0.38041, 0.3798, 0.3795, 0.3792, 0.37886, 0.37846, 0.37807, 0.37804, 0.37781, 0.37744, 0.37711, 0.37696, 0.37669, 0.3763, 0.3758, 0.37528, 0.37484, 0.37438, 0.37381, 0.3733, 0.37312, 0.37266, 0.37222, 0.37209, 0.37173, 0.37119, 0.37063, 0.36975, 0.3689, 0.36841, 0.36781, 0.36723, 0.36665, 0.3663, 0.3661, 0.36546, 0.36489, 0.36448, 0.36412, 0.36373, 0.36317, 0.36266, 0.3623, 0.362, 0.36188, 0.36155, 0.36107, 0.36048, 0.35993, 0.35931, 0.35833, 0.35725, 0.35594, 0.35471, 0.35383, 0.35311, 0.35251, 0.35214, 0.35177, 0.3511, 0.35023, 0.34951, 0.34897, 0.34826, 0.34743, 0.34651, 0.34583, 0.34538, 0.34497, 0.34447, 0.34363, 0.34256, 0.34151, 0.34042, 0.33931, 0.33826, 0.33734, 0.33657, 0.33573, 0.33505, 0.33403, 0.33278, 0.33147, 0.33013, 0.32883, 0.32737, 0.32622, 0.32487, 0.32335, 0.32163, 0.31986, 0.31838, 0.31735, 0.31651, 0.31567, 0.31461, 0.31342, 0.3123, 0.31126, 0.31041, 0.30957, 0.3085, 0.3073, 0.3061, 0.30492, 0.30384, 0.30284, 0.30121, 0.29998, 0.29884, 0.29773, 0.29653, 0.29541, 0.29449, 0.29371, 0.29245, 0.29111, 0.28975, 0.28825, 0.28698, 0.28576, 0.2848, 0.28415, 0.28324, 0.28214, 0.28111, 0.28027, 0.2794, 0.27861, 0.27782, 0.27692, 0.27591, 0.27468, 0.27361, 0.27289, 0.27241, 0.2725, 0.27243, 0.27185, 0.27116, 0.27062, 0.26994, 0.26893, 0.26785, 0.26654, 0.26524, 0.26415, 0.26349, 0.26277, 0.26176, 0.26086, 0.26008, 0.25944, 0.25898, 0.25865, 0.25806, 0.25734, 0.2566, 0.25591, 0.25549, 0.25526, 0.25494, 0.25444, 0.25397, 0.25402, 0.2542, 0.25425, 0.25413, 0.25415, 0.25416, 0.25426, 0.25431, 0.25437, 0.2544, 0.25441, 0.25455, 0.25482, 0.25501, 0.25491, 0.25456, 0.25419, 0.25381, 0.25334, 0.25266, 0.2522, 0.25214, 0.2522, 0.25234, 0.25271, 0.25301, 0.2532, 0.25325, 0.25312, 0.25291, 0.25268, 0.25235, 0.25213, 0.2522, 0.25229, 0.2524, 0.25263, 0.25286, 0.253, 0.25343, 0.25392, 0.25422, 0.25465, 0.25528, 0.25621, 0.25717, 0.25795, 0.25822, 0.25803, 0.25777, 0.25802, 0.25887, 0.25982, 0.26069, 0.26154, 0.26219, 0.26309, 0.26405, 0.26508, 0.26624, 0.26731, 0.268, 0.2686, 0.26909, 0.26972, 0.27067, 0.27182, 0.27291, 0.27417, 0.27524, 0.2761, 0.27686, 0.27784, 0.2794, 0.28112, 0.28233, 0.28322, 0.28402, 0.28484, 0.28582, 0.2868, 0.28757, 0.28836, 0.28937, 0.29035, 0.29105, 0.29162, 0.29224, 0.29329, 0.29464, 0.29614, 0.29764, 0.29914, 0.30048, 0.30138, 0.30222, 0.3032, 0.30419, 0.30523, 0.30678, 0.30865, 0.31047, 0.31232, 0.31424, 0.31619, 0.31771, 0.31887, 0.31981, 0.32076, 0.3223, 0.32382, 0.32518, 0.32656, 0.328, 0.3295, 0.331, 0.33222, 0.3331, 0.33363, 0.33416, 0.33525, 0.33684, 0.33863, 0.3404, 0.34212, 0.34396, 0.34541, 0.34645, 0.34738, 0.34858, 0.35004, 0.35131, 0.35273, 0.35421, 0.35562, 0.35717, 0.35906, 0.36126, 0.3631, 0.36475, 0.36642, 0.36814, 0.36973, 0.37151, 0.37323, 0.37503, 0.37723, 0.37974, 0.38172, 0.3834, 0.3851, 0.38704, 0.3888, 0.39052, 0.39222, 0.39392, 0.39579, 0.39779, 0.39958, 0.40109, 0.40218, 0.4031, 0.40429, 0.40584, 0.40788, 0.41021, 0.41267, 0.4149, 0.4168, 0.41845, 0.42014, 0.42201, 0.42357, 0.42527, 0.42677, 0.42791, 0.4292, 0.43062, 0.43202, 0.43344, 0.4346, 0.43606, 0.43713, 0.43814, 0.43928, 0.44039, 0.44206, 0.44376, 0.44564, 0.44745, 0.44886, 0.45013, 0.45131, 0.45237, 0.45382, 0.45505, 0.456, 0.45688, 0.45772, 0.45883, 0.45989, 0.46099, 0.46216, 0.46343, 0.46476, 0.46662, 0.46895, 0.47071, 0.47171, 0.47227, 0.47297, 0.47351, 0.47409, 0.4748, 0.47556, 0.47627, 0.4772, 0.47803, 0.47881, 0.47967, 0.48076, 0.48206, 0.48309, 0.4842, 0.48518, 0.486, 0.48675, 0.48737, 0.48773, 0.48839, 0.48892, 0.48926, 0.48966, 0.49008, 0.49041, 0.49046, 0.49042, 0.49033, 0.49042, 0.49039, 0.49042, 0.49044, 0.49041, 0.49058, 0.49101, 0.49121, 0.49121, 0.49116, 0.49111, 0.49097, 0.49056, 0.48987, 0.48922, 0.4883, 0.48733, 0.48656, 0.48584, 0.48503, 0.48446, 0.4839, 0.48321, 0.48247, 0.48169, 0.4809, 0.48001, 0.47898, 0.47805, 0.47688, 0.47548, 0.47407, 0.47317, 0.47266, 0.47198, 0.47109, 0.47018, 0.46893, 0.46742, 0.46569, 0.46388, 0.4621, 0.46048, 0.45892, 0.45735, 0.45599, 0.45471, 0.4532, 0.45135, 0.45004, 0.44866, 0.44721, 0.44544, 0.44331, 0.44119, 0.43921, 0.43715, 0.43533, 0.4336, 0.43201, 0.43065, 0.42926, 0.42708, 0.42496, 0.42283, 0.42083, 0.41915, 0.41771, 0.41638, 0.41491, 0.4133, 0.41162, 0.40954, 0.40724, 0.40511, 0.40305, 0.40086, 0.39864, 0.39627, 0.39374, 0.391, 0.38825, 0.38572, 0.38313, 0.38046, 0.37786, 0.37536, 0.373, 0.37046, 0.36799, 0.36545, 0.3626, 0.35969, 0.35707, 0.35504, 0.3529, 0.35066, 0.34838, 0.3458, 0.34291, 0.34002, 0.33707, 0.33418, 0.3315, 0.32921, 0.32648, 0.32365, 0.32096, 0.31853, 0.31602, 0.31338, 0.31096, 0.30823, 0.30569, 0.3033, 0.3011, 0.29911, 0.2974, 0.29541, 0.29284, 0.28992, 0.28695, 0.2842, 0.28201, 0.27969, 0.27733, 0.27496, 0.27254, 0.27036, 0.26854, 0.26701, 0.26547, 0.26373, 0.26187, 0.25982, 0.25781, 0.25584, 0.25386, 0.25179, 0.24976, 0.24769, 0.246, 0.24438, 0.24258, 0.24054, 0.23839, 0.23628, 0.23422, 0.2322, 0.2303, 0.22847, 0.22665, 0.22477, 0.22299, 0.22109, 0.21956, 0.21797, 0.21635, 0.2148, 0.21303, 0.21107, 0.20948, 0.20779, 0.20642, 0.20529, 0.20398, 0.20284, 0.20166, 0.2005, 0.19932, 0.19825, 0.1975, 0.19681, 0.19593, 0.19502, 0.19425, 0.19356, 0.19296, 0.19254, 0.19207, 0.19184, 0.19137, 0.19101, 0.1905, 0.19013, 0.19013, 0.19037, 0.19038, 0.19004, 0.19014, 0.19024, 0.1904, 0.19064, 0.19088, 0.19103, 0.19108, 0.19146, 0.1921, 0.19253, 0.19279, 0.19306, 0.19323, 0.19335, 0.19342, 0.19354, 0.19413, 0.19469, 0.19489, 0.19544, 0.19604, 0.1964, 0.197, 0.1981, 0.19937, 0.20078, 0.20228, 0.2037, 0.20449, 0.20483, 0.20514, 0.20587, 0.20691, 0.20816, 0.20941, 0.21106, 0.21261, 0.21417, 0.21586, 0.21716, 0.21857, 0.2198, 0.2211, 0.22241, 0.22396, 0.2255, 0.22665, 0.22774, 0.22878, 0.23026, 0.2318, 0.23338, 0.23505, 0.23631, 0.23768, 0.23933, 0.24099, 0.24269, 0.24446, 0.24612, 0.24764, 0.24903, 0.25107, 0.25273, 0.25479, 0.25685, 0.25842, 0.26006, 0.26192, 0.26394, 0.26553, 0.26714, 0.26881, 0.27065, 0.27263, 0.27492, 0.27758, 0.28011, 0.28282, 0.28574, 0.28877, 0.29102, 0.29297, 0.29506, 0.2971, 0.29918, 0.30165, 0.3044, 0.3068, 0.30902, 0.31161, 0.31391, 0.3165, 0.31931, 0.32179, 0.32408, 0.32645, 0.32913, 0.33235, 0.33556, 0.33837, 0.34118, 0.34403, 0.34686, 0.34941, 0.352, 0.35485, 0.35765, 0.35992, 0.36194, 0.36441, 0.36723, 0.36942, 0.37146, 0.37393, 0.37676, 0.37951, 0.38214, 0.38492, 0.38784, 0.39089, 0.3938, 0.39648, 0.39897, 0.40157, 0.40409, 0.40675, 0.40974, 0.41271, 0.41598, 0.41893, 0.42174, 0.42444, 0.42671, 0.42931, 0.43177, 0.43446, 0.43758, 0.44039, 0.44327, 0.446, 0.44892, 0.45203, 0.45514, 0.45792, 0.46085, 0.46386, 0.46699, 0.47017, 0.4731, 0.47581, 0.47845, 0.48064, 0.48291, 0.48493, 0.48666, 0.48818, 0.48984, 0.49165, 0.49354, 0.4954, 0.49704, 0.49873, 0.50046, 0.50243, 0.50471, 0.50686, 0.50874, 0.51036, 0.51184, 0.51295, 0.51387, 0.51458, 0.51567, 0.51741, 0.51938, 0.52161, 0.52381, 0.52581, 0.52746, 0.52842, 0.52916, 0.5299, 0.53073, 0.53177, 0.53327, 0.53463, 0.53602, 0.537, 0.53773, 0.53829, 0.53856, 0.53881, 0.53926, 0.54001, 0.54067, 0.54144, 0.54186, 0.54226, 0.54261, 0.54263, 0.54266, 0.54273, 0.54266, 0.5427, 0.54273, 0.54269, 0.54237, 0.54192, 0.54166, 0.54146, 0.54134, 0.54132, 0.5415, 0.54148, 0.54119, 0.54065, 0.54013, 0.53977, 0.53926, 0.53852, 0.53741, 0.53613, 0.53499, 0.5338, 0.53278, 0.53169, 0.53072, 0.52921, 0.5277, 0.52611, 0.52472, 0.52335, 0.52194, 0.52072, 0.51907, 0.51745, 0.51592, 0.51438, 0.51291, 0.51136, 0.50999, 0.50842, 0.50711, 0.50588, 0.50404, 0.5021, 0.49986, 0.49761, 0.49534, 0.49326, 0.4912, 0.48911, 0.48727, 0.48542, 0.48336, 0.48114, 0.47923, 0.47725, 0.47498, 0.4725, 0.46988, 0.46708, 0.46409, 0.46158, 0.45909, 0.45659, 0.45381, 0.45088, 0.44771, 0.44415, 0.44071, 0.43741, 0.4348, 0.43238, 0.42966, 0.42695, 0.42406, 0.42134, 0.41825, 0.41507, 0.41161, 0.40808, 0.40466, 0.40134, 0.39841, 0.39556, 0.39266, 0.38949, 0.38603, 0.3827, 0.3794, 0.37637, 0.37342, 0.37066, 0.36812, 0.36518, 0.36196, 0.35875, 0.35565, 0.35236, 0.34909, 0.34615, 0.34308, 0.33953, 0.33593, 0.33259, 0.32964, 0.32614, 0.3224, 0.31855, 0.31466, 0.31096, 0.30726, 0.3037, 0.29989, 0.29644, 0.29304, 0.28986, 0.28669, 0.28374, 0.28073, 0.27775, 0.27457, 0.27131, 0.26829, 0.26503, 0.26172, 0.25812, 0.25467, 0.25124, 0.24782, 0.24438, 0.24091, 0.23767, 0.23433, 0.23107, 0.22796, 0.22537, 0.22281, 0.22031, 0.21769, 0.21502, 0.21231, 0.20977, 0.20758, 0.20563, 0.20345, 0.2008, 0.19795, 0.19468, 0.19174, 0.18914, 0.1868, 0.18481, 0.18247, 0.18037, 0.17781, 0.17521, 0.17277, 0.17066, 0.16868, 0.16687, 0.16492, 0.16249, 0.15994, 0.15791, 0.15679, 0.15576, 0.15441, 0.15298, 0.15144, 0.14971, 0.1485, 0.14772, 0.14672, 0.14565, 0.14471, 0.14388, 0.14302, 0.14222, 0.14113, 0.1403, 0.13928, 0.138, 0.13686, 0.13616, 0.13575, 0.13549, 0.1351, 0.13518, 0.13552, 0.13598, 0.13629, 0.13668, 0.13735, 0.13717, 0.1366, 0.13623, 0.13592, 0.13562, 0.13536, 0.13525, 0.13514, 0.13511, 0.13519, 0.13536, 0.13515, 0.13462, 0.13438, 0.13484, 0.135, 0.13451, 0.13446, 0.13435, 0.13453, 0.13489, 0.13509, 0.13558, 0.13601, 0.13661, 0.13738, 0.13817, 0.13862, 0.13906, 0.13947, 0.13991, 0.14053, 0.14173, 0.14307, 0.1442, 0.14505, 0.1462, 0.14752, 0.14902, 0.15073, 0.15268, 0.1546, 0.15622, 0.15802, 0.15966, 0.16118, 0.16273, 0.16437, 0.16622, 0.16769, 0.16923, 0.17041, 0.17143, 0.17306, 0.17491, 0.17706, 0.17955, 0.18188, 0.18427, 0.18669, 0.18937, 0.19215, 0.19493, 0.19742, 0.20001, 0.20263, 0.2053, 0.20798, 0.21061, 0.21359, 0.21696, 0.22069, 0.22438, 0.22795, 0.23137, 0.23441, 0.23716, 0.24042, 0.24408, 0.24772, 0.25123, 0.25494, 0.25872, 0.26209, 0.26511, 0.26785, 0.27048, 0.27305, 0.27579, 0.27872, 0.2821, 0.28571, 0.28896, 0.29259, 0.29618, 0.29983, 0.30324, 0.30639, 0.30969, 0.3132, 0.31683, 0.32071, 0.32464, 0.32881, 0.33291, 0.33687, 0.34058, 0.34387, 0.34679, 0.3501, 0.35329, 0.35672, 0.35986, 0.36332, 0.3668, 0.37014, 0.37359, 0.37687, 0.38052, 0.38431, 0.38794, 0.39163, 0.39495, 0.39812, 0.40087, 0.40365, 0.40596, 0.40837, 0.41097, 0.41369, 0.41645, 0.41955, 0.42311, 0.42611, 0.42895, 0.43169, 0.43458, 0.4371, 0.43956, 0.44242, 0.44573, 0.44919, 0.45249, 0.45537, 0.4582, 0.46085, 0.46355, 0.46646, 0.4692, 0.47164, 0.47385, 0.47612, 0.47809, 0.48021, 0.48227, 0.48444, 0.48649, 0.48864, 0.4905, 0.49243, 0.49425, 0.49592, 0.49769, 0.49982, 0.50214, 0.50436, 0.50613, 0.50793, 0.50985, 0.51195, 0.51372, 0.51546, 0.51692, 0.51854, 0.52023, 0.52163, 0.52274, 0.52407, 0.52527, 0.52629, 0.52749, 0.52878, 0.53023, 0.53154, 0.53263, 0.53339, 0.53368, 0.53359, 0.53376, 0.53439, 0.53525, 0.53658, 0.53782, 0.53881, 0.53951, 0.54009, 0.54047, 0.54045, 0.54058, 0.54109, 0.54156, 0.54184, 0.54192, 0.54171, 0.54121, 0.54073, 0.54051, 0.54034, 0.53983, 0.53915, 0.53846, 0.53796, 0.53765, 0.53724, 0.53672, 0.53587, 0.53494, 0.53364, 0.53258, 0.53167, 0.53106, 0.53039, 0.5296, 0.52873, 0.52767, 0.52678, 0.52584, 0.52493, 0.5242, 0.52341, 0.52231, 0.52125, 0.52008, 0.51904, 0.51828, 0.51733, 0.51601, 0.51483, 0.51368, 0.51221, 0.51064, 0.50882, 0.50688, 0.50483, 0.5028, 0.50027, 0.49798, 0.49564, 0.49298, 0.49035, 0.48765, 0.48513, 0.4824, 0.47998, 0.47754, 0.47536, 0.47317, 0.47076, 0.46836, 0.46571, 0.46338, 0.46125, 0.45919, 0.45686, 0.45443, 0.45206, 0.44962, 0.44716, 0.44472, 0.44255, 0.44035, 0.43808, 0.43581, 0.43357, 0.43119, 0.42876, 0.42621, 0.42357, 0.42082, 0.41812, 0.41487, 0.41177, 0.40887, 0.40627, 0.40359, 0.40062, 0.39751, 0.39453, 0.39179, 0.38897, 0.38592, 0.38281, 0.37973, 0.3766, 0.37368, 0.37104, 0.36839, 0.36582, 0.36328, 0.36055, 0.3576, 0.35455, 0.35132, 0.34808, 0.34503, 0.34198, 0.33903, 0.3367, 0.33412, 0.33136, 0.32836, 0.32567, 0.323, 0.32038, 0.31793, 0.31558, 0.31336, 0.31098, 0.30852, 0.30601, 0.30365, 0.30141, 0.29913, 0.29619, 0.29307, 0.29051, 0.28798, 0.28558, 0.28342, 0.28151, 0.27926, 0.27665, 0.27391, 0.2711, 0.2688, 0.26654, 0.26433, 0.26215, 0.25986, 0.25766, 0.25563, 0.25344, 0.25168, 0.25009, 0.2483, 0.2463, 0.24374, 0.24111, 0.23866, 0.23651, 0.23437, 0.23229, 0.23021, 0.22837, 0.22668, 0.22516, 0.2238, 0.22236, 0.22092, 0.2195, 0.21808, 0.21675, 0.21536, 0.2139, 0.21294, 0.21241, 0.21195, 0.21107, 0.21016, 0.20947, 0.20888, 0.20764, 0.20624, 0.20478, 0.20334, 0.20216, 0.20126, 0.20067, 0.19962, 0.19864, 0.19762, 0.19681, 0.1962, 0.19595, 0.19565, 0.19517, 0.19464, 0.19395, 0.1937, 0.19365, 0.19356, 0.19323, 0.19292, 0.1925, 0.19209, 0.19186, 0.19179, 0.19184, 0.19186, 0.19205, 0.1923, 0.19287, 0.19319, 0.19319, 0.19341, 0.19391, 0.1941, 0.19431, 0.19443, 0.19452, 0.19441, 0.1943, 0.19449, 0.19456, 0.19491, 0.19529, 0.1956, 0.19581, 0.19598, 0.19617, 0.19654, 0.19685, 0.19712, 0.19719, 0.19742, 0.19798, 0.19868, 0.19928, 0.2004, 0.20193, 0.20408, 0.20626, 0.20798, 0.20925, 0.21047, 0.2118, 0.2128, 0.21341, 0.21412, 0.21506, 0.21632, 0.21785, 0.21947, 0.22103, 0.22263, 0.2244, 0.22635, 0.22858, 0.23087, 0.23301, 0.23519, 0.23729, 0.23917, 0.24088, 0.24259, 0.24452, 0.24661, 0.24873, 0.25103, 0.2534, 0.2556, 0.25775, 0.25985, 0.26189, 0.2639, 0.26594, 0.26776, 0.26945, 0.27102, 0.27246, 0.27399, 0.27573, 0.27772, 0.28012, 0.28278, 0.28539, 0.28772, 0.28965, 0.29113, 0.2925, 0.29413, 0.29608, 0.2983, 0.30084, 0.30361, 0.30615, 0.30829, 0.31047, 0.31271, 0.31488, 0.31689, 0.3193, 0.32199, 0.32466, 0.32725, 0.32949, 0.3313, 0.33297, 0.33488, 0.33723, 0.33967, 0.34227, 0.34509, 0.34802, 0.35072, 0.35311, 0.35531, 0.35748, 0.35972, 0.36209, 0.36464, 0.36702, 0.36941, 0.37185, 0.37411, 0.37636, 0.37859, 0.381, 0.38345, 0.38555, 0.38756, 0.38954, 0.39144, 0.39342, 0.39543, 0.39746, 0.39983, 0.40242, 0.40523, 0.40807, 0.41068, 0.41312, 0.41538, 0.41752, 0.41952, 0.42152, 0.42343, 0.42501, 0.42634, 0.42781, 0.42964, 0.43147, 0.43341, 0.4355, 0.43757, 0.43963, 0.44179, 0.44375, 0.4454, 0.4467, 0.44819, 0.45005, 0.45194, 0.4536, 0.45506, 0.45646, 0.45783, 0.45935, 0.46111, 0.46269, 0.46431, 0.46607, 0.46773, 0.46931, 0.47088, 0.4723, 0.47345, 0.47442, 0.47542, 0.47646, 0.4776, 0.47847, 0.47882, 0.47892, 0.47889, 0.47914, 0.47969, 0.48044, 0.48122, 0.48192, 0.48248, 0.4829, 0.48319, 0.48357, 0.4839, 0.48404, 0.48407, 0.48412, 0.48433, 0.48428, 0.48404, 0.48392, 0.48382, 0.48376, 0.48373, 0.48379, 0.48378, 0.48346, 0.48282, 0.48177, 0.48057, 0.47953, 0.47863, 0.47789, 0.47719, 0.47633, 0.47502, 0.47359, 0.47233, 0.4713, 0.47048, 0.46945, 0.46806, 0.46672, 0.46557, 0.46459, 0.46366, 0.46258, 0.46136, 0.46008, 0.45893, 0.45786, 0.45669, 0.45544, 0.45428, 0.453, 0.45145, 0.44966, 0.44808, 0.44703, 0.44604, 0.4448, 0.44312, 0.44123, 0.43922, 0.43729, 0.43578, 0.43454, 0.43327, 0.43173, 0.43, 0.42847, 0.42712, 0.42577, 0.42457, 0.42309, 0.42128, 0.41943, 0.4178, 0.41624, 0.41446, 0.41264, 0.41083, 0.40877, 0.4066, 0.40442, 0.40226, 0.39979, 0.39709, 0.39476, 0.39287, 0.39112, 0.38951, 0.38793, 0.3861, 0.38408, 0.38195, 0.38016, 0.37854, 0.37677, 0.37489, 0.37273, 0.37042, 0.3681, 0.36579, 0.36347, 0.36099, 0.35855, 0.35618, 0.35385, 0.35157, 0.34914, 0.34661, 0.34422, 0.34191, 0.33949, 0.3373, 0.33554, 0.33396, 0.33247, 0.33081, 0.32895, 0.32698, 0.32504, 0.32299, 0.32067, 0.3184, 0.31654, 0.31491, 0.31298, 0.31073, 0.30839, 0.30601, 0.30369, 0.30162, 0.29956, 0.29714, 0.29438, 0.29186, 0.28953, 0.28737, 0.28536, 0.28308, 0.28074, 0.27874, 0.27689, 0.2751, 0.27359, 0.27227, 0.27067, 0.26858, 0.26611, 0.26352, 0.26093, 0.2584, 0.25616, 0.25419, 0.25235, 0.25066, 0.2488, 0.24702, 0.24562, 0.24435, 0.2428, 0.24113, 0.23973, 0.23841, 0.23693, 0.23547, 0.23402, 0.23244, 0.23088, 0.22952, 0.22849, 0.22769, 0.22678, 0.22588, 0.2251, 0.224, 0.22245, 0.2209, 0.21976, 0.21882, 0.21781, 0.21671, 0.21553, 0.2144, 0.2133, 0.21236, 0.21157, 0.21062, 0.20934, 0.20786, 0.20654, 0.20532, 0.20419, 0.20322, 0.20234, 0.20148, 0.20078, 0.20036, 0.19991, 0.19936, 0.19867, 0.19771, 0.19675, 0.19613, 0.19599, 0.19607, 0.19604, 0.1959, 0.19578, 0.1955, 0.19509, 0.19487, 0.19482, 0.19468, 0.19455, 0.19466, 0.19502, 0.19561, 0.1964, 0.19731, 0.19808, 0.19869, 0.1993, 0.1999, 0.20066, 0.20153, 0.20225, 0.20265, 0.20293, 0.20343, 0.20438, 0.20578, 0.20731, 0.20862, 0.20962, 0.21056, 0.21156, 0.21238, 0.21318, 0.21452, 0.21628, 0.21784, 0.219, 0.22, 0.22075, 0.22133, 0.22204, 0.22297, 0.22392, 0.22478, 0.22574, 0.22696, 0.22826, 0.2294, 0.23058, 0.23197, 0.2336, 0.23556, 0.23747, 0.23901, 0.24056, 0.24236, 0.24434, 0.24626, 0.24809, 0.24964, 0.25069, 0.25174, 0.25308, 0.25449, 0.25603, 0.25778, 0.25981, 0.26182, 0.26356, 0.26531, 0.26711, 0.26898, 0.27084, 0.27267, 0.27431, 0.27585, 0.27749, 0.27915, 0.28063, 0.28202, 0.28366, 0.28545, 0.28702, 0.28876, 0.29097, 0.29342, 0.29571, 0.29769, 0.29966, 0.30186, 0.30422, 0.30674, 0.3094, 0.31199, 0.31434, 0.3164, 0.31844, 0.32045, 0.32224, 0.32398, 0.32582, 0.32752, 0.32925, 0.33131, 0.33365, 0.33614, 0.33857, 0.34118, 0.34405, 0.34677, 0.34911, 0.35131, 0.35345, 0.35541, 0.3573, 0.35901, 0.36077, 0.36293, 0.36545, 0.36824, 0.37119, 0.37409, 0.37637, 0.37808, 0.37995, 0.38168, 0.38327, 0.38479, 0.38623, 0.38772, 0.38923, 0.39091, 0.39313, 0.39554, 0.39737, 0.39897, 0.40065, 0.40203, 0.40324, 0.40446, 0.40574, 0.40747, 0.40928, 0.4108, 0.41228, 0.41401, 0.41563, 0.41688, 0.41822, 0.41979, 0.42112, 0.42218, 0.42294, 0.42358, 0.42442, 0.42544, 0.42639, 0.42708, 0.42775, 0.42846, 0.42928, 0.43014, 0.43082, 0.43149, 0.43223, 0.43306, 0.43382, 0.43466, 0.43557, 0.43638, 0.43712, 0.43789, 0.43898, 0.44008, 0.44079, 0.44131, 0.44172, 0.44217, 0.44297, 0.44382, 0.44438, 0.44479, 0.44515, 0.44561, 0.44636, 0.44717, 0.44763, 0.44789, 0.44821, 0.44871, 0.44939, 0.44974, 0.44973, 0.44954, 0.44869, 0.44736, 0.44635, 0.44589, 0.44578, 0.4456, 0.44505, 0.44444, 0.44385, 0.44327, 0.44283, 0.44241, 0.44186, 0.44117, 0.44057, 0.44009, 0.43956, 0.43907, 0.43847, 0.43752, 0.43668, 0.43603, 0.43541, 0.43466, 0.43381, 0.43278, 0.43157, 0.43046, 0.42925, 0.42812, 0.42709, 0.42605, 0.42484, 0.42362, 0.42263, 0.4217, 0.42081, 0.41984, 0.41863, 0.41716, 0.41568, 0.41442, 0.41322, 0.41195, 0.41068, 0.40941, 0.40812, 0.40688, 0.40569, 0.40464, 0.40367, 0.40261, 0.40144, 0.4003, 0.39904, 0.39718, 0.395, 0.39303, 0.39125, 0.38963, 0.38805, 0.38632, 0.38447, 0.38253, 0.38056, 0.37871, 0.37685, 0.375, 0.37319, 0.37129, 0.36945, 0.36795, 0.36666, 0.3654, 0.36417, 0.36277, 0.3613, 0.35989, 0.35847, 0.35686, 0.35502, 0.35305, 0.35122, 0.34963, 0.34824, 0.34687, 0.34532, 0.34388, 0.3427, 0.34165, 0.34043, 0.33886, 0.33698, 0.33494, 0.33271, 0.33036, 0.32822, 0.32639, 0.3249, 0.32387, 0.32302, 0.32189, 0.32031, 0.31833, 0.31617, 0.31426, 0.31269, 0.31103, 0.3093, 0.3075, 0.30583, 0.3045, 0.30329, 0.30233, 0.30162, 0.30069, 0.29965, 0.29869, 0.29756, 0.29612, 0.29446, 0.29263, 0.29085, 0.28954, 0.28874, 0.28785, 0.2866, 0.28523, 0.28411, 0.28321, 0.28229, 0.28159, 0.28114, 0.28059, 0.27988, 0.27905, 0.27833, 0.27779, 0.27717, 0.27656, 0.27605, 0.27545, 0.27494, 0.27473, 0.27466, 0.27435, 0.27333, 0.27201, 0.2708, 0.26968, 0.2687, 0.26802, 0.26743, 0.26684, 0.26635, 0.26571, 0.26494, 0.26417, 0.26326, 0.26245, 0.26163, 0.26071, 0.26021, 0.25999, 0.25965, 0.25893, 0.2581, 0.25722, 0.25606, 0.25508, 0.25453, 0.25435, 0.2544, 0.2546, 0.2549, 0.25485, 0.25446, 0.25428, 0.25464, 0.25494, 0.25516, 0.25561, 0.25588, 0.25609, 0.2562, 0.25626, 0.25622, 0.25603, 0.25584, 0.25557, 0.25527, 0.25485, 0.25441, 0.25411, 0.25404, 0.25424, 0.25458, 0.25509, 0.25584, 0.25671, 0.25748, 0.25811, 0.25867, 0.25963, 0.26091, 0.26203, 0.26307, 0.26407, 0.26504, 0.26573, 0.26635, 0.26708, 0.26787, 0.26898, 0.27027, 0.27123, 0.27201, 0.27305, 0.27427, 0.27571, 0.27717, 0.27822, 0.2791, 0.28002, 0.2808, 0.28152, 0.28256, 0.28379, 0.28506, 0.28631, 0.2875, 0.28883, 0.29014, 0.29132, 0.29251, 0.29384, 0.29507, 0.29602, 0.297, 0.29825, 0.29959, 0.30101, 0.30262, 0.30404, 0.30507, 0.30589, 0.3071, 0.30881, 0.31071, 0.31278, 0.31489, 0.31688, 0.31868, 0.32037, 0.32221, 0.32417, 0.32602, 0.32793, 0.33015, 0.33254, 0.33487, 0.33712, 0.3392, 0.34114, 0.343, 0.34497, 0.34718, 0.34954, 0.35196, 0.35416, 0.35607, 0.35799, 0.35995, 0.36179, 0.36341, 0.36486, 0.36623, 0.36748, 0.36875, 0.36992, 0.3709, 0.37194, 0.37327, 0.37474, 0.37635, 0.37801, 0.37944, 0.38078, 0.38194, 0.38274, 0.3834, 0.38407, 0.38478, 0.38567, 0.38669, 0.38756, 0.38836, 0.3889, 0.3891, 0.38932, 0.38981, 0.39054, 0.39126, 0.39191, 0.39254, 0.39319, 0.39389, 0.3947, 0.39547, 0.396, 0.39657, 0.39719, 0.39764, 0.39789, 0.39818, 0.39865, 0.39902, 0.39953, 0.40003, 0.40052, 0.4014, 0.40258, 0.40388, 0.40476, 0.4052, 0.40546, 0.40565, 0.40589, 0.40626, 0.40682, 0.40738, 0.40798, 0.40847, 0.40855, 0.40855, 0.40859, 0.40871, 0.40901, 0.40929, 0.40939, 0.40921, 0.40897, 0.40867, 0.40833, 0.40798, 0.4076, 0.40753, 0.40763, 0.40777, 0.40781, 0.40759, 0.4073, 0.40707, 0.40715, 0.40735, 0.4073, 0.40708, 0.40688, 0.40666, 0.40631, 0.40581, 0.40516, 0.40457, 0.40404, 0.40331, 0.40256, 0.40184, 0.40126, 0.40105, 0.40073, 0.40025, 0.39985, 0.39938, 0.39884, 0.39819, 0.39763, 0.39704, 0.39639, 0.3959, 0.39524, 0.39427, 0.39347, 0.39293, 0.39238, 0.39191, 0.39144, 0.39076, 0.39, 0.38906, 0.38798, 0.38677, 0.38547, 0.38429, 0.38312, 0.38204, 0.38097, 0.37996, 0.37879, 0.37733, 0.37577, 0.37432, 0.37311, 0.37201, 0.37087, 0.36964, 0.36834, 0.3669, 0.36532, 0.36367, 0.36225, 0.36097, 0.35965, 0.35835, 0.35724, 0.35617, 0.35503, 0.35393, 0.35289, 0.35195, 0.35089, 0.34973, 0.34824, 0.34639, 0.34466, 0.34327, 0.34219, 0.34158, 0.34115, 0.3406, 0.33988, 0.33865, 0.3367, 0.33458, 0.33289, 0.33161, 0.33069, 0.32973, 0.32851, 0.3273, 0.32626, 0.32529, 0.32409, 0.32293, 0.32218, 0.32146, 0.32062, 0.32001, 0.31938, 0.31833, 0.3173, 0.3167, 0.31615, 0.31537, 0.31439, 0.31331, 0.31246, 0.31189, 0.31154, 0.31139, 0.31151, 0.31161, 0.3114, 0.31136, 0.31135, 0.31126, 0.31108, 0.31041, 0.3095, 0.30846, 0.30765, 0.307, 0.30676, 0.30686, 0.30667, 0.30627, 0.30584, 0.30562, 0.30544, 0.30501, 0.30461, 0.30462, 0.30453, 0.30416, 0.30375, 0.30307, 0.30232, 0.30179, 0.30133, 0.30073, 0.30044, 0.30063, 0.30065, 0.30055, 0.30025, 0.29983, 0.29948, 0.29929, 0.29951, 0.29948, 0.29932, 0.29908, 0.2984, 0.29775, 0.29714, 0.29674, 0.29636, 0.29564, 0.29485, 0.29399, 0.2934, 0.29268, 0.29183, 0.29135, 0.29119, 0.29115, 0.29078, 0.29037, 0.29029, 0.29043, 0.29056, 0.29049, 0.29024, 0.29001, 0.28995, 0.28991, 0.28991, 0.28975, 0.28961, 0.28959, 0.28972, 0.29008, 0.29057, 0.29135, 0.29222, 0.29307, 0.29366, 0.29433, 0.29515, 0.29593, 0.29657, 0.29746, 0.29844, 0.2994, 0.30073, 0.30187, 0.30285, 0.30407, 0.30516, 0.30596, 0.3065, 0.3069, 0.30721, 0.30763, 0.30823, 0.30926, 0.31056, 0.31196, 0.31353, 0.31473, 0.31567, 0.31692, 0.31849, 0.31977, 0.32054, 0.32125, 0.32215, 0.32319, 0.32405, 0.3246, 0.32513, 0.32598, 0.32692, 0.32791, 0.32916, 0.33034, 0.33142, 0.33244, 0.33344, 0.33437, 0.33492, 0.33515, 0.33582, 0.33683, 0.33819, 0.33975, 0.34129, 0.3428, 0.34402, 0.345, 0.34572, 0.34645, 0.34739, 0.34855, 0.35, 0.35191, 0.3541, 0.35599, 0.35742, 0.35864, 0.35959, 0.36027, 0.36074, 0.36131, 0.36219, 0.36326, 0.36444, 0.3656, 0.36692, 0.3682, 0.36951, 0.37089, 0.37212, 0.37332, 0.37443, 0.37533, 0.37608, 0.37676, 0.37743, 0.37813, 0.37879, 0.37937, 0.38011, 0.3812, 0.38243, 0.38348, 0.38431, 0.38509, 0.38569, 0.38605, 0.38646, 0.38696, 0.38762, 0.38872, 0.38995, 0.39098, 0.39197, 0.39281, 0.3934, 0.3939, 0.39427, 0.39479, 0.39525, 0.39557, 0.39596, 0.39626, 0.39688, 0.39765, 0.39818, 0.39872, 0.39921, 0.39953, 0.39975, 0.40017, 0.40052, 0.4009, 0.40146, 0.40223, 0.40323, 0.40403, 0.40457, 0.40478, 0.40489, 0.40487, 0.40487, 0.40516, 0.40579, 0.40662, 0.40712, 0.40722, 0.40724, 0.40726, 0.40721, 0.40718, 0.40711, 0.4069, 0.40668, 0.40652, 0.40637, 0.40598, 0.40541, 0.40464, 0.4038, 0.40294, 0.4021, 0.40142, 0.40105, 0.40063, 0.40005, 0.39951, 0.39895, 0.39857, 0.39824, 0.3979, 0.39787, 0.39769, 0.39709, 0.39648, 0.396, 0.39559, 0.39501, 0.39438, 0.39375, 0.39288, 0.39204, 0.39145, 0.39083, 0.39016, 0.38955, 0.38875, 0.38756, 0.38621, 0.38489, 0.38358, 0.38226, 0.38121, 0.38078, 0.38059, 0.38011, 0.37938, 0.37829, 0.3772, 0.37627, 0.37547, 0.37472, 0.37392, 0.37308, 0.37185, 0.37037, 0.36906, 0.36791, 0.36672, 0.3656, 0.36477, 0.364, 0.36296, 0.36179, 0.36084, 0.35992, 0.3588, 0.35754, 0.35632, 0.35528, 0.35428, 0.35345, 0.35289, 0.35214, 0.35128, 0.35021, 0.34898, 0.34777, 0.34645, 0.34517, 0.34397, 0.34292, 0.3419, 0.34076, 0.3394, 0.33791, 0.33645, 0.33499, 0.33361, 0.33223, 0.33077, 0.32945, 0.32829, 0.32712, 0.32571, 0.32414, 0.3227, 0.32147, 0.32048, 0.31951, 0.31839, 0.31738, 0.31641, 0.31535, 0.31416, 0.31283, 0.31145, 0.30997, 0.30844, 0.307, 0.30601, 0.30557, 0.30534, 0.3048, 0.30401, 0.30322, 0.3024, 0.30145, 0.30042, 0.29962, 0.29884, 0.298, 0.29726, 0.29628, 0.2952, 0.29412, 0.29297, 0.29202, 0.29108, 0.29019, 0.28961, 0.28908, 0.28819, 0.28734, 0.28675, 0.28608, 0.28532, 0.28485, 0.28453, 0.2841, 0.28381, 0.28363, 0.28342, 0.28314, 0.28274, 0.28252, 0.28235, 0.28231, 0.28252, 0.28266, 0.28252, 0.28246, 0.28295, 0.28366, 0.2841, 0.28424, 0.28426, 0.28443, 0.28473, 0.28501, 0.28545, 0.28582, 0.2862, 0.28666, 0.28663, 0.2862, 0.28576, 0.28528, 0.28498, 0.28498, 0.28518, 0.28552, 0.28604, 0.28683, 0.2876, 0.2882, 0.28876, 0.28916, 0.28957, 0.29017, 0.2908, 0.29154, 0.29222, 0.29281, 0.29334, 0.29376, 0.29422, 0.2949, 0.29563, 0.29644, 0.2974, 0.29873, 0.30037, 0.30158, 0.30259, 0.30388, 0.30519, 0.30628, 0.30733, 0.30824, 0.30866, 0.30853, 0.30817, 0.30806, 0.30823, 0.30864, 0.30915, 0.30977, 0.31045, 0.31127, 0.31234, 0.3135, 0.31483, 0.31599, 0.31687, 0.31765, 0.31825, 0.31887, 0.31961, 0.32034, 0.32079, 0.32122, 0.3219, 0.32283, 0.3239, 0.32502, 0.32644, 0.32784, 0.32899, 0.32994, 0.33074, 0.33171, 0.33267, 0.33375, 0.3351, 0.33637, 0.33741, 0.33825, 0.33905, 0.33993, 0.34074, 0.34134, 0.34186, 0.34263, 0.34393, 0.34551, 0.34691, 0.34796, 0.34879, 0.34948, 0.35012, 0.35105, 0.35231, 0.35374, 0.35527, 0.35672, 0.35819, 0.35983, 0.36177, 0.36371, 0.36541, 0.36706, 0.36866, 0.3704, 0.3721, 0.37347, 0.37481, 0.37613, 0.37735, 0.37856, 0.37994, 0.38139, 0.38271, 0.38358, 0.38423, 0.38526, 0.38656, 0.3879, 0.38939, 0.39085, 0.39201, 0.39298, 0.394, 0.3951, 0.39611, 0.39698, 0.398, 0.39912, 0.40019, 0.40126, 0.40243, 0.40372, 0.40492, 0.4056, 0.40601, 0.40647, 0.40719, 0.4084, 0.40984, 0.41128, 0.4127, 0.41412, 0.41519, 0.416, 0.41691, 0.41807, 0.41947, 0.42098, 0.42252, 0.42387, 0.42492, 0.42573, 0.42625, 0.42651, 0.4272, 0.42822, 0.42907, 0.42984, 0.4305, 0.43082, 0.43121, 0.43203, 0.43274, 0.43336, 0.43447, 0.43583, 0.43695, 0.43791, 0.43871, 0.43936, 0.43992, 0.44044, 0.44105, 0.44176, 0.44235, 0.44265, 0.44282, 0.44315, 0.44358, 0.44403, 0.44456, 0.44487, 0.44505, 0.44551, 0.44618, 0.44673, 0.44688, 0.44674, 0.44671, 0.44706, 0.44756, 0.4479, 0.44805, 0.44807, 0.44801, 0.44782, 0.44764, 0.44772, 0.44806, 0.44825, 0.4481, 0.44767, 0.44704, 0.44628, 0.4455, 0.44491, 0.44421, 0.44356, 0.44289, 0.44197, 0.4409, 0.43979, 0.43882, 0.43796, 0.43735, 0.43664, 0.43589, 0.43529, 0.43477, 0.43425, 0.43355, 0.43268, 0.43162, 0.4307, 0.43004, 0.42951, 0.42891, 0.42817, 0.42729, 0.42627, 0.42514, 0.4239, 0.42265, 0.42146, 0.42027, 0.4191, 0.41786, 0.41647, 0.41503, 0.41382, 0.41276, 0.41177, 0.41092, 0.4099, 0.40878, 0.40773, 0.4068, 0.40589, 0.4048, 0.40374, 0.40276, 0.40177, 0.40068, 0.39929, 0.39787, 0.39626, 0.39461, 0.39316, 0.39196, 0.39104, 0.39012, 0.38923, 0.38819, 0.38707, 0.38599, 0.38498, 0.38399, 0.38296, 0.38172, 0.38031, 0.37904, 0.37768, 0.37614, 0.37457, 0.37324, 0.37221, 0.37124, 0.37015, 0.36914, 0.36834, 0.36762, 0.36691, 0.36605, 0.3649, 0.36354, 0.36216, 0.36078, 0.35932, 0.35778, 0.35616, 0.35441, 0.35257, 0.3507, 0.34886, 0.34698, 0.345, 0.34286, 0.34093, 0.33948, 0.33824, 0.33688, 0.33525, 0.33339, 0.33155, 0.32983, 0.3283, 0.32694, 0.32564, 0.32405, 0.32214, 0.31984, 0.31751, 0.31545, 0.31371, 0.31228, 0.3109, 0.30951, 0.30814, 0.30671, 0.30503, 0.30329, 0.30148, 0.29964, 0.29794, 0.2965, 0.29532, 0.2942, 0.29312, 0.29187, 0.29044, 0.28887, 0.28745, 0.28633, 0.28515, 0.28394, 0.28266, 0.28114, 0.27949, 0.27802, 0.27691, 0.2757, 0.27431, 0.27294, 0.27168, 0.27063, 0.2696, 0.26844, 0.26745, 0.26639, 0.2652, 0.26414, 0.26326, 0.26257, 0.26159, 0.26034, 0.25908, 0.25787, 0.25714, 0.25674, 0.25637, 0.25603, 0.25547, 0.25461, 0.25366, 0.25307, 0.25304, 0.25305, 0.25269, 0.25218, 0.25184, 0.25145, 0.2511, 0.25105, 0.25122, 0.25149, 0.25186, 0.25209, 0.2523, 0.25293, 0.25352, 0.25379, 0.25408, 0.25434, 0.25433, 0.25404, 0.25389, 0.25401, 0.25445, 0.25526, 0.25604, 0.25673, 0.2577, 0.25873, 0.25947, 0.25988, 0.26015, 0.26093, 0.2619, 0.26265, 0.26356, 0.26434, 0.2651, 0.26611, 0.26731, 0.26838, 0.26944, 0.27063, 0.27169, 0.2722, 0.27262, 0.27324, 0.27364, 0.27393, 0.27428, 0.27489, 0.27559, 0.27631, 0.27696, 0.27775, 0.27866, 0.27957, 0.28036, 0.28084, 0.28124, 0.28162, 0.28209, 0.28277, 0.28355, 0.28452, 0.28546, 0.28604, 0.28673, 0.2878, 0.28884, 0.28984, 0.29091, 0.29221, 0.29359, 0.29456, 0.29532, 0.29611, 0.29685, 0.29763, 0.29858, 0.2995, 0.30022, 0.30121, 0.3022, 0.30312, 0.30446, 0.30622, 0.30844, 0.31084, 0.31318, 0.31555, 0.3178, 0.31977, 0.32129, 0.32278, 0.32439, 0.32578, 0.32708, 0.32837, 0.32975, 0.33118, 0.33241, 0.3335, 0.33457, 0.33576, 0.33719, 0.33845, 0.33965, 0.34107, 0.3427, 0.34446, 0.3464, 0.34851, 0.35033, 0.35176, 0.35318, 0.35482, 0.35662, 0.35866, 0.36062, 0.36227, 0.36372, 0.36497, 0.36618, 0.36731, 0.36822, 0.36928, 0.37049, 0.37162, 0.37269, 0.37365, 0.37458, 0.37552, 0.37649, 0.37748, 0.3784, 0.37955, 0.38129, 0.38332, 0.38528, 0.38711, 0.38859, 0.3898, 0.39098, 0.39213, 0.39318, 0.39413, 0.39525, 0.39647, 0.39793, 0.39974, 0.40165, 0.40341, 0.40484, 0.40604, 0.407, 0.40796, 0.40927, 0.41062, 0.41165, 0.4124, 0.41323, 0.4142, 0.4154, 0.41682, 0.41793, 0.41887, 0.41978, 0.42085, 0.42174, 0.42258, 0.42384, 0.42508, 0.42628, 0.42777, 0.42929, 0.43056, 0.43153, 0.43237, 0.43322, 0.43422, 0.43553, 0.43695, 0.43832, 0.43961, 0.44088, 0.44224, 0.44362, 0.44456, 0.44512, 0.44561, 0.44611, 0.44677, 0.44711, 0.44736, 0.44814, 0.44889, 0.44926, 0.44945, 0.44952, 0.44989, 0.45064, 0.45131, 0.45204, 0.45266, 0.45325, 0.45392, 0.45465, 0.45542, 0.45601, 0.4565, 0.45691, 0.45703, 0.45693, 0.45683, 0.45665, 0.45614, 0.45564, 0.45536, 0.45522, 0.45516, 0.45495, 0.45469, 0.45447, 0.45408, 0.45366, 0.45341, 0.45324, 0.45304, 0.45299, 0.45285, 0.4524, 0.45195, 0.45155, 0.45117, 0.45082, 0.45036, 0.44969, 0.44892, 0.44817, 0.44738, 0.44663, 0.44564, 0.44469, 0.4441, 0.44384, 0.44376, 0.44348, 0.44279, 0.44178, 0.4406, 0.43947, 0.43849, 0.43754, 0.43632, 0.43498, 0.4339, 0.43294, 0.4321, 0.43134, 0.43043, 0.42958, 0.42879, 0.42788, 0.4268, 0.42546, 0.42415, 0.42296, 0.42163, 0.4202, 0.41874, 0.41735, 0.41592, 0.41465, 0.4135, 0.41231, 0.41117, 0.41005, 0.40853, 0.40668, 0.40499, 0.40334, 0.40147, 0.39963, 0.39809, 0.39682, 0.39549, 0.39403, 0.39235, 0.39047, 0.38849, 0.38651, 0.38466, 0.38288, 0.38109, 0.3792, 0.37716, 0.37502, 0.37329, 0.37193, 0.3707, 0.36969, 0.36866, 0.36723, 0.36574, 0.36461, 0.36332, 0.36182, 0.36023, 0.35837, 0.35647, 0.35453, 0.35237, 0.35036, 0.34842, 0.34664, 0.34519, 0.34378, 0.34226, 0.34044, 0.33846, 0.3363, 0.3341, 0.33206, 0.33002, 0.3283, 0.32676, 0.32519, 0.32344, 0.32126, 0.31873, 0.31605, 0.31378, 0.31199, 0.31007, 0.30805, 0.30629, 0.30471, 0.30329, 0.30203, 0.30072, 0.29916, 0.29748, 0.2958, 0.29403, 0.29213, 0.29043, 0.28891, 0.28727, 0.28568, 0.2843, 0.28325, 0.28242, 0.28151, 0.28031, 0.27898, 0.27779, 0.27667, 0.27572, 0.275, 0.27402, 0.27249, 0.27078, 0.26941, 0.2685, 0.26788, 0.26748, 0.26698, 0.26614, 0.26509, 0.26417, 0.26346, 0.26271, 0.26187, 0.26099, 0.26008, 0.2593, 0.25884, 0.25839, 0.25773, 0.257, 0.25621, 0.25564, 0.25543, 0.25522, 0.25471, 0.25417, 0.25412, 0.25429, 0.25436, 0.25436, 0.25407, 0.25383, 0.25359, 0.25329, 0.25326, 0.25312, 0.25292, 0.25268, 0.25217, 0.25163, 0.25123, 0.2508, 0.25054, 0.25052, 0.25059, 0.25068, 0.25038, 0.24996, 0.25018, 0.25076, 0.25116, 0.25141, 0.25155, 0.25167, 0.25217, 0.25295, 0.25341, 0.25383, 0.25439, 0.25499, 0.25565, 0.25624, 0.25682, 0.25733, 0.25774, 0.2586, 0.26016, 0.26182, 0.26332, 0.26511, 0.26714, 0.26891, 0.27067, 0.27254, 0.27435, 0.27566, 0.27674, 0.27811, 0.2796, 0.28132, 0.2832, 0.285, 0.28646, 0.28776, 0.28879, 0.28939, 0.28988, 0.2906, 0.29176, 0.29298, 0.29418, 0.29577, 0.29758, 0.29953, 0.3013, 0.30275, 0.30453, 0.30645, 0.30816, 0.30982, 0.3115, 0.31318, 0.31504, 0.3171, 0.31905, 0.3211, 0.32327, 0.32534, 0.32704, 0.32856, 0.33042, 0.33239, 0.33405, 0.33559, 0.33764, 0.33985, 0.34208, 0.34437, 0.34635, 0.34846, 0.35078, 0.35282, 0.35443, 0.35597, 0.3579, 0.36022, 0.36263, 0.36506, 0.36757, 0.37006, 0.37252, 0.37491, 0.37703, 0.37896, 0.38081, 0.38266, 0.38481, 0.38714, 0.3895, 0.392, 0.39451, 0.397, 0.39953, 0.40205, 0.40436, 0.40642, 0.40844, 0.41051, 0.41261, 0.41454, 0.41633, 0.41804, 0.41972, 0.42123, 0.4227, 0.42417, 0.42589, 0.42789, 0.42994, 0.43223, 0.43474, 0.43708, 0.43907, 0.44096, 0.4427, 0.44422, 0.44571, 0.44749, 0.44966, 0.45192, 0.45408, 0.45581, 0.45683, 0.45767, 0.45875, 0.46024, 0.46188, 0.46354, 0.46535, 0.46702, 0.46855, 0.46988, 0.47095, 0.47232, 0.47401, 0.47554, 0.47684, 0.47802, 0.47909, 0.48025, 0.48155, 0.48286, 0.48412, 0.4853, 0.48637, 0.48734, 0.48821, 0.48881, 0.48917, 0.48967, 0.49038, 0.4912, 0.49216, 0.49308, 0.49365, 0.49386, 0.49422, 0.49484, 0.49548, 0.49609, 0.49654, 0.49668, 0.49659, 0.49655, 0.49668, 0.49695, 0.4972, 0.4974, 0.49749, 0.49758, 0.49785, 0.49792, 0.4977, 0.49716, 0.49636, 0.49535, 0.49434, 0.49409, 0.49451, 0.49478, 0.49454, 0.49401, 0.4932, 0.49225, 0.49147, 0.49073, 0.49019, 0.48958, 0.489, 0.48869, 0.48815, 0.48723, 0.48632, 0.48532, 0.48394, 0.48264, 0.4816, 0.4806, 0.47957, 0.47848, 0.47737, 0.47633, 0.47514, 0.47372, 0.47233, 0.47118, 0.47024, 0.46923, 0.46805, 0.46676, 0.46552, 0.46431, 0.4631, 0.462, 0.46093, 0.45977, 0.45864, 0.45761, 0.45671, 0.45598, 0.45514, 0.45423, 0.45315, 0.45189, 0.45062, 0.44939, 0.44796, 0.44618, 0.44464, 0.44334, 0.44208, 0.44062, 0.43913, 0.43768, 0.4361, 0.43427, 0.43209, 0.42979, 0.42746, 0.425, 0.42249, 0.42024, 0.41815, 0.41614, 0.41422, 0.41224, 0.41021, 0.40795, 0.40577, 0.40386, 0.40197, 0.3999, 0.39773, 0.39567, 0.39335, 0.39109, 0.38932, 0.38807, 0.38705, 0.38573, 0.38405, 0.38215, 0.38013, 0.37795, 0.37577, 0.37376, 0.37178, 0.36983, 0.3679, 0.36613, 0.3644, 0.36249, 0.36055, 0.35875, 0.357, 0.35512, 0.35311, 0.351, 0.34897, 0.34689, 0.34456, 0.34218, 0.33973, 0.33703, 0.33453, 0.33265, 0.33106, 0.32953, 0.32789, 0.32622, 0.32468, 0.32301, 0.32137, 0.31958, 0.31775, 0.31596, 0.31413, 0.31253, 0.31129, 0.31034, 0.30926, 0.30788, 0.30612, 0.30408, 0.30211, 0.30008, 0.29819, 0.29648, 0.29485, 0.29349, 0.29183, 0.2899, 0.28825, 0.28679, 0.28552, 0.28458, 0.28362, 0.28252, 0.28154, 0.28046, 0.27948, 0.27904, 0.27893, 0.27876, 0.27833, 0.2777, 0.27707, 0.27639, 0.2754, 0.27431, 0.27328, 0.27226, 0.27144, 0.27083, 0.27046, 0.27026, 0.27, 0.26953, 0.26902, 0.26868, 0.26845, 0.2684, 0.26839, 0.26856, 0.2687, 0.26838, 0.26791, 0.26742, 0.26705, 0.26683, 0.26654, 0.2663, 0.26603, 0.26573, 0.26556, 0.26565, 0.26595, 0.26633, 0.26684, 0.26726, 0.2674, 0.26742, 0.26717, 0.26659, 0.2661, 0.26592, 0.266, 0.26593, 0.26566, 0.26521, 0.26469, 0.26454, 0.26459, 0.26464, 0.26464, 0.26419, 0.26354, 0.26309, 0.26315, 0.2636, 0.264, 0.26428, 0.26475, 0.26502, 0.26508, 0.26532, 0.26542, 0.26563, 0.26607, 0.26676, 0.2676, 0.26851, 0.26937, 0.27013, 0.27076, 0.27112, 0.27157, 0.27208, 0.2728, 0.27362, 0.27458, 0.27569, 0.27666, 0.27766, 0.27854, 0.27949, 0.2806, 0.28167, 0.28269, 0.28369, 0.28466, 0.28568, 0.2869, 0.28832, 0.28969, 0.2909, 0.29198, 0.29308, 0.29407, 0.29506, 0.29613, 0.29709, 0.29802, 0.29893, 0.29988, 0.30066, 0.3015, 0.30293, 0.30478, 0.30685, 0.30895, 0.31103, 0.31344, 0.31582, 0.31763, 0.31917, 0.32082, 0.32272, 0.32454, 0.3264, 0.32834, 0.33009, 0.33186, 0.33352, 0.33496, 0.33627, 0.33775, 0.33952, 0.34142, 0.34308, 0.34448, 0.34588, 0.34723, 0.34893, 0.35097, 0.35319, 0.35563, 0.35801, 0.36025, 0.36259, 0.36481, 0.36667, 0.36841, 0.37025, 0.37199, 0.3735, 0.37498, 0.37627, 0.37757, 0.37892, 0.37986, 0.38089, 0.38254, 0.38455, 0.38654, 0.38838, 0.39009, 0.3918, 0.39354, 0.39515, 0.39684, 0.39883, 0.40107, 0.40346, 0.40569, 0.40772, 0.40968, 0.4113, 0.41285, 0.41499, 0.41748, 0.4197, 0.42157, 0.42318, 0.42454, 0.42592, 0.42755, 0.42943, 0.43127, 0.43285, 0.43414, 0.43521, 0.43651, 0.43783, 0.43903, 0.44042, 0.44176, 0.44305, 0.44439, 0.44586, 0.44724, 0.44839, 0.44927, 0.4498, 0.45022, 0.45074, 0.45173, 0.45282, 0.45365, 0.45443, 0.45505, 0.45543, 0.45564, 0.45591, 0.45623, 0.45636, 0.45656, 0.45702, 0.45732, 0.4575, 0.45778, 0.45818, 0.45848, 0.45848, 0.45839, 0.45826, 0.45803, 0.45776, 0.45747, 0.4572, 0.45703, 0.45718, 0.45735, 0.45727, 0.45706, 0.45666, 0.45619, 0.45571, 0.4553, 0.45498, 0.45474, 0.45443, 0.45413, 0.45391, 0.4534, 0.4526, 0.45168, 0.45078, 0.44993, 0.44924, 0.44875, 0.44826, 0.44767, 0.44715, 0.44663, 0.44593, 0.44523, 0.44466, 0.44387, 0.44278, 0.44169, 0.44054, 0.43934, 0.43812, 0.43664, 0.43507, 0.43372, 0.43227, 0.43068, 0.42884, 0.4266, 0.42445, 0.42269, 0.42122, 0.41989, 0.41844, 0.41687, 0.41528, 0.41363, 0.41178, 0.40992, 0.40821, 0.40666, 0.40539, 0.40417, 0.40291, 0.40147, 0.39981, 0.39818, 0.39653, 0.3948, 0.39306, 0.3913, 0.38956, 0.38784, 0.38594, 0.38372, 0.38147, 0.37973, 0.37852, 0.3773, 0.37568, 0.37382, 0.37177, 0.36963, 0.36782, 0.36616, 0.36442, 0.36291, 0.36137, 0.35938, 0.35711, 0.35503, 0.35322, 0.35161, 0.35001, 0.3481, 0.34619, 0.3444, 0.34286, 0.34171, 0.3406, 0.33918, 0.33749, 0.33577, 0.33435, 0.33304, 0.33149, 0.32991, 0.32827, 0.32644, 0.32448, 0.32262, 0.32075, 0.31855, 0.31629, 0.31402, 0.31178, 0.30971, 0.30774, 0.30554, 0.30306, 0.30062, 0.29852, 0.29665, 0.2949, 0.29384, 0.29302, 0.29203, 0.29076, 0.28911, 0.28734, 0.28539, 0.28341, 0.28154, 0.27974, 0.27816, 0.27684, 0.27537, 0.27371, 0.27212, 0.2707, 0.26953, 0.26833, 0.26696, 0.26559, 0.26404, 0.26253, 0.26119, 0.25992, 0.2588, 0.25782, 0.25684, 0.25599, 0.25549, 0.25493, 0.25397, 0.25285, 0.25157, 0.25032, 0.24924, 0.248, 0.24688, 0.24623, 0.24588, 0.24537, 0.24466, 0.24411, 0.24344, 0.24242, 0.24148, 0.24068, 0.2399, 0.23919, 0.23866, 0.23825, 0.23785, 0.2374, 0.23703, 0.23681, 0.23695, 0.23705, 0.23673, 0.23627, 0.23562, 0.23485, 0.234, 0.23354, 0.2335, 0.23355, 0.23388, 0.23455, 0.23539, 0.23608, 0.23653, 0.23701, 0.23754, 0.23806, 0.23856, 0.23903, 0.23944, 0.23936, 0.23879, 0.23836, 0.2385, 0.23905, 0.2398, 0.24066, 0.24169, 0.24306, 0.24432, 0.24543, 0.24657, 0.24761, 0.24857, 0.24951, 0.25045, 0.25157, 0.25291, 0.25412, 0.25498, 0.25585, 0.25712, 0.25853, 0.25977, 0.26051, 0.26081, 0.2612, 0.26198, 0.26327, 0.26499, 0.26681, 0.2686, 0.27033, 0.27203, 0.27372, 0.27551, 0.27733, 0.27903, 0.28055, 0.28176, 0.28296, 0.28447, 0.28623, 0.28821, 0.29012, 0.29168, 0.29336, 0.29525, 0.29664, 0.2979, 0.29959, 0.30136, 0.30317, 0.30513, 0.3072, 0.30928, 0.31127, 0.31324, 0.31497, 0.31645, 0.31795, 0.31964, 0.32175, 0.32432, 0.32689, 0.32925, 0.33164, 0.33387, 0.33599, 0.33792, 0.33962, 0.34148, 0.34373, 0.3463, 0.34899, 0.35167, 0.35426, 0.35665, 0.35871, 0.36035, 0.36156, 0.36262, 0.36396, 0.36556, 0.36734, 0.36927, 0.37122, 0.37299, 0.37448, 0.37588, 0.37739, 0.37869, 0.37971, 0.381, 0.38261, 0.38418, 0.38544, 0.3864, 0.38746, 0.38898, 0.39077, 0.39264, 0.39448, 0.39627, 0.39818, 0.40018, 0.40206, 0.40382, 0.40545, 0.40706, 0.40859, 0.41014, 0.41188, 0.41381, 0.41564, 0.41719, 0.41876, 0.42026, 0.42149, 0.42233, 0.42319, 0.42449, 0.42598, 0.42753, 0.42912, 0.43071, 0.43207, 0.43303, 0.43389, 0.43476, 0.43571, 0.43667, 0.43767, 0.43872, 0.43935, 0.43981, 0.44036, 0.4411, 0.44194, 0.4428, 0.44375, 0.44464, 0.44524, 0.4453, 0.44516, 0.44511, 0.44521, 0.44546, 0.44572, 0.44622, 0.44688, 0.44741, 0.44765, 0.44767, 0.44771, 0.44779, 0.44791, 0.44792, 0.44772, 0.44745, 0.44725, 0.4472, 0.44714, 0.44694, 0.44679, 0.44682, 0.44688, 0.44698, 0.44719, 0.4473, 0.44718, 0.44684, 0.44629, 0.44572, 0.44541, 0.44531, 0.44511, 0.44445, 0.44335, 0.44202, 0.44078, 0.43964, 0.43866, 0.43802, 0.43739, 0.4366, 0.43582, 0.43497, 0.43385, 0.43265, 0.43161, 0.43087, 0.43034, 0.42968, 0.42859, 0.42719, 0.42596, 0.42542, 0.42533, 0.42516, 0.42502, 0.42469, 0.42378, 0.42267, 0.4216, 0.42043, 0.41939, 0.41875, 0.41842, 0.41805, 0.41746, 0.41668, 0.41572, 0.41466, 0.41361, 0.41277, 0.41225, 0.41188, 0.4113, 0.41051, 0.40973, 0.40875, 0.40767, 0.4065, 0.40526, 0.40421, 0.40312, 0.40206, 0.40099, 0.39979, 0.39856, 0.39735, 0.3961, 0.39463, 0.39302, 0.39149, 0.3901, 0.38883, 0.38754, 0.38617, 0.3848, 0.3833, 0.38194, 0.38097, 0.38022, 0.37945, 0.37843, 0.3772, 0.37604, 0.37498, 0.37385, 0.3728, 0.37169, 0.37051, 0.36934, 0.36787, 0.36614, 0.36451, 0.36313, 0.36187, 0.36094, 0.36041, 0.35983, 0.35912, 0.35833, 0.35753, 0.35672, 0.3559, 0.35503, 0.35402, 0.35285, 0.3516, 0.35028, 0.34877, 0.34716, 0.34566, 0.34422, 0.3426, 0.34089, 0.33928, 0.33765, 0.33606, 0.33475, 0.33361, 0.33224, 0.33088, 0.32977, 0.32864, 0.32764, 0.32653, 0.32503, 0.32369, 0.3227, 0.32189, 0.32105, 0.31999, 0.3186, 0.31694, 0.31542, 0.31425, 0.31334, 0.31236, 0.31107, 0.30982, 0.30863, 0.3075, 0.30627, 0.30505, 0.30424, 0.30372, 0.30319, 0.30257, 0.30206, 0.30129, 0.30012, 0.2987, 0.29702, 0.29524, 0.29363, 0.29251, 0.29171, 0.29107, 0.29041, 0.28941, 0.2882, 0.287, 0.2859, 0.28482, 0.2838, 0.2828, 0.28171, 0.28064, 0.27976, 0.27916, 0.27866, 0.27832, 0.27804, 0.27766, 0.27736, 0.27724, 0.27705, 0.27688, 0.27686, 0.27661, 0.27598, 0.27515, 0.27429, 0.27351, 0.27285, 0.27232, 0.27203, 0.27179, 0.27144, 0.27102, 0.27086, 0.27099, 0.27109, 0.27092, 0.27048, 0.27002, 0.26955, 0.26898, 0.26847, 0.26799, 0.26745, 0.26704, 0.26678, 0.26656, 0.26652, 0.26659, 0.26677, 0.2673, 0.26806, 0.2689, 0.26975, 0.27041, 0.27075, 0.27118, 0.27195, 0.27249, 0.27255, 0.27257, 0.2729, 0.27335, 0.27383, 0.27476, 0.27564, 0.2761, 0.277, 0.27841, 0.28007, 0.28194, 0.28375, 0.28545, 0.28675, 0.28771, 0.28866, 0.28963, 0.29065, 0.29204, 0.29393, 0.29579, 0.29723, 0.29861, 0.30009, 0.30152, 0.3029, 0.30434, 0.3062, 0.30844, 0.31039, 0.31165, 0.31273, 0.31385, 0.31496, 0.31632, 0.31819, 0.32028, 0.32201, 0.32318, 0.32381, 0.32414, 0.32457, 0.32557, 0.32704, 0.32879, 0.33069, 0.33251, 0.3342, 0.33592, 0.33741, 0.33842, 0.33925, 0.34023, 0.34133, 0.34251, 0.34405, 0.34573, 0.34733, 0.34901, 0.35085, 0.35257, 0.35423, 0.35577, 0.35685, 0.35783, 0.35912, 0.36055, 0.36183, 0.36307, 0.36429, 0.36557, 0.36672, 0.36769, 0.36871, 0.36967, 0.37062, 0.37179, 0.37308, 0.37444, 0.37583, 0.37724, 0.37837, 0.37926, 0.3802, 0.38126, 0.38263, 0.38405, 0.38529, 0.38653, 0.38787, 0.38904, 0.39013, 0.39132, 0.39234, 0.39332, 0.39428, 0.39512, 0.39616, 0.39729, 0.39823, 0.39907, 0.39995, 0.4006, 0.4011, 0.40195, 0.40283, 0.40369, 0.40486, 0.40622, 0.4074, 0.40821, 0.40878, 0.4092, 0.40952, 0.41001, 0.41065, 0.41136, 0.41212, 0.41282, 0.41336, 0.41392, 0.41477, 0.41562, 0.41624, 0.41676, 0.41739, 0.41804, 0.41857, 0.41884, 0.41912, 0.41969, 0.42042, 0.42114, 0.42194, 0.42282, 0.4237, 0.42436, 0.42467, 0.42507, 0.42564, 0.42634, 0.42714, 0.42798, 0.42864, 0.4291, 0.42938, 0.42935, 0.42933, 0.42967, 0.43025, 0.43083, 0.43127, 0.43127, 0.4309, 0.4306, 0.43016, 0.42988, 0.42975, 0.42955, 0.42939, 0.42919, 0.42896, 0.42863, 0.42811, 0.42752, 0.42684, 0.42626, 0.42604, 0.42589, 0.42573, 0.42527, 0.42451, 0.42353, 0.42258, 0.42208, 0.42178, 0.42138, 0.42067, 0.41956, 0.4183, 0.41717, 0.41618, 0.4154, 0.41502, 0.41476, 0.4142, 0.41338, 0.41238, 0.41122, 0.40994, 0.40864, 0.40742, 0.4065, 0.40597, 0.40531, 0.40451, 0.40359, 0.40245, 0.40132, 0.40032, 0.3994, 0.3982, 0.39678, 0.39561, 0.39499, 0.39466, 0.3941, 0.39329, 0.39227, 0.39118, 0.39018, 0.38935, 0.38877, 0.38836, 0.38795, 0.38736, 0.38644, 0.38528, 0.38378, 0.38215, 0.38056, 0.37901, 0.37776, 0.37669, 0.37562, 0.37444, 0.3732, 0.37185, 0.37035, 0.36877, 0.36725, 0.36555, 0.36363, 0.36168, 0.35982, 0.35798, 0.35617, 0.35436, 0.3526, 0.35105, 0.34979, 0.34839, 0.34676, 0.34512, 0.34333, 0.34162, 0.34023, 0.3389, 0.3376, 0.33622, 0.33445, 0.33252, 0.3308, 0.32955, 0.32836, 0.32689, 0.32546, 0.32417, 0.323, 0.3217, 0.32041, 0.31941, 0.31853, 0.31776, 0.31709, 0.31627, 0.31551, 0.31463, 0.31345, 0.31219, 0.31105, 0.30995, 0.30875, 0.30755, 0.30617, 0.30491, 0.30354, 0.30197, 0.30071, 0.29973, 0.29938, 0.29918, 0.29854, 0.29777, 0.29719, 0.29662, 0.29561, 0.2945, 0.29346, 0.29239, 0.29129, 0.29044, 0.28991, 0.28905, 0.28779, 0.28652, 0.28546, 0.2843, 0.28311, 0.28207, 0.28111, 0.28023, 0.2794, 0.27874, 0.27823, 0.27801, 0.27782, 0.27722, 0.27655, 0.27591, 0.27529, 0.275, 0.27502, 0.27496, 0.27501, 0.27502, 0.27446, 0.27369, 0.27306, 0.27243, 0.27175, 0.27103, 0.27052, 0.27004, 0.26951, 0.26916, 0.26911, 0.26937, 0.26962, 0.26994, 0.27044, 0.27093, 0.27133, 0.27141, 0.2713, 0.27115, 0.27107, 0.27098, 0.27093, 0.27101, 0.27108, 0.2713, 0.27202, 0.27318, 0.27414, 0.27476, 0.27507, 0.27532, 0.2757, 0.27611, 0.27651, 0.27727, 0.27832, 0.27908, 0.27959, 0.28008, 0.28069, 0.28129, 0.28165, 0.28177, 0.28193, 0.28234, 0.28271, 0.28319, 0.28401, 0.28482, 0.28524, 0.28551, 0.28594, 0.28661, 0.28751, 0.28867, 0.28985, 0.29101, 0.29235, 0.29379, 0.29531, 0.29672, 0.29767, 0.29857, 0.29949, 0.30027, 0.30119, 0.3025, 0.30366, 0.30485, 0.30626, 0.30746, 0.30867, 0.31016, 0.31164, 0.31298, 0.31444, 0.31604, 0.31769, 0.31943, 0.32122, 0.3228, 0.32395, 0.3248, 0.32532, 0.32607, 0.32731, 0.32868, 0.33024, 0.33191, 0.3332, 0.33404, 0.33491, 0.3361, 0.33761, 0.33898, 0.33999, 0.34083, 0.34164, 0.34284, 0.34465, 0.34673, 0.34891, 0.35113, 0.35325, 0.35526, 0.35716, 0.359, 0.36062, 0.36209, 0.36387, 0.3657, 0.36744, 0.3691, 0.37069, 0.37229, 0.37378, 0.37547, 0.37751, 0.37941, 0.38091, 0.38214, 0.38307, 0.38403, 0.38506, 0.38607, 0.38725, 0.38857, 0.38997, 0.39149, 0.39302, 0.39413, 0.39512, 0.39647, 0.39802, 0.39964, 0.40134, 0.40326, 0.40521, 0.4068, 0.40795, 0.40886, 0.40944, 0.41002, 0.41098, 0.41202, 0.41297, 0.41405, 0.41539, 0.41674, 0.41812, 0.4197, 0.42139, 0.42296, 0.42418, 0.42511, 0.42586, 0.42652, 0.42734, 0.42827, 0.42937, 0.43074, 0.43194, 0.43288, 0.43371, 0.43468, 0.43584, 0.43695, 0.43813, 0.43933, 0.4404, 0.44133, 0.44215, 0.4428, 0.44354, 0.44454, 0.44553, 0.4463, 0.44671, 0.44662, 0.44641, 0.44631, 0.44614, 0.44601, 0.44588, 0.44597, 0.44635, 0.44679, 0.44698, 0.44661, 0.44602, 0.44531, 0.44448, 0.4439, 0.4434, 0.44289, 0.44235, 0.44163, 0.441, 0.44058, 0.44034, 0.44042, 0.44079, 0.44132, 0.44166, 0.44156, 0.44113, 0.44079, 0.4408, 0.44082, 0.44069, 0.44042, 0.43989, 0.43934, 0.43877, 0.43811, 0.43757, 0.43707, 0.43651, 0.43583, 0.43507, 0.43446, 0.43388, 0.43333, 0.43278, 0.43231, 0.43205, 0.43163, 0.43092, 0.42999, 0.42881, 0.42742, 0.42609, 0.42483, 0.42342, 0.42188, 0.42049, 0.41938, 0.41822, 0.41694, 0.4157, 0.41472, 0.41385, 0.41289, 0.4119, 0.41073, 0.40946, 0.40818, 0.4067, 0.40523, 0.404, 0.40284, 0.40168, 0.4005, 0.39931, 0.39819, 0.39712, 0.39596, 0.39483, 0.39411, 0.39368, 0.3932, 0.39252, 0.39171, 0.3908, 0.3895, 0.38803, 0.38668, 0.38533, 0.38389, 0.38224, 0.38057, 0.37911, 0.37793, 0.37709, 0.37642, 0.37574, 0.37483, 0.37352, 0.37183, 0.37015, 0.3687, 0.36734, 0.3661, 0.36491, 0.36385, 0.36312, 0.36234, 0.36153, 0.36061, 0.35935, 0.35782, 0.35606, 0.35446, 0.35315, 0.35178, 0.35041, 0.34944, 0.34881, 0.3483, 0.34754, 0.34646, 0.34542, 0.34414, 0.34277, 0.34147, 0.34004, 0.33862, 0.33724, 0.33602, 0.33499, 0.334, 0.33298, 0.33183, 0.33055, 0.32925, 0.32794, 0.3266, 0.32536, 0.32442, 0.32369, 0.3228, 0.32155, 0.32019, 0.31923, 0.31849, 0.31753, 0.31626, 0.31496, 0.31381, 0.31252, 0.31136, 0.31048, 0.30959, 0.30884, 0.30816, 0.30743, 0.3066, 0.3056, 0.30472, 0.30397, 0.30319, 0.30239, 0.30151, 0.3006, 0.29986, 0.29918, 0.29853, 0.29822, 0.29775, 0.29708, 0.29658, 0.29605, 0.29539, 0.29458, 0.29355, 0.29277, 0.29241, 0.29204, 0.29164, 0.2912, 0.29069, 0.29023, 0.28963, 0.28895, 0.28844, 0.28796, 0.28735, 0.28684, 0.28672, 0.28668, 0.28638, 0.28633, 0.28662, 0.287, 0.28746, 0.28788, 0.28825, 0.2885, 0.28851, 0.28815, 0.28764, 0.2875, 0.28794, 0.28883, 0.2895, 0.28966, 0.2897, 0.28963, 0.28938, 0.2894, 0.29002, 0.29107, 0.29206, 0.2928, 0.29335, 0.29397, 0.29457, 0.29492, 0.29523, 0.29549, 0.29578, 0.29607, 0.29652, 0.29725, 0.29795, 0.29871, 0.29995, 0.3015, 0.30256, 0.30311, 0.30405, 0.30545, 0.30673, 0.30777, 0.30863, 0.30951, 0.31027, 0.31108, 0.31198, 0.31302, 0.31406, 0.31465, 0.31541, 0.31609, 0.31687, 0.31781, 0.31873, 0.31945, 0.32001, 0.32092, 0.32198, 0.32308, 0.32426, 0.32565, 0.32716, 0.32869, 0.3305, 0.33243, 0.33434, 0.33614, 0.33791, 0.33985, 0.34166, 0.34314, 0.34437, 0.34564, 0.347, 0.34839, 0.34988, 0.35132, 0.35261, 0.35381, 0.35491, 0.35573, 0.35679, 0.35812, 0.35927, 0.36029, 0.36116, 0.36201, 0.36304, 0.36388, 0.36457, 0.36524, 0.36561, 0.36611, 0.36713, 0.36856, 0.37023, 0.372, 0.37372, 0.37524, 0.37654, 0.37789, 0.37938, 0.38085, 0.38235, 0.38388, 0.38523, 0.3864, 0.38776, 0.38937, 0.391, 0.39254, 0.3942, 0.39593, 0.39744, 0.39894, 0.4004, 0.40182, 0.40349, 0.40508, 0.40649, 0.40785, 0.40899, 0.40961, 0.40985, 0.41013, 0.41048, 0.41108, 0.41175, 0.41253, 0.41336, 0.41394, 0.41454, 0.41561, 0.41678, 0.41776, 0.4188, 0.41988, 0.42074, 0.42136, 0.42187, 0.42244, 0.42323, 0.42381, 0.42436, 0.42525, 0.42626, 0.42757, 0.42891, 0.4301, 0.43113, 0.43203, 0.43277, 0.43338, 0.43386, 0.4344, 0.43485, 0.43523, 0.43578, 0.43647, 0.43743, 0.43846, 0.43938, 0.44034, 0.44148, 0.4426, 0.44344, 0.44424, 0.44489, 0.44507, 0.44494, 0.44506, 0.44543, 0.4458, 0.44631, 0.44661, 0.44645, 0.44622, 0.44609, 0.44614, 0.44625, 0.44601, 0.44554, 0.44515, 0.44472, 0.44406, 0.44339, 0.44318, 0.44302, 0.44254, 0.44219, 0.44179, 0.44104, 0.43994, 0.43878, 0.43781, 0.43704, 0.4365, 0.4361, 0.43573, 0.4354, 0.43506, 0.43481, 0.4345, 0.43394, 0.43309, 0.43203, 0.43123, 0.43072, 0.43032, 0.42967, 0.42866, 0.42753, 0.42626, 0.42498, 0.42397, 0.42315, 0.42197, 0.42066, 0.41936, 0.41813, 0.41694, 0.41585, 0.41495, 0.41403, 0.41311, 0.4121, 0.41073, 0.4091, 0.40765, 0.40653, 0.40574, 0.40511, 0.40416, 0.40308, 0.40227, 0.40149, 0.4003, 0.39891, 0.39761, 0.39631, 0.39483, 0.39338, 0.39209, 0.39079, 0.38917, 0.38699, 0.38457, 0.38252, 0.38114, 0.38013, 0.37899, 0.37764, 0.37621, 0.37473, 0.37344, 0.37218, 0.37092, 0.36947, 0.36746, 0.36528, 0.36335, 0.36152, 0.35975, 0.35812, 0.35653, 0.3549, 0.35325, 0.35167, 0.35006, 0.34829, 0.34652, 0.34453, 0.34224, 0.34013, 0.3383, 0.33646, 0.33474, 0.3332, 0.33165, 0.32981, 0.32782, 0.32594, 0.3242, 0.32277, 0.32118, 0.31926, 0.31727, 0.31538, 0.31368, 0.31196, 0.31041, 0.3092, 0.30818, 0.30682, 0.30546, 0.30416, 0.30244, 0.30066, 0.29894, 0.29707, 0.29518, 0.29345, 0.29196, 0.29072, 0.2897, 0.28853, 0.28688, 0.28507, 0.28323, 0.28135, 0.27982, 0.27847, 0.27741, 0.27637, 0.27529, 0.27405, 0.27226, 0.27036, 0.26863, 0.26711, 0.26597, 0.26537, 0.26502, 0.26451, 0.264, 0.26333, 0.26271, 0.26204, 0.2611, 0.26035, 0.25965, 0.25889, 0.25806, 0.25685, 0.25575, 0.25511, 0.25463, 0.25417, 0.25372, 0.25343, 0.25302, 0.25256, 0.25199, 0.25113, 0.2504, 0.24977, 0.24927, 0.24873, 0.24808, 0.24753, 0.24712, 0.24678, 0.24657, 0.24647, 0.24643, 0.2463, 0.24597, 0.2454, 0.24513, 0.24521, 0.24534, 0.24596, 0.24687, 0.24727, 0.24729, 0.24771, 0.24835, 0.24915, 0.2501, 0.2508, 0.25139, 0.25212, 0.25308, 0.25406, 0.25441, 0.25459, 0.25509, 0.25566, 0.25627, 0.25673, 0.25709, 0.25736, 0.25738, 0.25747, 0.25807, 0.25896, 0.25975, 0.26069, 0.26129, 0.26173, 0.26256, 0.26345, 0.26427, 0.2652, 0.26649, 0.2678, 0.269, 0.27036, 0.27192, 0.27346, 0.27473, 0.27594, 0.27699, 0.27792, 0.27905, 0.28069, 0.28293, 0.28505, 0.28693, 0.28866, 0.2902, 0.29147, 0.29256, 0.29346, 0.29444, 0.29589, 0.29788, 0.29984, 0.30147, 0.30293, 0.30398, 0.30502, 0.30619, 0.30734, 0.30866, 0.31012, 0.31153, 0.3128, 0.31414, 0.31563, 0.31717, 0.31899, 0.32096, 0.32307, 0.32545, 0.32775, 0.32999, 0.33214, 0.33391, 0.33561, 0.33729, 0.3385, 0.33953, 0.34065, 0.34193, 0.34313, 0.34432, 0.34584, 0.34767, 0.34997, 0.35253, 0.35499, 0.35731, 0.35942, 0.36122, 0.36279, 0.36435, 0.36579, 0.36724, 0.36884, 0.37062, 0.37231, 0.37404, 0.37626, 0.37848, 0.38055, 0.38263, 0.38474, 0.38668, 0.38852, 0.39032, 0.39209, 0.3937, 0.39517, 0.39665, 0.39803, 0.39956, 0.40125, 0.4029, 0.40444, 0.40597, 0.40743, 0.4089, 0.41073, 0.41288, 0.41499, 0.41691, 0.41858, 0.42017, 0.42168, 0.42309, 0.42483, 0.4269, 0.42891, 0.43101, 0.43356, 0.43613, 0.43827, 0.44007, 0.44181, 0.44358, 0.44532, 0.44706, 0.44901, 0.45105, 0.45286, 0.45448, 0.45617, 0.45779, 0.4593, 0.46081, 0.462, 0.46305, 0.4641, 0.46509, 0.46628, 0.46793, 0.46984, 0.47146, 0.47274, 0.47354, 0.47408, 0.47462, 0.47531, 0.47611, 0.47692, 0.47788, 0.47882, 0.4795, 0.48006, 0.48051, 0.48097, 0.48177, 0.48267, 0.48337, 0.48394, 0.48448, 0.48529, 0.4858, 0.48567, 0.48555, 0.48559, 0.48604, 0.48674, 0.48738, 0.48813, 0.48853, 0.4885, 0.48845, 0.48837, 0.48825, 0.48796, 0.48709, 0.48616, 0.48543, 0.48476, 0.48415, 0.48362, 0.48315, 0.48285, 0.48282, 0.48286, 0.48288, 0.48263, 0.482, 0.48122, 0.48036, 0.47928, 0.47801, 0.47672, 0.47554, 0.47452, 0.47357, 0.47282, 0.47225, 0.47161, 0.47076, 0.46969, 0.46844, 0.46703, 0.46559, 0.46414, 0.46259, 0.46084, 0.45922, 0.45782, 0.45654, 0.4551, 0.4533, 0.4516, 0.45011, 0.44865, 0.44703, 0.44541, 0.4439, 0.44202, 0.43992, 0.43812, 0.43634, 0.43437, 0.43233, 0.43027, 0.42819, 0.42625, 0.42445, 0.42267, 0.42091, 0.41933, 0.41788, 0.41612, 0.41414, 0.41183, 0.40943, 0.40728, 0.4052, 0.40321, 0.401, 0.39871, 0.39655, 0.39419, 0.39164, 0.38902, 0.38621, 0.38325, 0.38033, 0.37781, 0.37571, 0.37356, 0.3713, 0.36904, 0.36673, 0.3644, 0.36202, 0.35975, 0.35742, 0.35493, 0.35246, 0.34991, 0.34745, 0.34491, 0.34234, 0.33991, 0.3374, 0.33497, 0.33273, 0.33038, 0.32766, 0.32505, 0.32275, 0.32046, 0.31794, 0.31493, 0.31176, 0.30868, 0.30566, 0.30285, 0.30027, 0.29791, 0.29581, 0.29381, 0.29168, 0.28962, 0.28779, 0.28584, 0.28351, 0.28105, 0.27837, 0.27554, 0.27293, 0.27043, 0.26817, 0.26641, 0.26492, 0.2633, 0.2615, 0.25974, 0.25788, 0.25573, 0.25352, 0.25142, 0.24922, 0.24671, 0.24429, 0.24214, 0.23999, 0.23787, 0.23572, 0.23378, 0.23208, 0.23037, 0.22884, 0.22722, 0.22512, 0.22295, 0.22115, 0.2193, 0.21753, 0.21603, 0.21464, 0.2132, 0.21179, 0.21036, 0.20886, 0.2074, 0.20626, 0.20522, 0.20419, 0.20349, 0.20238, 0.20132, 0.20071, 0.19979, 0.19901, 0.19835, 0.1976, 0.19667, 0.19591, 0.19502, 0.19396, 0.19284, 0.1922, 0.19212, 0.19225, 0.19262, 0.19294, 0.19288, 0.19269, 0.19248, 0.19212, 0.19164, 0.19142, 0.19111, 0.19079, 0.19026, 0.18979, 0.1898, 0.19009, 0.18993, 0.18963, 0.18954, 0.18911, 0.18874, 0.18886, 0.1887, 0.18889, 0.18925, 0.18944, 0.18933, 0.18936, 0.18978, 0.1906, 0.19159, 0.19213, 0.19247, 0.19275, 0.19315, 0.19334, 0.194, 0.19495, 0.1961, 0.197, 0.19737, 0.19777, 0.19839, 0.19858, 0.19916, 0.20011, 0.20091, 0.20176, 0.20246, 0.20302, 0.20383, 0.20509, 0.20623, 0.20758, 0.20905, 0.21026, 0.21109, 0.21194, 0.21301, 0.21443, 0.21607, 0.21796, 0.22023, 0.22244, 0.22422, 0.22559, 0.22686, 0.22774, 0.22887, 0.23016, 0.23147, 0.23334, 0.23578, 0.23816, 0.24037, 0.24267, 0.24496, 0.24783, 0.25032, 0.25243, 0.2543, 0.25593, 0.25773, 0.25968, 0.26163, 0.26346, 0.26553, 0.26803, 0.27043, 0.27306, 0.27579, 0.27813, 0.2807, 0.28288, 0.28485, 0.28684, 0.28897, 0.29145, 0.29463, 0.29825, 0.30187, 0.30509, 0.30817, 0.31075, 0.31318, 0.31635, 0.31872, 0.32112, 0.32379, 0.32659, 0.32977, 0.33331, 0.33663, 0.33982, 0.34303, 0.34643, 0.34951, 0.35255, 0.35597, 0.35942, 0.36227, 0.36461, 0.36684, 0.36898, 0.37125, 0.37391, 0.37708, 0.38021, 0.38332, 0.38638, 0.38949, 0.39259, 0.39547, 0.39785, 0.4, 0.40227, 0.40455, 0.40739, 0.40997, 0.41265, 0.41543, 0.41836, 0.42114, 0.42381, 0.42629, 0.4288, 0.43139, 0.43414, 0.43669, 0.43937, 0.44162, 0.44358, 0.44528, 0.44695, 0.44861, 0.45044, 0.45264, 0.45511, 0.45786, 0.46058, 0.46293, 0.46502, 0.46709, 0.46918, 0.47061, 0.47211, 0.47343, 0.47463, 0.47567, 0.47655, 0.47762, 0.47866, 0.4798, 0.48125, 0.48267, 0.4843, 0.48551, 0.48662, 0.48775, 0.48908, 0.49066, 0.49219, 0.49347, 0.49461, 0.49568, 0.49668, 0.49752, 0.49818, 0.49892, 0.49999, 0.50105, 0.50239, 0.50368, 0.50445, 0.50522, 0.50603, 0.50696, 0.50776, 0.50866, 0.50936, 0.51, 0.5104, 0.51077, 0.5113, 0.51155, 0.51176, 0.51216, 0.51255, 0.51288, 0.51308, 0.51314, 0.51303, 0.51287, 0.51288, 0.51272, 0.51254, 0.51215, 0.51203, 0.51151, 0.51122, 0.51081, 0.51067, 0.51032, 0.50998, 0.50992, 0.50965, 0.50911, 0.50846, 0.50786, 0.50755, 0.50738, 0.50703, 0.50639, 0.50547, 0.50452, 0.50321, 0.50198, 0.50093, 0.49987, 0.49877, 0.49758, 0.49651, 0.49545, 0.49454, 0.49379, 0.49305, 0.49224, 0.49106, 0.48995, 0.48861, 0.48711, 0.48541, 0.48398, 0.48234, 0.48076, 0.47913, 0.47729, 0.4753, 0.47333, 0.47166, 0.47006, 0.46827, 0.46636, 0.46487, 0.46355, 0.46219, 0.46064, 0.45874, 0.45649, 0.45468, 0.45261, 0.45066, 0.44886, 0.44704, 0.44513, 0.44294, 0.44062, 0.43814, 0.43541, 0.4324, 0.42978, 0.42726, 0.42478, 0.42262, 0.42063, 0.41896, 0.41751, 0.41641, 0.41492, 0.41327, 0.41117, 0.40925, 0.40715, 0.40486, 0.4023, 0.39924, 0.39582, 0.3924, 0.38948, 0.38676, 0.38448, 0.38231, 0.38013, 0.3776, 0.3747, 0.37181, 0.36903, 0.36628, 0.36355, 0.3607, 0.35778, 0.35497, 0.35192, 0.34896, 0.34619, 0.34341, 0.34096, 0.33873, 0.33645, 0.33428, 0.33201, 0.3295, 0.32681, 0.32403, 0.32148, 0.3191, 0.31681, 0.3146, 0.3123, 0.30989, 0.3073, 0.3048, 0.30289, 0.30104, 0.29894, 0.29674, 0.29466, 0.29287, 0.29113, 0.28934, 0.28738, 0.28498, 0.28238, 0.27991, 0.27774, 0.27571, 0.2741, 0.27284, 0.27166, 0.27031, 0.26828, 0.2662, 0.26434, 0.26266, 0.26124, 0.25983, 0.25853, 0.25716, 0.25566, 0.25438, 0.25286, 0.25128, 0.24973, 0.24819, 0.24674, 0.24509, 0.24296, 0.24044, 0.23814, 0.23612, 0.23456, 0.23345, 0.23224, 0.23132, 0.23078, 0.23014, 0.22945, 0.2285, 0.22727, 0.22597};
+const double vEOPy[] = {0.23007, 0.23234, 0.23449, 0.23658, 0.23868, 0.24084, 0.24316, 0.24568, 0.24844, 0.25134, 0.25428, 0.25716, 0.2599, 0.26241, 0.26471, 0.26689, 0.26901, 0.27116, 0.27341, 0.27581, 0.27834, 0.28093, 0.28354, 0.28617, 0.28874, 0.29116, 0.29338, 0.29549, 0.29759, 0.29979, 0.30213, 0.30464, 0.30724, 0.30982, 0.31229, 0.31461, 0.31681, 0.31894, 0.32105, 0.32322, 0.32549, 0.3279, 0.33048, 0.33323, 0.33619, 0.3393, 0.34243, 0.34548, 0.34836, 0.35102, 0.35341, 0.35561, 0.35773, 0.35991, 0.36219, 0.36455, 0.36699, 0.36946, 0.37195, 0.37445, 0.37694, 0.3794, 0.38178, 0.38409, 0.38634, 0.38853, 0.39066, 0.39276, 0.39488, 0.39714, 0.39957, 0.40209, 0.40456, 0.40684, 0.40883, 0.41055, 0.4122, 0.41398, 0.41602, 0.41834, 0.42086, 0.4234, 0.42581, 0.42803, 0.43013, 0.43215, 0.43408, 0.43595, 0.43775, 0.43951, 0.44136, 0.44347, 0.44576, 0.44811, 0.45038, 0.45248, 0.45449, 0.45649, 0.45855, 0.46079, 0.46325, 0.46584, 0.46846, 0.47098, 0.47324, 0.47523, 0.47701, 0.47869, 0.48037, 0.48204, 0.48362, 0.48508, 0.48641, 0.4876, 0.48871, 0.48981, 0.491, 0.49238, 0.4939, 0.49551, 0.49722, 0.49896, 0.50051, 0.50163, 0.50214, 0.5022, 0.50215, 0.50231, 0.50275, 0.50343, 0.5042, 0.50491, 0.50549, 0.50592, 0.50618, 0.50631, 0.5064, 0.50663, 0.50703, 0.5074, 0.50759, 0.50753, 0.50731, 0.50705, 0.50692, 0.50697, 0.50701, 0.507, 0.5069, 0.50663, 0.50614, 0.50545, 0.50471, 0.50406, 0.5036, 0.50333, 0.50315, 0.50297, 0.50277, 0.50253, 0.50217, 0.50164, 0.50089, 0.49992, 0.49878, 0.49763, 0.49667, 0.49602, 0.49557, 0.49522, 0.49483, 0.4943, 0.49356, 0.49259, 0.49149, 0.49044, 0.48951, 0.48869, 0.48787, 0.48691, 0.48578, 0.48448, 0.48307, 0.4816, 0.4801, 0.47861, 0.47721, 0.47599, 0.47484, 0.47359, 0.47219, 0.47063, 0.46895, 0.46718, 0.46541, 0.46371, 0.46216, 0.46076, 0.45946, 0.45821, 0.45701, 0.45584, 0.45467, 0.45342, 0.45199, 0.45032, 0.44843, 0.44638, 0.4442, 0.44189, 0.4395, 0.4371, 0.43475, 0.43249, 0.43043, 0.42838, 0.42644, 0.42462, 0.42285, 0.42103, 0.41906, 0.417, 0.41491, 0.4128, 0.41067, 0.40858, 0.40654, 0.40456, 0.40258, 0.40052, 0.39833, 0.39599, 0.39351, 0.39091, 0.38824, 0.38558, 0.38298, 0.38041, 0.37785, 0.3753, 0.37278, 0.3703, 0.36785, 0.36535, 0.36262, 0.35966, 0.35658, 0.35346, 0.35041, 0.34745, 0.34454, 0.34171, 0.33894, 0.33625, 0.33366, 0.33117, 0.3288, 0.32651, 0.3242, 0.32175, 0.31911, 0.31632, 0.31347, 0.3106, 0.30771, 0.30484, 0.3021, 0.29958, 0.29733, 0.29529, 0.29335, 0.29133, 0.28917, 0.28686, 0.28439, 0.28178, 0.27904, 0.27618, 0.27329, 0.27052, 0.26794, 0.26557, 0.26333, 0.26112, 0.25881, 0.25633, 0.25378, 0.25121, 0.2486, 0.24592, 0.24324, 0.24061, 0.23808, 0.23577, 0.23374, 0.23201, 0.23053, 0.22911, 0.22756, 0.22572, 0.22365, 0.22147, 0.21927, 0.21713, 0.21511, 0.21323, 0.21152, 0.20994, 0.20841, 0.20688, 0.20532, 0.20372, 0.20211, 0.20051, 0.19897, 0.19748, 0.19603, 0.1946, 0.19315, 0.19168, 0.19022, 0.18877, 0.18733, 0.1859, 0.18447, 0.18307, 0.1817, 0.18036, 0.17912, 0.17793, 0.17669, 0.17538, 0.17405, 0.17275, 0.17159, 0.17062, 0.16987, 0.16925, 0.16869, 0.16812, 0.16756, 0.16701, 0.16648, 0.16594, 0.16545, 0.16505, 0.16476, 0.1646, 0.16452, 0.16445, 0.16433, 0.16415, 0.16397, 0.16387, 0.1639, 0.16406, 0.16423, 0.16431, 0.16426, 0.16417, 0.16412, 0.16416, 0.16435, 0.16468, 0.16509, 0.1655, 0.16589, 0.16622, 0.16647, 0.16664, 0.16669, 0.16662, 0.16649, 0.16637, 0.16635, 0.16648, 0.16676, 0.16721, 0.16778, 0.16846, 0.16921, 0.17002, 0.17087, 0.17176, 0.17269, 0.17362, 0.17455, 0.17545, 0.17628, 0.17698, 0.17757, 0.17805, 0.1785, 0.17895, 0.17942, 0.1799, 0.18035, 0.18074, 0.18106, 0.18147, 0.18211, 0.18296, 0.18396, 0.18501, 0.18603, 0.18694, 0.18783, 0.1888, 0.18995, 0.1913, 0.1928, 0.19432, 0.1957, 0.19687, 0.19784, 0.19867, 0.19945, 0.20022, 0.20112, 0.20218, 0.20332, 0.2045, 0.20563, 0.20672, 0.20778, 0.20886, 0.21006, 0.21134, 0.21261, 0.21381, 0.21491, 0.21592, 0.21684, 0.21769, 0.21855, 0.21948, 0.22049, 0.22161, 0.22287, 0.22428, 0.22578, 0.22734, 0.22897, 0.23063, 0.23234, 0.23409, 0.23583, 0.23756, 0.23932, 0.24104, 0.24266, 0.24416, 0.24564, 0.24721, 0.24895, 0.25078, 0.25253, 0.25423, 0.25597, 0.25782, 0.25977, 0.26175, 0.26374, 0.26571, 0.26767, 0.26966, 0.27171, 0.27386, 0.27609, 0.27838, 0.28064, 0.28281, 0.28482, 0.28664, 0.28828, 0.28981, 0.29133, 0.29291, 0.29458, 0.29636, 0.29825, 0.30029, 0.30251, 0.30487, 0.30725, 0.30959, 0.31185, 0.31396, 0.31591, 0.31777, 0.31961, 0.32147, 0.3233, 0.32505, 0.32668, 0.32818, 0.32971, 0.33133, 0.33305, 0.33492, 0.33699, 0.33927, 0.34165, 0.34403, 0.34624, 0.34817, 0.34978, 0.35115, 0.35238, 0.35368, 0.35521, 0.35696, 0.35883, 0.36077, 0.36272, 0.36469, 0.36666, 0.36857, 0.37042, 0.37226, 0.37412, 0.37604, 0.37799, 0.37991, 0.38176, 0.38352, 0.38525, 0.38702, 0.38887, 0.39089, 0.39311, 0.3954, 0.39751, 0.39934, 0.4009, 0.40222, 0.40339, 0.40453, 0.40587, 0.40737, 0.40893, 0.41052, 0.41214, 0.41385, 0.41559, 0.4172, 0.41863, 0.41985, 0.42088, 0.42178, 0.42263, 0.42354, 0.42458, 0.42585, 0.42735, 0.42899, 0.43065, 0.43222, 0.43363, 0.43486, 0.43594, 0.43689, 0.43774, 0.43856, 0.43941, 0.44036, 0.44141, 0.44252, 0.44362, 0.44468, 0.44569, 0.44665, 0.44761, 0.44856, 0.44945, 0.45023, 0.45092, 0.45154, 0.45213, 0.45278, 0.45352, 0.45434, 0.45524, 0.4562, 0.4572, 0.45824, 0.45931, 0.46037, 0.46138, 0.46241, 0.46348, 0.46464, 0.46589, 0.46715, 0.46825, 0.46918, 0.46997, 0.4707, 0.47145, 0.4723, 0.4733, 0.47438, 0.47537, 0.47612, 0.47655, 0.47666, 0.47652, 0.47628, 0.47612, 0.47616, 0.47641, 0.47683, 0.47737, 0.47799, 0.47865, 0.4793, 0.47982, 0.48015, 0.48025, 0.48015, 0.47992, 0.47968, 0.47941, 0.47917, 0.47905, 0.47911, 0.47922, 0.47917, 0.47887, 0.47841, 0.4778, 0.47707, 0.4765, 0.47628, 0.47622, 0.476, 0.47542, 0.47468, 0.47387, 0.47297, 0.472, 0.47103, 0.47015, 0.46943, 0.46878, 0.46807, 0.46729, 0.46647, 0.4656, 0.46465, 0.46359, 0.46247, 0.46135, 0.46026, 0.45919, 0.45808, 0.45686, 0.45551, 0.45408, 0.45264, 0.45134, 0.45033, 0.44963, 0.44917, 0.44881, 0.44842, 0.44788, 0.44715, 0.44619, 0.44492, 0.44333, 0.44153, 0.43964, 0.43779, 0.43602, 0.43432, 0.43269, 0.43108, 0.42943, 0.42772, 0.42599, 0.42431, 0.42278, 0.42139, 0.42002, 0.41852, 0.41695, 0.41535, 0.41369, 0.41193, 0.41008, 0.40819, 0.40638, 0.40462, 0.40283, 0.40098, 0.39907, 0.39709, 0.39509, 0.3932, 0.39147, 0.38984, 0.38821, 0.38651, 0.38475, 0.38295, 0.38115, 0.37936, 0.37759, 0.37589, 0.37427, 0.37264, 0.37085, 0.36879, 0.36656, 0.36434, 0.36224, 0.36033, 0.35861, 0.35706, 0.35561, 0.35414, 0.35255, 0.35077, 0.34875, 0.34646, 0.34394, 0.34128, 0.33866, 0.33622, 0.334, 0.33193, 0.32993, 0.32789, 0.32579, 0.32358, 0.32124, 0.31884, 0.31647, 0.31422, 0.31211, 0.31011, 0.30812, 0.30606, 0.30395, 0.30186, 0.29985, 0.29786, 0.29582, 0.29381, 0.29195, 0.29025, 0.28866, 0.28708, 0.28537, 0.28345, 0.28135, 0.27911, 0.27676, 0.27433, 0.2719, 0.26954, 0.26736, 0.26536, 0.26349, 0.26172, 0.25999, 0.25824, 0.25641, 0.25448, 0.25246, 0.25038, 0.24822, 0.24599, 0.24377, 0.24166, 0.23976, 0.23801, 0.23624, 0.23437, 0.23233, 0.23016, 0.22795, 0.22586, 0.2239, 0.22203, 0.22019, 0.21838, 0.2166, 0.21493, 0.21346, 0.21214, 0.21089, 0.20964, 0.20836, 0.20699, 0.20554, 0.20399, 0.20245, 0.20101, 0.19972, 0.19852, 0.19738, 0.19627, 0.19513, 0.1939, 0.19254, 0.19103, 0.18933, 0.18751, 0.18571, 0.18413, 0.18273, 0.18141, 0.18016, 0.179, 0.17797, 0.1771, 0.1764, 0.17582, 0.17527, 0.17473, 0.17423, 0.17383, 0.17352, 0.17325, 0.17299, 0.17268, 0.17233, 0.17197, 0.1717, 0.17156, 0.17154, 0.17152, 0.17137, 0.171, 0.1704, 0.1697, 0.1691, 0.16877, 0.16869, 0.16876, 0.16886, 0.16889, 0.1688, 0.16862, 0.16844, 0.16838, 0.16849, 0.16872, 0.16902, 0.16943, 0.16992, 0.17037, 0.17073, 0.17106, 0.17144, 0.17195, 0.17261, 0.1734, 0.17427, 0.17515, 0.1761, 0.17714, 0.17819, 0.17916, 0.18, 0.18081, 0.18159, 0.18235, 0.18311, 0.18395, 0.18498, 0.18616, 0.18731, 0.18839, 0.18949, 0.19064, 0.19187, 0.19312, 0.19442, 0.19588, 0.1975, 0.19923, 0.20106, 0.20296, 0.20485, 0.20665, 0.20823, 0.20962, 0.2109, 0.21215, 0.2134, 0.21471, 0.21618, 0.2179, 0.21986, 0.22201, 0.22428, 0.22662, 0.22897, 0.23128, 0.23348, 0.23561, 0.23779, 0.23996, 0.24212, 0.24423, 0.24632, 0.24841, 0.25049, 0.25254, 0.2546, 0.25673, 0.25893, 0.2611, 0.26317, 0.2652, 0.2673, 0.26952, 0.27184, 0.27424, 0.27671, 0.2793, 0.282, 0.28476, 0.28755, 0.29028, 0.29292, 0.29548, 0.29809, 0.30078, 0.30349, 0.30621, 0.30896, 0.31181, 0.31474, 0.3176, 0.3204, 0.32318, 0.32593, 0.32865, 0.33138, 0.33409, 0.33674, 0.33928, 0.34167, 0.34391, 0.34603, 0.34815, 0.35036, 0.35278, 0.35543, 0.35824, 0.36111, 0.3639, 0.36655, 0.36912, 0.37176, 0.37449, 0.37726, 0.38003, 0.38273, 0.38528, 0.38762, 0.38988, 0.39214, 0.3945, 0.39706, 0.39988, 0.40293, 0.40613, 0.40931, 0.41244, 0.41554, 0.41858, 0.4215, 0.42424, 0.42679, 0.42919, 0.43141, 0.43345, 0.43535, 0.43723, 0.43928, 0.44167, 0.44426, 0.44689, 0.4495, 0.45207, 0.45457, 0.45691, 0.45905, 0.461, 0.46276, 0.46441, 0.46611, 0.46802, 0.47021, 0.4726, 0.47512, 0.47753, 0.4797, 0.48163, 0.48335, 0.48493, 0.48644, 0.48795, 0.4894, 0.49077, 0.49212, 0.49358, 0.49527, 0.4973, 0.49967, 0.50216, 0.50448, 0.50646, 0.5081, 0.50949, 0.51077, 0.51218, 0.51372, 0.51526, 0.51675, 0.51809, 0.51926, 0.52035, 0.52159, 0.52308, 0.52485, 0.52683, 0.5288, 0.53063, 0.53226, 0.53368, 0.53496, 0.53618, 0.53739, 0.53864, 0.53996, 0.54132, 0.5426, 0.54371, 0.5446, 0.54525, 0.54559, 0.54572, 0.54587, 0.54631, 0.54704, 0.54794, 0.54893, 0.54993, 0.55087, 0.55164, 0.55218, 0.55258, 0.55296, 0.55354, 0.55444, 0.55563, 0.5569, 0.55787, 0.55843, 0.55862, 0.55858, 0.55843, 0.55821, 0.55789, 0.55768, 0.55766, 0.55781, 0.55799, 0.55807, 0.55802, 0.55781, 0.55749, 0.55708, 0.55664, 0.55629, 0.55605, 0.55589, 0.55578, 0.55571, 0.55551, 0.55505, 0.55433, 0.55344, 0.55243, 0.55131, 0.5501, 0.5488, 0.54742, 0.54598, 0.54449, 0.543, 0.54156, 0.54012, 0.53862, 0.53706, 0.53551, 0.53402, 0.53255, 0.53105, 0.52949, 0.52784, 0.52614, 0.52448, 0.52289, 0.52136, 0.5198, 0.51807, 0.51612, 0.51392, 0.51149, 0.50898, 0.50652, 0.50413, 0.50181, 0.49947, 0.49704, 0.49451, 0.49184, 0.48904, 0.48615, 0.48324, 0.4803, 0.47721, 0.47399, 0.47075, 0.46762, 0.46473, 0.46206, 0.45928, 0.45634, 0.45336, 0.45036, 0.44727, 0.44405, 0.44076, 0.4375, 0.43429, 0.43112, 0.42791, 0.42457, 0.42104, 0.41742, 0.41381, 0.41029, 0.40683, 0.40336, 0.39974, 0.39598, 0.39223, 0.38848, 0.38464, 0.38068, 0.37659, 0.37238, 0.36818, 0.36409, 0.36011, 0.35616, 0.3522, 0.34829, 0.34447, 0.34079, 0.3372, 0.33365, 0.33006, 0.32636, 0.32257, 0.31876, 0.31497, 0.31116, 0.30731, 0.30341, 0.29949, 0.29554, 0.29159, 0.28768, 0.28381, 0.28002, 0.27628, 0.27249, 0.2686, 0.26466, 0.26073, 0.25682, 0.25288, 0.24893, 0.24506, 0.24132, 0.23769, 0.23412, 0.23054, 0.22695, 0.22336, 0.21978, 0.2163, 0.21295, 0.20966, 0.20647, 0.20343, 0.20052, 0.1977, 0.19492, 0.19211, 0.18923, 0.18637, 0.18347, 0.18049, 0.17756, 0.17477, 0.17214, 0.16957, 0.16698, 0.16438, 0.16183, 0.15941, 0.15716, 0.15508, 0.15309, 0.15109, 0.14887, 0.14639, 0.14376, 0.141, 0.13813, 0.13531, 0.13288, 0.13088, 0.12914, 0.12741, 0.12559, 0.12365, 0.12168, 0.11982, 0.11808, 0.11649, 0.11494, 0.11343, 0.11204, 0.11082, 0.10986, 0.10899, 0.10806, 0.10704, 0.10601, 0.10502, 0.10406, 0.10308, 0.10196, 0.10066, 0.09922, 0.09764, 0.09596, 0.0943, 0.09276, 0.09149, 0.09061, 0.09004, 0.08945, 0.08865, 0.08772, 0.08683, 0.08612, 0.08571, 0.08556, 0.08546, 0.0852, 0.0847, 0.08405, 0.08334, 0.08269, 0.08231, 0.08227, 0.08246, 0.08274, 0.08308, 0.08344, 0.0838, 0.08414, 0.08445, 0.08477, 0.08514, 0.08551, 0.08581, 0.0861, 0.08643, 0.08682, 0.08735, 0.08815, 0.08931, 0.09067, 0.09211, 0.09353, 0.09487, 0.09603, 0.097, 0.098, 0.09915, 0.1005, 0.10204, 0.10369, 0.1054, 0.10715, 0.1089, 0.1106, 0.11221, 0.11383, 0.1156, 0.11754, 0.11958, 0.12162, 0.1236, 0.12554, 0.12747, 0.12946, 0.13156, 0.13389, 0.13656, 0.1395, 0.14259, 0.14575, 0.14889, 0.15193, 0.15482, 0.15768, 0.16068, 0.16393, 0.1674, 0.17097, 0.17446, 0.17776, 0.18082, 0.18365, 0.18637, 0.18909, 0.19189, 0.19475, 0.19768, 0.20079, 0.20408, 0.20745, 0.21069, 0.21359, 0.21619, 0.21865, 0.22134, 0.22435, 0.22749, 0.2305, 0.23322, 0.23576, 0.23845, 0.24159, 0.24521, 0.24909, 0.25291, 0.25645, 0.2598, 0.26319, 0.26677, 0.27047, 0.27431, 0.2782, 0.28192, 0.28538, 0.28874, 0.2922, 0.29584, 0.2996, 0.3034, 0.30721, 0.31096, 0.31459, 0.31804, 0.32119, 0.324, 0.3267, 0.32949, 0.33252, 0.33591, 0.33976, 0.34407, 0.34863, 0.35314, 0.35739, 0.36124, 0.36471, 0.368, 0.37137, 0.37508, 0.37913, 0.38326, 0.38725, 0.39109, 0.39489, 0.39874, 0.40273, 0.40684, 0.41101, 0.41518, 0.41936, 0.4234, 0.42723, 0.43089, 0.43439, 0.4378, 0.44118, 0.44457, 0.44808, 0.45156, 0.45497, 0.45841, 0.46199, 0.46597, 0.47029, 0.47454, 0.47842, 0.48176, 0.48462, 0.48727, 0.48993, 0.49276, 0.49569, 0.49867, 0.50162, 0.50456, 0.50754, 0.51052, 0.51331, 0.51566, 0.5176, 0.51934, 0.52108, 0.52298, 0.52521, 0.52783, 0.53072, 0.53367, 0.53653, 0.53925, 0.54185, 0.54439, 0.54691, 0.54937, 0.55171, 0.55392, 0.55604, 0.55808, 0.56, 0.56174, 0.56322, 0.56456, 0.56598, 0.56771, 0.56986, 0.57225, 0.57456, 0.57651, 0.57812, 0.57953, 0.58085, 0.58212, 0.58337, 0.58461, 0.58587, 0.58704, 0.58811, 0.58914, 0.59017, 0.59112, 0.59193, 0.59264, 0.59323, 0.5937, 0.59415, 0.59457, 0.59493, 0.59518, 0.59528, 0.59533, 0.59549, 0.59572, 0.59598, 0.59626, 0.59656, 0.59673, 0.59666, 0.5963, 0.59562, 0.59471, 0.59364, 0.59247, 0.59134, 0.5903, 0.58921, 0.58798, 0.58658, 0.5851, 0.58359, 0.58202, 0.58044, 0.57886, 0.57712, 0.57525, 0.57335, 0.57142, 0.56949, 0.56769, 0.56619, 0.56497, 0.56377, 0.56233, 0.56044, 0.55804, 0.55535, 0.55261, 0.54993, 0.54727, 0.54457, 0.54182, 0.53907, 0.53635, 0.53375, 0.53131, 0.52901, 0.52673, 0.52433, 0.52172, 0.51889, 0.51591, 0.51286, 0.50973, 0.50658, 0.50355, 0.50072, 0.49795, 0.49514, 0.49228, 0.48939, 0.48651, 0.48369, 0.48091, 0.47806, 0.47508, 0.47213, 0.46931, 0.46656, 0.46374, 0.46071, 0.4574, 0.45379, 0.44992, 0.44588, 0.44179, 0.43772, 0.43386, 0.43022, 0.42665, 0.4231, 0.41956, 0.41603, 0.41252, 0.40904, 0.40552, 0.40193, 0.39829, 0.39468, 0.39113, 0.38761, 0.38413, 0.38068, 0.37721, 0.3736, 0.36974, 0.36568, 0.36146, 0.35706, 0.3525, 0.34794, 0.34346, 0.33906, 0.33476, 0.33054, 0.32639, 0.32232, 0.31829, 0.31439, 0.31058, 0.30683, 0.3032, 0.29964, 0.29599, 0.29216, 0.2881, 0.28384, 0.27952, 0.27531, 0.27122, 0.26732, 0.26381, 0.26057, 0.25734, 0.25392, 0.25026, 0.24649, 0.24267, 0.23888, 0.23523, 0.2317, 0.22816, 0.22451, 0.22067, 0.21677, 0.21311, 0.20968, 0.20645, 0.20346, 0.20065, 0.19788, 0.19499, 0.19194, 0.18885, 0.18581, 0.18287, 0.18005, 0.17735, 0.1747, 0.17205, 0.16947, 0.16696, 0.16442, 0.1617, 0.15883, 0.15583, 0.15278, 0.14974, 0.1468, 0.14396, 0.14117, 0.13832, 0.13528, 0.13227, 0.12949, 0.12701, 0.12484, 0.12296, 0.12119, 0.1194, 0.11747, 0.11561, 0.11397, 0.11256, 0.11122, 0.10988, 0.10839, 0.10665, 0.10482, 0.10312, 0.10166, 0.10046, 0.09953, 0.09875, 0.09795, 0.09703, 0.09607, 0.09529, 0.09472, 0.09426, 0.09379, 0.09322, 0.09254, 0.09179, 0.09109, 0.09053, 0.09001, 0.08939, 0.08862, 0.08775, 0.08685, 0.08602, 0.0854, 0.0851, 0.0851, 0.08538, 0.08589, 0.08653, 0.08722, 0.08791, 0.08864, 0.08933, 0.08996, 0.09053, 0.09106, 0.09155, 0.092, 0.09238, 0.09272, 0.09307, 0.09352, 0.09411, 0.09474, 0.09531, 0.09594, 0.09682, 0.09803, 0.09948, 0.10099, 0.10237, 0.10358, 0.10474, 0.10592, 0.1071, 0.10829, 0.10955, 0.11094, 0.11253, 0.11442, 0.11649, 0.11856, 0.12063, 0.1227, 0.12477, 0.12679, 0.12875, 0.13057, 0.1323, 0.13401, 0.13578, 0.13762, 0.13951, 0.14145, 0.14351, 0.14563, 0.14777, 0.1499, 0.1521, 0.15445, 0.15686, 0.15928, 0.1618, 0.16445, 0.16722, 0.17002, 0.17277, 0.17546, 0.17818, 0.18096, 0.18372, 0.18635, 0.18881, 0.19114, 0.19341, 0.19572, 0.19816, 0.20082, 0.2039, 0.20711, 0.21047, 0.21379, 0.21702, 0.22021, 0.2234, 0.22662, 0.22988, 0.23315, 0.23646, 0.23974, 0.24292, 0.24602, 0.24907, 0.25215, 0.25533, 0.25865, 0.26218, 0.26606, 0.27017, 0.27419, 0.27795, 0.28153, 0.28513, 0.2888, 0.29251, 0.29622, 0.29997, 0.30382, 0.30776, 0.31171, 0.3156, 0.31941, 0.32309, 0.32657, 0.32993, 0.33329, 0.33697, 0.34081, 0.34459, 0.34821, 0.3517, 0.35514, 0.35864, 0.36224, 0.36599, 0.36986, 0.37375, 0.3775, 0.38101, 0.38425, 0.38737, 0.39051, 0.39374, 0.39709, 0.40058, 0.40418, 0.40777, 0.41113, 0.41432, 0.41748, 0.42063, 0.42371, 0.4266, 0.42928, 0.43184, 0.43438, 0.43703, 0.43991, 0.44305, 0.44635, 0.44959, 0.45259, 0.45548, 0.45839, 0.46135, 0.46421, 0.46689, 0.46935, 0.47163, 0.47379, 0.47595, 0.47823, 0.48071, 0.48336, 0.48603, 0.48856, 0.49089, 0.49315, 0.49542, 0.49765, 0.49982, 0.50191, 0.50396, 0.50597, 0.50793, 0.50986, 0.51171, 0.51348, 0.51518, 0.51668, 0.51791, 0.51889, 0.51959, 0.52006, 0.52052, 0.52126, 0.52247, 0.52407, 0.52573, 0.52713, 0.52817, 0.529, 0.52976, 0.53058, 0.53141, 0.53217, 0.53279, 0.53327, 0.53371, 0.53414, 0.53459, 0.53502, 0.53536, 0.53566, 0.53605, 0.53659, 0.53708, 0.53731, 0.53724, 0.53694, 0.53646, 0.53586, 0.53523, 0.53465, 0.53422, 0.53376, 0.53314, 0.53238, 0.53159, 0.53087, 0.53019, 0.52949, 0.52875, 0.52791, 0.52696, 0.5259, 0.5248, 0.52376, 0.5228, 0.52194, 0.52103, 0.51998, 0.51878, 0.51744, 0.51609, 0.51477, 0.51347, 0.51217, 0.51086, 0.50952, 0.50816, 0.50682, 0.50548, 0.50403, 0.50236, 0.50047, 0.49844, 0.49642, 0.49448, 0.49243, 0.49024, 0.48805, 0.48592, 0.48383, 0.48169, 0.47947, 0.47714, 0.47474, 0.47243, 0.47032, 0.46846, 0.46681, 0.4652, 0.46348, 0.46168, 0.45985, 0.45802, 0.45624, 0.45447, 0.45263, 0.4507, 0.44858, 0.44622, 0.44368, 0.44111, 0.43863, 0.43612, 0.43342, 0.43076, 0.42838, 0.42622, 0.42408, 0.42175, 0.41922, 0.41672, 0.41429, 0.41187, 0.40944, 0.40693, 0.40428, 0.40143, 0.39824, 0.39486, 0.39151, 0.38831, 0.38529, 0.3824, 0.37951, 0.37649, 0.37338, 0.3703, 0.36738, 0.36469, 0.36221, 0.35983, 0.3575, 0.35514, 0.35265, 0.35004, 0.34741, 0.34482, 0.34221, 0.33951, 0.33668, 0.33376, 0.33078, 0.32788, 0.32514, 0.32255, 0.31997, 0.31734, 0.31462, 0.31176, 0.30876, 0.30563, 0.30236, 0.29895, 0.29561, 0.2925, 0.2897, 0.28723, 0.28497, 0.28276, 0.28048, 0.27818, 0.27589, 0.27356, 0.27117, 0.26872, 0.26621, 0.26373, 0.26134, 0.25909, 0.25693, 0.25484, 0.25273, 0.25049, 0.24803, 0.24538, 0.24256, 0.23969, 0.23694, 0.23441, 0.23216, 0.23021, 0.22845, 0.22675, 0.22502, 0.22318, 0.22121, 0.21922, 0.21732, 0.21554, 0.21379, 0.21204, 0.21026, 0.20847, 0.20675, 0.20513, 0.20359, 0.20201, 0.20025, 0.19825, 0.1961, 0.19407, 0.19236, 0.19115, 0.19023, 0.1893, 0.18818, 0.18678, 0.18507, 0.18331, 0.18163, 0.18009, 0.17874, 0.17758, 0.17659, 0.17569, 0.17478, 0.17392, 0.17321, 0.17265, 0.1722, 0.17176, 0.17125, 0.17061, 0.16989, 0.16921, 0.16868, 0.16831, 0.16808, 0.16794, 0.16778, 0.16763, 0.16759, 0.16768, 0.16791, 0.16815, 0.1682, 0.16791, 0.16748, 0.16707, 0.16678, 0.1667, 0.1669, 0.16733, 0.16789, 0.16845, 0.16898, 0.16953, 0.17019, 0.171, 0.17186, 0.17258, 0.17328, 0.17404, 0.17473, 0.17525, 0.1755, 0.17557, 0.17578, 0.1762, 0.17676, 0.17754, 0.1786, 0.17991, 0.18137, 0.1828, 0.18408, 0.18519, 0.18613, 0.18697, 0.1878, 0.1886, 0.18945, 0.19045, 0.19177, 0.19337, 0.19513, 0.1969, 0.19864, 0.20053, 0.20249, 0.20448, 0.20655, 0.20868, 0.21077, 0.21277, 0.2147, 0.21682, 0.21902, 0.22112, 0.22298, 0.22465, 0.22625, 0.22786, 0.22955, 0.23128, 0.23284, 0.23422, 0.23561, 0.23724, 0.23904, 0.24099, 0.24308, 0.24531, 0.24761, 0.24991, 0.25227, 0.25472, 0.25713, 0.25942, 0.26158, 0.26368, 0.26591, 0.26838, 0.271, 0.27382, 0.27677, 0.2797, 0.28248, 0.28514, 0.28776, 0.29038, 0.29307, 0.29591, 0.29877, 0.30154, 0.30427, 0.30704, 0.30993, 0.3127, 0.31512, 0.31726, 0.31935, 0.32159, 0.32395, 0.32621, 0.32831, 0.33031, 0.33231, 0.33442, 0.33668, 0.33908, 0.34139, 0.34353, 0.34557, 0.34758, 0.34964, 0.35176, 0.35391, 0.356, 0.35798, 0.35983, 0.3616, 0.36336, 0.36519, 0.36717, 0.36934, 0.37187, 0.37462, 0.37739, 0.38002, 0.38246, 0.38466, 0.38653, 0.38815, 0.38981, 0.39169, 0.39374, 0.39579, 0.39771, 0.39942, 0.40101, 0.40257, 0.40415, 0.40575, 0.40735, 0.40897, 0.41058, 0.41209, 0.41347, 0.41474, 0.416, 0.41734, 0.41881, 0.4205, 0.42216, 0.42366, 0.42502, 0.42631, 0.42764, 0.42911, 0.43067, 0.43212, 0.43339, 0.43458, 0.43582, 0.43725, 0.43886, 0.44051, 0.44216, 0.44384, 0.44555, 0.44722, 0.44874, 0.45008, 0.45134, 0.45273, 0.45432, 0.456, 0.45763, 0.45917, 0.46056, 0.46167, 0.46255, 0.46334, 0.46417, 0.46503, 0.4659, 0.46678, 0.46763, 0.4684, 0.46913, 0.46996, 0.47097, 0.47212, 0.47334, 0.47453, 0.47558, 0.47646, 0.4771, 0.47752, 0.47786, 0.47822, 0.47855, 0.47873, 0.4787, 0.47856, 0.47852, 0.4786, 0.47871, 0.47866, 0.47854, 0.4784, 0.47812, 0.47774, 0.47745, 0.47734, 0.47734, 0.47731, 0.47709, 0.47678, 0.47658, 0.47658, 0.47665, 0.47658, 0.47647, 0.47643, 0.47639, 0.47619, 0.47573, 0.4749, 0.47372, 0.47241, 0.47121, 0.47018, 0.46928, 0.46855, 0.46797, 0.46736, 0.46675, 0.46621, 0.46576, 0.4654, 0.46511, 0.46485, 0.46445, 0.46376, 0.46263, 0.46118, 0.45966, 0.45816, 0.45671, 0.45527, 0.45393, 0.45269, 0.45134, 0.44977, 0.4481, 0.44655, 0.44521, 0.444, 0.44269, 0.4413, 0.43978, 0.43806, 0.43612, 0.43405, 0.43214, 0.43069, 0.42964, 0.42869, 0.42758, 0.42617, 0.42466, 0.42332, 0.42217, 0.42108, 0.41991, 0.41857, 0.41699, 0.41509, 0.41307, 0.41121, 0.40956, 0.40801, 0.40637, 0.40465, 0.40292, 0.40132, 0.39982, 0.3984, 0.39697, 0.39552, 0.39404, 0.39237, 0.39051, 0.38836, 0.38601, 0.38361, 0.38126, 0.37901, 0.37692, 0.37489, 0.37284, 0.37079, 0.36874, 0.36673, 0.36481, 0.36288, 0.36097, 0.35908, 0.35712, 0.35507, 0.35308, 0.35119, 0.34926, 0.34721, 0.34504, 0.34289, 0.34095, 0.33927, 0.33773, 0.33631, 0.33519, 0.33432, 0.33349, 0.33255, 0.33143, 0.32994, 0.32806, 0.326, 0.32398, 0.32207, 0.32026, 0.31861, 0.31719, 0.31591, 0.31466, 0.31359, 0.31271, 0.31171, 0.31027, 0.30852, 0.30688, 0.30539, 0.30397, 0.30261, 0.30136, 0.30016, 0.2989, 0.29746, 0.29573, 0.29375, 0.29187, 0.29029, 0.28898, 0.28792, 0.2872, 0.28672, 0.28635, 0.28587, 0.28504, 0.28374, 0.28206, 0.28016, 0.27816, 0.27624, 0.27453, 0.27299, 0.27158, 0.27019, 0.26886, 0.26766, 0.26659, 0.26553, 0.26443, 0.26334, 0.26241, 0.26157, 0.2607, 0.25974, 0.2587, 0.25751, 0.25617, 0.25483, 0.25361, 0.25274, 0.25239, 0.25241, 0.25244, 0.25236, 0.2521, 0.25139, 0.2504, 0.24939, 0.24841, 0.2476, 0.24713, 0.24698, 0.24688, 0.2466, 0.2461, 0.24563, 0.2453, 0.24508, 0.24484, 0.24448, 0.24395, 0.24327, 0.24255, 0.24198, 0.24166, 0.24164, 0.24186, 0.24219, 0.24252, 0.24272, 0.24273, 0.24255, 0.24218, 0.24178, 0.24141, 0.24103, 0.2406, 0.24015, 0.23972, 0.23931, 0.2391, 0.23922, 0.2396, 0.2401, 0.24064, 0.24113, 0.24147, 0.24158, 0.24158, 0.24153, 0.24131, 0.24108, 0.24107, 0.24119, 0.24113, 0.24083, 0.24038, 0.23996, 0.23971, 0.23972, 0.24, 0.24033, 0.24055, 0.2408, 0.24131, 0.24214, 0.24311, 0.24413, 0.24524, 0.24649, 0.24768, 0.24852, 0.24892, 0.24902, 0.24901, 0.24908, 0.24944, 0.25013, 0.25102, 0.25194, 0.25286, 0.25391, 0.25517, 0.25658, 0.2579, 0.25893, 0.25959, 0.25996, 0.26017, 0.26053, 0.26115, 0.26196, 0.26279, 0.26361, 0.26459, 0.2658, 0.26719, 0.26866, 0.27018, 0.27178, 0.27342, 0.27494, 0.27615, 0.27701, 0.27767, 0.27835, 0.2791, 0.27983, 0.2805, 0.28111, 0.28161, 0.28216, 0.28282, 0.28343, 0.284, 0.28463, 0.28542, 0.2863, 0.28733, 0.28863, 0.29018, 0.29166, 0.29284, 0.29366, 0.29413, 0.29453, 0.29508, 0.29583, 0.29679, 0.29785, 0.29874, 0.2994, 0.29993, 0.30048, 0.30117, 0.30204, 0.30295, 0.3038, 0.30462, 0.30552, 0.30651, 0.3075, 0.30834, 0.309, 0.30958, 0.31019, 0.31091, 0.31191, 0.31322, 0.3147, 0.31613, 0.31737, 0.31849, 0.31965, 0.32087, 0.32208, 0.32327, 0.32451, 0.32575, 0.32681, 0.32751, 0.32803, 0.32857, 0.32922, 0.33001, 0.33082, 0.33156, 0.3322, 0.33272, 0.33316, 0.33359, 0.33409, 0.33476, 0.33563, 0.3366, 0.33762, 0.33869, 0.33971, 0.34067, 0.34156, 0.34244, 0.34347, 0.34466, 0.34576, 0.34661, 0.34718, 0.34758, 0.34794, 0.34831, 0.34885, 0.34969, 0.3508, 0.35205, 0.35332, 0.35453, 0.35567, 0.35685, 0.35805, 0.35917, 0.36015, 0.36099, 0.36168, 0.36228, 0.36281, 0.36327, 0.36372, 0.36419, 0.36462, 0.36495, 0.36525, 0.36558, 0.36604, 0.3666, 0.36717, 0.36779, 0.36844, 0.36903, 0.36957, 0.37011, 0.37078, 0.37166, 0.3726, 0.37331, 0.37377, 0.37415, 0.3746, 0.37508, 0.37547, 0.37574, 0.37595, 0.376, 0.37593, 0.37596, 0.37626, 0.37679, 0.37748, 0.37827, 0.37915, 0.38006, 0.38092, 0.38165, 0.3822, 0.38261, 0.38275, 0.38265, 0.38261, 0.38275, 0.38288, 0.38291, 0.38287, 0.38279, 0.38274, 0.38269, 0.38255, 0.38243, 0.3825, 0.38274, 0.38298, 0.38313, 0.38323, 0.3834, 0.38365, 0.38379, 0.3837, 0.38348, 0.3833, 0.38317, 0.38298, 0.38262, 0.38212, 0.38161, 0.38107, 0.38058, 0.38021, 0.37978, 0.37908, 0.3782, 0.37732, 0.37663, 0.37643, 0.37678, 0.37748, 0.37812, 0.37839, 0.37842, 0.37839, 0.37847, 0.37865, 0.37879, 0.37879, 0.37859, 0.37819, 0.37775, 0.37738, 0.37707, 0.37689, 0.37691, 0.37718, 0.37768, 0.37834, 0.37894, 0.37932, 0.37944, 0.37936, 0.37916, 0.37907, 0.37928, 0.37971, 0.38016, 0.38051, 0.38082, 0.38118, 0.38164, 0.382, 0.38215, 0.38219, 0.38219, 0.38203, 0.38159, 0.38085, 0.37984, 0.37879, 0.37801, 0.37768, 0.37772, 0.37796, 0.37828, 0.37837, 0.37816, 0.37787, 0.37764, 0.37741, 0.37711, 0.37679, 0.37647, 0.37627, 0.37614, 0.37586, 0.37542, 0.37505, 0.3749, 0.3749, 0.37493, 0.37495, 0.37496, 0.37502, 0.37527, 0.37564, 0.37585, 0.37604, 0.3764, 0.37687, 0.37727, 0.37749, 0.37747, 0.37719, 0.37686, 0.37658, 0.37633, 0.37607, 0.37568, 0.37516, 0.37451, 0.37388, 0.3733, 0.37279, 0.3724, 0.37214, 0.37199, 0.37175, 0.37132, 0.37082, 0.37034, 0.36989, 0.36942, 0.36899, 0.36868, 0.36854, 0.36846, 0.36832, 0.36801, 0.36753, 0.36692, 0.36619, 0.36537, 0.36446, 0.36355, 0.36274, 0.36207, 0.36156, 0.36106, 0.36065, 0.36041, 0.36027, 0.36013, 0.35997, 0.35976, 0.35939, 0.35904, 0.35886, 0.35877, 0.35853, 0.35802, 0.35728, 0.35641, 0.35557, 0.35479, 0.35403, 0.35334, 0.35278, 0.35227, 0.35175, 0.3512, 0.35057, 0.34977, 0.34891, 0.34811, 0.34731, 0.34659, 0.34615, 0.34608, 0.3463, 0.34668, 0.347, 0.34708, 0.34688, 0.34643, 0.34586, 0.34519, 0.34443, 0.34381, 0.34354, 0.34355, 0.34375, 0.34402, 0.34424, 0.34432, 0.34421, 0.34388, 0.34333, 0.34263, 0.34187, 0.34109, 0.3404, 0.33986, 0.33948, 0.33915, 0.33885, 0.33851, 0.33808, 0.33767, 0.33729, 0.33682, 0.33614, 0.3352, 0.33414, 0.33308, 0.33203, 0.33106, 0.33032, 0.32985, 0.32975, 0.32979, 0.32984, 0.32976, 0.32936, 0.32865, 0.32793, 0.32732, 0.32681, 0.32636, 0.32584, 0.32498, 0.32368, 0.32256, 0.32174, 0.321, 0.32026, 0.31953, 0.31886, 0.31822, 0.31751, 0.31666, 0.31568, 0.31466, 0.3137, 0.31282, 0.31205, 0.31126, 0.31033, 0.3091, 0.30766, 0.30628, 0.30505, 0.30382, 0.30266, 0.30152, 0.30045, 0.29932, 0.29783, 0.29616, 0.2945, 0.29274, 0.29096, 0.28934, 0.28807, 0.28685, 0.28551, 0.28418, 0.28301, 0.28172, 0.28023, 0.2788, 0.27757, 0.27651, 0.27563, 0.27487, 0.2741, 0.27342, 0.27286, 0.27227, 0.27155, 0.27057, 0.26939, 0.26826, 0.26716, 0.26603, 0.26502, 0.26413, 0.26313, 0.26182, 0.26044, 0.25926, 0.2582, 0.25716, 0.25633, 0.25573, 0.25523, 0.2547, 0.25409, 0.25335, 0.25255, 0.25188, 0.25131, 0.25086, 0.25041, 0.24984, 0.24923, 0.24871, 0.2483, 0.24796, 0.24767, 0.24727, 0.24658, 0.24582, 0.24523, 0.24472, 0.24438, 0.24429, 0.24433, 0.24432, 0.24419, 0.244, 0.24381, 0.24354, 0.24321, 0.24296, 0.24289, 0.24283, 0.24265, 0.24235, 0.24202, 0.24188, 0.24197, 0.24207, 0.24208, 0.24215, 0.24223, 0.24223, 0.24206, 0.24171, 0.24123, 0.24068, 0.24023, 0.2399, 0.23974, 0.2398, 0.23989, 0.23996, 0.24011, 0.24058, 0.24136, 0.24229, 0.24318, 0.24368, 0.24371, 0.24359, 0.24357, 0.24371, 0.2441, 0.24475, 0.24565, 0.24648, 0.24714, 0.24781, 0.24849, 0.24914, 0.24963, 0.2501, 0.25048, 0.25074, 0.25118, 0.25202, 0.25325, 0.25482, 0.25656, 0.25812, 0.25938, 0.26041, 0.26126, 0.26201, 0.2628, 0.26368, 0.2646, 0.26564, 0.26698, 0.26854, 0.27013, 0.27183, 0.27359, 0.27513, 0.27663, 0.27852, 0.28072, 0.28277, 0.28447, 0.28611, 0.28779, 0.28951, 0.29142, 0.29362, 0.29589, 0.29794, 0.29959, 0.30083, 0.30199, 0.30352, 0.3054, 0.30715, 0.30861, 0.31003, 0.31167, 0.31361, 0.31582, 0.31816, 0.32038, 0.32244, 0.32432, 0.3261, 0.32794, 0.32984, 0.3317, 0.33357, 0.33538, 0.33715, 0.33891, 0.34064, 0.34232, 0.34398, 0.34562, 0.34737, 0.34926, 0.35116, 0.3528, 0.35419, 0.35554, 0.35722, 0.35925, 0.36142, 0.36365, 0.3659, 0.36802, 0.36991, 0.3718, 0.37401, 0.3765, 0.3791, 0.38171, 0.38428, 0.38673, 0.38893, 0.3909, 0.39282, 0.39472, 0.3965, 0.39819, 0.39996, 0.40188, 0.40374, 0.40536, 0.4068, 0.40814, 0.40947, 0.41084, 0.41231, 0.4141, 0.41613, 0.41822, 0.42023, 0.42203, 0.42362, 0.42512, 0.4265, 0.42794, 0.4293, 0.43037, 0.43133, 0.43259, 0.43428, 0.4361, 0.43799, 0.43984, 0.44165, 0.44339, 0.44499, 0.4464, 0.44738, 0.44812, 0.44882, 0.44956, 0.45053, 0.45178, 0.45319, 0.45471, 0.45626, 0.45773, 0.459, 0.45998, 0.46092, 0.46213, 0.46342, 0.46475, 0.46605, 0.46727, 0.46839, 0.46956, 0.47089, 0.47236, 0.47409, 0.47591, 0.47754, 0.47895, 0.48018, 0.48124, 0.48219, 0.48289, 0.48342, 0.48403, 0.48475, 0.4853, 0.48557, 0.48562, 0.48559, 0.48556, 0.4856, 0.48571, 0.48592, 0.48629, 0.48657, 0.48685, 0.48723, 0.4876, 0.48801, 0.48858, 0.48905, 0.48924, 0.48965, 0.49022, 0.49069, 0.49103, 0.49124, 0.49131, 0.49127, 0.49097, 0.49045, 0.48988, 0.48941, 0.48901, 0.4884, 0.48751, 0.48688, 0.48664, 0.48642, 0.48587, 0.48498, 0.48411, 0.48346, 0.48295, 0.48223, 0.48133, 0.48041, 0.47945, 0.47877, 0.47824, 0.47777, 0.47711, 0.47631, 0.47559, 0.47487, 0.47388, 0.47257, 0.47122, 0.46976, 0.46818, 0.46643, 0.46449, 0.46271, 0.46147, 0.46027, 0.4587, 0.45673, 0.45461, 0.45247, 0.45025, 0.44799, 0.4459, 0.44422, 0.44271, 0.44094, 0.43879, 0.43651, 0.43372, 0.43091, 0.42808, 0.42535, 0.42275, 0.42032, 0.41818, 0.4158, 0.41328, 0.41054, 0.40756, 0.40465, 0.40194, 0.39934, 0.39679, 0.39421, 0.39149, 0.38864, 0.3857, 0.38265, 0.38014, 0.37746, 0.37495, 0.37262, 0.3702, 0.36757, 0.36485, 0.36186, 0.35855, 0.35543, 0.35249, 0.34963, 0.34668, 0.34373, 0.34092, 0.33799, 0.33504, 0.33202, 0.32897, 0.32588, 0.32277, 0.31993, 0.3172, 0.31412, 0.3109, 0.30777, 0.30458, 0.30134, 0.29838, 0.29566, 0.29295, 0.29023, 0.28745, 0.28434, 0.28098, 0.27781, 0.27484, 0.27192, 0.26899, 0.26587, 0.26253, 0.25923, 0.25609, 0.25288, 0.24981, 0.24674, 0.24369, 0.24079, 0.23803, 0.23556, 0.23283, 0.23002, 0.22707, 0.22397, 0.22091, 0.21815, 0.21565, 0.21369, 0.21152, 0.20886, 0.20597, 0.20333, 0.20089, 0.19879, 0.19649, 0.19424, 0.19175, 0.189, 0.18635, 0.18384, 0.1814, 0.17917, 0.17702, 0.17479, 0.17253, 0.17042, 0.16836, 0.1661, 0.1641, 0.16224, 0.16032, 0.15828, 0.15619, 0.15408, 0.15259, 0.15117, 0.15017, 0.14927, 0.14795, 0.14642, 0.14484, 0.14297, 0.14096, 0.13929, 0.13795, 0.13687, 0.13579, 0.13473, 0.13338, 0.13234, 0.13118, 0.13011, 0.1292, 0.12835, 0.1275, 0.12675, 0.12613, 0.1256, 0.12505, 0.12436, 0.12337, 0.12224, 0.12113, 0.12017, 0.11926, 0.11869, 0.11829, 0.11797, 0.11783, 0.11759, 0.11749, 0.11757, 0.11779, 0.11792, 0.11793, 0.11791, 0.11776, 0.11747, 0.11743, 0.11768, 0.11795, 0.11842, 0.11909, 0.11956, 0.12011, 0.12061, 0.12119, 0.12198, 0.12291, 0.12388, 0.12484, 0.12591, 0.12706, 0.12825, 0.12932, 0.1304, 0.1316, 0.13269, 0.13388, 0.13496, 0.136, 0.137, 0.13807, 0.13943, 0.14109, 0.14299, 0.14518, 0.14766, 0.15015, 0.15271, 0.15528, 0.15744, 0.15929, 0.16093, 0.16275, 0.16462, 0.16656, 0.16864, 0.17074, 0.17311, 0.17572, 0.17827, 0.18073, 0.18325, 0.18572, 0.18809, 0.19043, 0.19296, 0.19564, 0.19815, 0.20035, 0.20269, 0.2054, 0.20872, 0.21185, 0.21457, 0.21708, 0.21981, 0.22272, 0.22548, 0.22809, 0.23077, 0.23333, 0.236, 0.23875, 0.24173, 0.24499, 0.2486, 0.25201, 0.25553, 0.25909, 0.26271, 0.26659, 0.27069, 0.2748, 0.27875, 0.28254, 0.28657, 0.29046, 0.29411, 0.2978, 0.301, 0.30378, 0.30665, 0.3097, 0.3129, 0.31551, 0.31836, 0.32134, 0.32439, 0.32756, 0.33066, 0.33376, 0.33706, 0.34001, 0.34314, 0.34627, 0.34937, 0.3524, 0.35545, 0.35864, 0.36206, 0.36548, 0.36889, 0.37231, 0.3756, 0.37892, 0.38225, 0.38526, 0.3885, 0.39174, 0.39493, 0.39809, 0.40109, 0.40334, 0.40664, 0.40956, 0.41268, 0.41559, 0.41897, 0.42261, 0.42583, 0.4289, 0.43191, 0.43463, 0.43727, 0.43992, 0.44263, 0.44545, 0.448, 0.45104, 0.4541, 0.45741, 0.46079, 0.46396, 0.46709, 0.47039, 0.47365, 0.47661, 0.47994, 0.4831, 0.48609, 0.48909, 0.49187, 0.49458, 0.49724, 0.4999, 0.50262, 0.50533, 0.50773, 0.51004, 0.51233, 0.51451, 0.51665, 0.51862, 0.5205, 0.52242, 0.52418, 0.52587, 0.52772, 0.52934, 0.53084, 0.53248, 0.53427, 0.53599, 0.53748, 0.53874, 0.53974, 0.54045, 0.54094, 0.54132, 0.54182, 0.54305, 0.54442, 0.54588, 0.54711, 0.54803, 0.54885, 0.54951, 0.54993, 0.55058, 0.55141, 0.55211, 0.55275, 0.55333, 0.55383, 0.55432, 0.55475, 0.55501, 0.55514, 0.55512, 0.55498, 0.55481, 0.55467, 0.55449, 0.5541, 0.55354, 0.55304, 0.55263, 0.55258, 0.55243, 0.55212, 0.55199, 0.55193, 0.55177, 0.55139, 0.55088, 0.55008, 0.54931, 0.54901, 0.54854, 0.54783, 0.54698, 0.54577, 0.54421, 0.54261, 0.54143, 0.54067, 0.54015, 0.53966, 0.53899, 0.53814, 0.53725, 0.53622, 0.53514, 0.53398, 0.53285, 0.53154, 0.53019, 0.52872, 0.52719, 0.52546, 0.52358, 0.52199, 0.52031, 0.51864, 0.51692, 0.51527, 0.51365, 0.51198, 0.51009, 0.508, 0.50589, 0.50419, 0.50238, 0.5003, 0.49796, 0.49554, 0.49302, 0.49076, 0.48898, 0.48691, 0.48457, 0.48205, 0.4793, 0.47647, 0.47343, 0.47037, 0.46744, 0.46469, 0.46177, 0.45861, 0.45585, 0.4529, 0.44982, 0.44653, 0.44306, 0.43976, 0.43649, 0.43332, 0.43046, 0.42759, 0.42462, 0.42156, 0.4185, 0.4157, 0.41298, 0.41054, 0.40835, 0.40581, 0.40292, 0.39994, 0.39705, 0.39429, 0.39138, 0.38807, 0.38454, 0.38079, 0.377, 0.37331, 0.37004, 0.36704, 0.3643, 0.36174, 0.35918, 0.35652, 0.35361, 0.35042, 0.3476, 0.3451, 0.34245, 0.33989, 0.33704, 0.33384, 0.33105, 0.32836, 0.32579, 0.32317, 0.32048, 0.31774, 0.31492, 0.31191, 0.30883, 0.30558, 0.30227, 0.29887, 0.29536, 0.29191, 0.28865, 0.28559, 0.2825, 0.27939, 0.27625, 0.27305, 0.26988, 0.26687, 0.26386, 0.26089, 0.25822, 0.25585, 0.2534, 0.25077, 0.24822, 0.24564, 0.24298, 0.23989, 0.237, 0.23473, 0.2328, 0.23104, 0.22935, 0.22737, 0.22516, 0.2229, 0.22056, 0.21794, 0.21564, 0.2133, 0.21104, 0.20867, 0.20608, 0.20338, 0.20064, 0.1983, 0.19589, 0.19366, 0.19157, 0.1895, 0.18739, 0.18521, 0.18287, 0.18087, 0.17894, 0.17709, 0.17527, 0.17361, 0.17173, 0.17033, 0.16907, 0.16801, 0.16689, 0.1656, 0.16406, 0.16279, 0.1615, 0.16024, 0.15856, 0.15688, 0.15539, 0.15421, 0.15307, 0.15234, 0.15165, 0.15092, 0.15019, 0.14958, 0.14912, 0.14828, 0.14776, 0.14704, 0.14637, 0.1456, 0.14507, 0.14471, 0.14444, 0.14405, 0.1439, 0.14387, 0.14385, 0.1438, 0.14336, 0.1427, 0.14228, 0.14184, 0.14164, 0.1419, 0.14212, 0.14227, 0.14231, 0.14217, 0.14186, 0.1417, 0.14158, 0.14138, 0.14137, 0.14156, 0.14238, 0.14327, 0.1444, 0.14574, 0.14691, 0.14793, 0.14922, 0.15082, 0.15245, 0.15384, 0.1551, 0.1561, 0.15687, 0.15747, 0.15869, 0.16008, 0.16197, 0.16428, 0.16664, 0.16884, 0.17107, 0.17335, 0.17533, 0.17706, 0.17906, 0.18131, 0.18345, 0.18581, 0.18813, 0.19045, 0.19288, 0.19538, 0.1976, 0.19951, 0.20136, 0.20352, 0.20571, 0.20808, 0.21054, 0.21283, 0.21496, 0.21705, 0.21934, 0.22183, 0.22423, 0.22671, 0.22901, 0.23123, 0.23368, 0.23655, 0.23978, 0.24259, 0.245, 0.24724, 0.24958, 0.25231, 0.25529, 0.25842, 0.26149, 0.26426, 0.26699, 0.26985, 0.2726, 0.27552, 0.27814, 0.28059, 0.28339, 0.28614, 0.28881, 0.2915, 0.29429, 0.29705, 0.29967, 0.30233, 0.30478, 0.30726, 0.31027, 0.31369, 0.31778, 0.32156, 0.32467, 0.3276, 0.33064, 0.33369, 0.33659, 0.33951, 0.34234, 0.34485, 0.34744, 0.3504, 0.35328, 0.35604, 0.35851, 0.36099, 0.36368, 0.36654, 0.36954, 0.37257, 0.37567, 0.37891, 0.38153, 0.38421, 0.38707, 0.38996, 0.39282, 0.39587, 0.39976, 0.40372, 0.40686, 0.40979, 0.41269, 0.41564, 0.41851, 0.42141, 0.42423, 0.42708, 0.43008, 0.43303, 0.43577, 0.43879, 0.44194, 0.44488, 0.44774, 0.45096, 0.45426, 0.45719, 0.45987, 0.46254, 0.46503, 0.46771, 0.4705, 0.47308, 0.47545, 0.47762, 0.47944, 0.48141, 0.48361, 0.48588, 0.48791, 0.48972, 0.49183, 0.49388, 0.49605, 0.4982, 0.50038, 0.5026, 0.50454, 0.50637, 0.50822, 0.51005, 0.51177, 0.51363, 0.51565, 0.51768, 0.51988, 0.52191, 0.52341, 0.52521, 0.52683, 0.52814, 0.52946, 0.53078, 0.53209, 0.53342, 0.53455, 0.53567, 0.5367, 0.53772, 0.5388, 0.53989, 0.54077, 0.54117, 0.54141, 0.54173, 0.54218, 0.5428, 0.54379, 0.54471, 0.54575, 0.54664, 0.5473, 0.54785, 0.54805, 0.54808, 0.54802, 0.54802, 0.54805, 0.54812, 0.54823, 0.54826, 0.54795, 0.5474, 0.54689, 0.54637, 0.54579, 0.54528, 0.54506, 0.54495, 0.54473, 0.54458, 0.54428, 0.54382, 0.54319, 0.54269, 0.54227, 0.54188, 0.54126, 0.54065, 0.54008, 0.53951, 0.53878, 0.53776, 0.53612, 0.53436, 0.53282, 0.53139, 0.52992, 0.52841, 0.52689, 0.52541, 0.52412, 0.52282, 0.5214, 0.51993, 0.51841, 0.51682, 0.51491, 0.51288, 0.51084, 0.50873, 0.50641, 0.50407, 0.50182, 0.49962, 0.49742, 0.49502, 0.4923, 0.48934, 0.48661, 0.48409, 0.48174, 0.47971, 0.47752, 0.47506, 0.47257, 0.46981, 0.46681, 0.46391, 0.4613, 0.45907, 0.4569, 0.45451, 0.45229, 0.44998, 0.44752, 0.44495, 0.442, 0.43888, 0.43562, 0.43266, 0.42995, 0.42746, 0.42507, 0.42226, 0.41908, 0.41574, 0.4125, 0.40924, 0.40627, 0.40351, 0.4007, 0.39773, 0.39461, 0.39139, 0.38814, 0.38464, 0.38111, 0.37771, 0.37448, 0.37136, 0.36809, 0.36479, 0.36148, 0.35819, 0.35501, 0.35197, 0.34898, 0.34613, 0.34319, 0.34001, 0.33662, 0.33315, 0.32993, 0.32706, 0.32429, 0.32102, 0.31747, 0.31422, 0.3113, 0.30868, 0.30641, 0.30423, 0.30163, 0.29883, 0.29633, 0.29365, 0.29066, 0.28761, 0.28487, 0.28228, 0.27946, 0.27668, 0.27387, 0.27092, 0.26767, 0.26445, 0.26127, 0.25812, 0.25526, 0.25273, 0.25024, 0.24756, 0.24493, 0.24241, 0.24016, 0.23803, 0.236, 0.23396, 0.23177, 0.22945, 0.22719, 0.22522, 0.22355, 0.22183, 0.21976, 0.21723, 0.21436, 0.21142, 0.20846, 0.20592, 0.20367, 0.20132, 0.19871, 0.19632, 0.19398, 0.19159, 0.18931, 0.18733, 0.18567, 0.18399, 0.18218, 0.18058, 0.17928, 0.17859, 0.17799, 0.17706, 0.17581, 0.17441, 0.17318, 0.17206, 0.1708, 0.16935, 0.16803, 0.16687, 0.16568, 0.16467, 0.16398, 0.16369, 0.1633, 0.16273, 0.16221, 0.16173, 0.16121, 0.16048, 0.15972, 0.15906, 0.15876, 0.15855, 0.15835, 0.15791, 0.15741, 0.15709, 0.15665, 0.15613, 0.1557, 0.15532, 0.15498, 0.15472, 0.15474, 0.15494, 0.15497, 0.15466, 0.15435, 0.15404, 0.15387, 0.15405, 0.1545, 0.15505, 0.15568, 0.15641, 0.15712, 0.15755, 0.15787, 0.15813, 0.15855, 0.15923, 0.16028, 0.16159, 0.16283, 0.16397, 0.16528, 0.16655, 0.16746, 0.16846, 0.17023, 0.17198, 0.1734, 0.17471, 0.17612, 0.17766, 0.17942, 0.18129, 0.18317, 0.18484, 0.18615, 0.18727, 0.18836, 0.18924, 0.19007, 0.19089, 0.19224, 0.19383, 0.19556, 0.19728, 0.19931, 0.20114, 0.20281, 0.20469, 0.20647, 0.20827, 0.21024, 0.21258, 0.21504, 0.21727, 0.21976, 0.22224, 0.2245, 0.2266, 0.22886, 0.23122, 0.23365, 0.23606, 0.23812, 0.24011, 0.24233, 0.24443, 0.24661, 0.24908, 0.25175, 0.25428, 0.25644, 0.2583, 0.26028, 0.26232, 0.26426, 0.26645, 0.26869, 0.27087, 0.27304, 0.27508, 0.27732, 0.27979, 0.28219, 0.28493, 0.28809, 0.29147, 0.29509, 0.29859, 0.30196, 0.30541, 0.30859, 0.31172, 0.31487, 0.31797, 0.32085, 0.32358, 0.32626, 0.32886, 0.33121, 0.33354, 0.3364, 0.33951, 0.34275, 0.34602, 0.34937, 0.35255, 0.35542, 0.35823, 0.361, 0.36391, 0.36727, 0.37065, 0.374, 0.37745, 0.38054, 0.38305, 0.38537, 0.38751, 0.38931, 0.3911, 0.3931, 0.39543, 0.39821, 0.40129, 0.40447, 0.40764, 0.41073, 0.41373, 0.41665, 0.41947, 0.42177, 0.42411, 0.42646, 0.42902, 0.43188, 0.43471, 0.43735, 0.44023, 0.44259, 0.44438, 0.44584, 0.44706, 0.44842, 0.44972, 0.45125, 0.45257, 0.45383, 0.45527, 0.45685, 0.45857, 0.46013, 0.46172, 0.46329, 0.46464, 0.46591, 0.46742, 0.46915, 0.47094, 0.47242, 0.47398, 0.47564, 0.47718, 0.47851, 0.48014, 0.48177, 0.48325, 0.48469, 0.48614, 0.48749, 0.48875, 0.49019, 0.49178, 0.49358, 0.49556, 0.49722, 0.49859, 0.49989, 0.50119, 0.50229, 0.50342, 0.50497, 0.50629, 0.50731, 0.50817, 0.50927, 0.51036, 0.51113, 0.51187, 0.5126, 0.51331, 0.51397, 0.51462, 0.51497, 0.51542, 0.51636, 0.51723, 0.51803, 0.51896, 0.51957, 0.52011, 0.52056, 0.5209, 0.52104, 0.52098, 0.52078, 0.52043, 0.52004, 0.51979, 0.51946, 0.51927, 0.51931, 0.51933, 0.51896, 0.51852, 0.51782, 0.51716, 0.51648, 0.51592, 0.51556, 0.51542, 0.51532, 0.51517, 0.51497, 0.51446, 0.51395, 0.51352, 0.51312, 0.51311, 0.51346, 0.51379, 0.51392, 0.51374, 0.5133, 0.51261, 0.51196, 0.51139, 0.51061, 0.50956, 0.50819, 0.50663, 0.50522, 0.50397, 0.5027, 0.50152, 0.50027, 0.49898, 0.49761, 0.49599, 0.49423, 0.49227, 0.49005, 0.48762, 0.48515, 0.48295, 0.48109, 0.47919, 0.47739, 0.47553, 0.47339, 0.47107, 0.46876, 0.46642, 0.46409, 0.4617, 0.45937, 0.45712, 0.45477, 0.45228, 0.45018, 0.44834, 0.44677, 0.44506, 0.44307, 0.44101, 0.43885, 0.43665, 0.43419, 0.43185, 0.4294, 0.42689, 0.42441, 0.42204, 0.41954, 0.41707, 0.41458, 0.41235, 0.4102, 0.40786, 0.40539, 0.40288, 0.40011, 0.39727, 0.39497, 0.3928, 0.39073, 0.3888, 0.38672, 0.38472, 0.38278, 0.38096, 0.37911, 0.37705, 0.37481, 0.37265, 0.37039, 0.36811, 0.36596, 0.36381, 0.36163, 0.35944, 0.35737, 0.35505, 0.35233, 0.34963, 0.34706, 0.34484, 0.34294, 0.34125, 0.33924, 0.33683, 0.33452, 0.33214, 0.32953, 0.32686, 0.32455, 0.32227, 0.32004, 0.31795, 0.3158, 0.31357, 0.31133, 0.30918, 0.30694, 0.30453, 0.30217, 0.30006, 0.29808, 0.29603, 0.29375, 0.29147, 0.28896, 0.28665, 0.28466, 0.28269, 0.2806, 0.27875, 0.27696, 0.27481, 0.27279, 0.27084, 0.26883, 0.26669, 0.26454, 0.26249, 0.26065, 0.25904, 0.25759, 0.25605, 0.25426, 0.25232, 0.25033, 0.24877, 0.24754, 0.24668, 0.24568, 0.24407, 0.24253, 0.24097, 0.23947, 0.2382, 0.23707, 0.23601, 0.23488, 0.23356, 0.23193, 0.22995, 0.22829, 0.22701, 0.22586, 0.22466, 0.22339, 0.22223, 0.22118, 0.21999, 0.21875, 0.21757, 0.21659, 0.21597, 0.21533, 0.21431, 0.21344, 0.21263, 0.21171, 0.21078, 0.20994, 0.20939, 0.2091, 0.2091, 0.20892, 0.20873, 0.20872, 0.20799, 0.20708, 0.20633, 0.20606, 0.20605, 0.20601, 0.20573, 0.20507, 0.20455, 0.20379, 0.20342, 0.20331, 0.2034, 0.20356, 0.20336, 0.20319, 0.20333, 0.20395, 0.20474, 0.20546, 0.20604, 0.20631, 0.20644, 0.20682, 0.20774, 0.20882, 0.21005, 0.21153, 0.21306, 0.21433, 0.21512, 0.21604, 0.21673, 0.21728, 0.21799, 0.21883, 0.21968, 0.22059, 0.22143, 0.22216, 0.22274, 0.22339, 0.22359, 0.2238, 0.22421, 0.22498, 0.22598, 0.22706, 0.22844, 0.23031, 0.23193, 0.23325, 0.2347, 0.23639, 0.23804, 0.23943, 0.2404, 0.24149, 0.24272, 0.2441, 0.24511, 0.24577, 0.2462, 0.24676, 0.24821, 0.25032, 0.2524, 0.25407, 0.25548, 0.25697, 0.25875, 0.26056, 0.26251, 0.2649, 0.26735, 0.26964, 0.27191, 0.27423, 0.27647, 0.27872, 0.28104, 0.28331, 0.28529, 0.28701, 0.2887, 0.29055, 0.29253, 0.29493, 0.29763, 0.30011, 0.30218, 0.3041, 0.306, 0.30784, 0.30977, 0.31158, 0.31319, 0.31478, 0.31624, 0.31762, 0.31899, 0.32036, 0.32188, 0.32356, 0.32513, 0.3265, 0.32787, 0.3293, 0.33075, 0.33235, 0.33403, 0.33568, 0.33742, 0.33938, 0.34163, 0.34378, 0.3459, 0.34801, 0.34979, 0.35115, 0.35272, 0.35459, 0.35653, 0.35831, 0.35986, 0.36123, 0.36239, 0.36347, 0.36491, 0.36692, 0.36902, 0.37114, 0.37323, 0.37499, 0.37649, 0.378, 0.37955, 0.38117, 0.38282, 0.38443, 0.38604, 0.38733, 0.3884, 0.38964, 0.39081, 0.392, 0.3935, 0.39491, 0.39615, 0.397, 0.39801, 0.39898, 0.40001, 0.40134, 0.4029, 0.40466, 0.40621, 0.40746, 0.40824, 0.40886, 0.4095, 0.41033, 0.41145, 0.41274, 0.41379, 0.41449, 0.41499, 0.41532, 0.41546, 0.41573, 0.41639, 0.4172, 0.41804, 0.41877, 0.41929, 0.41976, 0.42013, 0.42034, 0.42057, 0.42095, 0.42135, 0.42161, 0.42182, 0.42207, 0.42224, 0.42266, 0.42308, 0.42358, 0.42444, 0.42541, 0.42646, 0.42733, 0.42796, 0.42854, 0.42906, 0.42942, 0.42954, 0.42944, 0.42919, 0.42908, 0.42912, 0.42905, 0.42871, 0.42862, 0.4285, 0.42809, 0.42713, 0.42622, 0.42572, 0.42543, 0.42514, 0.42525, 0.42556, 0.42544, 0.4249, 0.42426, 0.42375, 0.42343, 0.42304, 0.42303, 0.42319, 0.42332, 0.42321, 0.42258, 0.42159, 0.42119, 0.42129, 0.42158, 0.42196, 0.42182, 0.42115, 0.42032, 0.4195, 0.41898, 0.41839, 0.41781, 0.41745, 0.41707, 0.4169, 0.41707, 0.41716, 0.41724, 0.41702, 0.41647, 0.41572, 0.41542, 0.41545, 0.4158, 0.41579, 0.41526, 0.41449, 0.41358, 0.41295, 0.41223, 0.41123, 0.40998, 0.40884, 0.40823, 0.40797, 0.40777, 0.40744, 0.40708, 0.40649, 0.40582, 0.4052, 0.40462, 0.40388, 0.40302, 0.40226, 0.40161, 0.40069, 0.39975, 0.39897, 0.39843, 0.39778, 0.39725, 0.39662, 0.39611, 0.39561, 0.3954, 0.39503, 0.3947, 0.39395, 0.3935, 0.39319, 0.39281, 0.39225, 0.39214, 0.39277, 0.3929, 0.39245, 0.39213, 0.39165, 0.39073, 0.38936, 0.38856, 0.38819, 0.38825, 0.38824, 0.38821, 0.38851, 0.3891, 0.38949, 0.38992, 0.39029, 0.39068, 0.39098, 0.3912, 0.39116, 0.39107, 0.39059, 0.39001, 0.38924, 0.38848, 0.38804, 0.38776, 0.38791, 0.38834, 0.38894, 0.38939, 0.38955, 0.38952, 0.38875, 0.38808, 0.38772, 0.38742, 0.38733, 0.38739, 0.38725, 0.38663, 0.38585, 0.3851, 0.38424, 0.3837, 0.38334, 0.38308, 0.38277, 0.38247, 0.38215, 0.38201, 0.38191, 0.38169, 0.38154, 0.38146, 0.38115, 0.38084, 0.38047, 0.3802, 0.38014, 0.38039, 0.38074, 0.38104, 0.38134, 0.38155, 0.38158, 0.38108, 0.38067, 0.38068, 0.3808, 0.38104, 0.38134, 0.38172, 0.38207, 0.38262, 0.38338, 0.38405, 0.38471, 0.38488, 0.3849, 0.3848, 0.38484, 0.38466, 0.38455, 0.3848, 0.38489, 0.38477, 0.38445, 0.38418, 0.38395, 0.38394, 0.3844, 0.3849, 0.38523, 0.38514, 0.38496, 0.38455, 0.38416, 0.38379, 0.38339, 0.38306, 0.38307, 0.38326, 0.38326, 0.38341, 0.38351, 0.38338, 0.38355, 0.38374, 0.38363, 0.38309, 0.3827, 0.38259, 0.38263, 0.38252, 0.38184, 0.38104, 0.38041, 0.3798, 0.3795, 0.3792, 0.37886, 0.37846, 0.37807, 0.37804, 0.37781, 0.37744, 0.37711, 0.37696, 0.37669, 0.3763, 0.3758, 0.37528, 0.37484, 0.37438, 0.37381, 0.3733, 0.37312, 0.37266, 0.37222, 0.37209, 0.37173, 0.37119, 0.37063, 0.36975, 0.3689, 0.36841, 0.36781, 0.36723, 0.36665, 0.3663, 0.3661, 0.36546, 0.36489, 0.36448, 0.36412, 0.36373, 0.36317, 0.36266, 0.3623, 0.362, 0.36188, 0.36155, 0.36107, 0.36048, 0.35993, 0.35931, 0.35833, 0.35725, 0.35594, 0.35471, 0.35383, 0.35311, 0.35251, 0.35214, 0.35177, 0.3511, 0.35023, 0.34951, 0.34897, 0.34826, 0.34743, 0.34651, 0.34583, 0.34538, 0.34497, 0.34447, 0.34363, 0.34256, 0.34151, 0.34042, 0.33931, 0.33826, 0.33734, 0.33657, 0.33573, 0.33505, 0.33403, 0.33278, 0.33147, 0.33013, 0.32883, 0.32737, 0.32622, 0.32487, 0.32335, 0.32163, 0.31986, 0.31838, 0.31735, 0.31651, 0.31567, 0.31461, 0.31342, 0.3123, 0.31126, 0.31041, 0.30957, 0.3085, 0.3073, 0.3061, 0.30492, 0.30384, 0.30284, 0.30121, 0.29998, 0.29884, 0.29773, 0.29653, 0.29541, 0.29449, 0.29371, 0.29245, 0.29111, 0.28975, 0.28825, 0.28698, 0.28576, 0.2848, 0.28415, 0.28324, 0.28214, 0.28111, 0.28027, 0.2794, 0.27861, 0.27782, 0.27692, 0.27591, 0.27468, 0.27361, 0.27289, 0.27241, 0.2725, 0.27243, 0.27185, 0.27116, 0.27062, 0.26994, 0.26893, 0.26785, 0.26654, 0.26524, 0.26415, 0.26349, 0.26277, 0.26176, 0.26086, 0.26008, 0.25944, 0.25898, 0.25865, 0.25806, 0.25734, 0.2566, 0.25591, 0.25549, 0.25526, 0.25494, 0.25444, 0.25397, 0.25402, 0.2542, 0.25425, 0.25413, 0.25415, 0.25416, 0.25426, 0.25431, 0.25437, 0.2544, 0.25441, 0.25455, 0.25482, 0.25501, 0.25491, 0.25456, 0.25419, 0.25381, 0.25334, 0.25266, 0.2522, 0.25214, 0.2522, 0.25234, 0.25271, 0.25301, 0.2532, 0.25325, 0.25312, 0.25291, 0.25268, 0.25235, 0.25213, 0.2522, 0.25229, 0.2524, 0.25263, 0.25286, 0.253, 0.25343, 0.25392, 0.25422, 0.25465, 0.25528, 0.25621, 0.25717, 0.25795, 0.25822, 0.25803, 0.25777, 0.25802, 0.25887, 0.25982, 0.26069, 0.26154, 0.26219, 0.26309, 0.26405, 0.26508, 0.26624, 0.26731, 0.268, 0.2686, 0.26909, 0.26972, 0.27067, 0.27182, 0.27291, 0.27417, 0.27524, 0.2761, 0.27686, 0.27784, 0.2794, 0.28112, 0.28233, 0.28322, 0.28402, 0.28484, 0.28582, 0.2868, 0.28757, 0.28836, 0.28937, 0.29035, 0.29105, 0.29162, 0.29224, 0.29329, 0.29464, 0.29614, 0.29764, 0.29914, 0.30048, 0.30138, 0.30222, 0.3032, 0.30419, 0.30523, 0.30678, 0.30865, 0.31047, 0.31232, 0.31424, 0.31619, 0.31771, 0.31887, 0.31981, 0.32076, 0.3223, 0.32382, 0.32518, 0.32656, 0.328, 0.3295, 0.331, 0.33222, 0.3331, 0.33363, 0.33416, 0.33525, 0.33684, 0.33863, 0.3404, 0.34212, 0.34396, 0.34541, 0.34645, 0.34738, 0.34858, 0.35004, 0.35131, 0.35273, 0.35421, 0.35562, 0.35717, 0.35906, 0.36126, 0.3631, 0.36475, 0.36642, 0.36814, 0.36973, 0.37151, 0.37323, 0.37503, 0.37723, 0.37974, 0.38172, 0.3834, 0.3851, 0.38704, 0.3888, 0.39052, 0.39222, 0.39392, 0.39579, 0.39779, 0.39958, 0.40109, 0.40218, 0.4031, 0.40429, 0.40584, 0.40788, 0.41021, 0.41267, 0.4149, 0.4168, 0.41845, 0.42014, 0.42201, 0.42357, 0.42527, 0.42677, 0.42791, 0.4292, 0.43062, 0.43202, 0.43344, 0.4346, 0.43606, 0.43713, 0.43814, 0.43928, 0.44039, 0.44206, 0.44376, 0.44564, 0.44745, 0.44886, 0.45013, 0.45131, 0.45237, 0.45382, 0.45505, 0.456, 0.45688, 0.45772, 0.45883, 0.45989, 0.46099, 0.46216, 0.46343, 0.46476, 0.46662, 0.46895, 0.47071, 0.47171, 0.47227, 0.47297, 0.47351, 0.47409, 0.4748, 0.47556, 0.47627, 0.4772, 0.47803, 0.47881, 0.47967, 0.48076, 0.48206, 0.48309, 0.4842, 0.48518, 0.486, 0.48675, 0.48737, 0.48773, 0.48839, 0.48892, 0.48926, 0.48966, 0.49008, 0.49041, 0.49046, 0.49042, 0.49033, 0.49042, 0.49039, 0.49042, 0.49044, 0.49041, 0.49058, 0.49101, 0.49121, 0.49121, 0.49116, 0.49111, 0.49097, 0.49056, 0.48987, 0.48922, 0.4883, 0.48733, 0.48656, 0.48584, 0.48503, 0.48446, 0.4839, 0.48321, 0.48247, 0.48169, 0.4809, 0.48001, 0.47898, 0.47805, 0.47688, 0.47548, 0.47407, 0.47317, 0.47266, 0.47198, 0.47109, 0.47018, 0.46893, 0.46742, 0.46569, 0.46388, 0.4621, 0.46048, 0.45892, 0.45735, 0.45599, 0.45471, 0.4532, 0.45135, 0.45004, 0.44866, 0.44721, 0.44544, 0.44331, 0.44119, 0.43921, 0.43715, 0.43533, 0.4336, 0.43201, 0.43065, 0.42926, 0.42708, 0.42496, 0.42283, 0.42083, 0.41915, 0.41771, 0.41638, 0.41491, 0.4133, 0.41162, 0.40954, 0.40724, 0.40511, 0.40305, 0.40086, 0.39864, 0.39627, 0.39374, 0.391, 0.38825, 0.38572, 0.38313, 0.38046, 0.37786, 0.37536, 0.373, 0.37046, 0.36799, 0.36545, 0.3626, 0.35969, 0.35707, 0.35504, 0.3529, 0.35066, 0.34838, 0.3458, 0.34291, 0.34002, 0.33707, 0.33418, 0.3315, 0.32921, 0.32648, 0.32365, 0.32096, 0.31853, 0.31602, 0.31338, 0.31096, 0.30823, 0.30569, 0.3033, 0.3011, 0.29911, 0.2974, 0.29541, 0.29284, 0.28992, 0.28695, 0.2842, 0.28201, 0.27969, 0.27733, 0.27496, 0.27254, 0.27036, 0.26854, 0.26701, 0.26547, 0.26373, 0.26187, 0.25982, 0.25781, 0.25584, 0.25386, 0.25179, 0.24976, 0.24769, 0.246, 0.24438, 0.24258, 0.24054, 0.23839, 0.23628, 0.23422, 0.2322, 0.2303, 0.22847, 0.22665, 0.22477, 0.22299, 0.22109, 0.21956, 0.21797, 0.21635, 0.2148, 0.21303, 0.21107, 0.20948, 0.20779, 0.20642, 0.20529, 0.20398, 0.20284, 0.20166, 0.2005, 0.19932, 0.19825, 0.1975, 0.19681, 0.19593, 0.19502, 0.19425, 0.19356, 0.19296, 0.19254, 0.19207, 0.19184, 0.19137, 0.19101, 0.1905, 0.19013, 0.19013, 0.19037, 0.19038, 0.19004, 0.19014, 0.19024, 0.1904, 0.19064, 0.19088, 0.19103, 0.19108, 0.19146, 0.1921, 0.19253, 0.19279, 0.19306, 0.19323, 0.19335, 0.19342, 0.19354, 0.19413, 0.19469, 0.19489, 0.19544, 0.19604, 0.1964, 0.197, 0.1981, 0.19937, 0.20078, 0.20228, 0.2037, 0.20449, 0.20483, 0.20514, 0.20587, 0.20691, 0.20816, 0.20941, 0.21106, 0.21261, 0.21417, 0.21586, 0.21716, 0.21857, 0.2198, 0.2211, 0.22241, 0.22396, 0.2255, 0.22665, 0.22774, 0.22878, 0.23026, 0.2318, 0.23338, 0.23505, 0.23631, 0.23768, 0.23933, 0.24099, 0.24269, 0.24446, 0.24612, 0.24764, 0.24903, 0.25107, 0.25273, 0.25479, 0.25685, 0.25842, 0.26006, 0.26192, 0.26394, 0.26553, 0.26714, 0.26881, 0.27065, 0.27263, 0.27492, 0.27758, 0.28011, 0.28282, 0.28574, 0.28877, 0.29102, 0.29297, 0.29506, 0.2971, 0.29918, 0.30165, 0.3044, 0.3068, 0.30902, 0.31161, 0.31391, 0.3165, 0.31931, 0.32179, 0.32408, 0.32645, 0.32913, 0.33235, 0.33556, 0.33837, 0.34118, 0.34403, 0.34686, 0.34941, 0.352, 0.35485, 0.35765, 0.35992, 0.36194, 0.36441, 0.36723, 0.36942, 0.37146, 0.37393, 0.37676, 0.37951, 0.38214, 0.38492, 0.38784, 0.39089, 0.3938, 0.39648, 0.39897, 0.40157, 0.40409, 0.40675, 0.40974, 0.41271, 0.41598, 0.41893, 0.42174, 0.42444, 0.42671, 0.42931, 0.43177, 0.43446, 0.43758, 0.44039, 0.44327, 0.446, 0.44892, 0.45203, 0.45514, 0.45792, 0.46085, 0.46386, 0.46699, 0.47017, 0.4731, 0.47581, 0.47845, 0.48064, 0.48291, 0.48493, 0.48666, 0.48818, 0.48984, 0.49165, 0.49354, 0.4954, 0.49704, 0.49873, 0.50046, 0.50243, 0.50471, 0.50686, 0.50874, 0.51036, 0.51184, 0.51295, 0.51387, 0.51458, 0.51567, 0.51741, 0.51938, 0.52161, 0.52381, 0.52581, 0.52746, 0.52842, 0.52916, 0.5299, 0.53073, 0.53177, 0.53327, 0.53463, 0.53602, 0.537, 0.53773, 0.53829, 0.53856, 0.53881, 0.53926, 0.54001, 0.54067, 0.54144, 0.54186, 0.54226, 0.54261, 0.54263, 0.54266, 0.54273, 0.54266, 0.5427, 0.54273, 0.54269, 0.54237, 0.54192, 0.54166, 0.54146, 0.54134, 0.54132, 0.5415, 0.54148, 0.54119, 0.54065, 0.54013, 0.53977, 0.53926, 0.53852, 0.53741, 0.53613, 0.53499, 0.5338, 0.53278, 0.53169, 0.53072, 0.52921, 0.5277, 0.52611, 0.52472, 0.52335, 0.52194, 0.52072, 0.51907, 0.51745, 0.51592, 0.51438, 0.51291, 0.51136, 0.50999, 0.50842, 0.50711, 0.50588, 0.50404, 0.5021, 0.49986, 0.49761, 0.49534, 0.49326, 0.4912, 0.48911, 0.48727, 0.48542, 0.48336, 0.48114, 0.47923, 0.47725, 0.47498, 0.4725, 0.46988, 0.46708, 0.46409, 0.46158, 0.45909, 0.45659, 0.45381, 0.45088, 0.44771, 0.44415, 0.44071, 0.43741, 0.4348, 0.43238, 0.42966, 0.42695, 0.42406, 0.42134, 0.41825, 0.41507, 0.41161, 0.40808, 0.40466, 0.40134, 0.39841, 0.39556, 0.39266, 0.38949, 0.38603, 0.3827, 0.3794, 0.37637, 0.37342, 0.37066, 0.36812, 0.36518, 0.36196, 0.35875, 0.35565, 0.35236, 0.34909, 0.34615, 0.34308, 0.33953, 0.33593, 0.33259, 0.32964, 0.32614, 0.3224, 0.31855, 0.31466, 0.31096, 0.30726, 0.3037, 0.29989, 0.29644, 0.29304, 0.28986, 0.28669, 0.28374, 0.28073, 0.27775, 0.27457, 0.27131, 0.26829, 0.26503, 0.26172, 0.25812, 0.25467, 0.25124, 0.24782, 0.24438, 0.24091, 0.23767, 0.23433, 0.23107, 0.22796, 0.22537, 0.22281, 0.22031, 0.21769, 0.21502, 0.21231, 0.20977, 0.20758, 0.20563, 0.20345, 0.2008, 0.19795, 0.19468, 0.19174, 0.18914, 0.1868, 0.18481, 0.18247, 0.18037, 0.17781, 0.17521, 0.17277, 0.17066, 0.16868, 0.16687, 0.16492, 0.16249, 0.15994, 0.15791, 0.15679, 0.15576, 0.15441, 0.15298, 0.15144, 0.14971, 0.1485, 0.14772, 0.14672, 0.14565, 0.14471, 0.14388, 0.14302, 0.14222, 0.14113, 0.1403, 0.13928, 0.138, 0.13686, 0.13616, 0.13575, 0.13549, 0.1351, 0.13518, 0.13552, 0.13598, 0.13629, 0.13668, 0.13735, 0.13717, 0.1366, 0.13623, 0.13592, 0.13562, 0.13536, 0.13525, 0.13514, 0.13511, 0.13519, 0.13536, 0.13515, 0.13462, 0.13438, 0.13484, 0.135, 0.13451, 0.13446, 0.13435, 0.13453, 0.13489, 0.13509, 0.13558, 0.13601, 0.13661, 0.13738, 0.13817, 0.13862, 0.13906, 0.13947, 0.13991, 0.14053, 0.14173, 0.14307, 0.1442, 0.14505, 0.1462, 0.14752, 0.14902, 0.15073, 0.15268, 0.1546, 0.15622, 0.15802, 0.15966, 0.16118, 0.16273, 0.16437, 0.16622, 0.16769, 0.16923, 0.17041, 0.17143, 0.17306, 0.17491, 0.17706, 0.17955, 0.18188, 0.18427, 0.18669, 0.18937, 0.19215, 0.19493, 0.19742, 0.20001, 0.20263, 0.2053, 0.20798, 0.21061, 0.21359, 0.21696, 0.22069, 0.22438, 0.22795, 0.23137, 0.23441, 0.23716, 0.24042, 0.24408, 0.24772, 0.25123, 0.25494, 0.25872, 0.26209, 0.26511, 0.26785, 0.27048, 0.27305, 0.27579, 0.27872, 0.2821, 0.28571, 0.28896, 0.29259, 0.29618, 0.29983, 0.30324, 0.30639, 0.30969, 0.3132, 0.31683, 0.32071, 0.32464, 0.32881, 0.33291, 0.33687, 0.34058, 0.34387, 0.34679, 0.3501, 0.35329, 0.35672, 0.35986, 0.36332, 0.3668, 0.37014, 0.37359, 0.37687, 0.38052, 0.38431, 0.38794, 0.39163, 0.39495, 0.39812, 0.40087, 0.40365, 0.40596, 0.40837, 0.41097, 0.41369, 0.41645, 0.41955, 0.42311, 0.42611, 0.42895, 0.43169, 0.43458, 0.4371, 0.43956, 0.44242, 0.44573, 0.44919, 0.45249, 0.45537, 0.4582, 0.46085, 0.46355, 0.46646, 0.4692, 0.47164, 0.47385, 0.47612, 0.47809, 0.48021, 0.48227, 0.48444, 0.48649, 0.48864, 0.4905, 0.49243, 0.49425, 0.49592, 0.49769, 0.49982, 0.50214, 0.50436, 0.50613, 0.50793, 0.50985, 0.51195, 0.51372, 0.51546, 0.51692, 0.51854, 0.52023, 0.52163, 0.52274, 0.52407, 0.52527, 0.52629, 0.52749, 0.52878, 0.53023, 0.53154, 0.53263, 0.53339, 0.53368, 0.53359, 0.53376, 0.53439, 0.53525, 0.53658, 0.53782, 0.53881, 0.53951, 0.54009, 0.54047, 0.54045, 0.54058, 0.54109, 0.54156, 0.54184, 0.54192, 0.54171, 0.54121, 0.54073, 0.54051, 0.54034, 0.53983, 0.53915, 0.53846, 0.53796, 0.53765, 0.53724, 0.53672, 0.53587, 0.53494, 0.53364, 0.53258, 0.53167, 0.53106, 0.53039, 0.5296, 0.52873, 0.52767, 0.52678, 0.52584, 0.52493, 0.5242, 0.52341, 0.52231, 0.52125, 0.52008, 0.51904, 0.51828, 0.51733, 0.51601, 0.51483, 0.51368, 0.51221, 0.51064, 0.50882, 0.50688, 0.50483, 0.5028, 0.50027, 0.49798, 0.49564, 0.49298, 0.49035, 0.48765, 0.48513, 0.4824, 0.47998, 0.47754, 0.47536, 0.47317, 0.47076, 0.46836, 0.46571, 0.46338, 0.46125, 0.45919, 0.45686, 0.45443, 0.45206, 0.44962, 0.44716, 0.44472, 0.44255, 0.44035, 0.43808, 0.43581, 0.43357, 0.43119, 0.42876, 0.42621, 0.42357, 0.42082, 0.41812, 0.41487, 0.41177, 0.40887, 0.40627, 0.40359, 0.40062, 0.39751, 0.39453, 0.39179, 0.38897, 0.38592, 0.38281, 0.37973, 0.3766, 0.37368, 0.37104, 0.36839, 0.36582, 0.36328, 0.36055, 0.3576, 0.35455, 0.35132, 0.34808, 0.34503, 0.34198, 0.33903, 0.3367, 0.33412, 0.33136, 0.32836, 0.32567, 0.323, 0.32038, 0.31793, 0.31558, 0.31336, 0.31098, 0.30852, 0.30601, 0.30365, 0.30141, 0.29913, 0.29619, 0.29307, 0.29051, 0.28798, 0.28558, 0.28342, 0.28151, 0.27926, 0.27665, 0.27391, 0.2711, 0.2688, 0.26654, 0.26433, 0.26215, 0.25986, 0.25766, 0.25563, 0.25344, 0.25168, 0.25009, 0.2483, 0.2463, 0.24374, 0.24111, 0.23866, 0.23651, 0.23437, 0.23229, 0.23021, 0.22837, 0.22668, 0.22516, 0.2238, 0.22236, 0.22092, 0.2195, 0.21808, 0.21675, 0.21536, 0.2139, 0.21294, 0.21241, 0.21195, 0.21107, 0.21016, 0.20947, 0.20888, 0.20764, 0.20624, 0.20478, 0.20334, 0.20216, 0.20126, 0.20067, 0.19962, 0.19864, 0.19762, 0.19681, 0.1962, 0.19595, 0.19565, 0.19517, 0.19464, 0.19395, 0.1937, 0.19365, 0.19356, 0.19323, 0.19292, 0.1925, 0.19209, 0.19186, 0.19179, 0.19184, 0.19186, 0.19205, 0.1923, 0.19287, 0.19319, 0.19319, 0.19341, 0.19391, 0.1941, 0.19431, 0.19443, 0.19452, 0.19441, 0.1943, 0.19449, 0.19456, 0.19491, 0.19529, 0.1956, 0.19581, 0.19598, 0.19617, 0.19654, 0.19685, 0.19712, 0.19719, 0.19742, 0.19798, 0.19868, 0.19928, 0.2004, 0.20193, 0.20408, 0.20626, 0.20798, 0.20925, 0.21047, 0.2118, 0.2128, 0.21341, 0.21412, 0.21506, 0.21632, 0.21785, 0.21947, 0.22103, 0.22263, 0.2244, 0.22635, 0.22858, 0.23087, 0.23301, 0.23519, 0.23729, 0.23917, 0.24088, 0.24259, 0.24452, 0.24661, 0.24873, 0.25103, 0.2534, 0.2556, 0.25775, 0.25985, 0.26189, 0.2639, 0.26594, 0.26776, 0.26945, 0.27102, 0.27246, 0.27399, 0.27573, 0.27772, 0.28012, 0.28278, 0.28539, 0.28772, 0.28965, 0.29113, 0.2925, 0.29413, 0.29608, 0.2983, 0.30084, 0.30361, 0.30615, 0.30829, 0.31047, 0.31271, 0.31488, 0.31689, 0.3193, 0.32199, 0.32466, 0.32725, 0.32949, 0.3313, 0.33297, 0.33488, 0.33723, 0.33967, 0.34227, 0.34509, 0.34802, 0.35072, 0.35311, 0.35531, 0.35748, 0.35972, 0.36209, 0.36464, 0.36702, 0.36941, 0.37185, 0.37411, 0.37636, 0.37859, 0.381, 0.38345, 0.38555, 0.38756, 0.38954, 0.39144, 0.39342, 0.39543, 0.39746, 0.39983, 0.40242, 0.40523, 0.40807, 0.41068, 0.41312, 0.41538, 0.41752, 0.41952, 0.42152, 0.42343, 0.42501, 0.42634, 0.42781, 0.42964, 0.43147, 0.43341, 0.4355, 0.43757, 0.43963, 0.44179, 0.44375, 0.4454, 0.4467, 0.44819, 0.45005, 0.45194, 0.4536, 0.45506, 0.45646, 0.45783, 0.45935, 0.46111, 0.46269, 0.46431, 0.46607, 0.46773, 0.46931, 0.47088, 0.4723, 0.47345, 0.47442, 0.47542, 0.47646, 0.4776, 0.47847, 0.47882, 0.47892, 0.47889, 0.47914, 0.47969, 0.48044, 0.48122, 0.48192, 0.48248, 0.4829, 0.48319, 0.48357, 0.4839, 0.48404, 0.48407, 0.48412, 0.48433, 0.48428, 0.48404, 0.48392, 0.48382, 0.48376, 0.48373, 0.48379, 0.48378, 0.48346, 0.48282, 0.48177, 0.48057, 0.47953, 0.47863, 0.47789, 0.47719, 0.47633, 0.47502, 0.47359, 0.47233, 0.4713, 0.47048, 0.46945, 0.46806, 0.46672, 0.46557, 0.46459, 0.46366, 0.46258, 0.46136, 0.46008, 0.45893, 0.45786, 0.45669, 0.45544, 0.45428, 0.453, 0.45145, 0.44966, 0.44808, 0.44703, 0.44604, 0.4448, 0.44312, 0.44123, 0.43922, 0.43729, 0.43578, 0.43454, 0.43327, 0.43173, 0.43, 0.42847, 0.42712, 0.42577, 0.42457, 0.42309, 0.42128, 0.41943, 0.4178, 0.41624, 0.41446, 0.41264, 0.41083, 0.40877, 0.4066, 0.40442, 0.40226, 0.39979, 0.39709, 0.39476, 0.39287, 0.39112, 0.38951, 0.38793, 0.3861, 0.38408, 0.38195, 0.38016, 0.37854, 0.37677, 0.37489, 0.37273, 0.37042, 0.3681, 0.36579, 0.36347, 0.36099, 0.35855, 0.35618, 0.35385, 0.35157, 0.34914, 0.34661, 0.34422, 0.34191, 0.33949, 0.3373, 0.33554, 0.33396, 0.33247, 0.33081, 0.32895, 0.32698, 0.32504, 0.32299, 0.32067, 0.3184, 0.31654, 0.31491, 0.31298, 0.31073, 0.30839, 0.30601, 0.30369, 0.30162, 0.29956, 0.29714, 0.29438, 0.29186, 0.28953, 0.28737, 0.28536, 0.28308, 0.28074, 0.27874, 0.27689, 0.2751, 0.27359, 0.27227, 0.27067, 0.26858, 0.26611, 0.26352, 0.26093, 0.2584, 0.25616, 0.25419, 0.25235, 0.25066, 0.2488, 0.24702, 0.24562, 0.24435, 0.2428, 0.24113, 0.23973, 0.23841, 0.23693, 0.23547, 0.23402, 0.23244, 0.23088, 0.22952, 0.22849, 0.22769, 0.22678, 0.22588, 0.2251, 0.224, 0.22245, 0.2209, 0.21976, 0.21882, 0.21781, 0.21671, 0.21553, 0.2144, 0.2133, 0.21236, 0.21157, 0.21062, 0.20934, 0.20786, 0.20654, 0.20532, 0.20419, 0.20322, 0.20234, 0.20148, 0.20078, 0.20036, 0.19991, 0.19936, 0.19867, 0.19771, 0.19675, 0.19613, 0.19599, 0.19607, 0.19604, 0.1959, 0.19578, 0.1955, 0.19509, 0.19487, 0.19482, 0.19468, 0.19455, 0.19466, 0.19502, 0.19561, 0.1964, 0.19731, 0.19808, 0.19869, 0.1993, 0.1999, 0.20066, 0.20153, 0.20225, 0.20265, 0.20293, 0.20343, 0.20438, 0.20578, 0.20731, 0.20862, 0.20962, 0.21056, 0.21156, 0.21238, 0.21318, 0.21452, 0.21628, 0.21784, 0.219, 0.22, 0.22075, 0.22133, 0.22204, 0.22297, 0.22392, 0.22478, 0.22574, 0.22696, 0.22826, 0.2294, 0.23058, 0.23197, 0.2336, 0.23556, 0.23747, 0.23901, 0.24056, 0.24236, 0.24434, 0.24626, 0.24809, 0.24964, 0.25069, 0.25174, 0.25308, 0.25449, 0.25603, 0.25778, 0.25981, 0.26182, 0.26356, 0.26531, 0.26711, 0.26898, 0.27084, 0.27267, 0.27431, 0.27585, 0.27749, 0.27915, 0.28063, 0.28202, 0.28366, 0.28545, 0.28702, 0.28876, 0.29097, 0.29342, 0.29571, 0.29769, 0.29966, 0.30186, 0.30422, 0.30674, 0.3094, 0.31199, 0.31434, 0.3164, 0.31844, 0.32045, 0.32224, 0.32398, 0.32582, 0.32752, 0.32925, 0.33131, 0.33365, 0.33614, 0.33857, 0.34118, 0.34405, 0.34677, 0.34911, 0.35131, 0.35345, 0.35541, 0.3573, 0.35901, 0.36077, 0.36293, 0.36545, 0.36824, 0.37119, 0.37409, 0.37637, 0.37808, 0.37995, 0.38168, 0.38327, 0.38479, 0.38623, 0.38772, 0.38923, 0.39091, 0.39313, 0.39554, 0.39737, 0.39897, 0.40065, 0.40203, 0.40324, 0.40446, 0.40574, 0.40747, 0.40928, 0.4108, 0.41228, 0.41401, 0.41563, 0.41688, 0.41822, 0.41979, 0.42112, 0.42218, 0.42294, 0.42358, 0.42442, 0.42544, 0.42639, 0.42708, 0.42775, 0.42846, 0.42928, 0.43014, 0.43082, 0.43149, 0.43223, 0.43306, 0.43382, 0.43466, 0.43557, 0.43638, 0.43712, 0.43789, 0.43898, 0.44008, 0.44079, 0.44131, 0.44172, 0.44217, 0.44297, 0.44382, 0.44438, 0.44479, 0.44515, 0.44561, 0.44636, 0.44717, 0.44763, 0.44789, 0.44821, 0.44871, 0.44939, 0.44974, 0.44973, 0.44954, 0.44869, 0.44736, 0.44635, 0.44589, 0.44578, 0.4456, 0.44505, 0.44444, 0.44385, 0.44327, 0.44283, 0.44241, 0.44186, 0.44117, 0.44057, 0.44009, 0.43956, 0.43907, 0.43847, 0.43752, 0.43668, 0.43603, 0.43541, 0.43466, 0.43381, 0.43278, 0.43157, 0.43046, 0.42925, 0.42812, 0.42709, 0.42605, 0.42484, 0.42362, 0.42263, 0.4217, 0.42081, 0.41984, 0.41863, 0.41716, 0.41568, 0.41442, 0.41322, 0.41195, 0.41068, 0.40941, 0.40812, 0.40688, 0.40569, 0.40464, 0.40367, 0.40261, 0.40144, 0.4003, 0.39904, 0.39718, 0.395, 0.39303, 0.39125, 0.38963, 0.38805, 0.38632, 0.38447, 0.38253, 0.38056, 0.37871, 0.37685, 0.375, 0.37319, 0.37129, 0.36945, 0.36795, 0.36666, 0.3654, 0.36417, 0.36277, 0.3613, 0.35989, 0.35847, 0.35686, 0.35502, 0.35305, 0.35122, 0.34963, 0.34824, 0.34687, 0.34532, 0.34388, 0.3427, 0.34165, 0.34043, 0.33886, 0.33698, 0.33494, 0.33271, 0.33036, 0.32822, 0.32639, 0.3249, 0.32387, 0.32302, 0.32189, 0.32031, 0.31833, 0.31617, 0.31426, 0.31269, 0.31103, 0.3093, 0.3075, 0.30583, 0.3045, 0.30329, 0.30233, 0.30162, 0.30069, 0.29965, 0.29869, 0.29756, 0.29612, 0.29446, 0.29263, 0.29085, 0.28954, 0.28874, 0.28785, 0.2866, 0.28523, 0.28411, 0.28321, 0.28229, 0.28159, 0.28114, 0.28059, 0.27988, 0.27905, 0.27833, 0.27779, 0.27717, 0.27656, 0.27605, 0.27545, 0.27494, 0.27473, 0.27466, 0.27435, 0.27333, 0.27201, 0.2708, 0.26968, 0.2687, 0.26802, 0.26743, 0.26684, 0.26635, 0.26571, 0.26494, 0.26417, 0.26326, 0.26245, 0.26163, 0.26071, 0.26021, 0.25999, 0.25965, 0.25893, 0.2581, 0.25722, 0.25606, 0.25508, 0.25453, 0.25435, 0.2544, 0.2546, 0.2549, 0.25485, 0.25446, 0.25428, 0.25464, 0.25494, 0.25516, 0.25561, 0.25588, 0.25609, 0.2562, 0.25626, 0.25622, 0.25603, 0.25584, 0.25557, 0.25527, 0.25485, 0.25441, 0.25411, 0.25404, 0.25424, 0.25458, 0.25509, 0.25584, 0.25671, 0.25748, 0.25811, 0.25867, 0.25963, 0.26091, 0.26203, 0.26307, 0.26407, 0.26504, 0.26573, 0.26635, 0.26708, 0.26787, 0.26898, 0.27027, 0.27123, 0.27201, 0.27305, 0.27427, 0.27571, 0.27717, 0.27822, 0.2791, 0.28002, 0.2808, 0.28152, 0.28256, 0.28379, 0.28506, 0.28631, 0.2875, 0.28883, 0.29014, 0.29132, 0.29251, 0.29384, 0.29507, 0.29602, 0.297, 0.29825, 0.29959, 0.30101, 0.30262, 0.30404, 0.30507, 0.30589, 0.3071, 0.30881, 0.31071, 0.31278, 0.31489, 0.31688, 0.31868, 0.32037, 0.32221, 0.32417, 0.32602, 0.32793, 0.33015, 0.33254, 0.33487, 0.33712, 0.3392, 0.34114, 0.343, 0.34497, 0.34718, 0.34954, 0.35196, 0.35416, 0.35607, 0.35799, 0.35995, 0.36179, 0.36341, 0.36486, 0.36623, 0.36748, 0.36875, 0.36992, 0.3709, 0.37194, 0.37327, 0.37474, 0.37635, 0.37801, 0.37944, 0.38078, 0.38194, 0.38274, 0.3834, 0.38407, 0.38478, 0.38567, 0.38669, 0.38756, 0.38836, 0.3889, 0.3891, 0.38932, 0.38981, 0.39054, 0.39126, 0.39191, 0.39254, 0.39319, 0.39389, 0.3947, 0.39547, 0.396, 0.39657, 0.39719, 0.39764, 0.39789, 0.39818, 0.39865, 0.39902, 0.39953, 0.40003, 0.40052, 0.4014, 0.40258, 0.40388, 0.40476, 0.4052, 0.40546, 0.40565, 0.40589, 0.40626, 0.40682, 0.40738, 0.40798, 0.40847, 0.40855, 0.40855, 0.40859, 0.40871, 0.40901, 0.40929, 0.40939, 0.40921, 0.40897, 0.40867, 0.40833, 0.40798, 0.4076, 0.40753, 0.40763, 0.40777, 0.40781, 0.40759, 0.4073, 0.40707, 0.40715, 0.40735, 0.4073, 0.40708, 0.40688, 0.40666, 0.40631, 0.40581, 0.40516, 0.40457, 0.40404, 0.40331, 0.40256, 0.40184, 0.40126, 0.40105, 0.40073, 0.40025, 0.39985, 0.39938, 0.39884, 0.39819, 0.39763, 0.39704, 0.39639, 0.3959, 0.39524, 0.39427, 0.39347, 0.39293, 0.39238, 0.39191, 0.39144, 0.39076, 0.39, 0.38906, 0.38798, 0.38677, 0.38547, 0.38429, 0.38312, 0.38204, 0.38097, 0.37996, 0.37879, 0.37733, 0.37577, 0.37432, 0.37311, 0.37201, 0.37087, 0.36964, 0.36834, 0.3669, 0.36532, 0.36367, 0.36225, 0.36097, 0.35965, 0.35835, 0.35724, 0.35617, 0.35503, 0.35393, 0.35289, 0.35195, 0.35089, 0.34973, 0.34824, 0.34639, 0.34466, 0.34327, 0.34219, 0.34158, 0.34115, 0.3406, 0.33988, 0.33865, 0.3367, 0.33458, 0.33289, 0.33161, 0.33069, 0.32973, 0.32851, 0.3273, 0.32626, 0.32529, 0.32409, 0.32293, 0.32218, 0.32146, 0.32062, 0.32001, 0.31938, 0.31833, 0.3173, 0.3167, 0.31615, 0.31537, 0.31439, 0.31331, 0.31246, 0.31189, 0.31154, 0.31139, 0.31151, 0.31161, 0.3114, 0.31136, 0.31135, 0.31126, 0.31108, 0.31041, 0.3095, 0.30846, 0.30765, 0.307, 0.30676, 0.30686, 0.30667, 0.30627, 0.30584, 0.30562, 0.30544, 0.30501, 0.30461, 0.30462, 0.30453, 0.30416, 0.30375, 0.30307, 0.30232, 0.30179, 0.30133, 0.30073, 0.30044, 0.30063, 0.30065, 0.30055, 0.30025, 0.29983, 0.29948, 0.29929, 0.29951, 0.29948, 0.29932, 0.29908, 0.2984, 0.29775, 0.29714, 0.29674, 0.29636, 0.29564, 0.29485, 0.29399, 0.2934, 0.29268, 0.29183, 0.29135, 0.29119, 0.29115, 0.29078, 0.29037, 0.29029, 0.29043, 0.29056, 0.29049, 0.29024, 0.29001, 0.28995, 0.28991, 0.28991, 0.28975, 0.28961, 0.28959, 0.28972, 0.29008, 0.29057, 0.29135, 0.29222, 0.29307, 0.29366, 0.29433, 0.29515, 0.29593, 0.29657, 0.29746, 0.29844, 0.2994, 0.30073, 0.30187, 0.30285, 0.30407, 0.30516, 0.30596, 0.3065, 0.3069, 0.30721, 0.30763, 0.30823, 0.30926, 0.31056, 0.31196, 0.31353, 0.31473, 0.31567, 0.31692, 0.31849, 0.31977, 0.32054, 0.32125, 0.32215, 0.32319, 0.32405, 0.3246, 0.32513, 0.32598, 0.32692, 0.32791, 0.32916, 0.33034, 0.33142, 0.33244, 0.33344, 0.33437, 0.33492, 0.33515, 0.33582, 0.33683, 0.33819, 0.33975, 0.34129, 0.3428, 0.34402, 0.345, 0.34572, 0.34645, 0.34739, 0.34855, 0.35, 0.35191, 0.3541, 0.35599, 0.35742, 0.35864, 0.35959, 0.36027, 0.36074, 0.36131, 0.36219, 0.36326, 0.36444, 0.3656, 0.36692, 0.3682, 0.36951, 0.37089, 0.37212, 0.37332, 0.37443, 0.37533, 0.37608, 0.37676, 0.37743, 0.37813, 0.37879, 0.37937, 0.38011, 0.3812, 0.38243, 0.38348, 0.38431, 0.38509, 0.38569, 0.38605, 0.38646, 0.38696, 0.38762, 0.38872, 0.38995, 0.39098, 0.39197, 0.39281, 0.3934, 0.3939, 0.39427, 0.39479, 0.39525, 0.39557, 0.39596, 0.39626, 0.39688, 0.39765, 0.39818, 0.39872, 0.39921, 0.39953, 0.39975, 0.40017, 0.40052, 0.4009, 0.40146, 0.40223, 0.40323, 0.40403, 0.40457, 0.40478, 0.40489, 0.40487, 0.40487, 0.40516, 0.40579, 0.40662, 0.40712, 0.40722, 0.40724, 0.40726, 0.40721, 0.40718, 0.40711, 0.4069, 0.40668, 0.40652, 0.40637, 0.40598, 0.40541, 0.40464, 0.4038, 0.40294, 0.4021, 0.40142, 0.40105, 0.40063, 0.40005, 0.39951, 0.39895, 0.39857, 0.39824, 0.3979, 0.39787, 0.39769, 0.39709, 0.39648, 0.396, 0.39559, 0.39501, 0.39438, 0.39375, 0.39288, 0.39204, 0.39145, 0.39083, 0.39016, 0.38955, 0.38875, 0.38756, 0.38621, 0.38489, 0.38358, 0.38226, 0.38121, 0.38078, 0.38059, 0.38011, 0.37938, 0.37829, 0.3772, 0.37627, 0.37547, 0.37472, 0.37392, 0.37308, 0.37185, 0.37037, 0.36906, 0.36791, 0.36672, 0.3656, 0.36477, 0.364, 0.36296, 0.36179, 0.36084, 0.35992, 0.3588, 0.35754, 0.35632, 0.35528, 0.35428, 0.35345, 0.35289, 0.35214, 0.35128, 0.35021, 0.34898, 0.34777, 0.34645, 0.34517, 0.34397, 0.34292, 0.3419, 0.34076, 0.3394, 0.33791, 0.33645, 0.33499, 0.33361, 0.33223, 0.33077, 0.32945, 0.32829, 0.32712, 0.32571, 0.32414, 0.3227, 0.32147, 0.32048, 0.31951, 0.31839, 0.31738, 0.31641, 0.31535, 0.31416, 0.31283, 0.31145, 0.30997, 0.30844, 0.307, 0.30601, 0.30557, 0.30534, 0.3048, 0.30401, 0.30322, 0.3024, 0.30145, 0.30042, 0.29962, 0.29884, 0.298, 0.29726, 0.29628, 0.2952, 0.29412, 0.29297, 0.29202, 0.29108, 0.29019, 0.28961, 0.28908, 0.28819, 0.28734, 0.28675, 0.28608, 0.28532, 0.28485, 0.28453, 0.2841, 0.28381, 0.28363, 0.28342, 0.28314, 0.28274, 0.28252, 0.28235, 0.28231, 0.28252, 0.28266, 0.28252, 0.28246, 0.28295, 0.28366, 0.2841, 0.28424, 0.28426, 0.28443, 0.28473, 0.28501, 0.28545, 0.28582, 0.2862, 0.28666, 0.28663, 0.2862, 0.28576, 0.28528, 0.28498, 0.28498, 0.28518, 0.28552, 0.28604, 0.28683, 0.2876, 0.2882, 0.28876, 0.28916, 0.28957, 0.29017, 0.2908, 0.29154, 0.29222, 0.29281, 0.29334, 0.29376, 0.29422, 0.2949, 0.29563, 0.29644, 0.2974, 0.29873, 0.30037, 0.30158, 0.30259, 0.30388, 0.30519, 0.30628, 0.30733, 0.30824, 0.30866, 0.30853, 0.30817, 0.30806, 0.30823, 0.30864, 0.30915, 0.30977, 0.31045, 0.31127, 0.31234, 0.3135, 0.31483, 0.31599, 0.31687, 0.31765, 0.31825, 0.31887, 0.31961, 0.32034, 0.32079, 0.32122, 0.3219, 0.32283, 0.3239, 0.32502, 0.32644, 0.32784, 0.32899, 0.32994, 0.33074, 0.33171, 0.33267, 0.33375, 0.3351, 0.33637, 0.33741, 0.33825, 0.33905, 0.33993, 0.34074, 0.34134, 0.34186, 0.34263, 0.34393, 0.34551, 0.34691, 0.34796, 0.34879, 0.34948, 0.35012, 0.35105, 0.35231, 0.35374, 0.35527, 0.35672, 0.35819, 0.35983, 0.36177, 0.36371, 0.36541, 0.36706, 0.36866, 0.3704, 0.3721, 0.37347, 0.37481, 0.37613, 0.37735, 0.37856, 0.37994, 0.38139, 0.38271, 0.38358, 0.38423, 0.38526, 0.38656, 0.3879, 0.38939, 0.39085, 0.39201, 0.39298, 0.394, 0.3951, 0.39611, 0.39698, 0.398, 0.39912, 0.40019, 0.40126, 0.40243, 0.40372, 0.40492, 0.4056, 0.40601, 0.40647, 0.40719, 0.4084, 0.40984, 0.41128, 0.4127, 0.41412, 0.41519, 0.416, 0.41691, 0.41807, 0.41947, 0.42098, 0.42252, 0.42387, 0.42492, 0.42573, 0.42625, 0.42651, 0.4272, 0.42822, 0.42907, 0.42984, 0.4305, 0.43082, 0.43121, 0.43203, 0.43274, 0.43336, 0.43447, 0.43583, 0.43695, 0.43791, 0.43871, 0.43936, 0.43992, 0.44044, 0.44105, 0.44176, 0.44235, 0.44265, 0.44282, 0.44315, 0.44358, 0.44403, 0.44456, 0.44487, 0.44505, 0.44551, 0.44618, 0.44673, 0.44688, 0.44674, 0.44671, 0.44706, 0.44756, 0.4479, 0.44805, 0.44807, 0.44801, 0.44782, 0.44764, 0.44772, 0.44806, 0.44825, 0.4481, 0.44767, 0.44704, 0.44628, 0.4455, 0.44491, 0.44421, 0.44356, 0.44289, 0.44197, 0.4409, 0.43979, 0.43882, 0.43796, 0.43735, 0.43664, 0.43589, 0.43529, 0.43477, 0.43425, 0.43355, 0.43268, 0.43162, 0.4307, 0.43004, 0.42951, 0.42891, 0.42817, 0.42729, 0.42627, 0.42514, 0.4239, 0.42265, 0.42146, 0.42027, 0.4191, 0.41786, 0.41647, 0.41503, 0.41382, 0.41276, 0.41177, 0.41092, 0.4099, 0.40878, 0.40773, 0.4068, 0.40589, 0.4048, 0.40374, 0.40276, 0.40177, 0.40068, 0.39929, 0.39787, 0.39626, 0.39461, 0.39316, 0.39196, 0.39104, 0.39012, 0.38923, 0.38819, 0.38707, 0.38599, 0.38498, 0.38399, 0.38296, 0.38172, 0.38031, 0.37904, 0.37768, 0.37614, 0.37457, 0.37324, 0.37221, 0.37124, 0.37015, 0.36914, 0.36834, 0.36762, 0.36691, 0.36605, 0.3649, 0.36354, 0.36216, 0.36078, 0.35932, 0.35778, 0.35616, 0.35441, 0.35257, 0.3507, 0.34886, 0.34698, 0.345, 0.34286, 0.34093, 0.33948, 0.33824, 0.33688, 0.33525, 0.33339, 0.33155, 0.32983, 0.3283, 0.32694, 0.32564, 0.32405, 0.32214, 0.31984, 0.31751, 0.31545, 0.31371, 0.31228, 0.3109, 0.30951, 0.30814, 0.30671, 0.30503, 0.30329, 0.30148, 0.29964, 0.29794, 0.2965, 0.29532, 0.2942, 0.29312, 0.29187, 0.29044, 0.28887, 0.28745, 0.28633, 0.28515, 0.28394, 0.28266, 0.28114, 0.27949, 0.27802, 0.27691, 0.2757, 0.27431, 0.27294, 0.27168, 0.27063, 0.2696, 0.26844, 0.26745, 0.26639, 0.2652, 0.26414, 0.26326, 0.26257, 0.26159, 0.26034, 0.25908, 0.25787, 0.25714, 0.25674, 0.25637, 0.25603, 0.25547, 0.25461, 0.25366, 0.25307, 0.25304, 0.25305, 0.25269, 0.25218, 0.25184, 0.25145, 0.2511, 0.25105, 0.25122, 0.25149, 0.25186, 0.25209, 0.2523, 0.25293, 0.25352, 0.25379, 0.25408, 0.25434, 0.25433, 0.25404, 0.25389, 0.25401, 0.25445, 0.25526, 0.25604, 0.25673, 0.2577, 0.25873, 0.25947, 0.25988, 0.26015, 0.26093, 0.2619, 0.26265, 0.26356, 0.26434, 0.2651, 0.26611, 0.26731, 0.26838, 0.26944, 0.27063, 0.27169, 0.2722, 0.27262, 0.27324, 0.27364, 0.27393, 0.27428, 0.27489, 0.27559, 0.27631, 0.27696, 0.27775, 0.27866, 0.27957, 0.28036, 0.28084, 0.28124, 0.28162, 0.28209, 0.28277, 0.28355, 0.28452, 0.28546, 0.28604, 0.28673, 0.2878, 0.28884, 0.28984, 0.29091, 0.29221, 0.29359, 0.29456, 0.29532, 0.29611, 0.29685, 0.29763, 0.29858, 0.2995, 0.30022, 0.30121, 0.3022, 0.30312, 0.30446, 0.30622, 0.30844, 0.31084, 0.31318, 0.31555, 0.3178, 0.31977, 0.32129, 0.32278, 0.32439, 0.32578, 0.32708, 0.32837, 0.32975, 0.33118, 0.33241, 0.3335, 0.33457, 0.33576, 0.33719, 0.33845, 0.33965, 0.34107, 0.3427, 0.34446, 0.3464, 0.34851, 0.35033, 0.35176, 0.35318, 0.35482, 0.35662, 0.35866, 0.36062, 0.36227, 0.36372, 0.36497, 0.36618, 0.36731, 0.36822, 0.36928, 0.37049, 0.37162, 0.37269, 0.37365, 0.37458, 0.37552, 0.37649, 0.37748, 0.3784, 0.37955, 0.38129, 0.38332, 0.38528, 0.38711, 0.38859, 0.3898, 0.39098, 0.39213, 0.39318, 0.39413, 0.39525, 0.39647, 0.39793, 0.39974, 0.40165, 0.40341, 0.40484, 0.40604, 0.407, 0.40796, 0.40927, 0.41062, 0.41165, 0.4124, 0.41323, 0.4142, 0.4154, 0.41682, 0.41793, 0.41887, 0.41978, 0.42085, 0.42174, 0.42258, 0.42384, 0.42508, 0.42628, 0.42777, 0.42929, 0.43056, 0.43153, 0.43237, 0.43322, 0.43422, 0.43553, 0.43695, 0.43832, 0.43961, 0.44088, 0.44224, 0.44362, 0.44456, 0.44512, 0.44561, 0.44611, 0.44677, 0.44711, 0.44736, 0.44814, 0.44889, 0.44926, 0.44945, 0.44952, 0.44989, 0.45064, 0.45131, 0.45204, 0.45266, 0.45325, 0.45392, 0.45465, 0.45542, 0.45601, 0.4565, 0.45691, 0.45703, 0.45693, 0.45683, 0.45665, 0.45614, 0.45564, 0.45536, 0.45522, 0.45516, 0.45495, 0.45469, 0.45447, 0.45408, 0.45366, 0.45341, 0.45324, 0.45304, 0.45299, 0.45285, 0.4524, 0.45195, 0.45155, 0.45117, 0.45082, 0.45036, 0.44969, 0.44892, 0.44817, 0.44738, 0.44663, 0.44564, 0.44469, 0.4441, 0.44384, 0.44376, 0.44348, 0.44279, 0.44178, 0.4406, 0.43947, 0.43849, 0.43754, 0.43632, 0.43498, 0.4339, 0.43294, 0.4321, 0.43134, 0.43043, 0.42958, 0.42879, 0.42788, 0.4268, 0.42546, 0.42415, 0.42296, 0.42163, 0.4202, 0.41874, 0.41735, 0.41592, 0.41465, 0.4135, 0.41231, 0.41117, 0.41005, 0.40853, 0.40668, 0.40499, 0.40334, 0.40147, 0.39963, 0.39809, 0.39682, 0.39549, 0.39403, 0.39235, 0.39047, 0.38849, 0.38651, 0.38466, 0.38288, 0.38109, 0.3792, 0.37716, 0.37502, 0.37329, 0.37193, 0.3707, 0.36969, 0.36866, 0.36723, 0.36574, 0.36461, 0.36332, 0.36182, 0.36023, 0.35837, 0.35647, 0.35453, 0.35237, 0.35036, 0.34842, 0.34664, 0.34519, 0.34378, 0.34226, 0.34044, 0.33846, 0.3363, 0.3341, 0.33206, 0.33002, 0.3283, 0.32676, 0.32519, 0.32344, 0.32126, 0.31873, 0.31605, 0.31378, 0.31199, 0.31007, 0.30805, 0.30629, 0.30471, 0.30329, 0.30203, 0.30072, 0.29916, 0.29748, 0.2958, 0.29403, 0.29213, 0.29043, 0.28891, 0.28727, 0.28568, 0.2843, 0.28325, 0.28242, 0.28151, 0.28031, 0.27898, 0.27779, 0.27667, 0.27572, 0.275, 0.27402, 0.27249, 0.27078, 0.26941, 0.2685, 0.26788, 0.26748, 0.26698, 0.26614, 0.26509, 0.26417, 0.26346, 0.26271, 0.26187, 0.26099, 0.26008, 0.2593, 0.25884, 0.25839, 0.25773, 0.257, 0.25621, 0.25564, 0.25543, 0.25522, 0.25471, 0.25417, 0.25412, 0.25429, 0.25436, 0.25436, 0.25407, 0.25383, 0.25359, 0.25329, 0.25326, 0.25312, 0.25292, 0.25268, 0.25217, 0.25163, 0.25123, 0.2508, 0.25054, 0.25052, 0.25059, 0.25068, 0.25038, 0.24996, 0.25018, 0.25076, 0.25116, 0.25141, 0.25155, 0.25167, 0.25217, 0.25295, 0.25341, 0.25383, 0.25439, 0.25499, 0.25565, 0.25624, 0.25682, 0.25733, 0.25774, 0.2586, 0.26016, 0.26182, 0.26332, 0.26511, 0.26714, 0.26891, 0.27067, 0.27254, 0.27435, 0.27566, 0.27674, 0.27811, 0.2796, 0.28132, 0.2832, 0.285, 0.28646, 0.28776, 0.28879, 0.28939, 0.28988, 0.2906, 0.29176, 0.29298, 0.29418, 0.29577, 0.29758, 0.29953, 0.3013, 0.30275, 0.30453, 0.30645, 0.30816, 0.30982, 0.3115, 0.31318, 0.31504, 0.3171, 0.31905, 0.3211, 0.32327, 0.32534, 0.32704, 0.32856, 0.33042, 0.33239, 0.33405, 0.33559, 0.33764, 0.33985, 0.34208, 0.34437, 0.34635, 0.34846, 0.35078, 0.35282, 0.35443, 0.35597, 0.3579, 0.36022, 0.36263, 0.36506, 0.36757, 0.37006, 0.37252, 0.37491, 0.37703, 0.37896, 0.38081, 0.38266, 0.38481, 0.38714, 0.3895, 0.392, 0.39451, 0.397, 0.39953, 0.40205, 0.40436, 0.40642, 0.40844, 0.41051, 0.41261, 0.41454, 0.41633, 0.41804, 0.41972, 0.42123, 0.4227, 0.42417, 0.42589, 0.42789, 0.42994, 0.43223, 0.43474, 0.43708, 0.43907, 0.44096, 0.4427, 0.44422, 0.44571, 0.44749, 0.44966, 0.45192, 0.45408, 0.45581, 0.45683, 0.45767, 0.45875, 0.46024, 0.46188, 0.46354, 0.46535, 0.46702, 0.46855, 0.46988, 0.47095, 0.47232, 0.47401, 0.47554, 0.47684, 0.47802, 0.47909, 0.48025, 0.48155, 0.48286, 0.48412, 0.4853, 0.48637, 0.48734, 0.48821, 0.48881, 0.48917, 0.48967, 0.49038, 0.4912, 0.49216, 0.49308, 0.49365, 0.49386, 0.49422, 0.49484, 0.49548, 0.49609, 0.49654, 0.49668, 0.49659, 0.49655, 0.49668, 0.49695, 0.4972, 0.4974, 0.49749, 0.49758, 0.49785, 0.49792, 0.4977, 0.49716, 0.49636, 0.49535, 0.49434, 0.49409, 0.49451, 0.49478, 0.49454, 0.49401, 0.4932, 0.49225, 0.49147, 0.49073, 0.49019, 0.48958, 0.489, 0.48869, 0.48815, 0.48723, 0.48632, 0.48532, 0.48394, 0.48264, 0.4816, 0.4806, 0.47957, 0.47848, 0.47737, 0.47633, 0.47514, 0.47372, 0.47233, 0.47118, 0.47024, 0.46923, 0.46805, 0.46676, 0.46552, 0.46431, 0.4631, 0.462, 0.46093, 0.45977, 0.45864, 0.45761, 0.45671, 0.45598, 0.45514, 0.45423, 0.45315, 0.45189, 0.45062, 0.44939, 0.44796, 0.44618, 0.44464, 0.44334, 0.44208, 0.44062, 0.43913, 0.43768, 0.4361, 0.43427, 0.43209, 0.42979, 0.42746, 0.425, 0.42249, 0.42024, 0.41815, 0.41614, 0.41422, 0.41224, 0.41021, 0.40795, 0.40577, 0.40386, 0.40197, 0.3999, 0.39773, 0.39567, 0.39335, 0.39109, 0.38932, 0.38807, 0.38705, 0.38573, 0.38405, 0.38215, 0.38013, 0.37795, 0.37577, 0.37376, 0.37178, 0.36983, 0.3679, 0.36613, 0.3644, 0.36249, 0.36055, 0.35875, 0.357, 0.35512, 0.35311, 0.351, 0.34897, 0.34689, 0.34456, 0.34218, 0.33973, 0.33703, 0.33453, 0.33265, 0.33106, 0.32953, 0.32789, 0.32622, 0.32468, 0.32301, 0.32137, 0.31958, 0.31775, 0.31596, 0.31413, 0.31253, 0.31129, 0.31034, 0.30926, 0.30788, 0.30612, 0.30408, 0.30211, 0.30008, 0.29819, 0.29648, 0.29485, 0.29349, 0.29183, 0.2899, 0.28825, 0.28679, 0.28552, 0.28458, 0.28362, 0.28252, 0.28154, 0.28046, 0.27948, 0.27904, 0.27893, 0.27876, 0.27833, 0.2777, 0.27707, 0.27639, 0.2754, 0.27431, 0.27328, 0.27226, 0.27144, 0.27083, 0.27046, 0.27026, 0.27, 0.26953, 0.26902, 0.26868, 0.26845, 0.2684, 0.26839, 0.26856, 0.2687, 0.26838, 0.26791, 0.26742, 0.26705, 0.26683, 0.26654, 0.2663, 0.26603, 0.26573, 0.26556, 0.26565, 0.26595, 0.26633, 0.26684, 0.26726, 0.2674, 0.26742, 0.26717, 0.26659, 0.2661, 0.26592, 0.266, 0.26593, 0.26566, 0.26521, 0.26469, 0.26454, 0.26459, 0.26464, 0.26464, 0.26419, 0.26354, 0.26309, 0.26315, 0.2636, 0.264, 0.26428, 0.26475, 0.26502, 0.26508, 0.26532, 0.26542, 0.26563, 0.26607, 0.26676, 0.2676, 0.26851, 0.26937, 0.27013, 0.27076, 0.27112, 0.27157, 0.27208, 0.2728, 0.27362, 0.27458, 0.27569, 0.27666, 0.27766, 0.27854, 0.27949, 0.2806, 0.28167, 0.28269, 0.28369, 0.28466, 0.28568, 0.2869, 0.28832, 0.28969, 0.2909, 0.29198, 0.29308, 0.29407, 0.29506, 0.29613, 0.29709, 0.29802, 0.29893, 0.29988, 0.30066, 0.3015, 0.30293, 0.30478, 0.30685, 0.30895, 0.31103, 0.31344, 0.31582, 0.31763, 0.31917, 0.32082, 0.32272, 0.32454, 0.3264, 0.32834, 0.33009, 0.33186, 0.33352, 0.33496, 0.33627, 0.33775, 0.33952, 0.34142, 0.34308, 0.34448, 0.34588, 0.34723, 0.34893, 0.35097, 0.35319, 0.35563, 0.35801, 0.36025, 0.36259, 0.36481, 0.36667, 0.36841, 0.37025, 0.37199, 0.3735, 0.37498, 0.37627, 0.37757, 0.37892, 0.37986, 0.38089, 0.38254, 0.38455, 0.38654, 0.38838, 0.39009, 0.3918, 0.39354, 0.39515, 0.39684, 0.39883, 0.40107, 0.40346, 0.40569, 0.40772, 0.40968, 0.4113, 0.41285, 0.41499, 0.41748, 0.4197, 0.42157, 0.42318, 0.42454, 0.42592, 0.42755, 0.42943, 0.43127, 0.43285, 0.43414, 0.43521, 0.43651, 0.43783, 0.43903, 0.44042, 0.44176, 0.44305, 0.44439, 0.44586, 0.44724, 0.44839, 0.44927, 0.4498, 0.45022, 0.45074, 0.45173, 0.45282, 0.45365, 0.45443, 0.45505, 0.45543, 0.45564, 0.45591, 0.45623, 0.45636, 0.45656, 0.45702, 0.45732, 0.4575, 0.45778, 0.45818, 0.45848, 0.45848, 0.45839, 0.45826, 0.45803, 0.45776, 0.45747, 0.4572, 0.45703, 0.45718, 0.45735, 0.45727, 0.45706, 0.45666, 0.45619, 0.45571, 0.4553, 0.45498, 0.45474, 0.45443, 0.45413, 0.45391, 0.4534, 0.4526, 0.45168, 0.45078, 0.44993, 0.44924, 0.44875, 0.44826, 0.44767, 0.44715, 0.44663, 0.44593, 0.44523, 0.44466, 0.44387, 0.44278, 0.44169, 0.44054, 0.43934, 0.43812, 0.43664, 0.43507, 0.43372, 0.43227, 0.43068, 0.42884, 0.4266, 0.42445, 0.42269, 0.42122, 0.41989, 0.41844, 0.41687, 0.41528, 0.41363, 0.41178, 0.40992, 0.40821, 0.40666, 0.40539, 0.40417, 0.40291, 0.40147, 0.39981, 0.39818, 0.39653, 0.3948, 0.39306, 0.3913, 0.38956, 0.38784, 0.38594, 0.38372, 0.38147, 0.37973, 0.37852, 0.3773, 0.37568, 0.37382, 0.37177, 0.36963, 0.36782, 0.36616, 0.36442, 0.36291, 0.36137, 0.35938, 0.35711, 0.35503, 0.35322, 0.35161, 0.35001, 0.3481, 0.34619, 0.3444, 0.34286, 0.34171, 0.3406, 0.33918, 0.33749, 0.33577, 0.33435, 0.33304, 0.33149, 0.32991, 0.32827, 0.32644, 0.32448, 0.32262, 0.32075, 0.31855, 0.31629, 0.31402, 0.31178, 0.30971, 0.30774, 0.30554, 0.30306, 0.30062, 0.29852, 0.29665, 0.2949, 0.29384, 0.29302, 0.29203, 0.29076, 0.28911, 0.28734, 0.28539, 0.28341, 0.28154, 0.27974, 0.27816, 0.27684, 0.27537, 0.27371, 0.27212, 0.2707, 0.26953, 0.26833, 0.26696, 0.26559, 0.26404, 0.26253, 0.26119, 0.25992, 0.2588, 0.25782, 0.25684, 0.25599, 0.25549, 0.25493, 0.25397, 0.25285, 0.25157, 0.25032, 0.24924, 0.248, 0.24688, 0.24623, 0.24588, 0.24537, 0.24466, 0.24411, 0.24344, 0.24242, 0.24148, 0.24068, 0.2399, 0.23919, 0.23866, 0.23825, 0.23785, 0.2374, 0.23703, 0.23681, 0.23695, 0.23705, 0.23673, 0.23627, 0.23562, 0.23485, 0.234, 0.23354, 0.2335, 0.23355, 0.23388, 0.23455, 0.23539, 0.23608, 0.23653, 0.23701, 0.23754, 0.23806, 0.23856, 0.23903, 0.23944, 0.23936, 0.23879, 0.23836, 0.2385, 0.23905, 0.2398, 0.24066, 0.24169, 0.24306, 0.24432, 0.24543, 0.24657, 0.24761, 0.24857, 0.24951, 0.25045, 0.25157, 0.25291, 0.25412, 0.25498, 0.25585, 0.25712, 0.25853, 0.25977, 0.26051, 0.26081, 0.2612, 0.26198, 0.26327, 0.26499, 0.26681, 0.2686, 0.27033, 0.27203, 0.27372, 0.27551, 0.27733, 0.27903, 0.28055, 0.28176, 0.28296, 0.28447, 0.28623, 0.28821, 0.29012, 0.29168, 0.29336, 0.29525, 0.29664, 0.2979, 0.29959, 0.30136, 0.30317, 0.30513, 0.3072, 0.30928, 0.31127, 0.31324, 0.31497, 0.31645, 0.31795, 0.31964, 0.32175, 0.32432, 0.32689, 0.32925, 0.33164, 0.33387, 0.33599, 0.33792, 0.33962, 0.34148, 0.34373, 0.3463, 0.34899, 0.35167, 0.35426, 0.35665, 0.35871, 0.36035, 0.36156, 0.36262, 0.36396, 0.36556, 0.36734, 0.36927, 0.37122, 0.37299, 0.37448, 0.37588, 0.37739, 0.37869, 0.37971, 0.381, 0.38261, 0.38418, 0.38544, 0.3864, 0.38746, 0.38898, 0.39077, 0.39264, 0.39448, 0.39627, 0.39818, 0.40018, 0.40206, 0.40382, 0.40545, 0.40706, 0.40859, 0.41014, 0.41188, 0.41381, 0.41564, 0.41719, 0.41876, 0.42026, 0.42149, 0.42233, 0.42319, 0.42449, 0.42598, 0.42753, 0.42912, 0.43071, 0.43207, 0.43303, 0.43389, 0.43476, 0.43571, 0.43667, 0.43767, 0.43872, 0.43935, 0.43981, 0.44036, 0.4411, 0.44194, 0.4428, 0.44375, 0.44464, 0.44524, 0.4453, 0.44516, 0.44511, 0.44521, 0.44546, 0.44572, 0.44622, 0.44688, 0.44741, 0.44765, 0.44767, 0.44771, 0.44779, 0.44791, 0.44792, 0.44772, 0.44745, 0.44725, 0.4472, 0.44714, 0.44694, 0.44679, 0.44682, 0.44688, 0.44698, 0.44719, 0.4473, 0.44718, 0.44684, 0.44629, 0.44572, 0.44541, 0.44531, 0.44511, 0.44445, 0.44335, 0.44202, 0.44078, 0.43964, 0.43866, 0.43802, 0.43739, 0.4366, 0.43582, 0.43497, 0.43385, 0.43265, 0.43161, 0.43087, 0.43034, 0.42968, 0.42859, 0.42719, 0.42596, 0.42542, 0.42533, 0.42516, 0.42502, 0.42469, 0.42378, 0.42267, 0.4216, 0.42043, 0.41939, 0.41875, 0.41842, 0.41805, 0.41746, 0.41668, 0.41572, 0.41466, 0.41361, 0.41277, 0.41225, 0.41188, 0.4113, 0.41051, 0.40973, 0.40875, 0.40767, 0.4065, 0.40526, 0.40421, 0.40312, 0.40206, 0.40099, 0.39979, 0.39856, 0.39735, 0.3961, 0.39463, 0.39302, 0.39149, 0.3901, 0.38883, 0.38754, 0.38617, 0.3848, 0.3833, 0.38194, 0.38097, 0.38022, 0.37945, 0.37843, 0.3772, 0.37604, 0.37498, 0.37385, 0.3728, 0.37169, 0.37051, 0.36934, 0.36787, 0.36614, 0.36451, 0.36313, 0.36187, 0.36094, 0.36041, 0.35983, 0.35912, 0.35833, 0.35753, 0.35672, 0.3559, 0.35503, 0.35402, 0.35285, 0.3516, 0.35028, 0.34877, 0.34716, 0.34566, 0.34422, 0.3426, 0.34089, 0.33928, 0.33765, 0.33606, 0.33475, 0.33361, 0.33224, 0.33088, 0.32977, 0.32864, 0.32764, 0.32653, 0.32503, 0.32369, 0.3227, 0.32189, 0.32105, 0.31999, 0.3186, 0.31694, 0.31542, 0.31425, 0.31334, 0.31236, 0.31107, 0.30982, 0.30863, 0.3075, 0.30627, 0.30505, 0.30424, 0.30372, 0.30319, 0.30257, 0.30206, 0.30129, 0.30012, 0.2987, 0.29702, 0.29524, 0.29363, 0.29251, 0.29171, 0.29107, 0.29041, 0.28941, 0.2882, 0.287, 0.2859, 0.28482, 0.2838, 0.2828, 0.28171, 0.28064, 0.27976, 0.27916, 0.27866, 0.27832, 0.27804, 0.27766, 0.27736, 0.27724, 0.27705, 0.27688, 0.27686, 0.27661, 0.27598, 0.27515, 0.27429, 0.27351, 0.27285, 0.27232, 0.27203, 0.27179, 0.27144, 0.27102, 0.27086, 0.27099, 0.27109, 0.27092, 0.27048, 0.27002, 0.26955, 0.26898, 0.26847, 0.26799, 0.26745, 0.26704, 0.26678, 0.26656, 0.26652, 0.26659, 0.26677, 0.2673, 0.26806, 0.2689, 0.26975, 0.27041, 0.27075, 0.27118, 0.27195, 0.27249, 0.27255, 0.27257, 0.2729, 0.27335, 0.27383, 0.27476, 0.27564, 0.2761, 0.277, 0.27841, 0.28007, 0.28194, 0.28375, 0.28545, 0.28675, 0.28771, 0.28866, 0.28963, 0.29065, 0.29204, 0.29393, 0.29579, 0.29723, 0.29861, 0.30009, 0.30152, 0.3029, 0.30434, 0.3062, 0.30844, 0.31039, 0.31165, 0.31273, 0.31385, 0.31496, 0.31632, 0.31819, 0.32028, 0.32201, 0.32318, 0.32381, 0.32414, 0.32457, 0.32557, 0.32704, 0.32879, 0.33069, 0.33251, 0.3342, 0.33592, 0.33741, 0.33842, 0.33925, 0.34023, 0.34133, 0.34251, 0.34405, 0.34573, 0.34733, 0.34901, 0.35085, 0.35257, 0.35423, 0.35577, 0.35685, 0.35783, 0.35912, 0.36055, 0.36183, 0.36307, 0.36429, 0.36557, 0.36672, 0.36769, 0.36871, 0.36967, 0.37062, 0.37179, 0.37308, 0.37444, 0.37583, 0.37724, 0.37837, 0.37926, 0.3802, 0.38126, 0.38263, 0.38405, 0.38529, 0.38653, 0.38787, 0.38904, 0.39013, 0.39132, 0.39234, 0.39332, 0.39428, 0.39512, 0.39616, 0.39729, 0.39823, 0.39907, 0.39995, 0.4006, 0.4011, 0.40195, 0.40283, 0.40369, 0.40486, 0.40622, 0.4074, 0.40821, 0.40878, 0.4092, 0.40952, 0.41001, 0.41065, 0.41136, 0.41212, 0.41282, 0.41336, 0.41392, 0.41477, 0.41562, 0.41624, 0.41676, 0.41739, 0.41804, 0.41857, 0.41884, 0.41912, 0.41969, 0.42042, 0.42114, 0.42194, 0.42282, 0.4237, 0.42436, 0.42467, 0.42507, 0.42564, 0.42634, 0.42714, 0.42798, 0.42864, 0.4291, 0.42938, 0.42935, 0.42933, 0.42967, 0.43025, 0.43083, 0.43127, 0.43127, 0.4309, 0.4306, 0.43016, 0.42988, 0.42975, 0.42955, 0.42939, 0.42919, 0.42896, 0.42863, 0.42811, 0.42752, 0.42684, 0.42626, 0.42604, 0.42589, 0.42573, 0.42527, 0.42451, 0.42353, 0.42258, 0.42208, 0.42178, 0.42138, 0.42067, 0.41956, 0.4183, 0.41717, 0.41618, 0.4154, 0.41502, 0.41476, 0.4142, 0.41338, 0.41238, 0.41122, 0.40994, 0.40864, 0.40742, 0.4065, 0.40597, 0.40531, 0.40451, 0.40359, 0.40245, 0.40132, 0.40032, 0.3994, 0.3982, 0.39678, 0.39561, 0.39499, 0.39466, 0.3941, 0.39329, 0.39227, 0.39118, 0.39018, 0.38935, 0.38877, 0.38836, 0.38795, 0.38736, 0.38644, 0.38528, 0.38378, 0.38215, 0.38056, 0.37901, 0.37776, 0.37669, 0.37562, 0.37444, 0.3732, 0.37185, 0.37035, 0.36877, 0.36725, 0.36555, 0.36363, 0.36168, 0.35982, 0.35798, 0.35617, 0.35436, 0.3526, 0.35105, 0.34979, 0.34839, 0.34676, 0.34512, 0.34333, 0.34162, 0.34023, 0.3389, 0.3376, 0.33622, 0.33445, 0.33252, 0.3308, 0.32955, 0.32836, 0.32689, 0.32546, 0.32417, 0.323, 0.3217, 0.32041, 0.31941, 0.31853, 0.31776, 0.31709, 0.31627, 0.31551, 0.31463, 0.31345, 0.31219, 0.31105, 0.30995, 0.30875, 0.30755, 0.30617, 0.30491, 0.30354, 0.30197, 0.30071, 0.29973, 0.29938, 0.29918, 0.29854, 0.29777, 0.29719, 0.29662, 0.29561, 0.2945, 0.29346, 0.29239, 0.29129, 0.29044, 0.28991, 0.28905, 0.28779, 0.28652, 0.28546, 0.2843, 0.28311, 0.28207, 0.28111, 0.28023, 0.2794, 0.27874, 0.27823, 0.27801, 0.27782, 0.27722, 0.27655, 0.27591, 0.27529, 0.275, 0.27502, 0.27496, 0.27501, 0.27502, 0.27446, 0.27369, 0.27306, 0.27243, 0.27175, 0.27103, 0.27052, 0.27004, 0.26951, 0.26916, 0.26911, 0.26937, 0.26962, 0.26994, 0.27044, 0.27093, 0.27133, 0.27141, 0.2713, 0.27115, 0.27107, 0.27098, 0.27093, 0.27101, 0.27108, 0.2713, 0.27202, 0.27318, 0.27414, 0.27476, 0.27507, 0.27532, 0.2757, 0.27611, 0.27651, 0.27727, 0.27832, 0.27908, 0.27959, 0.28008, 0.28069, 0.28129, 0.28165, 0.28177, 0.28193, 0.28234, 0.28271, 0.28319, 0.28401, 0.28482, 0.28524, 0.28551, 0.28594, 0.28661, 0.28751, 0.28867, 0.28985, 0.29101, 0.29235, 0.29379, 0.29531, 0.29672, 0.29767, 0.29857, 0.29949, 0.30027, 0.30119, 0.3025, 0.30366, 0.30485, 0.30626, 0.30746, 0.30867, 0.31016, 0.31164, 0.31298, 0.31444, 0.31604, 0.31769, 0.31943, 0.32122, 0.3228, 0.32395, 0.3248, 0.32532, 0.32607, 0.32731, 0.32868, 0.33024, 0.33191, 0.3332, 0.33404, 0.33491, 0.3361, 0.33761, 0.33898, 0.33999, 0.34083, 0.34164, 0.34284, 0.34465, 0.34673, 0.34891, 0.35113, 0.35325, 0.35526, 0.35716, 0.359, 0.36062, 0.36209, 0.36387, 0.3657, 0.36744, 0.3691, 0.37069, 0.37229, 0.37378, 0.37547, 0.37751, 0.37941, 0.38091, 0.38214, 0.38307, 0.38403, 0.38506, 0.38607, 0.38725, 0.38857, 0.38997, 0.39149, 0.39302, 0.39413, 0.39512, 0.39647, 0.39802, 0.39964, 0.40134, 0.40326, 0.40521, 0.4068, 0.40795, 0.40886, 0.40944, 0.41002, 0.41098, 0.41202, 0.41297, 0.41405, 0.41539, 0.41674, 0.41812, 0.4197, 0.42139, 0.42296, 0.42418, 0.42511, 0.42586, 0.42652, 0.42734, 0.42827, 0.42937, 0.43074, 0.43194, 0.43288, 0.43371, 0.43468, 0.43584, 0.43695, 0.43813, 0.43933, 0.4404, 0.44133, 0.44215, 0.4428, 0.44354, 0.44454, 0.44553, 0.4463, 0.44671, 0.44662, 0.44641, 0.44631, 0.44614, 0.44601, 0.44588, 0.44597, 0.44635, 0.44679, 0.44698, 0.44661, 0.44602, 0.44531, 0.44448, 0.4439, 0.4434, 0.44289, 0.44235, 0.44163, 0.441, 0.44058, 0.44034, 0.44042, 0.44079, 0.44132, 0.44166, 0.44156, 0.44113, 0.44079, 0.4408, 0.44082, 0.44069, 0.44042, 0.43989, 0.43934, 0.43877, 0.43811, 0.43757, 0.43707, 0.43651, 0.43583, 0.43507, 0.43446, 0.43388, 0.43333, 0.43278, 0.43231, 0.43205, 0.43163, 0.43092, 0.42999, 0.42881, 0.42742, 0.42609, 0.42483, 0.42342, 0.42188, 0.42049, 0.41938, 0.41822, 0.41694, 0.4157, 0.41472, 0.41385, 0.41289, 0.4119, 0.41073, 0.40946, 0.40818, 0.4067, 0.40523, 0.404, 0.40284, 0.40168, 0.4005, 0.39931, 0.39819, 0.39712, 0.39596, 0.39483, 0.39411, 0.39368, 0.3932, 0.39252, 0.39171, 0.3908, 0.3895, 0.38803, 0.38668, 0.38533, 0.38389, 0.38224, 0.38057, 0.37911, 0.37793, 0.37709, 0.37642, 0.37574, 0.37483, 0.37352, 0.37183, 0.37015, 0.3687, 0.36734, 0.3661, 0.36491, 0.36385, 0.36312, 0.36234, 0.36153, 0.36061, 0.35935, 0.35782, 0.35606, 0.35446, 0.35315, 0.35178, 0.35041, 0.34944, 0.34881, 0.3483, 0.34754, 0.34646, 0.34542, 0.34414, 0.34277, 0.34147, 0.34004, 0.33862, 0.33724, 0.33602, 0.33499, 0.334, 0.33298, 0.33183, 0.33055, 0.32925, 0.32794, 0.3266, 0.32536, 0.32442, 0.32369, 0.3228, 0.32155, 0.32019, 0.31923, 0.31849, 0.31753, 0.31626, 0.31496, 0.31381, 0.31252, 0.31136, 0.31048, 0.30959, 0.30884, 0.30816, 0.30743, 0.3066, 0.3056, 0.30472, 0.30397, 0.30319, 0.30239, 0.30151, 0.3006, 0.29986, 0.29918, 0.29853, 0.29822, 0.29775, 0.29708, 0.29658, 0.29605, 0.29539, 0.29458, 0.29355, 0.29277, 0.29241, 0.29204, 0.29164, 0.2912, 0.29069, 0.29023, 0.28963, 0.28895, 0.28844, 0.28796, 0.28735, 0.28684, 0.28672, 0.28668, 0.28638, 0.28633, 0.28662, 0.287, 0.28746, 0.28788, 0.28825, 0.2885, 0.28851, 0.28815, 0.28764, 0.2875, 0.28794, 0.28883, 0.2895, 0.28966, 0.2897, 0.28963, 0.28938, 0.2894, 0.29002, 0.29107, 0.29206, 0.2928, 0.29335, 0.29397, 0.29457, 0.29492, 0.29523, 0.29549, 0.29578, 0.29607, 0.29652, 0.29725, 0.29795, 0.29871, 0.29995, 0.3015, 0.30256, 0.30311, 0.30405, 0.30545, 0.30673, 0.30777, 0.30863, 0.30951, 0.31027, 0.31108, 0.31198, 0.31302, 0.31406, 0.31465, 0.31541, 0.31609, 0.31687, 0.31781, 0.31873, 0.31945, 0.32001, 0.32092, 0.32198, 0.32308, 0.32426, 0.32565, 0.32716, 0.32869, 0.3305, 0.33243, 0.33434, 0.33614, 0.33791, 0.33985, 0.34166, 0.34314, 0.34437, 0.34564, 0.347, 0.34839, 0.34988, 0.35132, 0.35261, 0.35381, 0.35491, 0.35573, 0.35679, 0.35812, 0.35927, 0.36029, 0.36116, 0.36201, 0.36304, 0.36388, 0.36457, 0.36524, 0.36561, 0.36611, 0.36713, 0.36856, 0.37023, 0.372, 0.37372, 0.37524, 0.37654, 0.37789, 0.37938, 0.38085, 0.38235, 0.38388, 0.38523, 0.3864, 0.38776, 0.38937, 0.391, 0.39254, 0.3942, 0.39593, 0.39744, 0.39894, 0.4004, 0.40182, 0.40349, 0.40508, 0.40649, 0.40785, 0.40899, 0.40961, 0.40985, 0.41013, 0.41048, 0.41108, 0.41175, 0.41253, 0.41336, 0.41394, 0.41454, 0.41561, 0.41678, 0.41776, 0.4188, 0.41988, 0.42074, 0.42136, 0.42187, 0.42244, 0.42323, 0.42381, 0.42436, 0.42525, 0.42626, 0.42757, 0.42891, 0.4301, 0.43113, 0.43203, 0.43277, 0.43338, 0.43386, 0.4344, 0.43485, 0.43523, 0.43578, 0.43647, 0.43743, 0.43846, 0.43938, 0.44034, 0.44148, 0.4426, 0.44344, 0.44424, 0.44489, 0.44507, 0.44494, 0.44506, 0.44543, 0.4458, 0.44631, 0.44661, 0.44645, 0.44622, 0.44609, 0.44614, 0.44625, 0.44601, 0.44554, 0.44515, 0.44472, 0.44406, 0.44339, 0.44318, 0.44302, 0.44254, 0.44219, 0.44179, 0.44104, 0.43994, 0.43878, 0.43781, 0.43704, 0.4365, 0.4361, 0.43573, 0.4354, 0.43506, 0.43481, 0.4345, 0.43394, 0.43309, 0.43203, 0.43123, 0.43072, 0.43032, 0.42967, 0.42866, 0.42753, 0.42626, 0.42498, 0.42397, 0.42315, 0.42197, 0.42066, 0.41936, 0.41813, 0.41694, 0.41585, 0.41495, 0.41403, 0.41311, 0.4121, 0.41073, 0.4091, 0.40765, 0.40653, 0.40574, 0.40511, 0.40416, 0.40308, 0.40227, 0.40149, 0.4003, 0.39891, 0.39761, 0.39631, 0.39483, 0.39338, 0.39209, 0.39079, 0.38917, 0.38699, 0.38457, 0.38252, 0.38114, 0.38013, 0.37899, 0.37764, 0.37621, 0.37473, 0.37344, 0.37218, 0.37092, 0.36947, 0.36746, 0.36528, 0.36335, 0.36152, 0.35975, 0.35812, 0.35653, 0.3549, 0.35325, 0.35167, 0.35006, 0.34829, 0.34652, 0.34453, 0.34224, 0.34013, 0.3383, 0.33646, 0.33474, 0.3332, 0.33165, 0.32981, 0.32782, 0.32594, 0.3242, 0.32277, 0.32118, 0.31926, 0.31727, 0.31538, 0.31368, 0.31196, 0.31041, 0.3092, 0.30818, 0.30682, 0.30546, 0.30416, 0.30244, 0.30066, 0.29894, 0.29707, 0.29518, 0.29345, 0.29196, 0.29072, 0.2897, 0.28853, 0.28688, 0.28507, 0.28323, 0.28135, 0.27982, 0.27847, 0.27741, 0.27637, 0.27529, 0.27405, 0.27226, 0.27036, 0.26863, 0.26711, 0.26597, 0.26537, 0.26502, 0.26451, 0.264, 0.26333, 0.26271, 0.26204, 0.2611, 0.26035, 0.25965, 0.25889, 0.25806, 0.25685, 0.25575, 0.25511, 0.25463, 0.25417, 0.25372, 0.25343, 0.25302, 0.25256, 0.25199, 0.25113, 0.2504, 0.24977, 0.24927, 0.24873, 0.24808, 0.24753, 0.24712, 0.24678, 0.24657, 0.24647, 0.24643, 0.2463, 0.24597, 0.2454, 0.24513, 0.24521, 0.24534, 0.24596, 0.24687, 0.24727, 0.24729, 0.24771, 0.24835, 0.24915, 0.2501, 0.2508, 0.25139, 0.25212, 0.25308, 0.25406, 0.25441, 0.25459, 0.25509, 0.25566, 0.25627, 0.25673, 0.25709, 0.25736, 0.25738, 0.25747, 0.25807, 0.25896, 0.25975, 0.26069, 0.26129, 0.26173, 0.26256, 0.26345, 0.26427, 0.2652, 0.26649, 0.2678, 0.269, 0.27036, 0.27192, 0.27346, 0.27473, 0.27594, 0.27699, 0.27792, 0.27905, 0.28069, 0.28293, 0.28505, 0.28693, 0.28866, 0.2902, 0.29147, 0.29256, 0.29346, 0.29444, 0.29589, 0.29788, 0.29984, 0.30147, 0.30293, 0.30398, 0.30502, 0.30619, 0.30734, 0.30866, 0.31012, 0.31153, 0.3128, 0.31414, 0.31563, 0.31717, 0.31899, 0.32096, 0.32307, 0.32545, 0.32775, 0.32999, 0.33214, 0.33391, 0.33561, 0.33729, 0.3385, 0.33953, 0.34065, 0.34193, 0.34313, 0.34432, 0.34584, 0.34767, 0.34997, 0.35253, 0.35499, 0.35731, 0.35942, 0.36122, 0.36279, 0.36435, 0.36579, 0.36724, 0.36884, 0.37062, 0.37231, 0.37404, 0.37626, 0.37848, 0.38055, 0.38263, 0.38474, 0.38668, 0.38852, 0.39032, 0.39209, 0.3937, 0.39517, 0.39665, 0.39803, 0.39956, 0.40125, 0.4029, 0.40444, 0.40597, 0.40743, 0.4089, 0.41073, 0.41288, 0.41499, 0.41691, 0.41858, 0.42017, 0.42168, 0.42309, 0.42483, 0.4269, 0.42891, 0.43101, 0.43356, 0.43613, 0.43827, 0.44007, 0.44181, 0.44358, 0.44532, 0.44706, 0.44901, 0.45105, 0.45286, 0.45448, 0.45617, 0.45779, 0.4593, 0.46081, 0.462, 0.46305, 0.4641, 0.46509, 0.46628, 0.46793, 0.46984, 0.47146, 0.47274, 0.47354, 0.47408, 0.47462, 0.47531, 0.47611, 0.47692, 0.47788, 0.47882, 0.4795, 0.48006, 0.48051, 0.48097, 0.48177, 0.48267, 0.48337, 0.48394, 0.48448, 0.48529, 0.4858, 0.48567, 0.48555, 0.48559, 0.48604, 0.48674, 0.48738, 0.48813, 0.48853, 0.4885, 0.48845, 0.48837, 0.48825, 0.48796, 0.48709, 0.48616, 0.48543, 0.48476, 0.48415, 0.48362, 0.48315, 0.48285, 0.48282, 0.48286, 0.48288, 0.48263, 0.482, 0.48122, 0.48036, 0.47928, 0.47801, 0.47672, 0.47554, 0.47452, 0.47357, 0.47282, 0.47225, 0.47161, 0.47076, 0.46969, 0.46844, 0.46703, 0.46559, 0.46414, 0.46259, 0.46084, 0.45922, 0.45782, 0.45654, 0.4551, 0.4533, 0.4516, 0.45011, 0.44865, 0.44703, 0.44541, 0.4439, 0.44202, 0.43992, 0.43812, 0.43634, 0.43437, 0.43233, 0.43027, 0.42819, 0.42625, 0.42445, 0.42267, 0.42091, 0.41933, 0.41788, 0.41612, 0.41414, 0.41183, 0.40943, 0.40728, 0.4052, 0.40321, 0.401, 0.39871, 0.39655, 0.39419, 0.39164, 0.38902, 0.38621, 0.38325, 0.38033, 0.37781, 0.37571, 0.37356, 0.3713, 0.36904, 0.36673, 0.3644, 0.36202, 0.35975, 0.35742, 0.35493, 0.35246, 0.34991, 0.34745, 0.34491, 0.34234, 0.33991, 0.3374, 0.33497, 0.33273, 0.33038, 0.32766, 0.32505, 0.32275, 0.32046, 0.31794, 0.31493, 0.31176, 0.30868, 0.30566, 0.30285, 0.30027, 0.29791, 0.29581, 0.29381, 0.29168, 0.28962, 0.28779, 0.28584, 0.28351, 0.28105, 0.27837, 0.27554, 0.27293, 0.27043, 0.26817, 0.26641, 0.26492, 0.2633, 0.2615, 0.25974, 0.25788, 0.25573, 0.25352, 0.25142, 0.24922, 0.24671, 0.24429, 0.24214, 0.23999, 0.23787, 0.23572, 0.23378, 0.23208, 0.23037, 0.22884, 0.22722, 0.22512, 0.22295, 0.22115, 0.2193, 0.21753, 0.21603, 0.21464, 0.2132, 0.21179, 0.21036, 0.20886, 0.2074, 0.20626, 0.20522, 0.20419, 0.20349, 0.20238, 0.20132, 0.20071, 0.19979, 0.19901, 0.19835, 0.1976, 0.19667, 0.19591, 0.19502, 0.19396, 0.19284, 0.1922, 0.19212, 0.19225, 0.19262, 0.19294, 0.19288, 0.19269, 0.19248, 0.19212, 0.19164, 0.19142, 0.19111, 0.19079, 0.19026, 0.18979, 0.1898, 0.19009, 0.18993, 0.18963, 0.18954, 0.18911, 0.18874, 0.18886, 0.1887, 0.18889, 0.18925, 0.18944, 0.18933, 0.18936, 0.18978, 0.1906, 0.19159, 0.19213, 0.19247, 0.19275, 0.19315, 0.19334, 0.194, 0.19495, 0.1961, 0.197, 0.19737, 0.19777, 0.19839, 0.19858, 0.19916, 0.20011, 0.20091, 0.20176, 0.20246, 0.20302, 0.20383, 0.20509, 0.20623, 0.20758, 0.20905, 0.21026, 0.21109, 0.21194, 0.21301, 0.21443, 0.21607, 0.21796, 0.22023, 0.22244, 0.22422, 0.22559, 0.22686, 0.22774, 0.22887, 0.23016, 0.23147, 0.23334, 0.23578, 0.23816, 0.24037, 0.24267, 0.24496, 0.24783, 0.25032, 0.25243, 0.2543, 0.25593, 0.25773, 0.25968, 0.26163, 0.26346, 0.26553, 0.26803, 0.27043, 0.27306, 0.27579, 0.27813, 0.2807, 0.28288, 0.28485, 0.28684, 0.28897, 0.29145, 0.29463, 0.29825, 0.30187, 0.30509, 0.30817, 0.31075, 0.31318, 0.31635, 0.31872, 0.32112, 0.32379, 0.32659, 0.32977, 0.33331, 0.33663, 0.33982, 0.34303, 0.34643, 0.34951, 0.35255, 0.35597, 0.35942, 0.36227, 0.36461, 0.36684, 0.36898, 0.37125, 0.37391, 0.37708, 0.38021, 0.38332, 0.38638, 0.38949, 0.39259, 0.39547, 0.39785, 0.4, 0.40227, 0.40455, 0.40739, 0.40997, 0.41265, 0.41543, 0.41836, 0.42114, 0.42381, 0.42629, 0.4288, 0.43139, 0.43414, 0.43669, 0.43937, 0.44162, 0.44358, 0.44528, 0.44695, 0.44861, 0.45044, 0.45264, 0.45511, 0.45786, 0.46058, 0.46293, 0.46502, 0.46709, 0.46918, 0.47061, 0.47211, 0.47343, 0.47463, 0.47567, 0.47655, 0.47762, 0.47866, 0.4798, 0.48125, 0.48267, 0.4843, 0.48551, 0.48662, 0.48775, 0.48908, 0.49066, 0.49219, 0.49347, 0.49461, 0.49568, 0.49668, 0.49752, 0.49818, 0.49892, 0.49999, 0.50105, 0.50239, 0.50368, 0.50445, 0.50522, 0.50603, 0.50696, 0.50776, 0.50866, 0.50936, 0.51, 0.5104, 0.51077, 0.5113, 0.51155, 0.51176, 0.51216, 0.51255, 0.51288, 0.51308, 0.51314, 0.51303, 0.51287, 0.51288, 0.51272, 0.51254, 0.51215, 0.51203, 0.51151, 0.51122, 0.51081, 0.51067, 0.51032, 0.50998, 0.50992, 0.50965, 0.50911, 0.50846, 0.50786, 0.50755, 0.50738, 0.50703, 0.50639, 0.50547, 0.50452, 0.50321, 0.50198, 0.50093, 0.49987, 0.49877, 0.49758, 0.49651, 0.49545, 0.49454, 0.49379, 0.49305, 0.49224, 0.49106, 0.48995, 0.48861, 0.48711, 0.48541, 0.48398, 0.48234, 0.48076, 0.47913, 0.47729, 0.4753, 0.47333, 0.47166, 0.47006, 0.46827, 0.46636, 0.46487, 0.46355, 0.46219, 0.46064, 0.45874, 0.45649, 0.45468, 0.45261, 0.45066, 0.44886, 0.44704, 0.44513, 0.44294, 0.44062, 0.43814, 0.43541, 0.4324, 0.42978, 0.42726, 0.42478, 0.42262, 0.42063, 0.41896, 0.41751, 0.41641, 0.41492, 0.41327, 0.41117, 0.40925, 0.40715, 0.40486, 0.4023, 0.39924, 0.39582, 0.3924, 0.38948, 0.38676, 0.38448, 0.38231, 0.38013, 0.3776, 0.3747, 0.37181, 0.36903, 0.36628, 0.36355, 0.3607, 0.35778, 0.35497, 0.35192, 0.34896, 0.34619, 0.34341, 0.34096, 0.33873, 0.33645, 0.33428, 0.33201, 0.3295, 0.32681, 0.32403, 0.32148, 0.3191, 0.31681, 0.3146, 0.3123, 0.30989, 0.3073, 0.3048, 0.30289, 0.30104, 0.29894, 0.29674, 0.29466, 0.29287, 0.29113, 0.28934, 0.28738, 0.28498, 0.28238, 0.27991, 0.27774, 0.27571, 0.2741, 0.27284, 0.27166, 0.27031, 0.26828, 0.2662, 0.26434, 0.26266, 0.26124, 0.25983, 0.25853, 0.25716, 0.25566, 0.25438, 0.25286, 0.25128, 0.24973, 0.24819, 0.24674, 0.24509, 0.24296, 0.24044, 0.23814, 0.23612, 0.23456, 0.23345, 0.23224, 0.23132, 0.23078, 0.23014, 0.22945, 0.2285, 0.22727, 0.22597};
 
-double vUTC_MINUS_UT1[] = {-0.438771, -0.441294, -0.443637, -0.445805, -0.447842, -0.449829, -0.451867, -0.454054, -0.456452, -0.459058, -0.461812, -0.464618, -0.467373, -0.470011, -0.472464, -0.474703, -0.476752, -0.478673, -0.480543, -0.482439, -0.484407, -0.486467, -0.488613, -0.490852, -0.493169, -0.495531, -0.497887, -0.500166, -0.502299, -0.504262, -0.506045, -0.507666, -0.509196, -0.510734, -0.512389, -0.514229, -0.51626, -0.518427, -0.520636, -0.522786, -0.524794, -0.52662, -0.528255, -0.529729, -0.531096, -0.532414, -0.533739, -0.535116, -0.536576, -0.538141, -0.539818, -0.541602, -0.543459, -0.545339, -0.547186, -0.548944, -0.550569, -0.552037, -0.55335, -0.554551, -0.555722, 0.443037, 0.441665, 0.440116, 0.438404, 0.436611, 0.434853, 0.433226, 0.431786, 0.430546, 0.429489, 0.428559, 0.427699, 0.426857, 0.425987, 0.425038, 0.423964, 0.42275, 0.421409, 0.419964, 0.418446, 0.416897, 0.415357, 0.413867, 0.412456, 0.411135, 0.409883, 0.408646, 0.407359, 0.405941, 0.40431, 0.40244, 0.400381, 0.39824, 0.396144, 0.394198, 0.392458, 0.3909, 0.389507, 0.388234, 0.387031, 0.385843, 0.384605, 0.383208, 0.381616, 0.379861, 0.378001, 0.376091, 0.37418, 0.372312, 0.370513, 0.36879, 0.367144, 0.365556, 0.363977, 0.362335, 0.36055, 0.358542, 0.35625, 0.353686, 0.35096, 0.348239, 0.345693, 0.343446, 0.341523, 0.339862, 0.338386, 0.337008, 0.335638, 0.334192, 0.332608, 0.330853, 0.328939, 0.326902, 0.324787, 0.322649, 0.320547, 0.318536, 0.31665, 0.314884, 0.313209, 0.311582, 0.309947, 0.308234, 0.306377, 0.304315, 0.301995, 0.299458, 0.296808, 0.294183, 0.291699, 0.289415, 0.287336, 0.285421, 0.283609, 0.281835, 0.280027, 0.278128, 0.276096, 0.273913, 0.271588, 0.269155, 0.266662, 0.264171, 0.261744, 0.259426, 0.257236, 0.255136, 0.253092, 0.25105, 0.248921, 0.246617, 0.244073, 0.241256, 0.23819, 0.234995, 0.231824, 0.228801, 0.22601, 0.223482, 0.221181, 0.219026, 0.216928, 0.214814, 0.212632, 0.210374, 0.208059, 0.205703, 0.203283, 0.200789, 0.198277, 0.1958, 0.193401, 0.191112, 0.188929, 0.186822, 0.184744, 0.182625, 0.18038, 0.177935, 0.175255, 0.172358, 0.169327, 0.166279, 0.163331, 0.160563, 0.158013, 0.155673, 0.153492, 0.151392, 0.149297, 0.147151, 0.14492, 0.142588, 0.140163, 0.137634, 0.135001, 0.132299, 0.129598, 0.126942, 0.12436, 0.121884, 0.119512, 0.117194, 0.114861, 0.112435, 0.109849, 0.107078, 0.104141, 0.101104, 0.098074, 0.095158, 0.092437, 0.089951, 0.087698, 0.085629, 0.083661, 0.081701, 0.079676, 0.077533, 0.075246, 0.07281, 0.070244, 0.067581, 0.064872, 0.062159, 0.059475, 0.056852, 0.054304, 0.05183, 0.049404, 0.046997, 0.044556, 0.042022, 0.039335, 0.036481, 0.033509, 0.030508, 0.027579, 0.024806, 0.022229, 0.019851, 0.017641, 0.01555, 0.01351, 0.011444, 0.009299, 0.00705, 0.00468, 0.002187, -0.000419, -0.003117, -0.005859, -0.00858, -0.011237, -0.013802, -0.016269, -0.018653, -0.021006, -0.023411, -0.02596, -0.028733, -0.031762, -0.035012, -0.03838, -0.041731, -0.044927, -0.047868, -0.050524, -0.052942, -0.055206, -0.057409, -0.059637, -0.061948, -0.064384, -0.066965, -0.069677, -0.072479, -0.075317, -0.078132, -0.080879, -0.083525, -0.08605, -0.088449, -0.090737, -0.092949, -0.095152, -0.097437, -0.099891, -0.102574, -0.10551, -0.108658, -0.111923, -0.115184, -0.118321, -0.121265, -0.12401, -0.126607, -0.129123, -0.131619, -0.134142, -0.136728, -0.139397, -0.142156, -0.144991, -0.147873, -0.150764, -0.153625, -0.156411, -0.159076, -0.161616, -0.164042, -0.166377, -0.168668, -0.170982, -0.173413, -0.176042, -0.178915, -0.182024, -0.185302, -0.188642, -0.191934, -0.195079, -0.198033, -0.200818, -0.203492, -0.206124, -0.208763, -0.211456, -0.214249, -0.217134, -0.220079, -0.223048, -0.226005, -0.228909, -0.231742, -0.234521, -0.237254, -0.239913, -0.2425, -0.245044, -0.247587, -0.250213, -0.25303, -0.256094, -0.259383, -0.262825, -0.26631, -0.269701, -0.272882, -0.275803, -0.278473, -0.280959, -0.283345, -0.285706, -0.288091, -0.290515, -0.292971, -0.295471, -0.298027, -0.300616, -0.303207, -0.305762, -0.30825, -0.310638, -0.312912, -0.315091, -0.317211, -0.319335, -0.321536, -0.323875, -0.326383, -0.329059, -0.331865, -0.334726, -0.337549, -0.340242, -0.342731, -0.344985, -0.347031, -0.348937, -0.350793, -0.352675, -0.354636, -0.356693, -0.358832, -0.36104, -0.363286, -0.365527, -0.367718, -0.36982, -0.371803, -0.373667, -0.375432, -0.377128, -0.378809, -0.380545, -0.382401, -0.384417, -0.386583, -0.388856, -0.391178, -0.39347, -0.395643, -0.397627, -0.399395, 0.599021, 0.597567, 0.596174, 0.594781, 0.59334, 0.591829, 0.590251, 0.588627, 0.586993, 0.585379, 0.583809, 0.582297, 0.58085, 0.579461, 0.578121, 0.576836, 0.575583, 0.574306, 0.572918, 0.571344, 0.569539, 0.567495, 0.565287, 0.563043, 0.560883, 0.558894, 0.557111, 0.555521, 0.554057, 0.552629, 0.551177, 0.54965, 0.548015, 0.546261, 0.544396, 0.54244, 0.540433, 0.538443, 0.536522, 0.534704, 0.533009, 0.531439, 0.529958, 0.528505, 0.527009, 0.525388, 0.523573, 0.521527, 0.519252, 0.516786, 0.514218, 0.511673, 0.509269, 0.507075, 0.505105, 0.503331, 0.501688, 0.500107, 0.498514, 0.496853, 0.495089, 0.493208, 0.491217, 0.489143, 0.48704, 0.484959, 0.48294, 0.481006, 0.479158, 0.477382, 0.475656, 0.473927, 0.472119, 0.470152, 0.467958, 0.46551, 0.462832, 0.460013, 0.457185, 0.454477, 0.451971, 0.449683, 0.447566, 0.445533, 0.443508, 0.441444, 0.439302, 0.437064, 0.434738, 0.432348, 0.429931, 0.427539, 0.425195, 0.422913, 0.420702, 0.418554, 0.416447, 0.41434, 0.412194, 0.409984, 0.407662, 0.405168, 0.402452, 0.3995, 0.396346, 0.393065, 0.389801, 0.386688, 0.383806, 0.38116, 0.378699, 0.376338, 0.373984, 0.371561, 0.369044, 0.366431, 0.363741, 0.360998, 0.358235, 0.355492, 0.352811, 0.350219, 0.347732, 0.345355, 0.343075, 0.340861, 0.338681, 0.336477, 0.334166, 0.33168, 0.32898, 0.326074, 0.323015, 0.31991, 0.316882, 0.314026, 0.311386, 0.308946, 0.306644, 0.304404, 0.302159, 0.299862, 0.297499, 0.295074, 0.292608, 0.290126, 0.287659, 0.285243, 0.282916, 0.280697, 0.278595, 0.27661, 0.274737, 0.272943, 0.271131, 0.269246, 0.267224, 0.26502, 0.26262, 0.260045, 0.257348, 0.254631, 0.251988, 0.249478, 0.247118, 0.244875, 0.242678, 0.240444, 0.238101, 0.235633, 0.233075, 0.230463, 0.227826, 0.225183, 0.22256, 0.220025, 0.217597, 0.21527, 0.213038, 0.210884, 0.208771, 0.206648, 0.204452, 0.202092, 0.199546, 0.196842, 0.194043, 0.191236, 0.188515, 0.185943, 0.183549, 0.181336, 0.179269, 0.177276, 0.175283, 0.173232, 0.171055, 0.168744, 0.166369, 0.164023, 0.161732, 0.15948, 0.157293, 0.155218, 0.153228, 0.151273, 0.149345, 0.147415, 0.145446, 0.143368, 0.141094, 0.138609, 0.135941, 0.133149, 0.130324, 0.127565, 0.124965, 0.12257, 0.12037, 0.11833, 0.116392, 0.114476, 0.1125, 0.110419, 0.108228, 0.105944, 0.103608, 0.101255, 0.098911, 0.096609, 0.09438, 0.092239, 0.090168, 0.088144, 0.086132, 0.084072, 0.0819, 0.079547, 0.076944, 0.074062, 0.070928, 0.067618, 0.064246, 0.060935, 0.057775, 0.054804, 0.052024, 0.049409, 0.046903, 0.044427, 0.041923, 0.039359, 0.03672, 0.034035, 0.031371, 0.028782, 0.026285, 0.023886, 0.021577, 0.019341, 0.017183, 0.015071, 0.012961, 0.010793, 0.008504, 0.006035, 0.003335, 0.000398, -0.00275, -0.006006, -0.009231, -0.012298, -0.015133, -0.017753, -0.020219, -0.022601, -0.024976, -0.027398, -0.029875, -0.0324, -0.034976, -0.037591, -0.04022, -0.04283, -0.045386, -0.047856, -0.050219, -0.052478, -0.054647, -0.056755, -0.058866, -0.061045, -0.063353, -0.065832, -0.068488, -0.071337, -0.074367, -0.077506, -0.080633, -0.083624, -0.086404, -0.088987, -0.091454, -0.093897, -0.096375, -0.098912, -0.101501, -0.10412, -0.106754, -0.109379, -0.111956, -0.114459, -0.116875, -0.119192, -0.121422, -0.123604, -0.125764, -0.127913, -0.1301, -0.132367, -0.134745, -0.137252, -0.139888, -0.142628, -0.145406, -0.148135, -0.150731, -0.153136, -0.155333, -0.157352, -0.159273, -0.161164, -0.163075, -0.165025, -0.167017, -0.169035, -0.171042, -0.172995, -0.174865, -0.176634, -0.178293, -0.17984, -0.181294, -0.182688, -0.184075, -0.185521, -0.187076, -0.188773, -0.190626, -0.192626, -0.194723, -0.196859, -0.198966, -0.200968, -0.202795, -0.204409, -0.205822, -0.207102, -0.208322, -0.209544, -0.210808, -0.212121, -0.213461, -0.214783, -0.216023, 0.782811, 0.781698, 0.780652, 0.779679, 0.778771, 0.777903, 0.777045, 0.77613, 0.775074, 0.773833, 0.77239, 0.770755, 0.768967, 0.767079, 0.765161, 0.763256, 0.761429, 0.759732, 0.758188, 0.756788, 0.755489, 0.754209, 0.752865, 0.75142, 0.749898, 0.748345, 0.746811, 0.74534, 0.743927, 0.742554, 0.741241, 0.740004, 0.738845, 0.737737, 0.736598, 0.735375, 0.734035, 0.732553, 0.730937, 0.729218, 0.727457, 0.72569, 0.723979, 0.722393, 0.720964, 0.719673, 0.718458, 0.717244, 0.715988, 0.714641, 0.713172, 0.711577, 0.709877, 0.708113, 0.706334, 0.704594, 0.702935, 0.701339, 0.699801, 0.698319, 0.69688, 0.695455, 0.693974, 0.692366, 0.690576, 0.688567, 0.686335, 0.683921, 0.681407, 0.678876, 0.676345, 0.67389, 0.671543, 0.669288, 0.667076, 0.664854, 0.662575, 0.660197, 0.657694, 0.655099, 0.652471, 0.649873, 0.647351, 0.644918, 0.642599, 0.640409, 0.638336, 0.636348, 0.634404, 0.632462, 0.630483, 0.628413, 0.626195, 0.623792, 0.621202, 0.618451, 0.615597, 0.612744, 0.610003, 0.607436, 0.605026, 0.602714, 0.600426, 0.5981, 0.595704, 0.593235, 0.590713, 0.588175, 0.585673, 0.583263, 0.58099, 0.578857, 0.576824, 0.574853, 0.572917, 0.570982, 0.569009, 0.566952, 0.564777, 0.56246, 0.559976, 0.557311, 0.554487, 0.551555, 0.548596, 0.545698, 0.542948, 0.540374, 0.537951, 0.535614, 0.533304, 0.530975, 0.528584, 0.526129, 0.52363, 0.52112, 0.518635, 0.516201, 0.513837, 0.51156, 0.509379, 0.507287, 0.505257, 0.503243, 0.501191, 0.499047, 0.496763, 0.494322, 0.491733, 0.489026, 0.486249, 0.483473, 0.480768, 0.478143, 0.475622, 0.473216, 0.470893, 0.468593, 0.466253, 0.463839, 0.461363, 0.458857, 0.456351, 0.453866, 0.451416, 0.449009, 0.446652, 0.444383, 0.44217, 0.439965, 0.437716, 0.435372, 0.43289, 0.430246, 0.427482, 0.424611, 0.421637, 0.418588, 0.415511, 0.412464, 0.409505, 0.406666, 0.403956, 0.401307, 0.398652, 0.39593, 0.393103, 0.390169, 0.387174, 0.384191, 0.381283, 0.378498, 0.375865, 0.373398, 0.371092, 0.368905, 0.366792, 0.364712, 0.36262, 0.360479, 0.358259, 0.35593, 0.353446, 0.350824, 0.348089, 0.345278, 0.342434, 0.339606, 0.336833, 0.33412, 0.331449, 0.328797, 0.326115, 0.323363, 0.320531, 0.31765, 0.314766, 0.311904, 0.309082, 0.306333, 0.303683, 0.301154, 0.298763, 0.296501, 0.294308, 0.292143, 0.289969, 0.287735, 0.285396, 0.282916, 0.280266, 0.277483, 0.274639, 0.2718, 0.269026, 0.266355, 0.263795, 0.261322, 0.258882, 0.256398, 0.253816, 0.251104, 0.248267, 0.245333, 0.242328, 0.239283, 0.236229, 0.23322, 0.230302, 0.227508, 0.224836, 0.222214, 0.219571, 0.216871, 0.214098, 0.211237, 0.208288, 0.205247, 0.202087, 0.19883, 0.195535, 0.19228, 0.18914, 0.186189, 0.183463, 0.180923, 0.178449, 0.175937, 0.173332, 0.170618, 0.167805, 0.164928, 0.162025, 0.159143, 0.156324, 0.15359, 0.150948, 0.148398, 0.145932, 0.143512, 0.14107, 0.138563, 0.135979, 0.133307, 0.13051, 0.127562, 0.124471, 0.121318, 0.118172, 0.115084, 0.112092, 0.109218, 0.106455, 0.103781, 0.101131, 0.098437, 0.095673, 0.092834, 0.089934, 0.087004, 0.084102, 0.081291, 0.078608, 0.076066, 0.073655, 0.07132, 0.068995, 0.066632, 0.06421, 0.061722, 0.059168, 0.05654, 0.0538, 0.050927, 0.047942, 0.044904, 0.041903, 0.038982, 0.036159, 0.033446, 0.030826, 0.028262, 0.025713, 0.023151, 0.020581, 0.01803, 0.015539, 0.013144, 0.010868, 0.008684, 0.006581, 0.00457, 0.00263, 0.000735, -0.001146, -0.003046, -0.005009, -0.007072, -0.009248, -0.011523, -0.01388, -0.016297, -0.018757, -0.021204, -0.023574, -0.025833, -0.027976, -0.030031, -0.032068, -0.034149, -0.036274, -0.038466, -0.040709, -0.042956, -0.045157, -0.047269, -0.049251, -0.051065, -0.052679, -0.054095, -0.055364, -0.056533, -0.057658, -0.058806, -0.060037, -0.061389, -0.062885, -0.064522, -0.066256, -0.068021, -0.069761, -0.071447, -0.073054, -0.074572, -0.076018, -0.077434, -0.078877, -0.080394, -0.081999, -0.083699, -0.085456, -0.087203, -0.088869, -0.090403, -0.091781, -0.093, -0.094066, -0.095008, -0.095867, -0.096687, -0.097509, -0.098368, -0.099294, -0.100314, -0.101453, -0.102723, -0.104102, -0.105542, -0.106974, -0.108359, -0.10969, -0.11099, -0.112295, -0.113648, -0.115092, -0.116654, -0.118335, -0.120096, -0.121879, -0.123626, -0.125292, -0.126859, -0.128326, -0.129701, -0.131015, -0.132314, -0.133634, -0.135007, -0.136459, -0.137997, -0.139645, -0.14144, -0.14339, -0.145454, -0.147588, -0.1497, -0.151764, -0.15378, -0.155758, -0.157719, -0.159693, -0.161719, -0.163826, -0.166019, -0.1683, -0.170645, -0.172987, -0.175256, -0.177411, -0.179442, -0.181363, -0.183215, -0.185039, -0.186866, -0.188719, -0.190617, -0.192586, -0.1947, -0.196985, -0.199434, -0.202016, -0.204684, -0.207375, -0.21002, -0.212556, -0.214976, -0.217311, -0.219616, -0.221952, -0.224366, -0.226875, -0.229455, -0.232093, -0.234768, -0.237438, -0.24004, -0.242511, -0.244819, -0.246991, -0.249039, -0.250989, -0.2529, -0.254819, -0.256793, -0.258861, -0.261021, -0.263262, -0.265605, -0.268036, -0.270503, -0.272965, -0.275391, -0.277756, -0.28005, -0.282302, -0.284577, -0.286934, -0.289416, -0.292037, -0.294778, -0.297552, -0.300275, -0.3029, -0.305398, -0.307771, -0.310033, -0.312191, -0.31424, -0.316219, -0.318192, -0.320225, -0.322368, -0.324665, -0.327156, -0.329805, -0.332557, -0.33539, -0.338265, -0.341132, -0.343947, -0.346679, -0.349339, -0.351967, -0.354612, -0.357311, -0.360071, -0.362878, -0.365696, -0.36846, -0.371122, -0.373674, -0.376121, -0.378456, -0.380682, -0.382816, -0.384907, -0.387006, -0.389161, -0.391392, -0.393714, -0.396141, -0.398689, -0.40131, -0.403956, -0.406607, -0.40926, -0.411886, -0.414458, -0.416957, -0.419401, -0.421853, -0.424392, -0.427057, -0.429814, -0.432597, -0.435331, -0.437945, -0.440387, -0.442627, 0.555341, 0.553497, 0.551802, 0.550209, 0.548666, 0.547111, 0.545481, 0.543734, 0.541878, 0.539946, 0.53797, 0.535975, 0.533975, 0.531983, 0.530016, 0.528091, 0.526232, 0.524454, 0.522702, 0.520882, 0.518937, 0.516862, 0.514716, 0.512587, 0.510532, 0.508595, 0.506795, 0.505139, 0.503611, 0.502181, 0.500803, 0.499418, 0.497971, 0.496423, 0.494765, 0.492998, 0.491124, 0.489135, 0.487045, 0.484901, 0.482757, 0.480654, 0.478618, 0.476648, 0.47472, 0.472791, 0.470795, 0.468661, 0.466355, 0.463889, 0.461322, 0.458738, 0.456217, 0.453852, 0.451711, 0.449753, 0.447906, 0.446114, 0.444341, 0.442555, 0.440694, 0.438708, 0.43658, 0.4343, 0.431884, 0.429364, 0.426779, 0.424166, 0.42156, 0.418988, 0.416473, 0.414049, 0.411742, 0.409534, 0.40735, 0.405121, 0.402811, 0.400424, 0.39799, 0.39555, 0.393153, 0.390858, 0.388697, 0.386661, 0.384715, 0.382827, 0.380962, 0.379083, 0.377148, 0.375128, 0.373002, 0.370758, 0.368387, 0.365915, 0.363411, 0.360909, 0.358435, 0.356019, 0.353674, 0.35139, 0.349127, 0.346824, 0.344435, 0.341946, 0.339381, 0.336793, 0.334234, 0.331753, 0.32938, 0.32716, 0.325093, 0.323132, 0.32122, 0.31933, 0.317429, 0.31548, 0.313457, 0.311329, 0.309077, 0.306709, 0.304237, 0.30168, 0.299061, 0.296436, 0.293872, 0.291403, 0.289026, 0.286698, 0.284357, 0.281948, 0.279446, 0.276846, 0.274179, 0.271507, 0.268895, 0.266397, 0.264039, 0.261848, 0.259825, 0.257939, 0.256154, 0.254445, 0.252781, 0.251107, 0.249389, 0.247611, 0.245761, 0.243846, 0.24189, 0.239925, 0.237981, 0.236105, 0.234324, 0.232631, 0.230984, 0.229319, 0.227577, 0.225744, 0.223822, 0.221824, 0.219774, 0.217715, 0.215713, 0.213822, 0.212074, 0.21048, 0.209037, 0.207732, 0.206502, 0.205303, 0.204093, 0.202826, 0.201474, 0.200034, 0.198512, 0.19694, 0.195358, 0.193807, 0.1923, 0.190869, 0.18954, 0.188305, 0.187126, 0.185945, 0.184696, 0.183328, 0.181878, 0.180417, 0.179006, 0.177683, 0.176469, 0.175369, 0.174367, 0.173455, 0.172618, 0.171807, 0.17098, 0.170107, 0.169171, 0.168156, 0.16705, 0.165868, 0.164623, 0.163332, 0.162011, 0.160676, 0.159338, 0.158034, 0.15679, 0.15557, 0.154305, 0.152928, 0.151394, 0.149706, 0.147942, 0.146212, 0.144618, 0.143216, 0.14201, 0.140986, 0.140125, 0.13938, 0.138692, 0.138027, 0.137335, 0.136584, 0.135761, 0.134853, 0.133853, 0.132764, 0.131613, 0.130439, 0.12927, 0.128124, 0.126999, 0.125883, 0.124773, 0.123639, 0.122426, 0.121082, 0.119579, 0.117894, 0.116098, 0.114297, 0.112589, 0.111044, 0.109688, 0.108514, 0.10747, 0.10651, 0.105581, 0.104644, 0.103646, 0.102527, 0.101234, 0.099727, 0.098049, 0.096275, 0.094461, 0.092655, 0.090904, 0.089241, 0.087646, 0.086077, 0.084478, 0.082806, 0.08099, 0.078982, 0.076782, 0.074447, 0.072085, 0.069798, 0.067648, 0.065647, 0.063769, 0.061985, 0.060328, 0.058753, 0.0572, 0.055609, 0.053957, 0.052221, 0.050385, 0.048441, 0.046408, 0.044319, 0.042202, 0.04009, 0.038016, 0.036006, 0.034065, 0.032175, 0.030269, 0.028255, 0.026111, 0.023853, 0.021499, 0.019057, 0.016604, 0.014238, 0.012017, 0.009967, 0.008077, 0.006323, 0.004668, 0.003049, 0.001419, -0.000275, -0.002076, -0.004006, -0.006066, -0.008203, -0.010382, -0.012566, -0.014701, -0.01678, -0.018821, -0.020845, -0.022817, -0.024698, -0.026539, -0.028455, -0.030476, -0.032584, -0.034742, -0.036903, -0.039002, -0.040982, -0.042827, -0.044559, -0.046208, -0.047811, -0.049386, -0.05096, -0.05256, -0.054205, -0.055894, -0.057613, -0.059355, -0.061138, -0.062946, -0.06474, -0.066487, -0.068178, -0.069825, -0.071457, -0.073118, -0.074848, -0.076688, -0.078657, -0.080731, -0.082872, -0.08504, -0.087198, -0.089284, -0.091251, -0.093105, -0.094882, -0.096605, -0.098288, -0.099962, -0.101663, -0.103416, -0.105234, -0.10712, -0.109063, -0.111049, -0.113053, -0.115056, -0.117029, -0.118956, -0.120832, -0.122672, -0.124512, -0.126397, -0.128363, -0.130434, -0.132595, -0.134811, -0.137047, -0.139249, -0.141363, -0.143345, -0.145164, -0.146822, -0.148351, -0.149794, -0.151207, -0.15265, -0.154129, -0.155619, -0.157145, -0.158726, -0.160365, -0.162024, -0.163627, -0.165165, -0.166648, -0.168034, -0.169331, -0.170593, -0.171898, -0.17334, -0.174965, -0.176785, -0.17875, -0.180788, -0.182862, -0.184925, -0.18687, -0.188667, -0.19035, -0.191942, -0.193472, -0.194994, -0.19655, -0.198159, -0.199847, -0.201624, -0.203499, -0.205456, -0.207475, -0.209507, -0.21152, -0.213527, -0.215538, -0.217555, -0.219581, -0.221631, -0.223748, -0.225986, -0.228409, -0.231037, -0.23383, -0.236697, -0.23954, -0.242283, -0.24488, -0.247343, -0.249717, -0.252052, -0.254387, -0.256743, -0.259141, -0.261593, -0.264062, -0.26656, -0.2691, -0.271667, -0.27424, -0.276794, -0.279303, -0.281759, -0.284176, -0.286568, -0.288962, -0.291395, -0.293903, -0.296517, -0.299267, -0.30215, -0.305115, -0.308072, -0.310934, -0.31364, -0.316189, -0.318595, -0.320892, -0.323114, -0.325302, -0.327485, -0.329693, -0.331967, -0.334286, -0.336625, -0.338985, -0.341348, -0.343669, -0.345916, -0.348082, -0.35017, -0.35219, -0.354157, -0.356102, -0.358078, -0.360135, -0.362309, -0.36459, -0.366979, -0.369456, -0.371966, -0.37444, -0.376836, -0.379092, -0.381216, -0.38326, -0.385249, -0.387207, -0.389157, -0.391111, -0.393072, -0.395048, -0.39706, -0.39911, -0.401187, -0.403278, -0.405367, -0.407421, -0.409427, -0.4114, -0.41337, -0.415376, -0.417468, -0.419691, -0.422063, -0.424554, -0.427092, -0.429603, -0.432024, -0.434291, -0.436362, -0.438218, -0.439888, -0.44144, -0.442925, -0.444385, -0.44586, -0.447378, -0.448949, -0.450554, -0.452163, -0.453749, -0.455279, -0.456727, -0.458072, -0.459271, -0.460336, -0.461324, -0.462302, -0.46334, -0.464481, -0.465732, -0.46707, -0.468444, -0.469783, -0.471024, -0.472129, 0.526926, 0.526142, 0.525501, 0.524956, 0.524438, 0.523886, 0.523252, 0.52252, 0.521695, 0.52079, 0.519812, 0.518773, 0.517684, 0.516568, 0.515459, 0.514394, 0.513363, 0.5123, 0.511138, 0.50983, 0.508334, 0.506641, 0.504783, 0.502817, 0.500793, 0.498819, 0.496968, 0.495275, 0.493738, 0.492341, 0.491057, 0.489826, 0.488594, 0.487338, 0.48605, 0.484712, 0.483326, 0.481898, 0.480436, 0.478958, 0.477503, 0.476107, 0.474787, 0.47354, 0.472353, 0.471192, 0.469988, 0.468665, 0.467178, 0.465524, 0.463725, 0.461827, 0.459942, 0.458164, 0.456541, 0.45508, 0.453734, 0.452435, 0.451133, 0.449822, 0.44849, 0.447115, 0.445673, 0.444153, 0.442572, 0.440957, 0.439348, 0.437768, 0.436222, 0.434713, 0.433276, 0.431916, 0.43054, 0.42908, 0.427502, 0.42577, 0.423828, 0.421662, 0.419311, 0.41687, 0.414461, 0.41219, 0.410103, 0.408183, 0.406382, 0.404645, 0.402919, 0.401149, 0.399291, 0.397362, 0.395382, 0.393381, 0.391369, 0.389311, 0.387239, 0.385211, 0.383253, 0.381367, 0.379526, 0.377692, 0.375812, 0.373846, 0.371762, 0.369529, 0.367136, 0.364614, 0.362024, 0.359435, 0.356928, 0.354575, 0.352405, 0.350397, 0.348511, 0.346706, 0.344949, 0.343194, 0.341397, 0.339541, 0.33762, 0.335643, 0.333613, 0.331539, 0.329432, 0.327301, 0.325184, 0.323107, 0.321068, 0.319027, 0.316898, 0.314656, 0.312305, 0.309832, 0.307226, 0.304546, 0.301885, 0.299337, 0.297, 0.294923, 0.293073, 0.291382, 0.289786, 0.28822, 0.286632, 0.285027, 0.28342, 0.2818, 0.280161, 0.278512, 0.276874, 0.275276, 0.273734, 0.272255, 0.27083, 0.269439, 0.268055, 0.266646, 0.265187, 0.263623, 0.261895, 0.259954, 0.257804, 0.255537, 0.253265, 0.251084, 0.249036, 0.247153, 0.245442, 0.243865, 0.242359, 0.24088, 0.239391, 0.23787, 0.236291, 0.234651, 0.232968, 0.231254, 0.229549, 0.227899, 0.226328, 0.224856, 0.223484, 0.222184, 0.220896, 0.219561, 0.218131, 0.216552, 0.214792, 0.212857, 0.210793, 0.20872, 0.206739, 0.204893, 0.203211, 0.201694, 0.200279, 0.198886, 0.197462, 0.195955, 0.194359, 0.192704, 0.191017, 0.1893, 0.187552, 0.185794, 0.184054, 0.182333, 0.180632, 0.178936, 0.177236, 0.175531, 0.173767, 0.171857, 0.169726, 0.16738, 0.164885, 0.162337, 0.159786, 0.157277, 0.154838, 0.152472, 0.150211, 0.14807, 0.146001, 0.143964, 0.141982, 0.140056, 0.13812, 0.136153, 0.134162, 0.132165, 0.130179, 0.128217, 0.126312, 0.124501, 0.122729, 0.120939, 0.119128, 0.117265, 0.115298, 0.113181, 0.110902, 0.108481, 0.105935, 0.103295, 0.100663, 0.098143, 0.095799, 0.093625, 0.091588, 0.089652, 0.087783, 0.085942, 0.084083, 0.08215, 0.080095, 0.077987, 0.075863, 0.073746, 0.071665, 0.069643, 0.067699, 0.065841, 0.064054, 0.062306, 0.060553, 0.058746, 0.056836, 0.054764, 0.052456, 0.049946, 0.047354, 0.044783, 0.042296, 0.039969, 0.037828, 0.03584, 0.033962, 0.032144, 0.030334, 0.028499, 0.026622, 0.024698, 0.022734, 0.020785, 0.018846, 0.016894, 0.014948, 0.01306, 0.011258, 0.009522, 0.007854, 0.006197, 0.0045, 0.002716, 0.000796, -0.001299, -0.003579, -0.006035, -0.008599, -0.011134, -0.013517, -0.015692, -0.017666, -0.019506, -0.021295, -0.023076, -0.024858, -0.026639, -0.028417, -0.030209, -0.032052, -0.0339, -0.035714, -0.037491, -0.039206, -0.040836, -0.042369, -0.043816, -0.045222, -0.046662, -0.048212, -0.049927, -0.051838, -0.053944, -0.056206, -0.058553, -0.060945, -0.063271, -0.065424, -0.067357, -0.069071, -0.070592, -0.071976, -0.073297, -0.074613, -0.075944, -0.077271, -0.078582, -0.079878, -0.081145, -0.082356, -0.083458, -0.084432, -0.085284, -0.086032, -0.086726, -0.087406, -0.088102, -0.088861, -0.089719, -0.090653, -0.091635, -0.092642, -0.093617, -0.094541, -0.095373, -0.096063, -0.096596, -0.097014, -0.097399, -0.097792, -0.098219, -0.098686, -0.099206, -0.099787, -0.100409, -0.101033, -0.101598, -0.102067, -0.10244, -0.102719, -0.102897, -0.102982, -0.103003, -0.103041, -0.103195, -0.103523, -0.10403, -0.104681, -0.105419, -0.106174, -0.106866, -0.107439, -0.107872, -0.108164, -0.108331, -0.108423, -0.108522, -0.108684, -0.108945, -0.109314, -0.109762, -0.110247, -0.11073, -0.111194, -0.11167, -0.112137, -0.112552, -0.112918, -0.113247, -0.11356, -0.113884, -0.114274, -0.114795, -0.115484, -0.116339, -0.117309, -0.118317, -0.119287, -0.120133, -0.1208, -0.121275, -0.121593, -0.121827, -0.122036, -0.122237, -0.122495, -0.122859, -0.123315, -0.123841, -0.124424, -0.125062, -0.125743, -0.126364, -0.126921, -0.127468, -0.128027, -0.128609, -0.129234, -0.129924, -0.130722, -0.131683, -0.132837, -0.13415, -0.135573, -0.137032, -0.138443, -0.139703, -0.140756, -0.141625, -0.142353, -0.143036, -0.143748, -0.144525, -0.145383, -0.146344, -0.147409, -0.148534, -0.149673, -0.15078, -0.151829, -0.152826, -0.153774, -0.15467, -0.155505, -0.156318, -0.157172, -0.158162, -0.159346, -0.16075, -0.162382, -0.164199, -0.166101, -0.167977, -0.169772, -0.17143, -0.172952, -0.174344, -0.175627, -0.176859, -0.178108, -0.17944, -0.180827, -0.182244, -0.183689, -0.185154, -0.186616, -0.188065, -0.189479, -0.190814, -0.192074, -0.193303, -0.194523, -0.195716, -0.196901, -0.19816, -0.19959, -0.201245, -0.20313, -0.205193, -0.207325, -0.209409, -0.211365, -0.213141, -0.214755, -0.216249, -0.217682, -0.21912, -0.220591, -0.22209, -0.223608, -0.225132, -0.226641, -0.228114, -0.229545, -0.230934, -0.232281, -0.233578, -0.234834, -0.236062, -0.237288, -0.238533, -0.239819, -0.241204, -0.24274, -0.24444, -0.246269, -0.248132, -0.24993, -0.251594, -0.253116, -0.25448, -0.255707, -0.256849, -0.25795, -0.259032, -0.260105, -0.261218, -0.262391, -0.263583, -0.264736, -0.265827, -0.266846, -0.267779, -0.268616, -0.269372, -0.27006, -0.270701, -0.271336, -0.272001, -0.272744, -0.27365, -0.27475, -0.276001, -0.277331, -0.278675, -0.279977, -0.28121, -0.282334, 0.716663, 0.715754, 0.714893, 0.714042, 0.713182, 0.712279, 0.711265, 0.710184, 0.709105, 0.708035, 0.706994, 0.706048, 0.705235, 0.7045, 0.703818, 0.703208, 0.702652, 0.702107, 0.701491, 0.700737, 0.699797, 0.698672, 0.697403, 0.696035, 0.694625, 0.693274, 0.692025, 0.690842, 0.689699, 0.688545, 0.687362, 0.686136, 0.684864, 0.683555, 0.682226, 0.680893, 0.679571, 0.678288, 0.677076, 0.675955, 0.674912, 0.673943, 0.673036, 0.672139, 0.67118, 0.670114, 0.668918, 0.667574, 0.666052, 0.664394, 0.662697, 0.661041, 0.659473, 0.658051, 0.656811, 0.655731, 0.654768, 0.653875, 0.652988, 0.652067, 0.651125, 0.650175, 0.649198, 0.648184, 0.647173, 0.646258, 0.645429, 0.644668, 0.643957, 0.643265, 0.642549, 0.641765, 0.640864, 0.6398, 0.638561, 0.63716, 0.635628, 0.634007, 0.632345, 0.630683, 0.629082, 0.627621, 0.626318, 0.625115, 0.623966, 0.62279, 0.621548, 0.620227, 0.618855, 0.617466, 0.616056, 0.614636, 0.613249, 0.611944, 0.610719, 0.60955, 0.608406, 0.607302, 0.606216, 0.605079, 0.603838, 0.602437, 0.600831, 0.599032, 0.597127, 0.595189, 0.593301, 0.591542, 0.589937, 0.58848, 0.587136, 0.58587, 0.584652, 0.58341, 0.582104, 0.580727, 0.579288, 0.577815, 0.576342, 0.574911, 0.573557, 0.572301, 0.571161, 0.570153, 0.569285, 0.568525, 0.567802, 0.567024, 0.566126, 0.565066, 0.563838, 0.562442, 0.560902, 0.559308, 0.557771, 0.556384, 0.555178, 0.554105, 0.553077, 0.552031, 0.550933, 0.549742, 0.548475, 0.547184, 0.545883, 0.544617, 0.543479, 0.542488, 0.541621, 0.540857, 0.540179, 0.539571, 0.538999, 0.538421, 0.537797, 0.537078, 0.536224, 0.535234, 0.534088, 0.532794, 0.531421, 0.530058, 0.528804, 0.527745, 0.526884, 0.526165, 0.525526, 0.524912, 0.524256, 0.523543, 0.522799, 0.522054, 0.521334, 0.52069, 0.520187, 0.519825, 0.519592, 0.519489, 0.519493, 0.519581, 0.519704, 0.519818, 0.519887, 0.519859, 0.5197, 0.519353, 0.518834, 0.518196, 0.517532, 0.516929, 0.516439, 0.516064, 0.515766, 0.515499, 0.515211, 0.51485, 0.51441, 0.513896, 0.513349, 0.512822, 0.512341, 0.511926, 0.511593, 0.51136, 0.511227, 0.51118, 0.511203, 0.511245, 0.511247, 0.511164, 0.510967, 0.510602, 0.51006, 0.509383, 0.508583, 0.507725, 0.506952, 0.506336, 0.505885, 0.505573, 0.505357, 0.505155, 0.504882, 0.504494, 0.504031, 0.503475, 0.502834, 0.502151, 0.501476, 0.500866, 0.500354, 0.49995, 0.499645, 0.499376, 0.499108, 0.498813, 0.498439, 0.497889, 0.497114, 0.496137, 0.495013, 0.493795, 0.49256, 0.491397, 0.490374, 0.489496, 0.488733, 0.488042, 0.487377, 0.486702, 0.485997, 0.485259, 0.484489, 0.483704, 0.482955, 0.482272, 0.481676, 0.48118, 0.480801, 0.480507, 0.48024, 0.479937, 0.479555, 0.479037, 0.478334, 0.477447, 0.476404, 0.475268, 0.474102, 0.472938, 0.471852, 0.470892, 0.470039, 0.469293, 0.468645, 0.467989, 0.467201, 0.466249, 0.465139, 0.463897, 0.462581, 0.461232, 0.459898, 0.458635, 0.457495, 0.456475, 0.455529, 0.454673, 0.453907, 0.453182, 0.45243, 0.451592, 0.4506, 0.449369, 0.447879, 0.446165, 0.444298, 0.44238, 0.440522, 0.438806, 0.437301, 0.435968, 0.434722, 0.433482, 0.432194, 0.43084, 0.429407, 0.427902, 0.426386, 0.424894, 0.423449, 0.422082, 0.420776, 0.419517, 0.418324, 0.417197, 0.416086, 0.414914, 0.413656, 0.412316, 0.410864, 0.409249, 0.407511, 0.405705, 0.403882, 0.402137, 0.400563, 0.399199, 0.398029, 0.397, 0.396027, 0.39502, 0.393907, 0.39265, 0.391283, 0.389902, 0.38857, 0.387319, 0.386162, 0.385108, 0.384151, 0.383287, 0.382487, 0.381692, 0.380858, 0.379961, 0.379001, 0.377929, 0.376719, 0.375391, 0.373949, 0.372428, 0.370891, 0.369418, 0.368078, 0.366899, 0.365834, 0.364813, 0.363768, 0.362642, 0.361418, 0.36012, 0.358815, 0.357582, 0.356468, 0.355478, 0.354601, 0.353851, 0.353241, 0.352758, 0.352348, 0.351953, 0.351545, 0.351101, 0.350558, 0.349884, 0.349058, 0.348079, 0.346953, 0.345753, 0.344571, 0.343479, 0.342494, 0.341601, 0.340768, 0.339924, 0.339009, 0.337979, 0.336823, 0.335565, 0.334263, 0.332971, 0.331759, 0.330694, 0.329781, 0.328997, 0.328313, 0.327703, 0.327165, 0.326669, 0.326136, 0.325487, 0.32469, 0.323723, 0.322595, 0.32137, 0.320152, 0.319049, 0.318116, 0.317323, 0.316634, 0.315993, 0.315343, 0.314632, 0.3138, 0.312788, 0.311609, 0.310353, 0.30912, 0.307976, 0.306961, 0.306091, 0.305351, 0.304711, 0.304148, 0.303615, 0.303048, 0.302413, 0.301669, 0.300774, 0.299699, 0.298457, 0.297097, 0.295697, 0.294331, 0.293059, 0.291918, 0.290922, 0.290059, 0.289281, 0.28849, 0.287633, 0.286709, 0.285735, 0.28473, 0.283692, 0.282635, 0.281619, 0.280719, 0.279963, 0.279353, 0.27889, 0.278492, 0.278094, 0.277672, 0.277166, 0.276498, 0.275618, 0.274532, 0.273282, 0.271945, 0.27063, 0.269419, 0.268346, 0.267412, 0.266581, 0.265788, 0.264959, 0.26403, 0.262956, 0.261719, 0.260343, 0.258884, 0.257425, 0.256036, 0.254764, 0.253609, 0.252575, 0.251676, 0.250907, 0.250236, 0.249613, 0.24896, 0.248181, 0.247215, 0.246052, 0.244721, 0.24326, 0.241745, 0.240255, 0.238884, 0.2377, 0.236689, 0.235796, 0.234943, 0.234049, 0.233037, 0.231916, 0.230706, 0.229441, 0.228174, 0.226975, 0.225887, 0.224898, 0.224024, 0.223285, 0.222668, 0.222136, 0.221635, 0.221117, 0.22057, 0.219972, 0.219299, 0.218528, 0.21766, 0.216729, 0.215793, 0.214926, 0.214181, 0.213576, 0.213089, 0.212657, 0.212179, 0.211585, 0.210836, 0.209962, 0.20904, 0.208152, 0.207361, 0.206715, 0.206258, 0.206011, 0.205962, 0.206055, 0.206222, 0.206416, 0.206596, 0.206709, 0.20671, 0.206605, 0.206405, 0.20611, 0.205724, 0.205289, 0.204852, 0.204482, 0.204241, 0.20414, 0.204127, 0.204102, 0.203967, 0.203664, 0.203186, 0.202572, 0.201907, 0.201268, 0.200707, 0.200255, 0.199915, 0.199706, 0.199614, 0.19964, 0.19977, 0.199954, 0.200149, 0.200323, 0.200452, 0.200532, 0.200566, 0.20054, 0.200462, 0.200367, 0.200291, 0.200276, 0.20035, 0.200497, 0.200659, 0.200747, 0.200692, 0.200473, 0.200124, 0.199718, 0.19933, 0.199021, 0.198838, 0.198799, 0.198898, 0.199089, 0.199329, 0.199579, 0.199797, 0.199946, 0.199992, 0.199903, 0.199646, 0.199224, 0.19867, 0.198028, 0.197348, 0.196679, 0.196063, 0.19552, 0.195074, 0.194678, 0.194242, 0.193689, 0.192975, 0.192107, 0.191153, 0.190199, 0.189326, 0.188592, 0.188027, 0.187635, 0.187403, 0.18731, 0.187322, 0.187386, 0.187427, 0.187401, 0.187287, 0.18705, 0.186637, 0.186055, 0.185356, 0.184624, 0.183938, 0.183358, 0.182896, 0.182501, 0.182143, 0.181763, 0.181295, 0.180675, 0.179863, 0.178876, 0.177766, 0.176634, 0.175577, 0.174662, 0.173932, 0.173405, 0.17306, 0.172819, 0.172592, 0.172301, 0.171886, 0.171308, 0.170544, 0.169591, 0.168473, 0.167229, 0.165916, 0.1646, 0.163346, 0.162201, 0.161174, 0.160222, 0.159302, 0.158337, 0.157249, 0.155997, 0.154584, 0.153051, 0.151469, 0.149915, 0.148458, 0.147142, 0.145975, 0.144948, 0.144038, 0.143225, 0.142421, 0.141578, 0.140679, 0.139702, 0.138631, 0.137456, 0.136179, 0.134841, 0.133512, 0.132281, 0.131229, 0.13038, 0.129688, 0.129075, 0.128467, 0.12778, 0.126955, 0.12598, 0.124881, 0.123709, 0.122526, 0.121427, 0.120474, 0.119689, 0.119058, 0.118537, 0.118051, 0.117536, 0.116957, 0.116284, 0.115477, 0.114526, 0.11344, 0.112237, 0.110942, 0.10961, 0.108324, 0.107151, 0.10614, 0.105302, 0.104596, 0.103942, 0.103252, 0.102479, 0.101621, 0.100692, 0.099734, 0.098795, 0.09793, 0.097185, 0.09657, 0.096077, 0.095696, 0.0954, 0.095151, 0.09491, 0.094636, 0.094283, 0.093812, 0.093212, 0.092491, 0.091669, 0.090775, 0.089868, 0.089019, 0.088291, 0.08771, 0.087241, 0.086821, 0.086398, 0.085892, 0.085228, 0.084397, 0.083465, 0.08252, 0.081662, 0.080979, 0.080492, 0.080179, 0.08002, 0.079981, 0.080024, 0.080107, 0.080117, 0.080001, 0.079748, 0.07936, 0.078857, 0.078286, 0.077707, 0.077192, 0.076777, 0.076491, 0.076346, 0.076307, 0.07629, 0.076179, 0.075837, 0.075221, 0.074355, 0.073313, 0.072185, 0.071038, 0.069929, 0.068949, 0.06812, 0.067417, 0.066805, 0.066222, 0.065618, 0.064969, 0.064271, 0.063474, 0.062519, 0.061386, 0.060091, 0.058679, 0.057219, 0.055787, 0.05446, 0.053282, 0.052238, 0.051283, 0.050349, 0.049344, 0.048134, 0.046701, 0.045123, 0.043477, 0.04188, 0.040437, 0.03923, 0.038295, 0.037573, 0.036989, 0.036505, 0.036078, 0.035654, 0.035168, 0.034574, 0.033881, 0.033095, 0.032173, 0.031134, 0.030036, 0.028953, 0.027943, 0.027058, 0.026279, 0.025579, 0.024909, 0.024197, 0.023353, 0.022294, 0.021031, 0.019613, 0.018118, 0.016713, 0.015515, 0.014559, 0.013839, 0.013317, 0.012948, 0.012645, 0.012309, 0.011848, 0.011227, 0.010435, 0.009529, 0.008556, 0.007552, 0.006577, 0.005671, 0.004844, 0.004079, 0.003402, 0.002819, 0.002243, 0.001573, 0.000728, -0.000326, -0.001593, -0.003035, -0.004593, -0.006133, -0.007537, -0.00874, -0.009737, -0.010532, -0.011176, -0.01175, -0.012325, -0.01296, -0.013704, -0.01457, -0.015537, -0.016601, -0.017727, -0.018863, -0.019942, -0.020903, -0.021678, -0.022237, -0.022603, -0.022824, -0.023003, -0.023246, -0.023618, -0.024132, -0.024748, -0.025397, -0.026017, -0.026518, -0.026829, -0.026912, -0.026759, -0.026402, -0.025929, -0.025433, -0.025001, -0.024689, -0.024524, -0.0245, -0.024585, -0.024715, -0.024884, -0.025086, -0.025277, -0.02541, -0.025432, -0.025332, -0.025178, -0.02501, -0.024897, -0.02492, -0.025157, -0.025622, -0.026235, -0.026837, -0.027331, -0.027663, -0.027807, -0.027772, -0.027592, -0.027321, -0.027017, -0.026717, -0.026488, -0.026356, -0.026296, -0.026294, -0.026342, -0.026442, -0.026575, -0.026678, -0.0267, -0.026605, -0.026377, -0.025994, -0.025508, -0.025006, -0.024613, -0.024417, -0.024438, -0.024625, -0.024855, -0.025036, -0.025071, -0.024897, -0.02452, -0.023975, -0.023317, -0.022603, -0.021931, -0.021374, -0.020965, -0.020713, -0.020609, -0.020645, -0.020828, -0.021118, -0.021488, -0.021858, -0.022168, -0.022376, -0.022472, -0.022495, -0.022542, -0.022735, -0.023147, -0.023811, -0.024672, -0.025634, -0.026572, -0.027331, -0.027886, -0.028191, -0.02827, -0.028181, -0.027987, -0.02777, -0.027625, -0.027557, -0.027624, -0.027846, -0.02821, -0.02868, -0.029222, -0.029723, -0.030125, -0.030399, -0.030541, -0.030558, -0.030489, -0.03039, -0.030377, -0.030559, -0.031023, -0.031772, -0.032708, -0.033683, -0.034578, -0.035319, -0.035865, -0.036229, -0.036431, -0.036515, -0.036572, -0.036665, -0.036863, -0.037207, -0.037682, -0.038286, -0.039027, -0.039884, -0.040766, -0.04166, -0.042507, -0.043221, -0.043809, -0.044312, -0.044795, -0.045347, -0.046039, -0.046935, -0.048105, -0.049525, -0.051092, -0.052676, -0.054138, -0.055364, -0.05631, -0.057017, -0.057586, -0.058094, -0.058603, -0.059148, -0.059806, -0.060627, -0.061601, -0.062673, -0.063794, -0.0649, -0.065962, -0.066911, -0.067679, -0.068309, -0.068849, -0.069338, -0.069819, -0.070392, -0.071211, -0.072345, -0.073715, -0.07524, -0.076824, -0.07836, -0.07968, -0.080715, -0.08153, -0.082187, -0.082757, -0.083304, -0.083864, -0.084476, -0.085189, -0.085991, -0.086876, -0.087832, -0.088823, -0.089793, -0.090684, -0.091463, -0.092097, -0.092539, -0.092848, -0.093111, -0.093407, -0.093841, -0.094481, -0.095334, -0.096386, -0.097564, -0.098748, -0.099813, -0.100708, -0.101406, -0.101886, -0.10222, -0.102528, -0.102898, -0.103369, -0.103952, -0.104741, -0.105734, -0.106832, -0.107993, -0.10918, -0.110355, -0.111483, -0.112525, -0.113444, -0.114256, -0.115021, -0.115804, -0.116669, -0.117698, -0.118899, -0.120211, -0.121547, -0.122837, -0.123961, -0.124807, -0.125401, -0.125789, -0.125999, -0.126059, -0.126049, -0.126053, -0.126143, -0.126307, -0.126579, -0.127012, -0.127535, -0.128105, -0.128701, -0.129301, -0.129855, -0.130299, -0.130633, -0.13094, -0.131327, -0.131902, -0.132738, -0.133868, -0.135186, -0.136644, -0.138144, -0.139521, -0.140717, -0.141709, -0.142448, -0.143016, -0.14344, -0.143815, -0.144249, -0.144793, -0.145416, -0.146148, -0.14698, -0.147911, -0.148942, -0.150009, -0.151041, -0.152, -0.152876, -0.153647, -0.154341, -0.155, -0.155754, -0.156715, -0.157943, -0.159414, -0.161013, -0.162676, -0.164281, -0.165671, -0.166792, -0.167692, -0.16842, -0.169027, -0.169578, -0.170115, -0.170727, -0.171474, -0.17237, -0.173359, -0.174353, -0.17529, -0.176179, -0.177019, -0.177769, -0.178368, -0.178834, -0.179222, -0.179603, -0.180049, -0.180658, -0.181514, -0.182663, -0.184093, -0.185655, -0.187129, -0.18841, -0.189458, -0.190263, -0.190858, -0.191294, -0.191673, -0.192073, -0.192564, -0.193149, -0.193838, -0.194639, -0.195543, -0.196507, -0.197444, -0.19829, -0.199008, -0.199563, -0.199915, -0.200194, -0.200454, -0.200674, -0.200966, -0.201462, -0.202254, -0.203313, -0.204587, -0.205994, -0.207365, -0.208533, -0.209407, -0.209996, -0.210329, -0.210553, -0.210754, -0.210992, -0.211363, -0.211911, -0.212616, -0.213446, -0.214361, -0.215327, -0.216294, -0.217196, -0.218012, -0.218729, -0.219317, -0.219856, -0.220351, -0.220863, -0.22154, -0.222449, -0.223619, -0.224988, -0.226417, -0.227798, -0.229004, -0.229922, -0.230524, -0.23085, -0.230982, -0.231023, -0.231061, -0.231116, -0.231221, -0.231385, -0.231601, -0.231817, -0.231936, -0.231953, -0.231866, -0.231637, -0.231256, -0.230726, -0.230069, -0.22939, -0.228701, -0.228185, -0.227908, -0.227893, -0.22808, -0.228359, -0.228683, -0.228987, -0.229218, -0.229302, -0.229245, -0.22911, -0.228963, -0.228828, -0.228777, -0.228835, -0.228969, -0.229206, -0.229564, -0.230011, -0.230429, -0.230786, -0.231027, -0.231123, -0.231079, -0.230914, -0.230668, -0.23039, -0.230169, -0.230184, -0.230434, -0.230894, -0.231473, -0.232047, -0.232515, -0.232806, -0.232826, -0.232549, -0.232043, -0.2314, -0.230692, -0.229988, -0.229406, -0.228964, -0.228655, -0.228457, -0.228299, -0.228106, -0.227846, -0.227512, -0.227097, -0.226556, -0.225892, -0.22516, -0.224445, -0.223856, -0.223511, -0.223477, -0.223737, -0.224218, -0.224797, -0.225321, -0.225702, -0.225859, -0.22578, -0.225524, -0.225164, -0.224774, -0.22444, -0.224268, -0.224267, -0.224354, -0.224557, -0.224842, -0.225162, -0.225469, -0.225704, -0.225814, -0.225791, -0.225654, -0.225428, -0.225168, -0.224974, -0.224953, -0.225159, -0.22569, -0.226539, -0.227565, -0.22858, -0.229408, -0.229958, -0.230289, -0.230426, -0.230433, -0.230393, -0.23037, -0.230397, -0.230518, -0.230748, -0.231079, -0.23149, -0.231941, -0.232385, -0.232755, -0.233004, -0.233103, -0.233145, -0.233066, -0.232913, -0.232783, -0.232802, -0.233001, -0.233454, -0.234256, -0.235307, -0.236457, -0.237533, -0.238403, -0.239008, -0.239363, -0.23954, -0.239657, -0.239822, -0.240091, -0.240483, -0.241016, -0.241696, -0.24243, -0.243189, -0.243946, -0.244677, -0.245347, -0.245909, -0.246336, -0.246629, -0.246846, -0.247029, -0.247203, -0.247516, -0.248081, -0.24892, -0.250022, -0.251263, -0.252491, -0.253587, -0.2544, -0.254977, -0.255326, -0.255526, -0.255625, -0.255733, -0.255923, -0.256253, -0.256745, -0.257338, -0.257978, -0.258628, -0.25924, -0.259767, -0.26014, -0.260381, -0.260572, -0.260733, -0.260893, -0.261144, -0.261566, -0.262211, -0.26313, -0.264284, -0.265629, -0.267053, -0.268408, -0.269566, -0.270448, -0.271057, -0.271424, -0.27174, -0.272121, -0.272641, -0.273336, -0.274191, -0.275186, -0.276197, -0.277257, -0.278259, -0.279143, -0.279866, -0.280432, -0.280807, -0.281029, -0.28121, -0.281387, -0.281638, -0.282081, -0.2828, -0.283765, -0.284896, -0.286082, -0.287208, -0.288165, -0.288901, -0.289428, -0.289785, -0.29009, -0.29043, -0.290811, -0.291324, -0.292019, -0.29284, -0.293714, -0.294625, -0.295555, -0.296459, -0.297254, -0.297903, -0.298409, -0.298761, -0.298994, -0.299203, -0.299484, -0.299895, -0.300452, -0.301158, -0.30198, -0.302861, -0.303754, -0.304515, -0.305042, -0.305322, -0.3054, -0.305389, -0.305353, -0.305338, -0.305421, -0.305683, -0.306173, -0.306869, -0.307646, -0.308425, -0.309132, -0.309734, -0.310225, -0.310588, -0.310842, -0.311079, -0.311373, -0.311731, -0.312182, -0.312853, -0.313786, -0.314935, -0.316186, -0.317426, -0.318518, -0.319363, -0.319958, -0.320348, -0.320606, -0.320827, -0.321062, -0.321334, -0.321728, -0.322277, -0.322934, -0.323598, -0.324284, -0.324988, -0.325634, -0.326205, -0.326699, -0.327113, -0.327441, -0.327767, -0.328122, -0.328623, -0.329354, -0.330383, -0.331706, -0.333215, -0.334755, -0.336155, -0.337291, -0.33812, -0.338663, -0.339002, -0.339243, -0.33953, -0.339936, -0.340478, -0.341174, -0.342002, -0.342919, -0.343875, -0.344859, -0.345789, -0.346603, -0.347323, -0.347916, -0.348363, -0.348696, -0.349016, -0.34941, -0.349957, -0.350757, -0.351858, -0.353221, -0.354705, -0.356127, -0.357296, -0.358153, -0.358637, -0.358822, -0.35888, -0.358912, -0.359029, -0.359289, -0.359682, -0.360228, -0.360899, -0.361645, -0.362403, -0.363094, -0.363628, -0.363973, -0.364128, -0.364114, -0.364019, -0.363916, -0.363832, -0.363906, -0.3642, -0.364731, -0.365519, -0.366554, -0.367758, -0.368942, -0.36991, -0.37054, -0.370887, -0.371057, -0.371209, -0.371425, -0.371742, -0.372198, -0.372768, -0.373413, -0.37406, -0.374653, -0.375158, -0.37554, -0.375772, -0.375823, -0.375673, -0.375367, -0.37497, -0.374514, -0.37406, -0.373745, -0.373661, -0.373832, -0.374238, -0.374771, -0.375271, -0.375596, -0.375628, -0.375333, -0.374783, -0.374105, -0.373434, -0.372872, -0.372472, -0.37224, -0.372122, -0.37205, -0.371964, -0.371811, -0.371541, -0.371126, -0.370566, -0.369862, -0.369037, -0.368135, -0.367229, -0.366398, -0.365688, -0.365135, -0.364773, -0.364561, -0.36442, -0.364263, -0.364005, -0.363533, -0.362816, -0.361917, -0.360953, -0.360025, -0.359223, -0.358619, -0.358238, -0.358022, -0.357894, -0.357786, -0.357634, -0.3574, -0.35706, -0.356607, -0.356044, -0.35539, -0.35473, -0.354123, -0.353607, -0.353214, -0.353033, -0.353091, -0.353318, -0.353656, -0.354037, -0.354321, -0.35436, -0.354162, -0.353744, -0.353178, -0.352588, -0.352087, -0.351768, -0.351677, -0.351766, -0.351988, -0.352294, -0.352603, -0.352838, -0.352905, -0.352729, -0.35236, -0.351842, -0.351221, -0.350581, -0.349987, -0.349531, -0.349293, -0.349415, -0.349862, -0.350525, -0.351276, -0.351947, -0.352416, -0.352634, -0.352586, -0.352358, -0.352069, -0.351775, -0.351576, -0.351556, -0.351737, -0.35206, -0.35246, -0.352833, -0.353132, -0.353343, -0.353453, -0.353458, -0.353347, -0.353089, -0.352797, -0.352533, -0.352388, -0.352469, -0.352814, -0.353419, -0.354241, -0.355172, -0.35606, -0.356776, -0.357263, -0.357495, -0.357543, -0.357525, -0.357556, -0.357712, -0.35805, -0.3586, -0.359308, -0.360054, -0.360757, -0.361405, -0.361945, -0.362344, -0.362594, -0.362701, -0.362685, -0.3626, -0.362527, -0.362573, -0.362835, -0.363382, -0.364221, -0.365318, -0.366604, -0.367915, -0.369075, -0.369934, -0.370426, -0.370584, -0.370542, -0.370434, -0.370363, -0.370426, -0.37067, -0.371095, -0.371646, -0.372217, -0.372738, -0.373167, -0.373499, -0.37371, -0.373806, -0.373742, -0.373685, -0.373687, -0.373744, -0.373904, -0.374257, -0.374858, -0.375673, -0.376614, -0.377657, -0.378759, -0.379692, -0.380339, -0.380692, -0.380766, -0.380708, -0.380674, -0.380777, -0.381038, -0.38143, -0.381926, -0.382461, -0.38296, -0.383344, -0.383626, -0.383789, -0.383784, -0.383567, -0.383196, -0.382808, -0.382431, -0.382144, -0.381973, -0.381996, -0.382251, -0.382753, -0.383454, -0.384227, -0.384999, -0.385678, -0.386129, -0.386305, -0.386312, -0.38638, -0.386559, -0.386881, -0.387344, -0.387905, -0.388512, -0.389094, -0.389611, -0.390077, -0.390426, -0.390593, -0.390604, -0.390521, -0.390442, -0.390462, -0.39061, -0.390973, -0.391587, -0.392462, -0.39357, -0.394842, -0.39611, -0.397263, -0.398224, -0.398919, -0.399378, -0.399642, -0.39984, -0.400069, -0.400433, -0.400949, -0.401619, -0.402424, -0.4033, -0.404071, -0.404664, -0.405043, -0.405164, -0.405114, -0.404944, -0.404702, -0.404425, -0.40418, -0.404114, -0.404221, -0.404633, -0.405292, -0.406121, -0.407039, -0.407956, -0.408755, -0.409345, -0.409695, -0.409864, -0.409954, -0.410058, -0.410318, -0.410811, -0.411554, -0.412469, -0.413518, -0.414597, -0.41557, -0.416364, -0.416966, -0.417377, -0.417528, -0.417476, -0.417334, -0.417212, -0.417185, -0.417341, -0.417716, -0.418335, -0.419174, -0.420115, -0.42101, -0.421733, -0.422202, -0.422444, -0.422502, -0.422453, -0.422455, -0.422566, -0.422905, -0.423497, -0.424361, -0.425449, -0.426591, -0.42772, -0.428809, -0.429777, -0.430597, -0.431243, -0.431725, -0.432107, -0.432497, -0.432972, -0.433615, -0.434473, -0.435545, -0.436876, -0.438401, -0.43995, -0.441407, -0.442619, -0.443511, -0.444179, -0.444632, -0.444954, -0.445344, -0.445929, -0.446731, -0.447683, -0.44873, -0.44977, -0.450733, -0.45155, -0.45214, -0.452502, -0.45263, -0.452541, -0.452348, -0.452118, -0.451968, -0.451975, -0.45221, -0.452676, -0.45344, -0.454446, -0.455569, -0.456704, -0.457757, -0.458608, -0.459242, -0.459682, -0.460009, -0.460378, -0.460881, -0.46154, -0.462362, -0.463326, -0.464366, -0.465406, -0.466345, -0.467149, -0.467751, -0.468166, -0.468355, -0.468424, -0.468387, -0.468279, -0.468262, -0.468304, -0.46848, -0.46885, -0.469328, -0.469874, -0.470411, -0.470867, -0.471151, -0.471172, -0.471015, -0.470717, -0.47044, -0.470301, -0.470372, -0.470595, -0.470982, -0.471425, -0.471897, -0.472309, -0.472571, -0.472623, -0.472415, -0.472003, -0.471465, -0.470858, -0.470293, -0.469771, -0.469367, -0.469125, -0.469029, -0.469118, -0.469343, -0.469547, -0.469683, -0.469669, -0.469469, -0.469002, -0.468375, -0.467605, -0.466881, -0.466359, -0.466073, -0.465948, -0.465866, -0.465747, -0.465525, -0.465147, -0.464604, -0.463873, -0.462948, -0.461923, -0.460871, -0.45986, -0.458968, -0.458231, -0.457669, -0.457318, -0.457191, -0.45721, -0.457298, -0.457357, -0.457282, -0.456994, -0.456476, -0.455774, -0.455027, -0.454375, -0.453927, -0.45378, -0.4539, -0.454152, -0.454404, -0.454557, -0.454614, -0.454519, -0.454252, -0.453819, -0.453232, -0.452618, -0.451964, -0.451396, -0.450946, -0.45069, -0.450677, -0.450907, -0.451323, -0.451857, -0.452402, -0.452818, -0.453012, -0.452983, -0.452811, -0.452466, -0.45211, -0.45184, -0.45182, -0.452083, -0.452575, -0.453161, -0.453711, -0.454086, -0.454275, -0.454195, -0.453811, -0.453192, -0.452424, -0.451621, -0.450887, -0.450351, -0.45008, -0.450102, -0.450422, -0.450972, -0.45164, -0.452298, -0.452857, -0.453157, -0.453197, -0.453032, -0.452743, -0.452446, -0.452268, -0.452329, -0.452646, -0.453184, -0.453931, -0.454742, -0.455438, -0.455961, -0.456348, -0.45656, -0.456634, -0.456647, -0.456655, -0.456741, -0.456929, -0.457137, -0.457579, -0.458231, -0.459095, -0.460153, -0.461287, -0.462352, -0.463298, -0.463902, -0.464175, -0.464233, -0.464212, -0.464265, -0.464504, -0.464965, -0.46562, -0.466428, -0.467317, -0.46822, -0.469041, -0.469693, -0.470108, -0.470286, -0.470315, -0.470288, -0.470266, -0.470298, -0.47046, -0.470849, -0.471503, -0.472419, -0.473556, -0.474853, -0.476163, -0.477341, -0.478352, -0.479059, -0.479503, -0.479833, -0.480174, -0.480665, -0.481382, -0.482305, -0.483391, -0.484522, -0.485622, -0.486604, -0.487377, -0.487945, -0.488264, -0.488381, -0.48839, -0.488361, -0.488316, -0.488446, -0.488732, -0.48918, -0.489843, -0.490709, -0.491723, -0.492816, -0.493858, -0.494681, -0.495313, -0.495699, -0.495909, -0.496104, -0.496484, -0.49709, -0.497906, -0.498904, -0.499963, -0.501023, -0.501941, -0.502589, -0.503075, -0.503352, -0.503395, -0.503288, -0.503131, -0.503004, -0.502949, -0.502973, -0.503188, -0.503631, -0.504263, -0.505009, -0.505848, -0.506691, -0.507395, -0.507878, -0.508158, -0.508328, -0.508507, -0.508784, -0.509335, -0.510181, -0.511269, -0.512456, -0.513655, -0.514761, -0.515702, -0.516415, -0.516891, -0.517218, -0.517403, -0.517485, -0.517525, -0.517582, -0.517706, -0.517973, -0.518436, -0.519053, -0.51974, -0.520463, -0.521191, -0.521874, -0.522405, -0.522754, -0.522942, -0.523176, -0.523545, -0.524069, -0.524876, -0.526032, -0.527455, -0.529023, -0.530555, -0.531899, -0.532979, -0.53376, -0.534304, -0.534695, -0.535121, -0.53564, -0.536288, -0.537105, -0.538099, -0.539295, -0.540706, -0.542305, -0.544027, -0.545726, -0.547343, -0.548826, -0.550107, -0.551212, -0.552216, -0.553158, -0.554124, -0.55523, -0.5565, -0.557891, -0.559377, -0.560905, -0.562288, -0.563396, -0.56416, -0.564583, -0.56476, -0.564808, -0.564849, -0.564937, -0.565114, -0.565442, -0.566024, -0.566874, -0.567939, -0.569128, -0.570319, -0.57141, -0.572319, -0.572978, -0.573354, -0.573531, -0.573623, -0.573847, -0.574313, -0.575076, -0.576062, -0.577231, -0.578517, -0.579796, -0.580854, -0.581585, -0.582065, -0.582345, -0.582586, -0.582843, -0.583175, -0.583653, -0.5843, -0.585145, -0.586182, -0.587395, -0.588758, -0.590175, -0.591602, -0.592923, -0.594046, -0.594902, -0.595502, -0.595957, -0.596468, -0.597114, -0.59799, -0.599113, -0.60044, -0.601849, -0.603197, -0.604406, -0.60544, -0.606232, -0.606792, -0.607171, -0.607429, -0.607676, -0.607927, -0.608308, -0.608865, -0.609586, -0.610413, -0.611367, -0.612394, -0.613354, -0.614219, -0.614838, -0.615132, -0.615113, -0.614859, -0.61456, -0.614407, -0.61449, -0.614824, -0.615383, -0.616093, -0.61682, -0.617375, -0.617671, -0.617769, -0.617632, -0.617303, -0.616834, -0.61626, -0.61574, -0.615344, -0.615058, -0.6149, -0.614906, -0.61507, -0.615378, -0.615773, -0.616124, -0.6163, -0.616233, -0.615941, -0.615464, -0.614956, -0.614575, -0.614415, -0.614536, -0.614801, -0.615127, -0.615392, -0.615544, -0.615456, -0.615103, -0.614447, -0.613536, -0.612509, -0.611458, -0.610465, -0.609613, -0.608896, -0.608333, -0.607994, -0.607833, -0.607765, -0.607752, -0.607678, -0.607473, -0.607107, -0.606492, -0.605696, -0.604837, -0.60404, -0.603401, -0.60315, -0.603252, -0.603647, -0.60414, -0.604576, -0.604837, -0.604849, -0.604656, -0.604209, -0.603642, -0.603022, -0.602371, -0.601762, -0.601252, -0.600955, -0.600889, -0.60106, -0.60139, -0.601837, -0.602253, -0.602552, -0.602666, -0.602577, -0.602222, -0.601756, -0.601347, -0.600991, -0.60089, -0.60113, -0.601703, -0.602445, -0.603083, -0.603499, -0.603652, -0.60353, -0.603067, -0.602405, -0.601561, -0.600649, -0.599794, -0.599095, -0.598644, -0.598494, -0.598609, -0.598849, -0.599217, -0.599661, -0.600131, -0.600514, -0.600724, -0.600739, -0.600569, -0.600392, -0.600374, -0.600592, -0.601141, -0.602067, -0.603275, -0.604569, -0.605783, -0.606745, -0.607391, -0.60772, -0.607771, -0.607655, -0.607462, -0.607313, -0.607221, -0.607303, -0.607604, -0.60806, -0.608723, -0.609474, -0.610217, -0.610865, -0.611353, -0.611696, -0.611937, -0.612022, -0.612021, -0.612055, -0.612224, -0.612641, -0.613355, -0.614384, -0.615552, -0.616706, -0.617741, -0.618575, -0.619158, -0.619512, -0.619722, -0.619868, -0.620004, -0.620236, -0.62054, -0.620978, -0.621643, -0.622469, -0.623486, -0.62458, -0.625642, -0.626568, -0.627302, -0.627833, -0.628082, -0.628252, -0.628408, -0.62873, -0.629315, -0.630293, -0.631549, -0.632994, -0.634452, -0.635795, -0.636902, -0.637707, -0.638262, -0.638601, -0.638765, -0.639, -0.639332, -0.639805, -0.640405, -0.641146, -0.642022, -0.643012, -0.644062, -0.645074, -0.645954, -0.646628, -0.647089, -0.647354, -0.647493, -0.647623, -0.647739, -0.648003, -0.648565, -0.649323, -0.650265, -0.651242, -0.652128, -0.652883, -0.653455, -0.653806, -0.653936, -0.654, -0.654038, -0.654123, -0.654315, -0.654658, -0.655228, -0.655963, -0.656824, -0.657759, -0.658683, -0.659547, -0.660277, -0.660783, -0.661094, -0.66114, -0.661124, 0.338817, 0.338585, 0.338108, 0.33741, 0.336543, 0.335587, 0.334679, 0.333957, 0.333494, 0.333291, 0.333308, 0.3335, 0.333773, 0.334, 0.334089, 0.334076, 0.333944, 0.333646, 0.333133, 0.332545, 0.331882, 0.331191, 0.330541, 0.32999, 0.329517, 0.32912, 0.328724, 0.328274, 0.327696, 0.326865, 0.325729, 0.324299, 0.322726, 0.321182, 0.319757, 0.318628, 0.317788, 0.317217, 0.316819, 0.316468, 0.316078, 0.315603, 0.314995, 0.314222, 0.31334, 0.312376, 0.311352, 0.310262, 0.309146, 0.308089, 0.307134, 0.306373, 0.305827, 0.305424, 0.30505, 0.304514, 0.303705, 0.302493, 0.300894, 0.299007, 0.29701, 0.295186, 0.293602, 0.292331, 0.291409, 0.290764, 0.290303, 0.289924, 0.289569, 0.289175, 0.288673, 0.28798, 0.287118, 0.286114, 0.285061, 0.284037, 0.283102, 0.282219, 0.28147, 0.280885, 0.280394, 0.279897, 0.279325, 0.27852, 0.277337, 0.275794, 0.273965, 0.271917, 0.269862, 0.268018, 0.266501, 0.265372, 0.264554, 0.263959, 0.263409, 0.262842, 0.262194, 0.261421, 0.260437, 0.259258, 0.25803, 0.256777, 0.255536, 0.254354, 0.253332, 0.25251, 0.251858, 0.251324, 0.250831, 0.250306, 0.249663, 0.24878, 0.247564, 0.246018, 0.244259, 0.242426, 0.240648, 0.239043, 0.23771, 0.236714, 0.23597, 0.235272, 0.234486, 0.23362, 0.232622, 0.231502, 0.23022, 0.228856, 0.227397, 0.225887, 0.22439, 0.222952, 0.221632, 0.220493, 0.219557, 0.218724, 0.217967, 0.217208, 0.216292, 0.215146, 0.213795, 0.212291, 0.210709, 0.209172, 0.207809, 0.206689, 0.205928, 0.205496, 0.205288, 0.205138, 0.204917, 0.204612, 0.204132, 0.203497, 0.202748, 0.201958, 0.201199, 0.200487, 0.199918, 0.199566, 0.199478, 0.199635, 0.199984, 0.200375, 0.200666, 0.200774, 0.200624, 0.200146, 0.199401, 0.198544, 0.1977, 0.197014, 0.196498, 0.196216, 0.196114, 0.196196, 0.19631, 0.196318, 0.196176, 0.19584, 0.195272, 0.194523, 0.193606, 0.19264, 0.191674, 0.190726, 0.189909, 0.189302, 0.188897, 0.188764, 0.188743, 0.188758, 0.188676, 0.188407, 0.187809, 0.1869, 0.185794, 0.184713, 0.183791, 0.183093, 0.182668, 0.182514, 0.182589, 0.182819, 0.183082, 0.183238, 0.183269, 0.183135, 0.182894, 0.182546, 0.182114, 0.181646, 0.181184, 0.180794, 0.180573, 0.180499, 0.180545, 0.180706, 0.18091, 0.180994, 0.180835, 0.180332, 0.179495, 0.178436, 0.177321, 0.176358, 0.175652, 0.175227, 0.175053, 0.175093, 0.175255, 0.175432, 0.175478, 0.175339, 0.175031, 0.174523, 0.17388, 0.173168, 0.172444, 0.171743, 0.171122, 0.17062, 0.170303, 0.170181, 0.170148, 0.170149, 0.170042, 0.169662, 0.168951, 0.167873, 0.166471, 0.164904, 0.163377, 0.162062, 0.161073, 0.160369, 0.15983, 0.159481, 0.15918, 0.158843, 0.158384, 0.157729, 0.156882, 0.155896, 0.154771, 0.153582, 0.15244, 0.151366, 0.150399, 0.149554, 0.148833, 0.148223, 0.14759, 0.146857, 0.146001, 0.144884, 0.143409, 0.141587, 0.139449, 0.137182, 0.135007, 0.133124, 0.131586, 0.13036, 0.12932, 0.128395, 0.127569, 0.12668, 0.125672, 0.124508, 0.123204, 0.121791, 0.120306, 0.118821, 0.117375, 0.116022, 0.114794, 0.113742, 0.112856, 0.11205, 0.111313, 0.110512, 0.109529, 0.108276, 0.10674, 0.1049, 0.102895, 0.100916, 0.099132, 0.097724, 0.096644, 0.095835, 0.095145, 0.094469, 0.093751, 0.092805, 0.091744, 0.09056, 0.089312, 0.088089, 0.086845, 0.085656, 0.084578, 0.083615, 0.082778, 0.082072, 0.081463, 0.080925, 0.080319, 0.079509, 0.078413, 0.077021, 0.075384, 0.073605, 0.071803, 0.070128, 0.068745, 0.067641, 0.066753, 0.066, 0.065312, 0.064507, 0.06356, 0.062429, 0.061138, 0.059754, 0.058307, 0.05691, 0.055648, 0.054432, 0.053391, 0.052568, 0.051867, 0.051254, 0.050727, 0.050191, 0.049479, 0.048534, 0.047313, 0.045847, 0.044219, 0.042572, 0.041025, 0.039608, 0.038464, 0.037597, 0.036941, 0.036403, 0.035858, 0.035262, 0.034464, 0.033474, 0.032332, 0.031066, 0.029715, 0.028348, 0.027079, 0.025859, 0.024771, 0.023841, 0.023027, 0.0222, 0.021399, 0.020463, 0.019223, 0.017679, 0.01586, 0.013819, 0.011676, 0.009619, 0.007791, 0.006208, 0.004899, 0.003818, 0.00283, 0.001832, 0.000736, -0.00052, -0.001959, -0.003539, -0.005208, -0.006922, -0.008607, -0.010216, -0.011661, -0.012933, -0.01405, -0.015004, -0.015806, -0.016547, -0.017289, -0.018124, -0.019134, -0.020366, -0.021876, -0.023472, -0.025002, -0.026291, -0.027275, -0.028032, -0.028576, -0.029017, -0.029438, -0.029925, -0.030536, -0.031302, -0.032255, -0.033343, -0.03454, -0.035777, -0.036981, -0.03816, -0.039229, -0.040123, -0.04086, -0.041471, -0.042023, -0.042599, -0.04328, -0.044212, -0.045534, -0.04727, -0.049265, -0.051366, -0.0534, -0.05512, -0.056415, -0.057355, -0.058114, -0.058816, -0.059543, -0.060398, -0.06145, -0.062653, -0.063969, -0.065371, -0.06689, -0.068447, -0.069973, -0.071423, -0.072772, -0.074025, -0.075253, -0.076454, -0.077642, -0.078894, -0.08027, -0.081849, -0.08375, -0.085885, -0.088167, -0.090421, -0.092426, -0.094065, -0.095312, -0.096252, -0.097059, -0.097887, -0.098805, -0.099825, -0.101005, -0.102325, -0.10377, -0.105253, -0.106703, -0.108064, -0.109293, -0.110392, -0.111338, -0.112162, -0.112877, -0.113519, -0.114218, -0.115133, -0.116318, -0.11782, -0.119668, -0.121815, -0.124026, -0.1261, -0.12785, -0.129221, -0.13032, -0.131229, -0.132102, -0.13303, -0.133947, -0.134926, -0.136048, -0.137331, -0.138634, -0.139876, -0.141012, -0.142, -0.142822, -0.143473, -0.14394, -0.144216, -0.144377, -0.144564, -0.144929, -0.145516, -0.146287, -0.147245, -0.148321, -0.149451, -0.150549, -0.151459, -0.152053, -0.152329, -0.152367, -0.152298, -0.152304, -0.152493, -0.152866, -0.153426, -0.154131, -0.154883, -0.155591, -0.156211, -0.156728, -0.157098, -0.15733, -0.157424, -0.157416, -0.157377, -0.157337, -0.157421, -0.157734, -0.1583, -0.159068, -0.15998, -0.160938, -0.161819, -0.162453, -0.162776, -0.162857, -0.162719, -0.162471, -0.162174, -0.161996, -0.16199, -0.162156, -0.16248, -0.162882, -0.163262, -0.163555, -0.163723, -0.163713, -0.163512, -0.163126, -0.162572, -0.161951, -0.161355, -0.160925, -0.160739, -0.160824, -0.161188, -0.161814, -0.162607, -0.163363, -0.16396, -0.164304, -0.164351, -0.164138, -0.163751, -0.163288, -0.162906, -0.162727, -0.162746, -0.162892, -0.163132, -0.163408, -0.163639, -0.163856, -0.163993, -0.164001, -0.163853, -0.163545, -0.163115, -0.162611, -0.162173, -0.161902, -0.161899, -0.162206, -0.162843, -0.163711, -0.164689, -0.16564, -0.166398, -0.166887, -0.16712, -0.167184, -0.167226, -0.167352, -0.167646, -0.16815, -0.168869, -0.169698, -0.170593, -0.171555, -0.172452, -0.17323, -0.173865, -0.174348, -0.174711, -0.174961, -0.175178, -0.175478, -0.175935, -0.176599, -0.177546, -0.178791, -0.180395, -0.182119, -0.183751, -0.185171, -0.1863, -0.187131, -0.187715, -0.188223, -0.188756, -0.189371, -0.190086, -0.190949, -0.191933, -0.192978, -0.194058, -0.195158, -0.196161, -0.197024, -0.197703, -0.198223, -0.198649, -0.199032, -0.199481, -0.200036, -0.200752, -0.201681, -0.202828, -0.204218, -0.205838, -0.20753, -0.209062, -0.210252, -0.21108, -0.211662, -0.212155, -0.212643, -0.2132, -0.213886, -0.214736, -0.215722, -0.216744, -0.217789, -0.218842, -0.219891, -0.220838, -0.221599, -0.222172, -0.222586, -0.222909, -0.223255, -0.223718, -0.224438, -0.225429, -0.226698, -0.228277, -0.230114, -0.232095, -0.234095, -0.235938, -0.237505, -0.238764, -0.239777, -0.240684, -0.241644, -0.242752, -0.24406, -0.245555, -0.247135, -0.248739, -0.250252, -0.251588, -0.252672, -0.253506, -0.254088, -0.254446, -0.254655, -0.254809, -0.255034, -0.255391, -0.255908, -0.256638, -0.257625, -0.258833, -0.260155, -0.261465, -0.262731, -0.263833, -0.264614, -0.265167, -0.265641, -0.266158, -0.266806, -0.267625, -0.26862, -0.269758, -0.271023, -0.272245, -0.273349, -0.274325, -0.275192, -0.275954, -0.276611, -0.277205, -0.277744, -0.27826, -0.278847, -0.279572, -0.280459, -0.28155, -0.282827, -0.284206, -0.285592, -0.28691, -0.288001, -0.288795, -0.289356, -0.289784, -0.290214, -0.290806, -0.291645, -0.292758, -0.294091, -0.29559, -0.297125, -0.298604, -0.299962, -0.301109, -0.30202, -0.302752, -0.303392, -0.30397, -0.30453, -0.305205, -0.306069, -0.307147, -0.308466, -0.309973, -0.311569, -0.313229, -0.314821, -0.316175, -0.317323, -0.318233, -0.318919, -0.319478, -0.320078, -0.320877, -0.321925, -0.323157, -0.324496, -0.325838, -0.327112, -0.328286, -0.329282, -0.330058, -0.330609, -0.330968, -0.331201, -0.331436, -0.331782, -0.33224, -0.332968, -0.33399, -0.335268, -0.336755, -0.338335, -0.33981, -0.341083, -0.342085, -0.342812, -0.343333, -0.34377, -0.344277, -0.344937, -0.345811, -0.346964, -0.3483, -0.349718, -0.351215, -0.352666, -0.354036, -0.355276, -0.356342, -0.357226, -0.357962, -0.358599, -0.359254, -0.360024, -0.360992, -0.362179, -0.363636, -0.365282, -0.36712, -0.369045, -0.370804, -0.372212, -0.373278, -0.374045, -0.374628, -0.375168, -0.375775, -0.37658, -0.377649, -0.378911, -0.380253, -0.381609, -0.382934, -0.384167, -0.385235, -0.386156, -0.386927, -0.387595, -0.388199, -0.388769, -0.389394, -0.390199, -0.391215, -0.392512, -0.394077, -0.39578, -0.397614, -0.399463, -0.401147, -0.402571, -0.403662, -0.404556, -0.405414, -0.406353, -0.407479, -0.408878, -0.410467, -0.412139, -0.413811, -0.415407, -0.416828, -0.418013, -0.419016, -0.41981, -0.420363, -0.420738, -0.42103, -0.421325, -0.42172, -0.422294, -0.423071, -0.424022, -0.425129, -0.426351, -0.427594, -0.428728, -0.429673, -0.430332, -0.430767, -0.43109, -0.43144, -0.431902, -0.432529, -0.433315, -0.434258, -0.435266, -0.436184, -0.436931, -0.437492, -0.437821, -0.437989, -0.43806, -0.438026, -0.437951, -0.437902, -0.437909, -0.438096, -0.43852, -0.439194, -0.440063, -0.441033, -0.442062, -0.442981, -0.44377, -0.44438, -0.44475, -0.444937, -0.44508, -0.445356, -0.445826, -0.446466, -0.447246, -0.448062, -0.448747, -0.449323, -0.449728, -0.449868, -0.449781, -0.449538, -0.449185, -0.448772, -0.448403, -0.448161, -0.448067, -0.448194, -0.448612, -0.449227, -0.449947, -0.450717, -0.451469, -0.452101, -0.452516, -0.452714, -0.452769, -0.452734, -0.452792, -0.453009, -0.453439, -0.454051, -0.454839, -0.455626, -0.456292, -0.456804, -0.457136, -0.457279, -0.457273, -0.457143, -0.456931, -0.456718, -0.456597, -0.456612, -0.4568, -0.457147, -0.457712, -0.458462, -0.459322, -0.460135, -0.46078, -0.461245, -0.461491, -0.461579, -0.461635, -0.461766, -0.462055, -0.46254, -0.463315, -0.46428, -0.465338, -0.466393, -0.46728, -0.467959, -0.46848, -0.468781, -0.468961, -0.469082, -0.469201, -0.469446, -0.469848, -0.470478, -0.471409, -0.472632, -0.474095, -0.475709, -0.477329, -0.478799, -0.480021, -0.480986, -0.481685, -0.482262, -0.482856, -0.483503, -0.484302, -0.485365, -0.486613, -0.487984, -0.489419, -0.490783, -0.491993, -0.492992, -0.493745, -0.494285, -0.494678, -0.495025, -0.495358, -0.495836, -0.49651, -0.497413, -0.498549, -0.499912, -0.501435, -0.503033, -0.504535, -0.505923, -0.507136, -0.508155, -0.509054, -0.510026, -0.511112, -0.512328, -0.513729, -0.515322, -0.516978, -0.51862, -0.520212, -0.521696, -0.522999, -0.524071, -0.524951, -0.525697, -0.526309, -0.526927, -0.527591, -0.528302, -0.529143, -0.530182, -0.53143, -0.532882, -0.534505, -0.53618, -0.537797, -0.539194, -0.54031, -0.541169, -0.541924, -0.54277, -0.543856, -0.545269, -0.546932, -0.548762, -0.550643, -0.55247, -0.554167, -0.555704, -0.55707, -0.558314, -0.559388, -0.560333, -0.561201, -0.562092, -0.563064, -0.564118, -0.56529, -0.566647, -0.568187, -0.56983, -0.571519, -0.573121, -0.574494, -0.575614, -0.576487, -0.577155, -0.577862, -0.578761, -0.579919, -0.581251, -0.582668, -0.584124, -0.585514, -0.586736, -0.587753, -0.588583, -0.589212, -0.58962, -0.58987, -0.590063, -0.590317, -0.590666, -0.59115, -0.591869, 0.407164, 0.405984, 0.404678, 0.403352, 0.402074, 0.400911, 0.399946, 0.399227, 0.398689, 0.398131, 0.397457, 0.39651, 0.395283, 0.393852, 0.392343, 0.39089, 0.389617, 0.388554, 0.387764, 0.387252, 0.386974, 0.386842, 0.386787, 0.38674, 0.386618, 0.386329, 0.38587, 0.385198, 0.384368, 0.383434, 0.382451, 0.381539, 0.380711, 0.380043, 0.37951, 0.379075, 0.37863, 0.378091, 0.37733, 0.376306, 0.375022, 0.37359, 0.372156, 0.370884, 0.369923, 0.369211, 0.368678, 0.368304, 0.368065, 0.367918, 0.367775, 0.367599, 0.367335, 0.366862, 0.366145, 0.365213, 0.364091, 0.362836, 0.361559, 0.36033, 0.359196, 0.358194, 0.357306, 0.35654, 0.35578, 0.354878, 0.35377, 0.352389, 0.350759, 0.349016, 0.347287, 0.345701, 0.344333, 0.343197, 0.342277, 0.341542, 0.340927, 0.340348, 0.339709, 0.338933, 0.337922, 0.336677, 0.335223, 0.33362, 0.331959, 0.330299, 0.328722, 0.327345, 0.326213, 0.325292, 0.324496, 0.323709, 0.322834, 0.321812, 0.320614, 0.319169, 0.317496, 0.315717, 0.313981, 0.312407, 0.311023, 0.309861, 0.308933, 0.308166, 0.307438, 0.306654, 0.305752, 0.304728, 0.303547, 0.302179, 0.300591, 0.298831, 0.297013, 0.295257, 0.293648, 0.29223, 0.291023, 0.289972, 0.28897, 0.287903, 0.286699, 0.285296, 0.283685, 0.281926, 0.280135, 0.278432, 0.276901, 0.275646, 0.274676, 0.273922, 0.273313, 0.272773, 0.27224, 0.271652, 0.270942, 0.27009, 0.269107, 0.26799, 0.2667, 0.265262, 0.263777, 0.262376, 0.261172, 0.260144, 0.259277, 0.258525, 0.257785, 0.256935, 0.255886, 0.254607, 0.253166, 0.251709, 0.250355, 0.249162, 0.248182, 0.247423, 0.246895, 0.24651, 0.246231, 0.245974, 0.245665, 0.24525, 0.244667, 0.243928, 0.24308, 0.242154, 0.241161, 0.240125, 0.239162, 0.238353, 0.237742, 0.237349, 0.237131, 0.237002, 0.236825, 0.236536, 0.236041, 0.23537, 0.234628, 0.23393, 0.233393, 0.233089, 0.233026, 0.233162, 0.233426, 0.233792, 0.234216, 0.234624, 0.234961, 0.235149, 0.235197, 0.23512, 0.234891, 0.234591, 0.234288, 0.234, 0.233803, 0.233746, 0.233806, 0.233948, 0.2341, 0.23418, 0.2341, 0.233819, 0.233289, 0.23258, 0.231814, 0.231111, 0.230556, 0.230251, 0.230178, 0.230311, 0.23059, 0.230935, 0.231219, 0.231396, 0.231479, 0.231384, 0.23106, 0.230604, 0.230023, 0.229356, 0.228706, 0.228163, 0.227785, 0.227601, 0.227603, 0.227676, 0.227733, 0.227631, 0.227244, 0.226581, 0.225682, 0.224675, 0.223727, 0.222912, 0.222309, 0.221943, 0.221747, 0.221643, 0.221571, 0.221504, 0.221387, 0.221167, 0.22079, 0.220232, 0.219501, 0.218629, 0.217672, 0.216729, 0.215868, 0.215163, 0.214654, 0.214297, 0.214035, 0.213739, 0.213315, 0.212689, 0.211819, 0.210674, 0.209331, 0.207986, 0.206709, 0.205622, 0.204827, 0.204302, 0.20392, 0.203617, 0.203336, 0.203056, 0.202693, 0.202104, 0.201242, 0.200135, 0.198894, 0.197601, 0.196269, 0.194998, 0.193905, 0.192976, 0.192222, 0.191593, 0.191006, 0.190385, 0.189672, 0.188732, 0.187547, 0.186173, 0.184685, 0.183203, 0.181878, 0.180776, 0.179897, 0.179198, 0.178599, 0.178027, 0.177506, 0.176945, 0.176224, 0.175336, 0.174279, 0.173101, 0.171853, 0.170583, 0.169327, 0.168204, 0.167221, 0.1664, 0.165698, 0.16503, 0.164364, 0.163608, 0.162718, 0.161685, 0.160461, 0.159134, 0.157813, 0.156661, 0.155716, 0.154964, 0.154403, 0.153946, 0.153558, 0.15322, 0.152788, 0.152164, 0.151314, 0.150295, 0.149161, 0.147913, 0.146572, 0.145218, 0.143956, 0.142846, 0.141951, 0.141244, 0.140611, 0.139962, 0.13918, 0.138248, 0.137119, 0.135837, 0.134408, 0.133013, 0.131767, 0.130737, 0.129908, 0.129206, 0.128605, 0.128032, 0.12743, 0.126769, 0.126016, 0.125123, 0.124071, 0.12285, 0.12154, 0.120199, 0.118956, 0.117807, 0.116781, 0.11593, 0.115294, 0.11487, 0.114514, 0.114078, 0.113445, 0.112526, 0.111371, 0.110018, 0.108624, 0.107347, 0.10626, 0.105398, 0.104815, 0.104419, 0.104138, 0.10388, 0.103646, 0.103327, 0.102857, 0.102215, 0.101368, 0.100412, 0.099422, 0.098422, 0.097398, 0.096412, 0.095513, 0.094726, 0.09409, 0.093538, 0.09293, 0.092103, 0.091006, 0.089597, 0.087866, 0.085981, 0.084124, 0.082424, 0.081004, 0.079851, 0.078914, 0.078162, 0.077539, 0.076988, 0.076387, 0.075653, 0.074757, 0.073675, 0.072429, 0.071044, 0.069582, 0.068059, 0.066579, 0.065197, 0.063949, 0.062827, 0.061818, 0.060864, 0.059784, 0.058466, 0.056898, 0.055038, 0.052988, 0.050924, 0.049046, 0.047395, 0.04602, 0.044932, 0.044025, 0.043265, 0.042463, 0.041544, 0.040606, 0.039596, 0.038479, 0.037382, 0.036256, 0.035053, 0.033822, 0.032593, 0.03149, 0.030571, 0.029811, 0.029202, 0.028659, 0.028065, 0.027279, 0.026142, 0.024667, 0.022948, 0.021035, 0.019054, 0.017223, 0.015729, 0.014565, 0.013648, 0.012858, 0.01207, 0.011203, 0.010236, 0.009137, 0.007875, 0.00651, 0.005059, 0.003516, 0.001959, 0.000398, -0.001095, -0.002465, -0.003674, -0.004773, -0.005804, -0.006847, -0.008001, -0.009375, -0.010972, -0.012737, -0.014615, -0.016483, -0.018294, -0.019929, -0.021277, -0.022342, -0.023163, -0.023814, -0.024384, -0.024912, -0.025471, -0.0261, -0.026831, -0.027709, -0.028753, -0.029922, -0.031144, -0.032334, -0.033396, -0.034288, -0.035, -0.03565, -0.036347, -0.037158, -0.038217, -0.039515, -0.041017, -0.042672, -0.044362, -0.045913, -0.047226, -0.048267, -0.049091, -0.049798, -0.050343, -0.050744, -0.051122, -0.051585, -0.052161, -0.05283, -0.053573, -0.054314, -0.055023, -0.055683, -0.056219, -0.056662, -0.056971, -0.057164, -0.057245, -0.057295, -0.057395, -0.057599, -0.05795, -0.058454, -0.059089, -0.05974, -0.060198, -0.06041, -0.060406, -0.060151, -0.059702, -0.05913, -0.058516, -0.057934, -0.057444, -0.057104, -0.056916, -0.056855, -0.056831, -0.05687, -0.056906, -0.056851, -0.056669, -0.056331, -0.055821, -0.055222, -0.054606, -0.054066, -0.053671, -0.053482, -0.053544, -0.053765, -0.054068, -0.054389, -0.054577, -0.054628, -0.054429, -0.054012, -0.053377, -0.052603, -0.051877, -0.051168, -0.050588, -0.050194, -0.049977, -0.049863, -0.049779, -0.049695, -0.049542, -0.049293, -0.048952, -0.048559, -0.048122, -0.04768, -0.047278, -0.047034, -0.047043, -0.04735, -0.047949, -0.0487, -0.049431, -0.050052, -0.050458, -0.050607, -0.050533, -0.050245, -0.04985, -0.049467, -0.04914, -0.048922, -0.0489, -0.049039, -0.049263, -0.049602, -0.050004, -0.05034, -0.050617, -0.050808, -0.050902, -0.050911, -0.050825, -0.050738, -0.05071, -0.050841, -0.051231, -0.051918, -0.05285, -0.053928, -0.054966, -0.055764, -0.056296, -0.05655, -0.056555, -0.056429, -0.056295, -0.056185, -0.056175, -0.056306, -0.056562, -0.056912, -0.057303, -0.05776, -0.05827, -0.058724, -0.059157, -0.059488, -0.059681, -0.059792, -0.059891, -0.06011, -0.060452, -0.061093, -0.062128, -0.063487, -0.0651, -0.066808, -0.068434, -0.069847, -0.071041, -0.072012, -0.072833, -0.073611, -0.074373, -0.075218, -0.076108, -0.077084, -0.078177, -0.079346, -0.080591, -0.081813, -0.082943, -0.083955, -0.084807, -0.085518, -0.08612, -0.086661, -0.087193, -0.08783, -0.088654, -0.089736, -0.091112, -0.092716, -0.094454, -0.096154, -0.097713, -0.099068, -0.100154, -0.100979, -0.101671, -0.102256, -0.102845, -0.103528, -0.104345, -0.105325, -0.106422, -0.107587, -0.108771, -0.109877, -0.110896, -0.111736, -0.112411, -0.112972, -0.113459, -0.113951, -0.114507, -0.115206, -0.116132, -0.117321, -0.118681, -0.120064, -0.121433, -0.122668, -0.123664, -0.124405, -0.124931, -0.125362, -0.125777, -0.126247, -0.126798, -0.127468, -0.128185, -0.128905, -0.129618, -0.130344, -0.130985, -0.131537, -0.132037, -0.132416, -0.13269, -0.132824, -0.132898, -0.133098, -0.133441, -0.133993, -0.134751, -0.135706, -0.136822, -0.13794, -0.13893, -0.139654, -0.140224, -0.140557, -0.140785, -0.14097, -0.141132, -0.141342, -0.141639, -0.142066, -0.142575, -0.143127, -0.143732, -0.144327, -0.144907, -0.145462, -0.14595, -0.146323, -0.146633, -0.146896, -0.147177, -0.14756, -0.148076, -0.1488, -0.149707, -0.150817, -0.151998, -0.153088, -0.154013, -0.154725, -0.155224, -0.155582, -0.155891, -0.156204, -0.156571, -0.157039, -0.157685, -0.158418, -0.15924, -0.159997, -0.160757, -0.16146, -0.16208, -0.162624, -0.163087, -0.16347, -0.163815, -0.164176, -0.164659, -0.165365, -0.166349, -0.167653, -0.169142, -0.170763, -0.172391, -0.173827, -0.174998, -0.175847, -0.176475, -0.176951, -0.177393, -0.177836, -0.178443, -0.179193, -0.18008, -0.181156, -0.182322, -0.183533, -0.184703, -0.18575, -0.186738, -0.187623, -0.188399, -0.189121, -0.189684, -0.190292, -0.191023, -0.191995, -0.193222, -0.194652, -0.196212, -0.197804, -0.199341, -0.200722, -0.201833, -0.202757, -0.203553, -0.204432, -0.205311, -0.206334, -0.20752, -0.208848, -0.210234, -0.21171, -0.213193, -0.214686, -0.216058, -0.217272, -0.218318, -0.219231, -0.219987, -0.220727, -0.22149, -0.222337, -0.223308, -0.224479, -0.225795, -0.227301, -0.228922, -0.23058, -0.232111, -0.233454, -0.234561, -0.23545, -0.236176, -0.236889, -0.237684, -0.238557, -0.239524, -0.240562, -0.241625, -0.242769, -0.243867, -0.244903, -0.245874, -0.246843, -0.24769, -0.248572, -0.249394, -0.250214, -0.251105, -0.252117, -0.253326, -0.254814, -0.256427, -0.258167, -0.259984, -0.261808, -0.26343, -0.26484, -0.265996, -0.266991, -0.26779, -0.268564, -0.26939, -0.270204, -0.271091, -0.271973, -0.272888, -0.273902, -0.274877, -0.275776, -0.276592, -0.277265, -0.277867, -0.278411, -0.278902, -0.279405, -0.280073, -0.280891, -0.281861, -0.283, -0.284183, -0.285307, -0.286366, -0.287278, -0.287931, -0.288434, -0.288785, -0.288977, -0.289185, -0.289421, -0.289714, -0.290069, -0.29047, -0.290877, -0.291241, -0.291519, -0.291682, -0.291739, -0.291714, -0.29161, -0.291433, -0.291168, -0.290884, -0.290658, -0.290534, -0.290687, -0.291071, -0.291565, -0.292076, -0.292486, -0.292784, -0.292853, -0.292734, -0.292487, -0.292156, -0.291834, -0.291572, -0.291385, -0.291332, -0.291421, -0.291591, -0.291861, -0.292027, -0.292153, -0.292207, -0.292192, -0.292085, -0.291866, -0.29156, -0.291213, -0.290928, -0.290735, -0.290795, -0.291128, -0.291651, -0.292314, -0.293, -0.293595, -0.294003, -0.29415, -0.294103, -0.293973, -0.293789, -0.293621, -0.293486, -0.293477, -0.293579, -0.293704, -0.293933, -0.294171, -0.294435, -0.294619, -0.294688, -0.294668, -0.294563, -0.294405, -0.294212, -0.29413, -0.294206, -0.294536, -0.295107, -0.295905, -0.296896, -0.297899, -0.298868, -0.299708, -0.300298, -0.300662, -0.300888, -0.301053, -0.301219, -0.301496, -0.301869, -0.30232, -0.302836, -0.303431, -0.304087, -0.3048, -0.30552, -0.306141, -0.306653, -0.307078, -0.307491, -0.307901, -0.308398, -0.309041, -0.309905, -0.311011, -0.312403, -0.314, -0.315758, -0.317524, -0.319136, -0.320481, -0.321617, -0.322615, -0.323532, -0.324453, -0.325463, -0.326608, -0.327888, -0.329235, -0.330627, -0.332012, -0.33336, -0.334645, -0.335813, -0.336767, -0.337538, -0.338143, -0.338653, -0.339161, -0.339726, -0.340407, -0.341273, -0.342363, -0.343677, -0.345158, -0.346746, -0.348273, -0.349641, -0.350809, -0.351768, -0.352602, -0.353411, -0.354291, -0.355295, -0.356416, -0.357667, -0.359065, -0.360481, -0.361872, -0.363204, -0.364368, -0.365356, -0.366231, -0.366958, -0.367638, -0.368295, -0.369001, -0.369801, -0.370739, -0.371872, -0.373199, -0.374704, -0.376247, -0.377736, -0.379158, -0.380401, -0.381425, -0.382276, -0.383042, -0.383803, -0.384618, -0.385529, -0.386563, -0.387725, -0.388924, -0.390014, -0.391029, -0.391934, -0.392712, -0.39335, -0.393907, -0.394458, -0.395014, -0.395595, -0.396276, -0.397123, -0.398161, -0.399388, -0.400762, -0.402232, -0.403726, -0.405117, -0.406358, -0.407392, -0.408214, -0.408944, -0.409738, -0.410696, -0.411857, -0.413201, -0.414683, -0.416201, -0.41766, -0.41902, -0.420263, -0.421396, -0.422393, -0.42327, -0.424054, -0.424777, -0.425533, -0.426363, -0.427284, -0.42836, -0.429596, -0.431004, -0.432521, -0.434007, -0.435413, -0.43667, -0.437724, -0.438578, -0.439316, -0.440001, -0.440785, -0.441699, -0.442704, -0.443795, -0.44491, -0.446024, -0.447072, -0.447982, -0.448785, -0.449465, -0.449969, -0.450384, -0.450812, -0.451259, -0.451751, -0.452396, -0.453298, -0.454405, -0.455723, -0.45716, -0.458634, -0.460038, -0.461318, -0.462375, -0.463176, -0.463787, -0.46434, -0.464901, -0.465564, -0.46635, -0.467232, -0.468152, -0.469045, -0.469884, -0.470611, -0.471269, -0.471809, -0.472269, -0.472631, -0.472912, -0.473189, -0.473543, -0.474013, -0.474632, -0.475448, -0.476478, -0.477697, -0.479072, -0.48052, -0.482009, -0.483383, -0.484612, -0.48576, -0.486874, -0.488046, -0.489362, -0.490819, -0.492341, -0.493913, -0.495503, -0.497, -0.4984, -0.499741, -0.501002, -0.502141, -0.503198, -0.504204, -0.505185, -0.506196, -0.507281, -0.508501, -0.509882, -0.511433, -0.513165, -0.514984, -0.516876, -0.518652, -0.520195, -0.521524, -0.522664, -0.523696, -0.524731, -0.525838, -0.527044, -0.528287, -0.529563, -0.530875, -0.532205, -0.533485, -0.534722, -0.535851, -0.536877, -0.537801, -0.538631, -0.539393, -0.540148, -0.540941, -0.541791, -0.542687, -0.543688, -0.544873, -0.546231, -0.547702, -0.549184, -0.550584, -0.551863, -0.552955, -0.553874, -0.554696, -0.555565, -0.556491, -0.55746, -0.558483, -0.559543, -0.560611, -0.561696, -0.562693, -0.563599, -0.564342, -0.564932, -0.565396, -0.565794, -0.566176, -0.566597, -0.567092, -0.567704, -0.568446, -0.569319, -0.570332, -0.571458, -0.572657, -0.573872, -0.575013, -0.575996, -0.576819, -0.577452, -0.578023, -0.578674, -0.579443, -0.580344, -0.581241, -0.582064, -0.582842, -0.583533, -0.584088, -0.584496, -0.584758, -0.584935, -0.584985, -0.584952, -0.584882, -0.5848, -0.58475, -0.584799, -0.585014, -0.585325, -0.585723, -0.586164, -0.586535, -0.586762, -0.586837, 0.413237, 0.413434, 0.413666, 0.413837, 0.41394, 0.413911, 0.413722, 0.413467, 0.413161, 0.412903, 0.412728, 0.412689, 0.412872, 0.413121, 0.413419, 0.413789, 0.414068, 0.414214, 0.41425, 0.414072, 0.413733, 0.413259, 0.412704, 0.412129, 0.411582, 0.411116, 0.410786, 0.410548, 0.41042, 0.410344, 0.410212, 0.409957, 0.40957, 0.409058, 0.408516, 0.407922, 0.407367, 0.406943, 0.406691, 0.406586, 0.406595, 0.406668, 0.406819, 0.40702, 0.40718, 0.407228, 0.407123, 0.406851, 0.406437, 0.405864, 0.405186, 0.404502, 0.403897, 0.403415, 0.403103, 0.402923, 0.402798, 0.402607, 0.402259, 0.40172, 0.401027, 0.400236, 0.399371, 0.398542, 0.397737, 0.397003, 0.396429, 0.396045, 0.395738, 0.39549, 0.395301, 0.395043, 0.394659, 0.3941, 0.393357, 0.392391, 0.391157, 0.389755, 0.38834, 0.386976, 0.385767, 0.384724, 0.383891, 0.383233, 0.382582, 0.381868, 0.381025, 0.38001, 0.378803, 0.377466, 0.376128, 0.374835, 0.373676, 0.372692, 0.37191, 0.371246, 0.370672, 0.370163, 0.369669, 0.369114, 0.368418, 0.367553, 0.36649, 0.36526, 0.363886, 0.362399, 0.360901, 0.359486, 0.358228, 0.357164, 0.356271, 0.355491, 0.354732, 0.353912, 0.353017, 0.352015, 0.350923, 0.349772, 0.348605, 0.347494, 0.346477, 0.345556, 0.34471, 0.343952, 0.343229, 0.342542, 0.341807, 0.34096, 0.340003, 0.338948, 0.337732, 0.336381, 0.334983, 0.333533, 0.332028, 0.330533, 0.329135, 0.327819, 0.326523, 0.32522, 0.323794, 0.322188, 0.320473, 0.318733, 0.317015, 0.315347, 0.313766, 0.31233, 0.311051, 0.309889, 0.308853, 0.307913, 0.307012, 0.30614, 0.305186, 0.304152, 0.303043, 0.30184, 0.300539, 0.299178, 0.297809, 0.296454, 0.295123, 0.293899, 0.292813, 0.291858, 0.29095, 0.290018, 0.28902, 0.287948, 0.286821, 0.285702, 0.284679, 0.283803, 0.283052, 0.282336, 0.28167, 0.281105, 0.280623, 0.280164, 0.27971, 0.27924, 0.278648, 0.277927, 0.277091, 0.27613, 0.275039, 0.273859, 0.272659, 0.271472, 0.270396, 0.269463, 0.268613, 0.267762, 0.266807, 0.265726, 0.264488, 0.263083, 0.261566, 0.260074, 0.25868, 0.257376, 0.256124, 0.254962, 0.253863, 0.252802, 0.251737, 0.250644, 0.249516, 0.24839, 0.247142, 0.245764, 0.244302, 0.242808, 0.241237, 0.239741, 0.23836, 0.237136, 0.236037, 0.23503, 0.234108, 0.233174, 0.232137, 0.23094, 0.229605, 0.228196, 0.226775, 0.225447, 0.224287, 0.223288, 0.222384, 0.221587, 0.220898, 0.220277, 0.219641, 0.218932, 0.218081, 0.217051, 0.215845, 0.214483, 0.212928, 0.211247, 0.209492, 0.207749, 0.206062, 0.204531, 0.203072, 0.201607, 0.200114, 0.198564, 0.196908, 0.195153, 0.193282, 0.191381, 0.189505, 0.187662, 0.185911, 0.184305, 0.182834, 0.181462, 0.180201, 0.179005, 0.177865, 0.176686, 0.175475, 0.174156, 0.172661, 0.171015, 0.169231, 0.167326, 0.16535, 0.163416, 0.161559, 0.159825, 0.158187, 0.156613, 0.155029, 0.153424, 0.151741, 0.149911, 0.148022, 0.146146, 0.144301, 0.142549, 0.140944, 0.139508, 0.138214, 0.137032, 0.135935, 0.134834, 0.133685, 0.132524, 0.131286, 0.129886, 0.128344, 0.126711, 0.124962, 0.123137, 0.121322, 0.119571, 0.117954, 0.116496, 0.115127, 0.11377, 0.112371, 0.110895, 0.109296, 0.107645, 0.10594, 0.104277, 0.102674, 0.101131, 0.099752, 0.098559, 0.097463, 0.096467, 0.095556, 0.094668, 0.093732, 0.092727, 0.091603, 0.090352, 0.088957, 0.087472, 0.085948, 0.084454, 0.083046, 0.081739, 0.080528, 0.079453, 0.078483, 0.077568, 0.076675, 0.075754, 0.074811, 0.073982, 0.073214, 0.072526, 0.071919, 0.071442, 0.071072, 0.070794, 0.070607, 0.070515, 0.070423, 0.070242, 0.069998, 0.069656, 0.069157, 0.068535, 0.067806, 0.067006, 0.066131, 0.065295, 0.064494, 0.06377, 0.063178, 0.062624, 0.062049, 0.061379, 0.06064, 0.059842, 0.059055, 0.058338, 0.057758, 0.05736, 0.057168, 0.057152, 0.057306, 0.057586, 0.05792, 0.058271, 0.058575, 0.058769, 0.058835, 0.058756, 0.058529, 0.058216, 0.057835, 0.057416, 0.05697, 0.056537, 0.056181, 0.055872, 0.055637, 0.055417, 0.055157, 0.054782, 0.054278, 0.053659, 0.053004, 0.052358, 0.051821, 0.051396, 0.051098, 0.05094, 0.050861, 0.050864, 0.050922, 0.050956, 0.050927, 0.050782, 0.05056, 0.050241, 0.049833, 0.049332, 0.048772, 0.048245, 0.047792, 0.047398, 0.047058, 0.046753, 0.046417, 0.045972, 0.045389, 0.044673, 0.043828, 0.042948, 0.042085, 0.041283, 0.040592, 0.039997, 0.03953, 0.039193, 0.038913, 0.038683, 0.038456, 0.038203, 0.03785, 0.037386, 0.036794, 0.036061, 0.035183, 0.034228, 0.033259, 0.032356, 0.031538, 0.030783, 0.030107, 0.029477, 0.028804, 0.028018, 0.027077, 0.025962, 0.024674, 0.023305, 0.021947, 0.020735, 0.019652, 0.018704, 0.017826, 0.016974, 0.016185, 0.015436, 0.014733, 0.014008, 0.013184, 0.01226, 0.011209, 0.010024, 0.008802, 0.007511, 0.006213, 0.004949, 0.003749, 0.002584, 0.001468, 0.000383, -0.00077, -0.001957, -0.003277, -0.004719, -0.006234, -0.007748, -0.00924, -0.010596, -0.011769, -0.012766, -0.013631, -0.01442, -0.015178, -0.016025, -0.017009, -0.018064, -0.019253, -0.020606, -0.022057, -0.023586, -0.025107, -0.026525, -0.027884, -0.029209, -0.030482, -0.031726, -0.032891, -0.034033, -0.035197, -0.036445, -0.037792, -0.039229, -0.040723, -0.042188, -0.043563, -0.044772, -0.045869, -0.046872, -0.047804, -0.048691, -0.049572, -0.050453, -0.051415, -0.052543, -0.053742, -0.055, -0.056353, -0.057785, -0.05923, -0.060613, -0.061981, -0.063276, -0.064483, -0.065597, -0.066748, -0.067949, -0.069255, -0.070643, -0.072071, -0.073465, -0.07476, -0.075962, -0.077056, -0.078041, -0.078878, -0.079601, -0.08024, -0.080834, -0.081477, -0.082195, -0.083042, -0.084036, -0.085159, -0.086403, -0.087727, -0.0891, -0.090528, -0.091954, -0.093349, -0.094658, -0.09588, -0.097038, -0.098234, -0.099509, -0.100834, -0.102236, -0.103653, -0.104989, -0.106171, -0.10719, -0.10809, -0.108849, -0.109455, -0.110027, -0.110576, -0.111158, -0.111814, -0.112595, -0.113498, -0.114549, -0.115717, -0.116949, -0.118229, -0.119515, -0.120723, -0.121832, -0.122891, -0.12385, -0.124794, -0.125816, -0.126962, -0.128264, -0.129645, -0.131052, -0.13245, -0.133738, -0.13487, -0.135775, -0.136546, -0.137227, -0.137817, -0.138382, -0.139, -0.139669, -0.140469, -0.141399, -0.142449, -0.143646, -0.144945, -0.146308, -0.147706, -0.149058, -0.150344, -0.151542, -0.152676, -0.153818, -0.155036, -0.156392, -0.15793, -0.159734, -0.161697, -0.163689, -0.16566, -0.167522, -0.16922, -0.170739, -0.172109, -0.173344, -0.174469, -0.175548, -0.176624, -0.177674, -0.178779, -0.179977, -0.181236, -0.182513, -0.183786, -0.18503, -0.186253, -0.187441, -0.188584, -0.189681, -0.19082, -0.192046, -0.193349, -0.194788, -0.1964, -0.1981, -0.199876, -0.201679, -0.203414, -0.205003, -0.206461, -0.207827, -0.209078, -0.210267, -0.211479, -0.212679, -0.213868, -0.215068, -0.216344, -0.217669, -0.219072, -0.22049, -0.221974, -0.223426, -0.224722, -0.225929, -0.227131, -0.228324, -0.229567, -0.230867, -0.232296, -0.233898, -0.235623, -0.237478, -0.239475, -0.241458, -0.24332, -0.245039, -0.246537, -0.247843, -0.249011, -0.250133, -0.251233, -0.252358, -0.253537, -0.254785, -0.256106, -0.257521, -0.258953, -0.260404, -0.261797, -0.263121, -0.264295, -0.265405, -0.266433, -0.267429, -0.268474, -0.269612, -0.270892, -0.272292, -0.27377, -0.275218, -0.276642, -0.27792, -0.279023, -0.279955, -0.280711, -0.281342, -0.281827, -0.282232, -0.282621, -0.283039, -0.283486, -0.283976, -0.284584, -0.285218, -0.285951, -0.286692, -0.287393, -0.288067, -0.288762, -0.289396, -0.290041, -0.290694, -0.291433, -0.292261, -0.29323, -0.29437, -0.295504, -0.296679, -0.297746, -0.298677, -0.2994, -0.29999, -0.30039, -0.300713, -0.30087, -0.301012, -0.301232, -0.301519, -0.301846, -0.302218, -0.302687, -0.303236, -0.303772, -0.304274, -0.304703, -0.30505, -0.305353, -0.305617, -0.305971, -0.30637, -0.306912, -0.307626, -0.308508, -0.309416, -0.310345, -0.31117, -0.311876, -0.312422, -0.312771, -0.312985, -0.31309, -0.313107, -0.313146, -0.313177, -0.313268, -0.313426, -0.313654, -0.314028, -0.31446, -0.314915, -0.315317, -0.315648, -0.315924, -0.316111, -0.316239, -0.316321, -0.316406, -0.316658, -0.317055, -0.317657, -0.318368, -0.319187, -0.320041, -0.320799, -0.321429, -0.321928, -0.322346, -0.322664, -0.322854, -0.323049, -0.323215, -0.323438, -0.323669, -0.323899, -0.324194, -0.32459, -0.325072, -0.32557, -0.326057, -0.326587, -0.327094, -0.327619, -0.328138, -0.328692, -0.329271, -0.330045, -0.330979, -0.332107, -0.333386, -0.334691, -0.335894, -0.336934, -0.33777, -0.338477, -0.339096, -0.33967, -0.340259, -0.34093, -0.34161, -0.342311, -0.34306, -0.343905, -0.344834, -0.345702, -0.346665, -0.347574, -0.348366, -0.349132, -0.34984, -0.35056, -0.351266, -0.352054, -0.352914, -0.354004, -0.355299, -0.356741, -0.358296, -0.359948, -0.361468, -0.362825, -0.364, -0.365092, -0.366112, -0.367029, -0.367912, -0.368825, -0.369788, -0.370758, -0.37186, -0.373022, -0.374283, -0.375622, -0.377027, -0.378297, -0.379482, -0.380589, -0.381604, -0.382589, -0.383593, -0.384672, -0.38582, -0.387103, -0.388635, -0.390328, -0.392018, -0.393656, -0.395175, -0.396518, -0.397751, -0.39876, -0.399661, -0.400526, -0.401359, -0.402274, -0.403227, -0.404234, -0.405284, -0.406443, -0.407688, -0.408951, -0.410198, -0.411347, -0.412448, -0.413509, -0.414527, -0.415529, -0.416517, -0.417551, -0.418716, -0.42006, -0.421512, -0.423025, -0.424487, -0.425879, -0.427213, -0.428434, -0.429539, -0.430507, -0.431454, -0.432441, -0.433477, -0.434536, -0.435705, -0.436938, -0.438161, -0.439386, -0.440656, -0.441969, -0.443209, -0.444393, -0.445474, -0.446456, -0.447371, -0.448345, -0.449404, -0.450579, -0.451943, -0.453371, -0.454883, -0.456386, -0.457717, -0.458892, -0.459917, -0.46083, -0.461655, -0.462376, -0.462998, -0.463658, -0.464314, -0.465089, -0.466012, -0.467061, -0.468187, -0.469291, -0.47039, -0.471531, -0.472678, -0.473783, -0.474894, -0.475944, -0.477021, -0.478158, -0.479385, -0.480814, -0.482341, -0.483859, -0.485455, -0.486784, -0.488007, -0.489063, -0.48998, -0.490823, -0.491658, -0.492527, -0.493426, -0.494431, -0.495514, -0.496649, -0.497863, -0.499144, -0.500517, -0.501881, -0.503163, -0.504359, -0.505528, -0.506702, -0.507896, -0.509055, -0.510276, -0.511588, -0.513078, -0.514756, -0.516508, -0.518267, -0.519952, -0.52151, -0.522888, -0.524022, -0.525021, -0.525928, -0.5268, -0.527669, -0.528586, -0.52957, -0.530606, -0.53174, -0.532877, -0.534098, -0.535343, -0.536656, -0.538045, -0.53944, -0.54085, -0.542268, -0.543678, -0.545207, -0.546811, -0.548545, -0.55046, -0.552582, -0.554767, -0.557051, -0.559264, -0.561303, -0.563221, -0.564983, -0.566639, -0.568113, -0.569529, -0.570924, -0.572292, -0.573665, -0.575063, -0.576417, -0.577735, -0.578993, -0.580202, -0.581426, -0.582655, -0.583871, -0.585132, -0.586404, -0.587751, -0.589263, -0.590911, -0.592675, -0.594549, -0.59654, -0.598559, -0.600431, -0.602209, -0.603721, -0.605038, -0.606146, -0.6072, -0.608214, -0.609267, -0.610445, -0.611685, -0.61299, -0.614361, -0.615742, -0.617154, -0.618511, -0.619777, -0.62097, -0.622073, -0.623092, -0.624098, -0.62517, -0.626284, -0.627541, -0.628954, -0.63058, -0.632375, -0.634264, -0.636154, -0.638, -0.639746, -0.641318, -0.642741, -0.644051, -0.645286, -0.646409, -0.647516, -0.648537, -0.649557, -0.650568, -0.651617, -0.652609, -0.653638, -0.654568, -0.655442, -0.656213, -0.656913, -0.657549, -0.658192, -0.658824, -0.659558, -0.660412, -0.661409, -0.662492, -0.663531, -0.664547, -0.6655, -0.666325, -0.666933, -0.667353, -0.667748, -0.667968, -0.668184, -0.668427, -0.668822, -0.669341, -0.669919, -0.670565, -0.671326, -0.672136, -0.672958, -0.673809, -0.674637, -0.675384, -0.676032, 0.323368, 0.322763, 0.322102, 0.32127, 0.320254, 0.319027, 0.317769, 0.316375, 0.315092, 0.313849, 0.312726, 0.311797, 0.311079, 0.310556, 0.310111, 0.309724, 0.309276, 0.308825, 0.308354, 0.307887, 0.307341, 0.306791, 0.30625, 0.305795, 0.305296, 0.304894, 0.304492, 0.304099, 0.303744, 0.303272, 0.302658, 0.301842, 0.300846, 0.299686, 0.298451, 0.297222, 0.296013, 0.295001, 0.294121, 0.293356, 0.29272, 0.292141, 0.291537, 0.290922, 0.290188, 0.289419, 0.288604, 0.287763, 0.286927, 0.286131, 0.285308, 0.284467, 0.283639, 0.282864, 0.282114, 0.281311, 0.280428, 0.279465, 0.278348, 0.277044, 0.275537, 0.273802, 0.27199, 0.270195, 0.268498, 0.267019, 0.265677, 0.264478, 0.263362, 0.262314, 0.261257, 0.260197, 0.259152, 0.257974, 0.256677, 0.255364, 0.254052, 0.252745, 0.251505, 0.250321, 0.249134, 0.247976, 0.24675, 0.245508, 0.244176, 0.242761, 0.24118, 0.239377, 0.237348, 0.235221, 0.233125, 0.231148, 0.229354, 0.227801, 0.226463, 0.225229, 0.224026, 0.222748, 0.221413, 0.220023, 0.218603, 0.217057, 0.215494, 0.213866, 0.212225, 0.210552, 0.209002, 0.2076, 0.206196, 0.204723, 0.20318, 0.201624, 0.20006, 0.198392, 0.196535, 0.194465, 0.192245, 0.189947, 0.187656, 0.185472, 0.183438, 0.181662, 0.180024, 0.178516, 0.177032, 0.175595, 0.174182, 0.17275, 0.171253, 0.169652, 0.168037, 0.16643, 0.164874, 0.163356, 0.161889, 0.160475, 0.159118, 0.157719, 0.156352, 0.154927, 0.153443, 0.151883, 0.15025, 0.148517, 0.146687, 0.144891, 0.143075, 0.141384, 0.139784, 0.138347, 0.136986, 0.135599, 0.134129, 0.132588, 0.130996, 0.12931, 0.127622, 0.125924, 0.124276, 0.122597, 0.120945, 0.119315, 0.117697, 0.116204, 0.114781, 0.113361, 0.111981, 0.110511, 0.108921, 0.107218, 0.105398, 0.103505, 0.101503, 0.099521, 0.097636, 0.095862, 0.094304, 0.092904, 0.091445, 0.090079, 0.088594, 0.086978, 0.085271, 0.083476, 0.081579, 0.079637, 0.077715, 0.075774, 0.073846, 0.071962, 0.070121, 0.068316, 0.066584, 0.064823, 0.063026, 0.061064, 0.059008, 0.056879, 0.054633, 0.052483, 0.050353, 0.048417, 0.046511, 0.04474, 0.043107, 0.041541, 0.040017, 0.038423, 0.036815, 0.035183, 0.033575, 0.03199, 0.030453, 0.028937, 0.027592, 0.026287, 0.024991, 0.023799, 0.022617, 0.021427, 0.020189, 0.018651, 0.017107, 0.015309, 0.013314, 0.011212, 0.009166, 0.007129, 0.005241, 0.003504, 0.001912, 0.000469, -0.000856, -0.002144, -0.003467, -0.004887, -0.006431, -0.008075, -0.009792, -0.011576, -0.013419, -0.015216, -0.016966, -0.018691, -0.020365, -0.022012, -0.023702, -0.025442, -0.027236, -0.029184, -0.031309, -0.03356, -0.035917, -0.038365, -0.040862, -0.043282, -0.04558, -0.047747, -0.049769, -0.051648, -0.053466, -0.055284, -0.057143, -0.059084, -0.061099, -0.063186, -0.065293, -0.06734, -0.069354, -0.07139, -0.073399, -0.075336, -0.077184, -0.078961, -0.0807, -0.082451, -0.084246, -0.08615, -0.088153, -0.090299, -0.092577, -0.094934, -0.097274, -0.099575, -0.101722, -0.103665, -0.105474, -0.107167, -0.108754, -0.110296, -0.111895, -0.113549, -0.115215, -0.116908, -0.118631, -0.120326, -0.121971, -0.123581, -0.125116, -0.126519, -0.127798, -0.129029, -0.130317, -0.131701, -0.133193, -0.134817, -0.136586, -0.13854, -0.14067, -0.142863, -0.14501, -0.14703, -0.148878, -0.150549, -0.152073, -0.153475, -0.154831, -0.156259, -0.157809, -0.159459, -0.161178, -0.162928, -0.164654, -0.166296, -0.167864, -0.169378, -0.170842, -0.172305, -0.17376, -0.17517, -0.176536, -0.177918, -0.179389, -0.180976, -0.182702, -0.184513, -0.186356, -0.188195, -0.189937, -0.19149, -0.192844, -0.194049, -0.19515, -0.196185, -0.197171, -0.198113, -0.199042, -0.199971, -0.20086, -0.20168, -0.202426, -0.203061, -0.203581, -0.20403, -0.204359, -0.204617, -0.204834, -0.205081, -0.205432, -0.20589, -0.206513, -0.207316, -0.208262, -0.209308, -0.210415, -0.211482, -0.212436, -0.213314, -0.214104, -0.214752, -0.215314, -0.215836, -0.216348, -0.216902, -0.217509, -0.218145, -0.218691, -0.219142, -0.219541, -0.219847, -0.220006, -0.220047, -0.220032, -0.220006, -0.219998, -0.220069, -0.22025, -0.220554, -0.220971, -0.22145, -0.221995, -0.2226, -0.223201, -0.22376, -0.224266, -0.224711, -0.225099, -0.225447, -0.225841, -0.226339, -0.226919, -0.227568, -0.228255, -0.228963, -0.229673, -0.230366, -0.231028, -0.231606, -0.232082, -0.232444, -0.232714, -0.232975, -0.233323, -0.233796, -0.23441, -0.235233, -0.236229, -0.237322, -0.238444, -0.239546, -0.240574, -0.241496, -0.242326, -0.243064, -0.243729, -0.244333, -0.24496, -0.24568, -0.246461, -0.247292, -0.248177, -0.249119, -0.250086, -0.251033, -0.251919, -0.252746, -0.253511, -0.254194, -0.254892, -0.255633, -0.256407, -0.257238, -0.258296, -0.259545, -0.260937, -0.262405, -0.263902, -0.265366, -0.266741, -0.267975, -0.269108, -0.27019, -0.271257, -0.272385, -0.273577, -0.274815, -0.27615, -0.277575, -0.278979, -0.28034, -0.281604, -0.282773, -0.283889, -0.284945, -0.285934, -0.2869, -0.287872, -0.288932, -0.290151, -0.291565, -0.293181, -0.295011, -0.297021, -0.299114, -0.301174, -0.303093, -0.304857, -0.306461, -0.307908, -0.309316, -0.310746, -0.312168, -0.313592, -0.315065, -0.316535, -0.318003, -0.319498, -0.320998, -0.322448, -0.323818, -0.325132, -0.326393, -0.327625, -0.32887, -0.330196, -0.331672, -0.33327, -0.335005, -0.336901, -0.338945, -0.341097, -0.343236, -0.345259, -0.3471, -0.348693, -0.350072, -0.351358, -0.352624, -0.353944, -0.355327, -0.356807, -0.358332, -0.359898, -0.36148, -0.363035, -0.364514, -0.365904, -0.367215, -0.368473, -0.369702, -0.370916, -0.372125, -0.373334, -0.374646, -0.376048, -0.377547, -0.379172, -0.380912, -0.382729, -0.384517, -0.386187, -0.387701, -0.389022, -0.390251, -0.391491, -0.39276, -0.394024, -0.395282, -0.396562, -0.397837, -0.399102, -0.400339, -0.40151, -0.402582, -0.403553, -0.404454, -0.405285, -0.406089, -0.406918, -0.40776, 0.591282, 0.590175, 0.588941, 0.587563, 0.586017, 0.584426, 0.582844, 0.581305, 0.579852, 0.578519, 0.57732, 0.576158, 0.574976, 0.573747, 0.572439, 0.571082, 0.569739, 0.568474, 0.567266, 0.566147, 0.565076, 0.564053, 0.563108, 0.562257, 0.561454, 0.560665, 0.559867, 0.558982, 0.557988, 0.55684, 0.555572, 0.554189, 0.552735, 0.551265, 0.549833, 0.548472, 0.547194, 0.545961, 0.544776, 0.543568, 0.542269, 0.540859, 0.539313, 0.537679, 0.536002, 0.534339, 0.532712, 0.53119, 0.529806, 0.52863, 0.527585, 0.526616, 0.525693, 0.524752, 0.523709, 0.522614, 0.5214, 0.520063, 0.518563, 0.516937, 0.515296, 0.513742, 0.51227, 0.510874, 0.509554, 0.508324, 0.507052, 0.505723, 0.504323, 0.502858, 0.501302, 0.499668, 0.497966, 0.496313, 0.494788, 0.4934, 0.49212, 0.490932, 0.489804, 0.488665, 0.487499, 0.486239, 0.484844, 0.483372, 0.481714, 0.479896, 0.477989, 0.476007, 0.474027, 0.472177, 0.470479, 0.468909, 0.467483, 0.466151, 0.464806, 0.463435, 0.461915, 0.460303, 0.45863, 0.456982, 0.455406, 0.453847, 0.452259, 0.4507, 0.449216, 0.447799, 0.446362, 0.444892, 0.443412, 0.441903, 0.440357, 0.438635, 0.436729, 0.434647, 0.432459, 0.430264, 0.428137, 0.426252, 0.424589, 0.423115, 0.421725, 0.420343, 0.418963, 0.417579, 0.416112, 0.414541, 0.412909, 0.411336, 0.409928, 0.408581, 0.407296, 0.406097, 0.404988, 0.403938, 0.40296, 0.401995, 0.400921, 0.399777, 0.398573, 0.397282, 0.395859, 0.394294, 0.392632, 0.390933, 0.389311, 0.387834, 0.386538, 0.385441, 0.384388, 0.383255, 0.382034, 0.380716, 0.379346, 0.377976, 0.376682, 0.37548, 0.374367, 0.373385, 0.372591, 0.37195, 0.371458, 0.371041, 0.370632, 0.37026, 0.369865, 0.369361, 0.368745, 0.368076, 0.367284, 0.366467, 0.365673, 0.364817, 0.364104, 0.363538, 0.363108, 0.362707, 0.362287, 0.361802, 0.361236, 0.360643, 0.360073, 0.359516, 0.358931, 0.358426, 0.358093, 0.357851, 0.357679, 0.357589, 0.357507, 0.357425, 0.357334, 0.357152, 0.356799, 0.35634, 0.355775, 0.355133, 0.354511, 0.353934, 0.353387, 0.35287, 0.352476, 0.352098, 0.351785, 0.351506, 0.35119, 0.350777, 0.350227, 0.349555, 0.348832, 0.348161, 0.34753, 0.347019, 0.346657, 0.346418, 0.34628, 0.346207, 0.346131, 0.345988, 0.345854, 0.345634, 0.345291, 0.344811, 0.344181, 0.343486, 0.342811, 0.342183, 0.341657, 0.341237, 0.340936, 0.340741, 0.340519, 0.340304, 0.339968, 0.339491, 0.338989, 0.338483, 0.337908, 0.337431, 0.337066, 0.336801, 0.336597, 0.336465, 0.336407, 0.336307, 0.336183, 0.33602, 0.335792, 0.335404, 0.334818, 0.334055, 0.333174, 0.332226, 0.331268, 0.330376, 0.32957, 0.328893, 0.328294, 0.327713, 0.327125, 0.32637, 0.325452, 0.324382, 0.32327, 0.322178, 0.321107, 0.320148, 0.319295, 0.318579, 0.318006, 0.31748, 0.316972, 0.316388, 0.315787, 0.315143, 0.314504, 0.313755, 0.31288, 0.311847, 0.310703, 0.309546, 0.308403, 0.307367, 0.306468, 0.305687, 0.304941, 0.304178, 0.303304, 0.302331, 0.301219, 0.299941, 0.298579, 0.29719, 0.295816, 0.294546, 0.293378, 0.292269, 0.291299, 0.290446, 0.289623, 0.288795, 0.287942, 0.286994, 0.285921, 0.284756, 0.283419, 0.281974, 0.280443, 0.278892, 0.277428, 0.276114, 0.274959, 0.273917, 0.272855, 0.271755, 0.270565, 0.269249, 0.267817, 0.266313, 0.264823, 0.263415, 0.262146, 0.260993, 0.259955, 0.259095, 0.258403, 0.257772, 0.257128, 0.256443, 0.255718, 0.254941, 0.253993, 0.252835, 0.25148, 0.250015, 0.2485, 0.24697, 0.245562, 0.244278, 0.243072, 0.241879, 0.240656, 0.239388, 0.238049, 0.236614, 0.235151, 0.233727, 0.232386, 0.231184, 0.230136, 0.229291, 0.228568, 0.227941, 0.227416, 0.226913, 0.226363, 0.225823, 0.22523, 0.224487, 0.223622, 0.222665, 0.221602, 0.220457, 0.219308, 0.218244, 0.21724, 0.216358, 0.215587, 0.214861, 0.214053, 0.213188, 0.21229, 0.211426, 0.210595, 0.20991, 0.209347, 0.208906, 0.208515, 0.20828, 0.208176, 0.208098, 0.208077, 0.207975, 0.207832, 0.207647, 0.207312, 0.206794, 0.206116, 0.205314, 0.204397, 0.20344, 0.202432, 0.20147, 0.200578, 0.199686, 0.198757, 0.197674, 0.196465, 0.195082, 0.193498, 0.191817, 0.190142, 0.188566, 0.187154, 0.185894, 0.184802, 0.183913, 0.18314, 0.182386, 0.181632, 0.180859, 0.180036, 0.179152, 0.178179, 0.177118, 0.175977, 0.174806, 0.17366, 0.172564, 0.17154, 0.170636, 0.169827, 0.169049, 0.168248, 0.167403, 0.166447, 0.165292, 0.164027, 0.162787, 0.161579, 0.160484, 0.159541, 0.158637, 0.157825, 0.157111, 0.156427, 0.15573, 0.154972, 0.154145, 0.153242, 0.152245, 0.151166, 0.150027, 0.148829, 0.147587, 0.146348, 0.145157, 0.144065, 0.143102, 0.142233, 0.141381, 0.140418, 0.139337, 0.13815, 0.13687, 0.13548, 0.134092, 0.132764, 0.131548, 0.130493, 0.129617, 0.128867, 0.128182, 0.127526, 0.126865, 0.126184, 0.125484, 0.124688, 0.123765, 0.122728, 0.121552, 0.120222, 0.118859, 0.117602, 0.116491, 0.11546, 0.114501, 0.113543, 0.112534, 0.111398, 0.110079, 0.108653, 0.107145, 0.105618, 0.104128, 0.102818, 0.101657, 0.100623, 0.099735, 0.098977, 0.098287, 0.097618, 0.09697, 0.096296, 0.09552, 0.094633, 0.093686, 0.092657, 0.091526, 0.090427, 0.089408, 0.088537, 0.087829, 0.087198, 0.086655, 0.086064, 0.085425, 0.08466, 0.083728, 0.08269, 0.081646, 0.08065, 0.0797, 0.078838, 0.07817, 0.077697, 0.07733, 0.076997, 0.076708, 0.076395, 0.076046, 0.07561, 0.075109, 0.074492, 0.073782, 0.072988, 0.072106, 0.071266, 0.070555, 0.069998, 0.069592, 0.069317, 0.069114, 0.068887, 0.068606, 0.068219, 0.067758, 0.067325, 0.067002, 0.066844, 0.066876, 0.067126, 0.067527, 0.068092, 0.068727, 0.069328, 0.069965, 0.070597, 0.071182, 0.071679, 0.072053, 0.0723, 0.072368, 0.072319, 0.072198, 0.072034, 0.071889, 0.071774, 0.071739, 0.071779, 0.071788, 0.071687, 0.071412, 0.070978, 0.070446, 0.069902, 0.069451, 0.069162, 0.069046, 0.069069, 0.069178, 0.06933, 0.06951, 0.069661, 0.069783, 0.069889, 0.069945, 0.069932, 0.06981, 0.069576, 0.069263, 0.068939, 0.068667, 0.068461, 0.068333, 0.068293, 0.068279, 0.068197, 0.067967, 0.067537, 0.066958, 0.066338, 0.065734, 0.065181, 0.064765, 0.064489, 0.0644, 0.064427, 0.064528, 0.064688, 0.064852, 0.065002, 0.065162, 0.065231, 0.065109, 0.064811, 0.064452, 0.064095, 0.063704, 0.06328, 0.062952, 0.062747, 0.062618, 0.062522, 0.062397, 0.06217, 0.061751, 0.061143, 0.060319, 0.059349, 0.058369, 0.057514, 0.056858, 0.056403, 0.056124, 0.055995, 0.055912, 0.055862, 0.055813, 0.055664, 0.055389, 0.054974, 0.054378, 0.053613, 0.052739, 0.051842, 0.050912, 0.050009, 0.049186, 0.048442, 0.047756, 0.047095, 0.046383, 0.045533, 0.044428, 0.043167, 0.041793, 0.040347, 0.038973, 0.037737, 0.036677, 0.035804, 0.035101, 0.034509, 0.034049, 0.033636, 0.033184, 0.032634, 0.031981, 0.031191, 0.030212, 0.029089, 0.02785, 0.026552, 0.025295, 0.024129, 0.023059, 0.022095, 0.021205, 0.02034, 0.01941, 0.018339, 0.017153, 0.015906, 0.014652, 0.013413, 0.01223, 0.011193, 0.010258, 0.00947, 0.008767, 0.008091, 0.007442, 0.006731, 0.005958, 0.005095, 0.004141, 0.003079, 0.00187, 0.000526, -0.000874, -0.002264, -0.003586, -0.004808, -0.005892, -0.006861, -0.00782, -0.008816, -0.009925, -0.011137, -0.012423, -0.013734, -0.014992, -0.016115, -0.016996, -0.017681, -0.018237, -0.018732, -0.019134, -0.019491, -0.019882, -0.02035, -0.020888, -0.021493, -0.022195, -0.023008, -0.023941, -0.024966, -0.026005, -0.026907, -0.027635, -0.028213, -0.028679, -0.02914, -0.029669, -0.030294, -0.031076, -0.032011, -0.033085, -0.034166, -0.035195, -0.036163, -0.037045, -0.037758, -0.038271, -0.038723, -0.039111, -0.039432, -0.039761, -0.040123, -0.040582, -0.041092, -0.041734, -0.042465, -0.043266, -0.044143, -0.045047, -0.045913, -0.046725, -0.047481, -0.048218, -0.049008, -0.049919, -0.050977, -0.05223, -0.053634, -0.055068, -0.056486, -0.057808, -0.058911, -0.059832, -0.060576, -0.061156, -0.061662, -0.062128, -0.062653, -0.063318, -0.064089, -0.064984, -0.065979, -0.067067, -0.068229, -0.069433, -0.070616, -0.071794, -0.072926, -0.073967, -0.074954, -0.075918, -0.07693, -0.078102, -0.079456, -0.080945, -0.082487, -0.083992, -0.085379, -0.086533, -0.087483, -0.088212, -0.088795, -0.089276, -0.089715, -0.09021, -0.090725, -0.091334, -0.092043, -0.092878, -0.093828, -0.094822, -0.095867, -0.096942, -0.097963, -0.098882, -0.099702, -0.100469, -0.101269, -0.102138, -0.103134, -0.104342, -0.10575, -0.107324, -0.109003, -0.110633, -0.112124, -0.113399, -0.114443, -0.115318, -0.116097, -0.11681, -0.11754, -0.118324, -0.119198, -0.120165, -0.121246, -0.122473, -0.123757, -0.12504, -0.126335, -0.127579, -0.128742, -0.129774, -0.130658, -0.131415, -0.132212, -0.133062, -0.134044, -0.135233, -0.1366, -0.138075, -0.13949, -0.140803, -0.14193, -0.14281, -0.143476, -0.144017, -0.144513, -0.145004, -0.145563, -0.146175, -0.146839, -0.147632, -0.148567, -0.149612, -0.150656, -0.151632, -0.152533, -0.153366, -0.154093, -0.154711, -0.15528, -0.155827, -0.156399, -0.157094, -0.157942, -0.158971, -0.16018, -0.161457, -0.162712, -0.163795, -0.164605, -0.165206, -0.165595, -0.165853, -0.166076, -0.166313, -0.16659, -0.166908, -0.167309, -0.167776, -0.168288, -0.168872, -0.169467, -0.170051, -0.170589, -0.170974, -0.17122, -0.171393, -0.171519, -0.171641, -0.171829, -0.172139, -0.17261, -0.173213, -0.17387, -0.174495, -0.175015, -0.175362, -0.175471, -0.175408, -0.175244, -0.175012, -0.174768, -0.174574, -0.174438, -0.174352, -0.174371, -0.174416, -0.174479, -0.174542, -0.174553, -0.174537, -0.174421, -0.174172, -0.173807, -0.173323, -0.172772, -0.172296, -0.172008, -0.171934, -0.171947, -0.172011, -0.172063, -0.172024, -0.171793, -0.171341, -0.170672, -0.169813, -0.168858, -0.167937, -0.167065, -0.166291, -0.165639, -0.165134, -0.164655, -0.164206, -0.163871, -0.163555, -0.163194, -0.162789, -0.162366, -0.161847, -0.161241, -0.160654, -0.160159, -0.159849, -0.159766, -0.15989, -0.160156, -0.160447, -0.160659, -0.160699, -0.160514, -0.160086, -0.159495, -0.158817, -0.158045, -0.157327, -0.156743, -0.156276, -0.155842, -0.155503, -0.155215, -0.154987, -0.154822, -0.154679, -0.154523, -0.154351, -0.154081, -0.153706, -0.153305, -0.152991, -0.152817, -0.152861, -0.153126, -0.153633, -0.154265, -0.154814, -0.155263, -0.155524, -0.155542, -0.155368, -0.155106, -0.154717, -0.154301, -0.153939, -0.153596, -0.153369, -0.153299, -0.153325, -0.153337, -0.153324, -0.153282, -0.153151, -0.152911, -0.152552, -0.152108, -0.151646, -0.151209, -0.150915, -0.150903, -0.151215, -0.151802, -0.152506, -0.153197, -0.153742, -0.153982, -0.15393, -0.153687, -0.153299, -0.152834, -0.152374, -0.151972, -0.151646, -0.151433, -0.151374, -0.151478, -0.151673, -0.151935, -0.15224, -0.152573, -0.152884, -0.153135, -0.153321, -0.153419, -0.15349, -0.153599, -0.153818, -0.15424, -0.154916, -0.155816, -0.156812, -0.157742, -0.158452, -0.158919, -0.15915, -0.159219, -0.159203, -0.159177, -0.159217, -0.159284, -0.159451, -0.159776, -0.16025, -0.160864, -0.161559, -0.162267, -0.162901, -0.163435, -0.163865, -0.164175, -0.164388, -0.16447, -0.164518, -0.164658, -0.164964, -0.165553, -0.16634, -0.167211, -0.168096, -0.168901, -0.169475, -0.169787, -0.169946, -0.17002, -0.170032, -0.170014, -0.170067, -0.170205, -0.170424, -0.170692, -0.171027, -0.171423, -0.171864, -0.172268, -0.172536, -0.172624, -0.172599, -0.17246, -0.172275, -0.172102, -0.171998, -0.172034, -0.172248, -0.172718, -0.173355, -0.174038, -0.174719, -0.175312, -0.175757, -0.176025, -0.176147, -0.176209, -0.176251, -0.176326, -0.176492, -0.176769, -0.177155, -0.177627, -0.178115, -0.178589, -0.179082, -0.179428, -0.179551, -0.17953, -0.179375, -0.179117, -0.178879, -0.17879, -0.178937, -0.179328, -0.179964, -0.180793, -0.181743, -0.182785, -0.183757, -0.184602, -0.185284, -0.185801, -0.186164, -0.186469, -0.186783, -0.187192, -0.187708, -0.188327, -0.189052, -0.189813, -0.19052, -0.19117, -0.19172, -0.192187, -0.192514, -0.192715, -0.192845, -0.19293, -0.193019, -0.193268, -0.193793, -0.194581, -0.195552, -0.19654, -0.197428, -0.198113, -0.198629, -0.19894, -0.199076, -0.199126, -0.199152, -0.199237, -0.199508, -0.199974, -0.200575, -0.201249, -0.201971, -0.202736, -0.203521, -0.20428, -0.20499, -0.205625, -0.206169, -0.206666, -0.207141, -0.207682, -0.208381, -0.209258, -0.210358, -0.211715, -0.213267, -0.214795, -0.21614, -0.217282, -0.218166, -0.218794, -0.219272, -0.219647, -0.219942, -0.220242, -0.220585, -0.220949, -0.221378, -0.221931, -0.222494, -0.223053, -0.223573, -0.224033, -0.224433, -0.22471, -0.224943, -0.225164, -0.225438, -0.225815, -0.226426, -0.227326, -0.228545, -0.230009, -0.231621, -0.233204, -0.234631, -0.235776, -0.236627, -0.237232, -0.237621, -0.237856, -0.238017, -0.238233, -0.238573, -0.239014, -0.239515, -0.239995, -0.240481, -0.240961, -0.24137, -0.24168, -0.241868, -0.241977, -0.242069, -0.242135, -0.242237, -0.242466, -0.242919, -0.243644, -0.244598, -0.245674, -0.246782, -0.247845, -0.248699, -0.24929, -0.249739, -0.249995, -0.250153, -0.25033, -0.250535, -0.250752, -0.251076, -0.251486, -0.252004, -0.252609, -0.253142, -0.25362, -0.253967, -0.254144, -0.254153, -0.254012, -0.253832, -0.253679, -0.253549, -0.25355, -0.253714, -0.254087, -0.254634, -0.255252, -0.2558, -0.256136, -0.256208, -0.256053, -0.255689, -0.255186, -0.254626, -0.253981, -0.253376, -0.252731, -0.252098, -0.251564, -0.251134, -0.250749, -0.25028, -0.249709, -0.249032, -0.248102, -0.247045, -0.245887, -0.244702, -0.243573, -0.2426, -0.241866, -0.241362, -0.241025, -0.24081, -0.240568, -0.240133, -0.239485, -0.2386, -0.237499, -0.236218, -0.234878, -0.233601, -0.232395, -0.231266, -0.230208, -0.229242, -0.228237, -0.227192, -0.22612, -0.224965, -0.223756, -0.222473, -0.221122, -0.219697, -0.218223, -0.216857, -0.215693, -0.21474, -0.213989, -0.213428, -0.212964, -0.212451, -0.211825, -0.211086, -0.210185, -0.209173, -0.208124, -0.207052, -0.206068, -0.205219, -0.204463, -0.203881, -0.20342, -0.203041, -0.202727, -0.202337, -0.201832, -0.201197, -0.200391, -0.199493, -0.198462, -0.197279, -0.196107, -0.195096, -0.194295, -0.193665, -0.193349, -0.193238, -0.193178, -0.193031, -0.192704, -0.192095, -0.191202, -0.190122, -0.188891, -0.187601, -0.186382, -0.185342, -0.184421, -0.183644, -0.183008, -0.182438, -0.181864, -0.181304, -0.180675, -0.17996, -0.179144, -0.178349, -0.177533, -0.176742, -0.176111, -0.175711, -0.175556, -0.175676, -0.175978, -0.176403, -0.176789, -0.177006, -0.177019, -0.176811, -0.176457, -0.176008, -0.175564, -0.175037, -0.174483, -0.174055, -0.173718, -0.173478, -0.173252, -0.173089, -0.172952, -0.172781, -0.172508, -0.172119, -0.171606, -0.170953, -0.170346, -0.169833, -0.169429, -0.16929, -0.169486, -0.169928, -0.170637, -0.171433, -0.172209, -0.172737, -0.173014, -0.173092, -0.173076, -0.173119, -0.173193, -0.173321, -0.173498, -0.173762, -0.174107, -0.174464, -0.174771, -0.175063, -0.175324, -0.175492, -0.175538, -0.175484, -0.175309, -0.17503, -0.174723, -0.174517, -0.174566, -0.174925, -0.175491, -0.176261, -0.177147, -0.177973, -0.178636, -0.179014, -0.179119, -0.17902, -0.178745, -0.178451, -0.178194, -0.178074, -0.178147, -0.178355, -0.178641, -0.178963, -0.179135, -0.179286, -0.179305, -0.179212, -0.179024, -0.178717, -0.178321, -0.177923, -0.177628, -0.17754, -0.177646, -0.177974, -0.178494, -0.179104, -0.179735, -0.18018, -0.180399, -0.180377, -0.180117, -0.179684, -0.179165, -0.178769, -0.178462, -0.178312, -0.178298, -0.178394, -0.178563, -0.178636, -0.178635, -0.178503, -0.178208, -0.177771, -0.177239, -0.176642, -0.17599, -0.175361, -0.174841, -0.174488, -0.17433, -0.174381, -0.174579, -0.174838, -0.175065, -0.175102, -0.174888, -0.174474, -0.173972, -0.17342, -0.172894, -0.172471, -0.172057, -0.171785, -0.171587, -0.171415, -0.17125, -0.171061, -0.1708, -0.170488, -0.170026, -0.169424, -0.168715, -0.167972, -0.167332, -0.166914, -0.166692, -0.166711, -0.167014, -0.167556, -0.168217, -0.168823, -0.169285, -0.169545, -0.169598, -0.169491, -0.169334, -0.169253, -0.16926, -0.169413, -0.169739, -0.170199, -0.170727, -0.171226, -0.171662, -0.171948, -0.172005, -0.171907, -0.171574, -0.171054, -0.17046, -0.169831, -0.16934, -0.16906, -0.169053, -0.169307, -0.169804, -0.170416, -0.171018, -0.171586, -0.171908, -0.171969, -0.17185, -0.171615, -0.171321, -0.171105, -0.171028, -0.171077, -0.171286, -0.171611, -0.171949, -0.172233, -0.172387, -0.172405, -0.172289, -0.17203, -0.17169, -0.171333, -0.170979, -0.170672, -0.170534, -0.170591, -0.170935, -0.171497, -0.172258, -0.173045, -0.173728, -0.174221, -0.174496, -0.174577, -0.174495, -0.174424, -0.174468, -0.174609, -0.174873, -0.175281, -0.17576, -0.176303, -0.176821, -0.177251, -0.177622, -0.177861, -0.17799, -0.17803, -0.17799, -0.177906, -0.177852, -0.177907, -0.178111, -0.178533, -0.179169, -0.17998, -0.180919, -0.181903, -0.182716, -0.183217, -0.183371, -0.183315, -0.183109, -0.182804, -0.182515, -0.182393, -0.182401, -0.182553, -0.18284, -0.183071, -0.183234, -0.183357, -0.183444, -0.183305, -0.183086, -0.182841, -0.182552, -0.182262, -0.182035, -0.181978, -0.182096, -0.182509, -0.183032, -0.18372, -0.184437, -0.185036, -0.185419, -0.185553, -0.18541, -0.185056, -0.184596, -0.184171, -0.183878, -0.183719, -0.183672, -0.183713, -0.183749, -0.183676, -0.183483, -0.183118, -0.182598, -0.181909, -0.181105, -0.180183, -0.17927, -0.178357, -0.177575, -0.176979, -0.176527, -0.17629, -0.17622, -0.176249, -0.176222, -0.17594, -0.175467, -0.174677, -0.173584, -0.172398, -0.171152, -0.169978, -0.168986, -0.168191, -0.167433, -0.166727, -0.165992, -0.165169, -0.16419, -0.163027, -0.161814, -0.160471, -0.15903, -0.157574, -0.15622, -0.154978, -0.153905, -0.153029, -0.15241, -0.151989, -0.151753, -0.151531, -0.151179, -0.150706, -0.150091, -0.149313, -0.1484, -0.147481, -0.146711, -0.146091, -0.145542, -0.145124, -0.144766, -0.144369, -0.14393, -0.143346, -0.14265, -0.141831, -0.1409, -0.139865, -0.138784, -0.137758, -0.136746, -0.135829, -0.135082, -0.134513, -0.134118, -0.133843, -0.133521, -0.133132, -0.132565, -0.13176, -0.130723, -0.129577, -0.128366, -0.127242, -0.126329, -0.125582, -0.124965, -0.124469, -0.124027, -0.123503, -0.122901, -0.122116, -0.121288, -0.12033, -0.119342, -0.118298, -0.117225, -0.116349, -0.115546, -0.11493, -0.114564, -0.114428, -0.114464, -0.1145, -0.114524, -0.114343, -0.113936, -0.11325, -0.11245, -0.111582, -0.110791, -0.110178, -0.109817, -0.109534, -0.109389, -0.109272, -0.109198, -0.109077, -0.108868, -0.108527, -0.108039, -0.107404, -0.10672, -0.105979, -0.105242, -0.104692, -0.104305, -0.104095, -0.104149, -0.104504, -0.105042, -0.105558, -0.105938, -0.10607, -0.105978, -0.105725, -0.105381, -0.105061, -0.104817, -0.104729, -0.104803, -0.104998, -0.105328, -0.105665, -0.105957, -0.106159, -0.10618, -0.105962, -0.10558, -0.105077, -0.104573, -0.104133, -0.103768, -0.103581, -0.103664, -0.104058, -0.104699, -0.105529, -0.106355, -0.107038, -0.107431, -0.107512, -0.107392, -0.107187, -0.106984, -0.106885, -0.106991, -0.107263, -0.107648, -0.108025, -0.108269, -0.10847, -0.10856, -0.108468, -0.108199, -0.107791, -0.1073, -0.106752, -0.106215, -0.105745, -0.105393, -0.105322, -0.105507, -0.105835, -0.106254, -0.106811, -0.107355, -0.107767, -0.107899, -0.107773, -0.107512, -0.107271, -0.107081, -0.107111, -0.107389, -0.107761, -0.10821, -0.108627, -0.108952, -0.109203, -0.109314, -0.109267, -0.109045, -0.108744, -0.108378, -0.107994, -0.107598, -0.107322, -0.107253, -0.107367, -0.107713, -0.108271, -0.108922, -0.109558, -0.110103, -0.110418, -0.110499, -0.110373, -0.110105, -0.109901, -0.109904, -0.110078, -0.11037, -0.110784, -0.111227, -0.111596, -0.111856, -0.11194, -0.111852, -0.111581, -0.111149, -0.110585, -0.110003, -0.109369, -0.108812, -0.108432, -0.108292, -0.108322, -0.108494, -0.10875, -0.109017, -0.109215, -0.109276, -0.109131, -0.108812, -0.108355, -0.10784, -0.107395, -0.10713, -0.107099, -0.107236, -0.107432, -0.107589, -0.107648, -0.107579, -0.107294, -0.106813, -0.106123, -0.105249, -0.104413, -0.103631, -0.102983, -0.102549, -0.102273, -0.102255, -0.102474, -0.102823, -0.103203, -0.10352, -0.103707, -0.103698, -0.103473, -0.103087, -0.102659, -0.102323, -0.10214, -0.102171, -0.102442, -0.102839, -0.103251, -0.10355, -0.103725, -0.103687, -0.103388, -0.102924, -0.102323, -0.101672, -0.101018, -0.100392, -0.099881, -0.099554, -0.099456, -0.099555, -0.099802, -0.100181, -0.10057, -0.100772, -0.100777, -0.100574, -0.100188, -0.099742, -0.099329, -0.099051, -0.098975, -0.099062, -0.099241, -0.099515, -0.099808, -0.100029, -0.100084, -0.099961, -0.099614, -0.099102, -0.098513, -0.097947, -0.097407, -0.09692, -0.096584, -0.096433, -0.096562, -0.096902, -0.097427, -0.097991, -0.098476, -0.098803, -0.098898, -0.098694, -0.098323, -0.097935, -0.097564, -0.09729, -0.09718, -0.09723, -0.097358, -0.097496, -0.097581, -0.097568, -0.097415, -0.097187, -0.096913, -0.09651, -0.096024, -0.095577, -0.09518, -0.094876, -0.094798, -0.094996, -0.095463, -0.096061, -0.096762, -0.0974, -0.097888, -0.098186, -0.098269, -0.098158, -0.097932, -0.097757, -0.097703, -0.097773, -0.097968, -0.098237, -0.098482, -0.09864, -0.098619, -0.098336, -0.097762, -0.096921, -0.095895, -0.094797, -0.093639, -0.092584, -0.091647, -0.090799, -0.090146, -0.089689, -0.089343, -0.089096, -0.088862, -0.088518, -0.087942, -0.087086, -0.085991, -0.084739, -0.083498, -0.082439, -0.0816, -0.080899, -0.08031, -0.079752, -0.079124, -0.078304, -0.077346, -0.076193, -0.074825, -0.073364, -0.071805, -0.07021, -0.068659, -0.067249, -0.06597, -0.064935, -0.064148, -0.063556, -0.063052, -0.062596, -0.062042, -0.061306, -0.060298, -0.059116, -0.057831, -0.05644, -0.055266, -0.054285, -0.053539, -0.052891, -0.052313, -0.051661, -0.05092, -0.049993, -0.048868, -0.047605, -0.046211, -0.044748, -0.043317, -0.041879, -0.040444, -0.039191, -0.038198, -0.037348, -0.036759, -0.036258, -0.035827, -0.035307, -0.034753, -0.033963, -0.032998, -0.031901, -0.030814, -0.029867, -0.029136, -0.028639, -0.028307, -0.027996, -0.027616, -0.027084, -0.026369, -0.025361, -0.024215, -0.022818, -0.021413, -0.020001, -0.018713, -0.017448, -0.016292, -0.015354, -0.014637, -0.014129, -0.013796, -0.013627, -0.013468, -0.013249, -0.012896, -0.012396, -0.011721, -0.011014, -0.010435, -0.009962, -0.009801, -0.009909, -0.010209, -0.010558, -0.010873, -0.010991, -0.010909, -0.010526, -0.010004, -0.009261, -0.008448, -0.007574, -0.006687, -0.005983, -0.005447, -0.005097, -0.004968, -0.004966, -0.005097, -0.005314, -0.005398, -0.005334, -0.005058, -0.004569, -0.004057, -0.003592, -0.00323, -0.003071, -0.003183, -0.003543, -0.0041, -0.004691, -0.005196, -0.005502, -0.005588, -0.005435, -0.00519, -0.004918, -0.004651, -0.004561, -0.004593, -0.004777, -0.005153, -0.00572, -0.006512, -0.007471, -0.008396, -0.009246, -0.009884, -0.010211, -0.010332, -0.010314, -0.010196, -0.010193, -0.010424, -0.010947, -0.011805, -0.012825, -0.013814, -0.014732, -0.015451, -0.015944, -0.016252, -0.016233, -0.016032, -0.015789, -0.015538, -0.015354, -0.015321, -0.015451, -0.015859, -0.016414, -0.017043, -0.017891, -0.018667, -0.019277, -0.019683, -0.019811, -0.019742, -0.019523, -0.0193, -0.019225, -0.01932, -0.01959, -0.020032, -0.020433, -0.02082, -0.02103, -0.021051, -0.020855, -0.020484, -0.01998, -0.019368, -0.018702, -0.0181, -0.017644, -0.017287, -0.017111, -0.017086, -0.017306, -0.017553, -0.017792, -0.017971, -0.018082, -0.018099, -0.017914, -0.017611, -0.017377, -0.017257, -0.017482, -0.017921, -0.018455, -0.019003, -0.019489, -0.019875, -0.019938, -0.019863, -0.019511, -0.019039, -0.018531, -0.017991, -0.017501, -0.017133, -0.016964, -0.016951, -0.017082, -0.017212, -0.017391, -0.017546, -0.017711, -0.017749, -0.017552, -0.017143, -0.01676, -0.016176, -0.015631, -0.015279, -0.015197, -0.015411, -0.0157, -0.015886, -0.01599, -0.015891, -0.015661, -0.015232, -0.014625, -0.013909, -0.013126, -0.012397, -0.01188, -0.011506, -0.011279, -0.011188, -0.011239, -0.011455, -0.0118, -0.012133, -0.012408, -0.012456, -0.012338, -0.012055, -0.011685, -0.011355, -0.011319, -0.011576, -0.012153, -0.012955, -0.013729, -0.0145, -0.015146, -0.015559, -0.015652, -0.015506, -0.015282, -0.015116, -0.014854, -0.014687, -0.014672, -0.014926, -0.015372, -0.016008, -0.016775, -0.017621, -0.018407, -0.019096, -0.019604, -0.019904, -0.020118, -0.020075, -0.020033, -0.020124, -0.02049, -0.021156, -0.022002, -0.022975, -0.02389, -0.02468, -0.02523, -0.02544, -0.025377, -0.025194, -0.024874, -0.024602, -0.024406, -0.024356, -0.024461, -0.024763, -0.025225, -0.025846, -0.026527, -0.02722, -0.027876, -0.028422, -0.028828, -0.029029, -0.029033, -0.028985, -0.029001, -0.029251, -0.029761, -0.030625, -0.0316, -0.032566, -0.033349, -0.033958, -0.034265, -0.034381, -0.034268, -0.034064, -0.033827, -0.033624, -0.033493, -0.033548, -0.033802, -0.034265, -0.034857, -0.035457, -0.036145, -0.036814, -0.037334, -0.03778, -0.037949, -0.038083, -0.038143, -0.038368, -0.038838, -0.039535, -0.040524, -0.041782, -0.043101, -0.044309, -0.045267, -0.045953, -0.046278, -0.046388, -0.046231, -0.045975, -0.04567, -0.045352, -0.045087, -0.044941, -0.044995, -0.045173, -0.045439, -0.045772, -0.046023, -0.046192, -0.046171, -0.04593, -0.045432, -0.044909, -0.044427, -0.044057, -0.043937, -0.044016, -0.04432, -0.044584, -0.044784, -0.044822, -0.044656, -0.044259, -0.043575, -0.042784, -0.041966, -0.041144, -0.040343, -0.039597, -0.038978, -0.038446, -0.038089, -0.037746, -0.037495, -0.037268, -0.03703, -0.036653, -0.036142, -0.035405, -0.034445, -0.033488, -0.03261, -0.031861, -0.031416, -0.031159, -0.030965, -0.030663, -0.030311, -0.029721, -0.028973, -0.027802, -0.02661, -0.025335, -0.024021, -0.02285, -0.021808, -0.020975, -0.020425, -0.02003, -0.019775, -0.019597, -0.019369, -0.019101, -0.018724, -0.018142, -0.017385, -0.016493, -0.015564, -0.014791, -0.014191, -0.013893, -0.013875, -0.014032, -0.014213, -0.014168, -0.01391, -0.013445, -0.012715, -0.011719, -0.010559, -0.009381, -0.008241, -0.007151, -0.006248, -0.005554, -0.00499, -0.004603, -0.004258, -0.003827, -0.003363, -0.002813, -0.00213, -0.00125, -0.000246, 0.00077, 0.001708, 0.002462, 0.002864, 0.002823, 0.002591, 0.002168, 0.001864, 0.00177, 0.002042, 0.002676, 0.003463, 0.004384, 0.005365, 0.006327, 0.007284, 0.00797, 0.008569, 0.008882, 0.009124, 0.009241, 0.009296, 0.009418, 0.009694, 0.01008, 0.01054, 0.011189, 0.011927, 0.012703, 0.013336, 0.013754, 0.013901, 0.01359, 0.013041, 0.01231, 0.011703, 0.01135, 0.011304, 0.01158, 0.012088, 0.012715, 0.013392, 0.013937, 0.014338, 0.014629, 0.014676, 0.014475, 0.014277, 0.013955, 0.013621, 0.013395, 0.013294, 0.013357, 0.013607, 0.013918, 0.014216, 0.014443, 0.014507, 0.014275, 0.013742, 0.013035, 0.012205, 0.011464, 0.011002, 0.010884, 0.011011, 0.011318, 0.01173, 0.012255, 0.012709, 0.013009, 0.0131, 0.013039, 0.012755, 0.012422, 0.01195, 0.011396, 0.010924, 0.010607, 0.010431, 0.010492, 0.010635, 0.01083, 0.011103, 0.011294, 0.011254, 0.011098, 0.010727, 0.010315, 0.009827, 0.009539, 0.009354, 0.009494, 0.009848, 0.010367, 0.010983};
+const double vUTC_MINUS_UT1[] = {-0.438771, -0.441294, -0.443637, -0.445805, -0.447842, -0.449829, -0.451867, -0.454054, -0.456452, -0.459058, -0.461812, -0.464618, -0.467373, -0.470011, -0.472464, -0.474703, -0.476752, -0.478673, -0.480543, -0.482439, -0.484407, -0.486467, -0.488613, -0.490852, -0.493169, -0.495531, -0.497887, -0.500166, -0.502299, -0.504262, -0.506045, -0.507666, -0.509196, -0.510734, -0.512389, -0.514229, -0.51626, -0.518427, -0.520636, -0.522786, -0.524794, -0.52662, -0.528255, -0.529729, -0.531096, -0.532414, -0.533739, -0.535116, -0.536576, -0.538141, -0.539818, -0.541602, -0.543459, -0.545339, -0.547186, -0.548944, -0.550569, -0.552037, -0.55335, -0.554551, -0.555722, 0.443037, 0.441665, 0.440116, 0.438404, 0.436611, 0.434853, 0.433226, 0.431786, 0.430546, 0.429489, 0.428559, 0.427699, 0.426857, 0.425987, 0.425038, 0.423964, 0.42275, 0.421409, 0.419964, 0.418446, 0.416897, 0.415357, 0.413867, 0.412456, 0.411135, 0.409883, 0.408646, 0.407359, 0.405941, 0.40431, 0.40244, 0.400381, 0.39824, 0.396144, 0.394198, 0.392458, 0.3909, 0.389507, 0.388234, 0.387031, 0.385843, 0.384605, 0.383208, 0.381616, 0.379861, 0.378001, 0.376091, 0.37418, 0.372312, 0.370513, 0.36879, 0.367144, 0.365556, 0.363977, 0.362335, 0.36055, 0.358542, 0.35625, 0.353686, 0.35096, 0.348239, 0.345693, 0.343446, 0.341523, 0.339862, 0.338386, 0.337008, 0.335638, 0.334192, 0.332608, 0.330853, 0.328939, 0.326902, 0.324787, 0.322649, 0.320547, 0.318536, 0.31665, 0.314884, 0.313209, 0.311582, 0.309947, 0.308234, 0.306377, 0.304315, 0.301995, 0.299458, 0.296808, 0.294183, 0.291699, 0.289415, 0.287336, 0.285421, 0.283609, 0.281835, 0.280027, 0.278128, 0.276096, 0.273913, 0.271588, 0.269155, 0.266662, 0.264171, 0.261744, 0.259426, 0.257236, 0.255136, 0.253092, 0.25105, 0.248921, 0.246617, 0.244073, 0.241256, 0.23819, 0.234995, 0.231824, 0.228801, 0.22601, 0.223482, 0.221181, 0.219026, 0.216928, 0.214814, 0.212632, 0.210374, 0.208059, 0.205703, 0.203283, 0.200789, 0.198277, 0.1958, 0.193401, 0.191112, 0.188929, 0.186822, 0.184744, 0.182625, 0.18038, 0.177935, 0.175255, 0.172358, 0.169327, 0.166279, 0.163331, 0.160563, 0.158013, 0.155673, 0.153492, 0.151392, 0.149297, 0.147151, 0.14492, 0.142588, 0.140163, 0.137634, 0.135001, 0.132299, 0.129598, 0.126942, 0.12436, 0.121884, 0.119512, 0.117194, 0.114861, 0.112435, 0.109849, 0.107078, 0.104141, 0.101104, 0.098074, 0.095158, 0.092437, 0.089951, 0.087698, 0.085629, 0.083661, 0.081701, 0.079676, 0.077533, 0.075246, 0.07281, 0.070244, 0.067581, 0.064872, 0.062159, 0.059475, 0.056852, 0.054304, 0.05183, 0.049404, 0.046997, 0.044556, 0.042022, 0.039335, 0.036481, 0.033509, 0.030508, 0.027579, 0.024806, 0.022229, 0.019851, 0.017641, 0.01555, 0.01351, 0.011444, 0.009299, 0.00705, 0.00468, 0.002187, -0.000419, -0.003117, -0.005859, -0.00858, -0.011237, -0.013802, -0.016269, -0.018653, -0.021006, -0.023411, -0.02596, -0.028733, -0.031762, -0.035012, -0.03838, -0.041731, -0.044927, -0.047868, -0.050524, -0.052942, -0.055206, -0.057409, -0.059637, -0.061948, -0.064384, -0.066965, -0.069677, -0.072479, -0.075317, -0.078132, -0.080879, -0.083525, -0.08605, -0.088449, -0.090737, -0.092949, -0.095152, -0.097437, -0.099891, -0.102574, -0.10551, -0.108658, -0.111923, -0.115184, -0.118321, -0.121265, -0.12401, -0.126607, -0.129123, -0.131619, -0.134142, -0.136728, -0.139397, -0.142156, -0.144991, -0.147873, -0.150764, -0.153625, -0.156411, -0.159076, -0.161616, -0.164042, -0.166377, -0.168668, -0.170982, -0.173413, -0.176042, -0.178915, -0.182024, -0.185302, -0.188642, -0.191934, -0.195079, -0.198033, -0.200818, -0.203492, -0.206124, -0.208763, -0.211456, -0.214249, -0.217134, -0.220079, -0.223048, -0.226005, -0.228909, -0.231742, -0.234521, -0.237254, -0.239913, -0.2425, -0.245044, -0.247587, -0.250213, -0.25303, -0.256094, -0.259383, -0.262825, -0.26631, -0.269701, -0.272882, -0.275803, -0.278473, -0.280959, -0.283345, -0.285706, -0.288091, -0.290515, -0.292971, -0.295471, -0.298027, -0.300616, -0.303207, -0.305762, -0.30825, -0.310638, -0.312912, -0.315091, -0.317211, -0.319335, -0.321536, -0.323875, -0.326383, -0.329059, -0.331865, -0.334726, -0.337549, -0.340242, -0.342731, -0.344985, -0.347031, -0.348937, -0.350793, -0.352675, -0.354636, -0.356693, -0.358832, -0.36104, -0.363286, -0.365527, -0.367718, -0.36982, -0.371803, -0.373667, -0.375432, -0.377128, -0.378809, -0.380545, -0.382401, -0.384417, -0.386583, -0.388856, -0.391178, -0.39347, -0.395643, -0.397627, -0.399395, 0.599021, 0.597567, 0.596174, 0.594781, 0.59334, 0.591829, 0.590251, 0.588627, 0.586993, 0.585379, 0.583809, 0.582297, 0.58085, 0.579461, 0.578121, 0.576836, 0.575583, 0.574306, 0.572918, 0.571344, 0.569539, 0.567495, 0.565287, 0.563043, 0.560883, 0.558894, 0.557111, 0.555521, 0.554057, 0.552629, 0.551177, 0.54965, 0.548015, 0.546261, 0.544396, 0.54244, 0.540433, 0.538443, 0.536522, 0.534704, 0.533009, 0.531439, 0.529958, 0.528505, 0.527009, 0.525388, 0.523573, 0.521527, 0.519252, 0.516786, 0.514218, 0.511673, 0.509269, 0.507075, 0.505105, 0.503331, 0.501688, 0.500107, 0.498514, 0.496853, 0.495089, 0.493208, 0.491217, 0.489143, 0.48704, 0.484959, 0.48294, 0.481006, 0.479158, 0.477382, 0.475656, 0.473927, 0.472119, 0.470152, 0.467958, 0.46551, 0.462832, 0.460013, 0.457185, 0.454477, 0.451971, 0.449683, 0.447566, 0.445533, 0.443508, 0.441444, 0.439302, 0.437064, 0.434738, 0.432348, 0.429931, 0.427539, 0.425195, 0.422913, 0.420702, 0.418554, 0.416447, 0.41434, 0.412194, 0.409984, 0.407662, 0.405168, 0.402452, 0.3995, 0.396346, 0.393065, 0.389801, 0.386688, 0.383806, 0.38116, 0.378699, 0.376338, 0.373984, 0.371561, 0.369044, 0.366431, 0.363741, 0.360998, 0.358235, 0.355492, 0.352811, 0.350219, 0.347732, 0.345355, 0.343075, 0.340861, 0.338681, 0.336477, 0.334166, 0.33168, 0.32898, 0.326074, 0.323015, 0.31991, 0.316882, 0.314026, 0.311386, 0.308946, 0.306644, 0.304404, 0.302159, 0.299862, 0.297499, 0.295074, 0.292608, 0.290126, 0.287659, 0.285243, 0.282916, 0.280697, 0.278595, 0.27661, 0.274737, 0.272943, 0.271131, 0.269246, 0.267224, 0.26502, 0.26262, 0.260045, 0.257348, 0.254631, 0.251988, 0.249478, 0.247118, 0.244875, 0.242678, 0.240444, 0.238101, 0.235633, 0.233075, 0.230463, 0.227826, 0.225183, 0.22256, 0.220025, 0.217597, 0.21527, 0.213038, 0.210884, 0.208771, 0.206648, 0.204452, 0.202092, 0.199546, 0.196842, 0.194043, 0.191236, 0.188515, 0.185943, 0.183549, 0.181336, 0.179269, 0.177276, 0.175283, 0.173232, 0.171055, 0.168744, 0.166369, 0.164023, 0.161732, 0.15948, 0.157293, 0.155218, 0.153228, 0.151273, 0.149345, 0.147415, 0.145446, 0.143368, 0.141094, 0.138609, 0.135941, 0.133149, 0.130324, 0.127565, 0.124965, 0.12257, 0.12037, 0.11833, 0.116392, 0.114476, 0.1125, 0.110419, 0.108228, 0.105944, 0.103608, 0.101255, 0.098911, 0.096609, 0.09438, 0.092239, 0.090168, 0.088144, 0.086132, 0.084072, 0.0819, 0.079547, 0.076944, 0.074062, 0.070928, 0.067618, 0.064246, 0.060935, 0.057775, 0.054804, 0.052024, 0.049409, 0.046903, 0.044427, 0.041923, 0.039359, 0.03672, 0.034035, 0.031371, 0.028782, 0.026285, 0.023886, 0.021577, 0.019341, 0.017183, 0.015071, 0.012961, 0.010793, 0.008504, 0.006035, 0.003335, 0.000398, -0.00275, -0.006006, -0.009231, -0.012298, -0.015133, -0.017753, -0.020219, -0.022601, -0.024976, -0.027398, -0.029875, -0.0324, -0.034976, -0.037591, -0.04022, -0.04283, -0.045386, -0.047856, -0.050219, -0.052478, -0.054647, -0.056755, -0.058866, -0.061045, -0.063353, -0.065832, -0.068488, -0.071337, -0.074367, -0.077506, -0.080633, -0.083624, -0.086404, -0.088987, -0.091454, -0.093897, -0.096375, -0.098912, -0.101501, -0.10412, -0.106754, -0.109379, -0.111956, -0.114459, -0.116875, -0.119192, -0.121422, -0.123604, -0.125764, -0.127913, -0.1301, -0.132367, -0.134745, -0.137252, -0.139888, -0.142628, -0.145406, -0.148135, -0.150731, -0.153136, -0.155333, -0.157352, -0.159273, -0.161164, -0.163075, -0.165025, -0.167017, -0.169035, -0.171042, -0.172995, -0.174865, -0.176634, -0.178293, -0.17984, -0.181294, -0.182688, -0.184075, -0.185521, -0.187076, -0.188773, -0.190626, -0.192626, -0.194723, -0.196859, -0.198966, -0.200968, -0.202795, -0.204409, -0.205822, -0.207102, -0.208322, -0.209544, -0.210808, -0.212121, -0.213461, -0.214783, -0.216023, 0.782811, 0.781698, 0.780652, 0.779679, 0.778771, 0.777903, 0.777045, 0.77613, 0.775074, 0.773833, 0.77239, 0.770755, 0.768967, 0.767079, 0.765161, 0.763256, 0.761429, 0.759732, 0.758188, 0.756788, 0.755489, 0.754209, 0.752865, 0.75142, 0.749898, 0.748345, 0.746811, 0.74534, 0.743927, 0.742554, 0.741241, 0.740004, 0.738845, 0.737737, 0.736598, 0.735375, 0.734035, 0.732553, 0.730937, 0.729218, 0.727457, 0.72569, 0.723979, 0.722393, 0.720964, 0.719673, 0.718458, 0.717244, 0.715988, 0.714641, 0.713172, 0.711577, 0.709877, 0.708113, 0.706334, 0.704594, 0.702935, 0.701339, 0.699801, 0.698319, 0.69688, 0.695455, 0.693974, 0.692366, 0.690576, 0.688567, 0.686335, 0.683921, 0.681407, 0.678876, 0.676345, 0.67389, 0.671543, 0.669288, 0.667076, 0.664854, 0.662575, 0.660197, 0.657694, 0.655099, 0.652471, 0.649873, 0.647351, 0.644918, 0.642599, 0.640409, 0.638336, 0.636348, 0.634404, 0.632462, 0.630483, 0.628413, 0.626195, 0.623792, 0.621202, 0.618451, 0.615597, 0.612744, 0.610003, 0.607436, 0.605026, 0.602714, 0.600426, 0.5981, 0.595704, 0.593235, 0.590713, 0.588175, 0.585673, 0.583263, 0.58099, 0.578857, 0.576824, 0.574853, 0.572917, 0.570982, 0.569009, 0.566952, 0.564777, 0.56246, 0.559976, 0.557311, 0.554487, 0.551555, 0.548596, 0.545698, 0.542948, 0.540374, 0.537951, 0.535614, 0.533304, 0.530975, 0.528584, 0.526129, 0.52363, 0.52112, 0.518635, 0.516201, 0.513837, 0.51156, 0.509379, 0.507287, 0.505257, 0.503243, 0.501191, 0.499047, 0.496763, 0.494322, 0.491733, 0.489026, 0.486249, 0.483473, 0.480768, 0.478143, 0.475622, 0.473216, 0.470893, 0.468593, 0.466253, 0.463839, 0.461363, 0.458857, 0.456351, 0.453866, 0.451416, 0.449009, 0.446652, 0.444383, 0.44217, 0.439965, 0.437716, 0.435372, 0.43289, 0.430246, 0.427482, 0.424611, 0.421637, 0.418588, 0.415511, 0.412464, 0.409505, 0.406666, 0.403956, 0.401307, 0.398652, 0.39593, 0.393103, 0.390169, 0.387174, 0.384191, 0.381283, 0.378498, 0.375865, 0.373398, 0.371092, 0.368905, 0.366792, 0.364712, 0.36262, 0.360479, 0.358259, 0.35593, 0.353446, 0.350824, 0.348089, 0.345278, 0.342434, 0.339606, 0.336833, 0.33412, 0.331449, 0.328797, 0.326115, 0.323363, 0.320531, 0.31765, 0.314766, 0.311904, 0.309082, 0.306333, 0.303683, 0.301154, 0.298763, 0.296501, 0.294308, 0.292143, 0.289969, 0.287735, 0.285396, 0.282916, 0.280266, 0.277483, 0.274639, 0.2718, 0.269026, 0.266355, 0.263795, 0.261322, 0.258882, 0.256398, 0.253816, 0.251104, 0.248267, 0.245333, 0.242328, 0.239283, 0.236229, 0.23322, 0.230302, 0.227508, 0.224836, 0.222214, 0.219571, 0.216871, 0.214098, 0.211237, 0.208288, 0.205247, 0.202087, 0.19883, 0.195535, 0.19228, 0.18914, 0.186189, 0.183463, 0.180923, 0.178449, 0.175937, 0.173332, 0.170618, 0.167805, 0.164928, 0.162025, 0.159143, 0.156324, 0.15359, 0.150948, 0.148398, 0.145932, 0.143512, 0.14107, 0.138563, 0.135979, 0.133307, 0.13051, 0.127562, 0.124471, 0.121318, 0.118172, 0.115084, 0.112092, 0.109218, 0.106455, 0.103781, 0.101131, 0.098437, 0.095673, 0.092834, 0.089934, 0.087004, 0.084102, 0.081291, 0.078608, 0.076066, 0.073655, 0.07132, 0.068995, 0.066632, 0.06421, 0.061722, 0.059168, 0.05654, 0.0538, 0.050927, 0.047942, 0.044904, 0.041903, 0.038982, 0.036159, 0.033446, 0.030826, 0.028262, 0.025713, 0.023151, 0.020581, 0.01803, 0.015539, 0.013144, 0.010868, 0.008684, 0.006581, 0.00457, 0.00263, 0.000735, -0.001146, -0.003046, -0.005009, -0.007072, -0.009248, -0.011523, -0.01388, -0.016297, -0.018757, -0.021204, -0.023574, -0.025833, -0.027976, -0.030031, -0.032068, -0.034149, -0.036274, -0.038466, -0.040709, -0.042956, -0.045157, -0.047269, -0.049251, -0.051065, -0.052679, -0.054095, -0.055364, -0.056533, -0.057658, -0.058806, -0.060037, -0.061389, -0.062885, -0.064522, -0.066256, -0.068021, -0.069761, -0.071447, -0.073054, -0.074572, -0.076018, -0.077434, -0.078877, -0.080394, -0.081999, -0.083699, -0.085456, -0.087203, -0.088869, -0.090403, -0.091781, -0.093, -0.094066, -0.095008, -0.095867, -0.096687, -0.097509, -0.098368, -0.099294, -0.100314, -0.101453, -0.102723, -0.104102, -0.105542, -0.106974, -0.108359, -0.10969, -0.11099, -0.112295, -0.113648, -0.115092, -0.116654, -0.118335, -0.120096, -0.121879, -0.123626, -0.125292, -0.126859, -0.128326, -0.129701, -0.131015, -0.132314, -0.133634, -0.135007, -0.136459, -0.137997, -0.139645, -0.14144, -0.14339, -0.145454, -0.147588, -0.1497, -0.151764, -0.15378, -0.155758, -0.157719, -0.159693, -0.161719, -0.163826, -0.166019, -0.1683, -0.170645, -0.172987, -0.175256, -0.177411, -0.179442, -0.181363, -0.183215, -0.185039, -0.186866, -0.188719, -0.190617, -0.192586, -0.1947, -0.196985, -0.199434, -0.202016, -0.204684, -0.207375, -0.21002, -0.212556, -0.214976, -0.217311, -0.219616, -0.221952, -0.224366, -0.226875, -0.229455, -0.232093, -0.234768, -0.237438, -0.24004, -0.242511, -0.244819, -0.246991, -0.249039, -0.250989, -0.2529, -0.254819, -0.256793, -0.258861, -0.261021, -0.263262, -0.265605, -0.268036, -0.270503, -0.272965, -0.275391, -0.277756, -0.28005, -0.282302, -0.284577, -0.286934, -0.289416, -0.292037, -0.294778, -0.297552, -0.300275, -0.3029, -0.305398, -0.307771, -0.310033, -0.312191, -0.31424, -0.316219, -0.318192, -0.320225, -0.322368, -0.324665, -0.327156, -0.329805, -0.332557, -0.33539, -0.338265, -0.341132, -0.343947, -0.346679, -0.349339, -0.351967, -0.354612, -0.357311, -0.360071, -0.362878, -0.365696, -0.36846, -0.371122, -0.373674, -0.376121, -0.378456, -0.380682, -0.382816, -0.384907, -0.387006, -0.389161, -0.391392, -0.393714, -0.396141, -0.398689, -0.40131, -0.403956, -0.406607, -0.40926, -0.411886, -0.414458, -0.416957, -0.419401, -0.421853, -0.424392, -0.427057, -0.429814, -0.432597, -0.435331, -0.437945, -0.440387, -0.442627, 0.555341, 0.553497, 0.551802, 0.550209, 0.548666, 0.547111, 0.545481, 0.543734, 0.541878, 0.539946, 0.53797, 0.535975, 0.533975, 0.531983, 0.530016, 0.528091, 0.526232, 0.524454, 0.522702, 0.520882, 0.518937, 0.516862, 0.514716, 0.512587, 0.510532, 0.508595, 0.506795, 0.505139, 0.503611, 0.502181, 0.500803, 0.499418, 0.497971, 0.496423, 0.494765, 0.492998, 0.491124, 0.489135, 0.487045, 0.484901, 0.482757, 0.480654, 0.478618, 0.476648, 0.47472, 0.472791, 0.470795, 0.468661, 0.466355, 0.463889, 0.461322, 0.458738, 0.456217, 0.453852, 0.451711, 0.449753, 0.447906, 0.446114, 0.444341, 0.442555, 0.440694, 0.438708, 0.43658, 0.4343, 0.431884, 0.429364, 0.426779, 0.424166, 0.42156, 0.418988, 0.416473, 0.414049, 0.411742, 0.409534, 0.40735, 0.405121, 0.402811, 0.400424, 0.39799, 0.39555, 0.393153, 0.390858, 0.388697, 0.386661, 0.384715, 0.382827, 0.380962, 0.379083, 0.377148, 0.375128, 0.373002, 0.370758, 0.368387, 0.365915, 0.363411, 0.360909, 0.358435, 0.356019, 0.353674, 0.35139, 0.349127, 0.346824, 0.344435, 0.341946, 0.339381, 0.336793, 0.334234, 0.331753, 0.32938, 0.32716, 0.325093, 0.323132, 0.32122, 0.31933, 0.317429, 0.31548, 0.313457, 0.311329, 0.309077, 0.306709, 0.304237, 0.30168, 0.299061, 0.296436, 0.293872, 0.291403, 0.289026, 0.286698, 0.284357, 0.281948, 0.279446, 0.276846, 0.274179, 0.271507, 0.268895, 0.266397, 0.264039, 0.261848, 0.259825, 0.257939, 0.256154, 0.254445, 0.252781, 0.251107, 0.249389, 0.247611, 0.245761, 0.243846, 0.24189, 0.239925, 0.237981, 0.236105, 0.234324, 0.232631, 0.230984, 0.229319, 0.227577, 0.225744, 0.223822, 0.221824, 0.219774, 0.217715, 0.215713, 0.213822, 0.212074, 0.21048, 0.209037, 0.207732, 0.206502, 0.205303, 0.204093, 0.202826, 0.201474, 0.200034, 0.198512, 0.19694, 0.195358, 0.193807, 0.1923, 0.190869, 0.18954, 0.188305, 0.187126, 0.185945, 0.184696, 0.183328, 0.181878, 0.180417, 0.179006, 0.177683, 0.176469, 0.175369, 0.174367, 0.173455, 0.172618, 0.171807, 0.17098, 0.170107, 0.169171, 0.168156, 0.16705, 0.165868, 0.164623, 0.163332, 0.162011, 0.160676, 0.159338, 0.158034, 0.15679, 0.15557, 0.154305, 0.152928, 0.151394, 0.149706, 0.147942, 0.146212, 0.144618, 0.143216, 0.14201, 0.140986, 0.140125, 0.13938, 0.138692, 0.138027, 0.137335, 0.136584, 0.135761, 0.134853, 0.133853, 0.132764, 0.131613, 0.130439, 0.12927, 0.128124, 0.126999, 0.125883, 0.124773, 0.123639, 0.122426, 0.121082, 0.119579, 0.117894, 0.116098, 0.114297, 0.112589, 0.111044, 0.109688, 0.108514, 0.10747, 0.10651, 0.105581, 0.104644, 0.103646, 0.102527, 0.101234, 0.099727, 0.098049, 0.096275, 0.094461, 0.092655, 0.090904, 0.089241, 0.087646, 0.086077, 0.084478, 0.082806, 0.08099, 0.078982, 0.076782, 0.074447, 0.072085, 0.069798, 0.067648, 0.065647, 0.063769, 0.061985, 0.060328, 0.058753, 0.0572, 0.055609, 0.053957, 0.052221, 0.050385, 0.048441, 0.046408, 0.044319, 0.042202, 0.04009, 0.038016, 0.036006, 0.034065, 0.032175, 0.030269, 0.028255, 0.026111, 0.023853, 0.021499, 0.019057, 0.016604, 0.014238, 0.012017, 0.009967, 0.008077, 0.006323, 0.004668, 0.003049, 0.001419, -0.000275, -0.002076, -0.004006, -0.006066, -0.008203, -0.010382, -0.012566, -0.014701, -0.01678, -0.018821, -0.020845, -0.022817, -0.024698, -0.026539, -0.028455, -0.030476, -0.032584, -0.034742, -0.036903, -0.039002, -0.040982, -0.042827, -0.044559, -0.046208, -0.047811, -0.049386, -0.05096, -0.05256, -0.054205, -0.055894, -0.057613, -0.059355, -0.061138, -0.062946, -0.06474, -0.066487, -0.068178, -0.069825, -0.071457, -0.073118, -0.074848, -0.076688, -0.078657, -0.080731, -0.082872, -0.08504, -0.087198, -0.089284, -0.091251, -0.093105, -0.094882, -0.096605, -0.098288, -0.099962, -0.101663, -0.103416, -0.105234, -0.10712, -0.109063, -0.111049, -0.113053, -0.115056, -0.117029, -0.118956, -0.120832, -0.122672, -0.124512, -0.126397, -0.128363, -0.130434, -0.132595, -0.134811, -0.137047, -0.139249, -0.141363, -0.143345, -0.145164, -0.146822, -0.148351, -0.149794, -0.151207, -0.15265, -0.154129, -0.155619, -0.157145, -0.158726, -0.160365, -0.162024, -0.163627, -0.165165, -0.166648, -0.168034, -0.169331, -0.170593, -0.171898, -0.17334, -0.174965, -0.176785, -0.17875, -0.180788, -0.182862, -0.184925, -0.18687, -0.188667, -0.19035, -0.191942, -0.193472, -0.194994, -0.19655, -0.198159, -0.199847, -0.201624, -0.203499, -0.205456, -0.207475, -0.209507, -0.21152, -0.213527, -0.215538, -0.217555, -0.219581, -0.221631, -0.223748, -0.225986, -0.228409, -0.231037, -0.23383, -0.236697, -0.23954, -0.242283, -0.24488, -0.247343, -0.249717, -0.252052, -0.254387, -0.256743, -0.259141, -0.261593, -0.264062, -0.26656, -0.2691, -0.271667, -0.27424, -0.276794, -0.279303, -0.281759, -0.284176, -0.286568, -0.288962, -0.291395, -0.293903, -0.296517, -0.299267, -0.30215, -0.305115, -0.308072, -0.310934, -0.31364, -0.316189, -0.318595, -0.320892, -0.323114, -0.325302, -0.327485, -0.329693, -0.331967, -0.334286, -0.336625, -0.338985, -0.341348, -0.343669, -0.345916, -0.348082, -0.35017, -0.35219, -0.354157, -0.356102, -0.358078, -0.360135, -0.362309, -0.36459, -0.366979, -0.369456, -0.371966, -0.37444, -0.376836, -0.379092, -0.381216, -0.38326, -0.385249, -0.387207, -0.389157, -0.391111, -0.393072, -0.395048, -0.39706, -0.39911, -0.401187, -0.403278, -0.405367, -0.407421, -0.409427, -0.4114, -0.41337, -0.415376, -0.417468, -0.419691, -0.422063, -0.424554, -0.427092, -0.429603, -0.432024, -0.434291, -0.436362, -0.438218, -0.439888, -0.44144, -0.442925, -0.444385, -0.44586, -0.447378, -0.448949, -0.450554, -0.452163, -0.453749, -0.455279, -0.456727, -0.458072, -0.459271, -0.460336, -0.461324, -0.462302, -0.46334, -0.464481, -0.465732, -0.46707, -0.468444, -0.469783, -0.471024, -0.472129, 0.526926, 0.526142, 0.525501, 0.524956, 0.524438, 0.523886, 0.523252, 0.52252, 0.521695, 0.52079, 0.519812, 0.518773, 0.517684, 0.516568, 0.515459, 0.514394, 0.513363, 0.5123, 0.511138, 0.50983, 0.508334, 0.506641, 0.504783, 0.502817, 0.500793, 0.498819, 0.496968, 0.495275, 0.493738, 0.492341, 0.491057, 0.489826, 0.488594, 0.487338, 0.48605, 0.484712, 0.483326, 0.481898, 0.480436, 0.478958, 0.477503, 0.476107, 0.474787, 0.47354, 0.472353, 0.471192, 0.469988, 0.468665, 0.467178, 0.465524, 0.463725, 0.461827, 0.459942, 0.458164, 0.456541, 0.45508, 0.453734, 0.452435, 0.451133, 0.449822, 0.44849, 0.447115, 0.445673, 0.444153, 0.442572, 0.440957, 0.439348, 0.437768, 0.436222, 0.434713, 0.433276, 0.431916, 0.43054, 0.42908, 0.427502, 0.42577, 0.423828, 0.421662, 0.419311, 0.41687, 0.414461, 0.41219, 0.410103, 0.408183, 0.406382, 0.404645, 0.402919, 0.401149, 0.399291, 0.397362, 0.395382, 0.393381, 0.391369, 0.389311, 0.387239, 0.385211, 0.383253, 0.381367, 0.379526, 0.377692, 0.375812, 0.373846, 0.371762, 0.369529, 0.367136, 0.364614, 0.362024, 0.359435, 0.356928, 0.354575, 0.352405, 0.350397, 0.348511, 0.346706, 0.344949, 0.343194, 0.341397, 0.339541, 0.33762, 0.335643, 0.333613, 0.331539, 0.329432, 0.327301, 0.325184, 0.323107, 0.321068, 0.319027, 0.316898, 0.314656, 0.312305, 0.309832, 0.307226, 0.304546, 0.301885, 0.299337, 0.297, 0.294923, 0.293073, 0.291382, 0.289786, 0.28822, 0.286632, 0.285027, 0.28342, 0.2818, 0.280161, 0.278512, 0.276874, 0.275276, 0.273734, 0.272255, 0.27083, 0.269439, 0.268055, 0.266646, 0.265187, 0.263623, 0.261895, 0.259954, 0.257804, 0.255537, 0.253265, 0.251084, 0.249036, 0.247153, 0.245442, 0.243865, 0.242359, 0.24088, 0.239391, 0.23787, 0.236291, 0.234651, 0.232968, 0.231254, 0.229549, 0.227899, 0.226328, 0.224856, 0.223484, 0.222184, 0.220896, 0.219561, 0.218131, 0.216552, 0.214792, 0.212857, 0.210793, 0.20872, 0.206739, 0.204893, 0.203211, 0.201694, 0.200279, 0.198886, 0.197462, 0.195955, 0.194359, 0.192704, 0.191017, 0.1893, 0.187552, 0.185794, 0.184054, 0.182333, 0.180632, 0.178936, 0.177236, 0.175531, 0.173767, 0.171857, 0.169726, 0.16738, 0.164885, 0.162337, 0.159786, 0.157277, 0.154838, 0.152472, 0.150211, 0.14807, 0.146001, 0.143964, 0.141982, 0.140056, 0.13812, 0.136153, 0.134162, 0.132165, 0.130179, 0.128217, 0.126312, 0.124501, 0.122729, 0.120939, 0.119128, 0.117265, 0.115298, 0.113181, 0.110902, 0.108481, 0.105935, 0.103295, 0.100663, 0.098143, 0.095799, 0.093625, 0.091588, 0.089652, 0.087783, 0.085942, 0.084083, 0.08215, 0.080095, 0.077987, 0.075863, 0.073746, 0.071665, 0.069643, 0.067699, 0.065841, 0.064054, 0.062306, 0.060553, 0.058746, 0.056836, 0.054764, 0.052456, 0.049946, 0.047354, 0.044783, 0.042296, 0.039969, 0.037828, 0.03584, 0.033962, 0.032144, 0.030334, 0.028499, 0.026622, 0.024698, 0.022734, 0.020785, 0.018846, 0.016894, 0.014948, 0.01306, 0.011258, 0.009522, 0.007854, 0.006197, 0.0045, 0.002716, 0.000796, -0.001299, -0.003579, -0.006035, -0.008599, -0.011134, -0.013517, -0.015692, -0.017666, -0.019506, -0.021295, -0.023076, -0.024858, -0.026639, -0.028417, -0.030209, -0.032052, -0.0339, -0.035714, -0.037491, -0.039206, -0.040836, -0.042369, -0.043816, -0.045222, -0.046662, -0.048212, -0.049927, -0.051838, -0.053944, -0.056206, -0.058553, -0.060945, -0.063271, -0.065424, -0.067357, -0.069071, -0.070592, -0.071976, -0.073297, -0.074613, -0.075944, -0.077271, -0.078582, -0.079878, -0.081145, -0.082356, -0.083458, -0.084432, -0.085284, -0.086032, -0.086726, -0.087406, -0.088102, -0.088861, -0.089719, -0.090653, -0.091635, -0.092642, -0.093617, -0.094541, -0.095373, -0.096063, -0.096596, -0.097014, -0.097399, -0.097792, -0.098219, -0.098686, -0.099206, -0.099787, -0.100409, -0.101033, -0.101598, -0.102067, -0.10244, -0.102719, -0.102897, -0.102982, -0.103003, -0.103041, -0.103195, -0.103523, -0.10403, -0.104681, -0.105419, -0.106174, -0.106866, -0.107439, -0.107872, -0.108164, -0.108331, -0.108423, -0.108522, -0.108684, -0.108945, -0.109314, -0.109762, -0.110247, -0.11073, -0.111194, -0.11167, -0.112137, -0.112552, -0.112918, -0.113247, -0.11356, -0.113884, -0.114274, -0.114795, -0.115484, -0.116339, -0.117309, -0.118317, -0.119287, -0.120133, -0.1208, -0.121275, -0.121593, -0.121827, -0.122036, -0.122237, -0.122495, -0.122859, -0.123315, -0.123841, -0.124424, -0.125062, -0.125743, -0.126364, -0.126921, -0.127468, -0.128027, -0.128609, -0.129234, -0.129924, -0.130722, -0.131683, -0.132837, -0.13415, -0.135573, -0.137032, -0.138443, -0.139703, -0.140756, -0.141625, -0.142353, -0.143036, -0.143748, -0.144525, -0.145383, -0.146344, -0.147409, -0.148534, -0.149673, -0.15078, -0.151829, -0.152826, -0.153774, -0.15467, -0.155505, -0.156318, -0.157172, -0.158162, -0.159346, -0.16075, -0.162382, -0.164199, -0.166101, -0.167977, -0.169772, -0.17143, -0.172952, -0.174344, -0.175627, -0.176859, -0.178108, -0.17944, -0.180827, -0.182244, -0.183689, -0.185154, -0.186616, -0.188065, -0.189479, -0.190814, -0.192074, -0.193303, -0.194523, -0.195716, -0.196901, -0.19816, -0.19959, -0.201245, -0.20313, -0.205193, -0.207325, -0.209409, -0.211365, -0.213141, -0.214755, -0.216249, -0.217682, -0.21912, -0.220591, -0.22209, -0.223608, -0.225132, -0.226641, -0.228114, -0.229545, -0.230934, -0.232281, -0.233578, -0.234834, -0.236062, -0.237288, -0.238533, -0.239819, -0.241204, -0.24274, -0.24444, -0.246269, -0.248132, -0.24993, -0.251594, -0.253116, -0.25448, -0.255707, -0.256849, -0.25795, -0.259032, -0.260105, -0.261218, -0.262391, -0.263583, -0.264736, -0.265827, -0.266846, -0.267779, -0.268616, -0.269372, -0.27006, -0.270701, -0.271336, -0.272001, -0.272744, -0.27365, -0.27475, -0.276001, -0.277331, -0.278675, -0.279977, -0.28121, -0.282334, 0.716663, 0.715754, 0.714893, 0.714042, 0.713182, 0.712279, 0.711265, 0.710184, 0.709105, 0.708035, 0.706994, 0.706048, 0.705235, 0.7045, 0.703818, 0.703208, 0.702652, 0.702107, 0.701491, 0.700737, 0.699797, 0.698672, 0.697403, 0.696035, 0.694625, 0.693274, 0.692025, 0.690842, 0.689699, 0.688545, 0.687362, 0.686136, 0.684864, 0.683555, 0.682226, 0.680893, 0.679571, 0.678288, 0.677076, 0.675955, 0.674912, 0.673943, 0.673036, 0.672139, 0.67118, 0.670114, 0.668918, 0.667574, 0.666052, 0.664394, 0.662697, 0.661041, 0.659473, 0.658051, 0.656811, 0.655731, 0.654768, 0.653875, 0.652988, 0.652067, 0.651125, 0.650175, 0.649198, 0.648184, 0.647173, 0.646258, 0.645429, 0.644668, 0.643957, 0.643265, 0.642549, 0.641765, 0.640864, 0.6398, 0.638561, 0.63716, 0.635628, 0.634007, 0.632345, 0.630683, 0.629082, 0.627621, 0.626318, 0.625115, 0.623966, 0.62279, 0.621548, 0.620227, 0.618855, 0.617466, 0.616056, 0.614636, 0.613249, 0.611944, 0.610719, 0.60955, 0.608406, 0.607302, 0.606216, 0.605079, 0.603838, 0.602437, 0.600831, 0.599032, 0.597127, 0.595189, 0.593301, 0.591542, 0.589937, 0.58848, 0.587136, 0.58587, 0.584652, 0.58341, 0.582104, 0.580727, 0.579288, 0.577815, 0.576342, 0.574911, 0.573557, 0.572301, 0.571161, 0.570153, 0.569285, 0.568525, 0.567802, 0.567024, 0.566126, 0.565066, 0.563838, 0.562442, 0.560902, 0.559308, 0.557771, 0.556384, 0.555178, 0.554105, 0.553077, 0.552031, 0.550933, 0.549742, 0.548475, 0.547184, 0.545883, 0.544617, 0.543479, 0.542488, 0.541621, 0.540857, 0.540179, 0.539571, 0.538999, 0.538421, 0.537797, 0.537078, 0.536224, 0.535234, 0.534088, 0.532794, 0.531421, 0.530058, 0.528804, 0.527745, 0.526884, 0.526165, 0.525526, 0.524912, 0.524256, 0.523543, 0.522799, 0.522054, 0.521334, 0.52069, 0.520187, 0.519825, 0.519592, 0.519489, 0.519493, 0.519581, 0.519704, 0.519818, 0.519887, 0.519859, 0.5197, 0.519353, 0.518834, 0.518196, 0.517532, 0.516929, 0.516439, 0.516064, 0.515766, 0.515499, 0.515211, 0.51485, 0.51441, 0.513896, 0.513349, 0.512822, 0.512341, 0.511926, 0.511593, 0.51136, 0.511227, 0.51118, 0.511203, 0.511245, 0.511247, 0.511164, 0.510967, 0.510602, 0.51006, 0.509383, 0.508583, 0.507725, 0.506952, 0.506336, 0.505885, 0.505573, 0.505357, 0.505155, 0.504882, 0.504494, 0.504031, 0.503475, 0.502834, 0.502151, 0.501476, 0.500866, 0.500354, 0.49995, 0.499645, 0.499376, 0.499108, 0.498813, 0.498439, 0.497889, 0.497114, 0.496137, 0.495013, 0.493795, 0.49256, 0.491397, 0.490374, 0.489496, 0.488733, 0.488042, 0.487377, 0.486702, 0.485997, 0.485259, 0.484489, 0.483704, 0.482955, 0.482272, 0.481676, 0.48118, 0.480801, 0.480507, 0.48024, 0.479937, 0.479555, 0.479037, 0.478334, 0.477447, 0.476404, 0.475268, 0.474102, 0.472938, 0.471852, 0.470892, 0.470039, 0.469293, 0.468645, 0.467989, 0.467201, 0.466249, 0.465139, 0.463897, 0.462581, 0.461232, 0.459898, 0.458635, 0.457495, 0.456475, 0.455529, 0.454673, 0.453907, 0.453182, 0.45243, 0.451592, 0.4506, 0.449369, 0.447879, 0.446165, 0.444298, 0.44238, 0.440522, 0.438806, 0.437301, 0.435968, 0.434722, 0.433482, 0.432194, 0.43084, 0.429407, 0.427902, 0.426386, 0.424894, 0.423449, 0.422082, 0.420776, 0.419517, 0.418324, 0.417197, 0.416086, 0.414914, 0.413656, 0.412316, 0.410864, 0.409249, 0.407511, 0.405705, 0.403882, 0.402137, 0.400563, 0.399199, 0.398029, 0.397, 0.396027, 0.39502, 0.393907, 0.39265, 0.391283, 0.389902, 0.38857, 0.387319, 0.386162, 0.385108, 0.384151, 0.383287, 0.382487, 0.381692, 0.380858, 0.379961, 0.379001, 0.377929, 0.376719, 0.375391, 0.373949, 0.372428, 0.370891, 0.369418, 0.368078, 0.366899, 0.365834, 0.364813, 0.363768, 0.362642, 0.361418, 0.36012, 0.358815, 0.357582, 0.356468, 0.355478, 0.354601, 0.353851, 0.353241, 0.352758, 0.352348, 0.351953, 0.351545, 0.351101, 0.350558, 0.349884, 0.349058, 0.348079, 0.346953, 0.345753, 0.344571, 0.343479, 0.342494, 0.341601, 0.340768, 0.339924, 0.339009, 0.337979, 0.336823, 0.335565, 0.334263, 0.332971, 0.331759, 0.330694, 0.329781, 0.328997, 0.328313, 0.327703, 0.327165, 0.326669, 0.326136, 0.325487, 0.32469, 0.323723, 0.322595, 0.32137, 0.320152, 0.319049, 0.318116, 0.317323, 0.316634, 0.315993, 0.315343, 0.314632, 0.3138, 0.312788, 0.311609, 0.310353, 0.30912, 0.307976, 0.306961, 0.306091, 0.305351, 0.304711, 0.304148, 0.303615, 0.303048, 0.302413, 0.301669, 0.300774, 0.299699, 0.298457, 0.297097, 0.295697, 0.294331, 0.293059, 0.291918, 0.290922, 0.290059, 0.289281, 0.28849, 0.287633, 0.286709, 0.285735, 0.28473, 0.283692, 0.282635, 0.281619, 0.280719, 0.279963, 0.279353, 0.27889, 0.278492, 0.278094, 0.277672, 0.277166, 0.276498, 0.275618, 0.274532, 0.273282, 0.271945, 0.27063, 0.269419, 0.268346, 0.267412, 0.266581, 0.265788, 0.264959, 0.26403, 0.262956, 0.261719, 0.260343, 0.258884, 0.257425, 0.256036, 0.254764, 0.253609, 0.252575, 0.251676, 0.250907, 0.250236, 0.249613, 0.24896, 0.248181, 0.247215, 0.246052, 0.244721, 0.24326, 0.241745, 0.240255, 0.238884, 0.2377, 0.236689, 0.235796, 0.234943, 0.234049, 0.233037, 0.231916, 0.230706, 0.229441, 0.228174, 0.226975, 0.225887, 0.224898, 0.224024, 0.223285, 0.222668, 0.222136, 0.221635, 0.221117, 0.22057, 0.219972, 0.219299, 0.218528, 0.21766, 0.216729, 0.215793, 0.214926, 0.214181, 0.213576, 0.213089, 0.212657, 0.212179, 0.211585, 0.210836, 0.209962, 0.20904, 0.208152, 0.207361, 0.206715, 0.206258, 0.206011, 0.205962, 0.206055, 0.206222, 0.206416, 0.206596, 0.206709, 0.20671, 0.206605, 0.206405, 0.20611, 0.205724, 0.205289, 0.204852, 0.204482, 0.204241, 0.20414, 0.204127, 0.204102, 0.203967, 0.203664, 0.203186, 0.202572, 0.201907, 0.201268, 0.200707, 0.200255, 0.199915, 0.199706, 0.199614, 0.19964, 0.19977, 0.199954, 0.200149, 0.200323, 0.200452, 0.200532, 0.200566, 0.20054, 0.200462, 0.200367, 0.200291, 0.200276, 0.20035, 0.200497, 0.200659, 0.200747, 0.200692, 0.200473, 0.200124, 0.199718, 0.19933, 0.199021, 0.198838, 0.198799, 0.198898, 0.199089, 0.199329, 0.199579, 0.199797, 0.199946, 0.199992, 0.199903, 0.199646, 0.199224, 0.19867, 0.198028, 0.197348, 0.196679, 0.196063, 0.19552, 0.195074, 0.194678, 0.194242, 0.193689, 0.192975, 0.192107, 0.191153, 0.190199, 0.189326, 0.188592, 0.188027, 0.187635, 0.187403, 0.18731, 0.187322, 0.187386, 0.187427, 0.187401, 0.187287, 0.18705, 0.186637, 0.186055, 0.185356, 0.184624, 0.183938, 0.183358, 0.182896, 0.182501, 0.182143, 0.181763, 0.181295, 0.180675, 0.179863, 0.178876, 0.177766, 0.176634, 0.175577, 0.174662, 0.173932, 0.173405, 0.17306, 0.172819, 0.172592, 0.172301, 0.171886, 0.171308, 0.170544, 0.169591, 0.168473, 0.167229, 0.165916, 0.1646, 0.163346, 0.162201, 0.161174, 0.160222, 0.159302, 0.158337, 0.157249, 0.155997, 0.154584, 0.153051, 0.151469, 0.149915, 0.148458, 0.147142, 0.145975, 0.144948, 0.144038, 0.143225, 0.142421, 0.141578, 0.140679, 0.139702, 0.138631, 0.137456, 0.136179, 0.134841, 0.133512, 0.132281, 0.131229, 0.13038, 0.129688, 0.129075, 0.128467, 0.12778, 0.126955, 0.12598, 0.124881, 0.123709, 0.122526, 0.121427, 0.120474, 0.119689, 0.119058, 0.118537, 0.118051, 0.117536, 0.116957, 0.116284, 0.115477, 0.114526, 0.11344, 0.112237, 0.110942, 0.10961, 0.108324, 0.107151, 0.10614, 0.105302, 0.104596, 0.103942, 0.103252, 0.102479, 0.101621, 0.100692, 0.099734, 0.098795, 0.09793, 0.097185, 0.09657, 0.096077, 0.095696, 0.0954, 0.095151, 0.09491, 0.094636, 0.094283, 0.093812, 0.093212, 0.092491, 0.091669, 0.090775, 0.089868, 0.089019, 0.088291, 0.08771, 0.087241, 0.086821, 0.086398, 0.085892, 0.085228, 0.084397, 0.083465, 0.08252, 0.081662, 0.080979, 0.080492, 0.080179, 0.08002, 0.079981, 0.080024, 0.080107, 0.080117, 0.080001, 0.079748, 0.07936, 0.078857, 0.078286, 0.077707, 0.077192, 0.076777, 0.076491, 0.076346, 0.076307, 0.07629, 0.076179, 0.075837, 0.075221, 0.074355, 0.073313, 0.072185, 0.071038, 0.069929, 0.068949, 0.06812, 0.067417, 0.066805, 0.066222, 0.065618, 0.064969, 0.064271, 0.063474, 0.062519, 0.061386, 0.060091, 0.058679, 0.057219, 0.055787, 0.05446, 0.053282, 0.052238, 0.051283, 0.050349, 0.049344, 0.048134, 0.046701, 0.045123, 0.043477, 0.04188, 0.040437, 0.03923, 0.038295, 0.037573, 0.036989, 0.036505, 0.036078, 0.035654, 0.035168, 0.034574, 0.033881, 0.033095, 0.032173, 0.031134, 0.030036, 0.028953, 0.027943, 0.027058, 0.026279, 0.025579, 0.024909, 0.024197, 0.023353, 0.022294, 0.021031, 0.019613, 0.018118, 0.016713, 0.015515, 0.014559, 0.013839, 0.013317, 0.012948, 0.012645, 0.012309, 0.011848, 0.011227, 0.010435, 0.009529, 0.008556, 0.007552, 0.006577, 0.005671, 0.004844, 0.004079, 0.003402, 0.002819, 0.002243, 0.001573, 0.000728, -0.000326, -0.001593, -0.003035, -0.004593, -0.006133, -0.007537, -0.00874, -0.009737, -0.010532, -0.011176, -0.01175, -0.012325, -0.01296, -0.013704, -0.01457, -0.015537, -0.016601, -0.017727, -0.018863, -0.019942, -0.020903, -0.021678, -0.022237, -0.022603, -0.022824, -0.023003, -0.023246, -0.023618, -0.024132, -0.024748, -0.025397, -0.026017, -0.026518, -0.026829, -0.026912, -0.026759, -0.026402, -0.025929, -0.025433, -0.025001, -0.024689, -0.024524, -0.0245, -0.024585, -0.024715, -0.024884, -0.025086, -0.025277, -0.02541, -0.025432, -0.025332, -0.025178, -0.02501, -0.024897, -0.02492, -0.025157, -0.025622, -0.026235, -0.026837, -0.027331, -0.027663, -0.027807, -0.027772, -0.027592, -0.027321, -0.027017, -0.026717, -0.026488, -0.026356, -0.026296, -0.026294, -0.026342, -0.026442, -0.026575, -0.026678, -0.0267, -0.026605, -0.026377, -0.025994, -0.025508, -0.025006, -0.024613, -0.024417, -0.024438, -0.024625, -0.024855, -0.025036, -0.025071, -0.024897, -0.02452, -0.023975, -0.023317, -0.022603, -0.021931, -0.021374, -0.020965, -0.020713, -0.020609, -0.020645, -0.020828, -0.021118, -0.021488, -0.021858, -0.022168, -0.022376, -0.022472, -0.022495, -0.022542, -0.022735, -0.023147, -0.023811, -0.024672, -0.025634, -0.026572, -0.027331, -0.027886, -0.028191, -0.02827, -0.028181, -0.027987, -0.02777, -0.027625, -0.027557, -0.027624, -0.027846, -0.02821, -0.02868, -0.029222, -0.029723, -0.030125, -0.030399, -0.030541, -0.030558, -0.030489, -0.03039, -0.030377, -0.030559, -0.031023, -0.031772, -0.032708, -0.033683, -0.034578, -0.035319, -0.035865, -0.036229, -0.036431, -0.036515, -0.036572, -0.036665, -0.036863, -0.037207, -0.037682, -0.038286, -0.039027, -0.039884, -0.040766, -0.04166, -0.042507, -0.043221, -0.043809, -0.044312, -0.044795, -0.045347, -0.046039, -0.046935, -0.048105, -0.049525, -0.051092, -0.052676, -0.054138, -0.055364, -0.05631, -0.057017, -0.057586, -0.058094, -0.058603, -0.059148, -0.059806, -0.060627, -0.061601, -0.062673, -0.063794, -0.0649, -0.065962, -0.066911, -0.067679, -0.068309, -0.068849, -0.069338, -0.069819, -0.070392, -0.071211, -0.072345, -0.073715, -0.07524, -0.076824, -0.07836, -0.07968, -0.080715, -0.08153, -0.082187, -0.082757, -0.083304, -0.083864, -0.084476, -0.085189, -0.085991, -0.086876, -0.087832, -0.088823, -0.089793, -0.090684, -0.091463, -0.092097, -0.092539, -0.092848, -0.093111, -0.093407, -0.093841, -0.094481, -0.095334, -0.096386, -0.097564, -0.098748, -0.099813, -0.100708, -0.101406, -0.101886, -0.10222, -0.102528, -0.102898, -0.103369, -0.103952, -0.104741, -0.105734, -0.106832, -0.107993, -0.10918, -0.110355, -0.111483, -0.112525, -0.113444, -0.114256, -0.115021, -0.115804, -0.116669, -0.117698, -0.118899, -0.120211, -0.121547, -0.122837, -0.123961, -0.124807, -0.125401, -0.125789, -0.125999, -0.126059, -0.126049, -0.126053, -0.126143, -0.126307, -0.126579, -0.127012, -0.127535, -0.128105, -0.128701, -0.129301, -0.129855, -0.130299, -0.130633, -0.13094, -0.131327, -0.131902, -0.132738, -0.133868, -0.135186, -0.136644, -0.138144, -0.139521, -0.140717, -0.141709, -0.142448, -0.143016, -0.14344, -0.143815, -0.144249, -0.144793, -0.145416, -0.146148, -0.14698, -0.147911, -0.148942, -0.150009, -0.151041, -0.152, -0.152876, -0.153647, -0.154341, -0.155, -0.155754, -0.156715, -0.157943, -0.159414, -0.161013, -0.162676, -0.164281, -0.165671, -0.166792, -0.167692, -0.16842, -0.169027, -0.169578, -0.170115, -0.170727, -0.171474, -0.17237, -0.173359, -0.174353, -0.17529, -0.176179, -0.177019, -0.177769, -0.178368, -0.178834, -0.179222, -0.179603, -0.180049, -0.180658, -0.181514, -0.182663, -0.184093, -0.185655, -0.187129, -0.18841, -0.189458, -0.190263, -0.190858, -0.191294, -0.191673, -0.192073, -0.192564, -0.193149, -0.193838, -0.194639, -0.195543, -0.196507, -0.197444, -0.19829, -0.199008, -0.199563, -0.199915, -0.200194, -0.200454, -0.200674, -0.200966, -0.201462, -0.202254, -0.203313, -0.204587, -0.205994, -0.207365, -0.208533, -0.209407, -0.209996, -0.210329, -0.210553, -0.210754, -0.210992, -0.211363, -0.211911, -0.212616, -0.213446, -0.214361, -0.215327, -0.216294, -0.217196, -0.218012, -0.218729, -0.219317, -0.219856, -0.220351, -0.220863, -0.22154, -0.222449, -0.223619, -0.224988, -0.226417, -0.227798, -0.229004, -0.229922, -0.230524, -0.23085, -0.230982, -0.231023, -0.231061, -0.231116, -0.231221, -0.231385, -0.231601, -0.231817, -0.231936, -0.231953, -0.231866, -0.231637, -0.231256, -0.230726, -0.230069, -0.22939, -0.228701, -0.228185, -0.227908, -0.227893, -0.22808, -0.228359, -0.228683, -0.228987, -0.229218, -0.229302, -0.229245, -0.22911, -0.228963, -0.228828, -0.228777, -0.228835, -0.228969, -0.229206, -0.229564, -0.230011, -0.230429, -0.230786, -0.231027, -0.231123, -0.231079, -0.230914, -0.230668, -0.23039, -0.230169, -0.230184, -0.230434, -0.230894, -0.231473, -0.232047, -0.232515, -0.232806, -0.232826, -0.232549, -0.232043, -0.2314, -0.230692, -0.229988, -0.229406, -0.228964, -0.228655, -0.228457, -0.228299, -0.228106, -0.227846, -0.227512, -0.227097, -0.226556, -0.225892, -0.22516, -0.224445, -0.223856, -0.223511, -0.223477, -0.223737, -0.224218, -0.224797, -0.225321, -0.225702, -0.225859, -0.22578, -0.225524, -0.225164, -0.224774, -0.22444, -0.224268, -0.224267, -0.224354, -0.224557, -0.224842, -0.225162, -0.225469, -0.225704, -0.225814, -0.225791, -0.225654, -0.225428, -0.225168, -0.224974, -0.224953, -0.225159, -0.22569, -0.226539, -0.227565, -0.22858, -0.229408, -0.229958, -0.230289, -0.230426, -0.230433, -0.230393, -0.23037, -0.230397, -0.230518, -0.230748, -0.231079, -0.23149, -0.231941, -0.232385, -0.232755, -0.233004, -0.233103, -0.233145, -0.233066, -0.232913, -0.232783, -0.232802, -0.233001, -0.233454, -0.234256, -0.235307, -0.236457, -0.237533, -0.238403, -0.239008, -0.239363, -0.23954, -0.239657, -0.239822, -0.240091, -0.240483, -0.241016, -0.241696, -0.24243, -0.243189, -0.243946, -0.244677, -0.245347, -0.245909, -0.246336, -0.246629, -0.246846, -0.247029, -0.247203, -0.247516, -0.248081, -0.24892, -0.250022, -0.251263, -0.252491, -0.253587, -0.2544, -0.254977, -0.255326, -0.255526, -0.255625, -0.255733, -0.255923, -0.256253, -0.256745, -0.257338, -0.257978, -0.258628, -0.25924, -0.259767, -0.26014, -0.260381, -0.260572, -0.260733, -0.260893, -0.261144, -0.261566, -0.262211, -0.26313, -0.264284, -0.265629, -0.267053, -0.268408, -0.269566, -0.270448, -0.271057, -0.271424, -0.27174, -0.272121, -0.272641, -0.273336, -0.274191, -0.275186, -0.276197, -0.277257, -0.278259, -0.279143, -0.279866, -0.280432, -0.280807, -0.281029, -0.28121, -0.281387, -0.281638, -0.282081, -0.2828, -0.283765, -0.284896, -0.286082, -0.287208, -0.288165, -0.288901, -0.289428, -0.289785, -0.29009, -0.29043, -0.290811, -0.291324, -0.292019, -0.29284, -0.293714, -0.294625, -0.295555, -0.296459, -0.297254, -0.297903, -0.298409, -0.298761, -0.298994, -0.299203, -0.299484, -0.299895, -0.300452, -0.301158, -0.30198, -0.302861, -0.303754, -0.304515, -0.305042, -0.305322, -0.3054, -0.305389, -0.305353, -0.305338, -0.305421, -0.305683, -0.306173, -0.306869, -0.307646, -0.308425, -0.309132, -0.309734, -0.310225, -0.310588, -0.310842, -0.311079, -0.311373, -0.311731, -0.312182, -0.312853, -0.313786, -0.314935, -0.316186, -0.317426, -0.318518, -0.319363, -0.319958, -0.320348, -0.320606, -0.320827, -0.321062, -0.321334, -0.321728, -0.322277, -0.322934, -0.323598, -0.324284, -0.324988, -0.325634, -0.326205, -0.326699, -0.327113, -0.327441, -0.327767, -0.328122, -0.328623, -0.329354, -0.330383, -0.331706, -0.333215, -0.334755, -0.336155, -0.337291, -0.33812, -0.338663, -0.339002, -0.339243, -0.33953, -0.339936, -0.340478, -0.341174, -0.342002, -0.342919, -0.343875, -0.344859, -0.345789, -0.346603, -0.347323, -0.347916, -0.348363, -0.348696, -0.349016, -0.34941, -0.349957, -0.350757, -0.351858, -0.353221, -0.354705, -0.356127, -0.357296, -0.358153, -0.358637, -0.358822, -0.35888, -0.358912, -0.359029, -0.359289, -0.359682, -0.360228, -0.360899, -0.361645, -0.362403, -0.363094, -0.363628, -0.363973, -0.364128, -0.364114, -0.364019, -0.363916, -0.363832, -0.363906, -0.3642, -0.364731, -0.365519, -0.366554, -0.367758, -0.368942, -0.36991, -0.37054, -0.370887, -0.371057, -0.371209, -0.371425, -0.371742, -0.372198, -0.372768, -0.373413, -0.37406, -0.374653, -0.375158, -0.37554, -0.375772, -0.375823, -0.375673, -0.375367, -0.37497, -0.374514, -0.37406, -0.373745, -0.373661, -0.373832, -0.374238, -0.374771, -0.375271, -0.375596, -0.375628, -0.375333, -0.374783, -0.374105, -0.373434, -0.372872, -0.372472, -0.37224, -0.372122, -0.37205, -0.371964, -0.371811, -0.371541, -0.371126, -0.370566, -0.369862, -0.369037, -0.368135, -0.367229, -0.366398, -0.365688, -0.365135, -0.364773, -0.364561, -0.36442, -0.364263, -0.364005, -0.363533, -0.362816, -0.361917, -0.360953, -0.360025, -0.359223, -0.358619, -0.358238, -0.358022, -0.357894, -0.357786, -0.357634, -0.3574, -0.35706, -0.356607, -0.356044, -0.35539, -0.35473, -0.354123, -0.353607, -0.353214, -0.353033, -0.353091, -0.353318, -0.353656, -0.354037, -0.354321, -0.35436, -0.354162, -0.353744, -0.353178, -0.352588, -0.352087, -0.351768, -0.351677, -0.351766, -0.351988, -0.352294, -0.352603, -0.352838, -0.352905, -0.352729, -0.35236, -0.351842, -0.351221, -0.350581, -0.349987, -0.349531, -0.349293, -0.349415, -0.349862, -0.350525, -0.351276, -0.351947, -0.352416, -0.352634, -0.352586, -0.352358, -0.352069, -0.351775, -0.351576, -0.351556, -0.351737, -0.35206, -0.35246, -0.352833, -0.353132, -0.353343, -0.353453, -0.353458, -0.353347, -0.353089, -0.352797, -0.352533, -0.352388, -0.352469, -0.352814, -0.353419, -0.354241, -0.355172, -0.35606, -0.356776, -0.357263, -0.357495, -0.357543, -0.357525, -0.357556, -0.357712, -0.35805, -0.3586, -0.359308, -0.360054, -0.360757, -0.361405, -0.361945, -0.362344, -0.362594, -0.362701, -0.362685, -0.3626, -0.362527, -0.362573, -0.362835, -0.363382, -0.364221, -0.365318, -0.366604, -0.367915, -0.369075, -0.369934, -0.370426, -0.370584, -0.370542, -0.370434, -0.370363, -0.370426, -0.37067, -0.371095, -0.371646, -0.372217, -0.372738, -0.373167, -0.373499, -0.37371, -0.373806, -0.373742, -0.373685, -0.373687, -0.373744, -0.373904, -0.374257, -0.374858, -0.375673, -0.376614, -0.377657, -0.378759, -0.379692, -0.380339, -0.380692, -0.380766, -0.380708, -0.380674, -0.380777, -0.381038, -0.38143, -0.381926, -0.382461, -0.38296, -0.383344, -0.383626, -0.383789, -0.383784, -0.383567, -0.383196, -0.382808, -0.382431, -0.382144, -0.381973, -0.381996, -0.382251, -0.382753, -0.383454, -0.384227, -0.384999, -0.385678, -0.386129, -0.386305, -0.386312, -0.38638, -0.386559, -0.386881, -0.387344, -0.387905, -0.388512, -0.389094, -0.389611, -0.390077, -0.390426, -0.390593, -0.390604, -0.390521, -0.390442, -0.390462, -0.39061, -0.390973, -0.391587, -0.392462, -0.39357, -0.394842, -0.39611, -0.397263, -0.398224, -0.398919, -0.399378, -0.399642, -0.39984, -0.400069, -0.400433, -0.400949, -0.401619, -0.402424, -0.4033, -0.404071, -0.404664, -0.405043, -0.405164, -0.405114, -0.404944, -0.404702, -0.404425, -0.40418, -0.404114, -0.404221, -0.404633, -0.405292, -0.406121, -0.407039, -0.407956, -0.408755, -0.409345, -0.409695, -0.409864, -0.409954, -0.410058, -0.410318, -0.410811, -0.411554, -0.412469, -0.413518, -0.414597, -0.41557, -0.416364, -0.416966, -0.417377, -0.417528, -0.417476, -0.417334, -0.417212, -0.417185, -0.417341, -0.417716, -0.418335, -0.419174, -0.420115, -0.42101, -0.421733, -0.422202, -0.422444, -0.422502, -0.422453, -0.422455, -0.422566, -0.422905, -0.423497, -0.424361, -0.425449, -0.426591, -0.42772, -0.428809, -0.429777, -0.430597, -0.431243, -0.431725, -0.432107, -0.432497, -0.432972, -0.433615, -0.434473, -0.435545, -0.436876, -0.438401, -0.43995, -0.441407, -0.442619, -0.443511, -0.444179, -0.444632, -0.444954, -0.445344, -0.445929, -0.446731, -0.447683, -0.44873, -0.44977, -0.450733, -0.45155, -0.45214, -0.452502, -0.45263, -0.452541, -0.452348, -0.452118, -0.451968, -0.451975, -0.45221, -0.452676, -0.45344, -0.454446, -0.455569, -0.456704, -0.457757, -0.458608, -0.459242, -0.459682, -0.460009, -0.460378, -0.460881, -0.46154, -0.462362, -0.463326, -0.464366, -0.465406, -0.466345, -0.467149, -0.467751, -0.468166, -0.468355, -0.468424, -0.468387, -0.468279, -0.468262, -0.468304, -0.46848, -0.46885, -0.469328, -0.469874, -0.470411, -0.470867, -0.471151, -0.471172, -0.471015, -0.470717, -0.47044, -0.470301, -0.470372, -0.470595, -0.470982, -0.471425, -0.471897, -0.472309, -0.472571, -0.472623, -0.472415, -0.472003, -0.471465, -0.470858, -0.470293, -0.469771, -0.469367, -0.469125, -0.469029, -0.469118, -0.469343, -0.469547, -0.469683, -0.469669, -0.469469, -0.469002, -0.468375, -0.467605, -0.466881, -0.466359, -0.466073, -0.465948, -0.465866, -0.465747, -0.465525, -0.465147, -0.464604, -0.463873, -0.462948, -0.461923, -0.460871, -0.45986, -0.458968, -0.458231, -0.457669, -0.457318, -0.457191, -0.45721, -0.457298, -0.457357, -0.457282, -0.456994, -0.456476, -0.455774, -0.455027, -0.454375, -0.453927, -0.45378, -0.4539, -0.454152, -0.454404, -0.454557, -0.454614, -0.454519, -0.454252, -0.453819, -0.453232, -0.452618, -0.451964, -0.451396, -0.450946, -0.45069, -0.450677, -0.450907, -0.451323, -0.451857, -0.452402, -0.452818, -0.453012, -0.452983, -0.452811, -0.452466, -0.45211, -0.45184, -0.45182, -0.452083, -0.452575, -0.453161, -0.453711, -0.454086, -0.454275, -0.454195, -0.453811, -0.453192, -0.452424, -0.451621, -0.450887, -0.450351, -0.45008, -0.450102, -0.450422, -0.450972, -0.45164, -0.452298, -0.452857, -0.453157, -0.453197, -0.453032, -0.452743, -0.452446, -0.452268, -0.452329, -0.452646, -0.453184, -0.453931, -0.454742, -0.455438, -0.455961, -0.456348, -0.45656, -0.456634, -0.456647, -0.456655, -0.456741, -0.456929, -0.457137, -0.457579, -0.458231, -0.459095, -0.460153, -0.461287, -0.462352, -0.463298, -0.463902, -0.464175, -0.464233, -0.464212, -0.464265, -0.464504, -0.464965, -0.46562, -0.466428, -0.467317, -0.46822, -0.469041, -0.469693, -0.470108, -0.470286, -0.470315, -0.470288, -0.470266, -0.470298, -0.47046, -0.470849, -0.471503, -0.472419, -0.473556, -0.474853, -0.476163, -0.477341, -0.478352, -0.479059, -0.479503, -0.479833, -0.480174, -0.480665, -0.481382, -0.482305, -0.483391, -0.484522, -0.485622, -0.486604, -0.487377, -0.487945, -0.488264, -0.488381, -0.48839, -0.488361, -0.488316, -0.488446, -0.488732, -0.48918, -0.489843, -0.490709, -0.491723, -0.492816, -0.493858, -0.494681, -0.495313, -0.495699, -0.495909, -0.496104, -0.496484, -0.49709, -0.497906, -0.498904, -0.499963, -0.501023, -0.501941, -0.502589, -0.503075, -0.503352, -0.503395, -0.503288, -0.503131, -0.503004, -0.502949, -0.502973, -0.503188, -0.503631, -0.504263, -0.505009, -0.505848, -0.506691, -0.507395, -0.507878, -0.508158, -0.508328, -0.508507, -0.508784, -0.509335, -0.510181, -0.511269, -0.512456, -0.513655, -0.514761, -0.515702, -0.516415, -0.516891, -0.517218, -0.517403, -0.517485, -0.517525, -0.517582, -0.517706, -0.517973, -0.518436, -0.519053, -0.51974, -0.520463, -0.521191, -0.521874, -0.522405, -0.522754, -0.522942, -0.523176, -0.523545, -0.524069, -0.524876, -0.526032, -0.527455, -0.529023, -0.530555, -0.531899, -0.532979, -0.53376, -0.534304, -0.534695, -0.535121, -0.53564, -0.536288, -0.537105, -0.538099, -0.539295, -0.540706, -0.542305, -0.544027, -0.545726, -0.547343, -0.548826, -0.550107, -0.551212, -0.552216, -0.553158, -0.554124, -0.55523, -0.5565, -0.557891, -0.559377, -0.560905, -0.562288, -0.563396, -0.56416, -0.564583, -0.56476, -0.564808, -0.564849, -0.564937, -0.565114, -0.565442, -0.566024, -0.566874, -0.567939, -0.569128, -0.570319, -0.57141, -0.572319, -0.572978, -0.573354, -0.573531, -0.573623, -0.573847, -0.574313, -0.575076, -0.576062, -0.577231, -0.578517, -0.579796, -0.580854, -0.581585, -0.582065, -0.582345, -0.582586, -0.582843, -0.583175, -0.583653, -0.5843, -0.585145, -0.586182, -0.587395, -0.588758, -0.590175, -0.591602, -0.592923, -0.594046, -0.594902, -0.595502, -0.595957, -0.596468, -0.597114, -0.59799, -0.599113, -0.60044, -0.601849, -0.603197, -0.604406, -0.60544, -0.606232, -0.606792, -0.607171, -0.607429, -0.607676, -0.607927, -0.608308, -0.608865, -0.609586, -0.610413, -0.611367, -0.612394, -0.613354, -0.614219, -0.614838, -0.615132, -0.615113, -0.614859, -0.61456, -0.614407, -0.61449, -0.614824, -0.615383, -0.616093, -0.61682, -0.617375, -0.617671, -0.617769, -0.617632, -0.617303, -0.616834, -0.61626, -0.61574, -0.615344, -0.615058, -0.6149, -0.614906, -0.61507, -0.615378, -0.615773, -0.616124, -0.6163, -0.616233, -0.615941, -0.615464, -0.614956, -0.614575, -0.614415, -0.614536, -0.614801, -0.615127, -0.615392, -0.615544, -0.615456, -0.615103, -0.614447, -0.613536, -0.612509, -0.611458, -0.610465, -0.609613, -0.608896, -0.608333, -0.607994, -0.607833, -0.607765, -0.607752, -0.607678, -0.607473, -0.607107, -0.606492, -0.605696, -0.604837, -0.60404, -0.603401, -0.60315, -0.603252, -0.603647, -0.60414, -0.604576, -0.604837, -0.604849, -0.604656, -0.604209, -0.603642, -0.603022, -0.602371, -0.601762, -0.601252, -0.600955, -0.600889, -0.60106, -0.60139, -0.601837, -0.602253, -0.602552, -0.602666, -0.602577, -0.602222, -0.601756, -0.601347, -0.600991, -0.60089, -0.60113, -0.601703, -0.602445, -0.603083, -0.603499, -0.603652, -0.60353, -0.603067, -0.602405, -0.601561, -0.600649, -0.599794, -0.599095, -0.598644, -0.598494, -0.598609, -0.598849, -0.599217, -0.599661, -0.600131, -0.600514, -0.600724, -0.600739, -0.600569, -0.600392, -0.600374, -0.600592, -0.601141, -0.602067, -0.603275, -0.604569, -0.605783, -0.606745, -0.607391, -0.60772, -0.607771, -0.607655, -0.607462, -0.607313, -0.607221, -0.607303, -0.607604, -0.60806, -0.608723, -0.609474, -0.610217, -0.610865, -0.611353, -0.611696, -0.611937, -0.612022, -0.612021, -0.612055, -0.612224, -0.612641, -0.613355, -0.614384, -0.615552, -0.616706, -0.617741, -0.618575, -0.619158, -0.619512, -0.619722, -0.619868, -0.620004, -0.620236, -0.62054, -0.620978, -0.621643, -0.622469, -0.623486, -0.62458, -0.625642, -0.626568, -0.627302, -0.627833, -0.628082, -0.628252, -0.628408, -0.62873, -0.629315, -0.630293, -0.631549, -0.632994, -0.634452, -0.635795, -0.636902, -0.637707, -0.638262, -0.638601, -0.638765, -0.639, -0.639332, -0.639805, -0.640405, -0.641146, -0.642022, -0.643012, -0.644062, -0.645074, -0.645954, -0.646628, -0.647089, -0.647354, -0.647493, -0.647623, -0.647739, -0.648003, -0.648565, -0.649323, -0.650265, -0.651242, -0.652128, -0.652883, -0.653455, -0.653806, -0.653936, -0.654, -0.654038, -0.654123, -0.654315, -0.654658, -0.655228, -0.655963, -0.656824, -0.657759, -0.658683, -0.659547, -0.660277, -0.660783, -0.661094, -0.66114, -0.661124, 0.338817, 0.338585, 0.338108, 0.33741, 0.336543, 0.335587, 0.334679, 0.333957, 0.333494, 0.333291, 0.333308, 0.3335, 0.333773, 0.334, 0.334089, 0.334076, 0.333944, 0.333646, 0.333133, 0.332545, 0.331882, 0.331191, 0.330541, 0.32999, 0.329517, 0.32912, 0.328724, 0.328274, 0.327696, 0.326865, 0.325729, 0.324299, 0.322726, 0.321182, 0.319757, 0.318628, 0.317788, 0.317217, 0.316819, 0.316468, 0.316078, 0.315603, 0.314995, 0.314222, 0.31334, 0.312376, 0.311352, 0.310262, 0.309146, 0.308089, 0.307134, 0.306373, 0.305827, 0.305424, 0.30505, 0.304514, 0.303705, 0.302493, 0.300894, 0.299007, 0.29701, 0.295186, 0.293602, 0.292331, 0.291409, 0.290764, 0.290303, 0.289924, 0.289569, 0.289175, 0.288673, 0.28798, 0.287118, 0.286114, 0.285061, 0.284037, 0.283102, 0.282219, 0.28147, 0.280885, 0.280394, 0.279897, 0.279325, 0.27852, 0.277337, 0.275794, 0.273965, 0.271917, 0.269862, 0.268018, 0.266501, 0.265372, 0.264554, 0.263959, 0.263409, 0.262842, 0.262194, 0.261421, 0.260437, 0.259258, 0.25803, 0.256777, 0.255536, 0.254354, 0.253332, 0.25251, 0.251858, 0.251324, 0.250831, 0.250306, 0.249663, 0.24878, 0.247564, 0.246018, 0.244259, 0.242426, 0.240648, 0.239043, 0.23771, 0.236714, 0.23597, 0.235272, 0.234486, 0.23362, 0.232622, 0.231502, 0.23022, 0.228856, 0.227397, 0.225887, 0.22439, 0.222952, 0.221632, 0.220493, 0.219557, 0.218724, 0.217967, 0.217208, 0.216292, 0.215146, 0.213795, 0.212291, 0.210709, 0.209172, 0.207809, 0.206689, 0.205928, 0.205496, 0.205288, 0.205138, 0.204917, 0.204612, 0.204132, 0.203497, 0.202748, 0.201958, 0.201199, 0.200487, 0.199918, 0.199566, 0.199478, 0.199635, 0.199984, 0.200375, 0.200666, 0.200774, 0.200624, 0.200146, 0.199401, 0.198544, 0.1977, 0.197014, 0.196498, 0.196216, 0.196114, 0.196196, 0.19631, 0.196318, 0.196176, 0.19584, 0.195272, 0.194523, 0.193606, 0.19264, 0.191674, 0.190726, 0.189909, 0.189302, 0.188897, 0.188764, 0.188743, 0.188758, 0.188676, 0.188407, 0.187809, 0.1869, 0.185794, 0.184713, 0.183791, 0.183093, 0.182668, 0.182514, 0.182589, 0.182819, 0.183082, 0.183238, 0.183269, 0.183135, 0.182894, 0.182546, 0.182114, 0.181646, 0.181184, 0.180794, 0.180573, 0.180499, 0.180545, 0.180706, 0.18091, 0.180994, 0.180835, 0.180332, 0.179495, 0.178436, 0.177321, 0.176358, 0.175652, 0.175227, 0.175053, 0.175093, 0.175255, 0.175432, 0.175478, 0.175339, 0.175031, 0.174523, 0.17388, 0.173168, 0.172444, 0.171743, 0.171122, 0.17062, 0.170303, 0.170181, 0.170148, 0.170149, 0.170042, 0.169662, 0.168951, 0.167873, 0.166471, 0.164904, 0.163377, 0.162062, 0.161073, 0.160369, 0.15983, 0.159481, 0.15918, 0.158843, 0.158384, 0.157729, 0.156882, 0.155896, 0.154771, 0.153582, 0.15244, 0.151366, 0.150399, 0.149554, 0.148833, 0.148223, 0.14759, 0.146857, 0.146001, 0.144884, 0.143409, 0.141587, 0.139449, 0.137182, 0.135007, 0.133124, 0.131586, 0.13036, 0.12932, 0.128395, 0.127569, 0.12668, 0.125672, 0.124508, 0.123204, 0.121791, 0.120306, 0.118821, 0.117375, 0.116022, 0.114794, 0.113742, 0.112856, 0.11205, 0.111313, 0.110512, 0.109529, 0.108276, 0.10674, 0.1049, 0.102895, 0.100916, 0.099132, 0.097724, 0.096644, 0.095835, 0.095145, 0.094469, 0.093751, 0.092805, 0.091744, 0.09056, 0.089312, 0.088089, 0.086845, 0.085656, 0.084578, 0.083615, 0.082778, 0.082072, 0.081463, 0.080925, 0.080319, 0.079509, 0.078413, 0.077021, 0.075384, 0.073605, 0.071803, 0.070128, 0.068745, 0.067641, 0.066753, 0.066, 0.065312, 0.064507, 0.06356, 0.062429, 0.061138, 0.059754, 0.058307, 0.05691, 0.055648, 0.054432, 0.053391, 0.052568, 0.051867, 0.051254, 0.050727, 0.050191, 0.049479, 0.048534, 0.047313, 0.045847, 0.044219, 0.042572, 0.041025, 0.039608, 0.038464, 0.037597, 0.036941, 0.036403, 0.035858, 0.035262, 0.034464, 0.033474, 0.032332, 0.031066, 0.029715, 0.028348, 0.027079, 0.025859, 0.024771, 0.023841, 0.023027, 0.0222, 0.021399, 0.020463, 0.019223, 0.017679, 0.01586, 0.013819, 0.011676, 0.009619, 0.007791, 0.006208, 0.004899, 0.003818, 0.00283, 0.001832, 0.000736, -0.00052, -0.001959, -0.003539, -0.005208, -0.006922, -0.008607, -0.010216, -0.011661, -0.012933, -0.01405, -0.015004, -0.015806, -0.016547, -0.017289, -0.018124, -0.019134, -0.020366, -0.021876, -0.023472, -0.025002, -0.026291, -0.027275, -0.028032, -0.028576, -0.029017, -0.029438, -0.029925, -0.030536, -0.031302, -0.032255, -0.033343, -0.03454, -0.035777, -0.036981, -0.03816, -0.039229, -0.040123, -0.04086, -0.041471, -0.042023, -0.042599, -0.04328, -0.044212, -0.045534, -0.04727, -0.049265, -0.051366, -0.0534, -0.05512, -0.056415, -0.057355, -0.058114, -0.058816, -0.059543, -0.060398, -0.06145, -0.062653, -0.063969, -0.065371, -0.06689, -0.068447, -0.069973, -0.071423, -0.072772, -0.074025, -0.075253, -0.076454, -0.077642, -0.078894, -0.08027, -0.081849, -0.08375, -0.085885, -0.088167, -0.090421, -0.092426, -0.094065, -0.095312, -0.096252, -0.097059, -0.097887, -0.098805, -0.099825, -0.101005, -0.102325, -0.10377, -0.105253, -0.106703, -0.108064, -0.109293, -0.110392, -0.111338, -0.112162, -0.112877, -0.113519, -0.114218, -0.115133, -0.116318, -0.11782, -0.119668, -0.121815, -0.124026, -0.1261, -0.12785, -0.129221, -0.13032, -0.131229, -0.132102, -0.13303, -0.133947, -0.134926, -0.136048, -0.137331, -0.138634, -0.139876, -0.141012, -0.142, -0.142822, -0.143473, -0.14394, -0.144216, -0.144377, -0.144564, -0.144929, -0.145516, -0.146287, -0.147245, -0.148321, -0.149451, -0.150549, -0.151459, -0.152053, -0.152329, -0.152367, -0.152298, -0.152304, -0.152493, -0.152866, -0.153426, -0.154131, -0.154883, -0.155591, -0.156211, -0.156728, -0.157098, -0.15733, -0.157424, -0.157416, -0.157377, -0.157337, -0.157421, -0.157734, -0.1583, -0.159068, -0.15998, -0.160938, -0.161819, -0.162453, -0.162776, -0.162857, -0.162719, -0.162471, -0.162174, -0.161996, -0.16199, -0.162156, -0.16248, -0.162882, -0.163262, -0.163555, -0.163723, -0.163713, -0.163512, -0.163126, -0.162572, -0.161951, -0.161355, -0.160925, -0.160739, -0.160824, -0.161188, -0.161814, -0.162607, -0.163363, -0.16396, -0.164304, -0.164351, -0.164138, -0.163751, -0.163288, -0.162906, -0.162727, -0.162746, -0.162892, -0.163132, -0.163408, -0.163639, -0.163856, -0.163993, -0.164001, -0.163853, -0.163545, -0.163115, -0.162611, -0.162173, -0.161902, -0.161899, -0.162206, -0.162843, -0.163711, -0.164689, -0.16564, -0.166398, -0.166887, -0.16712, -0.167184, -0.167226, -0.167352, -0.167646, -0.16815, -0.168869, -0.169698, -0.170593, -0.171555, -0.172452, -0.17323, -0.173865, -0.174348, -0.174711, -0.174961, -0.175178, -0.175478, -0.175935, -0.176599, -0.177546, -0.178791, -0.180395, -0.182119, -0.183751, -0.185171, -0.1863, -0.187131, -0.187715, -0.188223, -0.188756, -0.189371, -0.190086, -0.190949, -0.191933, -0.192978, -0.194058, -0.195158, -0.196161, -0.197024, -0.197703, -0.198223, -0.198649, -0.199032, -0.199481, -0.200036, -0.200752, -0.201681, -0.202828, -0.204218, -0.205838, -0.20753, -0.209062, -0.210252, -0.21108, -0.211662, -0.212155, -0.212643, -0.2132, -0.213886, -0.214736, -0.215722, -0.216744, -0.217789, -0.218842, -0.219891, -0.220838, -0.221599, -0.222172, -0.222586, -0.222909, -0.223255, -0.223718, -0.224438, -0.225429, -0.226698, -0.228277, -0.230114, -0.232095, -0.234095, -0.235938, -0.237505, -0.238764, -0.239777, -0.240684, -0.241644, -0.242752, -0.24406, -0.245555, -0.247135, -0.248739, -0.250252, -0.251588, -0.252672, -0.253506, -0.254088, -0.254446, -0.254655, -0.254809, -0.255034, -0.255391, -0.255908, -0.256638, -0.257625, -0.258833, -0.260155, -0.261465, -0.262731, -0.263833, -0.264614, -0.265167, -0.265641, -0.266158, -0.266806, -0.267625, -0.26862, -0.269758, -0.271023, -0.272245, -0.273349, -0.274325, -0.275192, -0.275954, -0.276611, -0.277205, -0.277744, -0.27826, -0.278847, -0.279572, -0.280459, -0.28155, -0.282827, -0.284206, -0.285592, -0.28691, -0.288001, -0.288795, -0.289356, -0.289784, -0.290214, -0.290806, -0.291645, -0.292758, -0.294091, -0.29559, -0.297125, -0.298604, -0.299962, -0.301109, -0.30202, -0.302752, -0.303392, -0.30397, -0.30453, -0.305205, -0.306069, -0.307147, -0.308466, -0.309973, -0.311569, -0.313229, -0.314821, -0.316175, -0.317323, -0.318233, -0.318919, -0.319478, -0.320078, -0.320877, -0.321925, -0.323157, -0.324496, -0.325838, -0.327112, -0.328286, -0.329282, -0.330058, -0.330609, -0.330968, -0.331201, -0.331436, -0.331782, -0.33224, -0.332968, -0.33399, -0.335268, -0.336755, -0.338335, -0.33981, -0.341083, -0.342085, -0.342812, -0.343333, -0.34377, -0.344277, -0.344937, -0.345811, -0.346964, -0.3483, -0.349718, -0.351215, -0.352666, -0.354036, -0.355276, -0.356342, -0.357226, -0.357962, -0.358599, -0.359254, -0.360024, -0.360992, -0.362179, -0.363636, -0.365282, -0.36712, -0.369045, -0.370804, -0.372212, -0.373278, -0.374045, -0.374628, -0.375168, -0.375775, -0.37658, -0.377649, -0.378911, -0.380253, -0.381609, -0.382934, -0.384167, -0.385235, -0.386156, -0.386927, -0.387595, -0.388199, -0.388769, -0.389394, -0.390199, -0.391215, -0.392512, -0.394077, -0.39578, -0.397614, -0.399463, -0.401147, -0.402571, -0.403662, -0.404556, -0.405414, -0.406353, -0.407479, -0.408878, -0.410467, -0.412139, -0.413811, -0.415407, -0.416828, -0.418013, -0.419016, -0.41981, -0.420363, -0.420738, -0.42103, -0.421325, -0.42172, -0.422294, -0.423071, -0.424022, -0.425129, -0.426351, -0.427594, -0.428728, -0.429673, -0.430332, -0.430767, -0.43109, -0.43144, -0.431902, -0.432529, -0.433315, -0.434258, -0.435266, -0.436184, -0.436931, -0.437492, -0.437821, -0.437989, -0.43806, -0.438026, -0.437951, -0.437902, -0.437909, -0.438096, -0.43852, -0.439194, -0.440063, -0.441033, -0.442062, -0.442981, -0.44377, -0.44438, -0.44475, -0.444937, -0.44508, -0.445356, -0.445826, -0.446466, -0.447246, -0.448062, -0.448747, -0.449323, -0.449728, -0.449868, -0.449781, -0.449538, -0.449185, -0.448772, -0.448403, -0.448161, -0.448067, -0.448194, -0.448612, -0.449227, -0.449947, -0.450717, -0.451469, -0.452101, -0.452516, -0.452714, -0.452769, -0.452734, -0.452792, -0.453009, -0.453439, -0.454051, -0.454839, -0.455626, -0.456292, -0.456804, -0.457136, -0.457279, -0.457273, -0.457143, -0.456931, -0.456718, -0.456597, -0.456612, -0.4568, -0.457147, -0.457712, -0.458462, -0.459322, -0.460135, -0.46078, -0.461245, -0.461491, -0.461579, -0.461635, -0.461766, -0.462055, -0.46254, -0.463315, -0.46428, -0.465338, -0.466393, -0.46728, -0.467959, -0.46848, -0.468781, -0.468961, -0.469082, -0.469201, -0.469446, -0.469848, -0.470478, -0.471409, -0.472632, -0.474095, -0.475709, -0.477329, -0.478799, -0.480021, -0.480986, -0.481685, -0.482262, -0.482856, -0.483503, -0.484302, -0.485365, -0.486613, -0.487984, -0.489419, -0.490783, -0.491993, -0.492992, -0.493745, -0.494285, -0.494678, -0.495025, -0.495358, -0.495836, -0.49651, -0.497413, -0.498549, -0.499912, -0.501435, -0.503033, -0.504535, -0.505923, -0.507136, -0.508155, -0.509054, -0.510026, -0.511112, -0.512328, -0.513729, -0.515322, -0.516978, -0.51862, -0.520212, -0.521696, -0.522999, -0.524071, -0.524951, -0.525697, -0.526309, -0.526927, -0.527591, -0.528302, -0.529143, -0.530182, -0.53143, -0.532882, -0.534505, -0.53618, -0.537797, -0.539194, -0.54031, -0.541169, -0.541924, -0.54277, -0.543856, -0.545269, -0.546932, -0.548762, -0.550643, -0.55247, -0.554167, -0.555704, -0.55707, -0.558314, -0.559388, -0.560333, -0.561201, -0.562092, -0.563064, -0.564118, -0.56529, -0.566647, -0.568187, -0.56983, -0.571519, -0.573121, -0.574494, -0.575614, -0.576487, -0.577155, -0.577862, -0.578761, -0.579919, -0.581251, -0.582668, -0.584124, -0.585514, -0.586736, -0.587753, -0.588583, -0.589212, -0.58962, -0.58987, -0.590063, -0.590317, -0.590666, -0.59115, -0.591869, 0.407164, 0.405984, 0.404678, 0.403352, 0.402074, 0.400911, 0.399946, 0.399227, 0.398689, 0.398131, 0.397457, 0.39651, 0.395283, 0.393852, 0.392343, 0.39089, 0.389617, 0.388554, 0.387764, 0.387252, 0.386974, 0.386842, 0.386787, 0.38674, 0.386618, 0.386329, 0.38587, 0.385198, 0.384368, 0.383434, 0.382451, 0.381539, 0.380711, 0.380043, 0.37951, 0.379075, 0.37863, 0.378091, 0.37733, 0.376306, 0.375022, 0.37359, 0.372156, 0.370884, 0.369923, 0.369211, 0.368678, 0.368304, 0.368065, 0.367918, 0.367775, 0.367599, 0.367335, 0.366862, 0.366145, 0.365213, 0.364091, 0.362836, 0.361559, 0.36033, 0.359196, 0.358194, 0.357306, 0.35654, 0.35578, 0.354878, 0.35377, 0.352389, 0.350759, 0.349016, 0.347287, 0.345701, 0.344333, 0.343197, 0.342277, 0.341542, 0.340927, 0.340348, 0.339709, 0.338933, 0.337922, 0.336677, 0.335223, 0.33362, 0.331959, 0.330299, 0.328722, 0.327345, 0.326213, 0.325292, 0.324496, 0.323709, 0.322834, 0.321812, 0.320614, 0.319169, 0.317496, 0.315717, 0.313981, 0.312407, 0.311023, 0.309861, 0.308933, 0.308166, 0.307438, 0.306654, 0.305752, 0.304728, 0.303547, 0.302179, 0.300591, 0.298831, 0.297013, 0.295257, 0.293648, 0.29223, 0.291023, 0.289972, 0.28897, 0.287903, 0.286699, 0.285296, 0.283685, 0.281926, 0.280135, 0.278432, 0.276901, 0.275646, 0.274676, 0.273922, 0.273313, 0.272773, 0.27224, 0.271652, 0.270942, 0.27009, 0.269107, 0.26799, 0.2667, 0.265262, 0.263777, 0.262376, 0.261172, 0.260144, 0.259277, 0.258525, 0.257785, 0.256935, 0.255886, 0.254607, 0.253166, 0.251709, 0.250355, 0.249162, 0.248182, 0.247423, 0.246895, 0.24651, 0.246231, 0.245974, 0.245665, 0.24525, 0.244667, 0.243928, 0.24308, 0.242154, 0.241161, 0.240125, 0.239162, 0.238353, 0.237742, 0.237349, 0.237131, 0.237002, 0.236825, 0.236536, 0.236041, 0.23537, 0.234628, 0.23393, 0.233393, 0.233089, 0.233026, 0.233162, 0.233426, 0.233792, 0.234216, 0.234624, 0.234961, 0.235149, 0.235197, 0.23512, 0.234891, 0.234591, 0.234288, 0.234, 0.233803, 0.233746, 0.233806, 0.233948, 0.2341, 0.23418, 0.2341, 0.233819, 0.233289, 0.23258, 0.231814, 0.231111, 0.230556, 0.230251, 0.230178, 0.230311, 0.23059, 0.230935, 0.231219, 0.231396, 0.231479, 0.231384, 0.23106, 0.230604, 0.230023, 0.229356, 0.228706, 0.228163, 0.227785, 0.227601, 0.227603, 0.227676, 0.227733, 0.227631, 0.227244, 0.226581, 0.225682, 0.224675, 0.223727, 0.222912, 0.222309, 0.221943, 0.221747, 0.221643, 0.221571, 0.221504, 0.221387, 0.221167, 0.22079, 0.220232, 0.219501, 0.218629, 0.217672, 0.216729, 0.215868, 0.215163, 0.214654, 0.214297, 0.214035, 0.213739, 0.213315, 0.212689, 0.211819, 0.210674, 0.209331, 0.207986, 0.206709, 0.205622, 0.204827, 0.204302, 0.20392, 0.203617, 0.203336, 0.203056, 0.202693, 0.202104, 0.201242, 0.200135, 0.198894, 0.197601, 0.196269, 0.194998, 0.193905, 0.192976, 0.192222, 0.191593, 0.191006, 0.190385, 0.189672, 0.188732, 0.187547, 0.186173, 0.184685, 0.183203, 0.181878, 0.180776, 0.179897, 0.179198, 0.178599, 0.178027, 0.177506, 0.176945, 0.176224, 0.175336, 0.174279, 0.173101, 0.171853, 0.170583, 0.169327, 0.168204, 0.167221, 0.1664, 0.165698, 0.16503, 0.164364, 0.163608, 0.162718, 0.161685, 0.160461, 0.159134, 0.157813, 0.156661, 0.155716, 0.154964, 0.154403, 0.153946, 0.153558, 0.15322, 0.152788, 0.152164, 0.151314, 0.150295, 0.149161, 0.147913, 0.146572, 0.145218, 0.143956, 0.142846, 0.141951, 0.141244, 0.140611, 0.139962, 0.13918, 0.138248, 0.137119, 0.135837, 0.134408, 0.133013, 0.131767, 0.130737, 0.129908, 0.129206, 0.128605, 0.128032, 0.12743, 0.126769, 0.126016, 0.125123, 0.124071, 0.12285, 0.12154, 0.120199, 0.118956, 0.117807, 0.116781, 0.11593, 0.115294, 0.11487, 0.114514, 0.114078, 0.113445, 0.112526, 0.111371, 0.110018, 0.108624, 0.107347, 0.10626, 0.105398, 0.104815, 0.104419, 0.104138, 0.10388, 0.103646, 0.103327, 0.102857, 0.102215, 0.101368, 0.100412, 0.099422, 0.098422, 0.097398, 0.096412, 0.095513, 0.094726, 0.09409, 0.093538, 0.09293, 0.092103, 0.091006, 0.089597, 0.087866, 0.085981, 0.084124, 0.082424, 0.081004, 0.079851, 0.078914, 0.078162, 0.077539, 0.076988, 0.076387, 0.075653, 0.074757, 0.073675, 0.072429, 0.071044, 0.069582, 0.068059, 0.066579, 0.065197, 0.063949, 0.062827, 0.061818, 0.060864, 0.059784, 0.058466, 0.056898, 0.055038, 0.052988, 0.050924, 0.049046, 0.047395, 0.04602, 0.044932, 0.044025, 0.043265, 0.042463, 0.041544, 0.040606, 0.039596, 0.038479, 0.037382, 0.036256, 0.035053, 0.033822, 0.032593, 0.03149, 0.030571, 0.029811, 0.029202, 0.028659, 0.028065, 0.027279, 0.026142, 0.024667, 0.022948, 0.021035, 0.019054, 0.017223, 0.015729, 0.014565, 0.013648, 0.012858, 0.01207, 0.011203, 0.010236, 0.009137, 0.007875, 0.00651, 0.005059, 0.003516, 0.001959, 0.000398, -0.001095, -0.002465, -0.003674, -0.004773, -0.005804, -0.006847, -0.008001, -0.009375, -0.010972, -0.012737, -0.014615, -0.016483, -0.018294, -0.019929, -0.021277, -0.022342, -0.023163, -0.023814, -0.024384, -0.024912, -0.025471, -0.0261, -0.026831, -0.027709, -0.028753, -0.029922, -0.031144, -0.032334, -0.033396, -0.034288, -0.035, -0.03565, -0.036347, -0.037158, -0.038217, -0.039515, -0.041017, -0.042672, -0.044362, -0.045913, -0.047226, -0.048267, -0.049091, -0.049798, -0.050343, -0.050744, -0.051122, -0.051585, -0.052161, -0.05283, -0.053573, -0.054314, -0.055023, -0.055683, -0.056219, -0.056662, -0.056971, -0.057164, -0.057245, -0.057295, -0.057395, -0.057599, -0.05795, -0.058454, -0.059089, -0.05974, -0.060198, -0.06041, -0.060406, -0.060151, -0.059702, -0.05913, -0.058516, -0.057934, -0.057444, -0.057104, -0.056916, -0.056855, -0.056831, -0.05687, -0.056906, -0.056851, -0.056669, -0.056331, -0.055821, -0.055222, -0.054606, -0.054066, -0.053671, -0.053482, -0.053544, -0.053765, -0.054068, -0.054389, -0.054577, -0.054628, -0.054429, -0.054012, -0.053377, -0.052603, -0.051877, -0.051168, -0.050588, -0.050194, -0.049977, -0.049863, -0.049779, -0.049695, -0.049542, -0.049293, -0.048952, -0.048559, -0.048122, -0.04768, -0.047278, -0.047034, -0.047043, -0.04735, -0.047949, -0.0487, -0.049431, -0.050052, -0.050458, -0.050607, -0.050533, -0.050245, -0.04985, -0.049467, -0.04914, -0.048922, -0.0489, -0.049039, -0.049263, -0.049602, -0.050004, -0.05034, -0.050617, -0.050808, -0.050902, -0.050911, -0.050825, -0.050738, -0.05071, -0.050841, -0.051231, -0.051918, -0.05285, -0.053928, -0.054966, -0.055764, -0.056296, -0.05655, -0.056555, -0.056429, -0.056295, -0.056185, -0.056175, -0.056306, -0.056562, -0.056912, -0.057303, -0.05776, -0.05827, -0.058724, -0.059157, -0.059488, -0.059681, -0.059792, -0.059891, -0.06011, -0.060452, -0.061093, -0.062128, -0.063487, -0.0651, -0.066808, -0.068434, -0.069847, -0.071041, -0.072012, -0.072833, -0.073611, -0.074373, -0.075218, -0.076108, -0.077084, -0.078177, -0.079346, -0.080591, -0.081813, -0.082943, -0.083955, -0.084807, -0.085518, -0.08612, -0.086661, -0.087193, -0.08783, -0.088654, -0.089736, -0.091112, -0.092716, -0.094454, -0.096154, -0.097713, -0.099068, -0.100154, -0.100979, -0.101671, -0.102256, -0.102845, -0.103528, -0.104345, -0.105325, -0.106422, -0.107587, -0.108771, -0.109877, -0.110896, -0.111736, -0.112411, -0.112972, -0.113459, -0.113951, -0.114507, -0.115206, -0.116132, -0.117321, -0.118681, -0.120064, -0.121433, -0.122668, -0.123664, -0.124405, -0.124931, -0.125362, -0.125777, -0.126247, -0.126798, -0.127468, -0.128185, -0.128905, -0.129618, -0.130344, -0.130985, -0.131537, -0.132037, -0.132416, -0.13269, -0.132824, -0.132898, -0.133098, -0.133441, -0.133993, -0.134751, -0.135706, -0.136822, -0.13794, -0.13893, -0.139654, -0.140224, -0.140557, -0.140785, -0.14097, -0.141132, -0.141342, -0.141639, -0.142066, -0.142575, -0.143127, -0.143732, -0.144327, -0.144907, -0.145462, -0.14595, -0.146323, -0.146633, -0.146896, -0.147177, -0.14756, -0.148076, -0.1488, -0.149707, -0.150817, -0.151998, -0.153088, -0.154013, -0.154725, -0.155224, -0.155582, -0.155891, -0.156204, -0.156571, -0.157039, -0.157685, -0.158418, -0.15924, -0.159997, -0.160757, -0.16146, -0.16208, -0.162624, -0.163087, -0.16347, -0.163815, -0.164176, -0.164659, -0.165365, -0.166349, -0.167653, -0.169142, -0.170763, -0.172391, -0.173827, -0.174998, -0.175847, -0.176475, -0.176951, -0.177393, -0.177836, -0.178443, -0.179193, -0.18008, -0.181156, -0.182322, -0.183533, -0.184703, -0.18575, -0.186738, -0.187623, -0.188399, -0.189121, -0.189684, -0.190292, -0.191023, -0.191995, -0.193222, -0.194652, -0.196212, -0.197804, -0.199341, -0.200722, -0.201833, -0.202757, -0.203553, -0.204432, -0.205311, -0.206334, -0.20752, -0.208848, -0.210234, -0.21171, -0.213193, -0.214686, -0.216058, -0.217272, -0.218318, -0.219231, -0.219987, -0.220727, -0.22149, -0.222337, -0.223308, -0.224479, -0.225795, -0.227301, -0.228922, -0.23058, -0.232111, -0.233454, -0.234561, -0.23545, -0.236176, -0.236889, -0.237684, -0.238557, -0.239524, -0.240562, -0.241625, -0.242769, -0.243867, -0.244903, -0.245874, -0.246843, -0.24769, -0.248572, -0.249394, -0.250214, -0.251105, -0.252117, -0.253326, -0.254814, -0.256427, -0.258167, -0.259984, -0.261808, -0.26343, -0.26484, -0.265996, -0.266991, -0.26779, -0.268564, -0.26939, -0.270204, -0.271091, -0.271973, -0.272888, -0.273902, -0.274877, -0.275776, -0.276592, -0.277265, -0.277867, -0.278411, -0.278902, -0.279405, -0.280073, -0.280891, -0.281861, -0.283, -0.284183, -0.285307, -0.286366, -0.287278, -0.287931, -0.288434, -0.288785, -0.288977, -0.289185, -0.289421, -0.289714, -0.290069, -0.29047, -0.290877, -0.291241, -0.291519, -0.291682, -0.291739, -0.291714, -0.29161, -0.291433, -0.291168, -0.290884, -0.290658, -0.290534, -0.290687, -0.291071, -0.291565, -0.292076, -0.292486, -0.292784, -0.292853, -0.292734, -0.292487, -0.292156, -0.291834, -0.291572, -0.291385, -0.291332, -0.291421, -0.291591, -0.291861, -0.292027, -0.292153, -0.292207, -0.292192, -0.292085, -0.291866, -0.29156, -0.291213, -0.290928, -0.290735, -0.290795, -0.291128, -0.291651, -0.292314, -0.293, -0.293595, -0.294003, -0.29415, -0.294103, -0.293973, -0.293789, -0.293621, -0.293486, -0.293477, -0.293579, -0.293704, -0.293933, -0.294171, -0.294435, -0.294619, -0.294688, -0.294668, -0.294563, -0.294405, -0.294212, -0.29413, -0.294206, -0.294536, -0.295107, -0.295905, -0.296896, -0.297899, -0.298868, -0.299708, -0.300298, -0.300662, -0.300888, -0.301053, -0.301219, -0.301496, -0.301869, -0.30232, -0.302836, -0.303431, -0.304087, -0.3048, -0.30552, -0.306141, -0.306653, -0.307078, -0.307491, -0.307901, -0.308398, -0.309041, -0.309905, -0.311011, -0.312403, -0.314, -0.315758, -0.317524, -0.319136, -0.320481, -0.321617, -0.322615, -0.323532, -0.324453, -0.325463, -0.326608, -0.327888, -0.329235, -0.330627, -0.332012, -0.33336, -0.334645, -0.335813, -0.336767, -0.337538, -0.338143, -0.338653, -0.339161, -0.339726, -0.340407, -0.341273, -0.342363, -0.343677, -0.345158, -0.346746, -0.348273, -0.349641, -0.350809, -0.351768, -0.352602, -0.353411, -0.354291, -0.355295, -0.356416, -0.357667, -0.359065, -0.360481, -0.361872, -0.363204, -0.364368, -0.365356, -0.366231, -0.366958, -0.367638, -0.368295, -0.369001, -0.369801, -0.370739, -0.371872, -0.373199, -0.374704, -0.376247, -0.377736, -0.379158, -0.380401, -0.381425, -0.382276, -0.383042, -0.383803, -0.384618, -0.385529, -0.386563, -0.387725, -0.388924, -0.390014, -0.391029, -0.391934, -0.392712, -0.39335, -0.393907, -0.394458, -0.395014, -0.395595, -0.396276, -0.397123, -0.398161, -0.399388, -0.400762, -0.402232, -0.403726, -0.405117, -0.406358, -0.407392, -0.408214, -0.408944, -0.409738, -0.410696, -0.411857, -0.413201, -0.414683, -0.416201, -0.41766, -0.41902, -0.420263, -0.421396, -0.422393, -0.42327, -0.424054, -0.424777, -0.425533, -0.426363, -0.427284, -0.42836, -0.429596, -0.431004, -0.432521, -0.434007, -0.435413, -0.43667, -0.437724, -0.438578, -0.439316, -0.440001, -0.440785, -0.441699, -0.442704, -0.443795, -0.44491, -0.446024, -0.447072, -0.447982, -0.448785, -0.449465, -0.449969, -0.450384, -0.450812, -0.451259, -0.451751, -0.452396, -0.453298, -0.454405, -0.455723, -0.45716, -0.458634, -0.460038, -0.461318, -0.462375, -0.463176, -0.463787, -0.46434, -0.464901, -0.465564, -0.46635, -0.467232, -0.468152, -0.469045, -0.469884, -0.470611, -0.471269, -0.471809, -0.472269, -0.472631, -0.472912, -0.473189, -0.473543, -0.474013, -0.474632, -0.475448, -0.476478, -0.477697, -0.479072, -0.48052, -0.482009, -0.483383, -0.484612, -0.48576, -0.486874, -0.488046, -0.489362, -0.490819, -0.492341, -0.493913, -0.495503, -0.497, -0.4984, -0.499741, -0.501002, -0.502141, -0.503198, -0.504204, -0.505185, -0.506196, -0.507281, -0.508501, -0.509882, -0.511433, -0.513165, -0.514984, -0.516876, -0.518652, -0.520195, -0.521524, -0.522664, -0.523696, -0.524731, -0.525838, -0.527044, -0.528287, -0.529563, -0.530875, -0.532205, -0.533485, -0.534722, -0.535851, -0.536877, -0.537801, -0.538631, -0.539393, -0.540148, -0.540941, -0.541791, -0.542687, -0.543688, -0.544873, -0.546231, -0.547702, -0.549184, -0.550584, -0.551863, -0.552955, -0.553874, -0.554696, -0.555565, -0.556491, -0.55746, -0.558483, -0.559543, -0.560611, -0.561696, -0.562693, -0.563599, -0.564342, -0.564932, -0.565396, -0.565794, -0.566176, -0.566597, -0.567092, -0.567704, -0.568446, -0.569319, -0.570332, -0.571458, -0.572657, -0.573872, -0.575013, -0.575996, -0.576819, -0.577452, -0.578023, -0.578674, -0.579443, -0.580344, -0.581241, -0.582064, -0.582842, -0.583533, -0.584088, -0.584496, -0.584758, -0.584935, -0.584985, -0.584952, -0.584882, -0.5848, -0.58475, -0.584799, -0.585014, -0.585325, -0.585723, -0.586164, -0.586535, -0.586762, -0.586837, 0.413237, 0.413434, 0.413666, 0.413837, 0.41394, 0.413911, 0.413722, 0.413467, 0.413161, 0.412903, 0.412728, 0.412689, 0.412872, 0.413121, 0.413419, 0.413789, 0.414068, 0.414214, 0.41425, 0.414072, 0.413733, 0.413259, 0.412704, 0.412129, 0.411582, 0.411116, 0.410786, 0.410548, 0.41042, 0.410344, 0.410212, 0.409957, 0.40957, 0.409058, 0.408516, 0.407922, 0.407367, 0.406943, 0.406691, 0.406586, 0.406595, 0.406668, 0.406819, 0.40702, 0.40718, 0.407228, 0.407123, 0.406851, 0.406437, 0.405864, 0.405186, 0.404502, 0.403897, 0.403415, 0.403103, 0.402923, 0.402798, 0.402607, 0.402259, 0.40172, 0.401027, 0.400236, 0.399371, 0.398542, 0.397737, 0.397003, 0.396429, 0.396045, 0.395738, 0.39549, 0.395301, 0.395043, 0.394659, 0.3941, 0.393357, 0.392391, 0.391157, 0.389755, 0.38834, 0.386976, 0.385767, 0.384724, 0.383891, 0.383233, 0.382582, 0.381868, 0.381025, 0.38001, 0.378803, 0.377466, 0.376128, 0.374835, 0.373676, 0.372692, 0.37191, 0.371246, 0.370672, 0.370163, 0.369669, 0.369114, 0.368418, 0.367553, 0.36649, 0.36526, 0.363886, 0.362399, 0.360901, 0.359486, 0.358228, 0.357164, 0.356271, 0.355491, 0.354732, 0.353912, 0.353017, 0.352015, 0.350923, 0.349772, 0.348605, 0.347494, 0.346477, 0.345556, 0.34471, 0.343952, 0.343229, 0.342542, 0.341807, 0.34096, 0.340003, 0.338948, 0.337732, 0.336381, 0.334983, 0.333533, 0.332028, 0.330533, 0.329135, 0.327819, 0.326523, 0.32522, 0.323794, 0.322188, 0.320473, 0.318733, 0.317015, 0.315347, 0.313766, 0.31233, 0.311051, 0.309889, 0.308853, 0.307913, 0.307012, 0.30614, 0.305186, 0.304152, 0.303043, 0.30184, 0.300539, 0.299178, 0.297809, 0.296454, 0.295123, 0.293899, 0.292813, 0.291858, 0.29095, 0.290018, 0.28902, 0.287948, 0.286821, 0.285702, 0.284679, 0.283803, 0.283052, 0.282336, 0.28167, 0.281105, 0.280623, 0.280164, 0.27971, 0.27924, 0.278648, 0.277927, 0.277091, 0.27613, 0.275039, 0.273859, 0.272659, 0.271472, 0.270396, 0.269463, 0.268613, 0.267762, 0.266807, 0.265726, 0.264488, 0.263083, 0.261566, 0.260074, 0.25868, 0.257376, 0.256124, 0.254962, 0.253863, 0.252802, 0.251737, 0.250644, 0.249516, 0.24839, 0.247142, 0.245764, 0.244302, 0.242808, 0.241237, 0.239741, 0.23836, 0.237136, 0.236037, 0.23503, 0.234108, 0.233174, 0.232137, 0.23094, 0.229605, 0.228196, 0.226775, 0.225447, 0.224287, 0.223288, 0.222384, 0.221587, 0.220898, 0.220277, 0.219641, 0.218932, 0.218081, 0.217051, 0.215845, 0.214483, 0.212928, 0.211247, 0.209492, 0.207749, 0.206062, 0.204531, 0.203072, 0.201607, 0.200114, 0.198564, 0.196908, 0.195153, 0.193282, 0.191381, 0.189505, 0.187662, 0.185911, 0.184305, 0.182834, 0.181462, 0.180201, 0.179005, 0.177865, 0.176686, 0.175475, 0.174156, 0.172661, 0.171015, 0.169231, 0.167326, 0.16535, 0.163416, 0.161559, 0.159825, 0.158187, 0.156613, 0.155029, 0.153424, 0.151741, 0.149911, 0.148022, 0.146146, 0.144301, 0.142549, 0.140944, 0.139508, 0.138214, 0.137032, 0.135935, 0.134834, 0.133685, 0.132524, 0.131286, 0.129886, 0.128344, 0.126711, 0.124962, 0.123137, 0.121322, 0.119571, 0.117954, 0.116496, 0.115127, 0.11377, 0.112371, 0.110895, 0.109296, 0.107645, 0.10594, 0.104277, 0.102674, 0.101131, 0.099752, 0.098559, 0.097463, 0.096467, 0.095556, 0.094668, 0.093732, 0.092727, 0.091603, 0.090352, 0.088957, 0.087472, 0.085948, 0.084454, 0.083046, 0.081739, 0.080528, 0.079453, 0.078483, 0.077568, 0.076675, 0.075754, 0.074811, 0.073982, 0.073214, 0.072526, 0.071919, 0.071442, 0.071072, 0.070794, 0.070607, 0.070515, 0.070423, 0.070242, 0.069998, 0.069656, 0.069157, 0.068535, 0.067806, 0.067006, 0.066131, 0.065295, 0.064494, 0.06377, 0.063178, 0.062624, 0.062049, 0.061379, 0.06064, 0.059842, 0.059055, 0.058338, 0.057758, 0.05736, 0.057168, 0.057152, 0.057306, 0.057586, 0.05792, 0.058271, 0.058575, 0.058769, 0.058835, 0.058756, 0.058529, 0.058216, 0.057835, 0.057416, 0.05697, 0.056537, 0.056181, 0.055872, 0.055637, 0.055417, 0.055157, 0.054782, 0.054278, 0.053659, 0.053004, 0.052358, 0.051821, 0.051396, 0.051098, 0.05094, 0.050861, 0.050864, 0.050922, 0.050956, 0.050927, 0.050782, 0.05056, 0.050241, 0.049833, 0.049332, 0.048772, 0.048245, 0.047792, 0.047398, 0.047058, 0.046753, 0.046417, 0.045972, 0.045389, 0.044673, 0.043828, 0.042948, 0.042085, 0.041283, 0.040592, 0.039997, 0.03953, 0.039193, 0.038913, 0.038683, 0.038456, 0.038203, 0.03785, 0.037386, 0.036794, 0.036061, 0.035183, 0.034228, 0.033259, 0.032356, 0.031538, 0.030783, 0.030107, 0.029477, 0.028804, 0.028018, 0.027077, 0.025962, 0.024674, 0.023305, 0.021947, 0.020735, 0.019652, 0.018704, 0.017826, 0.016974, 0.016185, 0.015436, 0.014733, 0.014008, 0.013184, 0.01226, 0.011209, 0.010024, 0.008802, 0.007511, 0.006213, 0.004949, 0.003749, 0.002584, 0.001468, 0.000383, -0.00077, -0.001957, -0.003277, -0.004719, -0.006234, -0.007748, -0.00924, -0.010596, -0.011769, -0.012766, -0.013631, -0.01442, -0.015178, -0.016025, -0.017009, -0.018064, -0.019253, -0.020606, -0.022057, -0.023586, -0.025107, -0.026525, -0.027884, -0.029209, -0.030482, -0.031726, -0.032891, -0.034033, -0.035197, -0.036445, -0.037792, -0.039229, -0.040723, -0.042188, -0.043563, -0.044772, -0.045869, -0.046872, -0.047804, -0.048691, -0.049572, -0.050453, -0.051415, -0.052543, -0.053742, -0.055, -0.056353, -0.057785, -0.05923, -0.060613, -0.061981, -0.063276, -0.064483, -0.065597, -0.066748, -0.067949, -0.069255, -0.070643, -0.072071, -0.073465, -0.07476, -0.075962, -0.077056, -0.078041, -0.078878, -0.079601, -0.08024, -0.080834, -0.081477, -0.082195, -0.083042, -0.084036, -0.085159, -0.086403, -0.087727, -0.0891, -0.090528, -0.091954, -0.093349, -0.094658, -0.09588, -0.097038, -0.098234, -0.099509, -0.100834, -0.102236, -0.103653, -0.104989, -0.106171, -0.10719, -0.10809, -0.108849, -0.109455, -0.110027, -0.110576, -0.111158, -0.111814, -0.112595, -0.113498, -0.114549, -0.115717, -0.116949, -0.118229, -0.119515, -0.120723, -0.121832, -0.122891, -0.12385, -0.124794, -0.125816, -0.126962, -0.128264, -0.129645, -0.131052, -0.13245, -0.133738, -0.13487, -0.135775, -0.136546, -0.137227, -0.137817, -0.138382, -0.139, -0.139669, -0.140469, -0.141399, -0.142449, -0.143646, -0.144945, -0.146308, -0.147706, -0.149058, -0.150344, -0.151542, -0.152676, -0.153818, -0.155036, -0.156392, -0.15793, -0.159734, -0.161697, -0.163689, -0.16566, -0.167522, -0.16922, -0.170739, -0.172109, -0.173344, -0.174469, -0.175548, -0.176624, -0.177674, -0.178779, -0.179977, -0.181236, -0.182513, -0.183786, -0.18503, -0.186253, -0.187441, -0.188584, -0.189681, -0.19082, -0.192046, -0.193349, -0.194788, -0.1964, -0.1981, -0.199876, -0.201679, -0.203414, -0.205003, -0.206461, -0.207827, -0.209078, -0.210267, -0.211479, -0.212679, -0.213868, -0.215068, -0.216344, -0.217669, -0.219072, -0.22049, -0.221974, -0.223426, -0.224722, -0.225929, -0.227131, -0.228324, -0.229567, -0.230867, -0.232296, -0.233898, -0.235623, -0.237478, -0.239475, -0.241458, -0.24332, -0.245039, -0.246537, -0.247843, -0.249011, -0.250133, -0.251233, -0.252358, -0.253537, -0.254785, -0.256106, -0.257521, -0.258953, -0.260404, -0.261797, -0.263121, -0.264295, -0.265405, -0.266433, -0.267429, -0.268474, -0.269612, -0.270892, -0.272292, -0.27377, -0.275218, -0.276642, -0.27792, -0.279023, -0.279955, -0.280711, -0.281342, -0.281827, -0.282232, -0.282621, -0.283039, -0.283486, -0.283976, -0.284584, -0.285218, -0.285951, -0.286692, -0.287393, -0.288067, -0.288762, -0.289396, -0.290041, -0.290694, -0.291433, -0.292261, -0.29323, -0.29437, -0.295504, -0.296679, -0.297746, -0.298677, -0.2994, -0.29999, -0.30039, -0.300713, -0.30087, -0.301012, -0.301232, -0.301519, -0.301846, -0.302218, -0.302687, -0.303236, -0.303772, -0.304274, -0.304703, -0.30505, -0.305353, -0.305617, -0.305971, -0.30637, -0.306912, -0.307626, -0.308508, -0.309416, -0.310345, -0.31117, -0.311876, -0.312422, -0.312771, -0.312985, -0.31309, -0.313107, -0.313146, -0.313177, -0.313268, -0.313426, -0.313654, -0.314028, -0.31446, -0.314915, -0.315317, -0.315648, -0.315924, -0.316111, -0.316239, -0.316321, -0.316406, -0.316658, -0.317055, -0.317657, -0.318368, -0.319187, -0.320041, -0.320799, -0.321429, -0.321928, -0.322346, -0.322664, -0.322854, -0.323049, -0.323215, -0.323438, -0.323669, -0.323899, -0.324194, -0.32459, -0.325072, -0.32557, -0.326057, -0.326587, -0.327094, -0.327619, -0.328138, -0.328692, -0.329271, -0.330045, -0.330979, -0.332107, -0.333386, -0.334691, -0.335894, -0.336934, -0.33777, -0.338477, -0.339096, -0.33967, -0.340259, -0.34093, -0.34161, -0.342311, -0.34306, -0.343905, -0.344834, -0.345702, -0.346665, -0.347574, -0.348366, -0.349132, -0.34984, -0.35056, -0.351266, -0.352054, -0.352914, -0.354004, -0.355299, -0.356741, -0.358296, -0.359948, -0.361468, -0.362825, -0.364, -0.365092, -0.366112, -0.367029, -0.367912, -0.368825, -0.369788, -0.370758, -0.37186, -0.373022, -0.374283, -0.375622, -0.377027, -0.378297, -0.379482, -0.380589, -0.381604, -0.382589, -0.383593, -0.384672, -0.38582, -0.387103, -0.388635, -0.390328, -0.392018, -0.393656, -0.395175, -0.396518, -0.397751, -0.39876, -0.399661, -0.400526, -0.401359, -0.402274, -0.403227, -0.404234, -0.405284, -0.406443, -0.407688, -0.408951, -0.410198, -0.411347, -0.412448, -0.413509, -0.414527, -0.415529, -0.416517, -0.417551, -0.418716, -0.42006, -0.421512, -0.423025, -0.424487, -0.425879, -0.427213, -0.428434, -0.429539, -0.430507, -0.431454, -0.432441, -0.433477, -0.434536, -0.435705, -0.436938, -0.438161, -0.439386, -0.440656, -0.441969, -0.443209, -0.444393, -0.445474, -0.446456, -0.447371, -0.448345, -0.449404, -0.450579, -0.451943, -0.453371, -0.454883, -0.456386, -0.457717, -0.458892, -0.459917, -0.46083, -0.461655, -0.462376, -0.462998, -0.463658, -0.464314, -0.465089, -0.466012, -0.467061, -0.468187, -0.469291, -0.47039, -0.471531, -0.472678, -0.473783, -0.474894, -0.475944, -0.477021, -0.478158, -0.479385, -0.480814, -0.482341, -0.483859, -0.485455, -0.486784, -0.488007, -0.489063, -0.48998, -0.490823, -0.491658, -0.492527, -0.493426, -0.494431, -0.495514, -0.496649, -0.497863, -0.499144, -0.500517, -0.501881, -0.503163, -0.504359, -0.505528, -0.506702, -0.507896, -0.509055, -0.510276, -0.511588, -0.513078, -0.514756, -0.516508, -0.518267, -0.519952, -0.52151, -0.522888, -0.524022, -0.525021, -0.525928, -0.5268, -0.527669, -0.528586, -0.52957, -0.530606, -0.53174, -0.532877, -0.534098, -0.535343, -0.536656, -0.538045, -0.53944, -0.54085, -0.542268, -0.543678, -0.545207, -0.546811, -0.548545, -0.55046, -0.552582, -0.554767, -0.557051, -0.559264, -0.561303, -0.563221, -0.564983, -0.566639, -0.568113, -0.569529, -0.570924, -0.572292, -0.573665, -0.575063, -0.576417, -0.577735, -0.578993, -0.580202, -0.581426, -0.582655, -0.583871, -0.585132, -0.586404, -0.587751, -0.589263, -0.590911, -0.592675, -0.594549, -0.59654, -0.598559, -0.600431, -0.602209, -0.603721, -0.605038, -0.606146, -0.6072, -0.608214, -0.609267, -0.610445, -0.611685, -0.61299, -0.614361, -0.615742, -0.617154, -0.618511, -0.619777, -0.62097, -0.622073, -0.623092, -0.624098, -0.62517, -0.626284, -0.627541, -0.628954, -0.63058, -0.632375, -0.634264, -0.636154, -0.638, -0.639746, -0.641318, -0.642741, -0.644051, -0.645286, -0.646409, -0.647516, -0.648537, -0.649557, -0.650568, -0.651617, -0.652609, -0.653638, -0.654568, -0.655442, -0.656213, -0.656913, -0.657549, -0.658192, -0.658824, -0.659558, -0.660412, -0.661409, -0.662492, -0.663531, -0.664547, -0.6655, -0.666325, -0.666933, -0.667353, -0.667748, -0.667968, -0.668184, -0.668427, -0.668822, -0.669341, -0.669919, -0.670565, -0.671326, -0.672136, -0.672958, -0.673809, -0.674637, -0.675384, -0.676032, 0.323368, 0.322763, 0.322102, 0.32127, 0.320254, 0.319027, 0.317769, 0.316375, 0.315092, 0.313849, 0.312726, 0.311797, 0.311079, 0.310556, 0.310111, 0.309724, 0.309276, 0.308825, 0.308354, 0.307887, 0.307341, 0.306791, 0.30625, 0.305795, 0.305296, 0.304894, 0.304492, 0.304099, 0.303744, 0.303272, 0.302658, 0.301842, 0.300846, 0.299686, 0.298451, 0.297222, 0.296013, 0.295001, 0.294121, 0.293356, 0.29272, 0.292141, 0.291537, 0.290922, 0.290188, 0.289419, 0.288604, 0.287763, 0.286927, 0.286131, 0.285308, 0.284467, 0.283639, 0.282864, 0.282114, 0.281311, 0.280428, 0.279465, 0.278348, 0.277044, 0.275537, 0.273802, 0.27199, 0.270195, 0.268498, 0.267019, 0.265677, 0.264478, 0.263362, 0.262314, 0.261257, 0.260197, 0.259152, 0.257974, 0.256677, 0.255364, 0.254052, 0.252745, 0.251505, 0.250321, 0.249134, 0.247976, 0.24675, 0.245508, 0.244176, 0.242761, 0.24118, 0.239377, 0.237348, 0.235221, 0.233125, 0.231148, 0.229354, 0.227801, 0.226463, 0.225229, 0.224026, 0.222748, 0.221413, 0.220023, 0.218603, 0.217057, 0.215494, 0.213866, 0.212225, 0.210552, 0.209002, 0.2076, 0.206196, 0.204723, 0.20318, 0.201624, 0.20006, 0.198392, 0.196535, 0.194465, 0.192245, 0.189947, 0.187656, 0.185472, 0.183438, 0.181662, 0.180024, 0.178516, 0.177032, 0.175595, 0.174182, 0.17275, 0.171253, 0.169652, 0.168037, 0.16643, 0.164874, 0.163356, 0.161889, 0.160475, 0.159118, 0.157719, 0.156352, 0.154927, 0.153443, 0.151883, 0.15025, 0.148517, 0.146687, 0.144891, 0.143075, 0.141384, 0.139784, 0.138347, 0.136986, 0.135599, 0.134129, 0.132588, 0.130996, 0.12931, 0.127622, 0.125924, 0.124276, 0.122597, 0.120945, 0.119315, 0.117697, 0.116204, 0.114781, 0.113361, 0.111981, 0.110511, 0.108921, 0.107218, 0.105398, 0.103505, 0.101503, 0.099521, 0.097636, 0.095862, 0.094304, 0.092904, 0.091445, 0.090079, 0.088594, 0.086978, 0.085271, 0.083476, 0.081579, 0.079637, 0.077715, 0.075774, 0.073846, 0.071962, 0.070121, 0.068316, 0.066584, 0.064823, 0.063026, 0.061064, 0.059008, 0.056879, 0.054633, 0.052483, 0.050353, 0.048417, 0.046511, 0.04474, 0.043107, 0.041541, 0.040017, 0.038423, 0.036815, 0.035183, 0.033575, 0.03199, 0.030453, 0.028937, 0.027592, 0.026287, 0.024991, 0.023799, 0.022617, 0.021427, 0.020189, 0.018651, 0.017107, 0.015309, 0.013314, 0.011212, 0.009166, 0.007129, 0.005241, 0.003504, 0.001912, 0.000469, -0.000856, -0.002144, -0.003467, -0.004887, -0.006431, -0.008075, -0.009792, -0.011576, -0.013419, -0.015216, -0.016966, -0.018691, -0.020365, -0.022012, -0.023702, -0.025442, -0.027236, -0.029184, -0.031309, -0.03356, -0.035917, -0.038365, -0.040862, -0.043282, -0.04558, -0.047747, -0.049769, -0.051648, -0.053466, -0.055284, -0.057143, -0.059084, -0.061099, -0.063186, -0.065293, -0.06734, -0.069354, -0.07139, -0.073399, -0.075336, -0.077184, -0.078961, -0.0807, -0.082451, -0.084246, -0.08615, -0.088153, -0.090299, -0.092577, -0.094934, -0.097274, -0.099575, -0.101722, -0.103665, -0.105474, -0.107167, -0.108754, -0.110296, -0.111895, -0.113549, -0.115215, -0.116908, -0.118631, -0.120326, -0.121971, -0.123581, -0.125116, -0.126519, -0.127798, -0.129029, -0.130317, -0.131701, -0.133193, -0.134817, -0.136586, -0.13854, -0.14067, -0.142863, -0.14501, -0.14703, -0.148878, -0.150549, -0.152073, -0.153475, -0.154831, -0.156259, -0.157809, -0.159459, -0.161178, -0.162928, -0.164654, -0.166296, -0.167864, -0.169378, -0.170842, -0.172305, -0.17376, -0.17517, -0.176536, -0.177918, -0.179389, -0.180976, -0.182702, -0.184513, -0.186356, -0.188195, -0.189937, -0.19149, -0.192844, -0.194049, -0.19515, -0.196185, -0.197171, -0.198113, -0.199042, -0.199971, -0.20086, -0.20168, -0.202426, -0.203061, -0.203581, -0.20403, -0.204359, -0.204617, -0.204834, -0.205081, -0.205432, -0.20589, -0.206513, -0.207316, -0.208262, -0.209308, -0.210415, -0.211482, -0.212436, -0.213314, -0.214104, -0.214752, -0.215314, -0.215836, -0.216348, -0.216902, -0.217509, -0.218145, -0.218691, -0.219142, -0.219541, -0.219847, -0.220006, -0.220047, -0.220032, -0.220006, -0.219998, -0.220069, -0.22025, -0.220554, -0.220971, -0.22145, -0.221995, -0.2226, -0.223201, -0.22376, -0.224266, -0.224711, -0.225099, -0.225447, -0.225841, -0.226339, -0.226919, -0.227568, -0.228255, -0.228963, -0.229673, -0.230366, -0.231028, -0.231606, -0.232082, -0.232444, -0.232714, -0.232975, -0.233323, -0.233796, -0.23441, -0.235233, -0.236229, -0.237322, -0.238444, -0.239546, -0.240574, -0.241496, -0.242326, -0.243064, -0.243729, -0.244333, -0.24496, -0.24568, -0.246461, -0.247292, -0.248177, -0.249119, -0.250086, -0.251033, -0.251919, -0.252746, -0.253511, -0.254194, -0.254892, -0.255633, -0.256407, -0.257238, -0.258296, -0.259545, -0.260937, -0.262405, -0.263902, -0.265366, -0.266741, -0.267975, -0.269108, -0.27019, -0.271257, -0.272385, -0.273577, -0.274815, -0.27615, -0.277575, -0.278979, -0.28034, -0.281604, -0.282773, -0.283889, -0.284945, -0.285934, -0.2869, -0.287872, -0.288932, -0.290151, -0.291565, -0.293181, -0.295011, -0.297021, -0.299114, -0.301174, -0.303093, -0.304857, -0.306461, -0.307908, -0.309316, -0.310746, -0.312168, -0.313592, -0.315065, -0.316535, -0.318003, -0.319498, -0.320998, -0.322448, -0.323818, -0.325132, -0.326393, -0.327625, -0.32887, -0.330196, -0.331672, -0.33327, -0.335005, -0.336901, -0.338945, -0.341097, -0.343236, -0.345259, -0.3471, -0.348693, -0.350072, -0.351358, -0.352624, -0.353944, -0.355327, -0.356807, -0.358332, -0.359898, -0.36148, -0.363035, -0.364514, -0.365904, -0.367215, -0.368473, -0.369702, -0.370916, -0.372125, -0.373334, -0.374646, -0.376048, -0.377547, -0.379172, -0.380912, -0.382729, -0.384517, -0.386187, -0.387701, -0.389022, -0.390251, -0.391491, -0.39276, -0.394024, -0.395282, -0.396562, -0.397837, -0.399102, -0.400339, -0.40151, -0.402582, -0.403553, -0.404454, -0.405285, -0.406089, -0.406918, -0.40776, 0.591282, 0.590175, 0.588941, 0.587563, 0.586017, 0.584426, 0.582844, 0.581305, 0.579852, 0.578519, 0.57732, 0.576158, 0.574976, 0.573747, 0.572439, 0.571082, 0.569739, 0.568474, 0.567266, 0.566147, 0.565076, 0.564053, 0.563108, 0.562257, 0.561454, 0.560665, 0.559867, 0.558982, 0.557988, 0.55684, 0.555572, 0.554189, 0.552735, 0.551265, 0.549833, 0.548472, 0.547194, 0.545961, 0.544776, 0.543568, 0.542269, 0.540859, 0.539313, 0.537679, 0.536002, 0.534339, 0.532712, 0.53119, 0.529806, 0.52863, 0.527585, 0.526616, 0.525693, 0.524752, 0.523709, 0.522614, 0.5214, 0.520063, 0.518563, 0.516937, 0.515296, 0.513742, 0.51227, 0.510874, 0.509554, 0.508324, 0.507052, 0.505723, 0.504323, 0.502858, 0.501302, 0.499668, 0.497966, 0.496313, 0.494788, 0.4934, 0.49212, 0.490932, 0.489804, 0.488665, 0.487499, 0.486239, 0.484844, 0.483372, 0.481714, 0.479896, 0.477989, 0.476007, 0.474027, 0.472177, 0.470479, 0.468909, 0.467483, 0.466151, 0.464806, 0.463435, 0.461915, 0.460303, 0.45863, 0.456982, 0.455406, 0.453847, 0.452259, 0.4507, 0.449216, 0.447799, 0.446362, 0.444892, 0.443412, 0.441903, 0.440357, 0.438635, 0.436729, 0.434647, 0.432459, 0.430264, 0.428137, 0.426252, 0.424589, 0.423115, 0.421725, 0.420343, 0.418963, 0.417579, 0.416112, 0.414541, 0.412909, 0.411336, 0.409928, 0.408581, 0.407296, 0.406097, 0.404988, 0.403938, 0.40296, 0.401995, 0.400921, 0.399777, 0.398573, 0.397282, 0.395859, 0.394294, 0.392632, 0.390933, 0.389311, 0.387834, 0.386538, 0.385441, 0.384388, 0.383255, 0.382034, 0.380716, 0.379346, 0.377976, 0.376682, 0.37548, 0.374367, 0.373385, 0.372591, 0.37195, 0.371458, 0.371041, 0.370632, 0.37026, 0.369865, 0.369361, 0.368745, 0.368076, 0.367284, 0.366467, 0.365673, 0.364817, 0.364104, 0.363538, 0.363108, 0.362707, 0.362287, 0.361802, 0.361236, 0.360643, 0.360073, 0.359516, 0.358931, 0.358426, 0.358093, 0.357851, 0.357679, 0.357589, 0.357507, 0.357425, 0.357334, 0.357152, 0.356799, 0.35634, 0.355775, 0.355133, 0.354511, 0.353934, 0.353387, 0.35287, 0.352476, 0.352098, 0.351785, 0.351506, 0.35119, 0.350777, 0.350227, 0.349555, 0.348832, 0.348161, 0.34753, 0.347019, 0.346657, 0.346418, 0.34628, 0.346207, 0.346131, 0.345988, 0.345854, 0.345634, 0.345291, 0.344811, 0.344181, 0.343486, 0.342811, 0.342183, 0.341657, 0.341237, 0.340936, 0.340741, 0.340519, 0.340304, 0.339968, 0.339491, 0.338989, 0.338483, 0.337908, 0.337431, 0.337066, 0.336801, 0.336597, 0.336465, 0.336407, 0.336307, 0.336183, 0.33602, 0.335792, 0.335404, 0.334818, 0.334055, 0.333174, 0.332226, 0.331268, 0.330376, 0.32957, 0.328893, 0.328294, 0.327713, 0.327125, 0.32637, 0.325452, 0.324382, 0.32327, 0.322178, 0.321107, 0.320148, 0.319295, 0.318579, 0.318006, 0.31748, 0.316972, 0.316388, 0.315787, 0.315143, 0.314504, 0.313755, 0.31288, 0.311847, 0.310703, 0.309546, 0.308403, 0.307367, 0.306468, 0.305687, 0.304941, 0.304178, 0.303304, 0.302331, 0.301219, 0.299941, 0.298579, 0.29719, 0.295816, 0.294546, 0.293378, 0.292269, 0.291299, 0.290446, 0.289623, 0.288795, 0.287942, 0.286994, 0.285921, 0.284756, 0.283419, 0.281974, 0.280443, 0.278892, 0.277428, 0.276114, 0.274959, 0.273917, 0.272855, 0.271755, 0.270565, 0.269249, 0.267817, 0.266313, 0.264823, 0.263415, 0.262146, 0.260993, 0.259955, 0.259095, 0.258403, 0.257772, 0.257128, 0.256443, 0.255718, 0.254941, 0.253993, 0.252835, 0.25148, 0.250015, 0.2485, 0.24697, 0.245562, 0.244278, 0.243072, 0.241879, 0.240656, 0.239388, 0.238049, 0.236614, 0.235151, 0.233727, 0.232386, 0.231184, 0.230136, 0.229291, 0.228568, 0.227941, 0.227416, 0.226913, 0.226363, 0.225823, 0.22523, 0.224487, 0.223622, 0.222665, 0.221602, 0.220457, 0.219308, 0.218244, 0.21724, 0.216358, 0.215587, 0.214861, 0.214053, 0.213188, 0.21229, 0.211426, 0.210595, 0.20991, 0.209347, 0.208906, 0.208515, 0.20828, 0.208176, 0.208098, 0.208077, 0.207975, 0.207832, 0.207647, 0.207312, 0.206794, 0.206116, 0.205314, 0.204397, 0.20344, 0.202432, 0.20147, 0.200578, 0.199686, 0.198757, 0.197674, 0.196465, 0.195082, 0.193498, 0.191817, 0.190142, 0.188566, 0.187154, 0.185894, 0.184802, 0.183913, 0.18314, 0.182386, 0.181632, 0.180859, 0.180036, 0.179152, 0.178179, 0.177118, 0.175977, 0.174806, 0.17366, 0.172564, 0.17154, 0.170636, 0.169827, 0.169049, 0.168248, 0.167403, 0.166447, 0.165292, 0.164027, 0.162787, 0.161579, 0.160484, 0.159541, 0.158637, 0.157825, 0.157111, 0.156427, 0.15573, 0.154972, 0.154145, 0.153242, 0.152245, 0.151166, 0.150027, 0.148829, 0.147587, 0.146348, 0.145157, 0.144065, 0.143102, 0.142233, 0.141381, 0.140418, 0.139337, 0.13815, 0.13687, 0.13548, 0.134092, 0.132764, 0.131548, 0.130493, 0.129617, 0.128867, 0.128182, 0.127526, 0.126865, 0.126184, 0.125484, 0.124688, 0.123765, 0.122728, 0.121552, 0.120222, 0.118859, 0.117602, 0.116491, 0.11546, 0.114501, 0.113543, 0.112534, 0.111398, 0.110079, 0.108653, 0.107145, 0.105618, 0.104128, 0.102818, 0.101657, 0.100623, 0.099735, 0.098977, 0.098287, 0.097618, 0.09697, 0.096296, 0.09552, 0.094633, 0.093686, 0.092657, 0.091526, 0.090427, 0.089408, 0.088537, 0.087829, 0.087198, 0.086655, 0.086064, 0.085425, 0.08466, 0.083728, 0.08269, 0.081646, 0.08065, 0.0797, 0.078838, 0.07817, 0.077697, 0.07733, 0.076997, 0.076708, 0.076395, 0.076046, 0.07561, 0.075109, 0.074492, 0.073782, 0.072988, 0.072106, 0.071266, 0.070555, 0.069998, 0.069592, 0.069317, 0.069114, 0.068887, 0.068606, 0.068219, 0.067758, 0.067325, 0.067002, 0.066844, 0.066876, 0.067126, 0.067527, 0.068092, 0.068727, 0.069328, 0.069965, 0.070597, 0.071182, 0.071679, 0.072053, 0.0723, 0.072368, 0.072319, 0.072198, 0.072034, 0.071889, 0.071774, 0.071739, 0.071779, 0.071788, 0.071687, 0.071412, 0.070978, 0.070446, 0.069902, 0.069451, 0.069162, 0.069046, 0.069069, 0.069178, 0.06933, 0.06951, 0.069661, 0.069783, 0.069889, 0.069945, 0.069932, 0.06981, 0.069576, 0.069263, 0.068939, 0.068667, 0.068461, 0.068333, 0.068293, 0.068279, 0.068197, 0.067967, 0.067537, 0.066958, 0.066338, 0.065734, 0.065181, 0.064765, 0.064489, 0.0644, 0.064427, 0.064528, 0.064688, 0.064852, 0.065002, 0.065162, 0.065231, 0.065109, 0.064811, 0.064452, 0.064095, 0.063704, 0.06328, 0.062952, 0.062747, 0.062618, 0.062522, 0.062397, 0.06217, 0.061751, 0.061143, 0.060319, 0.059349, 0.058369, 0.057514, 0.056858, 0.056403, 0.056124, 0.055995, 0.055912, 0.055862, 0.055813, 0.055664, 0.055389, 0.054974, 0.054378, 0.053613, 0.052739, 0.051842, 0.050912, 0.050009, 0.049186, 0.048442, 0.047756, 0.047095, 0.046383, 0.045533, 0.044428, 0.043167, 0.041793, 0.040347, 0.038973, 0.037737, 0.036677, 0.035804, 0.035101, 0.034509, 0.034049, 0.033636, 0.033184, 0.032634, 0.031981, 0.031191, 0.030212, 0.029089, 0.02785, 0.026552, 0.025295, 0.024129, 0.023059, 0.022095, 0.021205, 0.02034, 0.01941, 0.018339, 0.017153, 0.015906, 0.014652, 0.013413, 0.01223, 0.011193, 0.010258, 0.00947, 0.008767, 0.008091, 0.007442, 0.006731, 0.005958, 0.005095, 0.004141, 0.003079, 0.00187, 0.000526, -0.000874, -0.002264, -0.003586, -0.004808, -0.005892, -0.006861, -0.00782, -0.008816, -0.009925, -0.011137, -0.012423, -0.013734, -0.014992, -0.016115, -0.016996, -0.017681, -0.018237, -0.018732, -0.019134, -0.019491, -0.019882, -0.02035, -0.020888, -0.021493, -0.022195, -0.023008, -0.023941, -0.024966, -0.026005, -0.026907, -0.027635, -0.028213, -0.028679, -0.02914, -0.029669, -0.030294, -0.031076, -0.032011, -0.033085, -0.034166, -0.035195, -0.036163, -0.037045, -0.037758, -0.038271, -0.038723, -0.039111, -0.039432, -0.039761, -0.040123, -0.040582, -0.041092, -0.041734, -0.042465, -0.043266, -0.044143, -0.045047, -0.045913, -0.046725, -0.047481, -0.048218, -0.049008, -0.049919, -0.050977, -0.05223, -0.053634, -0.055068, -0.056486, -0.057808, -0.058911, -0.059832, -0.060576, -0.061156, -0.061662, -0.062128, -0.062653, -0.063318, -0.064089, -0.064984, -0.065979, -0.067067, -0.068229, -0.069433, -0.070616, -0.071794, -0.072926, -0.073967, -0.074954, -0.075918, -0.07693, -0.078102, -0.079456, -0.080945, -0.082487, -0.083992, -0.085379, -0.086533, -0.087483, -0.088212, -0.088795, -0.089276, -0.089715, -0.09021, -0.090725, -0.091334, -0.092043, -0.092878, -0.093828, -0.094822, -0.095867, -0.096942, -0.097963, -0.098882, -0.099702, -0.100469, -0.101269, -0.102138, -0.103134, -0.104342, -0.10575, -0.107324, -0.109003, -0.110633, -0.112124, -0.113399, -0.114443, -0.115318, -0.116097, -0.11681, -0.11754, -0.118324, -0.119198, -0.120165, -0.121246, -0.122473, -0.123757, -0.12504, -0.126335, -0.127579, -0.128742, -0.129774, -0.130658, -0.131415, -0.132212, -0.133062, -0.134044, -0.135233, -0.1366, -0.138075, -0.13949, -0.140803, -0.14193, -0.14281, -0.143476, -0.144017, -0.144513, -0.145004, -0.145563, -0.146175, -0.146839, -0.147632, -0.148567, -0.149612, -0.150656, -0.151632, -0.152533, -0.153366, -0.154093, -0.154711, -0.15528, -0.155827, -0.156399, -0.157094, -0.157942, -0.158971, -0.16018, -0.161457, -0.162712, -0.163795, -0.164605, -0.165206, -0.165595, -0.165853, -0.166076, -0.166313, -0.16659, -0.166908, -0.167309, -0.167776, -0.168288, -0.168872, -0.169467, -0.170051, -0.170589, -0.170974, -0.17122, -0.171393, -0.171519, -0.171641, -0.171829, -0.172139, -0.17261, -0.173213, -0.17387, -0.174495, -0.175015, -0.175362, -0.175471, -0.175408, -0.175244, -0.175012, -0.174768, -0.174574, -0.174438, -0.174352, -0.174371, -0.174416, -0.174479, -0.174542, -0.174553, -0.174537, -0.174421, -0.174172, -0.173807, -0.173323, -0.172772, -0.172296, -0.172008, -0.171934, -0.171947, -0.172011, -0.172063, -0.172024, -0.171793, -0.171341, -0.170672, -0.169813, -0.168858, -0.167937, -0.167065, -0.166291, -0.165639, -0.165134, -0.164655, -0.164206, -0.163871, -0.163555, -0.163194, -0.162789, -0.162366, -0.161847, -0.161241, -0.160654, -0.160159, -0.159849, -0.159766, -0.15989, -0.160156, -0.160447, -0.160659, -0.160699, -0.160514, -0.160086, -0.159495, -0.158817, -0.158045, -0.157327, -0.156743, -0.156276, -0.155842, -0.155503, -0.155215, -0.154987, -0.154822, -0.154679, -0.154523, -0.154351, -0.154081, -0.153706, -0.153305, -0.152991, -0.152817, -0.152861, -0.153126, -0.153633, -0.154265, -0.154814, -0.155263, -0.155524, -0.155542, -0.155368, -0.155106, -0.154717, -0.154301, -0.153939, -0.153596, -0.153369, -0.153299, -0.153325, -0.153337, -0.153324, -0.153282, -0.153151, -0.152911, -0.152552, -0.152108, -0.151646, -0.151209, -0.150915, -0.150903, -0.151215, -0.151802, -0.152506, -0.153197, -0.153742, -0.153982, -0.15393, -0.153687, -0.153299, -0.152834, -0.152374, -0.151972, -0.151646, -0.151433, -0.151374, -0.151478, -0.151673, -0.151935, -0.15224, -0.152573, -0.152884, -0.153135, -0.153321, -0.153419, -0.15349, -0.153599, -0.153818, -0.15424, -0.154916, -0.155816, -0.156812, -0.157742, -0.158452, -0.158919, -0.15915, -0.159219, -0.159203, -0.159177, -0.159217, -0.159284, -0.159451, -0.159776, -0.16025, -0.160864, -0.161559, -0.162267, -0.162901, -0.163435, -0.163865, -0.164175, -0.164388, -0.16447, -0.164518, -0.164658, -0.164964, -0.165553, -0.16634, -0.167211, -0.168096, -0.168901, -0.169475, -0.169787, -0.169946, -0.17002, -0.170032, -0.170014, -0.170067, -0.170205, -0.170424, -0.170692, -0.171027, -0.171423, -0.171864, -0.172268, -0.172536, -0.172624, -0.172599, -0.17246, -0.172275, -0.172102, -0.171998, -0.172034, -0.172248, -0.172718, -0.173355, -0.174038, -0.174719, -0.175312, -0.175757, -0.176025, -0.176147, -0.176209, -0.176251, -0.176326, -0.176492, -0.176769, -0.177155, -0.177627, -0.178115, -0.178589, -0.179082, -0.179428, -0.179551, -0.17953, -0.179375, -0.179117, -0.178879, -0.17879, -0.178937, -0.179328, -0.179964, -0.180793, -0.181743, -0.182785, -0.183757, -0.184602, -0.185284, -0.185801, -0.186164, -0.186469, -0.186783, -0.187192, -0.187708, -0.188327, -0.189052, -0.189813, -0.19052, -0.19117, -0.19172, -0.192187, -0.192514, -0.192715, -0.192845, -0.19293, -0.193019, -0.193268, -0.193793, -0.194581, -0.195552, -0.19654, -0.197428, -0.198113, -0.198629, -0.19894, -0.199076, -0.199126, -0.199152, -0.199237, -0.199508, -0.199974, -0.200575, -0.201249, -0.201971, -0.202736, -0.203521, -0.20428, -0.20499, -0.205625, -0.206169, -0.206666, -0.207141, -0.207682, -0.208381, -0.209258, -0.210358, -0.211715, -0.213267, -0.214795, -0.21614, -0.217282, -0.218166, -0.218794, -0.219272, -0.219647, -0.219942, -0.220242, -0.220585, -0.220949, -0.221378, -0.221931, -0.222494, -0.223053, -0.223573, -0.224033, -0.224433, -0.22471, -0.224943, -0.225164, -0.225438, -0.225815, -0.226426, -0.227326, -0.228545, -0.230009, -0.231621, -0.233204, -0.234631, -0.235776, -0.236627, -0.237232, -0.237621, -0.237856, -0.238017, -0.238233, -0.238573, -0.239014, -0.239515, -0.239995, -0.240481, -0.240961, -0.24137, -0.24168, -0.241868, -0.241977, -0.242069, -0.242135, -0.242237, -0.242466, -0.242919, -0.243644, -0.244598, -0.245674, -0.246782, -0.247845, -0.248699, -0.24929, -0.249739, -0.249995, -0.250153, -0.25033, -0.250535, -0.250752, -0.251076, -0.251486, -0.252004, -0.252609, -0.253142, -0.25362, -0.253967, -0.254144, -0.254153, -0.254012, -0.253832, -0.253679, -0.253549, -0.25355, -0.253714, -0.254087, -0.254634, -0.255252, -0.2558, -0.256136, -0.256208, -0.256053, -0.255689, -0.255186, -0.254626, -0.253981, -0.253376, -0.252731, -0.252098, -0.251564, -0.251134, -0.250749, -0.25028, -0.249709, -0.249032, -0.248102, -0.247045, -0.245887, -0.244702, -0.243573, -0.2426, -0.241866, -0.241362, -0.241025, -0.24081, -0.240568, -0.240133, -0.239485, -0.2386, -0.237499, -0.236218, -0.234878, -0.233601, -0.232395, -0.231266, -0.230208, -0.229242, -0.228237, -0.227192, -0.22612, -0.224965, -0.223756, -0.222473, -0.221122, -0.219697, -0.218223, -0.216857, -0.215693, -0.21474, -0.213989, -0.213428, -0.212964, -0.212451, -0.211825, -0.211086, -0.210185, -0.209173, -0.208124, -0.207052, -0.206068, -0.205219, -0.204463, -0.203881, -0.20342, -0.203041, -0.202727, -0.202337, -0.201832, -0.201197, -0.200391, -0.199493, -0.198462, -0.197279, -0.196107, -0.195096, -0.194295, -0.193665, -0.193349, -0.193238, -0.193178, -0.193031, -0.192704, -0.192095, -0.191202, -0.190122, -0.188891, -0.187601, -0.186382, -0.185342, -0.184421, -0.183644, -0.183008, -0.182438, -0.181864, -0.181304, -0.180675, -0.17996, -0.179144, -0.178349, -0.177533, -0.176742, -0.176111, -0.175711, -0.175556, -0.175676, -0.175978, -0.176403, -0.176789, -0.177006, -0.177019, -0.176811, -0.176457, -0.176008, -0.175564, -0.175037, -0.174483, -0.174055, -0.173718, -0.173478, -0.173252, -0.173089, -0.172952, -0.172781, -0.172508, -0.172119, -0.171606, -0.170953, -0.170346, -0.169833, -0.169429, -0.16929, -0.169486, -0.169928, -0.170637, -0.171433, -0.172209, -0.172737, -0.173014, -0.173092, -0.173076, -0.173119, -0.173193, -0.173321, -0.173498, -0.173762, -0.174107, -0.174464, -0.174771, -0.175063, -0.175324, -0.175492, -0.175538, -0.175484, -0.175309, -0.17503, -0.174723, -0.174517, -0.174566, -0.174925, -0.175491, -0.176261, -0.177147, -0.177973, -0.178636, -0.179014, -0.179119, -0.17902, -0.178745, -0.178451, -0.178194, -0.178074, -0.178147, -0.178355, -0.178641, -0.178963, -0.179135, -0.179286, -0.179305, -0.179212, -0.179024, -0.178717, -0.178321, -0.177923, -0.177628, -0.17754, -0.177646, -0.177974, -0.178494, -0.179104, -0.179735, -0.18018, -0.180399, -0.180377, -0.180117, -0.179684, -0.179165, -0.178769, -0.178462, -0.178312, -0.178298, -0.178394, -0.178563, -0.178636, -0.178635, -0.178503, -0.178208, -0.177771, -0.177239, -0.176642, -0.17599, -0.175361, -0.174841, -0.174488, -0.17433, -0.174381, -0.174579, -0.174838, -0.175065, -0.175102, -0.174888, -0.174474, -0.173972, -0.17342, -0.172894, -0.172471, -0.172057, -0.171785, -0.171587, -0.171415, -0.17125, -0.171061, -0.1708, -0.170488, -0.170026, -0.169424, -0.168715, -0.167972, -0.167332, -0.166914, -0.166692, -0.166711, -0.167014, -0.167556, -0.168217, -0.168823, -0.169285, -0.169545, -0.169598, -0.169491, -0.169334, -0.169253, -0.16926, -0.169413, -0.169739, -0.170199, -0.170727, -0.171226, -0.171662, -0.171948, -0.172005, -0.171907, -0.171574, -0.171054, -0.17046, -0.169831, -0.16934, -0.16906, -0.169053, -0.169307, -0.169804, -0.170416, -0.171018, -0.171586, -0.171908, -0.171969, -0.17185, -0.171615, -0.171321, -0.171105, -0.171028, -0.171077, -0.171286, -0.171611, -0.171949, -0.172233, -0.172387, -0.172405, -0.172289, -0.17203, -0.17169, -0.171333, -0.170979, -0.170672, -0.170534, -0.170591, -0.170935, -0.171497, -0.172258, -0.173045, -0.173728, -0.174221, -0.174496, -0.174577, -0.174495, -0.174424, -0.174468, -0.174609, -0.174873, -0.175281, -0.17576, -0.176303, -0.176821, -0.177251, -0.177622, -0.177861, -0.17799, -0.17803, -0.17799, -0.177906, -0.177852, -0.177907, -0.178111, -0.178533, -0.179169, -0.17998, -0.180919, -0.181903, -0.182716, -0.183217, -0.183371, -0.183315, -0.183109, -0.182804, -0.182515, -0.182393, -0.182401, -0.182553, -0.18284, -0.183071, -0.183234, -0.183357, -0.183444, -0.183305, -0.183086, -0.182841, -0.182552, -0.182262, -0.182035, -0.181978, -0.182096, -0.182509, -0.183032, -0.18372, -0.184437, -0.185036, -0.185419, -0.185553, -0.18541, -0.185056, -0.184596, -0.184171, -0.183878, -0.183719, -0.183672, -0.183713, -0.183749, -0.183676, -0.183483, -0.183118, -0.182598, -0.181909, -0.181105, -0.180183, -0.17927, -0.178357, -0.177575, -0.176979, -0.176527, -0.17629, -0.17622, -0.176249, -0.176222, -0.17594, -0.175467, -0.174677, -0.173584, -0.172398, -0.171152, -0.169978, -0.168986, -0.168191, -0.167433, -0.166727, -0.165992, -0.165169, -0.16419, -0.163027, -0.161814, -0.160471, -0.15903, -0.157574, -0.15622, -0.154978, -0.153905, -0.153029, -0.15241, -0.151989, -0.151753, -0.151531, -0.151179, -0.150706, -0.150091, -0.149313, -0.1484, -0.147481, -0.146711, -0.146091, -0.145542, -0.145124, -0.144766, -0.144369, -0.14393, -0.143346, -0.14265, -0.141831, -0.1409, -0.139865, -0.138784, -0.137758, -0.136746, -0.135829, -0.135082, -0.134513, -0.134118, -0.133843, -0.133521, -0.133132, -0.132565, -0.13176, -0.130723, -0.129577, -0.128366, -0.127242, -0.126329, -0.125582, -0.124965, -0.124469, -0.124027, -0.123503, -0.122901, -0.122116, -0.121288, -0.12033, -0.119342, -0.118298, -0.117225, -0.116349, -0.115546, -0.11493, -0.114564, -0.114428, -0.114464, -0.1145, -0.114524, -0.114343, -0.113936, -0.11325, -0.11245, -0.111582, -0.110791, -0.110178, -0.109817, -0.109534, -0.109389, -0.109272, -0.109198, -0.109077, -0.108868, -0.108527, -0.108039, -0.107404, -0.10672, -0.105979, -0.105242, -0.104692, -0.104305, -0.104095, -0.104149, -0.104504, -0.105042, -0.105558, -0.105938, -0.10607, -0.105978, -0.105725, -0.105381, -0.105061, -0.104817, -0.104729, -0.104803, -0.104998, -0.105328, -0.105665, -0.105957, -0.106159, -0.10618, -0.105962, -0.10558, -0.105077, -0.104573, -0.104133, -0.103768, -0.103581, -0.103664, -0.104058, -0.104699, -0.105529, -0.106355, -0.107038, -0.107431, -0.107512, -0.107392, -0.107187, -0.106984, -0.106885, -0.106991, -0.107263, -0.107648, -0.108025, -0.108269, -0.10847, -0.10856, -0.108468, -0.108199, -0.107791, -0.1073, -0.106752, -0.106215, -0.105745, -0.105393, -0.105322, -0.105507, -0.105835, -0.106254, -0.106811, -0.107355, -0.107767, -0.107899, -0.107773, -0.107512, -0.107271, -0.107081, -0.107111, -0.107389, -0.107761, -0.10821, -0.108627, -0.108952, -0.109203, -0.109314, -0.109267, -0.109045, -0.108744, -0.108378, -0.107994, -0.107598, -0.107322, -0.107253, -0.107367, -0.107713, -0.108271, -0.108922, -0.109558, -0.110103, -0.110418, -0.110499, -0.110373, -0.110105, -0.109901, -0.109904, -0.110078, -0.11037, -0.110784, -0.111227, -0.111596, -0.111856, -0.11194, -0.111852, -0.111581, -0.111149, -0.110585, -0.110003, -0.109369, -0.108812, -0.108432, -0.108292, -0.108322, -0.108494, -0.10875, -0.109017, -0.109215, -0.109276, -0.109131, -0.108812, -0.108355, -0.10784, -0.107395, -0.10713, -0.107099, -0.107236, -0.107432, -0.107589, -0.107648, -0.107579, -0.107294, -0.106813, -0.106123, -0.105249, -0.104413, -0.103631, -0.102983, -0.102549, -0.102273, -0.102255, -0.102474, -0.102823, -0.103203, -0.10352, -0.103707, -0.103698, -0.103473, -0.103087, -0.102659, -0.102323, -0.10214, -0.102171, -0.102442, -0.102839, -0.103251, -0.10355, -0.103725, -0.103687, -0.103388, -0.102924, -0.102323, -0.101672, -0.101018, -0.100392, -0.099881, -0.099554, -0.099456, -0.099555, -0.099802, -0.100181, -0.10057, -0.100772, -0.100777, -0.100574, -0.100188, -0.099742, -0.099329, -0.099051, -0.098975, -0.099062, -0.099241, -0.099515, -0.099808, -0.100029, -0.100084, -0.099961, -0.099614, -0.099102, -0.098513, -0.097947, -0.097407, -0.09692, -0.096584, -0.096433, -0.096562, -0.096902, -0.097427, -0.097991, -0.098476, -0.098803, -0.098898, -0.098694, -0.098323, -0.097935, -0.097564, -0.09729, -0.09718, -0.09723, -0.097358, -0.097496, -0.097581, -0.097568, -0.097415, -0.097187, -0.096913, -0.09651, -0.096024, -0.095577, -0.09518, -0.094876, -0.094798, -0.094996, -0.095463, -0.096061, -0.096762, -0.0974, -0.097888, -0.098186, -0.098269, -0.098158, -0.097932, -0.097757, -0.097703, -0.097773, -0.097968, -0.098237, -0.098482, -0.09864, -0.098619, -0.098336, -0.097762, -0.096921, -0.095895, -0.094797, -0.093639, -0.092584, -0.091647, -0.090799, -0.090146, -0.089689, -0.089343, -0.089096, -0.088862, -0.088518, -0.087942, -0.087086, -0.085991, -0.084739, -0.083498, -0.082439, -0.0816, -0.080899, -0.08031, -0.079752, -0.079124, -0.078304, -0.077346, -0.076193, -0.074825, -0.073364, -0.071805, -0.07021, -0.068659, -0.067249, -0.06597, -0.064935, -0.064148, -0.063556, -0.063052, -0.062596, -0.062042, -0.061306, -0.060298, -0.059116, -0.057831, -0.05644, -0.055266, -0.054285, -0.053539, -0.052891, -0.052313, -0.051661, -0.05092, -0.049993, -0.048868, -0.047605, -0.046211, -0.044748, -0.043317, -0.041879, -0.040444, -0.039191, -0.038198, -0.037348, -0.036759, -0.036258, -0.035827, -0.035307, -0.034753, -0.033963, -0.032998, -0.031901, -0.030814, -0.029867, -0.029136, -0.028639, -0.028307, -0.027996, -0.027616, -0.027084, -0.026369, -0.025361, -0.024215, -0.022818, -0.021413, -0.020001, -0.018713, -0.017448, -0.016292, -0.015354, -0.014637, -0.014129, -0.013796, -0.013627, -0.013468, -0.013249, -0.012896, -0.012396, -0.011721, -0.011014, -0.010435, -0.009962, -0.009801, -0.009909, -0.010209, -0.010558, -0.010873, -0.010991, -0.010909, -0.010526, -0.010004, -0.009261, -0.008448, -0.007574, -0.006687, -0.005983, -0.005447, -0.005097, -0.004968, -0.004966, -0.005097, -0.005314, -0.005398, -0.005334, -0.005058, -0.004569, -0.004057, -0.003592, -0.00323, -0.003071, -0.003183, -0.003543, -0.0041, -0.004691, -0.005196, -0.005502, -0.005588, -0.005435, -0.00519, -0.004918, -0.004651, -0.004561, -0.004593, -0.004777, -0.005153, -0.00572, -0.006512, -0.007471, -0.008396, -0.009246, -0.009884, -0.010211, -0.010332, -0.010314, -0.010196, -0.010193, -0.010424, -0.010947, -0.011805, -0.012825, -0.013814, -0.014732, -0.015451, -0.015944, -0.016252, -0.016233, -0.016032, -0.015789, -0.015538, -0.015354, -0.015321, -0.015451, -0.015859, -0.016414, -0.017043, -0.017891, -0.018667, -0.019277, -0.019683, -0.019811, -0.019742, -0.019523, -0.0193, -0.019225, -0.01932, -0.01959, -0.020032, -0.020433, -0.02082, -0.02103, -0.021051, -0.020855, -0.020484, -0.01998, -0.019368, -0.018702, -0.0181, -0.017644, -0.017287, -0.017111, -0.017086, -0.017306, -0.017553, -0.017792, -0.017971, -0.018082, -0.018099, -0.017914, -0.017611, -0.017377, -0.017257, -0.017482, -0.017921, -0.018455, -0.019003, -0.019489, -0.019875, -0.019938, -0.019863, -0.019511, -0.019039, -0.018531, -0.017991, -0.017501, -0.017133, -0.016964, -0.016951, -0.017082, -0.017212, -0.017391, -0.017546, -0.017711, -0.017749, -0.017552, -0.017143, -0.01676, -0.016176, -0.015631, -0.015279, -0.015197, -0.015411, -0.0157, -0.015886, -0.01599, -0.015891, -0.015661, -0.015232, -0.014625, -0.013909, -0.013126, -0.012397, -0.01188, -0.011506, -0.011279, -0.011188, -0.011239, -0.011455, -0.0118, -0.012133, -0.012408, -0.012456, -0.012338, -0.012055, -0.011685, -0.011355, -0.011319, -0.011576, -0.012153, -0.012955, -0.013729, -0.0145, -0.015146, -0.015559, -0.015652, -0.015506, -0.015282, -0.015116, -0.014854, -0.014687, -0.014672, -0.014926, -0.015372, -0.016008, -0.016775, -0.017621, -0.018407, -0.019096, -0.019604, -0.019904, -0.020118, -0.020075, -0.020033, -0.020124, -0.02049, -0.021156, -0.022002, -0.022975, -0.02389, -0.02468, -0.02523, -0.02544, -0.025377, -0.025194, -0.024874, -0.024602, -0.024406, -0.024356, -0.024461, -0.024763, -0.025225, -0.025846, -0.026527, -0.02722, -0.027876, -0.028422, -0.028828, -0.029029, -0.029033, -0.028985, -0.029001, -0.029251, -0.029761, -0.030625, -0.0316, -0.032566, -0.033349, -0.033958, -0.034265, -0.034381, -0.034268, -0.034064, -0.033827, -0.033624, -0.033493, -0.033548, -0.033802, -0.034265, -0.034857, -0.035457, -0.036145, -0.036814, -0.037334, -0.03778, -0.037949, -0.038083, -0.038143, -0.038368, -0.038838, -0.039535, -0.040524, -0.041782, -0.043101, -0.044309, -0.045267, -0.045953, -0.046278, -0.046388, -0.046231, -0.045975, -0.04567, -0.045352, -0.045087, -0.044941, -0.044995, -0.045173, -0.045439, -0.045772, -0.046023, -0.046192, -0.046171, -0.04593, -0.045432, -0.044909, -0.044427, -0.044057, -0.043937, -0.044016, -0.04432, -0.044584, -0.044784, -0.044822, -0.044656, -0.044259, -0.043575, -0.042784, -0.041966, -0.041144, -0.040343, -0.039597, -0.038978, -0.038446, -0.038089, -0.037746, -0.037495, -0.037268, -0.03703, -0.036653, -0.036142, -0.035405, -0.034445, -0.033488, -0.03261, -0.031861, -0.031416, -0.031159, -0.030965, -0.030663, -0.030311, -0.029721, -0.028973, -0.027802, -0.02661, -0.025335, -0.024021, -0.02285, -0.021808, -0.020975, -0.020425, -0.02003, -0.019775, -0.019597, -0.019369, -0.019101, -0.018724, -0.018142, -0.017385, -0.016493, -0.015564, -0.014791, -0.014191, -0.013893, -0.013875, -0.014032, -0.014213, -0.014168, -0.01391, -0.013445, -0.012715, -0.011719, -0.010559, -0.009381, -0.008241, -0.007151, -0.006248, -0.005554, -0.00499, -0.004603, -0.004258, -0.003827, -0.003363, -0.002813, -0.00213, -0.00125, -0.000246, 0.00077, 0.001708, 0.002462, 0.002864, 0.002823, 0.002591, 0.002168, 0.001864, 0.00177, 0.002042, 0.002676, 0.003463, 0.004384, 0.005365, 0.006327, 0.007284, 0.00797, 0.008569, 0.008882, 0.009124, 0.009241, 0.009296, 0.009418, 0.009694, 0.01008, 0.01054, 0.011189, 0.011927, 0.012703, 0.013336, 0.013754, 0.013901, 0.01359, 0.013041, 0.01231, 0.011703, 0.01135, 0.011304, 0.01158, 0.012088, 0.012715, 0.013392, 0.013937, 0.014338, 0.014629, 0.014676, 0.014475, 0.014277, 0.013955, 0.013621, 0.013395, 0.013294, 0.013357, 0.013607, 0.013918, 0.014216, 0.014443, 0.014507, 0.014275, 0.013742, 0.013035, 0.012205, 0.011464, 0.011002, 0.010884, 0.011011, 0.011318, 0.01173, 0.012255, 0.012709, 0.013009, 0.0131, 0.013039, 0.012755, 0.012422, 0.01195, 0.011396, 0.010924, 0.010607, 0.010431, 0.010492, 0.010635, 0.01083, 0.011103, 0.011294, 0.011254, 0.011098, 0.010727, 0.010315, 0.009827, 0.009539, 0.009354, 0.009494, 0.009848, 0.010367, 0.010983};
 
 // https://maia.usno.navy.mil/ser7/tai-utc.dat
-double vLEAP_JDS[] = {2441317.5, 2441499.5, 2441683.5, 2442048.5, 2442413.5, 2442778.5, 2443144.5, 2443509.5, 2443874.5, 2444239.5, 2444786.5, 2445151.5, 2445516.5, 2446247.5, 2447161.5, 2447892.5, 2448257.5, 2448804.5, 2449169.5, 2449534.5, 2450083.5, 2450630.5, 2451179.5, 2453736.5, 2454832.5, 2456109.5, 2457204.5, 2457754.5};
-double vTAI_MINUS_UTC[] = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37};
-
-double TT_MINUS_TAI = 32.184;
-
-Eigen::VectorXd PL = Eigen::Map<Eigen::VectorXd>(vPL, sizeof(vPL) / sizeof(vPL[0]));
-Eigen::VectorXd PLPRIME = Eigen::Map<Eigen::VectorXd>(vPLPRIME, sizeof(vPLPRIME) / sizeof(vPLPRIME[0]));
-Eigen::VectorXd PF = Eigen::Map<Eigen::VectorXd>(vPF, sizeof(vPF) / sizeof(vPF[0]));
-Eigen::VectorXd PD = Eigen::Map<Eigen::VectorXd>(vPD, sizeof(vPD) / sizeof(vPD[0]));
-Eigen::VectorXd POMEGA = Eigen::Map<Eigen::VectorXd>(vPOMEGA, sizeof(vPOMEGA) / sizeof(vPOMEGA[0]));
-Eigen::VectorXd P6 = Eigen::Map<Eigen::VectorXd>(vP6, sizeof(vP6) / sizeof(vP6[0]));
-Eigen::VectorXd P7 = Eigen::Map<Eigen::VectorXd>(vP7, sizeof(vP7) / sizeof(vP7[0]));
-Eigen::VectorXd P8 = Eigen::Map<Eigen::VectorXd>(vP8, sizeof(vP8) / sizeof(vP8[0]));
-Eigen::VectorXd P9 = Eigen::Map<Eigen::VectorXd>(vP9, sizeof(vP9) / sizeof(vP9[0]));
+const double vLEAP_JDS[] = {2441317.5, 2441499.5, 2441683.5, 2442048.5, 2442413.5, 2442778.5, 2443144.5, 2443509.5, 2443874.5, 2444239.5, 2444786.5, 2445151.5, 2445516.5, 2446247.5, 2447161.5, 2447892.5, 2448257.5, 2448804.5, 2449169.5, 2449534.5, 2450083.5, 2450630.5, 2451179.5, 2453736.5, 2454832.5, 2456109.5, 2457204.5, 2457754.5};
+const double vTAI_MINUS_UTC[] = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37};
 
-Eigen::VectorXd LEAP_JDS = Eigen::Map<Eigen::VectorXd>(vLEAP_JDS, sizeof(vLEAP_JDS) / sizeof(vLEAP_JDS[0]));
-Eigen::VectorXd TAI_MINUS_UTC = Eigen::Map<Eigen::VectorXd>(vTAI_MINUS_UTC, sizeof(vTAI_MINUS_UTC) / sizeof(vTAI_MINUS_UTC[0]));
\ No newline at end of file
+const double TT_MINUS_TAI = 32.184;
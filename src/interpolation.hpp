@@ -0,0 +1,176 @@
+#pragma once
+#ifdef _MSC_VER
+    #define _USE_MATH_DEFINES // For MS Visual Studio
+    #include <math.h>
+#else
+    #include <cmath>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+// Chebyshev interpolation of slowly varying quantities (nutation, precession) over dense epoch grids.
+//
+// The quantities are fit piecewise in T on segments a few days long, then the fit is compared with the exact
+// function at the extrema of the Chebyshev polynomial between the nodes, where the interpolation error peaks.
+// Segments that miss the tolerance are halved and fit again. If the fit costs more exact evaluations than
+// evaluating every epoch directly would save, it is abandoned and the caller takes the exact path.
+
+// Largest interpolation error allowed [rad], 0 (the default) always takes the exact path
+std::atomic<double> INTERPOLATION_TOLERANCE(0.0);
+
+void set_interpolation_tolerance(double tolerance) {
+    INTERPOLATION_TOLERANCE = std::max(tolerance, 0.0);
+}
+
+double get_interpolation_tolerance() {
+    return INTERPOLATION_TOLERANCE;
+}
+
+const int CHEBYSHEV_NODES = 12;
+const double CHEBYSHEV_SEGMENT = 4.0 / 36525.0; // initial segment length [julian centuries]
+const int CHEBYSHEV_MAX_SPLITS = 16;
+
+template <int n_values>
+class ChebyshevSeries {
+    private:
+        struct Segment {
+            double t0;
+            double t1;
+            double coeffs[n_values][CHEBYSHEV_NODES];
+        };
+
+        std::vector<Segment> segments_;
+        int n_exact_evaluations_ = 0;
+        bool valid_ = false;
+
+        // value k of a segment at x in [-1, 1], by Clenshaw's recurrence
+        static double clenshaw(const double* c, double x) {
+            double b1 = 0.0;
+            double b2 = 0.0;
+            for (int k = CHEBYSHEV_NODES - 1; k > 0; k--) {
+                double b0 = 2.0 * x * b1 - b2 + c[k];
+                b2 = b1;
+                b1 = b0;
+            }
+            return x * b1 - b2 + c[0];
+        }
+
+        template <typename Fn>
+        bool fit(double t0, double t1, int depth, double tolerance, int max_evaluations, const Fn& exact) {
+            const int n_checks = CHEBYSHEV_NODES + 1;
+            double t[CHEBYSHEV_NODES + n_checks];
+            double values[n_values][CHEBYSHEV_NODES + n_checks];
+            double* columns[n_values];
+            for (int k = 0; k < n_values; k++) {
+                columns[k] = values[k];
+            }
+            double mid = 0.5 * (t0 + t1);
+            double half = 0.5 * (t1 - t0);
+            for (int j = 0; j < CHEBYSHEV_NODES; j++) {
+                t[j] = mid + half * cos(M_PI * (j + 0.5) / CHEBYSHEV_NODES);
+            }
+            for (int j = 0; j < n_checks; j++) {
+                t[CHEBYSHEV_NODES + j] = mid + half * cos(M_PI * j / CHEBYSHEV_NODES);
+            }
+            n_exact_evaluations_ += CHEBYSHEV_NODES + n_checks;
+            if (n_exact_evaluations_ > max_evaluations) {
+                return false;
+            }
+            exact(t, CHEBYSHEV_NODES + n_checks, columns);
+
+            double basis[CHEBYSHEV_NODES][CHEBYSHEV_NODES];
+            for (int m = 0; m < CHEBYSHEV_NODES; m++) {
+                for (int j = 0; j < CHEBYSHEV_NODES; j++) {
+                    basis[m][j] = cos(M_PI * m * (j + 0.5) / CHEBYSHEV_NODES);
+                }
+            }
+            Segment segment;
+            segment.t0 = t0;
+            segment.t1 = t1;
+            for (int k = 0; k < n_values; k++) {
+                for (int m = 0; m < CHEBYSHEV_NODES; m++) {
+                    double sum = 0.0;
+                    for (int j = 0; j < CHEBYSHEV_NODES; j++) {
+                        sum += values[k][j] * basis[m][j];
+                    }
+                    segment.coeffs[k][m] = (m == 0 ? 1.0 : 2.0) * sum / CHEBYSHEV_NODES;
+                }
+            }
+
+            double max_error = 0.0;
+            for (int j = 0; j < n_checks; j++) {
+                double x = cos(M_PI * j / CHEBYSHEV_NODES);
+                for (int k = 0; k < n_values; k++) {
+                    max_error = std::max(max_error, std::abs(clenshaw(segment.coeffs[k], x) - values[k][CHEBYSHEV_NODES + j]));
+                }
+            }
+            if (max_error <= tolerance) {
+                segments_.push_back(segment);
+                return true;
+            }
+            if (depth >= CHEBYSHEV_MAX_SPLITS) {
+                return false;
+            }
+            return fit(t0, mid, depth + 1, tolerance, max_evaluations, exact) && fit(mid, t1, depth + 1, tolerance, max_evaluations, exact);
+        }
+
+        int find_segment(double t) const {
+            int s = static_cast<int>(std::upper_bound(segments_.begin(), segments_.end(), t,
+                [](double value, const Segment& segment) { return value < segment.t1; }) - segments_.begin());
+            return std::min(s, static_cast<int>(segments_.size()) - 1);
+        }
+
+    public:
+        // Fits exact(const double* T, int n, double* const* columns), which fills n_values columns for n epochs,
+        // over [t_min, t_max] using at most max_evaluations calls' worth of epochs
+        template <typename Fn>
+        ChebyshevSeries(double t_min, double t_max, double tolerance, int max_evaluations, const Fn& exact) {
+            if (!(t_max > t_min) || !(tolerance > 0.0)) {
+                return;
+            }
+            int n_segments = std::max(1, static_cast<int>(ceil((t_max - t_min) / CHEBYSHEV_SEGMENT)));
+            if (n_segments * (2 * CHEBYSHEV_NODES + 1) > max_evaluations) {
+                return;
+            }
+            double length = (t_max - t_min) / n_segments;
+            valid_ = true;
+            for (int s = 0; s < n_segments && valid_; s++) {
+                double t1 = s == n_segments - 1 ? t_max : t_min + (s + 1) * length;
+                valid_ = fit(t_min + s * length, t1, 0, tolerance, max_evaluations, exact);
+            }
+        }
+
+        // false if the tolerance could not be met within the evaluation budget
+        bool valid() const { return valid_; }
+        int n_segments() const { return segments_.size(); }
+        int n_exact_evaluations() const { return n_exact_evaluations_; }
+
+        // Fills n_values columns for n epochs inside the fitted range. Consecutive epochs that share a segment are
+        // evaluated together, one value at a time, so the recurrences of neighbouring epochs overlap.
+        void evaluate(const double* T, int n, double* const* columns) const {
+            const int block = 64;
+            double x[block];
+            int s = 0;
+            for (int start = 0; start < n;) {
+                if (T[start] < segments_[s].t0 || T[start] > segments_[s].t1) {
+                    s = find_segment(T[start]);
+                }
+                const Segment& segment = segments_[s];
+                double scale = 2.0 / (segment.t1 - segment.t0);
+                double offset = (segment.t0 + segment.t1) / (segment.t1 - segment.t0);
+                int b = 0;
+                do {
+                    x[b] = T[start + b] * scale - offset;
+                    b++;
+                } while (start + b < n && b < block && T[start + b] >= segment.t0 && T[start + b] <= segment.t1);
+                for (int k = 0; k < n_values; k++) {
+                    double* out = columns[k] + start;
+                    for (int e = 0; e < b; e++) {
+                        out[e] = clenshaw(segment.coeffs[k], x[e]);
+                    }
+                }
+                start += b;
+            }
+        }
+};
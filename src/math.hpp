@@ -1,3 +1,4 @@
+#pragma once
 #ifdef _MSC_VER
     #define _USE_MATH_DEFINES // For MS Visual Studio
     #include <math.h>
@@ -6,6 +7,8 @@
 #endif
 #include "Eigen/Eigen"
 
+const double RAD_TO_ARCSECOND = 180.0 * 3600.0 / M_PI;
+
 Eigen::MatrixXd eye(int n) {
     return Eigen::MatrixXd::Identity(n, n);
 }
@@ -56,26 +59,37 @@ Eigen::VectorXd rad_to_deg(Eigen::VectorXd rad) {
     return rad * 180.0 / M_PI;
 }
 
-Eigen::MatrixXd r1(double theta) {
-    Eigen::MatrixXd R(3, 3);
-    R << 1, 0, 0,
-         0, cos(theta), sin(theta),
-         0, -sin(theta), cos(theta);
+// elementary frame rotation by theta about the given axis (1 = x, 2 = y, 3 = z), fixed size so nothing is heap allocated
+template <int axis>
+Eigen::Matrix3d rotation(double theta) {
+    static_assert(axis >= 1 && axis <= 3, "rotation axis must be 1, 2 or 3");
+    double c = cos(theta);
+    double s = sin(theta);
+    Eigen::Matrix3d R;
+    if constexpr (axis == 1) {
+        R << 1, 0, 0,
+             0, c, s,
+             0, -s, c;
+    } else if constexpr (axis == 2) {
+        R << c, 0, -s,
+             0, 1, 0,
+             s, 0, c;
+    } else {
+        R << c, s, 0,
+             -s, c, 0,
+             0, 0, 1;
+    }
     return R;
 }
 
-Eigen::MatrixXd r2(double theta) {
-    Eigen::MatrixXd R(3, 3);
-    R << cos(theta), 0, -sin(theta),
-         0, 1, 0,
-         sin(theta), 0, cos(theta);
-    return R;
+Eigen::Matrix3d r1(double theta) {
+    return rotation<1>(theta);
 }
 
-Eigen::MatrixXd r3(double theta) {
-    Eigen::MatrixXd R(3, 3);
-    R << cos(theta), sin(theta), 0,
-         -sin(theta), cos(theta), 0,
-         0, 0, 1;
-    return R;
-}
\ No newline at end of file
+Eigen::Matrix3d r2(double theta) {
+    return rotation<2>(theta);
+}
+
+Eigen::Matrix3d r3(double theta) {
+    return rotation<3>(theta);
+}
@@ -0,0 +1,219 @@
+#pragma once
+#ifdef _MSC_VER
+    #define _USE_MATH_DEFINES // For MS Visual Studio
+    #include <math.h>
+#else
+    #include <cmath>
+#endif
+#include <algorithm>
+#include <array>
+#include "math.hpp"
+#include "dispatch.hpp"
+#include "iau1980.hpp"
+#include "profile.hpp"
+
+// Batch evaluation of the IAU1980 nutation series.
+//
+// Every term's argument is an integer combination of the five fundamental arguments (l, l', F, D, Omega),
+// so instead of 2 * 106 sin/cos calls per epoch we take sin/cos of the five arguments once and build each
+// term's phase from precomputed multiples with the angle addition formulas. Epochs are processed in fixed
+// size blocks held on the stack: the inner loops run over the epoch dimension so the compiler can vectorize
+// them, and nothing is allocated per epoch.
+
+const int NUTATION_BLOCK = 32;
+constexpr int NUTATION_N_TERMS = sizeof(IAU1980_TERMS) / sizeof(IAU1980_TERMS[0]);
+constexpr double NUTATION_COEFF_TO_RAD = M_PI / 180.0 / 3600e4; // coefficients are in units of 0.0001 arcseconds
+
+// Number of leading series terms summed by delta_psi_delta_epsilon(). Dropping the others costs at most the sum
+// of their amplitudes, for the usual truncations
+//     106 terms (all)  exact
+//      13 terms        0.088" in delta psi, 0.030" in delta epsilon
+//       4 terms        0.49" in delta psi, 0.11" in delta epsilon
+#ifndef SIDEREAL_NUTATION_TERMS
+    #define SIDEREAL_NUTATION_TERMS 106
+#endif
+
+// A series term as evaluated: the fundamental arguments with a nonzero multiplier, and the amplitudes in radians
+struct NutationTerm {
+    int n_factors;
+    int8_t argument[5];
+    int8_t multiple[5];
+    double psi;
+    double eps;
+    bool has_rate;
+    double psi_rate;
+    double eps_rate;
+};
+
+constexpr std::array<NutationTerm, NUTATION_N_TERMS> nutation_terms() {
+    std::array<NutationTerm, NUTATION_N_TERMS> terms = {};
+    for (int i = 0; i < NUTATION_N_TERMS; i++) {
+        for (int j = 0; j < 5; j++) {
+            if (IAU1980_TERMS[i].multipliers[j] != 0) {
+                terms[i].argument[terms[i].n_factors] = j;
+                terms[i].multiple[terms[i].n_factors] = IAU1980_TERMS[i].multipliers[j];
+                terms[i].n_factors++;
+            }
+        }
+        terms[i].psi = IAU1980_TERMS[i].psi * NUTATION_COEFF_TO_RAD;
+        terms[i].eps = IAU1980_TERMS[i].eps * NUTATION_COEFF_TO_RAD;
+    }
+    for (const Iau1980Rate& rate : IAU1980_RATES) {
+        terms[rate.term].has_rate = true;
+        terms[rate.term].psi_rate = rate.psi * NUTATION_COEFF_TO_RAD;
+        terms[rate.term].eps_rate = rate.eps * NUTATION_COEFF_TO_RAD;
+    }
+    return terms;
+}
+
+constexpr std::array<NutationTerm, NUTATION_N_TERMS> NUTATION_TERMS = nutation_terms();
+
+// whether any of the first n_terms terms depends on fundamental argument j
+constexpr bool nutation_uses_argument(int n_terms, int j) {
+    for (int i = 0; i < n_terms; i++) {
+        if (IAU1980_TERMS[i].multipliers[j] != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// largest |multiplier| among the first n_terms terms
+constexpr int nutation_max_multiple(int n_terms) {
+    int max_multiple = 0;
+    for (int i = 0; i < n_terms; i++) {
+        for (int f = 0; f < NUTATION_TERMS[i].n_factors; f++) {
+            int k = NUTATION_TERMS[i].multiple[f];
+            max_multiple = std::max(max_multiple, k < 0 ? -k : k);
+        }
+    }
+    return max_multiple;
+}
+
+void nutation_fundamental_arguments(double T, double args[5]) {
+    double days_since_j2k = 36525.0 * T;
+    args[0] = 2 * M_PI * (0.374897 + 0.03629164709 * days_since_j2k); // l
+    args[1] = 2 * M_PI * (0.993126 + 0.00273777850 * days_since_j2k); // lprime
+    args[2] = (335779.526232 + T * (1739527262.8478 + T * (-12.7512 + T * (-0.001037 + T * 0.00000417)))) / RAD_TO_ARCSECOND; // F
+    args[3] = (1072260.70369 + T * (1602961601.2090 + T * (-6.3706 + T * (0.00693 - T * 0.00003169)))) / RAD_TO_ARCSECOND; // D
+    args[4] = (450160.398036 + T * (-6962890.5431 + T * (7.4722 + T * (0.007702 - T * 0.00005939)))) / RAD_TO_ARCSECOND; // Omega
+}
+
+// Adds one series term to the block, its phase being the product of n_factors unit complex numbers.
+// The factor count is a template parameter so the whole product stays in registers.
+template <int n_factors, bool has_rate>
+void nutation_accumulate_term(const double* const* ck, const double* const* sk, const double* T, int b,
+                              const NutationTerm& term, double* dpsi, double* deps) {
+    for (int e = 0; e < b; e++) {
+        double cos_phi = ck[0][e];
+        double sin_phi = sk[0][e];
+        for (int f = 1; f < n_factors; f++) {
+            double c = cos_phi * ck[f][e] - sin_phi * sk[f][e];
+            sin_phi = sin_phi * ck[f][e] + cos_phi * sk[f][e];
+            cos_phi = c;
+        }
+        if (has_rate) {
+            dpsi[e] += (term.psi + T[e] * term.psi_rate) * sin_phi;
+            deps[e] += (term.eps + T[e] * term.eps_rate) * cos_phi;
+        } else {
+            dpsi[e] += term.psi * sin_phi;
+            deps[e] += term.eps * cos_phi;
+        }
+    }
+}
+
+template <bool has_rate>
+void nutation_add_term(const double* const* ck, const double* const* sk, const double* T, int b,
+                       const NutationTerm& term, double* dpsi, double* deps) {
+    switch (term.n_factors) {
+        case 1: nutation_accumulate_term<1, has_rate>(ck, sk, T, b, term, dpsi, deps); break;
+        case 2: nutation_accumulate_term<2, has_rate>(ck, sk, T, b, term, dpsi, deps); break;
+        case 3: nutation_accumulate_term<3, has_rate>(ck, sk, T, b, term, dpsi, deps); break;
+        case 4: nutation_accumulate_term<4, has_rate>(ck, sk, T, b, term, dpsi, deps); break;
+        default: nutation_accumulate_term<5, has_rate>(ck, sk, T, b, term, dpsi, deps); break;
+    }
+}
+
+// Fills delta_psi and delta_eps [rad] for n epochs given in julian centuries of TT since J2000, summing the first
+// n_terms terms of the series. Only the arguments and multiples those terms use are computed.
+template <int n_terms>
+void delta_psi_delta_epsilon(const double* T, int n, double* delta_psi, double* delta_eps) {
+    static_assert(n_terms > 0 && n_terms <= NUTATION_N_TERMS, "the IAU1980 series has 106 terms");
+    PROFILE_SCOPE("nutation.series", n);
+    constexpr int max_multiple = nutation_max_multiple(n_terms);
+    constexpr int n_multiples = 2 * max_multiple + 1;
+    constexpr bool uses_argument[5] = {nutation_uses_argument(n_terms, 0), nutation_uses_argument(n_terms, 1),
+                                       nutation_uses_argument(n_terms, 2), nutation_uses_argument(n_terms, 3),
+                                       nutation_uses_argument(n_terms, 4)};
+
+    // cos/sin of k * argument for k in [-max_multiple, max_multiple], per epoch in the block
+    double cos_k[5][n_multiples][NUTATION_BLOCK];
+    double sin_k[5][n_multiples][NUTATION_BLOCK];
+    double dpsi[NUTATION_BLOCK];
+    double deps[NUTATION_BLOCK];
+
+    for (int start = 0; start < n; start += NUTATION_BLOCK) {
+        int b = std::min(NUTATION_BLOCK, n - start);
+        const double* Tb = T + start;
+
+        for (int e = 0; e < b; e++) {
+            double args[5];
+            nutation_fundamental_arguments(Tb[e], args);
+            for (int j = 0; j < 5; j++) {
+                if (!uses_argument[j]) {
+                    continue;
+                }
+                double c = cos(args[j]);
+                double s = sin(args[j]);
+                cos_k[j][max_multiple][e] = 1.0;
+                sin_k[j][max_multiple][e] = 0.0;
+                for (int k = 1; k <= max_multiple; k++) {
+                    double ck = cos_k[j][max_multiple + k - 1][e];
+                    double sk = sin_k[j][max_multiple + k - 1][e];
+                    cos_k[j][max_multiple + k][e] = ck * c - sk * s;
+                    sin_k[j][max_multiple + k][e] = sk * c + ck * s;
+                    cos_k[j][max_multiple - k][e] = cos_k[j][max_multiple + k][e];
+                    sin_k[j][max_multiple - k][e] = -sin_k[j][max_multiple + k][e];
+                }
+            }
+        }
+
+        for (int e = 0; e < b; e++) {
+            dpsi[e] = 0.0;
+            deps[e] = 0.0;
+        }
+
+        for (int i = 0; i < n_terms; i++) {
+            const NutationTerm& term = NUTATION_TERMS[i];
+            const double* ck[5];
+            const double* sk[5];
+            for (int f = 0; f < term.n_factors; f++) {
+                ck[f] = cos_k[term.argument[f]][max_multiple + term.multiple[f]];
+                sk[f] = sin_k[term.argument[f]][max_multiple + term.multiple[f]];
+            }
+            if (term.has_rate) {
+                nutation_add_term<true>(ck, sk, Tb, b, term, dpsi, deps);
+            } else {
+                nutation_add_term<false>(ck, sk, Tb, b, term, dpsi, deps);
+            }
+        }
+
+        for (int e = 0; e < b; e++) {
+            delta_psi[start + e] = dpsi[e];
+            delta_eps[start + e] = deps[e];
+        }
+    }
+}
+
+// Same at the truncation chosen at build time with SIDEREAL_NUTATION_TERMS (all terms by default), built for each
+// instruction set level
+void delta_psi_delta_epsilon_kernel(const double* T, int n, double* delta_psi, double* delta_eps) {
+    delta_psi_delta_epsilon<SIDEREAL_NUTATION_TERMS>(T, n, delta_psi, delta_eps);
+}
+
+SIDEREAL_DISPATCH(delta_psi_delta_epsilon, (const double* T, int n, double* delta_psi, double* delta_eps),
+                  (T, n, delta_psi, delta_eps))
+
+void delta_psi_delta_epsilon(double T, double& delta_psi, double& delta_eps) {
+    delta_psi_delta_epsilon(&T, 1, &delta_psi, &delta_eps);
+}
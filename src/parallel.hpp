@@ -0,0 +1,64 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// Thread count used by the batch routines, 0 means one thread per hardware core
+std::atomic<int> NUM_THREADS(0);
+
+void set_num_threads(int num_threads) {
+    NUM_THREADS = std::max(num_threads, 0);
+}
+
+int get_num_threads() {
+    int num_threads = NUM_THREADS;
+    if (num_threads > 0) {
+        return num_threads;
+    }
+    // hardware_concurrency() reads sysfs on Linux (~3 us), too slow to ask on every small batch call
+    static const int hardware_threads = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+    return hardware_threads;
+}
+
+// Splits [0, n) into one contiguous range per thread and calls fn(begin, end) on each of them.
+// Every index is handled by exactly one call, so element-wise work gives the same result as the serial loop.
+// Workers only exist for the duration of the call, which keeps concurrent callers fully independent.
+// An exception thrown by fn is rethrown on the calling thread once all the ranges are done (the first range's
+// exception if several throw).
+template <typename Fn>
+void parallel_for(int n, const Fn& fn, int min_chunk = 4096) {
+    if (n <= 0) {
+        return;
+    }
+    int num_threads = std::min(get_num_threads(), (n + min_chunk - 1) / min_chunk);
+    if (num_threads <= 1) {
+        fn(0, n);
+        return;
+    }
+    int chunk = (n + num_threads - 1) / num_threads;
+    std::vector<std::exception_ptr> errors((n + chunk - 1) / chunk);
+    auto guarded = [&fn, &errors, chunk](int begin, int end) {
+        try {
+            fn(begin, end);
+        } catch (...) {
+            errors[begin / chunk] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (int begin = chunk; begin < n; begin += chunk) {
+        int end = std::min(n, begin + chunk);
+        workers.emplace_back([&guarded, begin, end]() { guarded(begin, end); });
+    }
+    guarded(0, chunk);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
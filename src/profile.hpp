@@ -1,8 +1,184 @@
+#pragma once
 #include <iostream>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
 
-// Global variable to store the start time
-std::chrono::time_point<std::chrono::high_resolution_clock> tic_start;
+// Hot path instrumentation.
+//
+// PROFILE_SCOPE(name, items) times the rest of the enclosing scope under a named probe, PROFILE_COUNT(name, n)
+// only counts. Both compile to nothing unless SIDEREAL_PROFILE is defined to 1 (setup.py does so when the
+// SIDEREAL_PROFILE environment variable is set at build time). Each thread accumulates into its own counters,
+// which are folded into a shared total when the thread exits, so probes inside parallel_for workers never
+// contend. profile_stats() sums everything recorded so far; scopes nest, and the time of a probe that runs on
+// several threads at once is summed over them.
+
+#ifndef SIDEREAL_PROFILE
+    #define SIDEREAL_PROFILE 0
+#endif
+
+const int PROFILE_MAX_PROBES = 64;
+
+struct ProfileCounters {
+    std::atomic<int64_t> calls[PROFILE_MAX_PROBES];
+    std::atomic<int64_t> nanoseconds[PROFILE_MAX_PROBES];
+    std::atomic<int64_t> items[PROFILE_MAX_PROBES];
+
+    ProfileCounters() {
+        reset();
+    }
+
+    void add(int probe, int64_t ns, int64_t n) {
+        calls[probe].fetch_add(1, std::memory_order_relaxed);
+        nanoseconds[probe].fetch_add(ns, std::memory_order_relaxed);
+        items[probe].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void reset() {
+        for (int i = 0; i < PROFILE_MAX_PROBES; i++) {
+            calls[i] = 0;
+            nanoseconds[i] = 0;
+            items[i] = 0;
+        }
+    }
+};
+
+// probe names and the counters of every thread, live or exited
+struct ProfileRegistry {
+    std::mutex mutex;
+    std::vector<std::string> names;
+    std::vector<ProfileCounters*> threads;
+    ProfileCounters exited;
+};
+
+ProfileRegistry& profile_registry() {
+    static ProfileRegistry registry;
+    return registry;
+}
+
+// index of a named probe, registered on first use (and then cached in a static at the probe site)
+int profile_probe_id(const char* name) {
+    ProfileRegistry& registry = profile_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (size_t i = 0; i < registry.names.size(); i++) {
+        if (registry.names[i] == name) {
+            return i;
+        }
+    }
+    if (registry.names.size() == PROFILE_MAX_PROBES) {
+        return PROFILE_MAX_PROBES - 1; // out of slots, the overflow shares the last one
+    }
+    registry.names.push_back(name);
+    return registry.names.size() - 1;
+}
+
+struct ThreadProfile {
+    ProfileCounters counters;
+
+    ThreadProfile() {
+        ProfileRegistry& registry = profile_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(&counters);
+    }
+
+    ~ThreadProfile() {
+        ProfileRegistry& registry = profile_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (int i = 0; i < PROFILE_MAX_PROBES; i++) {
+            registry.exited.calls[i] += counters.calls[i];
+            registry.exited.nanoseconds[i] += counters.nanoseconds[i];
+            registry.exited.items[i] += counters.items[i];
+        }
+        for (size_t i = 0; i < registry.threads.size(); i++) {
+            if (registry.threads[i] == &counters) {
+                registry.threads.erase(registry.threads.begin() + i);
+                break;
+            }
+        }
+    }
+};
+
+ProfileCounters& thread_profile_counters() {
+    thread_local ThreadProfile profile;
+    return profile.counters;
+}
+
+class ProfileScope {
+    private:
+        int probe_;
+        int64_t items_;
+        std::chrono::steady_clock::time_point start_;
+
+    public:
+        ProfileScope(int probe, int64_t items) : probe_(probe), items_(items), start_(std::chrono::steady_clock::now()) {}
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+        ~ProfileScope() {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            thread_profile_counters().add(probe_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), items_);
+        }
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+#if SIDEREAL_PROFILE
+    #define PROFILE_SCOPE(name, items) \
+        static const int PROFILE_CONCAT(profile_probe_, __LINE__) = profile_probe_id(name); \
+        ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(PROFILE_CONCAT(profile_probe_, __LINE__), items)
+    #define PROFILE_COUNT(name, n) \
+        do { \
+            static const int profile_probe = profile_probe_id(name); \
+            thread_profile_counters().add(profile_probe, 0, n); \
+        } while (0)
+#else
+    #define PROFILE_SCOPE(name, items) do {} while (0)
+    #define PROFILE_COUNT(name, n) do {} while (0)
+#endif
+
+struct ProfileStat {
+    std::string name;
+    int64_t calls;
+    double seconds; // summed over threads
+    int64_t items; // epochs (or whatever the probe counts) processed
+};
+
+// totals of every probe hit so far, empty when built without SIDEREAL_PROFILE
+std::vector<ProfileStat> profile_stats() {
+    ProfileRegistry& registry = profile_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::vector<ProfileStat> stats;
+    for (size_t i = 0; i < registry.names.size(); i++) {
+        int64_t calls = registry.exited.calls[i];
+        int64_t nanoseconds = registry.exited.nanoseconds[i];
+        int64_t items = registry.exited.items[i];
+        for (const ProfileCounters* counters : registry.threads) {
+            calls += counters->calls[i];
+            nanoseconds += counters->nanoseconds[i];
+            items += counters->items[i];
+        }
+        stats.push_back({registry.names[i], calls, nanoseconds * 1e-9, items});
+    }
+    return stats;
+}
+
+// counts recorded by probes running during the reset may survive it
+void reset_profile_stats() {
+    ProfileRegistry& registry = profile_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.exited.reset();
+    for (ProfileCounters* counters : registry.threads) {
+        counters->reset();
+    }
+}
+
+// Single stopwatch for quick manual timing, one per thread. Use PROFILE_SCOPE for anything that stays in the code.
+thread_local std::chrono::time_point<std::chrono::high_resolution_clock> tic_start;
 
 // Function to mimic MATLAB's tic
 void tic() {
@@ -14,7 +190,7 @@ double toc(bool print = true) {
     auto toc_end = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> elapsed = toc_end - tic_start;
     double dt = elapsed.count();
-    
+
     if (print) {
         if (dt < 1e-3) {
             std::cout << "Time elapsed: " << dt * 1e6 << " us" << std::endl;
@@ -25,4 +201,4 @@ double toc(bool print = true) {
         }
     }
     return dt;
-}
\ No newline at end of file
+}
@@ -2,8 +2,10 @@
 #include <iostream>
 #include <datetime.h>  // Include the Python datetime API
 #include <numpy/arrayobject.h> // and numpy
+#include <map>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/numpy.h>
 #include <pybind11/eigen.h>  // If you're using Eigen types
 
 namespace py = pybind11;
@@ -12,8 +14,350 @@ using namespace std;
 #include "time.hpp"
 #include "profile.hpp"
 
+// The batch entry points below run without the GIL, so several Python threads can compute on separate cores.
+// DateTimeArray fills its lazy columns under its own lock, everything else they touch is read-only.
+
+// Releases the GIL and holds the array's read lock against an in-place shift from another thread. The members go
+// out of scope in reverse, so the lock is dropped before the GIL is taken back: a shift waiting for the lock with
+// the GIL held cannot deadlock with a reader.
+struct ReadScope {
+    py::gil_scoped_release release;
+    std::shared_lock<std::shared_mutex> lock;
+
+    explicit ReadScope(const DateTimeArray& dtarray) : lock(dtarray.read_lock()) {}
+};
+
+// Wraps a DateTimeArray column as a read-only (N,) ndarray that shares its memory, the array object is kept alive as its base
+template <typename T, const std::vector<T>& (DateTimeArray::*column)() const>
+py::array_t<T> column_view(py::object self) {
+    const DateTimeArray& dtarray = self.cast<const DateTimeArray&>();
+    const std::vector<T>* col;
+    {
+        ReadScope scope(dtarray);
+        col = &(dtarray.*column)();
+    }
+    py::array_t<T> arr(col->size(), col->data(), self);
+    arr.attr("setflags")(py::arg("write") = false);
+    return arr;
+}
+
+// Moves the matrices into a (N,3,3) ndarray that owns them, strided over Eigen's column-major storage so nothing is copied
+py::array_t<double> own_matrices(std::vector<Eigen::Matrix3d>&& matrices) {
+    auto* mats = new std::vector<Eigen::Matrix3d>(std::move(matrices));
+    py::capsule owner(mats, [](void* p) { delete reinterpret_cast<std::vector<Eigen::Matrix3d>*>(p); });
+    std::vector<py::ssize_t> shape = {static_cast<py::ssize_t>(mats->size()), 3, 3};
+    std::vector<py::ssize_t> strides = {9 * sizeof(double), sizeof(double), 3 * sizeof(double)};
+    return py::array_t<double>(shape, strides, mats->empty() ? nullptr : mats->data()->data(), owner);
+}
+
+// Moves the quaternions into a (N,4) ndarray that owns them, scalar last (x, y, z, w) as in Eigen's storage and scipy
+template <typename Scalar>
+py::array_t<Scalar> own_quaternions(std::vector<Eigen::Quaternion<Scalar>>&& quaternions) {
+    auto* quats = new std::vector<Eigen::Quaternion<Scalar>>(std::move(quaternions));
+    py::capsule owner(quats, [](void* p) { delete reinterpret_cast<std::vector<Eigen::Quaternion<Scalar>>*>(p); });
+    std::vector<py::ssize_t> shape = {static_cast<py::ssize_t>(quats->size()), 4};
+    return py::array_t<Scalar>(shape, quats->empty() ? nullptr : quats->data()->coeffs().data(), owner);
+}
+
+// the rotations of one of the named frame changes, as matrices or (with quaternions) as unit quaternions
+template <std::vector<Eigen::Matrix3d> (DateTimeArray::*method)() const, Frame from, Frame to>
+py::object matrix_stack(const DateTimeArray& self, bool quaternions) {
+    if (quaternions) {
+        std::vector<Eigen::Quaterniond> quats;
+        {
+            ReadScope scope(self);
+            quats = self.transform_quaternions(from, to);
+        }
+        return own_quaternions(std::move(quats));
+    }
+    std::vector<Eigen::Matrix3d> mats;
+    {
+        ReadScope scope(self);
+        mats = (self.*method)();
+    }
+    return own_matrices(std::move(mats));
+}
+
+py::object transform_quaternions(const DateTimeArray& self, Frame from, Frame to, py::object dtype) {
+    py::dtype type = py::dtype::from_args(dtype);
+    if (type.kind() != 'f' || (type.itemsize() != 4 && type.itemsize() != 8)) {
+        throw py::value_error("dtype must be float32 or float64");
+    }
+    if (type.itemsize() == 4) {
+        std::vector<Eigen::Quaternionf> quats;
+        {
+            ReadScope scope(self);
+            quats = self.transform_quaternions<float>(from, to);
+        }
+        return own_quaternions(std::move(quats));
+    }
+    std::vector<Eigen::Quaterniond> quats;
+    {
+        ReadScope scope(self);
+        quats = self.transform_quaternions(from, to);
+    }
+    return own_quaternions(std::move(quats));
+}
+
+std::vector<Eigen::Quaterniond> history_at(const RotationHistory& history, const DateTimeArray& epochs) {
+    std::vector<int64_t> tai = epochs.tai_nanoseconds_since_j2000();
+    std::vector<Eigen::Quaterniond> quats(epochs.size());
+    history.at(tai.data(), epochs.size(), quats.data());
+    return quats;
+}
+
+// Moves a column into a (N,) ndarray that owns it
+template <typename T>
+py::array_t<T> own_column(std::vector<T>&& column) {
+    auto* owned = new std::vector<T>(std::move(column));
+    py::capsule owner(owned, [](void* p) { delete reinterpret_cast<std::vector<T>*>(p); });
+    return py::array_t<T>(owned->size(), owned->data(), owner);
+}
+
+typedef py::array_t<double, py::array::c_style | py::array::forcecast> Vectors;
+typedef py::array_t<double, py::array::c_style | py::array::forcecast> Doubles;
+typedef py::array_t<int64_t, py::array::c_style | py::array::forcecast> Int64s;
+typedef py::array_t<int, py::array::c_style | py::array::forcecast> Ints;
+
+// Sidereal angles straight from Julian date arrays, see sidereal_time_batch
+py::dict sidereal_time_arrays(Doubles jd_ut1, py::object jd_tt, bool rates) {
+    if (jd_ut1.ndim() != 1) {
+        throw py::value_error("jd_ut1 must be a 1-D array");
+    }
+    int n = jd_ut1.shape(0);
+    Doubles tt;
+    if (!jd_tt.is_none()) {
+        tt = jd_tt.cast<Doubles>();
+        if (tt.ndim() != 1 || tt.shape(0) != n) {
+            throw py::value_error("jd_tt must be a 1-D array as long as jd_ut1");
+        }
+    }
+    std::vector<double> gmst(n), era(n), gast, gmst_rate, gast_rate;
+    SiderealTimes out;
+    out.gmst = gmst.data();
+    out.era = era.data();
+    if (!jd_tt.is_none()) {
+        gast.resize(n);
+        out.gast = gast.data();
+    }
+    if (rates) {
+        gmst_rate.resize(n);
+        out.gmst_rate = gmst_rate.data();
+        if (out.gast) {
+            gast_rate.resize(n);
+            out.gast_rate = gast_rate.data();
+        }
+    }
+    {
+        const double* ut1 = jd_ut1.data();
+        const double* tt_data = out.gast ? tt.data() : nullptr;
+        py::gil_scoped_release release;
+        sidereal_time_batch(ut1, tt_data, n, out);
+    }
+    py::dict angles;
+    angles["gmst"] = own_column(std::move(gmst));
+    angles["era"] = own_column(std::move(era));
+    if (out.gast) {
+        angles["gast"] = own_column(std::move(gast));
+    }
+    if (rates) {
+        angles["gmst_rate"] = own_column(std::move(gmst_rate));
+        if (out.gast) {
+            angles["gast_rate"] = own_column(std::move(gast_rate));
+        }
+    }
+    return angles;
+}
+
+// Integer epochs are nanoseconds since J2000 and come back as int64, floating point ones are Julian dates
+py::array convert_time_scale_array(py::array epochs, TimeScale from, TimeScale to) {
+    char kind = epochs.dtype().kind();
+    std::vector<py::ssize_t> shape(epochs.shape(), epochs.shape() + epochs.ndim());
+    if (kind == 'i' || kind == 'u') {
+        Int64s in = epochs.cast<Int64s>();
+        Int64s out(shape);
+        {
+            const int64_t* in_data = in.data();
+            int64_t* out_data = out.mutable_data();
+            py::gil_scoped_release release;
+            convert_time_scale(in_data, in.size(), from, to, out_data);
+        }
+        return out;
+    }
+    if (kind == 'f') {
+        Doubles in = epochs.cast<Doubles>();
+        Doubles out(shape);
+        {
+            const double* in_data = in.data();
+            double* out_data = out.mutable_data();
+            py::gil_scoped_release release;
+            convert_time_scale(in_data, in.size(), from, to, out_data);
+        }
+        return out;
+    }
+    throw py::type_error("epochs must be integer nanoseconds since J2000 or floating point Julian dates");
+}
+
+// NumPy wraps values silently when astype("datetime64[ns]") overflows, so the epochs are checked in their own
+// unit first: from 1708 (the supported epochs) up to the last int64 Unix nanosecond in 2262. NaT passes through.
+void check_datetime64_range(py::array times) {
+    py::tuple unit = py::module_::import("numpy").attr("datetime_data")(times.dtype());
+    std::string name = unit[0].cast<std::string>();
+    int64_t count = unit[1].cast<int64_t>();
+    const int64_t min_unix_nanoseconds = MIN_EPOCH_SECONDS * NANOSECONDS_PER_SECOND + J2000_UNIX_NANOSECONDS;
+    const int64_t max_unix_nanoseconds = std::numeric_limits<int64_t>::max();
+    int64_t lowest;
+    int64_t highest;
+    if (name == "Y") {  // years since 1970
+        lowest = -floor_div(262, count);
+        highest = floor_div(292, count);
+    } else if (name == "M") {  // months since 1970-01, up to 2262-04
+        lowest = -floor_div(3144, count);
+        highest = floor_div(3507, count);
+    } else {
+        static const std::map<std::string, int64_t> nanoseconds_per_unit = {
+            {"W", 7 * NANOSECONDS_PER_DAY}, {"D", NANOSECONDS_PER_DAY}, {"h", 3600 * NANOSECONDS_PER_SECOND},
+            {"m", 60 * NANOSECONDS_PER_SECOND}, {"s", NANOSECONDS_PER_SECOND}, {"ms", 1000000}, {"us", 1000}, {"ns", 1}};
+        auto found = nanoseconds_per_unit.find(name);
+        if (found == nanoseconds_per_unit.end()) {
+            return;  // finer than a nanosecond, converting divides and cannot overflow
+        }
+        int64_t step = found->second;
+        if (count > max_unix_nanoseconds / step) {
+            throw std::out_of_range(EPOCH_RANGE_ERROR);
+        }
+        step *= count;
+        lowest = -floor_div(-min_unix_nanoseconds, step);
+        highest = floor_div(max_unix_nanoseconds, step);
+    }
+    Int64s values = times.attr("view")("int64").cast<Int64s>();
+    const int64_t nat = std::numeric_limits<int64_t>::min();
+    const int64_t* data = values.data();
+    for (py::ssize_t i = 0; i < values.size(); i++) {
+        if (data[i] != nat && (data[i] < lowest || data[i] > highest)) {
+            throw std::out_of_range(EPOCH_RANGE_ERROR);
+        }
+    }
+}
+
+// Builds a DateTimeArray from a 1-D array of epochs, read in place when it is already C-contiguous of the right dtype
+template <typename Array, DateTimeArray (*convert)(const typename Array::value_type*, int)>
+DateTimeArray from_epochs(Array epochs) {
+    if (epochs.ndim() != 1) {
+        throw py::value_error("epochs must be a 1-D array");
+    }
+    const typename Array::value_type* data = epochs.data();
+    int n = epochs.shape(0);
+    py::gil_scoped_release release;
+    return convert(data, n);
+}
+
+// Epochs from calendar field arrays of one length, omitted time of day fields are zero
+template <typename Array>
+Array calendar_field(py::object values, int n, const char* name) {
+    Array field(n);
+    if (values.is_none()) {
+        std::fill(field.mutable_data(), field.mutable_data() + n, 0);
+    } else {
+        field = values.cast<Array>();
+    }
+    if (field.ndim() != 1 || field.size() != n) {
+        throw py::value_error(std::string(name) + " must be a 1-D array as long as year");
+    }
+    return field;
+}
+
+DateTimeArray datetime_array_from_calendar(Ints year, py::object month, py::object day, py::object hour, py::object minute,
+                                           py::object second, py::object nanosecond) {
+    if (year.ndim() != 1) {
+        throw py::value_error("year must be a 1-D array");
+    }
+    int n = year.size();
+    Ints months = calendar_field<Ints>(month, n, "month");
+    Ints days = calendar_field<Ints>(day, n, "day");
+    Ints hours = calendar_field<Ints>(hour, n, "hour");
+    Ints minutes = calendar_field<Ints>(minute, n, "minute");
+    Ints seconds = calendar_field<Ints>(second, n, "second");
+    Int64s nanoseconds = calendar_field<Int64s>(nanosecond, n, "nanosecond");
+    py::gil_scoped_release release;
+    return calendar_to_datetime_array(year.data(), months.data(), days.data(), hours.data(), minutes.data(),
+                                      seconds.data(), nanoseconds.data(), n);
+}
+
+DateTimeArray nanoseconds_to_datetime_array(const int64_t* nanoseconds_since_j2000, int n) {
+    return std::vector<int64_t>(nanoseconds_since_j2000, nanoseconds_since_j2000 + n);
+}
+
+void check_vectors(const DateTimeArray& self, const Vectors& vectors, const std::string& name) {
+    if (vectors.ndim() != 2 || vectors.shape(1) != 3 || vectors.shape(0) != self.size()) {
+        throw py::value_error(name + " must have shape (len(self), 3)");
+    }
+}
+
+// Rotates (N,3) positions, and velocities if given, from one frame to another in a single pass without forming the matrices
+py::object transform_vectors(const DateTimeArray& self, Frame from, Frame to, Vectors positions, py::object velocities) {
+    check_vectors(self, positions, "positions");
+    std::vector<py::ssize_t> shape = {positions.shape(0), 3};
+    Vectors positions_out(shape);
+    const double* r = positions.data();
+    double* r_out = positions_out.mutable_data();
+    if (velocities.is_none()) {
+        {
+            ReadScope scope(self);
+            self.transform_vectors(from, to, r, r_out);
+        }
+        return positions_out;
+    }
+    Vectors v = velocities.cast<Vectors>();
+    check_vectors(self, v, "velocities");
+    Vectors velocities_out(shape);
+    double* v_out = velocities_out.mutable_data();
+    {
+        ReadScope scope(self);
+        self.transform_vectors(from, to, r, r_out, v.data(), v_out);
+    }
+    return py::make_tuple(positions_out, velocities_out);
+}
+
+template <Frame from, Frame to>
+py::object transform_vectors(const DateTimeArray& self, Vectors positions, py::object velocities) {
+    return transform_vectors(self, from, to, positions, velocities);
+}
+
+// Look angles from (M,3) geodetic sites [latitude rad, longitude rad, altitude km] of (N,3) J2000 positions [km]
+py::dict look_angles(const DateTimeArray& self, Vectors positions, Doubles sites, double min_elevation) {
+    check_vectors(self, positions, "positions");
+    if (sites.ndim() != 2 || sites.shape(1) != 3) {
+        throw py::value_error("sites must have shape (M, 3): latitude, longitude [rad] and altitude [km]");
+    }
+    int n_sites = sites.shape(0);
+    std::vector<TopocentricSite> topocentric(n_sites);
+    for (int s = 0; s < n_sites; s++) {
+        topocentric[s] = geodetic_to_site(sites.at(s, 0), sites.at(s, 1), sites.at(s, 2));
+    }
+    std::vector<py::ssize_t> shape = {n_sites, self.size()};
+    py::array_t<double> azimuth(shape), elevation(shape), range(shape);
+    py::array_t<bool> visible(shape);
+    LookAngles out;
+    out.azimuth = azimuth.mutable_data();
+    out.elevation = elevation.mutable_data();
+    out.range = range.mutable_data();
+    out.visible = visible.mutable_data();
+    {
+        const double* r = positions.data();
+        ReadScope scope(self);
+        self.look_angles(r, topocentric.data(), n_sites, min_elevation, out);
+    }
+    py::dict angles;
+    angles["azimuth"] = azimuth;
+    angles["elevation"] = elevation;
+    angles["range"] = range;
+    angles["visible"] = visible;
+    return angles;
+}
+
 PYBIND11_MODULE(sidereal, m) {
-    m.def("linspace", &datetime_linspace, R"mydelimiter(
+    m.def("linspace", &datetime_linspace, py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
         Generate n evenly spaced DateTime objects between two specified DateTime points
 
         :param dt1: The first DateTime
@@ -21,7 +365,7 @@ PYBIND11_MODULE(sidereal, m) {
         :param n: The number of DateTime objects to generate
         :return: A vector of DateTime objects
         )mydelimiter");
-    m.def("arange", &datetime_arange, R"mydelimiter(
+    m.def("arange", &datetime_arange, py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
         Generate DateTime objects between two specified DateTime points with a specified step size.
 
         :param dt1: The first DateTime
@@ -29,6 +373,114 @@ PYBIND11_MODULE(sidereal, m) {
         :param step: The step size
         :return: A vector of DateTime objects
         )mydelimiter");
+    m.def("linspace_chunks", &linspace_chunks, py::arg("dt1"), py::arg("dt2"), py::arg("n"), py::arg("chunk_size")=65536, R"mydelimiter(
+        Same epochs as linspace, produced lazily as DateTimeArrays of at most chunk_size epochs so memory stays bounded
+
+        :param dt1: The first DateTime
+        :param dt2: The second DateTime
+        :param n: The number of DateTime objects to generate
+        :param chunk_size: The largest number of epochs per chunk
+        :return: An iterable of DateTimeArray chunks
+        )mydelimiter");
+    m.def("arange_chunks", &arange_chunks, py::arg("dt1"), py::arg("dt2"), py::arg("step"), py::arg("chunk_size")=65536, R"mydelimiter(
+        Same epochs as arange, produced lazily as DateTimeArrays of at most chunk_size epochs so memory stays bounded
+
+        :param dt1: The first DateTime
+        :param dt2: The second DateTime
+        :param step: The step size
+        :param chunk_size: The largest number of epochs per chunk
+        :return: An iterable of DateTimeArray chunks
+        )mydelimiter");
+    m.def("sidereal_time", &sidereal_time_arrays, py::arg("jd_ut1"), py::arg("jd_tt")=py::none(), py::arg("rates")=false,
+          R"mydelimiter(
+        Sidereal angles of many epochs from their Julian dates, without building DateTime objects or matrices
+
+        :param jd_ut1: Julian dates in UT1
+        :param jd_tt: Julian dates in TT, only needed for GAST (nutation and obliquity). Dense epochs interpolate the
+            nutation series within the interpolation tolerance
+        :param rates: Also return the rates gmst_rate and gast_rate [rad/s]
+        :return: Dict of arrays: gmst, era (Earth rotation angle) and, with jd_tt, gast [rad]
+        )mydelimiter");
+    py::enum_<TimeScale>(m, "TimeScale", "Time scales of convert_time_scale.")
+        .value("UTC", TimeScale::UTC)
+        .value("TAI", TimeScale::TAI)
+        .value("TT", TimeScale::TT)
+        .value("UT1", TimeScale::UT1)
+        .value("GPS", TimeScale::GPS)
+        .value("TDB", TimeScale::TDB)
+        ;
+    m.def("convert_time_scale", &convert_time_scale_array, py::arg("epochs"), py::arg("from_scale"), py::arg("to_scale"),
+          R"mydelimiter(
+        Convert raw epochs from one time scale to another, without building DateTime objects
+
+        Leap seconds and UT1-UTC come from the current EOP table. Inside a leap second UTC repeats 23:59:59, as Unix
+        time does. TDB follows the two-term series, good to about 10 us.
+
+        :param epochs: Array of any shape, integers in nanoseconds since J2000 read on the from_scale clock (GPS
+            seconds s since 1980-01-06 are (s - 630763200) * 10**9), or floating point Julian dates of from_scale
+        :param from_scale: TimeScale of the epochs
+        :param to_scale: TimeScale to convert to
+        :return: Array of the same shape, int64 nanoseconds or float64 Julian dates as given
+        )mydelimiter");
+    m.def("set_num_threads", &set_num_threads, R"mydelimiter(
+        Set the number of threads used by the batch routines (linspace, arange, DateTimeArray arithmetic and accessors)
+
+        :param n: The number of threads, 0 uses one thread per hardware core
+        )mydelimiter");
+    m.def("get_num_threads", &get_num_threads, "Get the number of threads used by the batch routines.");
+    // the level is settled at import, SIDEREAL_ISA included
+    get_isa();
+    m.def("set_isa", [](const std::string& name) { set_isa(parse_isa(name)); }, py::arg("isa"), R"mydelimiter(
+        Force the instruction set the batch kernels run with, for testing and benchmarks
+
+        :param isa: "baseline", "avx2" or "avx512", raises ValueError if the CPU lacks it
+        )mydelimiter");
+    m.def("get_isa", []() { return std::string(isa_name(get_isa())); },
+          "Get the instruction set the batch kernels run with: baseline, avx2 or avx512.");
+    m.def("set_interpolation_tolerance", &set_interpolation_tolerance, R"mydelimiter(
+        Let DateTimeArray interpolate nutation and precession between a few exact evaluations on dense epoch grids.
+        The interpolation is checked against the exact series and falls back to it if the tolerance can't be met cheaply.
+
+        :param tolerance: Largest error allowed [rad], 0 (the default) always evaluates the series exactly
+        )mydelimiter");
+    m.def("get_interpolation_tolerance", &get_interpolation_tolerance, "Get the nutation and precession interpolation tolerance [rad].");
+    m.def("load_eop", &load_eop, py::arg("finals"), py::arg("tai_utc")="", py::arg("cache")="",
+          py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
+        Load Earth orientation data from IERS files, replacing the tables in use
+
+        :param finals: Path to an IERS finals (or USNO gpsrapid.out) file
+        :param tai_utc: Path to a USNO tai-utc.dat file, the current leap seconds are kept if empty
+        :param cache: If given, the parsed tables are also written to this binary cache for load_eop_cache
+        )mydelimiter");
+    m.def("load_eop_cache", &load_eop_cache, py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
+        Memory map a binary cache written by load_eop and use its tables. The SIDEREAL_EOP_CACHE environment
+        variable names a cache to map at import.
+
+        :param path: Path to the cache
+        )mydelimiter");
+    m.def("reset_eop", &reset_eop, "Go back to the Earth orientation tables compiled into the extension.");
+    m.def("eop_mjd_range", []() {
+        std::shared_ptr<const EopTable> table = current_eop_table();
+        return std::make_pair(table->first_mjd(), table->last_mjd());
+    }, "First and last MJD covered by the Earth orientation tables in use.");
+    m.def("profile_stats", []() {
+        py::dict stats;
+        for (const ProfileStat& stat : profile_stats()) {
+            py::dict entry;
+            entry["calls"] = stat.calls;
+            entry["seconds"] = stat.seconds;
+            entry["items"] = stat.items;
+            stats[py::str(stat.name)] = entry;
+        }
+        return stats;
+    }, R"mydelimiter(
+        Time spent in the instrumented hot paths since start-up or the last reset_profile_stats()
+
+        :return: {probe name: {"calls", "seconds" (summed over threads), "items" (epochs processed)}},
+            empty unless the extension was built with SIDEREAL_PROFILE=1
+        )mydelimiter");
+    m.def("reset_profile_stats", &reset_profile_stats, "Zero the counters read by profile_stats().");
+    m.def("profile_enabled", []() { return SIDEREAL_PROFILE != 0; }, "Whether the extension was built with the profiling probes.");
     m.def("jd_to_datetime", &jd_to_datetime, "Convert a Julian Date to a DateTime object.");
     m.def("now", &now, "Get the current DateTime.");
     m.def("years", &years);
@@ -39,28 +491,43 @@ PYBIND11_MODULE(sidereal, m) {
     m.def("seconds", &seconds);
     m.def("nanoseconds", &nanoseconds);
 
-    py::class_<DateTime>(m, "DateTime")
+    py::enum_<Frame>(m, "Frame", "Reference frames of the IAU-76/FK5 reduction chain, in chain order.")
+        .value("J2000", Frame::J2000)
+        .value("MOD", Frame::MOD)
+        .value("TOD", Frame::TOD)
+        .value("TEME", Frame::TEME)
+        .value("GTOD", Frame::GTOD)
+        .value("ITRF", Frame::ITRF)
+        ;
+
+    py::class_<DateTime>(m, "DateTime", R"mydelimiter(
+        A UTC epoch, stored as integer nanoseconds since J2000 (2000-01-01 12:00:00 UTC)
+
+        Epochs are supported for the years 1708 to 2291, constructors and conversions from Julian dates, Unix time
+        or calendar fields raise IndexError outside them.
+        )mydelimiter")
         .def(py::init<int, int, int, int, int, int, int>(), 
              py::arg("year"), py::arg("month"), py::arg("day"), 
              py::arg("hour")=0, py::arg("minute")=0, py::arg("second")=0, 
              py::arg("nanosecond")=0
              )
-        .def_readwrite("year", &DateTime::year)
-        .def_readwrite("month", &DateTime::month)
-        .def_readwrite("day", &DateTime::day)
-        .def_readwrite("hour", &DateTime::hour)
-        .def_readwrite("minute", &DateTime::minute)
-        .def_readwrite("second", &DateTime::second)
-        .def_readwrite("nanosecond", &DateTime::nanosecond)
-        .def_readwrite("px", &DateTime::px)
-        .def_readwrite("py", &DateTime::py)
-        .def_readwrite("gmst", &DateTime::gmst)
-        .def_readwrite("gast", &DateTime::gast)
+        .def_property_readonly("year", &DateTime::year)
+        .def_property_readonly("month", &DateTime::month)
+        .def_property_readonly("day", &DateTime::day)
+        .def_property_readonly("hour", &DateTime::hour)
+        .def_property_readonly("minute", &DateTime::minute)
+        .def_property_readonly("second", &DateTime::second)
+        .def_property_readonly("nanosecond", &DateTime::nanosecond)
+        .def_property_readonly("nanoseconds_since_j2000", &DateTime::nanoseconds_since_j2000)
+        .def_property_readonly("px", &DateTime::px)
+        .def_property_readonly("py", &DateTime::py)
+        .def_property_readonly("gmst", &DateTime::gmst)
+        .def_property_readonly("gast", &DateTime::gast)
         .def("__repr__", [](const DateTime &dt) {
-            return "<DateTime: " + std::to_string(dt.year) + "-" + std::to_string(dt.month) + "-" + std::to_string(dt.day) + " " + std::to_string(dt.hour) + ":" + std::to_string(dt.minute) + ":" + std::to_string(dt.second) + "." + std::to_string(dt.nanosecond) + ">";
+            return "<DateTime: " + std::to_string(dt.year()) + "-" + std::to_string(dt.month()) + "-" + std::to_string(dt.day()) + " " + std::to_string(dt.hour()) + ":" + std::to_string(dt.minute()) + ":" + std::to_string(dt.second()) + "." + std::to_string(dt.nanosecond()) + ">";
         })
         .def("__str__", [](const DateTime &dt) {
-            return std::to_string(dt.year) + "-" + std::to_string(dt.month) + "-" + std::to_string(dt.day) + " " + std::to_string(dt.hour) + ":" + std::to_string(dt.minute) + ":" + std::to_string(dt.second) + "." + std::to_string(dt.nanosecond);
+            return std::to_string(dt.year()) + "-" + std::to_string(dt.month()) + "-" + std::to_string(dt.day()) + " " + std::to_string(dt.hour()) + ":" + std::to_string(dt.minute()) + ":" + std::to_string(dt.second()) + "." + std::to_string(dt.nanosecond());
         })
         .def("__sub__", [](DateTime &dt1, DateTime &dt2) {
             return dt1 - dt2;
@@ -71,21 +538,35 @@ PYBIND11_MODULE(sidereal, m) {
         .def("__sub__", [](DateTime &dt1, TimeDelta &dt2) {
             return dt1 - dt2;
         })
-        .def_readwrite("jd_utc", &DateTime::jd_utc)
-        .def_readwrite("jd_ut1", &DateTime::jd_ut1)
-        .def_readwrite("jd_tai", &DateTime::jd_tai)
-        .def_readwrite("jd_tt", &DateTime::jd_tt)
-        .def_readwrite("mjd_utc", &DateTime::mjd_utc)
-        .def_readwrite("mjd_ut1", &DateTime::mjd_ut1)
-        .def_readwrite("mjd_tai", &DateTime::mjd_tai)
-        .def_readwrite("mjd_tt", &DateTime::mjd_tt)
-        .def_readwrite("gast", &DateTime::gast)
+        .def("__eq__", [](const DateTime &dt1, const DateTime &dt2) { return dt1 == dt2; })
+        .def("__ne__", [](const DateTime &dt1, const DateTime &dt2) { return dt1 != dt2; })
+        .def("__lt__", [](const DateTime &dt1, const DateTime &dt2) { return dt1 < dt2; })
+        .def("__le__", [](const DateTime &dt1, const DateTime &dt2) { return dt1 <= dt2; })
+        .def("__gt__", [](const DateTime &dt1, const DateTime &dt2) { return dt1 > dt2; })
+        .def("__ge__", [](const DateTime &dt1, const DateTime &dt2) { return dt1 >= dt2; })
+        .def("__hash__", [](const DateTime &dt) {
+            return std::hash<int64_t>()(dt.nanoseconds_since_j2000());
+        })
+        .def_property_readonly("jd_utc", &DateTime::jd_utc)
+        .def_property_readonly("jd_ut1", &DateTime::jd_ut1)
+        .def_property_readonly("jd_tai", &DateTime::jd_tai)
+        .def_property_readonly("jd_tt", &DateTime::jd_tt)
+        .def_property_readonly("mjd_utc", &DateTime::mjd_utc)
+        .def_property_readonly("mjd_ut1", &DateTime::mjd_ut1)
+        .def_property_readonly("mjd_tai", &DateTime::mjd_tai)
+        .def_property_readonly("mjd_tt", &DateTime::mjd_tt)
+        .def_property_readonly("tai_minus_utc", &DateTime::tai_minus_utc)
+        .def_property_readonly("ut1_minus_utc", &DateTime::ut1_minus_utc)
         .def("gtod_to_itrf", &DateTime::gtod_to_itrf)
         .def("teme_to_gtod", &DateTime::teme_to_gtod)
         .def("tod_to_teme", &DateTime::tod_to_teme)
         .def("mod_to_tod", &DateTime::mod_to_tod)
         .def("j2000_to_mod", &DateTime::j2000_to_mod)
         .def("itrf_to_j2000", &DateTime::itrf_to_j2000)
+        .def("transform", py::overload_cast<Frame, Frame>(&DateTime::transform, py::const_), py::arg("from_frame"), py::arg("to_frame"),
+             "Rotation matrix taking vectors from one frame to another.")
+        .def("transform", py::overload_cast<Frame, const std::vector<Frame>&>(&DateTime::transform, py::const_), py::arg("from_frame"), py::arg("to_frames"),
+             "Rotation matrices from one frame to each of several, the steps they share are computed once.")
         ;
     
     py::class_<TimeDelta>(m, "TimeDelta")
@@ -114,6 +595,62 @@ PYBIND11_MODULE(sidereal, m) {
     
     py::class_<DateTimeArray>(m, "DateTimeArray")
         .def(py::init<std::vector<DateTime>>())
+        .def("__add__", [](const DateTimeArray& dtarray, const TimeDelta& tdelta) {
+            ReadScope scope(dtarray);
+            return dtarray + tdelta;
+        })
+        .def("__sub__", [](const DateTimeArray& dtarray, const TimeDelta& tdelta) {
+            ReadScope scope(dtarray);
+            return dtarray - tdelta;
+        })
+        // in place, so the column views already handed out follow the shift. operator+= waits for the readers in a
+        // ReadScope; the GIL stays held so that no Python code reads the columns half shifted either
+        .def("__iadd__", [](py::object self, const TimeDelta& tdelta) {
+            self.cast<DateTimeArray&>() += tdelta;
+            return self;
+        })
+        .def("__isub__", [](py::object self, const TimeDelta& tdelta) {
+            self.cast<DateTimeArray&>() -= tdelta;
+            return self;
+        })
+        // batch constructors from NumPy arrays, nothing goes through Python objects per epoch
+        .def_static("from_jd_utc", &from_epochs<Doubles, &jd_to_datetime_array>, py::arg("jd_utc"),
+                    "Build from an array of UTC Julian dates.")
+        .def_static("from_mjd_utc", &from_epochs<Doubles, &mjd_to_datetime_array>, py::arg("mjd_utc"),
+                    "Build from an array of UTC modified Julian dates.")
+        .def_static("from_unix", &from_epochs<Doubles, &unix_seconds_to_datetime_array>, py::arg("seconds"),
+                    "Build from an array of Unix timestamps [s].")
+        .def_static("from_nanoseconds_since_j2000", &from_epochs<Int64s, &nanoseconds_to_datetime_array>, py::arg("nanoseconds"),
+                    "Build from an array of integer nanoseconds since J2000 (2000-01-01 12:00:00 UTC).")
+        .def_static("from_calendar", &datetime_array_from_calendar, py::arg("year"), py::arg("month"), py::arg("day"),
+                    py::arg("hour")=py::none(), py::arg("minute")=py::none(), py::arg("second")=py::none(),
+                    py::arg("nanosecond")=py::none(),
+                    "Build from calendar field arrays, fields outside their usual range roll over like in DateTime.")
+        .def_static("from_datetime64", [](py::array times) {
+            if (times.dtype().kind() != 'M') {
+                throw py::type_error("expected a numpy datetime64 array");
+            }
+            check_datetime64_range(times);
+            // no copy if the array already holds datetime64[ns]
+            py::array nanoseconds = times.attr("astype")("datetime64[ns]", py::arg("copy") = false).attr("view")("int64");
+            return from_epochs<Int64s, &unix_nanoseconds_to_datetime_array>(nanoseconds.cast<Int64s>());
+        }, py::arg("times"), "Build from a numpy datetime64 array (any unit, NaT is rejected, IndexError outside 1708 to 2262-04-11).")
+        .def("to_unix", [](const DateTimeArray& self) {
+            std::vector<double> seconds;
+            {
+                ReadScope scope(self);
+                seconds = self.unix_seconds();
+            }
+            return own_column(std::move(seconds));
+        }, "Unix timestamps [s] as a new (N,) array.")
+        .def("to_datetime64", [](const DateTimeArray& self) {
+            std::vector<int64_t> nanoseconds;
+            {
+                ReadScope scope(self);
+                nanoseconds = self.unix_nanoseconds();
+            }
+            return own_column(std::move(nanoseconds)).attr("view")("datetime64[ns]");
+        }, "The epochs as a new (N,) numpy datetime64[ns] array, IndexError for epochs past 2262-04-11.")
         // subscripting
         .def("__getitem__", [](DateTimeArray &dt, int i) {
             return dt[i];
@@ -121,25 +658,146 @@ PYBIND11_MODULE(sidereal, m) {
         .def("__len__", [](DateTimeArray &dt) {
             return dt.size();
         })
-        .def("jd_utc", &DateTimeArray::jd_utc)
-        .def("jd_ut1", &DateTimeArray::jd_ut1)
-        .def("jd_tai", &DateTimeArray::jd_tai)
-        .def("jd_tt", &DateTimeArray::jd_tt)
-        .def("mjd_utc", &DateTimeArray::mjd_utc)
-        .def("mjd_ut1", &DateTimeArray::mjd_ut1)
-        .def("mjd_tai", &DateTimeArray::mjd_tai)
-        .def("mjd_tt", &DateTimeArray::mjd_tt)
-        .def("gast", &DateTimeArray::gast)
-        .def("gmst", &DateTimeArray::gmst)
-        .def("py", &DateTimeArray::py)
-        .def("px", &DateTimeArray::px)
-        .def("tai_minus_utc", &DateTimeArray::tai_minus_utc)
-        .def("ut1_minus_utc", &DateTimeArray::ut1_minus_utc)
-        .def("itrf_to_j2000", &DateTimeArray::itrf_to_j2000)
-        .def("gtod_to_itrf", &DateTimeArray::gtod_to_itrf)
-        .def("teme_to_gtod", &DateTimeArray::teme_to_gtod)
-        .def("tod_to_teme", &DateTimeArray::tod_to_teme)
-        .def("mod_to_tod", &DateTimeArray::mod_to_tod)
-        .def("j2000_to_mod", &DateTimeArray::j2000_to_mod)
+        .def("nanoseconds_since_j2000", &column_view<int64_t, &DateTimeArray::nanoseconds_since_j2000>)
+        .def("year", &column_view<int, &DateTimeArray::year>)
+        .def("month", &column_view<int, &DateTimeArray::month>)
+        .def("day", &column_view<int, &DateTimeArray::day>)
+        .def("hour", &column_view<int, &DateTimeArray::hour>)
+        .def("minute", &column_view<int, &DateTimeArray::minute>)
+        .def("second", &column_view<int, &DateTimeArray::second>)
+        .def("nanosecond", &column_view<int, &DateTimeArray::nanosecond>)
+        .def("jd_utc", &column_view<double, &DateTimeArray::jd_utc>)
+        .def("jd_ut1", &column_view<double, &DateTimeArray::jd_ut1>)
+        .def("jd_tai", &column_view<double, &DateTimeArray::jd_tai>)
+        .def("jd_tt", &column_view<double, &DateTimeArray::jd_tt>)
+        .def("mjd_utc", &column_view<double, &DateTimeArray::mjd_utc>)
+        .def("mjd_ut1", &column_view<double, &DateTimeArray::mjd_ut1>)
+        .def("mjd_tai", &column_view<double, &DateTimeArray::mjd_tai>)
+        .def("mjd_tt", &column_view<double, &DateTimeArray::mjd_tt>)
+        .def("gast", &column_view<double, &DateTimeArray::gast>)
+        .def("gmst", &column_view<double, &DateTimeArray::gmst>)
+        .def("py", &column_view<double, &DateTimeArray::py>)
+        .def("px", &column_view<double, &DateTimeArray::px>)
+        .def("tai_minus_utc", &column_view<double, &DateTimeArray::tai_minus_utc>)
+        .def("ut1_minus_utc", &column_view<double, &DateTimeArray::ut1_minus_utc>)
+        .def("itrf_to_j2000", &matrix_stack<&DateTimeArray::itrf_to_j2000, Frame::ITRF, Frame::J2000>, py::kw_only(), py::arg("quaternions")=false)
+        .def("gtod_to_itrf", &matrix_stack<&DateTimeArray::gtod_to_itrf, Frame::GTOD, Frame::ITRF>, py::kw_only(), py::arg("quaternions")=false)
+        .def("teme_to_gtod", &matrix_stack<&DateTimeArray::teme_to_gtod, Frame::TEME, Frame::GTOD>, py::kw_only(), py::arg("quaternions")=false)
+        .def("tod_to_teme", &matrix_stack<&DateTimeArray::tod_to_teme, Frame::TOD, Frame::TEME>, py::kw_only(), py::arg("quaternions")=false)
+        .def("mod_to_tod", &matrix_stack<&DateTimeArray::mod_to_tod, Frame::MOD, Frame::TOD>, py::kw_only(), py::arg("quaternions")=false)
+        .def("j2000_to_mod", &matrix_stack<&DateTimeArray::j2000_to_mod, Frame::J2000, Frame::MOD>, py::kw_only(), py::arg("quaternions")=false)
+        // the same frame changes applied straight to (N,3) positions and optional velocities [position unit / s]
+        .def("itrf_to_j2000", &transform_vectors<Frame::ITRF, Frame::J2000>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("j2000_to_itrf", &transform_vectors<Frame::J2000, Frame::ITRF>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("teme_to_j2000", &transform_vectors<Frame::TEME, Frame::J2000>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("j2000_to_teme", &transform_vectors<Frame::J2000, Frame::TEME>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("gtod_to_itrf", &transform_vectors<Frame::GTOD, Frame::ITRF>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("itrf_to_gtod", &transform_vectors<Frame::ITRF, Frame::GTOD>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("teme_to_gtod", &transform_vectors<Frame::TEME, Frame::GTOD>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("gtod_to_teme", &transform_vectors<Frame::GTOD, Frame::TEME>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("tod_to_teme", &transform_vectors<Frame::TOD, Frame::TEME>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("teme_to_tod", &transform_vectors<Frame::TEME, Frame::TOD>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("mod_to_tod", &transform_vectors<Frame::MOD, Frame::TOD>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("tod_to_mod", &transform_vectors<Frame::TOD, Frame::MOD>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("j2000_to_mod", &transform_vectors<Frame::J2000, Frame::MOD>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("mod_to_j2000", &transform_vectors<Frame::MOD, Frame::J2000>, py::arg("positions"), py::arg("velocities")=py::none())
+        .def("transform", [](const DateTimeArray& self, Frame from, Frame to) {
+            std::vector<Eigen::Matrix3d> mats;
+            {
+                ReadScope scope(self);
+                mats = self.transform(from, to);
+            }
+            return own_matrices(std::move(mats));
+        }, py::arg("from_frame"), py::arg("to_frame"), "(N,3,3) rotation matrices taking vectors from one frame to another.")
+        .def("transform", [](const DateTimeArray& self, Frame from, const std::vector<Frame>& to) {
+            std::vector<std::vector<Eigen::Matrix3d>> stacks;
+            {
+                ReadScope scope(self);
+                stacks = self.transform(from, to);
+            }
+            py::list result;
+            for (std::vector<Eigen::Matrix3d>& mats : stacks) {
+                result.append(own_matrices(std::move(mats)));
+            }
+            return result;
+        }, py::arg("from_frame"), py::arg("to_frames"), R"mydelimiter(
+            (N,3,3) rotation matrices from one frame to each of several, in the order given.
+            Each epoch walks the frame chain once, so the steps the targets share are computed once.
+        )mydelimiter")
+        .def("transform", py::overload_cast<const DateTimeArray&, Frame, Frame, Vectors, py::object>(&transform_vectors),
+             py::arg("from_frame"), py::arg("to_frame"), py::arg("positions"), py::arg("velocities")=py::none(),
+             "Rotate (N,3) positions, and velocities if given, from one frame to another.")
+        .def("transform_quaternions", &transform_quaternions, py::arg("from_frame"), py::arg("to_frame"),
+             py::arg("dtype")=py::dtype::of<double>(), R"mydelimiter(
+            (N,4) unit quaternions (x, y, z, w), as in scipy, of the rotations from one frame to another
+
+            :param dtype: float64 (32 bytes per epoch) or float32 (16 bytes per epoch, good to ~1e-7 rad)
+            )mydelimiter")
+        .def("rotation_history", [](const DateTimeArray& self, Frame from, Frame to) {
+            ReadScope scope(self);
+            return self.rotation_history(from, to);
+        }, py::arg("from_frame"), py::arg("to_frame"), R"mydelimiter(
+            Keyframes of the rotation from one frame to another at these epochs, for cheap interpolation at any
+            epoch in between. The epochs must be increasing and less than 12 hours apart. The interpolation error
+            is measured halfway between keyframes and kept as max_error.
+            )mydelimiter")
+        .def("look_angles", &look_angles, py::arg("positions"), py::arg("sites"), py::arg("min_elevation")=0.0, R"mydelimiter(
+            Azimuth, elevation and range of a target from many ground sites
+
+            :param positions: (N,3) J2000 positions of the target [km], one per epoch
+            :param sites: (M,3) WGS84 geodetic latitude, longitude [rad] and altitude [km] of the sites
+            :param min_elevation: Elevation cutoff of the visibility mask [rad]
+            :return: Dict of (M,N) arrays: azimuth (from north through east, [0, 2 pi)), elevation [rad], range [km] and
+                visible (elevation >= min_elevation)
+            )mydelimiter")
+    ;
+
+    py::class_<RotationHistory>(m, "RotationHistory", R"mydelimiter(
+        Keyframes of a frame rotation, interpolated by SLERP at any epoch between the first and the last.
+        Built by DateTimeArray.rotation_history.
+        )mydelimiter")
+        .def("__len__", &RotationHistory::size)
+        .def_property_readonly("max_error", &RotationHistory::max_error,
+                               "Largest interpolation error found halfway between the keyframes [rad].")
+        .def("quaternions", [](const RotationHistory& history, const DateTimeArray& epochs) {
+            std::vector<Eigen::Quaterniond> quats;
+            {
+                ReadScope scope(epochs);
+                quats = history_at(history, epochs);
+            }
+            return own_quaternions(std::move(quats));
+        }, py::arg("epochs"), "(N,4) unit quaternions (x, y, z, w) at the epochs, raises IndexError outside the keyframes.")
+        .def("matrices", [](const RotationHistory& history, const DateTimeArray& epochs) {
+            std::vector<Eigen::Matrix3d> mats;
+            {
+                ReadScope scope(epochs);
+                std::vector<Eigen::Quaterniond> quats = history_at(history, epochs);
+                mats.resize(quats.size());
+                for (size_t i = 0; i < quats.size(); i++) {
+                    mats[i] = quats[i].toRotationMatrix();
+                }
+            }
+            return own_matrices(std::move(mats));
+        }, py::arg("epochs"), "(N,3,3) rotation matrices at the epochs, raises IndexError outside the keyframes.")
     ;
+
+    // each chunk is built when it is reached and owns its columns, so iterating keeps one chunk alive at a time
+    py::class_<EpochChunks>(m, "EpochChunks")
+        .def("__len__", &EpochChunks::size)
+        .def("__getitem__", [](const EpochChunks& chunks, int64_t k) {
+            if (k < 0) {
+                k += chunks.size();
+            }
+            if (k < 0 || k >= chunks.size()) {
+                throw py::index_error("chunk index out of range");
+            }
+            py::gil_scoped_release release;
+            return chunks.chunk(k);
+        })
+        .def("__iter__", [](const EpochChunks& chunks) {
+            return py::make_iterator(chunks.begin(), chunks.end());
+        }, py::keep_alive<0, 1>())
+        .def_property_readonly("n_epochs", &EpochChunks::n_epochs)
+        .def_property_readonly("chunk_size", &EpochChunks::chunk_size)
+        ;
 }
\ No newline at end of file
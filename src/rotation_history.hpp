@@ -0,0 +1,141 @@
+#pragma once
+#ifdef _MSC_VER
+    #define _USE_MATH_DEFINES // For MS Visual Studio
+    #include <math.h>
+#else
+    #include <cmath>
+#endif
+#include "Eigen/Eigen"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "parallel.hpp"
+#include "profile.hpp"
+
+// Frame rotations as unit quaternions, and histories of them interpolated between sparse keyframes.
+//
+// A quaternion takes 32 bytes (16 in single precision) against 72 for the 3x3 matrix. RotationHistory keeps
+// keyframes and answers any epoch between them by SLERP, which turns at a constant rate about a fixed axis. The
+// Earth-fixed frames spin at a constant rate about an axis that itself drifts slowly (precession, nutation,
+// polar motion), so SLERP is off by about h^2 / 8 |omega x omega_pole| halfway between keyframes h apart. Between
+// ITRF and J2000 that stays under the ~5e-9 rad the exact model resolves anyway (Julian dates in doubles are
+// good to ~40 us) up to h = 2 h, and is 3e-8 rad at h = 6 h. Between TOD and J2000 it is 1e-12 rad at h = 10 min.
+// Keyframes must be less than half a turn apart (12 h for the Earth-fixed frames), SLERP takes the shorter way
+// round.
+
+// unit quaternion of a rotation matrix, w >= 0
+Eigen::Quaterniond matrix_to_quaternion(const Eigen::Matrix3d& M) {
+    Eigen::Quaterniond q(M);
+    q.normalize();
+    if (q.w() < 0.0) {
+        q.coeffs() = -q.coeffs();
+    }
+    return q;
+}
+
+// angle of the rotation taking one unit quaternion to the other [rad]
+double quaternion_angle(const Eigen::Quaterniond& a, const Eigen::Quaterniond& b) {
+    Eigen::Quaterniond d = a.conjugate() * b;
+    return 2.0 * atan2(d.vec().norm(), fabs(d.w()));
+}
+
+class RotationHistory {
+    private:
+        std::vector<int64_t> epochs_; // nanoseconds of TAI since J2000, strictly increasing
+        std::vector<Eigen::Quaterniond> keyframes_;
+        std::vector<Eigen::Vector4d> steps_; // rotation from keyframe k to k + 1: unit axis and half the angle
+        double max_error_;
+
+        // SLERP within keyframe interval k, epoch in [epochs_[k], epochs_[k + 1]]: a fraction of the step
+        // applied to keyframe k, one sine and cosine per epoch
+        Eigen::Quaterniond interpolate(int k, int64_t epoch) const {
+            double s = static_cast<double>(epoch - epochs_[k]) / static_cast<double>(epochs_[k + 1] - epochs_[k]);
+            const Eigen::Vector4d& step = steps_[k];
+            double half_angle = s * step(3);
+            double sin_half = sin(half_angle);
+            Eigen::Quaterniond partial(cos(half_angle), sin_half * step(0), sin_half * step(1), sin_half * step(2));
+            return keyframes_[k] * partial;
+        }
+
+        // keyframe interval holding an epoch inside the history, the last one for the last keyframe
+        int interval(int64_t epoch) const {
+            int k = std::upper_bound(epochs_.begin(), epochs_.end() - 1, epoch) - epochs_.begin() - 1;
+            return std::max(k, 0);
+        }
+
+        void check_range(int64_t epoch) const {
+            if (epoch < epochs_.front() || epoch > epochs_.back()) {
+                throw std::out_of_range("epoch outside the keyframes of the rotation history");
+            }
+        }
+
+    public:
+        // max_error is the interpolation error the keyframes are known to keep within [rad], as measured by
+        // DateTimeArray::rotation_history
+        RotationHistory(std::vector<int64_t> epochs, std::vector<Eigen::Quaterniond> keyframes, double max_error)
+            : epochs_(std::move(epochs)), keyframes_(std::move(keyframes)), max_error_(max_error) {
+            if (epochs_.size() != keyframes_.size() || epochs_.size() < 2) {
+                throw std::invalid_argument("a rotation history needs at least two keyframes, one per epoch");
+            }
+            steps_.resize(epochs_.size() - 1);
+            for (size_t k = 1; k < epochs_.size(); k++) {
+                if (epochs_[k] <= epochs_[k - 1]) {
+                    throw std::invalid_argument("the keyframe epochs must be strictly increasing");
+                }
+                // the shorter way round, q and -q being the same rotation
+                Eigen::Quaterniond step = keyframes_[k - 1].conjugate() * keyframes_[k];
+                if (step.w() < 0.0) {
+                    step.coeffs() = -step.coeffs();
+                }
+                double sin_half = step.vec().norm();
+                Eigen::Vector3d axis = sin_half > 0.0 ? Eigen::Vector3d(step.vec() / sin_half) : Eigen::Vector3d::Zero();
+                steps_[k - 1] << axis, atan2(sin_half, step.w());
+            }
+        }
+
+        int size() const {
+            return epochs_.size();
+        }
+
+        double max_error() const {
+            return max_error_;
+        }
+
+        const std::vector<int64_t>& epochs() const {
+            return epochs_;
+        }
+
+        const std::vector<Eigen::Quaterniond>& keyframes() const {
+            return keyframes_;
+        }
+
+        // rotation at an epoch in nanoseconds of TAI since J2000, throws std::out_of_range outside the keyframes
+        Eigen::Quaterniond at(int64_t epoch) const {
+            check_range(epoch);
+            return interpolate(interval(epoch), epoch);
+        }
+
+        // Rotations at n epochs. Each thread looks its first epoch up by bisection and then walks the keyframes
+        // forward, so sorted epochs cost O(1) each.
+        void at(const int64_t* epochs, int n, Eigen::Quaterniond* out) const {
+            PROFILE_SCOPE("history.at", n);
+            for (int i = 0; i < n; i++) {
+                check_range(epochs[i]);
+            }
+            int last = size() - 2;
+            parallel_for(n, [&](int begin, int end) {
+                int k = 0;
+                for (int i = begin; i < end; i++) {
+                    int64_t epoch = epochs[i];
+                    if (i == begin || epoch < epochs_[k]) {
+                        k = interval(epoch);
+                    }
+                    while (k < last && epoch > epochs_[k + 1]) {
+                        k++;
+                    }
+                    out[i] = interpolate(k, epoch);
+                }
+            });
+        }
+};
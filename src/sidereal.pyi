@@ -1,44 +1,53 @@
 from __future__ import annotations
 import numpy
+import numpy.typing
 import typing
 
 __all__ = [
     "DateTime",
     "DateTimeArray",
+    "EpochChunks",
+    "Frame",
+    "RotationHistory",
     "TimeDelta",
+    "TimeScale",
     "arange",
+    "arange_chunks",
+    "convert_time_scale",
     "days",
+    "eop_mjd_range",
+    "get_interpolation_tolerance",
+    "get_isa",
+    "get_num_threads",
     "hours",
     "jd_to_datetime",
     "linspace",
+    "linspace_chunks",
+    "load_eop",
+    "load_eop_cache",
     "minutes",
     "months",
     "nanoseconds",
     "now",
+    "profile_enabled",
+    "profile_stats",
+    "reset_eop",
+    "reset_profile_stats",
     "seconds",
+    "set_interpolation_tolerance",
+    "set_isa",
+    "set_num_threads",
+    "sidereal_time",
     "years",
 ]
 
 class DateTime:
-    day: int
-    gast: float
-    gmst: float
-    hour: int
-    jd_tai: float
-    jd_tt: float
-    jd_ut1: float
-    jd_utc: float
-    minute: int
-    mjd_tai: float
-    mjd_tt: float
-    mjd_ut1: float
-    mjd_utc: float
-    month: int
-    nanosecond: int
-    px: float
-    py: float
-    second: int
-    year: int
+    """
+    A UTC epoch, stored as integer nanoseconds since J2000 (2000-01-01 12:00:00 UTC)
+
+    Epochs are supported for the years 1708 to 2291, constructors and conversions from Julian dates, Unix time
+    or calendar fields raise IndexError outside them.
+    """
     def __add__(self, arg0: TimeDelta) -> DateTime: ...
     def __init__(
         self,
@@ -50,6 +59,13 @@ class DateTime:
         second: int = 0,
         nanosecond: int = 0,
     ) -> None: ...
+    def __eq__(self, arg0: DateTime) -> bool: ...
+    def __ge__(self, arg0: DateTime) -> bool: ...
+    def __gt__(self, arg0: DateTime) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __le__(self, arg0: DateTime) -> bool: ...
+    def __lt__(self, arg0: DateTime) -> bool: ...
+    def __ne__(self, arg0: DateTime) -> bool: ...
     def __repr__(self) -> str: ...
     def __str__(self) -> str: ...
     @typing.overload
@@ -62,31 +78,241 @@ class DateTime:
     def mod_to_tod(self) -> numpy.ndarray: ...
     def teme_to_gtod(self) -> numpy.ndarray: ...
     def tod_to_teme(self) -> numpy.ndarray: ...
+    @typing.overload
+    def transform(self, from_frame: Frame, to_frame: Frame) -> numpy.ndarray: ...
+    @typing.overload
+    def transform(self, from_frame: Frame, to_frames: list[Frame]) -> list[numpy.ndarray]: ...
+    @property
+    def day(self) -> int: ...
+    @property
+    def gast(self) -> float: ...
+    @property
+    def gmst(self) -> float: ...
+    @property
+    def hour(self) -> int: ...
+    @property
+    def jd_tai(self) -> float: ...
+    @property
+    def jd_tt(self) -> float: ...
+    @property
+    def jd_ut1(self) -> float: ...
+    @property
+    def jd_utc(self) -> float: ...
+    @property
+    def minute(self) -> int: ...
+    @property
+    def mjd_tai(self) -> float: ...
+    @property
+    def mjd_tt(self) -> float: ...
+    @property
+    def mjd_ut1(self) -> float: ...
+    @property
+    def mjd_utc(self) -> float: ...
+    @property
+    def month(self) -> int: ...
+    @property
+    def nanosecond(self) -> int: ...
+    @property
+    def nanoseconds_since_j2000(self) -> int: ...
+    @property
+    def px(self) -> float: ...
+    @property
+    def py(self) -> float: ...
+    @property
+    def second(self) -> int: ...
+    @property
+    def tai_minus_utc(self) -> float: ...
+    @property
+    def ut1_minus_utc(self) -> float: ...
+    @property
+    def year(self) -> int: ...
 
 class DateTimeArray:
+    def __add__(self, arg0: TimeDelta) -> DateTimeArray: ...
     def __getitem__(self, arg0: int) -> DateTime: ...
+    def __iadd__(self, arg0: TimeDelta) -> DateTimeArray: ...
     def __init__(self, arg0: list[DateTime]) -> None: ...
+    def __isub__(self, arg0: TimeDelta) -> DateTimeArray: ...
     def __len__(self) -> int: ...
-    def gast(self) -> list[float]: ...
-    def gmst(self) -> list[float]: ...
-    def gtod_to_itrf(self) -> list[numpy.ndarray]: ...
-    def itrf_to_j2000(self) -> list[numpy.ndarray]: ...
-    def j2000_to_mod(self) -> list[numpy.ndarray]: ...
-    def jd_tai(self) -> list[float]: ...
-    def jd_tt(self) -> list[float]: ...
-    def jd_ut1(self) -> list[float]: ...
-    def jd_utc(self) -> list[float]: ...
-    def mjd_tai(self) -> list[float]: ...
-    def mjd_tt(self) -> list[float]: ...
-    def mjd_ut1(self) -> list[float]: ...
-    def mjd_utc(self) -> list[float]: ...
-    def mod_to_tod(self) -> list[numpy.ndarray]: ...
-    def px(self) -> list[float]: ...
-    def py(self) -> list[float]: ...
-    def tai_minus_utc(self) -> list[float]: ...
-    def teme_to_gtod(self) -> list[numpy.ndarray]: ...
-    def tod_to_teme(self) -> list[numpy.ndarray]: ...
-    def ut1_minus_utc(self) -> list[float]: ...
+    def __sub__(self, arg0: TimeDelta) -> DateTimeArray: ...
+    def day(self) -> numpy.ndarray: ...
+    @staticmethod
+    def from_calendar(year: numpy.ndarray, month: numpy.ndarray, day: numpy.ndarray, hour: numpy.ndarray | None = None, minute: numpy.ndarray | None = None, second: numpy.ndarray | None = None, nanosecond: numpy.ndarray | None = None) -> DateTimeArray:
+        """
+        Build from calendar field arrays, fields outside their usual range roll over like in DateTime.
+        """
+    @staticmethod
+    def from_datetime64(times: numpy.ndarray) -> DateTimeArray:
+        """
+        Build from a numpy datetime64 array (any unit, NaT is rejected, IndexError outside 1708 to 2262-04-11).
+        """
+    @staticmethod
+    def from_jd_utc(jd_utc: numpy.ndarray) -> DateTimeArray:
+        """
+        Build from an array of UTC Julian dates.
+        """
+    @staticmethod
+    def from_mjd_utc(mjd_utc: numpy.ndarray) -> DateTimeArray:
+        """
+        Build from an array of UTC modified Julian dates.
+        """
+    @staticmethod
+    def from_nanoseconds_since_j2000(nanoseconds: numpy.ndarray) -> DateTimeArray:
+        """
+        Build from an array of integer nanoseconds since J2000 (2000-01-01 12:00:00 UTC).
+        """
+    @staticmethod
+    def from_unix(seconds: numpy.ndarray) -> DateTimeArray:
+        """
+        Build from an array of Unix timestamps [s].
+        """
+    def gast(self) -> numpy.ndarray: ...
+    def gmst(self) -> numpy.ndarray: ...
+    @typing.overload
+    def gtod_to_itrf(self, *, quaternions: bool = False) -> numpy.ndarray: ...
+    @typing.overload
+    def gtod_to_itrf(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def gtod_to_itrf(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def gtod_to_teme(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def gtod_to_teme(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    def hour(self) -> numpy.ndarray: ...
+    @typing.overload
+    def itrf_to_gtod(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def itrf_to_gtod(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def itrf_to_j2000(self, *, quaternions: bool = False) -> numpy.ndarray: ...
+    @typing.overload
+    def itrf_to_j2000(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def itrf_to_j2000(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def j2000_to_itrf(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def j2000_to_itrf(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def j2000_to_mod(self, *, quaternions: bool = False) -> numpy.ndarray: ...
+    @typing.overload
+    def j2000_to_mod(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def j2000_to_mod(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def j2000_to_teme(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def j2000_to_teme(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    def jd_tai(self) -> numpy.ndarray: ...
+    def jd_tt(self) -> numpy.ndarray: ...
+    def jd_ut1(self) -> numpy.ndarray: ...
+    def jd_utc(self) -> numpy.ndarray: ...
+    def look_angles(
+        self, positions: numpy.ndarray, sites: numpy.ndarray, min_elevation: float = 0.0
+    ) -> dict[str, numpy.ndarray]: ...
+    def minute(self) -> numpy.ndarray: ...
+    def mjd_tai(self) -> numpy.ndarray: ...
+    def mjd_tt(self) -> numpy.ndarray: ...
+    def mjd_ut1(self) -> numpy.ndarray: ...
+    def mjd_utc(self) -> numpy.ndarray: ...
+    def month(self) -> numpy.ndarray: ...
+    @typing.overload
+    def mod_to_j2000(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def mod_to_j2000(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def mod_to_tod(self, *, quaternions: bool = False) -> numpy.ndarray: ...
+    @typing.overload
+    def mod_to_tod(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def mod_to_tod(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    def nanosecond(self) -> numpy.ndarray: ...
+    def nanoseconds_since_j2000(self) -> numpy.ndarray: ...
+    def px(self) -> numpy.ndarray: ...
+    def py(self) -> numpy.ndarray: ...
+    def rotation_history(self, from_frame: Frame, to_frame: Frame) -> RotationHistory: ...
+    def second(self) -> numpy.ndarray: ...
+    def tai_minus_utc(self) -> numpy.ndarray: ...
+    @typing.overload
+    def teme_to_gtod(self, *, quaternions: bool = False) -> numpy.ndarray: ...
+    @typing.overload
+    def teme_to_gtod(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def teme_to_gtod(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def teme_to_j2000(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def teme_to_j2000(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def teme_to_tod(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def teme_to_tod(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    def to_datetime64(self) -> numpy.ndarray:
+        """
+        The epochs as a new (N,) numpy datetime64[ns] array, IndexError for epochs past 2262-04-11.
+        """
+    def to_unix(self) -> numpy.ndarray:
+        """
+        Unix timestamps [s] as a new (N,) array.
+        """
+    @typing.overload
+    def tod_to_mod(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def tod_to_mod(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def tod_to_teme(self, *, quaternions: bool = False) -> numpy.ndarray: ...
+    @typing.overload
+    def tod_to_teme(self, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def tod_to_teme(self, positions: numpy.ndarray, velocities: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    @typing.overload
+    def transform(self, from_frame: Frame, to_frame: Frame) -> numpy.ndarray: ...
+    @typing.overload
+    def transform(self, from_frame: Frame, to_frames: list[Frame]) -> list[numpy.ndarray]: ...
+    @typing.overload
+    def transform(self, from_frame: Frame, to_frame: Frame, positions: numpy.ndarray, velocities: None = None) -> numpy.ndarray: ...
+    @typing.overload
+    def transform(
+        self, from_frame: Frame, to_frame: Frame, positions: numpy.ndarray, velocities: numpy.ndarray
+    ) -> tuple[numpy.ndarray, numpy.ndarray]: ...
+    def transform_quaternions(
+        self, from_frame: Frame, to_frame: Frame, dtype: numpy.typing.DTypeLike = numpy.float64
+    ) -> numpy.ndarray: ...
+    def ut1_minus_utc(self) -> numpy.ndarray: ...
+    def year(self) -> numpy.ndarray: ...
+
+class EpochChunks:
+    def __getitem__(self, arg0: int) -> DateTimeArray: ...
+    def __iter__(self) -> typing.Iterator[DateTimeArray]: ...
+    def __len__(self) -> int: ...
+    @property
+    def chunk_size(self) -> int: ...
+    @property
+    def n_epochs(self) -> int: ...
+
+class Frame:
+    GTOD: typing.ClassVar[Frame]
+    ITRF: typing.ClassVar[Frame]
+    J2000: typing.ClassVar[Frame]
+    MOD: typing.ClassVar[Frame]
+    TEME: typing.ClassVar[Frame]
+    TOD: typing.ClassVar[Frame]
+    __members__: typing.ClassVar[dict[str, Frame]]
+    def __eq__(self, other: typing.Any) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def value(self) -> int: ...
+
+class RotationHistory:
+    def __len__(self) -> int: ...
+    def matrices(self, epochs: DateTimeArray) -> numpy.ndarray: ...
+    def quaternions(self, epochs: DateTimeArray) -> numpy.ndarray: ...
+    @property
+    def max_error(self) -> float: ...
 
 class TimeDelta:
     days: int
@@ -110,6 +336,23 @@ class TimeDelta:
     def __str__(self) -> str: ...
     def total_seconds(self) -> float: ...
 
+class TimeScale:
+    GPS: typing.ClassVar[TimeScale]
+    TAI: typing.ClassVar[TimeScale]
+    TDB: typing.ClassVar[TimeScale]
+    TT: typing.ClassVar[TimeScale]
+    UT1: typing.ClassVar[TimeScale]
+    UTC: typing.ClassVar[TimeScale]
+    __members__: typing.ClassVar[dict[str, TimeScale]]
+    def __eq__(self, other: typing.Any) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def value(self) -> int: ...
+
 def arange(arg0: DateTime, arg1: DateTime, arg2: TimeDelta) -> DateTimeArray:
     """
     Generate DateTime objects between two specified DateTime points with a specified step size.
@@ -120,7 +363,52 @@ def arange(arg0: DateTime, arg1: DateTime, arg2: TimeDelta) -> DateTimeArray:
     :return: A vector of DateTime objects
     """
 
+def arange_chunks(dt1: DateTime, dt2: DateTime, step: TimeDelta, chunk_size: int = 65536) -> EpochChunks:
+    """
+    Same epochs as arange, produced lazily as DateTimeArrays of at most chunk_size epochs so memory stays bounded
+
+    :param dt1: The first DateTime
+    :param dt2: The second DateTime
+    :param step: The step size
+    :param chunk_size: The largest number of epochs per chunk
+    :return: An iterable of DateTimeArray chunks
+    """
+
+def convert_time_scale(epochs: numpy.ndarray, from_scale: TimeScale, to_scale: TimeScale) -> numpy.ndarray:
+    """
+    Convert raw epochs from one time scale to another, without building DateTime objects
+
+    Leap seconds and UT1-UTC come from the current EOP table. Inside a leap second UTC repeats 23:59:59, as Unix
+    time does. TDB follows the two-term series, good to about 10 us.
+
+    :param epochs: Array of any shape, integers in nanoseconds since J2000 read on the from_scale clock (GPS
+        seconds s since 1980-01-06 are (s - 630763200) * 10**9), or floating point Julian dates of from_scale
+    :param from_scale: TimeScale of the epochs
+    :param to_scale: TimeScale to convert to
+    :return: Array of the same shape, int64 nanoseconds or float64 Julian dates as given
+    """
+
 def days(arg0: int) -> TimeDelta: ...
+def eop_mjd_range() -> tuple[int, int]:
+    """
+    First and last MJD covered by the Earth orientation tables in use.
+    """
+
+def get_interpolation_tolerance() -> float:
+    """
+    Get the nutation and precession interpolation tolerance [rad].
+    """
+
+def get_isa() -> str:
+    """
+    Get the instruction set the batch kernels run with: baseline, avx2 or avx512.
+    """
+
+def get_num_threads() -> int:
+    """
+    Get the number of threads used by the batch routines.
+    """
+
 def hours(arg0: int) -> TimeDelta: ...
 def jd_to_datetime(arg0: float) -> DateTime:
     """
@@ -137,6 +425,34 @@ def linspace(arg0: DateTime, arg1: DateTime, arg2: int) -> DateTimeArray:
     :return: A vector of DateTime objects
     """
 
+def linspace_chunks(dt1: DateTime, dt2: DateTime, n: int, chunk_size: int = 65536) -> EpochChunks:
+    """
+    Same epochs as linspace, produced lazily as DateTimeArrays of at most chunk_size epochs so memory stays bounded
+
+    :param dt1: The first DateTime
+    :param dt2: The second DateTime
+    :param n: The number of DateTime objects to generate
+    :param chunk_size: The largest number of epochs per chunk
+    :return: An iterable of DateTimeArray chunks
+    """
+
+def load_eop(finals: str, tai_utc: str = "", cache: str = "") -> None:
+    """
+    Load Earth orientation data from IERS files, replacing the tables in use
+
+    :param finals: Path to an IERS finals (or USNO gpsrapid.out) file
+    :param tai_utc: Path to a USNO tai-utc.dat file, the current leap seconds are kept if empty
+    :param cache: If given, the parsed tables are also written to this binary cache for load_eop_cache
+    """
+
+def load_eop_cache(arg0: str) -> None:
+    """
+    Memory map a binary cache written by load_eop and use its tables. The SIDEREAL_EOP_CACHE environment
+    variable names a cache to map at import.
+
+    :param path: Path to the cache
+    """
+
 def minutes(arg0: int) -> TimeDelta: ...
 def months(arg0: int) -> TimeDelta: ...
 def nanoseconds(arg0: int) -> TimeDelta: ...
@@ -145,5 +461,60 @@ def now() -> DateTime:
     Get the current DateTime.
     """
 
+def profile_enabled() -> bool:
+    """
+    Whether the extension was built with the profiling probes.
+    """
+
+def profile_stats() -> dict[str, dict[str, float]]:
+    """
+    Time spent in the instrumented hot paths since start-up or the last reset_profile_stats()
+
+    :return: {probe name: {"calls", "seconds" (summed over threads), "items" (epochs processed)}},
+        empty unless the extension was built with SIDEREAL_PROFILE=1
+    """
+
+def reset_eop() -> None:
+    """
+    Go back to the Earth orientation tables compiled into the extension.
+    """
+
+def reset_profile_stats() -> None:
+    """
+    Zero the counters read by profile_stats().
+    """
+
 def seconds(arg0: int) -> TimeDelta: ...
+def set_interpolation_tolerance(arg0: float) -> None:
+    """
+    Let DateTimeArray interpolate nutation and precession between a few exact evaluations on dense epoch grids.
+    The interpolation is checked against the exact series and falls back to it if the tolerance can't be met cheaply.
+
+    :param tolerance: Largest error allowed [rad], 0 (the default) always evaluates the series exactly
+    """
+
+def set_isa(isa: str) -> None:
+    """
+    Force the instruction set the batch kernels run with, for testing and benchmarks
+
+    :param isa: "baseline", "avx2" or "avx512", raises ValueError if the CPU lacks it
+    """
+
+def set_num_threads(arg0: int) -> None:
+    """
+    Set the number of threads used by the batch routines (linspace, arange, DateTimeArray arithmetic and accessors)
+
+    :param n: The number of threads, 0 uses one thread per hardware core
+    """
+
+def sidereal_time(jd_ut1: numpy.ndarray, jd_tt: numpy.ndarray | None = None, rates: bool = False) -> dict[str, numpy.ndarray]:
+    """
+    Sidereal angles of many epochs from their Julian dates, without building DateTime objects or matrices
+
+    :param jd_ut1: Julian dates in UT1
+    :param jd_tt: Julian dates in TT, only needed for GAST (nutation and obliquity)
+    :param rates: Also return the rates gmst_rate and gast_rate [rad/s]
+    :return: Dict of arrays: gmst, era (Earth rotation angle) and, with jd_tt, gast [rad]
+    """
+
 def years(arg0: int) -> TimeDelta: ...
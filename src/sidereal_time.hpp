@@ -0,0 +1,169 @@
+#pragma once
+#ifdef _MSC_VER
+    #define _USE_MATH_DEFINES // For MS Visual Studio
+    #include <math.h>
+#else
+    #include <cmath>
+#endif
+#include <algorithm>
+#include <stdexcept>
+#include "dispatch.hpp"
+#include "interpolation.hpp"
+#include "math.hpp"
+#include "nutation.hpp"
+#include "parallel.hpp"
+#include "profile.hpp"
+
+// Sidereal time and Earth rotation angle.
+//
+// The scalar kernels are shared by DateTime and DateTimeArray. sidereal_time_batch() runs them over arrays of
+// Julian dates for callers that only need the angles (antenna schedulers, say), with no DateTime objects or
+// matrices: the nutation that GAST needs is evaluated block by block on the stack. The polynomials are in Horner
+// form, and GMST and the ERA split off the whole days of UT1 before scaling to seconds or turns, since the ~6e8
+// seconds since J2000 leave only ~1e-7 s of resolution in a double.
+
+const double SECONDS_PER_JULIAN_CENTURY = 36525.0 * 86400.0;
+const double EARTH_ROTATION_ANGLE_RATE = 2.0 * M_PI * 1.00273781191135448 / 86400.0; // [rad/s]
+
+double julian_centuries(double jd_tt) {
+    return (jd_tt - 2451545.0) / 36525.0;
+}
+
+// Greenwich mean sidereal time (IAU 1982) [rad], in [0, 2 pi)
+double greenwich_mean_sidereal_time(double jd_ut1) {
+    double du = jd_ut1 - 2451545.0; // days since J2000, 12h UT1
+    double T1 = du / 36525.0;
+    // the 876600 h * T1 term is 86400 s * du, only the fraction of the day of it matters
+    double sid_seconds = 67310.54841 + 86400.0 * (du - floor(du)) + T1 * (8640184.812866 + T1 * (0.093104 - T1 * 0.0000062));
+    sid_seconds -= 86400.0 * floor(sid_seconds / 86400.0);
+    return sid_seconds * (2.0 * M_PI / 86400.0);
+}
+
+// d GMST / dt [rad per second of UT1]
+double greenwich_mean_sidereal_rate(double jd_ut1) {
+    double T1 = (jd_ut1 - 2451545.0) / 36525.0;
+    double excess = 8640184.812866 + T1 * (2.0 * 0.093104 - T1 * 3.0 * 0.0000062); // sidereal over solar seconds per century
+    return (1.0 + excess / SECONDS_PER_JULIAN_CENTURY) * (2.0 * M_PI / 86400.0);
+}
+
+// Earth rotation angle (IERS Conventions 2010, eq. 5.15) [rad], in [0, 2 pi)
+double earth_rotation_angle(double jd_ut1) {
+    double du = jd_ut1 - 2451545.0;
+    double turns = (du - floor(du)) + 0.7790572732640 + 0.00273781191135448 * du;
+    return 2.0 * M_PI * (turns - floor(turns));
+}
+
+// mean longitude of the ascending node of the Moon [rad], T in julian centuries of TT
+double asc_node_moon(double T) {
+    return (450160.398036 + T * (-6962890.5431 + T * (7.4722 + T * (0.007702 - T * 0.00005939)))) / RAD_TO_ARCSECOND;
+}
+
+double mean_obliquity_of_ecliptic(double T) {
+    return dms_to_rad(23.43929111, 0, 0)
+        + T * (-dms_to_rad(0, 0, 46.8150) + T * (-dms_to_rad(0, 0, 0.00059) + T * dms_to_rad(0, 0, 0.001813)));
+}
+
+// GAST - GMST, with the terms in the Moon's node of the 1994 IAU resolution
+double equation_of_equinoxes(double T, double delta_psi, double epsilon_bar) {
+    double omega_moon = asc_node_moon(T);
+    return delta_psi * cos(epsilon_bar) + dms_to_rad(0, 0, 0.00264) * sin(omega_moon) + dms_to_rad(0, 0, 0.000063) * sin(2 * omega_moon);
+}
+
+double date_to_gast(double gmst, double T, double delta_psi, double epsilon_bar) {
+    return gmst + equation_of_equinoxes(T, delta_psi, epsilon_bar);
+}
+
+// gmst and gast of n epochs, built for each instruction set level
+void sidereal_times_kernel(const double* jd_ut1, const double* T, const double* delta_psi, const double* epsilon_bar, int n,
+                           double* gmst, double* gast) {
+    for (int i = 0; i < n; i++) {
+        gmst[i] = greenwich_mean_sidereal_time(jd_ut1[i]);
+        gast[i] = date_to_gast(gmst[i], T[i], delta_psi[i], epsilon_bar[i]);
+    }
+}
+
+SIDEREAL_DISPATCH(sidereal_times,
+                  (const double* jd_ut1, const double* T, const double* delta_psi, const double* epsilon_bar, int n,
+                   double* gmst, double* gast),
+                  (jd_ut1, T, delta_psi, epsilon_bar, n, gmst, gast))
+
+// gmst, era and the gmst rate of n epochs, outputs may be null, built for each instruction set level
+void rotation_angles_kernel(const double* jd_ut1, int n, double* gmst, double* era, double* gmst_rate) {
+    if (gmst) {
+        for (int i = 0; i < n; i++) {
+            gmst[i] = greenwich_mean_sidereal_time(jd_ut1[i]);
+        }
+    }
+    if (era) {
+        for (int i = 0; i < n; i++) {
+            era[i] = earth_rotation_angle(jd_ut1[i]);
+        }
+    }
+    if (gmst_rate) {
+        for (int i = 0; i < n; i++) {
+            gmst_rate[i] = greenwich_mean_sidereal_rate(jd_ut1[i]);
+        }
+    }
+}
+
+SIDEREAL_DISPATCH(rotation_angles, (const double* jd_ut1, int n, double* gmst, double* era, double* gmst_rate),
+                  (jd_ut1, n, gmst, era, gmst_rate))
+
+// Outputs of sidereal_time_batch, each an array of n or null if not wanted
+struct SiderealTimes {
+    double* gmst = nullptr;
+    double* gast = nullptr;
+    double* era = nullptr;
+    double* gmst_rate = nullptr; // [rad/s]
+    double* gast_rate = nullptr; // [rad/s], the rate of the equation of the equinoxes (< 1e-11 rad/s) is left out
+};
+
+// Sidereal angles of n epochs from their Julian dates. jd_tt is only read for GAST and may be null otherwise.
+// With an interpolation tolerance set (see interpolation.hpp) dense epochs interpolate the nutation series.
+void sidereal_time_batch(const double* jd_ut1, const double* jd_tt, int n, const SiderealTimes& out) {
+    if (out.gast && !jd_tt) {
+        throw std::invalid_argument("GAST needs the epochs in TT as well as in UT1");
+    }
+    PROFILE_SCOPE("sidereal.batch", n);
+    auto exact = [](const double* T, int m, double* const* columns) {
+        delta_psi_delta_epsilon(T, m, columns[0], columns[1]);
+    };
+    double tolerance = get_interpolation_tolerance();
+    ChebyshevSeries<2> series(0.0, 0.0, 0.0, 0, exact);
+    if (out.gast && tolerance > 0.0 && n > 0) {
+        auto range = std::minmax_element(jd_tt, jd_tt + n);
+        series = ChebyshevSeries<2>(julian_centuries(*range.first), julian_centuries(*range.second), tolerance, n / 4, exact);
+    }
+    parallel_for(n, [&](int begin, int end) {
+        const int block = 256;
+        double T[block];
+        double delta_psi[block];
+        double delta_eps[block];
+        double epsilon_bar[block];
+        double gmst[block];
+        for (int start = begin; start < end; start += block) {
+            int b = std::min(block, end - start);
+            const double* ut1 = jd_ut1 + start;
+            if (out.gast) {
+                for (int e = 0; e < b; e++) {
+                    T[e] = julian_centuries(jd_tt[start + e]);
+                    epsilon_bar[e] = mean_obliquity_of_ecliptic(T[e]);
+                }
+                if (series.valid()) {
+                    double* columns[2] = {delta_psi, delta_eps};
+                    series.evaluate(T, b, columns);
+                } else {
+                    delta_psi_delta_epsilon(T, b, delta_psi, delta_eps);
+                }
+                sidereal_times(ut1, T, delta_psi, epsilon_bar, b, out.gmst ? out.gmst + start : gmst, out.gast + start);
+                rotation_angles(ut1, b, nullptr, out.era ? out.era + start : nullptr, out.gmst_rate ? out.gmst_rate + start : nullptr);
+            } else {
+                rotation_angles(ut1, b, out.gmst ? out.gmst + start : nullptr, out.era ? out.era + start : nullptr,
+                                out.gmst_rate ? out.gmst_rate + start : nullptr);
+            }
+            if (out.gast_rate) {
+                rotation_angles(ut1, b, nullptr, nullptr, out.gast_rate + start);
+            }
+        }
+    }, 1024);
+}
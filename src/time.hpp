@@ -7,10 +7,26 @@
 #include "Eigen/Eigen"
 #include <iostream>
 #include "math.hpp"
+#include "calendar.hpp"
+#include "dispatch.hpp"
 #include "iau1980.hpp"
+#include "nutation.hpp"
+#include "sidereal_time.hpp"
+#include "topocentric.hpp"
+#include "rotation_history.hpp"
+#include "time_scales.hpp"
+#include "eop_loader.hpp"
+#include "parallel.hpp"
+#include "interpolation.hpp"
+#include "profile.hpp"
 #include <chrono>
-
-double RAD_TO_ARCSECOND = 180.0 * 3600.0 / M_PI;
+#include <iterator>
+#include <limits>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <cstdint>
+#include <stdexcept>
 
 class TimeDelta {
     public:
@@ -38,505 +54,1477 @@ class TimeDelta {
         const double total_seconds() {
             return years * 365.25 * 24 * 60 * 60 + months * 31 * 24 * 60 * 60 + days * 24 * 60 * 60 + hours * 60 * 60 + minutes * 60 + seconds + nanoseconds / 1e9; // Note: assumes 31 days in a month
         }
-        
+
+        // years and months have no fixed length, they are applied on the calendar
+        bool has_calendar_part() const {
+            return years != 0 || months != 0;
+        }
+
+        // exact length of the days through nanoseconds fields
+        int64_t fixed_nanoseconds() const {
+            int64_t secs = ((static_cast<int64_t>(days) * 24 + hours) * 60 + minutes) * 60 + seconds;
+            return secs * NANOSECONDS_PER_SECOND + nanoseconds;
+        }
+
+        TimeDelta operator-() const {
+            return TimeDelta(-years, -months, -days, -hours, -minutes, -seconds, -nanoseconds);
+        }
 };
 
-class DateTime {
-    private:
-        void setup() {
-            while (nanosecond >= 1e9) {
-                nanosecond -= 1e9;
-                second += 1;
-            }
-            while (second >= 60) {
-                second -= 60;
-                minute += 1;
-            }
-            while (minute >= 60) {
-                minute -= 60;
-                hour += 1;
-            }
-            while (hour >= 24) {
-                hour -= 24;
-                day += 1;
-            }
-            jd_utc = julian_date();
-            mjd_utc = modified_julian_date();
-
-            tai_minus_utc = compute_tai_minus_utc();
-            ut1_minus_utc = compute_utc_minus_ut1();
-
-            jd_ut1 = jd_utc + ut1_minus_utc / 86400.0;
-            mjd_ut1 = mjd_utc + ut1_minus_utc / 86400.0;
-            jd_tai = jd_utc + tai_minus_utc / 86400.0;
-            mjd_tai = mjd_utc + tai_minus_utc / 86400.0;
-            jd_tt = jd_tai + TT_MINUS_TAI / 86400.0;
-            mjd_tt = mjd_tai + TT_MINUS_TAI / 86400.0;
-
-            T = julian_centuries();
-            epsilon_bar = mean_obliquity_of_ecliptic();
-            gmst = greenwich_mean_sidereal_time();
-            std::vector<double> dpsi_deps = delta_psi_delta_epsilon();
-            delta_psi = dpsi_deps[0];
-            delta_eps = dpsi_deps[1];
-            gast = date_to_gast();
-
-            std::vector<double> eop = eop_py_px();
-            px = eop[0];
-            py = eop[1];
+// splits a duration into days, hours, minutes, seconds and nanoseconds that all carry its sign
+TimeDelta nanoseconds_to_timedelta(int64_t ns) {
+    int days = static_cast<int>(ns / NANOSECONDS_PER_DAY);
+    ns %= NANOSECONDS_PER_DAY;
+    int hours = static_cast<int>(ns / (3600 * NANOSECONDS_PER_SECOND));
+    ns %= 3600 * NANOSECONDS_PER_SECOND;
+    int minutes = static_cast<int>(ns / (60 * NANOSECONDS_PER_SECOND));
+    ns %= 60 * NANOSECONDS_PER_SECOND;
+    int seconds = static_cast<int>(ns / NANOSECONDS_PER_SECOND);
+    return TimeDelta(0, 0, days, hours, minutes, seconds, static_cast<int>(ns % NANOSECONDS_PER_SECOND));
+}
+
+// shifts an epoch by whole calendar months, keeping the day of month and time of day (overflowing days roll over)
+int64_t add_calendar_months(int64_t ns, int months) {
+    if (months == 0) {
+        return ns;
+    }
+    int64_t since_midnight = ns + NANOSECONDS_PER_DAY / 2;
+    int64_t days = floor_div(since_midnight, NANOSECONDS_PER_DAY);
+    int64_t time_of_day = since_midnight - days * NANOSECONDS_PER_DAY;
+    int year, month, day;
+    civil_from_days(days + J2000_UNIX_DAYS, year, month, day);
+    int64_t new_days = days_from_civil(year, static_cast<int64_t>(month) + months, day) - J2000_UNIX_DAYS;
+    return new_days * NANOSECONDS_PER_DAY + time_of_day - NANOSECONDS_PER_DAY / 2;
+}
+
+// the epoch shifted by a TimeDelta, calendar part first
+int64_t add_timedelta(int64_t ns, const TimeDelta& tdelta) {
+    if (tdelta.has_calendar_part()) {
+        ns = add_calendar_months(ns, 12 * tdelta.years + tdelta.months);
+    }
+    return ns + tdelta.fixed_nanoseconds();
+}
+
+// Shifts n epochs by a TimeDelta, out may alias ns. Deltas without years or months, which is what light time
+// and clock corrections are, add one fixed offset to every epoch in a loop the compiler vectorizes.
+void shift_nanoseconds(const int64_t* ns, int n, const TimeDelta& tdelta, int64_t* out) {
+    PROFILE_SCOPE("array.shift", n);
+    if (tdelta.has_calendar_part()) {
+        parallel_for(n, [&](int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                out[i] = add_timedelta(ns[i], tdelta);
+            }
+        });
+        return;
+    }
+    int64_t offset = tdelta.fixed_nanoseconds();
+    parallel_for(n, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            out[i] = ns[i] + offset;
         }
-    public:
-        int year;
-        int month;
-        int day;
-        int hour;
-        int minute;
-        int second;
-        int nanosecond;
-        double jd_utc;
-        double jd_ut1;
-        double jd_tai;
-        double jd_tt;
-        double mjd_utc;
-        double mjd_ut1;
-        double mjd_tai;
-        double mjd_tt;
-        double T;
-        double gmst;
-        double gast;
-        double delta_psi;
-        double delta_eps;
-        double epsilon_bar;
-        double px;
-        double py;
-        double tai_minus_utc;
-        double ut1_minus_utc;
-        Eigen::MatrixXd P;
-        Eigen::MatrixXd Theta;
-        Eigen::MatrixXd N;
-        Eigen::MatrixXd Pi;
-        // constructor if nanoseconds are given
-        DateTime(int year, int month, int day, int hour, int minute, int second, int nanosecond)
-            : year(year), month(month), day(day), hour(hour), minute(minute), second(second), nanosecond(nanosecond) {
-                // set its julian date
-                setup();
+    }, 65536);
+}
+
+// groups of derived quantities that DateTime and DateTimeArray evaluate on first access
+enum EvaluatedGroup : unsigned char {
+    EVALUATED_TIME_SCALES = 1 << 0, // includes the pole coordinates, they come from the same table lookup
+    EVALUATED_NUTATION = 1 << 1,
+    EVALUATED_SIDEREAL = 1 << 2,
+    EVALUATED_MJD = 1 << 3,
+    EVALUATED_JULIAN = 1 << 4,
+    EVALUATED_CALENDAR = 1 << 5,
+};
+
+// Tracks which groups have been evaluated, with a lock so concurrent readers fill each group exactly once, and a
+// shared lock that readers hold against an in-place shift. Copies take over the flags but get their own locks.
+struct EvaluationState {
+    std::atomic<unsigned char> flags;
+    std::mutex mutex;
+    std::shared_mutex shift;
+
+    EvaluationState() : flags(0) {}
+    EvaluationState(const EvaluationState& other) : flags(other.flags.load()) {}
+    EvaluationState& operator=(const EvaluationState& other) {
+        flags = other.flags.load();
+        return *this;
+    }
+
+    bool is_evaluated(unsigned char group) const {
+        return flags.load(std::memory_order_acquire) & group;
+    }
+
+    void mark_evaluated(unsigned char group) {
+        flags.fetch_or(group, std::memory_order_release);
+    }
+};
+
+// Frame rotations, each built in closed form on the stack
+
+Eigen::Matrix3d j2000_to_mod(double T) {
+    // P = r3(-z) * r2(theta) * r3(-zeta)
+    double zeta = dms_to_rad(0, 0, T * (2306.2181 + T * (0.30188 + T * 0.017998)));
+    double theta = dms_to_rad(0, 0, T * (2004.3109 + T * (-0.42665 - T * 0.041833)));
+    double z = dms_to_rad(0, 0, T * (2306.2181 + T * (1.09468 + T * 0.018203)));
+    double cze = cos(zeta), sze = sin(zeta);
+    double cth = cos(theta), sth = sin(theta);
+    double cz = cos(z), sz = sin(z);
+    Eigen::Matrix3d P;
+    P << cz * cth * cze - sz * sze, -cz * cth * sze - sz * cze, -cz * sth,
+         sz * cth * cze + cz * sze, -sz * cth * sze + cz * cze, -sz * sth,
+         sth * cze, -sth * sze, cth;
+    return P;
+}
+
+Eigen::Matrix3d mod_to_tod(double epsilon_bar, double delta_psi, double delta_eps) {
+    // N = r1(-epsilon_bar - delta_eps) * r3(-delta_psi) * r1(epsilon_bar)
+    double ce = cos(epsilon_bar), se = sin(epsilon_bar);
+    double cet = cos(epsilon_bar + delta_eps), set = sin(epsilon_bar + delta_eps);
+    double cp = cos(delta_psi), sp = sin(delta_psi);
+    Eigen::Matrix3d N;
+    N << cp, -sp * ce, -sp * se,
+         cet * sp, cet * cp * ce + set * se, cet * cp * se - set * ce,
+         set * sp, set * cp * ce - cet * se, set * cp * se + cet * ce;
+    return N;
+}
+
+Eigen::Matrix3d tod_to_teme(double delta_psi, double epsilon_bar) {
+    double dpsi_cos_eps = delta_psi * cos(epsilon_bar);
+    return r3(dpsi_cos_eps);
+}
+
+Eigen::Matrix3d teme_to_gtod(double gmst) {
+    return r3(gmst);
+}
+
+Eigen::Matrix3d gtod_to_itrf(double px, double py) {
+    // Pi = r2(y_p) * r1(x_p)
+    double x_p = dms_to_rad(0, 0, px);
+    double y_p = dms_to_rad(0, 0, py);
+    double cx = cos(x_p), sx = sin(x_p);
+    double cy = cos(y_p), sy = sin(y_p);
+    Eigen::Matrix3d Pi;
+    Pi << cy, sy * sx, -sy * cx,
+          0, cx, sx,
+          sy, -cy * sx, cy * cx;
+    return Pi;
+}
+
+// precession and nutation together, mod_to_tod * j2000_to_mod
+Eigen::Matrix3d j2000_to_tod(double T, double epsilon_bar, double delta_psi, double delta_eps) {
+    return mod_to_tod(epsilon_bar, delta_psi, delta_eps) * j2000_to_mod(T);
+}
+
+// the full chain given j2000_to_tod, with the two z rotations of teme_to_gtod and tod_to_teme fused into one
+Eigen::Matrix3d itrf_to_j2000(const Eigen::Matrix3d& PN, double epsilon_bar, double delta_psi, double gmst, double px, double py) {
+    Eigen::Matrix3d R = gtod_to_itrf(px, py) * (r3(gmst + delta_psi * cos(epsilon_bar)) * PN);
+    return R.transpose();
+}
+
+Eigen::Matrix3d itrf_to_j2000(double T, double epsilon_bar, double delta_psi, double delta_eps, double gmst, double px, double py) {
+    return itrf_to_j2000(j2000_to_tod(T, epsilon_bar, delta_psi, delta_eps), epsilon_bar, delta_psi, gmst, px, py);
+}
+
+// Frames of the reduction chain in order, each one is reached from the previous one by a single rotation
+enum class Frame { J2000, MOD, TOD, TEME, GTOD, ITRF };
+
+const int N_FRAMES = 6;
+
+// which angle groups the steps between two frames of the chain use
+bool needs_nutation(Frame lowest, Frame highest) {
+    return lowest < Frame::TEME && highest > Frame::MOD;
+}
+
+bool needs_sidereal(Frame lowest, Frame highest) {
+    return lowest <= Frame::TEME && highest >= Frame::GTOD;
+}
+
+const double EARTH_ROTATION_RATE = 7.292115146706979e-5; // [rad/s]
+
+// what the rotations of one epoch are built from
+struct FrameAngles {
+    double T;
+    double epsilon_bar;
+    double delta_psi;
+    double delta_eps;
+    double gmst;
+    double px;
+    double py;
+};
+
+// rotation from the given frame to the next one in the chain
+Eigen::Matrix3d frame_step(Frame from, const FrameAngles& a) {
+    switch (from) {
+        case Frame::J2000: return j2000_to_mod(a.T);
+        case Frame::MOD: return mod_to_tod(a.epsilon_bar, a.delta_psi, a.delta_eps);
+        case Frame::TOD: return tod_to_teme(a.delta_psi, a.epsilon_bar);
+        case Frame::TEME: return teme_to_gtod(a.gmst);
+        default: return gtod_to_itrf(a.px, a.py);
+    }
+}
+
+// Rotates a position, and a velocity [position unit / s] if given, between two frames of the chain one step at a time.
+// Crossing between TEME and GTOD adds or removes the velocity of the rotating Earth frame, omega x r.
+void transform_state(Frame from, Frame to, const FrameAngles& a, Eigen::Vector3d& r, Eigen::Vector3d* v) {
+    const Eigen::Vector3d omega(0.0, 0.0, EARTH_ROTATION_RATE);
+    for (Frame f = from; f < to; f = static_cast<Frame>(static_cast<int>(f) + 1)) {
+        Eigen::Matrix3d M = frame_step(f, a);
+        r = M * r;
+        if (v) {
+            *v = M * *v;
+            if (f == Frame::TEME) {
+                *v -= omega.cross(r);
             }
-        
-        // constructor if seconds are given as double
-        DateTime(int year, int month, int day, int hour, int minute, double second)
-            : year(year), month(month), day(day), hour(hour), minute(minute), second(static_cast<int>(second)), nanosecond(static_cast<int>((second - static_cast<int>(second)) * 1e9)) {
-                setup();
+        }
+    }
+    for (Frame f = from; f > to; f = static_cast<Frame>(static_cast<int>(f) - 1)) {
+        Frame lower = static_cast<Frame>(static_cast<int>(f) - 1);
+        Eigen::Matrix3d M = frame_step(lower, a);
+        if (v) {
+            if (lower == Frame::TEME) {
+                *v += omega.cross(r);
             }
-        
-    
-    // print when called with std::cout
-    friend std::ostream& operator<<(std::ostream& os, const DateTime dtime) {
-        os << dtime.year << "-" << dtime.month << "-" << dtime.day << " " << dtime.hour << ":" << dtime.minute << ":" << dtime.second << "." << dtime.nanosecond;
-        return os;
-    } 
-
-    double modified_julian_date() {
-        return jd_utc - 2400000.5;
+            *v = M.transpose() * *v;
+        }
+        r = M.transpose() * r;
     }
+}
 
-    double julian_date() {
-        int y = year;
-        int m = month;
-        if (month <= 2) {
-            y = year - 1;
-            m = month + 12;
+// Rotations from one frame to any number of others, out[k] takes vectors from `from` to targets[k]. The path
+// between two frames of the chain is the run of steps between them, so the chain is walked once over the span
+// of all the frames involved and every step is built once however many targets share it.
+void frame_transforms(Frame from, const Frame* targets, int n_targets, const FrameAngles& a, Eigen::Matrix3d* out) {
+    int lowest = static_cast<int>(from);
+    int highest = lowest;
+    for (int k = 0; k < n_targets; k++) {
+        lowest = std::min(lowest, static_cast<int>(targets[k]));
+        highest = std::max(highest, static_cast<int>(targets[k]));
+    }
+    // rotation from the lowest frame to each frame of the span
+    Eigen::Matrix3d from_lowest[N_FRAMES];
+    from_lowest[lowest].setIdentity();
+    for (int f = lowest; f < highest; f++) {
+        from_lowest[f + 1] = frame_step(static_cast<Frame>(f), a) * from_lowest[f];
+    }
+    int source = static_cast<int>(from);
+    for (int k = 0; k < n_targets; k++) {
+        int target = static_cast<int>(targets[k]);
+        if (source == lowest) {
+            out[k] = from_lowest[target];
+        } else if (target == lowest) {
+            out[k] = from_lowest[source].transpose();
+        } else {
+            out[k] = from_lowest[target] * from_lowest[source].transpose();
         }
-        int B = floor(y / 400) - floor(y / 100);
-        return floor(365.25 * y) + floor(30.6001 * (m + 1)) + B + 1720996.5 + day + (hour + (minute + (second + (nanosecond / 1e9)) / 60) / 60) / 24;
     }
+}
 
-    double julian_centuries() {
-        return (jd_tt - 2451545.0) / 36525.0;
+Eigen::Matrix3d frame_transform(Frame from, Frame to, const FrameAngles& a) {
+    Eigen::Matrix3d M;
+    frame_transforms(from, &to, 1, a, &M);
+    return M;
+}
+
+// span of the chain covered by from and all the targets
+void frame_span(Frame from, const std::vector<Frame>& targets, Frame& lowest, Frame& highest) {
+    lowest = highest = from;
+    for (Frame target : targets) {
+        lowest = std::min(lowest, target);
+        highest = std::max(highest, target);
+    }
+}
+
+// The angles of many epochs as columns, the groups the frames in use do not need may be left null
+struct FrameAngleColumns {
+    const double* T = nullptr;
+    const double* epsilon_bar = nullptr;
+    const double* delta_psi = nullptr;
+    const double* delta_eps = nullptr;
+    const double* gmst = nullptr;
+    const double* px = nullptr;
+    const double* py = nullptr;
+
+    FrameAngles operator[](int i) const {
+        return {T[i], epsilon_bar ? epsilon_bar[i] : 0.0, delta_psi ? delta_psi[i] : 0.0, delta_eps ? delta_eps[i] : 0.0,
+                gmst ? gmst[i] : 0.0, px[i], py[i]};
     }
+};
 
-    double greenwich_mean_sidereal_time() {
-        double T1 = (jd_ut1 - 2451545.0) / 36525.0;  // Time since Jan 1 2000, 12h UT to now
-        double sid_seconds = fmod(67310.54841 
-        + (876600.0 * 3600.0 + 8640184.812866) * T1 
-        + 0.093104 * pow(T1, 2.0) 
-        - 0.0000062 * pow(T1, 3.0), 86400);
-        return sid_seconds / 86400.0 * 2.0 * M_PI;
+// Batch versions of frame_transforms and transform_state over epochs [begin, end), built for each instruction set
+// level. stacks[k][i] takes the rotation to targets[k] at epoch i, scratch holds n_targets matrices.
+void frame_transforms_kernel(Frame from, const Frame* targets, int n_targets, const FrameAngleColumns& angles, int begin,
+                             int end, Eigen::Matrix3d* scratch, std::vector<Eigen::Matrix3d>* stacks) {
+    for (int i = begin; i < end; i++) {
+        frame_transforms(from, targets, n_targets, angles[i], scratch);
+        for (int k = 0; k < n_targets; k++) {
+            stacks[k][i] = scratch[k];
+        }
     }
+}
 
-    double asc_node_moon() {
-        double Omega = 450160.398036 + T * (-6962890.5431 + 7.4722 * T + 0.007702 * pow(T, 2) - 0.00005939 * pow(T,3)) / RAD_TO_ARCSECOND;
-        return Omega;
+// positions and velocities are rows of 3 doubles, velocities may be null, the outputs may alias the inputs
+void transform_states_kernel(Frame from, Frame to, const FrameAngleColumns& angles, int begin, int end,
+                             const double* positions, double* positions_out, const double* velocities, double* velocities_out) {
+    for (int i = begin; i < end; i++) {
+        FrameAngles a = angles[i];
+        Eigen::Vector3d r = Eigen::Map<const Eigen::Vector3d>(positions + 3 * i);
+        if (velocities) {
+            Eigen::Vector3d v = Eigen::Map<const Eigen::Vector3d>(velocities + 3 * i);
+            transform_state(from, to, a, r, &v);
+            Eigen::Map<Eigen::Vector3d>(velocities_out + 3 * i) = v;
+        } else {
+            transform_state(from, to, a, r, nullptr);
+        }
+        Eigen::Map<Eigen::Vector3d>(positions_out + 3 * i) = r;
     }
+}
 
-    double mean_obliquity_of_ecliptic() {
-        double epsilon = dms_to_rad(23.43929111, 0, 0) \
-            - dms_to_rad(0, 0, 46.8150) * T \
-            - dms_to_rad(0, 0, 0.00059) * pow(T,2) \
-            + dms_to_rad(0, 0, 0.001813) * pow(T,3);
-        return epsilon;
+// rotations from one frame to another over epochs [begin, end) as unit quaternions, out[i - begin] for epoch i
+void frame_quaternions_kernel(Frame from, Frame to, const FrameAngleColumns& angles, int begin, int end, Eigen::Quaterniond* out) {
+    for (int i = begin; i < end; i++) {
+        Eigen::Matrix3d M;
+        frame_transforms(from, &to, 1, angles[i], &M);
+        out[i - begin] = matrix_to_quaternion(M);
     }
+}
 
-    std::vector<double> delta_psi_delta_epsilon() {
-        double days_since_j2k = 36525.0 * T;
-        double l = 2 * M_PI * (0.374897 + 0.03629164709 * days_since_j2k);
-        double lprime = 2 * M_PI * (0.993126 + 0.00273777850 * days_since_j2k);
-        double F = (335779.526232 + T * (1739527262.8478 - 12.7512 * T - 0.001037 * pow(T, 2) + 0.00000417 * pow(T,3))) / RAD_TO_ARCSECOND;
-        double D = (1072260.70369 + T * (1602961601.2090 - 6.3706 * T + 0.00693 * pow(T, 2) - 0.00003169 * pow(T, 3))) / RAD_TO_ARCSECOND;
-        double Omega = (450160.398036 + T * (-6962890.5431 + 7.4722 * T + 0.007702 * pow(T, 2) - 0.00005939 * pow(T, 3))) / RAD_TO_ARCSECOND;
+SIDEREAL_DISPATCH(frame_transforms,
+                  (Frame from, const Frame* targets, int n_targets, const FrameAngleColumns& angles, int begin, int end,
+                   Eigen::Matrix3d* scratch, std::vector<Eigen::Matrix3d>* stacks),
+                  (from, targets, n_targets, angles, begin, end, scratch, stacks))
+SIDEREAL_DISPATCH(frame_quaternions,
+                  (Frame from, Frame to, const FrameAngleColumns& angles, int begin, int end, Eigen::Quaterniond* out),
+                  (from, to, angles, begin, end, out))
+SIDEREAL_DISPATCH(transform_states,
+                  (Frame from, Frame to, const FrameAngleColumns& angles, int begin, int end, const double* positions,
+                   double* positions_out, const double* velocities, double* velocities_out),
+                  (from, to, angles, begin, end, positions, positions_out, velocities, velocities_out))
 
-        Eigen::VectorXd deltaPsi_i = deg_to_rad((P6 + T * P7) / 3600e4);
-        // Computes the change in the equinox
-        Eigen::VectorXd deltaepsilon_i = deg_to_rad((P8 + T * P9) / 3600e4);
-        // Computes the change in the ecliptic
+class DateTime {
+    private:
+        int64_t ns_;
+        mutable unsigned char evaluated = 0;
+
+        mutable CalendarFields calendar_;
+        mutable double jd_utc_;
+        mutable double mjd_utc_;
+        mutable double jd_ut1_;
+        mutable double jd_tai_;
+        mutable double jd_tt_;
+        mutable double T_;
+        mutable double gmst_;
+        mutable double gast_;
+        mutable double delta_psi_;
+        mutable double delta_eps_;
+        mutable double epsilon_bar_;
+        mutable double px_;
+        mutable double py_;
+        mutable double tai_minus_utc_;
+        mutable double ut1_minus_utc_;
+
+        void evaluate_calendar() const {
+            if (evaluated & EVALUATED_CALENDAR) {
+                return;
+            }
+            calendar_ = nanoseconds_to_calendar(ns_);
+            evaluated |= EVALUATED_CALENDAR;
+        }
 
-        Eigen::VectorXd phi_i = PL * l + PLPRIME * lprime + PF * F + PD * D + POMEGA * Omega;
-        // Series form of phi
+        void evaluate_julian() const {
+            if (evaluated & EVALUATED_JULIAN) {
+                return;
+            }
+            jd_utc_ = nanoseconds_to_jd(ns_);
+            mjd_utc_ = jd_utc_ - 2400000.5;
+            evaluated |= EVALUATED_JULIAN;
+        }
 
-        Eigen::VectorXd cos_phi = phi_i.array().cos();
-        Eigen::VectorXd sin_phi = phi_i.array().sin();
+        void evaluate_time_scales() const {
+            if (evaluated & EVALUATED_TIME_SCALES) {
+                return;
+            }
+            PROFILE_SCOPE("datetime.evaluate_time_scales", 1);
+            evaluate_julian();
+            EopRecord eop = current_eop_table()->lookup(mjd_utc_);
+            tai_minus_utc_ = eop.tai_minus_utc;
+            ut1_minus_utc_ = eop.ut1_minus_utc;
+            px_ = eop.px;
+            py_ = eop.py;
+
+            jd_ut1_ = jd_utc_ + ut1_minus_utc_ / 86400.0;
+            jd_tai_ = jd_utc_ + tai_minus_utc_ / 86400.0;
+            jd_tt_ = jd_tai_ + TT_MINUS_TAI / 86400.0;
+            T_ = ::julian_centuries(jd_tt_);
+            evaluated |= EVALUATED_TIME_SCALES;
+        }
+
+        void evaluate_nutation() const {
+            if (evaluated & EVALUATED_NUTATION) {
+                return;
+            }
+            PROFILE_SCOPE("datetime.evaluate_nutation", 1);
+            evaluate_time_scales();
+            epsilon_bar_ = ::mean_obliquity_of_ecliptic(T_);
+            ::delta_psi_delta_epsilon(T_, delta_psi_, delta_eps_);
+            evaluated |= EVALUATED_NUTATION;
+        }
 
-        double delta_psi = (deltaPsi_i.array() * sin_phi.array()).sum();
-        double delta_eps = (deltaepsilon_i.array() * cos_phi.array()).sum();
+        void evaluate_sidereal() const {
+            if (evaluated & EVALUATED_SIDEREAL) {
+                return;
+            }
+            PROFILE_SCOPE("datetime.evaluate_sidereal", 1);
+            evaluate_nutation();
+            gmst_ = ::greenwich_mean_sidereal_time(jd_ut1_);
+            gast_ = ::date_to_gast(gmst_, T_, delta_psi_, epsilon_bar_);
+            evaluated |= EVALUATED_SIDEREAL;
+        }
 
-        return std::vector<double>({delta_psi, delta_eps});
-    }
+        // only the groups the steps between lowest and highest need are evaluated
+        FrameAngles frame_angles(Frame lowest, Frame highest) const {
+            FrameAngles a = {T(), 0.0, 0.0, 0.0, 0.0, px(), py()};
+            if (needs_nutation(lowest, highest)) {
+                a.epsilon_bar = epsilon_bar();
+                a.delta_psi = delta_psi();
+                a.delta_eps = delta_eps();
+            }
+            if (needs_sidereal(lowest, highest)) {
+                a.gmst = gmst();
+            }
+            return a;
+        }
 
-    double compute_tai_minus_utc() {
-        // find the first index where jd is greater than leap_jds
-        int ind = 0;
-        while (jd_utc > LEAP_JDS[ind]) {
-            ind++;
-            if(ind == LEAP_JDS.size()) {
-                break;
+        // llround is only defined while the nanoseconds fit in an int64
+        static int64_t seconds_to_nanoseconds(double second) {
+            if (!(fabs(second) < 9.2e9)) {
+                throw std::out_of_range(EPOCH_RANGE_ERROR);
             }
+            return llround(second * NANOSECONDS_PER_SECOND);
         }
-        ind--;
-        return TAI_MINUS_UTC[ind];
+
+    public:
+        // constructor if nanoseconds are given, any field may be out of its usual range, throws std::out_of_range
+        // for epochs outside the years 1708 to 2291
+        DateTime(int year, int month, int day, int hour, int minute, int second, int nanosecond)
+            : ns_(checked_civil_to_nanoseconds(year, month, day, hour, minute, second, nanosecond)) {}
+        
+        // constructor if seconds are given as double
+        DateTime(int year, int month, int day, int hour, int minute, double second)
+            : ns_(checked_civil_to_nanoseconds(year, month, day, hour, minute, 0, seconds_to_nanoseconds(second))) {}
+
+        // constructor from nanoseconds since J2000 (2000-01-01 12:00:00 UTC)
+        explicit DateTime(int64_t nanoseconds_since_j2000) : ns_(nanoseconds_since_j2000) {}
+        
+    
+    // print when called with std::cout
+    friend std::ostream& operator<<(std::ostream& os, const DateTime dtime) {
+        os << dtime.year() << "-" << dtime.month() << "-" << dtime.day() << " " << dtime.hour() << ":" << dtime.minute() << ":" << dtime.second() << "." << dtime.nanosecond();
+        return os;
+    } 
+
+    int64_t nanoseconds_since_j2000() const { return ns_; }
+
+    // calendar fields, derived on first access
+    int year() const { evaluate_calendar(); return calendar_.year; }
+    int month() const { evaluate_calendar(); return calendar_.month; }
+    int day() const { evaluate_calendar(); return calendar_.day; }
+    int hour() const { evaluate_calendar(); return calendar_.hour; }
+    int minute() const { evaluate_calendar(); return calendar_.minute; }
+    int second() const { evaluate_calendar(); return calendar_.second; }
+    int nanosecond() const { evaluate_calendar(); return calendar_.nanosecond; }
+
+    // derived quantities, computed on first access
+    double jd_utc() const { evaluate_julian(); return jd_utc_; }
+    double mjd_utc() const { evaluate_julian(); return mjd_utc_; }
+    double jd_ut1() const { evaluate_time_scales(); return jd_ut1_; }
+    double mjd_ut1() const { return mjd_utc() + ut1_minus_utc() / 86400.0; }
+    double jd_tai() const { evaluate_time_scales(); return jd_tai_; }
+    double mjd_tai() const { return mjd_utc() + tai_minus_utc() / 86400.0; }
+    double jd_tt() const { evaluate_time_scales(); return jd_tt_; }
+    double mjd_tt() const { return mjd_tai() + TT_MINUS_TAI / 86400.0; }
+    double T() const { evaluate_time_scales(); return T_; }
+    double tai_minus_utc() const { evaluate_time_scales(); return tai_minus_utc_; }
+    double ut1_minus_utc() const { evaluate_time_scales(); return ut1_minus_utc_; }
+    double epsilon_bar() const { evaluate_nutation(); return epsilon_bar_; }
+    double delta_psi() const { evaluate_nutation(); return delta_psi_; }
+    double delta_eps() const { evaluate_nutation(); return delta_eps_; }
+    double gmst() const { evaluate_sidereal(); return gmst_; }
+    double gast() const { evaluate_sidereal(); return gast_; }
+    double px() const { evaluate_time_scales(); return px_; }
+    double py() const { evaluate_time_scales(); return py_; }
+
+    double modified_julian_date() const {
+        return mjd_utc();
     }
 
-    double compute_utc_minus_ut1() {
-        int ind0 = floor(mjd_utc) - vEOPMJD[0];
-        double mjd_frac = mjd_utc - floor(mjd_utc);
-        return (1-mjd_frac) * vUTC_MINUS_UT1[ind0] + mjd_frac * vUTC_MINUS_UT1[ind0+1];
+    double julian_date() const {
+        return jd_utc();
     }
 
-    Eigen::Matrix3d j2000_to_mod() {
-        double zeta = dms_to_rad(0, 0, 2306.2181 * T + 0.30188 * pow(T, 2) + 0.017998 * pow(T, 3));
-        double theta = dms_to_rad(0, 0, 2004.3109 * T - 0.42665 * pow(T, 2) - 0.041833 * pow(T, 3));
-        double z = dms_to_rad(0, 0, 2306.2181 * T + 1.09468 * pow(T, 2) + 0.018203 * pow(T, 3));
-        Eigen::Matrix3d P = r3(-z) * r2(theta) * r3(-zeta);
-        return P;
+    double asc_node_moon() const {
+        return ::asc_node_moon(T());
     }
 
-    Eigen::Matrix3d mod_to_tod() {
-        Eigen::Matrix3d N = r1(-epsilon_bar - delta_eps) * r3(-delta_psi) * r1(epsilon_bar);
-        return N;
+    Eigen::Matrix3d j2000_to_mod() const {
+        return ::j2000_to_mod(T());
     }
 
-    Eigen::Matrix3d tod_to_teme() {
-        double dpsi_cos_eps = delta_psi * cos(epsilon_bar);
-        return r3(dpsi_cos_eps);
+    Eigen::Matrix3d mod_to_tod() const {
+        return ::mod_to_tod(epsilon_bar(), delta_psi(), delta_eps());
     }
 
-    Eigen::Matrix3d teme_to_gtod() {
-        return r3(gmst);
+    Eigen::Matrix3d tod_to_teme() const {
+        return ::tod_to_teme(delta_psi(), epsilon_bar());
     }
 
-    Eigen::Matrix3d gtod_to_itrf() {
-        // only if Pi is not already computed
-        double x_p = dms_to_rad(0, 0, px);
-        double y_p = dms_to_rad(0, 0, py);
-        Pi = r2(y_p) * r1(x_p);
-        return Pi;
+    Eigen::Matrix3d teme_to_gtod() const {
+        return ::teme_to_gtod(gmst());
     }
 
-    Eigen::Matrix3d itrf_to_j2000() {
-        return (gtod_to_itrf() * teme_to_gtod() * tod_to_teme() * mod_to_tod() * j2000_to_mod()).transpose();
+    Eigen::Matrix3d gtod_to_itrf() const {
+        return ::gtod_to_itrf(px(), py());
     }
 
-    double date_to_gast() {
-        double omega_moon = asc_node_moon();
-        double gast = gmst + delta_psi * cos(epsilon_bar) + dms_to_rad(0, 0, 0.00264) * sin(omega_moon) + dms_to_rad(0, 0, 0.000063) * sin(2 * omega_moon);
-        return gast;
+    Eigen::Matrix3d itrf_to_j2000() const {
+        return ::itrf_to_j2000(T(), epsilon_bar(), delta_psi(), delta_eps(), gmst(), px(), py());
     }
 
-    std::vector<double> eop_py_px() {
-        int ind0 = floor(mjd_utc) - vEOPMJD[0];
-        double mjd_frac = mjd_utc - floor(mjd_utc);
-        double pxi = (1-mjd_frac) * vEOPx[ind0] + mjd_frac * vEOPx[ind0+1];
-        double pyi = (1-mjd_frac) * vEOPy[ind0] + mjd_frac * vEOPy[ind0+1];
-        return std::vector<double>({pxi, pyi});
+    // rotation between any two frames of the chain
+    Eigen::Matrix3d transform(Frame from, Frame to) const {
+        return frame_transform(from, to, frame_angles(std::min(from, to), std::max(from, to)));
     }
 
+    // rotations from one frame to several, the steps they have in common are built once
+    std::vector<Eigen::Matrix3d> transform(Frame from, const std::vector<Frame>& to) const {
+        Frame lowest, highest;
+        frame_span(from, to, lowest, highest);
+        std::vector<Eigen::Matrix3d> mats(to.size());
+        frame_transforms(from, to.data(), to.size(), frame_angles(lowest, highest), mats.data());
+        return mats;
+    }
 
     DateTime operator+(const TimeDelta& tdelta) const {
-        int y = year + tdelta.years;
-        int m = month + tdelta.months;
-        int d = day + tdelta.days;
-        int h = hour + tdelta.hours;
-        int min = minute + tdelta.minutes;
-        int s = second + tdelta.seconds;
-        int ns = nanosecond + tdelta.nanoseconds;
-        return DateTime(y, m, d, h, min, s, ns);
+        return DateTime(add_timedelta(ns_, tdelta));
     }
 
     DateTime operator-(const TimeDelta& tdelta) const {
-        int y = year - tdelta.years;
-        int m = month - tdelta.months;
-        int d = day - tdelta.days;
-        int h = hour - tdelta.hours;
-        int min = minute - tdelta.minutes;
-        int s = second - tdelta.seconds;
-        int ns = nanosecond - tdelta.nanoseconds;
-        return DateTime(y, m, d, h, min, s, ns);
+        return DateTime(add_timedelta(ns_, -tdelta));
     }
 
     TimeDelta operator-(const DateTime& dtime) const {
-        int y = year - dtime.year;
-        int m = month - dtime.month;
-        int d = day - dtime.day;
-        int h = hour - dtime.hour;
-        int min = minute - dtime.minute;
-        int s = second - dtime.second;
-        int ns = nanosecond - dtime.nanosecond;
-        return TimeDelta(y, m, d, h, min, s, ns);
+        return nanoseconds_to_timedelta(ns_ - dtime.ns_);
     }
+
+    bool operator==(const DateTime& dtime) const { return ns_ == dtime.ns_; }
+    bool operator!=(const DateTime& dtime) const { return ns_ != dtime.ns_; }
+    bool operator<(const DateTime& dtime) const { return ns_ < dtime.ns_; }
+    bool operator<=(const DateTime& dtime) const { return ns_ <= dtime.ns_; }
+    bool operator>(const DateTime& dtime) const { return ns_ > dtime.ns_; }
+    bool operator>=(const DateTime& dtime) const { return ns_ >= dtime.ns_; }
 };
 
 DateTime jd_to_datetime(double jd) {
-    int a = floor(jd + 0.5);
-    int b = floor((a - 1867216.25) / 36524.25);
-    int c;
-    if (a < 2299161) {
-        c = a + 1524;
-    } else {
-        c = a + b - floor(b / 4) + 1525;
-    }
-    int d = floor((c - 122.1) / 365.25);
-    int e = floor(365.25 * d);
-    int f = floor((c - e) / 30.6001);
-    int D = (c - e - floor(30.6001 * f) + (jd + 0.5 - a));
-    int M = (f - 1 - 12 * floor(f / 14));
-    int Y = (d - 4715 - floor((7 + M) / 10));
-    double dy_frac = fmod(jd - floor(jd) + 0.5, 1);
-    double add_sec = dy_frac * 86400.0;
-    int hr = floor(add_sec / 3600);
-    add_sec -= hr * 3600;
-    int min = floor(add_sec / 60);
-    add_sec -= min * 60;
-    return DateTime(Y, M, D, hr, min, add_sec);
-};
+    return DateTime(checked_jd_to_nanoseconds(jd));
+}
 
 class DateTimeArray {
+    private:
+        mutable EvaluationState state;
+
+        // one contiguous column per quantity, derived columns are filled on first access
+        std::vector<int64_t> ns_;
+        mutable std::vector<double> jd_utc_;
+        mutable std::vector<double> mjd_utc_;
+        mutable std::vector<double> jd_ut1_;
+        mutable std::vector<double> mjd_ut1_;
+        mutable std::vector<double> jd_tai_;
+        mutable std::vector<double> mjd_tai_;
+        mutable std::vector<double> jd_tt_;
+        mutable std::vector<double> mjd_tt_;
+        mutable std::vector<double> T_;
+        mutable std::vector<double> gmst_;
+        mutable std::vector<double> gast_;
+        mutable std::vector<double> delta_psi_;
+        mutable std::vector<double> delta_eps_;
+        mutable std::vector<double> epsilon_bar_;
+        mutable std::vector<double> px_;
+        mutable std::vector<double> py_;
+        mutable std::vector<double> tai_minus_utc_;
+        mutable std::vector<double> ut1_minus_utc_;
+        mutable std::vector<int> year_;
+        mutable std::vector<int> month_;
+        mutable std::vector<int> day_;
+        mutable std::vector<int> hour_;
+        mutable std::vector<int> minute_;
+        mutable std::vector<int> second_;
+        mutable std::vector<int> nanosecond_;
+
+        void evaluate_calendar() const {
+            if (state.is_evaluated(EVALUATED_CALENDAR)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (state.is_evaluated(EVALUATED_CALENDAR)) {
+                return;
+            }
+            PROFILE_SCOPE("array.evaluate_calendar", size());
+            int n = size();
+            for (std::vector<int>* column : {&year_, &month_, &day_, &hour_, &minute_, &second_, &nanosecond_}) {
+                column->resize(n);
+            }
+            parallel_for(n, [&](int begin, int end) {
+                nanoseconds_to_calendar(ns_.data() + begin, end - begin, year_.data() + begin, month_.data() + begin,
+                                        day_.data() + begin, hour_.data() + begin, minute_.data() + begin,
+                                        second_.data() + begin, nanosecond_.data() + begin);
+            });
+            state.mark_evaluated(EVALUATED_CALENDAR);
+        }
+
+        void evaluate_julian() const {
+            if (state.is_evaluated(EVALUATED_JULIAN)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (state.is_evaluated(EVALUATED_JULIAN)) {
+                return;
+            }
+            PROFILE_SCOPE("array.evaluate_julian", size());
+            int n = size();
+            jd_utc_.resize(n);
+            mjd_utc_.resize(n);
+            parallel_for(n, [&](int begin, int end) {
+                nanoseconds_to_jd(ns_.data() + begin, end - begin, jd_utc_.data() + begin);
+                for (int i = begin; i < end; i++) {
+                    mjd_utc_[i] = jd_utc_[i] - 2400000.5;
+                }
+            });
+            state.mark_evaluated(EVALUATED_JULIAN);
+        }
+
+        void evaluate_time_scales() const {
+            if (state.is_evaluated(EVALUATED_TIME_SCALES)) {
+                return;
+            }
+            evaluate_julian();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (state.is_evaluated(EVALUATED_TIME_SCALES)) {
+                return;
+            }
+            PROFILE_SCOPE("array.evaluate_time_scales", size());
+            int n = size();
+            tai_minus_utc_.resize(n);
+            ut1_minus_utc_.resize(n);
+            jd_ut1_.resize(n);
+            jd_tai_.resize(n);
+            jd_tt_.resize(n);
+            T_.resize(n);
+            px_.resize(n);
+            py_.resize(n);
+            // one table for the whole array even if another one is swapped in meanwhile
+            std::shared_ptr<const EopTable> eop = current_eop_table();
+            parallel_for(n, [&](int begin, int end) {
+                eop->lookup(mjd_utc_.data() + begin, end - begin, tai_minus_utc_.data() + begin, ut1_minus_utc_.data() + begin,
+                                 px_.data() + begin, py_.data() + begin);
+                for (int i = begin; i < end; i++) {
+                    jd_ut1_[i] = jd_utc_[i] + ut1_minus_utc_[i] / 86400.0;
+                    jd_tai_[i] = jd_utc_[i] + tai_minus_utc_[i] / 86400.0;
+                    jd_tt_[i] = jd_tai_[i] + TT_MINUS_TAI / 86400.0;
+                    T_[i] = julian_centuries(jd_tt_[i]);
+                }
+            });
+            state.mark_evaluated(EVALUATED_TIME_SCALES);
+        }
+
+        void evaluate_mjd() const {
+            if (state.is_evaluated(EVALUATED_MJD)) {
+                return;
+            }
+            evaluate_time_scales();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (state.is_evaluated(EVALUATED_MJD)) {
+                return;
+            }
+            PROFILE_SCOPE("array.evaluate_mjd", size());
+            int n = size();
+            mjd_ut1_.resize(n);
+            mjd_tai_.resize(n);
+            mjd_tt_.resize(n);
+            for (int i = 0; i < n; i++) {
+                mjd_ut1_[i] = mjd_utc_[i] + ut1_minus_utc_[i] / 86400.0;
+                mjd_tai_[i] = mjd_utc_[i] + tai_minus_utc_[i] / 86400.0;
+                mjd_tt_[i] = mjd_tai_[i] + TT_MINUS_TAI / 86400.0;
+            }
+            state.mark_evaluated(EVALUATED_MJD);
+        }
+
+        void evaluate_nutation() const {
+            if (state.is_evaluated(EVALUATED_NUTATION)) {
+                return;
+            }
+            evaluate_time_scales();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (state.is_evaluated(EVALUATED_NUTATION)) {
+                return;
+            }
+            PROFILE_SCOPE("array.evaluate_nutation", size());
+            int n = size();
+            epsilon_bar_.resize(n);
+            delta_psi_.resize(n);
+            delta_eps_.resize(n);
+            parallel_for(n, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    epsilon_bar_[i] = mean_obliquity_of_ecliptic(T_[i]);
+                }
+            });
+            // dense grids can interpolate the series between a few exact evaluations, see interpolation.hpp
+            ChebyshevSeries<2> series = interpolate_over_T<2>([](const double* T, int m, double* const* columns) {
+                delta_psi_delta_epsilon(T, m, columns[0], columns[1]);
+            });
+            parallel_for(n, [&](int begin, int end) {
+                if (series.valid()) {
+                    double* columns[2] = {delta_psi_.data() + begin, delta_eps_.data() + begin};
+                    series.evaluate(T_.data() + begin, end - begin, columns);
+                } else {
+                    delta_psi_delta_epsilon(T_.data() + begin, end - begin, delta_psi_.data() + begin, delta_eps_.data() + begin);
+                }
+            }, 256);
+            state.mark_evaluated(EVALUATED_NUTATION);
+        }
+
+        void evaluate_sidereal() const {
+            if (state.is_evaluated(EVALUATED_SIDEREAL)) {
+                return;
+            }
+            evaluate_nutation();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (state.is_evaluated(EVALUATED_SIDEREAL)) {
+                return;
+            }
+            PROFILE_SCOPE("array.evaluate_sidereal", size());
+            int n = size();
+            gmst_.resize(n);
+            gast_.resize(n);
+            parallel_for(n, [&](int begin, int end) {
+                sidereal_times(jd_ut1_.data() + begin, T_.data() + begin, delta_psi_.data() + begin, epsilon_bar_.data() + begin,
+                               end - begin, gmst_.data() + begin, gast_.data() + begin);
+            });
+            state.mark_evaluated(EVALUATED_SIDEREAL);
+        }
+
+        // Piecewise fit of exact over the T range of the array when an interpolation tolerance is set. The fit may
+        // use up to a quarter as many exact evaluations as there are epochs, otherwise it comes back invalid.
+        template <int n_values, typename Fn>
+        ChebyshevSeries<n_values> interpolate_over_T(const Fn& exact) const {
+            double tolerance = get_interpolation_tolerance();
+            if (tolerance <= 0.0 || T_.empty()) {
+                return ChebyshevSeries<n_values>(0.0, 0.0, 0.0, 0, exact);
+            }
+            auto range = std::minmax_element(T_.begin(), T_.end());
+            ChebyshevSeries<n_values> series(*range.first, *range.second, tolerance, size() / 4, exact);
+            if (!series.valid()) {
+                PROFILE_COUNT("interpolation.fallback", size());
+            }
+            return series;
+        }
+
+        // the angle columns, only the groups the steps between lowest and highest need are set
+        FrameAngleColumns frame_angle_columns(Frame lowest, Frame highest) const {
+            FrameAngleColumns columns;
+            columns.T = T_.data();
+            columns.px = px_.data();
+            columns.py = py_.data();
+            if (needs_nutation(lowest, highest)) {
+                columns.epsilon_bar = epsilon_bar_.data();
+                columns.delta_psi = delta_psi_.data();
+                columns.delta_eps = delta_eps_.data();
+            }
+            if (needs_sidereal(lowest, highest)) {
+                columns.gmst = gmst_.data();
+            }
+            return columns;
+        }
+
+        void evaluate_frames(Frame lowest, Frame highest) const {
+            evaluate_time_scales();
+            if (needs_nutation(lowest, highest)) {
+                evaluate_nutation();
+            }
+            if (needs_sidereal(lowest, highest)) {
+                evaluate_sidereal();
+            }
+        }
+
     public:
-        std::vector<DateTime> vec;
+        // constructor from nanoseconds since J2000 (2000-01-01 12:00:00 UTC)
+        DateTimeArray(std::vector<int64_t> nanoseconds_since_j2000) : ns_(std::move(nanoseconds_since_j2000)) {}
 
-        DateTimeArray(std::vector<DateTime> vec) : vec(vec) {}
+        DateTimeArray(const std::vector<DateTime>& vec) {
+            ns_.reserve(vec.size());
+            for (const DateTime& dt : vec) {
+                ns_.push_back(dt.nanoseconds_since_j2000());
+            }
+        }
 
+        // the shifted epochs only, derived columns are evaluated on access like for any new array
         DateTimeArray operator+(const TimeDelta& tdelta) const {
-            std::vector<DateTime> new_vec;
-            int size_vec = vec.size();
-            for (int i = 0; i < size_vec; i++) {
-                new_vec.push_back(vec[i] + tdelta);
-            }
-            return DateTimeArray(new_vec);
+            std::vector<int64_t> new_ns(size());
+            shift_nanoseconds(ns_.data(), size(), tdelta, new_ns.data());
+            return DateTimeArray(std::move(new_ns));
         }
         DateTimeArray operator-(const TimeDelta& tdelta) const {
-            std::vector<DateTime> new_vec;
-            int size_vec = vec.size();
-            for (int i = 0; i < size_vec; i++) {
-                new_vec.push_back(vec[i] - tdelta);
+            return *this + (-tdelta);
+        }
+
+        // Shifts every epoch in place. The groups evaluated before are evaluated again in bulk into the same
+        // buffers, so views of the columns handed out earlier stay valid and follow the shift; the others are
+        // left for first access. Waits for the threads holding read_lock() and keeps them out until the columns
+        // are consistent again; readers without it must not run concurrently.
+        DateTimeArray& operator+=(const TimeDelta& tdelta) {
+            std::unique_lock<std::shared_mutex> lock(state.shift);
+            shift_nanoseconds(ns_.data(), size(), tdelta, ns_.data());
+            unsigned char evaluated = state.flags.exchange(0);
+            if (evaluated & EVALUATED_CALENDAR) {
+                evaluate_calendar();
+            }
+            if (evaluated & EVALUATED_JULIAN) {
+                evaluate_julian();
             }
-            return DateTimeArray(new_vec);
+            if (evaluated & EVALUATED_TIME_SCALES) {
+                evaluate_time_scales();
+            }
+            if (evaluated & EVALUATED_MJD) {
+                evaluate_mjd();
+            }
+            if (evaluated & EVALUATED_NUTATION) {
+                evaluate_nutation();
+            }
+            if (evaluated & EVALUATED_SIDEREAL) {
+                evaluate_sidereal();
+            }
+            return *this;
+        }
+        DateTimeArray& operator-=(const TimeDelta& tdelta) {
+            return *this += -tdelta;
+        }
+
+        // Held by a thread across a read, and the evaluations it triggers, that may overlap an in-place shift from
+        // another thread. Not reentrant: take it once, outside any call that shifts the array.
+        std::shared_lock<std::shared_mutex> read_lock() const {
+            return std::shared_lock<std::shared_mutex>(state.shift);
         }
 
         // print to cout
         friend std::ostream& operator<<(std::ostream& os, const DateTimeArray& dtarray) {
-            int size_vec = dtarray.vec.size();
+            int size_vec = dtarray.size();
             for (int i = 0; i < size_vec; i++) {
-                os << dtarray.vec[i] << std::endl;
+                os << dtarray[i] << std::endl;
             }
             return os;
         }
 
-        // subscript operator, ./src/time.hpp:358:26: error: overloaded 'operator[]' must have at least one parameter of class or enumeration type
-        DateTime operator[](int i) {
-            return vec[i];
+        // subscript operator
+        DateTime operator[](int i) const {
+            return DateTime(ns_[i]);
         }
-        
-        // takes in a function pointer to a DateTime member function, that member function must take no arguments and return a 3x3 matrix
-        std::vector<Eigen::Matrix3d> get_matrix_attribute(Eigen::Matrix3d (DateTime::*method)()) {
-            int size_vec = vec.size();
-            std::vector<Eigen::Matrix3d> attr_vec;
-            attr_vec.reserve(size_vec);
 
-            for (int i = 0; i < size_vec; i++) {
-                attr_vec.push_back((vec[i].*method)());  // Invoke the member function
-            }
+        // views of the columns, no copy is made
+        const std::vector<int64_t>& nanoseconds_since_j2000() const {
+            return ns_;
+        }
 
-            return attr_vec;
+        // calendar fields of every epoch, like DateTime::year() and so on
+        const std::vector<int>& year() const { evaluate_calendar(); return year_; }
+        const std::vector<int>& month() const { evaluate_calendar(); return month_; }
+        const std::vector<int>& day() const { evaluate_calendar(); return day_; }
+        const std::vector<int>& hour() const { evaluate_calendar(); return hour_; }
+        const std::vector<int>& minute() const { evaluate_calendar(); return minute_; }
+        const std::vector<int>& second() const { evaluate_calendar(); return second_; }
+        const std::vector<int>& nanosecond() const { evaluate_calendar(); return nanosecond_; }
+
+        const std::vector<double>& jd_utc() const {
+            evaluate_julian();
+            return jd_utc_;
         }
 
+        const std::vector<double>& jd_ut1() const {
+            evaluate_time_scales();
+            return jd_ut1_;
+        }
 
-        std::vector<double> get_double_attribute(double DateTime::*attr) {
-            int size_vec = vec.size();
-            std::vector<double> attr_vec;
-            attr_vec.reserve(size_vec);
+        const std::vector<double>& jd_tai() const {
+            evaluate_time_scales();
+            return jd_tai_;
+        }
 
-            for (int i = 0; i < size_vec; i++) {
-                attr_vec.push_back(vec[i].*attr);
-            }
-            return attr_vec;
+        const std::vector<double>& jd_tt() const {
+            evaluate_time_scales();
+            return jd_tt_;
         }
 
-        std::vector<double> jd_utc() {
-            return get_double_attribute(&DateTime::jd_utc);
+        const std::vector<double>& mjd_utc() const {
+            evaluate_julian();
+            return mjd_utc_;
         }
 
-        std::vector<double> jd_ut1() {
-            return get_double_attribute(&DateTime::jd_ut1);
+        const std::vector<double>& mjd_ut1() const {
+            evaluate_mjd();
+            return mjd_ut1_;
         }
 
-        std::vector<double> jd_tai() {
-            return get_double_attribute(&DateTime::jd_tai);
+        const std::vector<double>& mjd_tai() const {
+            evaluate_mjd();
+            return mjd_tai_;
         }
 
-        std::vector<double> jd_tt() {
-            return get_double_attribute(&DateTime::jd_tt);
+        const std::vector<double>& mjd_tt() const {
+            evaluate_mjd();
+            return mjd_tt_;
         }
 
-        std::vector<double> mjd_utc() {
-            return get_double_attribute(&DateTime::mjd_utc);
+        const std::vector<double>& T() const {
+            evaluate_time_scales();
+            return T_;
         }
 
-        std::vector<double> mjd_ut1() {
-            return get_double_attribute(&DateTime::mjd_ut1);
+        const std::vector<double>& gast() const {
+            evaluate_sidereal();
+            return gast_;
         }
 
-        std::vector<double> mjd_tai() {
-            return get_double_attribute(&DateTime::mjd_tai);
+        const std::vector<double>& gmst() const {
+            evaluate_sidereal();
+            return gmst_;
         }
 
-        std::vector<double> mjd_tt() {
-            return get_double_attribute(&DateTime::mjd_tt);
+        const std::vector<double>& delta_psi() const {
+            evaluate_nutation();
+            return delta_psi_;
         }
 
-        std::vector<double> gast() {
-            return get_double_attribute(&DateTime::gast);
+        const std::vector<double>& delta_eps() const {
+            evaluate_nutation();
+            return delta_eps_;
         }
 
-        std::vector<double> gmst() {
-            return get_double_attribute(&DateTime::gmst);
+        const std::vector<double>& epsilon_bar() const {
+            evaluate_nutation();
+            return epsilon_bar_;
         }
 
-        std::vector<double> delta_psi() {
-            return get_double_attribute(&DateTime::delta_psi);
+        const std::vector<double>& px() const {
+            evaluate_time_scales();
+            return px_;
         }
 
-        std::vector<double> delta_eps() {
-            return get_double_attribute(&DateTime::delta_eps);
+        const std::vector<double>& py() const {
+            evaluate_time_scales();
+            return py_;
         }
 
-        std::vector<double> epsilon_bar() {
-            return get_double_attribute(&DateTime::epsilon_bar);
+        const std::vector<double>& tai_minus_utc() const {
+            evaluate_time_scales();
+            return tai_minus_utc_;
         }
 
-        std::vector<double> px() {
-            return get_double_attribute(&DateTime::px);
+        const std::vector<double>& ut1_minus_utc() const {
+            evaluate_time_scales();
+            return ut1_minus_utc_;
         }
 
-        std::vector<double> py() {
-            return get_double_attribute(&DateTime::py);
+        // element-wise matrix kernels run directly over the columns
+
+        std::vector<Eigen::Matrix3d> itrf_to_j2000() const {
+            PROFILE_SCOPE("array.itrf_to_j2000", size());
+            evaluate_sidereal();
+            int size_vec = size();
+            std::vector<Eigen::Matrix3d> attr_vec(size_vec);
+            // on dense grids the precession-nutation matrix can be interpolated as well
+            ChebyshevSeries<9> series = interpolate_over_T<9>([](const double* T, int m, double* const* columns) {
+                std::vector<double> delta_psi(m), delta_eps(m);
+                delta_psi_delta_epsilon(T, m, delta_psi.data(), delta_eps.data());
+                for (int i = 0; i < m; i++) {
+                    Eigen::Matrix3d PN = j2000_to_tod(T[i], mean_obliquity_of_ecliptic(T[i]), delta_psi[i], delta_eps[i]);
+                    for (int k = 0; k < 9; k++) {
+                        columns[k][i] = PN(k);
+                    }
+                }
+            });
+            parallel_for(size_vec, [&](int begin, int end) {
+                if (!series.valid()) {
+                    for (int i = begin; i < end; i++) {
+                        attr_vec[i] = ::itrf_to_j2000(T_[i], epsilon_bar_[i], delta_psi_[i], delta_eps_[i], gmst_[i], px_[i], py_[i]);
+                    }
+                    return;
+                }
+                const int block = 64;
+                double values[9][block];
+                double* columns[9];
+                for (int k = 0; k < 9; k++) {
+                    columns[k] = values[k];
+                }
+                for (int start = begin; start < end; start += block) {
+                    int b = std::min(block, end - start);
+                    series.evaluate(T_.data() + start, b, columns);
+                    for (int e = 0; e < b; e++) {
+                        int i = start + e;
+                        Eigen::Matrix3d PN;
+                        for (int k = 0; k < 9; k++) {
+                            PN(k) = values[k][e];
+                        }
+                        attr_vec[i] = ::itrf_to_j2000(PN, epsilon_bar_[i], delta_psi_[i], gmst_[i], px_[i], py_[i]);
+                    }
+                }
+            });
+            return attr_vec;
         }
 
-        std::vector<double> tai_minus_utc() {
-            return get_double_attribute(&DateTime::tai_minus_utc);
+        std::vector<Eigen::Matrix3d> gtod_to_itrf() const {
+            PROFILE_SCOPE("array.gtod_to_itrf", size());
+            evaluate_time_scales();
+            int size_vec = size();
+            std::vector<Eigen::Matrix3d> attr_vec(size_vec);
+            parallel_for(size_vec, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    attr_vec[i] = ::gtod_to_itrf(px_[i], py_[i]);
+                }
+            });
+            return attr_vec;
+        }
+
+        std::vector<Eigen::Matrix3d> teme_to_gtod() const {
+            PROFILE_SCOPE("array.teme_to_gtod", size());
+            evaluate_sidereal();
+            int size_vec = size();
+            std::vector<Eigen::Matrix3d> attr_vec(size_vec);
+            parallel_for(size_vec, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    attr_vec[i] = ::teme_to_gtod(gmst_[i]);
+                }
+            });
+            return attr_vec;
         }
 
-        std::vector<double> ut1_minus_utc() {
-            return get_double_attribute(&DateTime::ut1_minus_utc);
+        std::vector<Eigen::Matrix3d> tod_to_teme() const {
+            PROFILE_SCOPE("array.tod_to_teme", size());
+            evaluate_nutation();
+            int size_vec = size();
+            std::vector<Eigen::Matrix3d> attr_vec(size_vec);
+            parallel_for(size_vec, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    attr_vec[i] = ::tod_to_teme(delta_psi_[i], epsilon_bar_[i]);
+                }
+            });
+            return attr_vec;
+        }
+
+        std::vector<Eigen::Matrix3d> mod_to_tod() const {
+            PROFILE_SCOPE("array.mod_to_tod", size());
+            evaluate_nutation();
+            int size_vec = size();
+            std::vector<Eigen::Matrix3d> attr_vec(size_vec);
+            parallel_for(size_vec, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    attr_vec[i] = ::mod_to_tod(epsilon_bar_[i], delta_psi_[i], delta_eps_[i]);
+                }
+            });
+            return attr_vec;
         }
 
-        // note:  src/time.hpp:472:41: error: cannot initialize a parameter of type 'Eigen::Matrix3d DateTime::*' with an rvalue of type 'Eigen::Matrix3d (DateTime::*)()'
+        std::vector<Eigen::Matrix3d> j2000_to_mod() const {
+            PROFILE_SCOPE("array.j2000_to_mod", size());
+            evaluate_time_scales();
+            int size_vec = size();
+            std::vector<Eigen::Matrix3d> attr_vec(size_vec);
+            parallel_for(size_vec, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    attr_vec[i] = ::j2000_to_mod(T_[i]);
+                }
+            });
+            return attr_vec;
+        }
+
+        // rotations between any two frames of the chain, one per epoch
+        std::vector<Eigen::Matrix3d> transform(Frame from, Frame to) const {
+            return std::move(transform(from, std::vector<Frame>{to})[0]);
+        }
+
+        // Rotations from one frame to several, one stack per target. Each epoch walks the chain once, so the
+        // steps the targets have in common (precession and nutation for TOD, TEME and ITRF, say) are built once.
+        std::vector<std::vector<Eigen::Matrix3d>> transform(Frame from, const std::vector<Frame>& to) const {
+            PROFILE_SCOPE("array.transform", size());
+            Frame lowest, highest;
+            frame_span(from, to, lowest, highest);
+            evaluate_frames(lowest, highest);
+            int size_vec = size();
+            int n_targets = to.size();
+            std::vector<std::vector<Eigen::Matrix3d>> stacks(n_targets, std::vector<Eigen::Matrix3d>(size_vec));
+            FrameAngleColumns angles = frame_angle_columns(lowest, highest);
+            parallel_for(size_vec, [&](int begin, int end) {
+                std::vector<Eigen::Matrix3d> scratch(n_targets);
+                frame_transforms(from, to.data(), n_targets, angles, begin, end, scratch.data(), stacks.data());
+            }, 1024);
+            return stacks;
+        }
+
+        // Rotations between two frames as unit quaternions with w >= 0, 32 bytes per epoch (16 in single precision)
+        // against 72 for the matrices. The matrices are built a block at a time and never stored.
+        template <typename Scalar = double>
+        std::vector<Eigen::Quaternion<Scalar>> transform_quaternions(Frame from, Frame to) const {
+            PROFILE_SCOPE("array.transform_quaternions", size());
+            Frame lowest = std::min(from, to);
+            Frame highest = std::max(from, to);
+            evaluate_frames(lowest, highest);
+            FrameAngleColumns angles = frame_angle_columns(lowest, highest);
+            std::vector<Eigen::Quaternion<Scalar>> quaternions(size());
+            parallel_for(size(), [&](int begin, int end) {
+                const int block = 256;
+                Eigen::Quaterniond scratch[block];
+                for (int start = begin; start < end; start += block) {
+                    int stop = std::min(start + block, end);
+                    frame_quaternions(from, to, angles, start, stop, scratch);
+                    for (int i = start; i < stop; i++) {
+                        quaternions[i] = scratch[i - start].cast<Scalar>();
+                    }
+                }
+            }, 1024);
+            return quaternions;
+        }
 
-        std::vector<Eigen::Matrix3d> itrf_to_j2000() {
-            return get_matrix_attribute(&DateTime::itrf_to_j2000);
+        // Keyframes of the rotation between two frames at the epochs of this array, to be interpolated at any
+        // epoch in between. The rotation is also evaluated halfway between consecutive keyframes, where the
+        // interpolation error peaks, and the largest error found is kept as the bound of the history.
+        RotationHistory rotation_history(Frame from, Frame to) const {
+            PROFILE_SCOPE("array.rotation_history", size());
+            if (size() < 2) {
+                throw std::invalid_argument("a rotation history needs at least two epochs");
+            }
+            std::vector<Eigen::Quaterniond> keyframes = transform_quaternions(from, to);
+            std::vector<int64_t> epochs = tai_nanoseconds_since_j2000();
+            std::vector<int64_t> midpoints(size() - 1);
+            for (int i = 0; i < size() - 1; i++) {
+                midpoints[i] = ns_[i] + (ns_[i + 1] - ns_[i]) / 2;
+            }
+            DateTimeArray halfway(std::move(midpoints));
+            std::vector<Eigen::Quaterniond> exact = halfway.transform_quaternions(from, to);
+            std::vector<int64_t> halfway_epochs = halfway.tai_nanoseconds_since_j2000();
+            double max_error = 0.0;
+            for (int i = 0; i < halfway.size(); i++) {
+                double s = static_cast<double>(halfway_epochs[i] - epochs[i]) / static_cast<double>(epochs[i + 1] - epochs[i]);
+                max_error = std::max(max_error, quaternion_angle(exact[i], keyframes[i].slerp(s, keyframes[i + 1])));
+            }
+            return RotationHistory(std::move(epochs), std::move(keyframes), max_error);
         }
 
-        std::vector<Eigen::Matrix3d> gtod_to_itrf() {
-            return get_matrix_attribute(&DateTime::gtod_to_itrf);
+        // Rotates one position per epoch, given as size() rows of 3 doubles, from one frame to another without
+        // forming the matrices. Velocities [position unit / s] are optional and pick up the Earth rotation term.
+        // The outputs may alias the inputs.
+        void transform_vectors(Frame from, Frame to, const double* positions, double* positions_out,
+                               const double* velocities = nullptr, double* velocities_out = nullptr) const {
+            PROFILE_SCOPE("array.transform_vectors", size());
+            Frame lowest = std::min(from, to);
+            Frame highest = std::max(from, to);
+            evaluate_frames(lowest, highest);
+            FrameAngleColumns angles = frame_angle_columns(lowest, highest);
+            parallel_for(size(), [&](int begin, int end) {
+                transform_states(from, to, angles, begin, end, positions, positions_out, velocities, velocities_out);
+            }, 1024);
         }
 
-        std::vector<Eigen::Matrix3d> teme_to_gtod() {
-            return get_matrix_attribute(&DateTime::teme_to_gtod);
+        // Azimuth, elevation and range from each of n_sites sites of one J2000 position [km] per epoch, given as
+        // size() rows of 3 doubles. The positions are rotated to ITRF once and the sites are then run in blocks of
+        // epochs that stay in cache, see topocentric.hpp for the output layout.
+        void look_angles(const double* positions, const TopocentricSite* sites, int n_sites, double min_elevation,
+                         const LookAngles& out) const {
+            PROFILE_SCOPE("array.look_angles", static_cast<int64_t>(size()) * n_sites);
+            int n = size();
+            std::vector<double> itrf_positions(3 * static_cast<size_t>(n));
+            transform_vectors(Frame::J2000, Frame::ITRF, positions, itrf_positions.data());
+            parallel_for(n, [&](int begin, int end) {
+                const int block = 512;
+                for (int start = begin; start < end; start += block) {
+                    ::look_angles(itrf_positions.data(), n, start, std::min(start + block, end), sites, n_sites, min_elevation, out);
+                }
+            }, std::max(64, 4096 / std::max(n_sites, 1)));
         }
 
-        std::vector<Eigen::Matrix3d> tod_to_teme() {
-            return get_matrix_attribute(&DateTime::tod_to_teme);
+        // seconds and nanoseconds since 1970-01-01 UTC, new columns
+        std::vector<double> unix_seconds() const {
+            std::vector<double> seconds(size());
+            parallel_for(size(), [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    seconds[i] = nanoseconds_to_unix_seconds(ns_[i]);
+                }
+            });
+            return seconds;
         }
 
-        std::vector<Eigen::Matrix3d> mod_to_tod() {
-            return get_matrix_attribute(&DateTime::mod_to_tod);
+        // throws std::out_of_range past 2262-04-11T23:47:16.854775807, the last int64 Unix nanosecond
+        std::vector<int64_t> unix_nanoseconds() const {
+            std::vector<int64_t> nanoseconds(size());
+            parallel_for(size(), [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    if (ns_[i] > std::numeric_limits<int64_t>::max() - J2000_UNIX_NANOSECONDS) {
+                        throw std::out_of_range("epoch past the range of Unix nanoseconds (2262-04-11)");
+                    }
+                    nanoseconds[i] = ns_[i] + J2000_UNIX_NANOSECONDS;
+                }
+            });
+            return nanoseconds;
         }
 
-        std::vector<Eigen::Matrix3d> j2000_to_mod() {
-            return get_matrix_attribute(&DateTime::j2000_to_mod);
+        // nanoseconds of TAI since J2000, continuous across leap seconds unlike nanoseconds_since_j2000()
+        std::vector<int64_t> tai_nanoseconds_since_j2000() const {
+            evaluate_time_scales();
+            std::vector<int64_t> nanoseconds(size());
+            parallel_for(size(), [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    nanoseconds[i] = ns_[i] + llround(tai_minus_utc_[i] * NANOSECONDS_PER_SECOND);
+                }
+            });
+            return nanoseconds;
         }
 
         // size attribute: DateTimeArray.size
-        int size() {
-            return vec.size();
+        int size() const {
+            return ns_.size();
         }
 };
+
     
 
-// datetime linspace returning as vec of datetimes
-DateTimeArray datetime_linspace(DateTime start, DateTime end, int num) {
-    std::vector<DateTime> vec;
-    double jd_start = start.jd_utc;
-    double jd_end = end.jd_utc;
-    double jd_step = (jd_end - jd_start) / (num - 1);
-    // preallocate that memory
-    vec.reserve(num);
-    for (int i = 0; i < num; i++) {
-        vec.push_back(jd_to_datetime(jd_start + i * jd_step));
+// Batch counterparts of jd_to_datetime, each value is converted independently in parallel. Non-finite input
+// (NaN, NaT) has no epoch and throws std::invalid_argument, epochs outside the years 1708 to 2291 throw
+// std::out_of_range.
+template <typename T, typename Fn>
+DateTimeArray to_datetime_array(const T* values, int n, const Fn& to_nanoseconds, bool (*is_valid)(T), bool (*in_range)(T)) {
+    std::vector<int64_t> ns(std::max(n, 0));
+    std::atomic<bool> invalid(false);
+    std::atomic<bool> outside(false);
+    parallel_for(n, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            if (!is_valid(values[i])) {
+                invalid = true;
+                return;
+            }
+            if (!in_range(values[i])) {
+                outside = true;
+                return;
+            }
+            ns[i] = to_nanoseconds(values[i]);
+        }
+    });
+    if (invalid) {
+        throw std::invalid_argument("epochs must be finite");
+    }
+    if (outside) {
+        throw std::out_of_range(EPOCH_RANGE_ERROR);
     }
-    return vec;
+    return ns;
 }
 
-DateTimeArray datetime_arange(DateTime start, DateTime end, TimeDelta step) {
-    std::vector<DateTime> vec;
-    double jd_start = start.jd_utc;
-    double jd_end = end.jd_utc;
-    double jd_step = step.total_seconds() / 86400.0;
-    int n_steps = (jd_end - jd_start) / jd_step;
-    // preallocate that memory
-    vec.reserve(n_steps);
-    for (int i = 0; i < n_steps; i++) {
-        vec.push_back(jd_to_datetime(jd_start + i * jd_step));
+bool is_valid_epoch(double value) {
+    return std::isfinite(value);
+}
+
+bool is_valid_epoch(int64_t value) {
+    return value != std::numeric_limits<int64_t>::min(); // NumPy's NaT
+}
+
+DateTimeArray jd_to_datetime_array(const double* jd_utc, int n) {
+    return to_datetime_array<double>(jd_utc, n, [](double jd) { return jd_to_nanoseconds(jd); }, is_valid_epoch,
+                                     jd_in_range);
+}
+
+DateTimeArray mjd_to_datetime_array(const double* mjd_utc, int n) {
+    return to_datetime_array<double>(mjd_utc, n, mjd_to_nanoseconds, is_valid_epoch, mjd_in_range);
+}
+
+DateTimeArray unix_seconds_to_datetime_array(const double* unix_seconds, int n) {
+    return to_datetime_array<double>(unix_seconds, n, unix_seconds_to_nanoseconds, is_valid_epoch,
+                                     unix_seconds_in_range);
+}
+
+DateTimeArray unix_nanoseconds_to_datetime_array(const int64_t* unix_nanoseconds, int n) {
+    return to_datetime_array<int64_t>(unix_nanoseconds, n, [](int64_t ns) { return ns - J2000_UNIX_NANOSECONDS; }, is_valid_epoch,
+                                      unix_nanoseconds_in_range);
+}
+
+// epochs from calendar columns, fields may overflow their usual range like in the DateTime constructor
+DateTimeArray calendar_to_datetime_array(const int* year, const int* month, const int* day, const int* hour,
+                                         const int* minute, const int* second, const int64_t* nanosecond, int n) {
+    std::vector<int64_t> ns(std::max(n, 0));
+    parallel_for(n, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            if (!civil_in_range(year[i], month[i], day[i], hour[i], minute[i], second[i], nanosecond[i])) {
+                throw std::out_of_range(EPOCH_RANGE_ERROR);
+            }
+        }
+        calendar_to_nanoseconds(year + begin, month + begin, day + begin, hour + begin, minute + begin, second + begin,
+                                nanosecond + begin, end - begin, ns.data() + begin);
+    });
+    return ns;
+}
+
+// a * b / c rounded down for 0 <= a < c and b >= 0, exact when a * b overflows int64 (linspace over more than
+// ~3e9 epochs): only then in 128 bits, or bit by bit where the compiler has no 128-bit integers
+int64_t mul_div(int64_t a, int64_t b, int64_t c) {
+    int64_t product;
+#if defined(__GNUC__) || defined(__clang__)
+    bool overflow = __builtin_mul_overflow(a, b, &product);
+#else
+    bool overflow = b != 0 && a > std::numeric_limits<int64_t>::max() / b;
+    product = overflow ? 0 : a * b;
+#endif
+    if (!overflow) {
+        return product / c;
+    }
+#if defined(__SIZEOF_INT128__)
+    return static_cast<int64_t>(static_cast<__int128>(a) * b / c);
+#else
+    // a * k / c as quotient and remainder while k takes on the bits of b from the top
+    uint64_t quotient = 0;
+    uint64_t rest = 0;
+    for (int bit = 62; bit >= 0; bit--) {
+        quotient *= 2;
+        rest *= 2;
+        if (rest >= static_cast<uint64_t>(c)) {
+            quotient++;
+            rest -= c;
+        }
+        if ((b >> bit) & 1) {
+            rest += a;
+            if (rest >= static_cast<uint64_t>(c)) {
+                quotient++;
+                rest -= c;
+            }
+        }
+    }
+    return static_cast<int64_t>(quotient);
+#endif
+}
+
+// Evenly spaced epochs described without storing them, epoch i is start + quotient * i + remainder * i / divisor
+// nanoseconds since J2000. The integer form keeps linspace exact to the nanosecond however many epochs there are.
+struct EpochGrid {
+    int64_t start;
+    int64_t quotient;
+    int64_t remainder;
+    int64_t divisor;
+    int64_t size;
+
+    int64_t operator[](int64_t i) const {
+        return start + quotient * i + mul_div(remainder, i, divisor);
+    }
+
+    // epochs [begin, end) of the grid as an array, filled in parallel
+    DateTimeArray slice(int64_t begin, int64_t end) const {
+        PROFILE_SCOPE("epochs.generate", std::max<int64_t>(end - begin, 0));
+        std::vector<int64_t> vec(std::max<int64_t>(end - begin, 0));
+        parallel_for(static_cast<int>(vec.size()), [&](int b, int e) {
+            for (int i = b; i < e; i++) {
+                vec[i] = (*this)[begin + i];
+            }
+        });
+        return vec;
+    }
+};
+
+// num epochs from start to end inclusive
+EpochGrid linspace_grid(DateTime start, DateTime end, int64_t num) {
+    num = std::max<int64_t>(num, 0);
+    int64_t ns_start = start.nanoseconds_since_j2000();
+    if (num <= 1) {
+        return {ns_start, 0, 0, 1, num};
     }
-    return vec;
+    int64_t span = end.nanoseconds_since_j2000() - ns_start;
+    return {ns_start, span / (num - 1), span % (num - 1), num - 1, num};
 }
 
-// function called now() that returns the current datetime in utc
-DateTime now() {
-    auto now = std::chrono::system_clock::now();
-    auto now_as_time_t = std::chrono::system_clock::to_time_t(now);
-    auto now_as_tm = *std::localtime(&now_as_time_t);
+// epochs start, start + step, ... before end
+EpochGrid arange_grid(DateTime start, DateTime end, TimeDelta step) {
+    int64_t ns_start = start.nanoseconds_since_j2000();
+    int64_t ns_step = step.has_calendar_part() ? llround(step.total_seconds() * 1e9) : step.fixed_nanoseconds();
+    if (ns_step == 0) {
+        throw std::invalid_argument("datetime_arange step must be nonzero");
+    }
+    int64_t span = end.nanoseconds_since_j2000() - ns_start;
+    return {ns_start, ns_step, 0, 1, std::max<int64_t>(span / ns_step, 0)};
+}
+
+// datetime linspace returning as vec of datetimes, the spacing is exact to the nanosecond
+DateTimeArray datetime_linspace(DateTime start, DateTime end, int num) {
+    EpochGrid grid = linspace_grid(start, end, num);
+    return grid.slice(0, grid.size);
+}
+
+// epochs start, start + step, ... before end
+DateTimeArray datetime_arange(DateTime start, DateTime end, TimeDelta step) {
+    EpochGrid grid = arange_grid(start, end, step);
+    return grid.slice(0, grid.size);
+}
 
-    // Get current time's nanoseconds component
-    auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()) % 1000000000;
+// A grid handed out as DateTimeArrays of at most chunk_size epochs, each one built only when it is reached.
+// Derived columns and matrices are computed per chunk and freed with it, so memory stays bounded by the chunk
+// size whatever the span is:
+//     for (const DateTimeArray& chunk : arange_chunks(start, end, seconds(1), 86400)) { ... chunk.gast() ... }
+class EpochChunks {
+    private:
+        EpochGrid grid_;
+        int chunk_size_;
 
-    // Construct DateTime object
-    return DateTime(now_as_tm.tm_year + 1900,  // Adjust year
-                    now_as_tm.tm_mon + 1,     // Adjust month (tm_mon is 0-11)
-                    now_as_tm.tm_mday,
-                    now_as_tm.tm_hour,
-                    now_as_tm.tm_min,
-                    now_as_tm.tm_sec,
-                    static_cast<int>(now_ns.count()));
+    public:
+        class iterator {
+            private:
+                const EpochChunks* chunks_;
+                int64_t index_;
+
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = DateTimeArray;
+                using difference_type = int64_t;
+                using pointer = void;
+                using reference = DateTimeArray;
+
+                iterator(const EpochChunks* chunks, int64_t index) : chunks_(chunks), index_(index) {}
+                DateTimeArray operator*() const { return chunks_->chunk(index_); }
+                iterator& operator++() { index_++; return *this; }
+                iterator operator++(int) { iterator previous = *this; index_++; return previous; }
+                bool operator==(const iterator& other) const { return index_ == other.index_; }
+                bool operator!=(const iterator& other) const { return index_ != other.index_; }
+        };
+
+        EpochChunks(EpochGrid grid, int chunk_size) : grid_(grid), chunk_size_(chunk_size) {
+            if (chunk_size < 1) {
+                throw std::invalid_argument("chunk size must be positive");
+            }
+        }
+
+        // total number of epochs and of chunks
+        int64_t n_epochs() const { return grid_.size; }
+        int64_t size() const { return (grid_.size + chunk_size_ - 1) / chunk_size_; }
+        int chunk_size() const { return chunk_size_; }
+
+        DateTimeArray chunk(int64_t k) const {
+            int64_t begin = k * chunk_size_;
+            return grid_.slice(begin, std::min(begin + chunk_size_, grid_.size));
+        }
+
+        iterator begin() const { return iterator(this, 0); }
+        iterator end() const { return iterator(this, size()); }
+};
+
+EpochChunks linspace_chunks(DateTime start, DateTime end, int64_t num, int chunk_size) {
+    return EpochChunks(linspace_grid(start, end, num), chunk_size);
+}
+
+EpochChunks arange_chunks(DateTime start, DateTime end, TimeDelta step, int chunk_size) {
+    return EpochChunks(arange_grid(start, end, step), chunk_size);
 }
 
+// function called now() that returns the current datetime in utc
+DateTime now() {
+    auto since_unix_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch());
+    return DateTime(static_cast<int64_t>(since_unix_epoch.count()) - J2000_UNIX_NANOSECONDS);
+}
 
 TimeDelta years(int years) {
     return TimeDelta(years, 0, 0, 0, 0, 0, 0);
@@ -0,0 +1,225 @@
+#pragma once
+#ifdef _MSC_VER
+    #define _USE_MATH_DEFINES // For MS Visual Studio
+    #include <math.h>
+#else
+    #include <cmath>
+#endif
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "calendar.hpp"
+#include "dispatch.hpp"
+#include "eop_loader.hpp"
+#include "parallel.hpp"
+#include "profile.hpp"
+
+// Conversions of raw epoch arrays between time scales, without DateTime objects.
+//
+// An epoch is counted in nanoseconds since J2000 (2000-01-01 12:00:00) read on the clock of its own scale, the
+// way DateTimeArray counts UTC, or as a Julian date of that scale. Every conversion goes through TAI:
+//   TT = TAI + 32.184 s, GPS = TAI - 19 s,
+//   TDB = TT + 1.657 ms sin g + 14 us sin 2g, g the mean anomaly of the Earth (good to about 10 us),
+//   UTC = TAI - (TAI-UTC) from the leap second table, UT1 = UTC + (UT1-UTC) from the EOP table.
+// UTC has no reading of its own inside a leap second, so converting to UTC repeats 23:59:59 there as Unix time
+// does. Every UTC epoch survives the round trip through TAI exactly. The inverses of UT1 and TDB are iterated.
+// TAI-UTC is a step function on both time lines (EopTable::leap_steps, built once with the table), looked up for
+// the first and last epoch of each block: a block without a leap second inside is shifted by one offset in a loop
+// that vectorizes, only blocks straddling a leap second look each epoch up.
+
+enum class TimeScale { UTC, TAI, TT, UT1, GPS, TDB };
+
+const int64_t TT_MINUS_TAI_NANOSECONDS = 32184000000;
+const int64_t TAI_MINUS_GPS_NANOSECONDS = 19000000000;
+
+const int TIME_SCALE_BLOCK = 256;
+
+// index of the step in force at epoch, the first one before all of them
+int step_index(const std::vector<int64_t>& steps, int64_t epoch) {
+    int k = std::upper_bound(steps.begin(), steps.end(), epoch) - steps.begin() - 1;
+    return std::max(k, 0);
+}
+
+// out = in + sign * the offset in force at each epoch
+void add_step_offsets(const int64_t* in, int n, const std::vector<int64_t>& steps, const std::vector<int64_t>& offsets,
+                      int64_t sign, int64_t* out) {
+    if (n == 0) {
+        return;
+    }
+    auto range = std::minmax_element(in, in + n);
+    int first = step_index(steps, *range.first);
+    if (first == step_index(steps, *range.second)) {
+        int64_t shift = sign * offsets[first];
+        for (int i = 0; i < n; i++) {
+            out[i] = in[i] + shift;
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            out[i] = in[i] + sign * offsets[step_index(steps, in[i])];
+        }
+    }
+}
+
+// TDB-TT [ns] at a TT epoch
+int64_t tdb_minus_tt(int64_t tt) {
+    double g = (357.53 + 0.98560028 * (tt / static_cast<double>(NANOSECONDS_PER_DAY))) * (M_PI / 180.0);
+    return llround((0.001657 * sin(g) + 0.000014 * sin(2.0 * g)) * NANOSECONDS_PER_SECOND);
+}
+
+// UT1-TAI [ns] at n <= TIME_SCALE_BLOCK TAI epochs
+void ut1_minus_tai(const EopTable& eop, const int64_t* tai, int n, int64_t* out) {
+    int64_t utc[TIME_SCALE_BLOCK];
+    double mjd_utc[TIME_SCALE_BLOCK] = {};
+    double tai_minus_utc[TIME_SCALE_BLOCK];
+    double ut1_minus_utc[TIME_SCALE_BLOCK];
+    add_step_offsets(tai, n, eop.leap_steps().tai, eop.leap_steps().offsets, -1, utc);
+    for (int i = 0; i < n; i++) {
+        // split like nanoseconds_to_jd, a double MJD resolves ~1 us
+        int64_t days = floor_div(utc[i], NANOSECONDS_PER_DAY);
+        mjd_utc[i] = (MJD_J2000 + days) + (utc[i] - days * NANOSECONDS_PER_DAY) / static_cast<double>(NANOSECONDS_PER_DAY);
+    }
+    eop.lookup(mjd_utc, n, tai_minus_utc, ut1_minus_utc, nullptr, nullptr);
+    for (int i = 0; i < n; i++) {
+        out[i] = llround((ut1_minus_utc[i] - tai_minus_utc[i]) * NANOSECONDS_PER_SECOND);
+    }
+}
+
+// n <= TIME_SCALE_BLOCK epochs of a scale to TAI
+void time_scale_to_tai(const EopTable& eop, TimeScale scale, const int64_t* in, int n, int64_t* tai) {
+    switch (scale) {
+        case TimeScale::UTC:
+            add_step_offsets(in, n, eop.leap_steps().utc, eop.leap_steps().offsets, 1, tai);
+            break;
+        case TimeScale::TAI:
+            std::copy(in, in + n, tai);
+            break;
+        case TimeScale::TT:
+            for (int i = 0; i < n; i++) {
+                tai[i] = in[i] - TT_MINUS_TAI_NANOSECONDS;
+            }
+            break;
+        case TimeScale::GPS:
+            for (int i = 0; i < n; i++) {
+                tai[i] = in[i] + TAI_MINUS_GPS_NANOSECONDS;
+            }
+            break;
+        case TimeScale::TDB:
+            // TDB-TT changes by < 1e-9 s per second, one correction at the first guess is sub-nanosecond
+            for (int i = 0; i < n; i++) {
+                int64_t tt = in[i] - tdb_minus_tt(in[i]);
+                tai[i] = in[i] - tdb_minus_tt(tt) - TT_MINUS_TAI_NANOSECONDS;
+            }
+            break;
+        case TimeScale::UT1: {
+            // UT1-TAI changes by < 1e-7 s per second, so starting with it taken at the UT1 reading (~40 s off)
+            // two iterations get to the nanosecond
+            int64_t correction[TIME_SCALE_BLOCK];
+            std::copy(in, in + n, tai);
+            for (int iteration = 0; iteration < 2; iteration++) {
+                ut1_minus_tai(eop, tai, n, correction);
+                for (int i = 0; i < n; i++) {
+                    tai[i] = in[i] - correction[i];
+                }
+            }
+            break;
+        }
+    }
+}
+
+// n <= TIME_SCALE_BLOCK TAI epochs to a scale, out may alias tai
+void tai_to_time_scale(const EopTable& eop, TimeScale scale, const int64_t* tai, int n, int64_t* out) {
+    switch (scale) {
+        case TimeScale::UTC:
+            add_step_offsets(tai, n, eop.leap_steps().tai, eop.leap_steps().offsets, -1, out);
+            break;
+        case TimeScale::TAI:
+            std::copy(tai, tai + n, out);
+            break;
+        case TimeScale::TT:
+            for (int i = 0; i < n; i++) {
+                out[i] = tai[i] + TT_MINUS_TAI_NANOSECONDS;
+            }
+            break;
+        case TimeScale::GPS:
+            for (int i = 0; i < n; i++) {
+                out[i] = tai[i] - TAI_MINUS_GPS_NANOSECONDS;
+            }
+            break;
+        case TimeScale::TDB:
+            for (int i = 0; i < n; i++) {
+                int64_t tt = tai[i] + TT_MINUS_TAI_NANOSECONDS;
+                out[i] = tt + tdb_minus_tt(tt);
+            }
+            break;
+        case TimeScale::UT1: {
+            int64_t correction[TIME_SCALE_BLOCK];
+            ut1_minus_tai(eop, tai, n, correction);
+            for (int i = 0; i < n; i++) {
+                out[i] = tai[i] + correction[i];
+            }
+            break;
+        }
+    }
+}
+
+constexpr bool nanoseconds_in_range(int64_t ns) {
+    return ns >= MIN_EPOCH_SECONDS * NANOSECONDS_PER_SECOND && ns < MAX_EPOCH_SECONDS * NANOSECONDS_PER_SECOND;
+}
+
+// throws std::out_of_range unless all n epochs are inside the supported years
+template <typename T>
+void check_epochs(const T* epochs, int n, bool (*in_range)(T)) {
+    bool valid = true;
+    for (int i = 0; i < n; i++) {
+        valid &= in_range(epochs[i]);
+    }
+    if (!valid) {
+        throw std::out_of_range(EPOCH_RANGE_ERROR);
+    }
+}
+
+// one block of convert_time_scale, built for each instruction set level
+void time_scale_block_kernel(const EopTable& eop, TimeScale from, TimeScale to, const int64_t* in, int n,
+                             int64_t* out) {
+    int64_t tai[TIME_SCALE_BLOCK];
+    time_scale_to_tai(eop, from, in, n, tai);
+    tai_to_time_scale(eop, to, tai, n, out);
+}
+
+SIDEREAL_DISPATCH(time_scale_block,
+                  (const EopTable& eop, TimeScale from, TimeScale to, const int64_t* in, int n, int64_t* out),
+                  (eop, from, to, in, n, out))
+
+// Converts n epochs in nanoseconds since J2000 from one scale to another, out may alias in. Throws
+// std::out_of_range for epochs outside the years 1708 to 2291.
+void convert_time_scale(const int64_t* in, int n, TimeScale from, TimeScale to, int64_t* out) {
+    PROFILE_SCOPE("time_scale.convert", n);
+    std::shared_ptr<const EopTable> table = current_eop_table();
+    const EopTable& eop = *table;
+    parallel_for(n, [&](int begin, int end) {
+        for (int start = begin; start < end; start += TIME_SCALE_BLOCK) {
+            int b = std::min(TIME_SCALE_BLOCK, end - start);
+            check_epochs(in + start, b, nanoseconds_in_range);
+            time_scale_block(eop, from, to, in + start, b, out + start);
+        }
+    });
+}
+
+// Converts n Julian dates from one scale to another, rounded to the nanosecond on the way, out may alias in
+void convert_time_scale(const double* jd, int n, TimeScale from, TimeScale to, double* out) {
+    PROFILE_SCOPE("time_scale.convert_jd", n);
+    std::shared_ptr<const EopTable> table = current_eop_table();
+    const EopTable& eop = *table;
+    parallel_for(n, [&](int begin, int end) {
+        int64_t ns[TIME_SCALE_BLOCK];
+        for (int start = begin; start < end; start += TIME_SCALE_BLOCK) {
+            int b = std::min(TIME_SCALE_BLOCK, end - start);
+            check_epochs(jd + start, b, jd_in_range);
+            jd_to_nanoseconds(jd + start, b, ns);
+            time_scale_block(eop, from, to, ns, b, ns);
+            nanoseconds_to_jd(ns, b, out + start);
+        }
+    });
+}
@@ -0,0 +1,107 @@
+#pragma once
+#ifdef _MSC_VER
+    #define _USE_MATH_DEFINES // For MS Visual Studio
+    #include <math.h>
+#else
+    #include <cmath>
+#endif
+#include "Eigen/Eigen"
+#include <cstdint>
+#include "dispatch.hpp"
+
+// Topocentric look angles: azimuth, elevation and range of a target seen from ground sites.
+//
+// Each site is turned once from WGS84 geodetic coordinates into its ITRF position and the rotation from ITRF to
+// its local east-north-up frame. The target is rotated into ITRF once per epoch (DateTimeArray::look_angles), so
+// all the sites share the Earth orientation of an epoch and cost a subtraction and a 3x3 product each.
+// Positions are in km, angles in radians. Azimuth counts from north through east, in [0, 2 pi).
+
+const double WGS84_EQUATORIAL_RADIUS = 6378.137; // [km]
+const double WGS84_FLATTENING = 1.0 / 298.257223563;
+
+struct TopocentricSite {
+    Eigen::Vector3d itrf; // [km]
+    Eigen::Matrix3d itrf_to_enu; // rows east, north, up
+};
+
+// latitude and longitude geodetic [rad], altitude above the ellipsoid [km]
+TopocentricSite geodetic_to_site(double latitude, double longitude, double altitude) {
+    double e2 = WGS84_FLATTENING * (2.0 - WGS84_FLATTENING);
+    double sin_lat = sin(latitude);
+    double cos_lat = cos(latitude);
+    double sin_lon = sin(longitude);
+    double cos_lon = cos(longitude);
+    double prime_vertical = WGS84_EQUATORIAL_RADIUS / sqrt(1.0 - e2 * sin_lat * sin_lat);
+    TopocentricSite site;
+    site.itrf << (prime_vertical + altitude) * cos_lat * cos_lon,
+                 (prime_vertical + altitude) * cos_lat * sin_lon,
+                 (prime_vertical * (1.0 - e2) + altitude) * sin_lat;
+    site.itrf_to_enu << -sin_lon, cos_lon, 0.0,
+                        -sin_lat * cos_lon, -sin_lat * sin_lon, cos_lat,
+                        cos_lat * cos_lon, cos_lat * sin_lon, sin_lat;
+    return site;
+}
+
+// atan2 within 5e-16 rad of the libm one, from the rational approximation of atan on [0, 0.66] of the Cephes
+// library after reducing to the first octant. Written with selects instead of branches so that loops over it
+// vectorize, which libm's atan2 does not.
+double atan2_rational(double y, double x) {
+    double ax = fabs(x);
+    double ay = fabs(y);
+    double hi = ax > ay ? ax : ay;
+    double lo = ax > ay ? ay : ax;
+    double t = lo / (hi > 0.0 ? hi : 1.0); // [0, 1]
+    bool shifted = t > 0.66; // atan(t) = pi/4 + atan((t - 1) / (t + 1))
+    double z = (shifted ? t - 1.0 : t) / (shifted ? t + 1.0 : 1.0);
+    double zz = z * z;
+    double p = (((-8.750608600031904122785e-1 * zz - 1.615753718733365076637e1) * zz - 7.500855792314704667340e1) * zz
+                - 1.228866684490136173410e2) * zz - 6.485021904942025371773e1;
+    double q = ((((zz + 2.485846490142306297962e1) * zz + 1.650270098316988542046e2) * zz + 4.328810604912902668951e2) * zz
+                + 4.853903996359136964868e2) * zz + 1.945506571482613964425e2;
+    double a = (shifted ? M_PI_4 : 0.0) + (z * zz * p / q + z + (shifted ? 3.061616997868382943065e-17 : 0.0));
+    a = ay > ax ? M_PI_2 - a : a;
+    a = x < 0.0 ? M_PI - a : a;
+    return y < 0.0 ? -a : a;
+}
+
+// Outputs of look_angles, n_sites rows of n_epochs values each (row s for site s), visible may be null
+struct LookAngles {
+    double* azimuth = nullptr;
+    double* elevation = nullptr;
+    double* range = nullptr;
+    bool* visible = nullptr; // elevation at or above the cutoff
+};
+
+// Look angles of epochs [begin, end) from every site, itrf_positions are rows of 3 doubles, built for each
+// instruction set level
+void look_angles_kernel(const double* itrf_positions, int n_epochs, int begin, int end, const TopocentricSite* sites,
+                        int n_sites, double min_elevation, const LookAngles& out) {
+    for (int s = 0; s < n_sites; s++) {
+        const TopocentricSite& site = sites[s];
+        const Eigen::Matrix3d& R = site.itrf_to_enu; // east has no z component
+        int64_t row = static_cast<int64_t>(s) * n_epochs;
+        for (int i = begin; i < end; i++) {
+            double dx = itrf_positions[3 * i] - site.itrf(0);
+            double dy = itrf_positions[3 * i + 1] - site.itrf(1);
+            double dz = itrf_positions[3 * i + 2] - site.itrf(2);
+            double east = R(0, 0) * dx + R(0, 1) * dy;
+            double north = R(1, 0) * dx + R(1, 1) * dy + R(1, 2) * dz;
+            double up = R(2, 0) * dx + R(2, 1) * dy + R(2, 2) * dz;
+            double horizontal2 = east * east + north * north;
+            double azimuth = atan2_rational(east, north);
+            out.azimuth[row + i] = azimuth < 0.0 ? azimuth + 2.0 * M_PI : azimuth;
+            out.elevation[row + i] = atan2_rational(up, sqrt(horizontal2));
+            out.range[row + i] = sqrt(horizontal2 + up * up);
+        }
+        if (out.visible) {
+            for (int i = begin; i < end; i++) {
+                out.visible[row + i] = out.elevation[row + i] >= min_elevation;
+            }
+        }
+    }
+}
+
+SIDEREAL_DISPATCH(look_angles,
+                  (const double* itrf_positions, int n_epochs, int begin, int end, const TopocentricSite* sites, int n_sites,
+                   double min_elevation, const LookAngles& out),
+                  (itrf_positions, n_epochs, begin, end, sites, n_sites, min_elevation, out))
@@ -2,6 +2,8 @@ import sidereal
 import numpy as np
 
 import time
+import threading
+from concurrent.futures import ThreadPoolExecutor
 from typing import Union
 
 tstart = None
@@ -123,6 +125,399 @@ def test_datetimearray_rotms():
     assert np.allclose(mats[0, :, :], mats2[0, :, :]), "Matrices are not equal"
 
 
+def test_datetimearray_accessors_are_ndarrays():
+    dtspace = sidereal.linspace(dtime1, dtime2, 1_000)
+
+    jd = dtspace.jd_utc()
+    assert isinstance(jd, np.ndarray) and jd.shape == (1_000,)
+    assert not jd.flags.writeable
+    assert np.shares_memory(jd, dtspace.jd_utc())  # views of the same column
+    assert np.allclose(dtspace.gast()[10], dtspace[10].gast)
+
+    mats = dtspace.itrf_to_j2000()
+    assert isinstance(mats, np.ndarray) and mats.shape == (1_000, 3, 3)
+    assert np.allclose(mats[10], dtspace[10].itrf_to_j2000())
+
+
+def test_concurrent_batch_calls():
+    # the batch calls run without the GIL, hammer them from several threads at once,
+    # both on private arrays and on one shared array whose lazy columns race to be filled
+    n = 20_000
+    expected = sidereal.linspace(dtime1, dtime2, n)
+    expected_gast = np.array(expected.gast())
+    expected_mats = np.array(expected.itrf_to_j2000())
+    shared = sidereal.linspace(dtime1, dtime2, n)
+    barrier = threading.Barrier(8)
+
+    def work(i):
+        barrier.wait()
+        if i % 2:
+            mats = shared.itrf_to_j2000()
+            gast = shared.gast()
+        else:
+            own = sidereal.linspace(dtime1, dtime2, n)
+            mats = own.itrf_to_j2000()
+            gast = own.gast()
+        return np.array_equal(mats, expected_mats) and np.array_equal(gast, expected_gast)
+
+    with ThreadPoolExecutor(max_workers=8) as pool:
+        assert all(pool.map(work, range(32)))
+
+
+def test_nanosecond_epoch_arithmetic():
+    dt = sidereal.DateTime(2018, 1, 1, 0, 0, 0, 1)
+    assert (dt + sidereal.nanoseconds(999_999_999)).second == 1
+    assert (dt - sidereal.nanoseconds(2)) < dtime1
+    assert dtime1 + sidereal.days(1) == dtime2
+    assert sidereal.DateTime(2018, 1, 32) == sidereal.DateTime(2018, 2, 1)
+    assert sidereal.DateTime(2018, 1, 1, -1).day == 31
+    assert (sidereal.DateTime(2018, 1, 31) + sidereal.months(1)).month == 3
+    assert sidereal.DateTime(2000, 1, 1, 12).nanoseconds_since_j2000 == 0
+
+    linspace = sidereal.linspace(dtime1, dtime2, 86_401)
+    assert np.all(np.diff(linspace.nanoseconds_since_j2000()) == 1_000_000_000)
+
+
+def test_eop_lookup_outside_table():
+    dts = sidereal.linspace(
+        sidereal.DateTime(1960, 1, 1), sidereal.DateTime(2200, 1, 1), 10_001
+    )
+    assert np.all(np.isfinite(dts.ut1_minus_utc()))
+    assert np.all(np.isfinite(dts.px()))
+    assert dts.tai_minus_utc()[0] == 10
+    assert dts.tai_minus_utc()[-1] == 37
+    assert dts[0].tai_minus_utc == 10
+    assert sidereal.DateTime(2017, 1, 1).tai_minus_utc == 37
+    assert sidereal.DateTime(2016, 12, 31, 23, 59, 59).tai_minus_utc == 36
+
+
+def test_load_eop(tmp_path):
+    finals = tmp_path / "finals.data"
+    lines = []
+    for i in range(10):
+        mjd = 58000 + i
+        lines.append(
+            f"170904 {mjd:8.2f} I {0.1 + i / 100:9.6f}{0.0001:9.6f} {0.3:9.6f}{0.0001:9.6f}  I{0.25:10.7f}{0.00001:10.7f}"
+        )
+    finals.write_text("\n".join(lines) + "\n")
+    tai_utc = tmp_path / "tai-utc.dat"
+    tai_utc.write_text(
+        " 1972 JAN  1 =JD 2441317.5  TAI-UTC=  10.0       S + (MJD - 41317.) X 0.0      S\n"
+        " 2018 JAN  1 =JD 2458119.5  TAI-UTC=  37.0       S + (MJD - 41317.) X 0.0      S\n"
+    )
+    cache = tmp_path / "eop.cache"
+
+    try:
+        sidereal.load_eop(str(finals), str(tai_utc), str(cache))
+        assert sidereal.eop_mjd_range() == (58000, 58009)
+        dt = sidereal.DateTime(2017, 9, 5, 12)  # MJD 58001.5
+        assert abs(dt.px - 0.115) < 1e-12
+        assert dt.ut1_minus_utc == 0.25
+        assert dt.tai_minus_utc == 10
+
+        sidereal.reset_eop()
+        assert sidereal.DateTime(2017, 9, 5, 12).tai_minus_utc == 37
+        sidereal.load_eop_cache(str(cache))
+        assert abs(sidereal.DateTime(2017, 9, 5, 12).px - 0.115) < 1e-12
+    finally:
+        sidereal.reset_eop()
+
+
+def test_interpolated_nutation_matches_exact():
+    exact = sidereal.arange(dtime1, dtime2, sidereal.seconds(1))
+    try:
+        sidereal.set_interpolation_tolerance(1e-12)
+        assert sidereal.get_interpolation_tolerance() == 1e-12
+        interp = sidereal.arange(dtime1, dtime2, sidereal.seconds(1))
+        assert np.max(np.abs(interp.gast() - exact.gast())) < 1e-12
+        assert np.max(np.abs(interp.itrf_to_j2000() - exact.itrf_to_j2000())) < 1e-12
+    finally:
+        sidereal.set_interpolation_tolerance(0)
+
+
+def test_vector_transforms():
+    dtspace = sidereal.linspace(dtime1, dtime2, 1_000)
+    r_itrf = np.tile([6378.0, -1200.0, 300.0], (1_000, 1))
+    v_itrf = np.zeros((1_000, 3))
+
+    r_j2000 = dtspace.itrf_to_j2000(r_itrf)
+    expected = np.einsum("nij,nj->ni", dtspace.itrf_to_j2000(), r_itrf)
+    assert np.allclose(r_j2000, expected, rtol=0, atol=1e-9)
+
+    # a point fixed on the Earth moves with omega x r in the inertial frame
+    r_j2000, v_j2000 = dtspace.itrf_to_j2000(r_itrf, v_itrf)
+    assert np.allclose(np.linalg.norm(v_j2000[:, :2], axis=1), 7.292115146706979e-5 * np.hypot(6378.0, 1200.0), rtol=1e-4)
+
+    r_back, v_back = dtspace.j2000_to_itrf(r_j2000, v_j2000)
+    assert np.allclose(r_back, r_itrf, rtol=0, atol=1e-9)
+    assert np.allclose(v_back, v_itrf, rtol=0, atol=1e-12)
+    assert np.allclose(dtspace.j2000_to_teme(dtspace.teme_to_j2000(r_itrf)), r_itrf, rtol=0, atol=1e-9)
+
+
+def test_frame_graph_transform():
+    F = sidereal.Frame
+    dtspace = sidereal.linspace(dtime1, dtime2, 1_000)
+    assert np.allclose(dtspace.transform(F.ITRF, F.J2000), dtspace.itrf_to_j2000(), rtol=0, atol=1e-14)
+
+    to_j2000, to_itrf, to_tod = dtspace.transform(F.TEME, [F.J2000, F.ITRF, F.TOD])
+    teme_from_j2000 = dtspace.tod_to_teme() @ dtspace.mod_to_tod() @ dtspace.j2000_to_mod()
+    assert np.allclose(to_j2000, np.swapaxes(teme_from_j2000, 1, 2), rtol=0, atol=1e-14)
+    assert np.allclose(to_itrf, dtspace.gtod_to_itrf() @ dtspace.teme_to_gtod(), rtol=0, atol=1e-14)
+    assert np.allclose(to_tod, np.swapaxes(dtspace.tod_to_teme(), 1, 2), rtol=0, atol=1e-14)
+    assert np.allclose(dtspace[10].transform(F.TEME, [F.ITRF])[0], to_itrf[10], rtol=0, atol=1e-14)
+
+    r = np.tile([7000.0, 0.0, 0.0], (1_000, 1))
+    expected = np.einsum("nij,nj->ni", to_itrf, r)
+    assert np.allclose(dtspace.transform(F.TEME, F.ITRF, r), expected, rtol=0, atol=1e-9)
+
+
+def test_chunked_epochs_match_full_grid():
+    full = sidereal.arange(dtime1, dtime2, sidereal.seconds(1))
+    chunks = sidereal.arange_chunks(dtime1, dtime2, sidereal.seconds(1), chunk_size=10_000)
+    assert len(chunks) == 9 and chunks.n_epochs == len(full)
+    assert np.array_equal(np.concatenate([c.nanoseconds_since_j2000() for c in chunks]), full.nanoseconds_since_j2000())
+    assert np.array_equal(chunks[-1].gast(), full.gast()[80_000:])
+
+    full = sidereal.linspace(dtime1, dtime2, 12_345)
+    chunks = sidereal.linspace_chunks(dtime1, dtime2, 12_345, chunk_size=1_000)
+    assert np.array_equal(np.concatenate([c.jd_utc() for c in chunks]), full.jd_utc())
+
+    # past ~3e9 epochs the spacing remainder times the index no longer fits in 64 bits
+    num = 7_000_000_001  # 12342.857... ns apart, epoch 3.5e9 at noon
+    chunks = sidereal.linspace_chunks(dtime1, dtime2, num)
+    assert chunks.n_epochs == num
+    middle = 3_500_000_000
+    assert chunks[0][0] == dtime1 and chunks[-1][len(chunks[-1]) - 1] == dtime2
+    assert chunks[middle // chunks.chunk_size][middle % chunks.chunk_size] == sidereal.DateTime(2018, 1, 1, 12)
+
+
+def test_profile_stats():
+    sidereal.reset_profile_stats()
+    sidereal.linspace(dtime1, dtime2, 10_000).itrf_to_j2000()
+    stats = sidereal.profile_stats()
+    if not sidereal.profile_enabled():
+        assert stats == {}
+        return
+    assert stats["array.itrf_to_j2000"]["calls"] == 1
+    assert stats["nutation.series"]["items"] == 10_000
+    assert stats["array.evaluate_nutation"]["seconds"] > 0
+
+
+def test_numpy_constructors_round_trip():
+    dtspace = sidereal.linspace(dtime1, dtime2, 10_001)
+    ns = dtspace.nanoseconds_since_j2000()
+
+    times = dtspace.to_datetime64()
+    assert times.dtype == np.dtype("datetime64[ns]")
+    assert times[0] == np.datetime64("2018-01-01T00:00:00")
+    assert np.array_equal(sidereal.DateTimeArray.from_datetime64(times).nanoseconds_since_j2000(), ns)
+    assert np.array_equal(sidereal.DateTimeArray.from_datetime64(times.astype("datetime64[s]"))[-1].nanoseconds_since_j2000, ns[-1])
+    assert np.array_equal(sidereal.DateTimeArray.from_nanoseconds_since_j2000(ns).nanoseconds_since_j2000(), ns)
+
+    unix = dtspace.to_unix()
+    assert unix[0] == 1514764800.0
+    assert np.max(np.abs(sidereal.DateTimeArray.from_unix(unix).nanoseconds_since_j2000() - ns)) < 1_000
+    assert np.max(np.abs(sidereal.DateTimeArray.from_jd_utc(dtspace.jd_utc()).nanoseconds_since_j2000() - ns)) < 50_000
+    assert np.max(np.abs(sidereal.DateTimeArray.from_mjd_utc(dtspace.mjd_utc()).nanoseconds_since_j2000() - ns)) < 50_000
+
+    try:
+        sidereal.DateTimeArray.from_jd_utc(np.array([np.nan]))
+        assert False, "NaN epochs must be rejected"
+    except ValueError:
+        pass
+    try:
+        sidereal.DateTimeArray.from_jd_utc(np.array([0.0]))
+        assert False, "epochs before 1708 must be rejected"
+    except IndexError:
+        pass
+    try:
+        sidereal.DateTime(2300, 1, 1)
+        assert False, "epochs after 2291 must be rejected"
+    except IndexError:
+        pass
+    try:
+        # about 2554, times 10**9 wraps around to 1970-01-01T00:00:00.29
+        sidereal.DateTimeArray.from_datetime64(np.array([18_446_744_074], dtype="datetime64[s]"))
+        assert False, "datetime64 epochs past 2262 must be rejected before converting to nanoseconds"
+    except IndexError:
+        pass
+    try:
+        sidereal.DateTimeArray([sidereal.DateTime(2280, 1, 1)]).to_datetime64()
+        assert False, "epochs past 2262 have no datetime64[ns]"
+    except IndexError:
+        pass
+
+
+def test_calendar_columns():
+    dtspace = sidereal.linspace(dtime1, sidereal.DateTime(2024, 3, 1, 7, 8, 9, 10), 1_001)
+    for i in [0, 17, 500, 1_000]:
+        dt = dtspace[i]
+        assert dtspace.year()[i] == dt.year and dtspace.month()[i] == dt.month and dtspace.day()[i] == dt.day
+        assert dtspace.hour()[i] == dt.hour and dtspace.minute()[i] == dt.minute and dtspace.second()[i] == dt.second
+        assert dtspace.nanosecond()[i] == dt.nanosecond
+
+    rebuilt = sidereal.DateTimeArray.from_calendar(
+        dtspace.year(), dtspace.month(), dtspace.day(), dtspace.hour(), dtspace.minute(), dtspace.second(), dtspace.nanosecond()
+    )
+    assert np.array_equal(rebuilt.nanoseconds_since_j2000(), dtspace.nanoseconds_since_j2000())
+
+    days = sidereal.DateTimeArray.from_calendar(np.array([2020, 2021]), np.array([2, 13]), np.array([30, 1]))
+    assert days[0] == sidereal.DateTime(2020, 3, 1) and days[1] == sidereal.DateTime(2022, 1, 1)
+
+
+def test_datetime_array_shift_in_place():
+    dtspace = sidereal.linspace(dtime1, dtime2, 10_001)
+    gast = dtspace.gast()
+    delta = sidereal.TimeDelta(nanoseconds=250_000_000)
+    expected = sidereal.linspace(dtime1, dtime2, 10_001) + delta
+
+    dtspace += delta
+    assert np.array_equal(dtspace.nanoseconds_since_j2000(), expected.nanoseconds_since_j2000())
+    assert np.array_equal(gast, expected.gast())  # the view handed out earlier follows the shift
+    assert np.array_equal(dtspace.jd_utc(), expected.jd_utc())
+
+    dtspace -= delta
+    assert dtspace[0] == dtime1 and dtspace[10_000] == dtime2
+    assert (dtspace - delta)[0] == dtime1 - delta
+
+
+def test_datetime_array_shift_in_place_with_readers():
+    n, shifts = 20_000, 4
+    delta = sidereal.seconds(30)
+    expected = [sidereal.linspace(dtime1, dtime2, n) + sidereal.seconds(30 * k) for k in range(shifts + 1)]
+    expected_gast = [np.array(e.gast()) for e in expected]
+    expected_mats = [np.array(e.itrf_to_j2000()) for e in expected]
+
+    for _ in range(3):
+        shared = sidereal.linspace(dtime1, dtime2, n)  # nothing evaluated, readers race to fill the columns
+        barrier = threading.Barrier(5)
+
+        def read(i):
+            barrier.wait()
+            consistent = True
+            for _ in range(4):
+                mats = shared.itrf_to_j2000()  # one shift state per call
+                consistent &= any(np.array_equal(mats, m) for m in expected_mats)
+                shared.gast()
+            return consistent
+
+        with ThreadPoolExecutor(max_workers=4) as pool:
+            readers = pool.map(read, range(4))
+            barrier.wait()
+            for _ in range(shifts):
+                shared += delta
+            assert all(readers)
+
+        assert np.array_equal(shared.nanoseconds_since_j2000(), expected[-1].nanoseconds_since_j2000())
+        assert np.array_equal(shared.gast(), expected_gast[-1])
+        assert np.array_equal(shared.itrf_to_j2000(), expected_mats[-1])
+        assert np.array_equal(shared.jd_utc(), expected[-1].jd_utc())
+
+
+def test_isa_levels_agree():
+    selected = sidereal.get_isa()
+    results = []
+    try:
+        for isa in ["baseline", "avx2", "avx512"]:
+            try:
+                sidereal.set_isa(isa)
+            except ValueError:
+                break  # the CPU lacks this level and the ones above
+            assert sidereal.get_isa() == isa
+            dtspace = sidereal.linspace(dtime1, dtime2, 1_001)
+            results.append((dtspace.gast(), dtspace.itrf_to_j2000(), dtspace.jd_utc()))
+    finally:
+        sidereal.set_isa(selected)
+    # fused multiply-adds may change the last bits
+    for gast, matrices, jd in results[1:]:
+        assert np.allclose(gast, results[0][0], rtol=0, atol=1e-12)
+        assert np.allclose(matrices, results[0][1], rtol=0, atol=1e-12)
+        assert np.array_equal(jd, results[0][2])
+
+    try:
+        sidereal.set_isa("sse9")
+        assert False, "unknown instruction sets must be rejected"
+    except ValueError:
+        pass
+
+
+def test_batch_sidereal_time():
+    dtspace = sidereal.linspace(dtime1, dtime2, 10_001)
+    angles = sidereal.sidereal_time(dtspace.jd_ut1(), dtspace.jd_tt(), rates=True)
+    assert np.array_equal(angles["gmst"], dtspace.gmst())
+    assert np.array_equal(angles["gast"], dtspace.gast())
+    assert np.all((angles["era"] >= 0) & (angles["era"] < 2 * np.pi))
+    assert np.max(np.abs(np.angle(np.exp(1j * (angles["gmst"] - angles["era"]))))) < 1e-2  # accumulated precession since J2000
+    assert np.allclose(angles["gmst_rate"], 7.2921158e-5, rtol=1e-7)
+    assert np.array_equal(angles["gast_rate"], angles["gmst_rate"])
+
+    gmst_only = sidereal.sidereal_time(dtspace.jd_ut1())
+    assert "gast" not in gmst_only and np.array_equal(gmst_only["gmst"], angles["gmst"])
+
+
+def test_look_angles():
+    dtspace = sidereal.linspace(dtime1, dtime2, 1_000)
+    r_itrf = np.tile([7000.0, 0.0, 0.0], (1_000, 1))  # fixed over the equator at longitude 0
+    sites = np.array([[0.0, 0.0, 0.0], [0.0, np.pi / 2, 0.0], [0.2, 0.0, 0.1]])
+
+    angles = dtspace.look_angles(dtspace.itrf_to_j2000(r_itrf), sites, min_elevation=np.radians(10))
+    assert angles["elevation"].shape == (3, 1_000)
+    assert np.allclose(angles["elevation"][0], np.pi / 2, atol=1e-9)
+    assert np.allclose(angles["range"][0], 7000.0 - 6378.137, atol=1e-6)
+    assert np.allclose(angles["azimuth"][1], 3 * np.pi / 2, atol=1e-9)  # looks west, below the horizon
+    assert not angles["visible"][1].any() and angles["visible"][0].all()
+    assert np.allclose(angles["azimuth"][2], np.pi, atol=1e-9)  # due south
+    assert np.allclose(angles["elevation"][2], np.radians(19.262053678), atol=1e-9) and angles["visible"][2].all()
+
+
+def test_quaternions_and_rotation_history():
+    dtspace = sidereal.linspace(dtime1, dtime2, 1_000)
+    quats = dtspace.itrf_to_j2000(quaternions=True)
+    assert quats.shape == (1_000, 4) and np.all(quats[:, 3] >= 0)
+    x, y, z, w = quats.T
+    first_row = np.stack([1 - 2 * (y**2 + z**2), 2 * (x * y - z * w), 2 * (x * z + y * w)], axis=1)
+    assert np.allclose(first_row, dtspace.itrf_to_j2000()[:, 0, :], rtol=0, atol=1e-14)
+    single = dtspace.transform_quaternions(sidereal.Frame.ITRF, sidereal.Frame.J2000, dtype=np.float32)
+    assert single.dtype == np.float32 and np.allclose(single, quats, rtol=0, atol=1e-7)
+
+    keys = sidereal.arange(dtime1, dtime2 + sidereal.hours(1), sidereal.minutes(10))
+    history = keys.rotation_history(sidereal.Frame.ITRF, sidereal.Frame.J2000)
+    assert len(history) == len(keys) and history.max_error < 1e-8
+    dense = sidereal.linspace(dtime1, dtime2, 5_000)
+    assert np.allclose(history.matrices(dense), dense.itrf_to_j2000(), rtol=0, atol=1e-8)
+
+    try:
+        history.quaternions(sidereal.linspace(dtime1 - sidereal.days(1), dtime1, 2))
+        assert False, "epochs before the first keyframe must be rejected"
+    except IndexError:
+        pass
+
+
+
+def test_time_scale_conversions():
+    scale = sidereal.TimeScale
+    dtspace = sidereal.linspace(dtime1, dtime2, 1_000)
+    jd_utc = dtspace.jd_utc()
+    assert np.allclose(sidereal.convert_time_scale(jd_utc, scale.UTC, scale.TT), dtspace.jd_tt(), rtol=0, atol=1e-9)
+    assert np.allclose(sidereal.convert_time_scale(jd_utc, scale.UTC, scale.UT1), dtspace.jd_ut1(), rtol=0, atol=1e-9)
+
+    ns = dtspace.nanoseconds_since_j2000()
+    gps = sidereal.convert_time_scale(ns, scale.UTC, scale.GPS)
+    assert gps.dtype == np.int64 and np.all(gps - ns == 18_000_000_000)
+    for to in [scale.TAI, scale.TT, scale.UT1, scale.GPS, scale.TDB]:
+        back = sidereal.convert_time_scale(sidereal.convert_time_scale(ns, scale.UTC, to), to, scale.UTC)
+        assert np.abs(back - ns).max() <= 1, to
+
+    # across the leap second at the end of 2016, half a second apart
+    leap = sidereal.DateTime(2017, 1, 1).nanoseconds_since_j2000
+    utc = leap + np.arange(-4, 4) * 500_000_000
+    tai = sidereal.convert_time_scale(utc, scale.UTC, scale.TAI)
+    assert np.array_equal(tai - utc, [36_000_000_000] * 4 + [37_000_000_000] * 4)
+    ut1 = sidereal.convert_time_scale(utc, scale.UTC, scale.UT1)
+    assert np.all(np.abs(np.diff(ut1 - tai)) < 100)  # UT1 runs on through the step of UTC
+    during = sidereal.convert_time_scale(np.array([leap + 36_500_000_000]), scale.TAI, scale.UTC)
+    assert during[0] == leap - 500_000_000  # 23:59:60.5 reads 23:59:59.5 again
+
 def test_jd_to_datetime():
     now = sidereal.now()
     jd = now.jd_utc
@@ -135,6 +530,23 @@ def test_timedelta_total_seconds():
     dt = sidereal.days(1)
     assert dt.total_seconds() == 86400
 
+def test_threaded_linspace_matches_serial():
+    try:
+        sidereal.set_num_threads(1)
+        serial = sidereal.linspace(dtime1, dtime2, 100_000)
+        sidereal.set_num_threads(4)
+        assert sidereal.get_num_threads() == 4
+        threaded = sidereal.linspace(dtime1, dtime2, 100_000)
+    finally:
+        sidereal.set_num_threads(0)
+
+    assert np.array_equal(serial.jd_utc(), threaded.jd_utc())
+    assert np.array_equal(serial.gast(), threaded.gast())
+    assert np.array_equal(
+        (serial + sidereal.seconds(30)).jd_utc(),
+        (threaded + sidereal.seconds(30)).jd_utc(),
+    )
+
 
 if __name__ == "__main__":
     tic("init linspace")